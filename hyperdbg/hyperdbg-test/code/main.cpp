@@ -133,6 +133,30 @@ main(int argc, char * argv[])
             printf("\n[x] The script variable-type test cases failed\n");
         }
     }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_SCRIPT_COMPILE_TIME))
+    {
+        if (TestScriptEngineCompileTime())
+        {
+            printf("\n[*] The script compile-time benchmark finished successfully\n");
+            TestResult = TRUE;
+        }
+        else
+        {
+            printf("\n[x] The script compile-time benchmark failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_SCRIPT_OPTIMIZER))
+    {
+        if (TestScriptEngineOptimizer())
+        {
+            printf("\n[*] The script optimizer test cases passed successfully\n");
+            TestResult = TRUE;
+        }
+        else
+        {
+            printf("\n[x] The script optimizer test cases failed\n");
+        }
+    }
     else
     {
         printf("unknown test case\n");
@@ -0,0 +1,107 @@
+/**
+ * @file test-script-compile-time.cpp
+ * @brief Compile-time benchmark of the script engine for scripts with many variables.
+ */
+#include "pch.h"
+
+/**
+ * @brief Creates a script that declares and references the given number of variables
+ *
+ * @param VariableCount
+ * @return std::string
+ */
+static std::string
+CreateManyVariablesScript(UINT32 VariableCount)
+{
+    std::ostringstream Script;
+
+    Script << "{ ";
+
+    for (UINT32 Index = 0; Index < VariableCount; Index++)
+    {
+        Script << "compileVar" << Index << " = " << Index << "; ";
+    }
+
+    //
+    // Reference every variable again, so the lookups (not only the
+    // declarations) are part of the measurement
+    //
+    for (UINT32 Index = 1; Index < VariableCount; Index++)
+    {
+        Script << "compileVar" << Index << " = compileVar" << Index << " + compileVar" << Index - 1 << "; ";
+    }
+
+    Script << "}";
+
+    return Script.str();
+}
+
+/**
+ * @brief Measures the average compile time of a script
+ *
+ * @param Script
+ * @param Iterations
+ * @param AverageMicroseconds
+ * @return BOOLEAN
+ */
+static BOOLEAN
+MeasureScriptCompileTime(const std::string & Script, UINT32 Iterations, double * AverageMicroseconds)
+{
+    std::vector<CHAR> ScriptCopy(Script.begin(), Script.end());
+    ScriptCopy.push_back('\0');
+
+    auto Start = std::chrono::steady_clock::now();
+
+    for (UINT32 Index = 0; Index < Iterations; Index++)
+    {
+        PSYMBOL_BUFFER Buffer = (PSYMBOL_BUFFER)ScriptEngineParse(ScriptCopy.data());
+
+        if (!Buffer || Buffer->Message)
+        {
+            std::cerr << "Unable to compile the benchmark script: "
+                      << (Buffer && Buffer->Message ? Buffer->Message : "no buffer") << std::endl;
+
+            if (Buffer)
+                RemoveSymbolBuffer(Buffer);
+
+            return FALSE;
+        }
+
+        RemoveSymbolBuffer(Buffer);
+    }
+
+    auto End = std::chrono::steady_clock::now();
+
+    *AverageMicroseconds = std::chrono::duration<double, std::micro>(End - Start).count() / Iterations;
+
+    return TRUE;
+}
+
+/**
+ * @brief Compile-time benchmark for scripts with 10, 100 and 500 variables
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestScriptEngineCompileTime()
+{
+    const UINT32 VariableCounts[] = {10, 100, 500};
+    const UINT32 Iterations       = 20;
+
+    for (UINT32 VariableCount : VariableCounts)
+    {
+        double AverageMicroseconds = 0;
+
+        if (!MeasureScriptCompileTime(CreateManyVariablesScript(VariableCount), Iterations, &AverageMicroseconds))
+        {
+            return FALSE;
+        }
+
+        printf("compiling a script with %4u variables: %10.1f us (%.2f us per variable)\n",
+               VariableCount,
+               AverageMicroseconds,
+               AverageMicroseconds / VariableCount);
+    }
+
+    return TRUE;
+}
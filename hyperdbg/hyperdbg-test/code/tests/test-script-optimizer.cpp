@@ -0,0 +1,180 @@
+/**
+ * @file test-script-optimizer.cpp
+ * @brief Differential (-O0 vs. -O1) and IR tests for the optimizer of the script engine.
+ */
+#include "pch.h"
+
+static std::string CapturedScriptOutput;
+
+static VOID
+CaptureScriptOutput(CHAR * Message)
+{
+    if (Message)
+    {
+        CapturedScriptOutput.append(Message);
+    }
+}
+
+static BOOLEAN
+RunScriptWithOptimizationLevel(const CHAR * Script, UINT32 Level, std::string & Output)
+{
+    ScriptEngineSetOptimizationLevel(Level);
+
+    CapturedScriptOutput.clear();
+    hyperdbg_u_set_text_message_callback((PVOID)CaptureScriptOutput);
+    BOOLEAN Result = hyperdbg_u_test_script_engine((CHAR *)Script);
+    hyperdbg_u_unset_text_message_callback();
+
+    Output = CapturedScriptOutput;
+    return Result;
+}
+
+/**
+ * @brief Runs a script once without and once with the optimizer, both runs
+ * must have the same result and the same output
+ */
+static BOOLEAN
+RunScriptDifferential(const CHAR * Script)
+{
+    std::string UnoptimizedOutput;
+    std::string OptimizedOutput;
+
+    BOOLEAN UnoptimizedResult = RunScriptWithOptimizationLevel(Script, 0, UnoptimizedOutput);
+    BOOLEAN OptimizedResult   = RunScriptWithOptimizationLevel(Script, 1, OptimizedOutput);
+
+    if (UnoptimizedResult != OptimizedResult || UnoptimizedOutput != OptimizedOutput)
+    {
+        std::cerr << "Optimized script behaves differently: " << Script
+                  << "\n-O0 (" << (UnoptimizedResult ? "success" : "failure") << "): " << UnoptimizedOutput
+                  << "\n-O1 (" << (OptimizedResult ? "success" : "failure") << "): " << OptimizedOutput << std::endl;
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static BOOLEAN
+CompileWithOptimizationLevel(const CHAR * Script, UINT32 Level, PSYMBOL_BUFFER * Buffer)
+{
+    ScriptEngineSetOptimizationLevel(Level);
+    *Buffer = (PSYMBOL_BUFFER)ScriptEngineParse((CHAR *)Script);
+
+    if (!*Buffer || (*Buffer)->Message)
+    {
+        if (*Buffer)
+        {
+            RemoveSymbolBuffer(*Buffer);
+            *Buffer = NULL;
+        }
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static BOOLEAN
+BufferHasOperator(PSYMBOL_BUFFER Buffer, UINT64 Operator)
+{
+    for (UINT32 Index = 0; Index < Buffer->Pointer; Index++)
+    {
+        if (Buffer->Head[Index].Type == SYMBOL_SEMANTIC_RULE_TYPE && Buffer->Head[Index].Value == Operator)
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Constant expressions and untaken branches must be removed by -O1
+ */
+static BOOLEAN
+TestOptimizerIr()
+{
+    const CHAR *   Script = "{ int value = 2 + 3; if (value > 9) { printf(\"never\\n\"); } printf(\"%d\\n\", value * 4); }";
+    PSYMBOL_BUFFER Unoptimized;
+    PSYMBOL_BUFFER Optimized;
+    BOOLEAN        Result;
+
+    if (!CompileWithOptimizationLevel(Script, 0, &Unoptimized))
+    {
+        return FALSE;
+    }
+
+    if (!CompileWithOptimizationLevel(Script, 1, &Optimized))
+    {
+        RemoveSymbolBuffer(Unoptimized);
+        return FALSE;
+    }
+
+    Result = BufferHasOperator(Unoptimized, FUNC_ADD_TYPED) && BufferHasOperator(Unoptimized, FUNC_JZ) &&
+             !BufferHasOperator(Optimized, FUNC_ADD_TYPED) && !BufferHasOperator(Optimized, FUNC_MUL_TYPED) &&
+             !BufferHasOperator(Optimized, FUNC_JZ) && BufferHasOperator(Optimized, FUNC_PRINTF) &&
+             Optimized->Pointer < Unoptimized->Pointer;
+
+    RemoveSymbolBuffer(Unoptimized);
+    RemoveSymbolBuffer(Optimized);
+
+    return Result;
+}
+
+static BOOLEAN
+TestOptimizerDifferentialCases()
+{
+    const CHAR * Scripts[] = {
+        "{ int value = 2 + 3; printf(\"%d\\n\", value); }",
+        "{ int first = 3; int second = first; int third = second; first = 9; printf(\"%d %d %d\\n\", first, second, third); }",
+        "{ int value = 3; int other = 4; int swap = value; value = other; other = swap; printf(\"%d %d\\n\", value, other); }",
+        "{ int value = 3; value += 4; value -= 1; value *= 5; value /= 2; value %= 7; value <<= 2; value >>= 1; value |= 0x10; value &= 0x1f; value ^= 3; printf(\"%d\\n\", value); }",
+        "{ int flag = !5; int flag2 = ~5; int flag3 = -5; printf(\"%d %d %d\\n\", flag, flag2, flag3); }",
+        "{ unsigned char narrow = 250; narrow = narrow + 10; short sword = 0x8000; bool truth = 5; printf(\"%d %lld %d\\n\", narrow, sword, truth); }",
+        "{ int negative = -5; int positive = 3; printf(\"%d %d %d\\n\", negative / positive, negative % positive, negative >> 1); }",
+        "{ int minimum = 0x80000000; int result = minimum / -1; printf(\"%d\\n\", result); }",
+        "{ int total = 0; for (int idx = 0; idx < 10; idx++) { if (idx == 5) { continue; } if (idx == 8) { break; } total += idx; } printf(\"%d\\n\", total); }",
+        "{ int value = 0; do { value = value + 3; } while (value < 20); printf(\"%d\\n\", value); }",
+        "{ int value = 0; while (0) { value = 1; } while (1) { value++; if (value > 5) { break; } } printf(\"%d\\n\", value); }",
+        "{ if (2 > 3) { printf(\"yes\\n\"); } else { printf(\"no\\n\"); } }",
+        "{ int myfibonacci(int var1) { if (var1 == 0) { return 0; } if (var1 == 1) { return 1; } return myfibonacci(var1 - 1) + myfibonacci(var1 - 2); } printf(\"%d\\n\", myfibonacci(12)); }",
+        "{ int twice(int num) { int result = num + num; return result; } printf(\"%d %d\\n\", twice(4), twice(twice(3))); }",
+        "{ int value = 5; int * ptr = &value; int copy = value; value = 7; printf(\"%d %d\\n\", copy, *ptr); }",
+        "{ optimizerGlobal = 5; optimizerGlobal2 = optimizerGlobal * 2; optimizerGlobal = 1; printf(\"%d %d\\n\", optimizerGlobal, optimizerGlobal2); }",
+        "{ optimizerLength = strlen(\"hello\"); printf(\"%d %d\\n\", optimizerLength, 5); }",
+        "{ double dvalue = 2.5; double dother = dvalue * 2.0; int sum = 3 + 4; if (dother == 5.0) { printf(\"ok %d\\n\", sum); } }",
+
+        //
+        // Runtime errors must not be folded away
+        //
+        "{ int value = 7; int other = value / 0; printf(\"%d\\n\", other); }",
+        "{ int value = 1 % 0; }",
+        "{ optimizerGlobal = 10 / 0; }",
+        "{ int shifted = 1 << 40; }",
+        "{ long long big = 0x8000000000000000; big = big / -1; }",
+    };
+
+    for (const CHAR * Script : Scripts)
+    {
+        if (!RunScriptDifferential(Script))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Tests the optimizer of the script engine
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestScriptEngineOptimizer()
+{
+    UINT32  PreviousLevel = ScriptEngineGetOptimizationLevel();
+    BOOLEAN Result        = TestOptimizerIr() && TestOptimizerDifferentialCases();
+
+    ScriptEngineSetOptimizationLevel(PreviousLevel);
+
+    return Result;
+}
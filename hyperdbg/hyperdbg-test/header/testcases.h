@@ -32,3 +32,9 @@ TestScriptEngineFloatingPoint();
 
 BOOLEAN
 TestScriptEngineVariableTypes();
+
+BOOLEAN
+TestScriptEngineCompileTime();
+
+BOOLEAN
+TestScriptEngineOptimizer();
@@ -916,6 +916,45 @@ MemoryMapperWriteMemorySafeByPte(PVOID            SourceVA,
     return TRUE;
 }
 
+/**
+ * @brief Map a physical page into a reserved mapping address by its PTE
+ * @details The page remains mapped until the PTE is cleared by the caller
+ *
+ * @param PhysicalAddress Physical address of the page
+ * @param PteVaAddress Virtual Address of PTE
+ * @param MappingVa Mapping virtual address
+ *
+ * @return PVOID The virtual address of the physical address in the mapping
+ */
+_Use_decl_annotations_
+PVOID
+MemoryMapperMapPhysicalPageByPte(UINT64 PhysicalAddress,
+                                 UINT64 PteVaAddress,
+                                 UINT64 MappingVa)
+{
+    PAGE_ENTRY  PageEntry;
+    PPAGE_ENTRY Pte = (PAGE_ENTRY *)PteVaAddress;
+
+    //
+    // Same as the entries of the read and write wrappers, a present,
+    // writable and global page of the target PFN
+    //
+    PageEntry.Flags                  = Pte->Flags;
+    PageEntry.Fields.Present         = 1;
+    PageEntry.Fields.Write           = 1;
+    PageEntry.Fields.Global          = 1;
+    PageEntry.Fields.PageFrameNumber = PhysicalAddress >> 12;
+
+    //
+    // Apply the page entry in a single instruction
+    //
+    Pte->Flags = PageEntry.Flags;
+
+    CpuInvlpg((PVOID)MappingVa);
+
+    return (PVOID)(MappingVa + (PAGE_4KB_OFFSET & PhysicalAddress));
+}
+
 /**
  * @brief Wrapper to read the memory safely by mapping the
  * buffer by physical address (It's a wrapper)
@@ -1196,6 +1235,44 @@ MemoryMapperReadMemorySafeOnTargetProcess(UINT64 VaAddressToRead, PVOID BufferTo
     return Result;
 }
 
+/**
+ * @brief Read memory safely on the target process memory by the translation
+ * cache of the current core
+ * @details The translations remain valid until the cache is invalidated by
+ * MemoryMapperInvalidateTranslationCache
+ *
+ * @param VaAddressToRead Virtual Address to read
+ * @param BufferToSaveMemory Destination to save
+ * @param SizeToRead Size
+ * @return BOOLEAN if it was successful the returns TRUE and if it was
+ * unsuccessful (the memory is not valid) then it returns FALSE
+ */
+_Use_decl_annotations_
+BOOLEAN
+MemoryMapperReadMemorySafeOnTargetProcessCached(UINT64 VaAddressToRead, PVOID BufferToSaveMemory, SIZE_T SizeToRead)
+{
+    ULONG CurrentCore = KeGetCurrentProcessorNumberEx(NULL);
+
+    return TranslationCacheReadMemory(&g_MemoryMapper[CurrentCore].TranslationCache,
+                                      LayoutGetCurrentProcessCr3(),
+                                      VaAddressToRead,
+                                      BufferToSaveMemory,
+                                      SizeToRead);
+}
+
+/**
+ * @brief Invalidate the translation cache of the current core
+ *
+ * @return VOID
+ */
+VOID
+MemoryMapperInvalidateTranslationCache()
+{
+    ULONG CurrentCore = KeGetCurrentProcessorNumberEx(NULL);
+
+    TranslationCacheInvalidate(&g_MemoryMapper[CurrentCore].TranslationCache);
+}
+
 /**
  * @brief Write memory safely by mapping the buffer on the target process memory (It's a wrapper)
  *
@@ -1241,6 +1318,189 @@ MemoryMapperWriteMemorySafeOnTargetProcess(UINT64 Destination, PVOID Source, SIZ
     return Result;
 }
 
+/**
+ * @brief Copy memory safely between two buffers of the target process memory
+ * @details Each page of the source and the destination is translated and
+ * validated once (by the translation cache of the current core) and mapped
+ * once, then the data is copied directly between the mapped pages, the
+ * buffers might overlap
+ *
+ * @param Destination Virtual Address to write
+ * @param Source Virtual Address to read
+ * @param Size Size
+ * @return BOOLEAN if it was successful the returns TRUE and if it was
+ * unsuccessful (the memory is not valid) then it returns FALSE
+ */
+_Use_decl_annotations_
+BOOLEAN
+MemoryMapperCopyMemorySafeOnTargetProcess(UINT64 Destination, UINT64 Source, SIZE_T Size)
+{
+    ULONG                    CurrentCore           = KeGetCurrentProcessorNumberEx(NULL);
+    PMEMORY_MAPPER_ADDRESSES Mapper                = &g_MemoryMapper[CurrentCore];
+    CR3_TYPE                 GuestCr3              = LayoutGetCurrentProcessCr3();
+    BOOLEAN                  Backward              = Destination > Source && Destination - Source < Size;
+    UINT64                   MappedSourcePage      = MAXULONG64;
+    UINT64                   MappedDestinationPage = MAXULONG64;
+    UINT64                   Done                  = 0;
+    BOOLEAN                  Result                = TRUE;
+    UINT64                   Offset;
+    UINT64                   Chunk;
+    UINT64                   SourcePa;
+    UINT64                   DestinationPa;
+    PVOID                    SourceVa;
+    PVOID                    DestinationVa;
+
+    while (Done < Size)
+    {
+        //
+        // Each chunk ends at a page boundary of either the source or the
+        // destination, overlapped buffers are copied from the end
+        //
+        if (Backward)
+        {
+            Offset = Size - Done;
+            Chunk  = ((Source + Offset - 1) & PAGE_4KB_OFFSET) + 1;
+
+            if (Chunk > ((Destination + Offset - 1) & PAGE_4KB_OFFSET) + 1)
+            {
+                Chunk = ((Destination + Offset - 1) & PAGE_4KB_OFFSET) + 1;
+            }
+            if (Chunk > Offset)
+            {
+                Chunk = Offset;
+            }
+
+            Offset = Offset - Chunk;
+        }
+        else
+        {
+            Offset = Done;
+            Chunk  = PAGE_SIZE - ((Source + Offset) & PAGE_4KB_OFFSET);
+
+            if (Chunk > PAGE_SIZE - ((Destination + Offset) & PAGE_4KB_OFFSET))
+            {
+                Chunk = PAGE_SIZE - ((Destination + Offset) & PAGE_4KB_OFFSET);
+            }
+            if (Chunk > Size - Done)
+            {
+                Chunk = Size - Done;
+            }
+        }
+
+        if (!TranslationCacheTranslate(&Mapper->TranslationCache, GuestCr3, Source + Offset, &SourcePa) ||
+            !TranslationCacheTranslate(&Mapper->TranslationCache, GuestCr3, Destination + Offset, &DestinationPa))
+        {
+            Result = FALSE;
+            break;
+        }
+
+        //
+        // The pages are only mapped again if the chunk is on another page
+        //
+        if ((DestinationPa & ~PAGE_4KB_OFFSET) != MappedDestinationPage)
+        {
+            MappedDestinationPage = DestinationPa & ~PAGE_4KB_OFFSET;
+            MemoryMapperMapPhysicalPageByPte(MappedDestinationPage,
+                                             Mapper->PteVirtualAddressForWrite,
+                                             Mapper->VirualAddressForWrite);
+        }
+
+        DestinationVa = (PVOID)(Mapper->VirualAddressForWrite + (DestinationPa & PAGE_4KB_OFFSET));
+
+        if ((SourcePa & ~PAGE_4KB_OFFSET) == MappedDestinationPage)
+        {
+            //
+            // Both of the virtual addresses are on the same physical page
+            //
+            SourceVa = (PVOID)(Mapper->VirualAddressForWrite + (SourcePa & PAGE_4KB_OFFSET));
+            memmove(DestinationVa, SourceVa, Chunk);
+        }
+        else
+        {
+            if ((SourcePa & ~PAGE_4KB_OFFSET) != MappedSourcePage)
+            {
+                MappedSourcePage = SourcePa & ~PAGE_4KB_OFFSET;
+                MemoryMapperMapPhysicalPageByPte(MappedSourcePage,
+                                                 Mapper->PteVirtualAddressForRead,
+                                                 Mapper->VirualAddressForRead);
+            }
+
+            SourceVa = (PVOID)(Mapper->VirualAddressForRead + (SourcePa & PAGE_4KB_OFFSET));
+            memcpy(DestinationVa, SourceVa, Chunk);
+        }
+
+        Done = Done + Chunk;
+    }
+
+    //
+    // Unmap addresses
+    //
+    ((PPAGE_ENTRY)Mapper->PteVirtualAddressForRead)->Flags  = NULL64_ZERO;
+    ((PPAGE_ENTRY)Mapper->PteVirtualAddressForWrite)->Flags = NULL64_ZERO;
+
+    //
+    // The written memory might be a part of the paging structures
+    //
+    TranslationCacheInvalidate(&Mapper->TranslationCache);
+
+    return Result;
+}
+
+/**
+ * @brief Zero memory safely on the target process memory
+ * @details Each page is translated, validated and mapped once
+ *
+ * @param Destination Virtual Address to zero
+ * @param Size Size
+ * @return BOOLEAN if it was successful the returns TRUE and if it was
+ * unsuccessful (the memory is not valid) then it returns FALSE
+ */
+_Use_decl_annotations_
+BOOLEAN
+MemoryMapperZeroMemorySafeOnTargetProcess(UINT64 Destination, SIZE_T Size)
+{
+    ULONG                    CurrentCore = KeGetCurrentProcessorNumberEx(NULL);
+    PMEMORY_MAPPER_ADDRESSES Mapper      = &g_MemoryMapper[CurrentCore];
+    CR3_TYPE                 GuestCr3    = LayoutGetCurrentProcessCr3();
+    BOOLEAN                  Result      = TRUE;
+    UINT64                   Chunk;
+    UINT64                   DestinationPa;
+
+    while (Size != 0)
+    {
+        Chunk = PAGE_SIZE - (Destination & PAGE_4KB_OFFSET);
+
+        if (Chunk > Size)
+        {
+            Chunk = Size;
+        }
+
+        if (!TranslationCacheTranslate(&Mapper->TranslationCache, GuestCr3, Destination, &DestinationPa))
+        {
+            Result = FALSE;
+            break;
+        }
+
+        memset(MemoryMapperMapPhysicalPageByPte(DestinationPa,
+                                                Mapper->PteVirtualAddressForWrite,
+                                                Mapper->VirualAddressForWrite),
+               0,
+               Chunk);
+
+        Destination = Destination + Chunk;
+        Size        = Size - Chunk;
+    }
+
+    //
+    // Unmap address
+    //
+    ((PPAGE_ENTRY)Mapper->PteVirtualAddressForWrite)->Flags = NULL64_ZERO;
+
+    TranslationCacheInvalidate(&Mapper->TranslationCache);
+
+    return Result;
+}
+
 /**
  * @brief Decides about making the address and converting the address
  * to physical address based on the passed parameters
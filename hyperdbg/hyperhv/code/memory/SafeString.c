@@ -0,0 +1,286 @@
+/**
+ * @file SafeString.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Page-granular safe string and memory functions
+ * @details The memory is validated once per page and read by chunks (at most
+ * SAFE_STRING_CHUNK_SIZE bytes which never pass the end of the validated page),
+ * then the chunks are scanned a word at a time
+ *
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief An address that is never page aligned, used as the initial value
+ * of the validated pages
+ *
+ */
+#define SAFE_STRING_NO_VALIDATED_PAGE ((UINT64)-1)
+
+/**
+ * @brief Check whether a 64-bit word contains a null character
+ *
+ * @param Word
+ * @param CharSize Size of the characters (1 or 2)
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SafeStringWordHasNull(UINT64 Word, UINT32 CharSize)
+{
+    if (CharSize == sizeof(CHAR))
+    {
+        return ((Word - 0x0101010101010101ULL) & ~Word & 0x8080808080808080ULL) != 0;
+    }
+    else
+    {
+        return ((Word - 0x0001000100010001ULL) & ~Word & 0x8000800080008000ULL) != 0;
+    }
+}
+
+/**
+ * @brief Get a character from a chunk
+ * @details The CHAR characters are signed (the same as the comparison of
+ * the vmx-root compatible functions)
+ *
+ * @param Buffer
+ * @param CharSize Size of the characters (1 or 2)
+ *
+ * @return INT32
+ */
+static INT32
+SafeStringGetCharacter(const CHAR * Buffer, UINT32 CharSize)
+{
+    WCHAR WideCharacter;
+
+    if (CharSize == sizeof(CHAR))
+    {
+        return (INT32)Buffer[0];
+    }
+
+    memcpy(&WideCharacter, Buffer, sizeof(WCHAR));
+
+    return (INT32)WideCharacter;
+}
+
+/**
+ * @brief Read a chunk of the memory safely
+ * @details The page of the address is validated only if it's not the same
+ * as the previously validated page, the chunk doesn't pass the end of the
+ * page unless a single character is placed on two pages
+ *
+ * @param Address
+ * @param Buffer
+ * @param MaximumSize Maximum size of the chunk (a multiple of CharSize)
+ * @param CharSize Size of the characters
+ * @param ValidatedPage The last validated page
+ * @param ChunkSize Size of the read chunk (a multiple of CharSize)
+ *
+ * @return BOOLEAN FALSE if the memory is not valid
+ */
+static BOOLEAN
+SafeStringReadChunk(UINT64   Address,
+                    CHAR *   Buffer,
+                    UINT32   MaximumSize,
+                    UINT32   CharSize,
+                    UINT64 * ValidatedPage,
+                    UINT32 * ChunkSize)
+{
+    UINT64 Page = (UINT64)PAGE_ALIGN(Address);
+    UINT32 Size = PAGE_SIZE - (UINT32)(Address & (PAGE_SIZE - 1));
+
+    if (Page != *ValidatedPage)
+    {
+        if (!CheckAccessValidityAndSafety(Page, sizeof(CHAR)))
+        {
+            return FALSE;
+        }
+
+        *ValidatedPage = Page;
+    }
+
+    if (Size < CharSize)
+    {
+        //
+        // The character is placed on two pages
+        //
+        if (!CheckAccessValidityAndSafety(Page + PAGE_SIZE, sizeof(CHAR)))
+        {
+            return FALSE;
+        }
+
+        *ValidatedPage = Page + PAGE_SIZE;
+        Size           = CharSize;
+    }
+
+    if (Size > MaximumSize)
+    {
+        Size = MaximumSize;
+    }
+
+    Size -= Size % CharSize;
+
+    if (!MemoryMapperReadMemorySafe(Address, Buffer, Size))
+    {
+        return FALSE;
+    }
+
+    *ChunkSize = Size;
+
+    return TRUE;
+}
+
+/**
+ * @brief Get the length of a null-terminated string safely
+ *
+ * @param Address
+ * @param CharSize Size of the characters (1 for strlen, 2 for wcslen)
+ * @param Length Number of the characters before the null character
+ *
+ * @return BOOLEAN FALSE if the memory is not valid
+ */
+BOOLEAN
+SafeStringLength(UINT64 Address, UINT32 CharSize, UINT32 * Length)
+{
+    CHAR   Buffer[SAFE_STRING_CHUNK_SIZE];
+    UINT64 ValidatedPage = SAFE_STRING_NO_VALIDATED_PAGE;
+    UINT32 ChunkSize;
+    UINT32 i;
+    UINT64 Word;
+
+    *Length = 0;
+
+    while (TRUE)
+    {
+        if (!SafeStringReadChunk(Address, Buffer, SAFE_STRING_CHUNK_SIZE, CharSize, &ValidatedPage, &ChunkSize))
+        {
+            return FALSE;
+        }
+
+        //
+        // Skip the words without a null character
+        //
+        for (i = 0; i + sizeof(UINT64) <= ChunkSize; i += sizeof(UINT64))
+        {
+            memcpy(&Word, &Buffer[i], sizeof(UINT64));
+
+            if (SafeStringWordHasNull(Word, CharSize))
+            {
+                break;
+            }
+        }
+
+        for (; i < ChunkSize; i += CharSize)
+        {
+            if (SafeStringGetCharacter(&Buffer[i], CharSize) == 0)
+            {
+                *Length += i / CharSize;
+                return TRUE;
+            }
+        }
+
+        *Length += ChunkSize / CharSize;
+        Address += ChunkSize;
+    }
+}
+
+/**
+ * @brief Compare two strings or two buffers safely
+ *
+ * @param Address1
+ * @param Address2
+ * @param CharSize Size of the characters (1 for strcmp and memcmp, 2 for wcscmp)
+ * @param Count Maximum number of the compared characters (if IsBounded is set)
+ * @param IsBounded Whether the comparison is limited to Count characters
+ * @param StopOnNull Whether the comparison ends at the null character of the strings
+ * @param Result -1, 0 or 1 (the same as strcmp)
+ *
+ * @return BOOLEAN FALSE if the memory is not valid
+ */
+BOOLEAN
+SafeStringCompare(UINT64  Address1,
+                  UINT64  Address2,
+                  UINT32  CharSize,
+                  UINT64  Count,
+                  BOOLEAN IsBounded,
+                  BOOLEAN StopOnNull,
+                  INT32 * Result)
+{
+    CHAR   Buffer1[SAFE_STRING_CHUNK_SIZE];
+    CHAR   Buffer2[SAFE_STRING_CHUNK_SIZE];
+    UINT64 ValidatedPage1 = SAFE_STRING_NO_VALIDATED_PAGE;
+    UINT64 ValidatedPage2 = SAFE_STRING_NO_VALIDATED_PAGE;
+    UINT32 MaximumSize;
+    UINT32 ChunkSize1;
+    UINT32 ChunkSize2;
+    UINT32 i;
+    UINT64 Word1;
+    UINT64 Word2;
+    INT32  Difference;
+
+    *Result = 0;
+
+    while (!IsBounded || Count != 0)
+    {
+        MaximumSize = SAFE_STRING_CHUNK_SIZE;
+
+        if (IsBounded && Count < SAFE_STRING_CHUNK_SIZE / CharSize)
+        {
+            MaximumSize = (UINT32)Count * CharSize;
+        }
+
+        //
+        // The second chunk is not longer than the first chunk, both of them
+        // are in their validated pages
+        //
+        if (!SafeStringReadChunk(Address1, Buffer1, MaximumSize, CharSize, &ValidatedPage1, &ChunkSize1) ||
+            !SafeStringReadChunk(Address2, Buffer2, ChunkSize1, CharSize, &ValidatedPage2, &ChunkSize2))
+        {
+            return FALSE;
+        }
+
+        //
+        // Skip the equal words without a null character
+        //
+        for (i = 0; i + sizeof(UINT64) <= ChunkSize2; i += sizeof(UINT64))
+        {
+            memcpy(&Word1, &Buffer1[i], sizeof(UINT64));
+            memcpy(&Word2, &Buffer2[i], sizeof(UINT64));
+
+            if (Word1 != Word2 || (StopOnNull && SafeStringWordHasNull(Word2, CharSize)))
+            {
+                break;
+            }
+        }
+
+        for (; i < ChunkSize2; i += CharSize)
+        {
+            Difference = SafeStringGetCharacter(&Buffer1[i], CharSize) - SafeStringGetCharacter(&Buffer2[i], CharSize);
+
+            if (Difference != 0)
+            {
+                *Result = Difference < 0 ? -1 : 1;
+                return TRUE;
+            }
+
+            if (StopOnNull && SafeStringGetCharacter(&Buffer2[i], CharSize) == 0)
+            {
+                return TRUE;
+            }
+        }
+
+        Address1 += ChunkSize2;
+        Address2 += ChunkSize2;
+
+        if (IsBounded)
+        {
+            Count -= ChunkSize2 / CharSize;
+        }
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,132 @@
+/**
+ * @file TranslationCache.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Per-core virtual to physical address translation cache
+ * @details The translations are tagged by the cr3 of the process, so a cache
+ * that is shared between the processes never returns the page of another
+ * process, the cache should be invalidated whenever the paging structures
+ * might have been changed (e.g., at the start of each run of a script)
+ *
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Invalidate all the entries of the translation cache
+ *
+ * @param Cache
+ *
+ * @return VOID
+ */
+VOID
+TranslationCacheInvalidate(PTRANSLATION_CACHE Cache)
+{
+    for (UINT32 i = 0; i < TRANSLATION_CACHE_ENTRIES_COUNT; i++)
+    {
+        Cache->Entries[i].IsValid = FALSE;
+    }
+}
+
+/**
+ * @brief Translate a virtual address to a physical address by the cache
+ * @details The page tables are only walked if the page is not cached, the
+ * page should be present in the current process (the cr3 should be the
+ * cr3 of the current process)
+ *
+ * @param Cache
+ * @param Cr3 The cr3 of the current process
+ * @param VirtualAddress
+ * @param PhysicalAddress
+ *
+ * @return BOOLEAN FALSE if the page is not valid
+ */
+BOOLEAN
+TranslationCacheTranslate(PTRANSLATION_CACHE Cache, CR3_TYPE Cr3, UINT64 VirtualAddress, UINT64 * PhysicalAddress)
+{
+    UINT64                   VirtualPage = (UINT64)PAGE_ALIGN(VirtualAddress);
+    UINT64                   PhysicalPage;
+    PTRANSLATION_CACHE_ENTRY Entry;
+
+    Entry = &Cache->Entries[(VirtualPage / PAGE_SIZE) & (TRANSLATION_CACHE_ENTRIES_COUNT - 1)];
+
+    if (Entry->IsValid && Entry->VirtualPage == VirtualPage && Entry->Cr3 == Cr3.Flags)
+    {
+        *PhysicalAddress = Entry->PhysicalPage + (VirtualAddress & (PAGE_SIZE - 1));
+        return TRUE;
+    }
+
+    //
+    // Not cached, walk the page tables
+    //
+    if (!CheckAccessValidityAndSafety(VirtualPage, sizeof(CHAR)))
+    {
+        return FALSE;
+    }
+
+    PhysicalPage = VirtualAddressToPhysicalAddressByProcessCr3((PVOID)VirtualPage, Cr3);
+
+    if (PhysicalPage == NULL64_ZERO)
+    {
+        return FALSE;
+    }
+
+    Entry->Cr3          = Cr3.Flags;
+    Entry->VirtualPage  = VirtualPage;
+    Entry->PhysicalPage = PhysicalPage;
+    Entry->IsValid      = TRUE;
+
+    *PhysicalAddress = PhysicalPage + (VirtualAddress & (PAGE_SIZE - 1));
+
+    return TRUE;
+}
+
+/**
+ * @brief Read memory safely by the physical addresses of the translation cache
+ * @details The memory is read page by page, if a page is not valid, the
+ * buffer might be partially filled
+ *
+ * @param Cache
+ * @param Cr3 The cr3 of the current process
+ * @param VaAddressToRead Virtual Address to read
+ * @param BufferToSaveMemory Destination to save
+ * @param SizeToRead Size
+ *
+ * @return BOOLEAN FALSE if the memory is not valid
+ */
+BOOLEAN
+TranslationCacheReadMemory(PTRANSLATION_CACHE Cache,
+                           CR3_TYPE           Cr3,
+                           UINT64             VaAddressToRead,
+                           PVOID              BufferToSaveMemory,
+                           SIZE_T             SizeToRead)
+{
+    UINT64 PhysicalAddress;
+    UINT64 ReadSize;
+    UINT64 Buffer = (UINT64)BufferToSaveMemory;
+
+    while (SizeToRead != 0)
+    {
+        ReadSize = PAGE_SIZE - (VaAddressToRead & (PAGE_SIZE - 1));
+
+        if (ReadSize > SizeToRead)
+        {
+            ReadSize = SizeToRead;
+        }
+
+        if (!TranslationCacheTranslate(Cache, Cr3, VaAddressToRead, &PhysicalAddress) ||
+            !MemoryMapperReadMemorySafeByPhysicalAddress(PhysicalAddress, Buffer, ReadSize))
+        {
+            return FALSE;
+        }
+
+        SizeToRead      = SizeToRead - ReadSize;
+        VaAddressToRead = VaAddressToRead + ReadSize;
+        Buffer          = Buffer + ReadSize;
+    }
+
+    return TRUE;
+}
@@ -1191,14 +1191,10 @@ VmxPerformTermination()
 UINT32
 VmxCompatibleStrlen(const CHAR * S)
 {
-    CHAR     Temp  = NULL_ZERO;
-    UINT32   Count = 0;
-    UINT64   AlignedAddress;
+    UINT32   Length = 0;
     CR3_TYPE GuestCr3;
     CR3_TYPE OriginalCr3;
 
-    AlignedAddress = (UINT64)PAGE_ALIGN((UINT64)S);
-
     //
     // Find the current process cr3
     //
@@ -1211,63 +1207,22 @@ VmxCompatibleStrlen(const CHAR * S)
     CpuWriteCr3(GuestCr3.Flags);
 
     //
-    // First check
+    // The string is validated and read once per page
     //
-    if (!CheckAccessValidityAndSafety(AlignedAddress, sizeof(CHAR)))
+    if (!SafeStringLength((UINT64)S, sizeof(CHAR), &Length))
     {
         //
         // Error
         //
-
-        //
-        // Move back to original cr3
-        //
-        CpuWriteCr3(OriginalCr3.Flags);
-        return 0;
-    }
-
-    while (TRUE)
-    {
-        /*
-        Temp = *S;
-        */
-        MemoryMapperReadMemorySafe((UINT64)S, &Temp, sizeof(CHAR));
-
-        if (Temp != '\0')
-        {
-            Count++;
-            S++;
-        }
-        else
-        {
-            //
-            // Move back to original cr3
-            //
-            CpuWriteCr3(OriginalCr3.Flags);
-            return Count;
-        }
-
-        if (!((UINT64)S & (PAGE_SIZE - 1)))
-        {
-            if (!CheckAccessValidityAndSafety((UINT64)S, sizeof(CHAR)))
-            {
-                //
-                // Error
-                //
-
-                //
-                // Move back to original cr3
-                //
-                CpuWriteCr3(OriginalCr3.Flags);
-                return 0;
-            }
-        }
+        Length = 0;
     }
 
     //
     // Move back to original cr3
     //
     CpuWriteCr3(OriginalCr3.Flags);
+
+    return Length;
 }
 
 /**
@@ -1280,14 +1235,10 @@ VmxCompatibleStrlen(const CHAR * S)
 UINT32
 VmxCompatibleWcslen(const WCHAR * S)
 {
-    WCHAR    Temp  = NULL_ZERO;
-    UINT32   Count = 0;
-    UINT64   AlignedAddress;
+    UINT32   Length = 0;
     CR3_TYPE GuestCr3;
     CR3_TYPE OriginalCr3;
 
-    AlignedAddress = (UINT64)PAGE_ALIGN((UINT64)S);
-
     //
     // Find the current process cr3
     //
@@ -1299,66 +1250,23 @@ VmxCompatibleWcslen(const WCHAR * S)
     OriginalCr3.Flags = CpuReadCr3();
     CpuWriteCr3(GuestCr3.Flags);
 
-    AlignedAddress = (UINT64)PAGE_ALIGN((UINT64)S);
-
     //
-    // First check
+    // The string is validated and read once per page
     //
-    if (!CheckAccessValidityAndSafety(AlignedAddress, sizeof(WCHAR)))
+    if (!SafeStringLength((UINT64)S, sizeof(WCHAR), &Length))
     {
         //
         // Error
         //
-
-        //
-        // Move back to original cr3
-        //
-        CpuWriteCr3(OriginalCr3.Flags);
-        return 0;
-    }
-
-    while (TRUE)
-    {
-        /*
-        Temp = *S;
-        */
-        MemoryMapperReadMemorySafe((UINT64)S, &Temp, sizeof(WCHAR));
-
-        if (Temp != '\0\0')
-        {
-            Count++;
-            S++;
-        }
-        else
-        {
-            //
-            // Move back to original cr3
-            //
-            CpuWriteCr3(OriginalCr3.Flags);
-            return Count;
-        }
-
-        if (!((UINT64)S & (PAGE_SIZE - 1)))
-        {
-            if (!CheckAccessValidityAndSafety((UINT64)S, sizeof(WCHAR)))
-            {
-                //
-                // Error
-                //
-
-                //
-                // Move back to original cr3
-                //
-                CpuWriteCr3(OriginalCr3.Flags);
-                return 0;
-            }
-        }
+        Length = 0;
     }
 
     //
     // Move back to original cr3
     //
     CpuWriteCr3(OriginalCr3.Flags);
+
+    return Length;
 }
 
 /**
@@ -1390,7 +1298,7 @@ VmxCompatibleMicroSleep(UINT64 Us)
  * @param Address1
  * @param Address2
  * @param Num
- * param IsStrncmp
+ * @param IsStrncmp
  *
  * @return INT32 0x2 indicates error, otherwise the same result as strcmp in string.h
  */
@@ -1400,16 +1308,10 @@ VmxCompatibleStrcmp(const CHAR * Address1,
                     SIZE_T       Num,
                     BOOLEAN      IsStrncmp)
 {
-    CHAR     C1 = NULL_ZERO, C2 = NULL_ZERO;
     INT32    Result = 0;
-    UINT32   Count  = 0;
-    UINT64   AlignedAddress1, AlignedAddress2;
     CR3_TYPE GuestCr3;
     CR3_TYPE OriginalCr3;
 
-    AlignedAddress1 = (UINT64)PAGE_ALIGN((UINT64)Address1);
-    AlignedAddress2 = (UINT64)PAGE_ALIGN((UINT64)Address2);
-
     //
     // Find the current process cr3
     //
@@ -1422,104 +1324,21 @@ VmxCompatibleStrcmp(const CHAR * Address1,
     CpuWriteCr3(GuestCr3.Flags);
 
     //
-    // First check
+    // The buffers are validated and read once per page
     //
-    if (!CheckAccessValidityAndSafety(AlignedAddress1, sizeof(CHAR)) || !CheckAccessValidityAndSafety(AlignedAddress2, sizeof(CHAR)))
+    if (!SafeStringCompare((UINT64)Address1, (UINT64)Address2, sizeof(CHAR), Num, IsStrncmp, TRUE, &Result))
     {
         //
         // Error
         //
-
-        //
-        // Move back to original cr3
-        //
-        CpuWriteCr3(OriginalCr3.Flags);
-        return 0x2;
-    }
-
-    do
-    {
-        //
-        // Check to see if we have byte number constraints
-        //
-        if (IsStrncmp)
-        {
-            if (Count == Num)
-            {
-                //
-                // Maximum number of bytes reached
-                //
-                break;
-            }
-            else
-            {
-                //
-                // Maximum number of bytes not reached
-                //
-                Count++;
-            }
-        }
-
-        /*
-        C1 = *Address1;
-        */
-        MemoryMapperReadMemorySafe((UINT64)Address1, &C1, sizeof(CHAR));
-
-        /*
-        C2 = *Address2;
-        */
-        MemoryMapperReadMemorySafe((UINT64)Address2, &C2, sizeof(CHAR));
-
-        Address1++;
-        Address2++;
-
-        if (!((UINT64)AlignedAddress1 & (PAGE_SIZE - 1)))
-        {
-            if (!CheckAccessValidityAndSafety((UINT64)AlignedAddress1, sizeof(CHAR)))
-            {
-                //
-                // Error
-                //
-
-                //
-                // Move back to original cr3
-                //
-                CpuWriteCr3(OriginalCr3.Flags);
-                return 0x2;
-            }
-        }
-
-        if (!((UINT64)AlignedAddress2 & (PAGE_SIZE - 1)))
-        {
-            if (!CheckAccessValidityAndSafety((UINT64)AlignedAddress2, sizeof(CHAR)))
-            {
-                //
-                // Error
-                //
-
-                //
-                // Move back to original cr3
-                //
-                CpuWriteCr3(OriginalCr3.Flags);
-                return 0x2;
-            }
-        }
-        Result = C1 - C2;
-    } while (!Result && C2);
-
-    if (Result < 0)
-    {
-        Result = -1;
-    }
-    else if (Result > 0)
-    {
-        Result = 1;
+        Result = 0x2;
     }
 
     //
     // Move back to original cr3
     //
     CpuWriteCr3(OriginalCr3.Flags);
+
     return Result;
 }
 
@@ -1538,16 +1357,10 @@ VmxCompatibleWcscmp(const WCHAR * Address1,
                     SIZE_T        Num,
                     BOOLEAN       IsWcsncmp)
 {
-    WCHAR    C1 = NULL_ZERO, C2 = NULL_ZERO;
     INT32    Result = 0;
-    UINT32   Count  = 0;
-    UINT64   AlignedAddress1, AlignedAddress2;
     CR3_TYPE GuestCr3;
     CR3_TYPE OriginalCr3;
 
-    AlignedAddress1 = (UINT64)PAGE_ALIGN((UINT64)Address1);
-    AlignedAddress2 = (UINT64)PAGE_ALIGN((UINT64)Address2);
-
     //
     // Find the current process cr3
     //
@@ -1560,105 +1373,21 @@ VmxCompatibleWcscmp(const WCHAR * Address1,
     CpuWriteCr3(GuestCr3.Flags);
 
     //
-    // First check
+    // The buffers are validated and read once per page
     //
-    if (!CheckAccessValidityAndSafety(AlignedAddress1, sizeof(WCHAR)) || !CheckAccessValidityAndSafety(AlignedAddress2, sizeof(WCHAR)))
+    if (!SafeStringCompare((UINT64)Address1, (UINT64)Address2, sizeof(WCHAR), Num, IsWcsncmp, TRUE, &Result))
     {
         //
         // Error
         //
-
-        //
-        // Move back to original cr3
-        //
-        CpuWriteCr3(OriginalCr3.Flags);
-        return 0x2;
-    }
-
-    do
-    {
-        //
-        // Check to see if we have byte number constraints
-        //
-        if (IsWcsncmp)
-        {
-            if (Count == Num)
-            {
-                //
-                // Maximum number of bytes reached
-                //
-                break;
-            }
-            else
-            {
-                //
-                // Maximum number of bytes not reached
-                //
-                Count++;
-            }
-        }
-
-        /*
-        C1 = *Address1;
-        */
-        MemoryMapperReadMemorySafe((UINT64)Address1, &C1, sizeof(WCHAR));
-
-        /*
-        C2 = *Address2;
-        */
-        MemoryMapperReadMemorySafe((UINT64)Address2, &C2, sizeof(WCHAR));
-
-        Address1++;
-        Address2++;
-
-        if (!((UINT64)AlignedAddress1 & (PAGE_SIZE - 1)))
-        {
-            if (!CheckAccessValidityAndSafety((UINT64)AlignedAddress1, sizeof(WCHAR)))
-            {
-                //
-                // Error
-                //
-
-                //
-                // Move back to original cr3
-                //
-                CpuWriteCr3(OriginalCr3.Flags);
-                return 0x2;
-            }
-        }
-
-        if (!((UINT64)AlignedAddress2 & (PAGE_SIZE - 1)))
-        {
-            if (!CheckAccessValidityAndSafety((UINT64)AlignedAddress2, sizeof(WCHAR)))
-            {
-                //
-                // Error
-                //
-
-                //
-                // Move back to original cr3
-                //
-                CpuWriteCr3(OriginalCr3.Flags);
-                return 0x2;
-            }
-        }
-
-        Result = C1 - C2;
-    } while (!Result && C2);
-
-    if (Result < 0)
-    {
-        Result = -1;
-    }
-    else if (Result > 0)
-    {
-        Result = 1;
+        Result = 0x2;
     }
 
     //
     // Move back to original cr3
     //
     CpuWriteCr3(OriginalCr3.Flags);
+
     return Result;
 }
 
@@ -1673,15 +1402,10 @@ VmxCompatibleWcscmp(const WCHAR * Address1,
 INT32
 VmxCompatibleMemcmp(const CHAR * Address1, const CHAR * Address2, SIZE_T Count)
 {
-    CHAR     C1 = NULL_ZERO, C2 = NULL_ZERO;
     INT32    Result = 0;
-    UINT64   AlignedAddress1, AlignedAddress2;
     CR3_TYPE GuestCr3;
     CR3_TYPE OriginalCr3;
 
-    AlignedAddress1 = (UINT64)PAGE_ALIGN((UINT64)Address1);
-    AlignedAddress2 = (UINT64)PAGE_ALIGN((UINT64)Address2);
-
     //
     // Find the current process cr3
     //
@@ -1694,84 +1418,21 @@ VmxCompatibleMemcmp(const CHAR * Address1, const CHAR * Address2, SIZE_T Count)
     CpuWriteCr3(GuestCr3.Flags);
 
     //
-    // First check
+    // The buffers are validated and read once per page
     //
-    if (!CheckAccessValidityAndSafety(AlignedAddress1, sizeof(WCHAR)) || !CheckAccessValidityAndSafety(AlignedAddress2, sizeof(WCHAR)))
+    if (!SafeStringCompare((UINT64)Address1, (UINT64)Address2, sizeof(CHAR), Count, TRUE, FALSE, &Result))
     {
         //
         // Error
         //
-
-        //
-        // Move back to original cr3
-        //
-        CpuWriteCr3(OriginalCr3.Flags);
-        return 0x2;
-    }
-
-    while (Count-- > 0 && !Result)
-    {
-        /*
-        C1 = *Address1;
-        */
-        MemoryMapperReadMemorySafe((UINT64)Address1, &C1, sizeof(CHAR));
-
-        /*
-        C2 = *Address2;
-        */
-        MemoryMapperReadMemorySafe((UINT64)Address2, &C2, sizeof(CHAR));
-
-        Address1++;
-        Address2++;
-
-        if (!((UINT64)AlignedAddress1 & (PAGE_SIZE - 1)))
-        {
-            if (!CheckAccessValidityAndSafety((UINT64)AlignedAddress1, sizeof(WCHAR)))
-            {
-                //
-                // Error
-                //
-
-                //
-                // Move back to original cr3
-                //
-                CpuWriteCr3(OriginalCr3.Flags);
-                return 0x2;
-            }
-        }
-
-        if (!((UINT64)AlignedAddress2 & (PAGE_SIZE - 1)))
-        {
-            if (!CheckAccessValidityAndSafety((UINT64)AlignedAddress2, sizeof(WCHAR)))
-            {
-                //
-                // Error
-                //
-
-                //
-                // Move back to original cr3
-                //
-                CpuWriteCr3(OriginalCr3.Flags);
-                return 0x2;
-            }
-        }
-
-        Result = C1 - C2;
-    }
-
-    if (Result < 0)
-    {
-        Result = -1;
-    }
-    else if (Result > 0)
-    {
-        Result = 1;
+        Result = 0x2;
     }
 
     //
     // Move back to original cr3
     //
     CpuWriteCr3(OriginalCr3.Flags);
+
     return Result;
 }
 
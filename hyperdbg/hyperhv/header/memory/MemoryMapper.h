@@ -108,6 +108,8 @@ typedef struct _MEMORY_MAPPER_ADDRESSES
 
     UINT64 PteVirtualAddressForWrite; // The virtual address of PTE for write operations
     UINT64 VirualAddressForWrite;     // The actual kernel virtual address to write
+
+    TRANSLATION_CACHE TranslationCache; // The cached translations of the script engine's reads
 } MEMORY_MAPPER_ADDRESSES, *PMEMORY_MAPPER_ADDRESSES;
 
 //////////////////////////////////////////////////
@@ -162,6 +164,11 @@ MemoryMapperWriteMemorySafeByPte(_In_ PVOID            SourceVA,
                                  _Inout_ UINT64        MappingVa,
                                  _In_ BOOLEAN          InvalidateVpids);
 
+static PVOID
+MemoryMapperMapPhysicalPageByPte(_In_ UINT64 PhysicalAddress,
+                                 _In_ UINT64 PteVaAddress,
+                                 _In_ UINT64 MappingVa);
+
 static UINT64
 MemoryMapperReadMemorySafeByPhysicalAddressWrapperAddressMaker(
     _In_ MEMORY_MAPPER_WRAPPER_FOR_MEMORY_READ TypeOfRead,
@@ -0,0 +1,39 @@
+/**
+ * @file SafeString.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers for the page-granular safe string and memory functions
+ * @details
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				   Definitions 					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum size of the memory that is read by a single safe read
+ * @details It should be a multiple of sizeof(UINT64)
+ *
+ */
+#define SAFE_STRING_CHUNK_SIZE 256
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+SafeStringLength(UINT64 Address, UINT32 CharSize, UINT32 * Length);
+
+BOOLEAN
+SafeStringCompare(UINT64  Address1,
+                  UINT64  Address2,
+                  UINT32  CharSize,
+                  UINT64  Count,
+                  BOOLEAN IsBounded,
+                  BOOLEAN StopOnNull,
+                  INT32 * Result);
@@ -0,0 +1,69 @@
+/**
+ * @file TranslationCache.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers for the per-core virtual to physical address translation cache
+ * @details
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				   Definitions 					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Number of the entries of the translation cache
+ * @details It should be a power of two
+ *
+ */
+#define TRANSLATION_CACHE_ENTRIES_COUNT 16
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief An entry of the translation cache
+ *
+ */
+typedef struct _TRANSLATION_CACHE_ENTRY
+{
+    UINT64  Cr3;          // The cr3 of the process that the page is translated in (tag)
+    UINT64  VirtualPage;  // Page-aligned virtual address
+    UINT64  PhysicalPage; // Page-aligned physical address
+    BOOLEAN IsValid;
+
+} TRANSLATION_CACHE_ENTRY, *PTRANSLATION_CACHE_ENTRY;
+
+/**
+ * @brief The translation cache of a core
+ * @details The cache is direct-mapped by the virtual page number, a zeroed
+ * cache is an empty cache
+ *
+ */
+typedef struct _TRANSLATION_CACHE
+{
+    TRANSLATION_CACHE_ENTRY Entries[TRANSLATION_CACHE_ENTRIES_COUNT];
+
+} TRANSLATION_CACHE, *PTRANSLATION_CACHE;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+VOID
+TranslationCacheInvalidate(PTRANSLATION_CACHE Cache);
+
+BOOLEAN
+TranslationCacheTranslate(PTRANSLATION_CACHE Cache, CR3_TYPE Cr3, UINT64 VirtualAddress, UINT64 * PhysicalAddress);
+
+BOOLEAN
+TranslationCacheReadMemory(PTRANSLATION_CACHE Cache,
+                           CR3_TYPE           Cr3,
+                           UINT64             VaAddressToRead,
+                           PVOID              BufferToSaveMemory,
+                           SIZE_T             SizeToRead);
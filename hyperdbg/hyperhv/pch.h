@@ -92,6 +92,7 @@
 // VMX and Capabilities
 //
 #include "vmm/vmx/VmxBroadcast.h"
+#include "memory/TranslationCache.h"
 #include "memory/MemoryMapper.h"
 #include "interface/Dispatch.h"
 #include "common/Msr.h"
@@ -102,6 +103,7 @@
 #include "memory/Layout.h"
 #include "memory/SwitchLayout.h"
 #include "memory/AddressCheck.h"
+#include "memory/SafeString.h"
 #include "memory/Segmentation.h"
 #include "common/Bitwise.h"
 #include "common/Common.h"
@@ -79,6 +79,44 @@ DebuggerInitializeScriptEngine()
     //
     RtlZeroMemory(g_ScriptGlobalVariables, MAX_VAR_COUNT * sizeof(UINT64));
 
+    //
+    // Initialize script engines per-core (percpu) variables holder
+    //
+    if (!g_ScriptPercpuVariables)
+    {
+        g_ScriptPercpuVariables = PlatformMemAllocateNonPagedPool(ProcessorsCount * MAX_VAR_COUNT * sizeof(UINT64));
+    }
+
+    if (!g_ScriptPercpuVariables)
+    {
+        //
+        // Out of resource, initialization of script engine's percpu variable holders failed
+        //
+        return FALSE;
+    }
+
+    //
+    // Zero the percpu variables memory
+    //
+    RtlZeroMemory(g_ScriptPercpuVariables, ProcessorsCount * MAX_VAR_COUNT * sizeof(UINT64));
+
+    //
+    // Initialize the holder of the expanded scripts (it's not possible to
+    // allocate memory in VMX root-mode where the scripts are expanded)
+    //
+    if (!g_ScriptEngineExpandedCodeBuffer)
+    {
+        g_ScriptEngineExpandedCodeBuffer = PlatformMemAllocateNonPagedPool(MaxSerialPacketSize);
+    }
+
+    if (!g_ScriptEngineExpandedCodeBuffer)
+    {
+        //
+        // Out of resource, initialization of the holder of the expanded scripts failed
+        //
+        return FALSE;
+    }
+
     //
     // Initialize the local and temp variables
     //
@@ -105,6 +143,14 @@ DebuggerInitializeScriptEngine()
         RtlZeroMemory(CurrentDebuggerState->ScriptEngineCoreSpecificStackBuffer, MAX_STACK_BUFFER_COUNT * sizeof(UINT64));
     }
 
+    //
+    // Request pages for the aggregation tables of the cores (each core takes
+    // its table when it runs its first aggregation function in VMX root-mode)
+    //
+    PoolManagerRequestAllocation(sizeof(SCRIPT_ENGINE_AGGREGATION_TABLE),
+                                 ProcessorsCount,
+                                 SCRIPT_ENGINE_AGGREGATION_TABLE);
+
     return TRUE;
 }
 
@@ -375,6 +421,24 @@ DebuggerUninitialize()
         g_ScriptGlobalVariables = NULL;
     }
 
+    //
+    // Free g_ScriptPercpuVariables
+    //
+    if (g_ScriptPercpuVariables != NULL)
+    {
+        PlatformMemFreePool(g_ScriptPercpuVariables);
+        g_ScriptPercpuVariables = NULL;
+    }
+
+    //
+    // Free g_ScriptEngineExpandedCodeBuffer
+    //
+    if (g_ScriptEngineExpandedCodeBuffer != NULL)
+    {
+        PlatformMemFreePool(g_ScriptEngineExpandedCodeBuffer);
+        g_ScriptEngineExpandedCodeBuffer = NULL;
+    }
+
     //
     // Free core specific local and temp variables
     //
@@ -713,6 +777,10 @@ DebuggerAddActionToEvent(PDEBUGGER_EVENT                                 Event,
     PDEBUGGER_EVENT_ACTION Action;
     SIZE_T                 ActionBufferSize;
     PVOID                  RequestedBuffer = NULL;
+    UINT32                 ScriptLength    = 0;
+    UINT32                 LinkedCodeSize  = 0;
+    UINT32                 ProfileSize     = 0;
+    SYMBOL_BUFFER          CodeBuffer      = {0};
 
     //
     // Allocate action + allocate code for custom code
@@ -728,9 +796,78 @@ DebuggerAddActionToEvent(PDEBUGGER_EVENT                                 Event,
     else if (InTheCaseOfRunScript != NULL)
     {
         //
-        // We should allocate extra buffer for script
+        // We should allocate extra buffer for script (compact scripts are
+        // expanded to symbols, so the size of the expanded script is used)
         //
-        ActionBufferSize = sizeof(DEBUGGER_EVENT_ACTION) + InTheCaseOfRunScript->ScriptLength;
+        if (InTheCaseOfRunScript->ScriptBuffer != NULL64_ZERO)
+        {
+            ScriptLength = CompactBytecodeGetExpandedSize((PVOID)InTheCaseOfRunScript->ScriptBuffer,
+                                                          InTheCaseOfRunScript->ScriptLength);
+
+            if (ScriptLength == 0 && InTheCaseOfRunScript->ScriptLength != 0)
+            {
+                ResultsToReturn->IsSuccessful = FALSE;
+                ResultsToReturn->Error        = DEBUGGER_ERROR_INVALID_SCRIPT_BUFFER;
+
+                return NULL;
+            }
+        }
+
+        ActionBufferSize = sizeof(DEBUGGER_EVENT_ACTION) + ScriptLength;
+
+        //
+        // The linked code of the script is stored after the script, actions
+        // that are added in VMX root-mode are only linked if the linked code
+        // fits into the same preallocated buffer
+        //
+        if ((UINT64)InTheCaseOfRunScript->ScriptPointer * sizeof(SYMBOL) <= ScriptLength)
+        {
+            LinkedCodeSize = ScriptEngineGetLinkedCodeSize(InTheCaseOfRunScript->ScriptPointer);
+        }
+
+        if (InputFromVmxRoot && LinkedCodeSize != 0)
+        {
+            if (ActionBufferSize <= REGULAR_INSTANT_EVENT_ACTION_BUFFER)
+            {
+                if (ActionBufferSize + LinkedCodeSize > REGULAR_INSTANT_EVENT_ACTION_BUFFER)
+                {
+                    LinkedCodeSize = 0;
+                }
+            }
+            else if (ActionBufferSize + LinkedCodeSize > BIG_INSTANT_EVENT_ACTION_BUFFER)
+            {
+                LinkedCodeSize = 0;
+            }
+        }
+
+        ActionBufferSize += LinkedCodeSize;
+
+        //
+        // The profile of the script (an entry per symbol) is stored between the
+        // script and the linked code, actions that are added in VMX root-mode
+        // are only profiled if the profile fits into the same preallocated buffer
+        //
+        if ((UINT64)InTheCaseOfRunScript->ScriptPointer * sizeof(SYMBOL) <= ScriptLength)
+        {
+            ProfileSize = InTheCaseOfRunScript->ScriptPointer * sizeof(SCRIPT_ENGINE_PROFILE_ENTRY);
+        }
+
+        if (InputFromVmxRoot && ProfileSize != 0)
+        {
+            if (ActionBufferSize <= REGULAR_INSTANT_EVENT_ACTION_BUFFER)
+            {
+                if (ActionBufferSize + ProfileSize > REGULAR_INSTANT_EVENT_ACTION_BUFFER)
+                {
+                    ProfileSize = 0;
+                }
+            }
+            else if (ActionBufferSize + ProfileSize > BIG_INSTANT_EVENT_ACTION_BUFFER)
+            {
+                ProfileSize = 0;
+            }
+        }
+
+        ActionBufferSize += ProfileSize;
     }
     else
     {
@@ -1067,16 +1204,79 @@ DebuggerAddActionToEvent(PDEBUGGER_EVENT                                 Event,
         Action->ScriptConfiguration.ScriptBuffer = (UINT64)((BYTE *)Action + sizeof(DEBUGGER_EVENT_ACTION));
 
         //
-        // Copy the memory of script to our non-paged pool
+        // Copy the memory of script to our non-paged pool (the compact scripts
+        // are expanded here once, so the script engine always evaluates symbols)
         //
-        RtlCopyMemory((PVOID)Action->ScriptConfiguration.ScriptBuffer, (const PVOID)InTheCaseOfRunScript->ScriptBuffer, InTheCaseOfRunScript->ScriptLength);
+        if (!CompactBytecodeExpand((PVOID)InTheCaseOfRunScript->ScriptBuffer,
+                                   InTheCaseOfRunScript->ScriptLength,
+                                   (PSYMBOL)Action->ScriptConfiguration.ScriptBuffer,
+                                   ScriptLength))
+        {
+            //
+            // There was an error
+            //
+            if (InputFromVmxRoot)
+            {
+                PoolManagerFreePool((UINT64)Action);
+
+                if (RequestedBuffer != 0)
+                {
+                    PoolManagerFreePool((UINT64)RequestedBuffer);
+                }
+            }
+            else
+            {
+                PlatformMemFreePool(Action);
+
+                if (RequestedBuffer != 0)
+                {
+                    PlatformMemFreePool(RequestedBuffer);
+                }
+            }
+
+            ResultsToReturn->IsSuccessful = FALSE;
+            ResultsToReturn->Error        = DEBUGGER_ERROR_INVALID_SCRIPT_BUFFER;
+
+            return NULL;
+        }
 
         //
         // Set other fields
         //
-        Action->ScriptConfiguration.ScriptLength                = InTheCaseOfRunScript->ScriptLength;
+        Action->ScriptConfiguration.ScriptLength                = ScriptLength;
         Action->ScriptConfiguration.ScriptPointer               = InTheCaseOfRunScript->ScriptPointer;
         Action->ScriptConfiguration.OptionalRequestedBufferSize = InTheCaseOfRunScript->OptionalRequestedBufferSize;
+
+        //
+        // The profile of the script is zeroed, it's only updated while the
+        // scripts are profiled
+        //
+        Action->ScriptProfile = NULL;
+
+        if (ProfileSize != 0)
+        {
+            Action->ScriptProfile = (PSCRIPT_ENGINE_PROFILE_ENTRY)(Action->ScriptConfiguration.ScriptBuffer + ScriptLength);
+
+            RtlZeroMemory(Action->ScriptProfile, ProfileSize);
+        }
+
+        //
+        // Link the script once, so the script is not decoded each time that
+        // the event is triggered (otherwise, the script is interpreted)
+        //
+        Action->LinkedScriptCode = NULL;
+
+        if (LinkedCodeSize != 0)
+        {
+            CodeBuffer.Head    = (PSYMBOL)Action->ScriptConfiguration.ScriptBuffer;
+            CodeBuffer.Size    = ScriptLength;
+            CodeBuffer.Pointer = InTheCaseOfRunScript->ScriptPointer;
+
+            if (ScriptEngineLink(&CodeBuffer, (PVOID)(Action->ScriptConfiguration.ScriptBuffer + ScriptLength + ProfileSize), LinkedCodeSize))
+            {
+                Action->LinkedScriptCode = (PVOID)(Action->ScriptConfiguration.ScriptBuffer + ScriptLength + ProfileSize);
+            }
+        }
     }
 
     //
@@ -1666,6 +1866,7 @@ DebuggerPerformRunScript(PROCESSOR_DEBUGGING_STATE *        DbgState,
     ACTION_BUFFER                   ActionBuffer           = {0};
     SYMBOL                          ErrorSymbol            = {0};
     SCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters = {0};
+    BOOLEAN                         IsCodeBufferExpanded   = FALSE;
 
     if (Action != NULL)
     {
@@ -1724,6 +1925,27 @@ DebuggerPerformRunScript(PROCESSOR_DEBUGGING_STATE *        DbgState,
         CodeBuffer.Head    = (SYMBOL *)((CHAR *)ScriptDetails + sizeof(DEBUGGEE_SCRIPT_PACKET));
         CodeBuffer.Size    = ScriptDetails->ScriptBufferSize;
         CodeBuffer.Pointer = ScriptDetails->ScriptBufferPointer;
+
+        //
+        // Scripts in the compact format should be expanded to symbols
+        //
+        if (CompactBytecodeIsCompactBuffer(CodeBuffer.Head, CodeBuffer.Size))
+        {
+            SpinlockLock(&g_ScriptEngineExpandedCodeBufferLock);
+
+            if (g_ScriptEngineExpandedCodeBuffer == NULL ||
+                !CompactBytecodeExpand(CodeBuffer.Head, CodeBuffer.Size, g_ScriptEngineExpandedCodeBuffer, MaxSerialPacketSize))
+            {
+                SpinlockUnlock(&g_ScriptEngineExpandedCodeBufferLock);
+
+                LogInfo("Err, the script buffer is invalid\n");
+                return FALSE;
+            }
+
+            CodeBuffer.Size      = CompactBytecodeGetExpandedSize(CodeBuffer.Head, CodeBuffer.Size);
+            CodeBuffer.Head      = g_ScriptEngineExpandedCodeBuffer;
+            IsCodeBufferExpanded = TRUE;
+        }
     }
     else
     {
@@ -1738,10 +1960,63 @@ DebuggerPerformRunScript(PROCESSOR_DEBUGGING_STATE *        DbgState,
     //
     ScriptGeneralRegisters.StackBuffer         = DbgState->ScriptEngineCoreSpecificStackBuffer;
     ScriptGeneralRegisters.GlobalVariablesList = g_ScriptGlobalVariables;
-    RtlZeroMemory(ScriptGeneralRegisters.StackBuffer, MAX_STACK_BUFFER_COUNT * sizeof(UINT64));
+    ScriptGeneralRegisters.PercpuVariablesList = &g_ScriptPercpuVariables[DbgState->CoreId * MAX_VAR_COUNT];
+
+    //
+    // The memory reads of the script are translated by the translation cache
+    // of this core, the translations of the previous runs are not valid anymore
+    //
+    MemoryMapperInvalidateTranslationCache();
 
     UINT64 EXECUTENUMBER = 0;
 
+    //
+    // The profiled scripts are interpreted, so each operator is measured
+    //
+    if (g_ScriptEngineProfilingEnabled && Action != NULL && Action->ScriptProfile != NULL)
+    {
+        ScriptGeneralRegisters.Profile = Action->ScriptProfile;
+    }
+
+    if (Action != NULL && Action->LinkedScriptCode != NULL && ScriptGeneralRegisters.Profile == NULL)
+    {
+        //
+        // Only the entries that are used by the linked code should be zeroed
+        //
+        RtlZeroMemory(ScriptGeneralRegisters.StackBuffer,
+                      ScriptEngineGetLinkedStackUsage(Action->LinkedScriptCode) * sizeof(UINT64));
+
+        //
+        // Execute the linked code of the action
+        //
+        switch (ScriptEngineExecuteLinked(Regs,
+                                          &ActionBuffer,
+                                          &ScriptGeneralRegisters,
+                                          Action->LinkedScriptCode,
+                                          &ErrorSymbol))
+        {
+        case ScriptEngineLinkedExecutionError:
+            LogInfo("Err, ScriptEngineExecute, function = % s\n ",
+                    FunctionNames[ErrorSymbol.Value]);
+            break;
+
+        case ScriptEngineLinkedExecutionStackOverflow:
+            LogInfo("Err, stack buffer overflow (more information: https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/change-script-engine-limitations)\n");
+            break;
+
+        case ScriptEngineLinkedExecutionExecutionCountExceeded:
+            LogInfo("Err, exceeding the max execution count (more information: https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/change-script-engine-limitations)\n");
+            break;
+
+        default:
+            break;
+        }
+
+        return TRUE;
+    }
+
+    RtlZeroMemory(ScriptGeneralRegisters.StackBuffer, MAX_STACK_BUFFER_COUNT * sizeof(UINT64));
+
     for (UINT64 i = 0; i < CodeBuffer.Pointer;)
     {
         //
@@ -1773,6 +2048,11 @@ DebuggerPerformRunScript(PROCESSOR_DEBUGGING_STATE *        DbgState,
         EXECUTENUMBER++;
     }
 
+    if (IsCodeBufferExpanded)
+    {
+        SpinlockUnlock(&g_ScriptEngineExpandedCodeBufferLock);
+    }
+
     return TRUE;
 }
 
@@ -2276,6 +2276,9 @@ KdDispatchAndPerformCommandsFromDebugger(PROCESSOR_DEBUGGING_STATE * DbgState)
     PDEBUGGEE_BP_PACKET                                 BpPacket;
     PDEBUGGER_READ_PAGE_TABLE_ENTRIES_DETAILS           PtePacket;
     PSMI_OPERATION_PACKETS                              SmiOperationPacket;
+    PSCRIPT_ENGINE_AGGREGATION_PACKETS                  ScriptEngineAggregationPacket;
+    PSCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS              ScriptEnginePercpuVariablePacket;
+    PSCRIPT_ENGINE_PROFILE_PACKETS                      ScriptEngineProfilePacket;
     PHYPERTRACE_LBR_DUMP_PACKETS                        HyperTraceLbrdumpPacket;
     PHYPERTRACE_PT_OPERATION_PACKETS                    HyperTracePtOperationPacket;
     PDEBUGGER_APIC_REQUEST                              ApicPacket;
@@ -3013,6 +3016,63 @@ KdDispatchAndPerformCommandsFromDebugger(PROCESSOR_DEBUGGING_STATE * DbgState)
 
                 break;
 
+            case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_QUERY_SCRIPT_ENGINE_AGGREGATIONS:
+
+                ScriptEngineAggregationPacket = (SCRIPT_ENGINE_AGGREGATION_PACKETS *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+
+                //
+                // Query or clear the aggregation tables (it's in vmx-root)
+                //
+                ScriptEnginePerformAggregationRequest(ScriptEngineAggregationPacket);
+
+                //
+                // Send the result of the aggregation request back to the debugger
+                //
+                KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
+                                           DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_SCRIPT_ENGINE_AGGREGATIONS,
+                                           (CHAR *)ScriptEngineAggregationPacket,
+                                           SIZEOF_SCRIPT_ENGINE_AGGREGATION_PACKETS);
+
+                break;
+
+            case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_QUERY_SCRIPT_ENGINE_PERCPU_VARIABLE:
+
+                ScriptEnginePercpuVariablePacket = (SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+
+                //
+                // Query or clear the percpu variable (it's in vmx-root)
+                //
+                ScriptEnginePerformPercpuVariableRequest(ScriptEnginePercpuVariablePacket);
+
+                //
+                // Send the result of the percpu variable request back to the debugger
+                //
+                KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
+                                           DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_SCRIPT_ENGINE_PERCPU_VARIABLE,
+                                           (CHAR *)ScriptEnginePercpuVariablePacket,
+                                           SIZEOF_SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS);
+
+                break;
+
+            case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_QUERY_SCRIPT_ENGINE_PROFILE:
+
+                ScriptEngineProfilePacket = (SCRIPT_ENGINE_PROFILE_PACKETS *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+
+                //
+                // Perform the profile request (it's in vmx-root)
+                //
+                ScriptEnginePerformProfileRequest(ScriptEngineProfilePacket);
+
+                //
+                // Send the result of the profile request back to the debugger
+                //
+                KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
+                                           DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_SCRIPT_ENGINE_PROFILE,
+                                           (CHAR *)ScriptEngineProfilePacket,
+                                           SIZEOF_SCRIPT_ENGINE_PROFILE_PACKETS);
+
+                break;
+
             case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_PERFORM_HYPERTRACE_LBR_DUMP:
 
                 HyperTraceLbrdumpPacket = (HYPERTRACE_LBR_DUMP_PACKETS *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
@@ -121,3 +121,359 @@ ScriptEngineGetTargetCoreDate()
     //
     return (UINT64)&DbgState->DateTimeHolder.DateBuffer;
 }
+
+/**
+ * @brief Get the aggregation table of the core
+ * @details The table is taken from the pool manager when the core runs
+ * its first aggregation function
+ *
+ * @param DbgState The processor debugging state
+ *
+ * @return PSCRIPT_ENGINE_AGGREGATION_TABLE NULL if there is no available table
+ */
+static PSCRIPT_ENGINE_AGGREGATION_TABLE
+ScriptEngineGetAggregationTable(PROCESSOR_DEBUGGING_STATE * DbgState)
+{
+    if (DbgState->ScriptEngineAggregationTable == NULL)
+    {
+        DbgState->ScriptEngineAggregationTable =
+            (PSCRIPT_ENGINE_AGGREGATION_TABLE)PoolManagerRequestPool(SCRIPT_ENGINE_AGGREGATION_TABLE, FALSE, 0);
+    }
+
+    return DbgState->ScriptEngineAggregationTable;
+}
+
+/**
+ * @brief Update an entry of the aggregation table of the current core
+ * @details The tables are not shared between the cores, so the entries are
+ * updated without locks. If the key is not found in the first entries that
+ * it can be placed, the update is counted as a dropped update
+ *
+ * @param Type Type of the aggregation
+ * @param Key
+ * @param Bucket The bucket of the histograms (zero for other types)
+ * @param Value
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineAggregationUpdate(UINT32 Type, UINT64 Key, UINT32 Bucket, UINT64 Value)
+{
+    ULONG                            CurrentCore = KeGetCurrentProcessorNumberEx(NULL);
+    PSCRIPT_ENGINE_AGGREGATION_TABLE Table       = ScriptEngineGetAggregationTable(&g_DbgState[CurrentCore]);
+    PSCRIPT_ENGINE_AGGREGATION_ENTRY Entry;
+    UINT64                           Hash;
+
+    if (Table == NULL)
+    {
+        return;
+    }
+
+    //
+    // Fibonacci hashing of the key, the type and the bucket
+    //
+    Hash = (Key ^ ((UINT64)Type << 56) ^ ((UINT64)Bucket << 48)) * 0x9e3779b97f4a7c15ULL;
+
+    for (UINT32 i = 0; i < SCRIPT_ENGINE_AGGREGATION_MAXIMUM_PROBES; i++)
+    {
+        Entry = &Table->Entries[((UINT32)(Hash >> 32) + i) & (SCRIPT_ENGINE_AGGREGATION_TABLE_SIZE - 1)];
+
+        if (Entry->Type == SCRIPT_ENGINE_AGGREGATION_TYPE_EMPTY)
+        {
+            //
+            // The type is set at last as it shows that the entry is used
+            //
+            Entry->Key    = Key;
+            Entry->Bucket = Bucket;
+            Entry->Count  = 0;
+            Entry->Value  = Value;
+            Entry->Type   = Type;
+        }
+        else if (Entry->Type != Type || Entry->Key != Key || Entry->Bucket != Bucket)
+        {
+            continue;
+        }
+        else if (Type == SCRIPT_ENGINE_AGGREGATION_TYPE_SUM)
+        {
+            Entry->Value += Value;
+        }
+        else if (Type == SCRIPT_ENGINE_AGGREGATION_TYPE_MIN && (INT64)Value < (INT64)Entry->Value)
+        {
+            Entry->Value = Value;
+        }
+        else if (Type == SCRIPT_ENGINE_AGGREGATION_TYPE_MAX && (INT64)Value > (INT64)Entry->Value)
+        {
+            Entry->Value = Value;
+        }
+
+        Entry->Count++;
+        return;
+    }
+
+    Table->DroppedUpdates++;
+}
+
+/**
+ * @brief Query or clear the aggregation tables of the cores
+ * @details The tables are read and cleared while the other cores might
+ * update them, so the updates of the same time might be missed
+ *
+ * @param AggregationRequest
+ *
+ * @return VOID
+ */
+VOID
+ScriptEnginePerformAggregationRequest(PSCRIPT_ENGINE_AGGREGATION_PACKETS AggregationRequest)
+{
+    ULONG                            ProcessorsCount = KeQueryActiveProcessorCount(0);
+    PSCRIPT_ENGINE_AGGREGATION_TABLE Table;
+    UINT32                           Index;
+
+    AggregationRequest->NumberOfCores   = ProcessorsCount;
+    AggregationRequest->NumberOfEntries = 0;
+    AggregationRequest->DroppedUpdates  = 0;
+
+    switch (AggregationRequest->RequestType)
+    {
+    case SCRIPT_ENGINE_AGGREGATION_REQUEST_TYPE_QUERY:
+
+        if (AggregationRequest->CoreId >= ProcessorsCount)
+        {
+            AggregationRequest->KernelStatus = DEBUGGER_ERROR_INVALID_CORE_ID;
+            return;
+        }
+
+        Table = g_DbgState[AggregationRequest->CoreId].ScriptEngineAggregationTable;
+        Index = AggregationRequest->StartIndex;
+
+        if (Table == NULL)
+        {
+            //
+            // The core has not run any aggregation function
+            //
+            Index = SCRIPT_ENGINE_AGGREGATION_TABLE_SIZE;
+        }
+        else
+        {
+            AggregationRequest->DroppedUpdates = Table->DroppedUpdates;
+        }
+
+        for (; Index < SCRIPT_ENGINE_AGGREGATION_TABLE_SIZE &&
+               AggregationRequest->NumberOfEntries < SCRIPT_ENGINE_AGGREGATION_MAXIMUM_ENTRIES_IN_PACKET;
+             Index++)
+        {
+            if (Table->Entries[Index].Type != SCRIPT_ENGINE_AGGREGATION_TYPE_EMPTY)
+            {
+                AggregationRequest->Entries[AggregationRequest->NumberOfEntries++] = Table->Entries[Index];
+            }
+        }
+
+        AggregationRequest->NextIndex    = Index;
+        AggregationRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+
+        break;
+
+    case SCRIPT_ENGINE_AGGREGATION_REQUEST_TYPE_CLEAR:
+
+        for (ULONG i = 0; i < ProcessorsCount; i++)
+        {
+            Table = g_DbgState[i].ScriptEngineAggregationTable;
+
+            if (Table != NULL)
+            {
+                RtlZeroMemory(Table, sizeof(SCRIPT_ENGINE_AGGREGATION_TABLE));
+            }
+        }
+
+        AggregationRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+
+        break;
+
+    default:
+
+        AggregationRequest->KernelStatus = DEBUGGER_ERROR_INVALID_SCRIPT_ENGINE_AGGREGATION_REQUEST;
+
+        break;
+    }
+}
+
+/**
+ * @brief Query or clear a percpu variable of the script engine
+ * @details Each core keeps its percpu variables in its own slice of
+ * g_ScriptPercpuVariables, the values are read while the other cores
+ * might update them
+ *
+ * @param PercpuVariableRequest
+ *
+ * @return VOID
+ */
+VOID
+ScriptEnginePerformPercpuVariableRequest(PSCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS PercpuVariableRequest)
+{
+    ULONG  ProcessorsCount = KeQueryActiveProcessorCount(0);
+    UINT32 Core;
+
+    PercpuVariableRequest->NumberOfCores  = ProcessorsCount;
+    PercpuVariableRequest->NumberOfValues = 0;
+
+    if (g_ScriptPercpuVariables == NULL || PercpuVariableRequest->VariableIndex >= MAX_VAR_COUNT)
+    {
+        PercpuVariableRequest->KernelStatus = DEBUGGER_ERROR_INVALID_SCRIPT_ENGINE_PERCPU_VARIABLE_REQUEST;
+        return;
+    }
+
+    switch (PercpuVariableRequest->RequestType)
+    {
+    case SCRIPT_ENGINE_PERCPU_VARIABLE_REQUEST_TYPE_QUERY:
+
+        if (PercpuVariableRequest->StartCore >= ProcessorsCount)
+        {
+            PercpuVariableRequest->KernelStatus = DEBUGGER_ERROR_INVALID_CORE_ID;
+            return;
+        }
+
+        for (Core = PercpuVariableRequest->StartCore;
+             Core < ProcessorsCount &&
+             PercpuVariableRequest->NumberOfValues < SCRIPT_ENGINE_PERCPU_VARIABLE_MAXIMUM_VALUES_IN_PACKET;
+             Core++)
+        {
+            PercpuVariableRequest->Values[PercpuVariableRequest->NumberOfValues++] =
+                g_ScriptPercpuVariables[Core * MAX_VAR_COUNT + PercpuVariableRequest->VariableIndex];
+        }
+
+        PercpuVariableRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+
+        break;
+
+    case SCRIPT_ENGINE_PERCPU_VARIABLE_REQUEST_TYPE_CLEAR:
+
+        for (Core = 0; Core < ProcessorsCount; Core++)
+        {
+            g_ScriptPercpuVariables[Core * MAX_VAR_COUNT + PercpuVariableRequest->VariableIndex] = 0;
+        }
+
+        PercpuVariableRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+
+        break;
+
+    default:
+
+        PercpuVariableRequest->KernelStatus = DEBUGGER_ERROR_INVALID_SCRIPT_ENGINE_PERCPU_VARIABLE_REQUEST;
+
+        break;
+    }
+}
+
+/**
+ * @brief Enable, disable, query or clear the profile of the scripts
+ * @details The profile of a script is kept in the action of the event,
+ * the entries are read while the other cores might update them
+ *
+ * @param ProfileRequest
+ *
+ * @return VOID
+ */
+VOID
+ScriptEnginePerformProfileRequest(PSCRIPT_ENGINE_PROFILE_PACKETS ProfileRequest)
+{
+    PDEBUGGER_EVENT              Event;
+    PLIST_ENTRY                  TempList;
+    PSCRIPT_ENGINE_PROFILE_ENTRY Profile         = NULL;
+    UINT32                       NumberOfSymbols = 0;
+    UINT32                       Index;
+
+    ProfileRequest->NumberOfEntries = 0;
+    ProfileRequest->NumberOfSymbols = 0;
+    ProfileRequest->NextIndex       = 0;
+
+    switch (ProfileRequest->RequestType)
+    {
+    case SCRIPT_ENGINE_PROFILE_REQUEST_TYPE_ENABLE:
+
+        g_ScriptEngineProfilingEnabled     = TRUE;
+        ProfileRequest->IsProfilingEnabled = g_ScriptEngineProfilingEnabled;
+        ProfileRequest->KernelStatus       = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+
+        return;
+
+    case SCRIPT_ENGINE_PROFILE_REQUEST_TYPE_DISABLE:
+
+        g_ScriptEngineProfilingEnabled     = FALSE;
+        ProfileRequest->IsProfilingEnabled = g_ScriptEngineProfilingEnabled;
+        ProfileRequest->KernelStatus       = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+
+        return;
+
+    case SCRIPT_ENGINE_PROFILE_REQUEST_TYPE_QUERY:
+    case SCRIPT_ENGINE_PROFILE_REQUEST_TYPE_CLEAR:
+
+        break;
+
+    default:
+
+        ProfileRequest->IsProfilingEnabled = g_ScriptEngineProfilingEnabled;
+        ProfileRequest->KernelStatus       = DEBUGGER_ERROR_INVALID_SCRIPT_ENGINE_PROFILE_REQUEST;
+
+        return;
+    }
+
+    ProfileRequest->IsProfilingEnabled = g_ScriptEngineProfilingEnabled;
+
+    //
+    // Find the first script of the event that is profiled
+    //
+    Event = DebuggerGetEventByTag(ProfileRequest->Tag);
+
+    if (Event != NULL)
+    {
+        TempList = &Event->ActionsListHead;
+
+        while (&Event->ActionsListHead != TempList->Flink)
+        {
+            TempList                             = TempList->Flink;
+            PDEBUGGER_EVENT_ACTION CurrentAction = CONTAINING_RECORD(TempList, DEBUGGER_EVENT_ACTION, ActionsList);
+
+            if (CurrentAction->ActionType == RUN_SCRIPT && CurrentAction->ScriptProfile != NULL)
+            {
+                Profile         = CurrentAction->ScriptProfile;
+                NumberOfSymbols = CurrentAction->ScriptConfiguration.ScriptPointer;
+                break;
+            }
+        }
+    }
+
+    if (Profile == NULL)
+    {
+        ProfileRequest->KernelStatus = DEBUGGER_ERROR_SCRIPT_ENGINE_PROFILE_NOT_FOUND;
+        return;
+    }
+
+    ProfileRequest->NumberOfSymbols = NumberOfSymbols;
+
+    if (ProfileRequest->RequestType == SCRIPT_ENGINE_PROFILE_REQUEST_TYPE_CLEAR)
+    {
+        RtlZeroMemory(Profile, NumberOfSymbols * sizeof(SCRIPT_ENGINE_PROFILE_ENTRY));
+
+        ProfileRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+        return;
+    }
+
+    //
+    // Only the symbols that are executed at least once are returned
+    //
+    for (Index = ProfileRequest->StartIndex;
+         Index < NumberOfSymbols &&
+         ProfileRequest->NumberOfEntries < SCRIPT_ENGINE_PROFILE_MAXIMUM_ENTRIES_IN_PACKET;
+         Index++)
+    {
+        if (Profile[Index].Count != 0)
+        {
+            ProfileRequest->Entries[ProfileRequest->NumberOfEntries].Index   = Index;
+            ProfileRequest->Entries[ProfileRequest->NumberOfEntries].Profile = Profile[Index];
+            ProfileRequest->NumberOfEntries++;
+        }
+    }
+
+    ProfileRequest->NextIndex    = Index;
+    ProfileRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+}
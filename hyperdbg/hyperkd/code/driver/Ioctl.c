@@ -431,6 +431,9 @@ DrvDispatchVmmIoControl(PIRP Irp, PIO_STACK_LOCATION IrpStack, BOOLEAN * DoNotCh
     PDEBUGGER_PAUSE_PACKET_RECEIVED                         DebuggerPauseKernelRequest;
     PDEBUGGER_GENERAL_ACTION                                DebuggerNewActionRequest;
     PSMI_OPERATION_PACKETS                                  SmiOperationRequest;
+    PSCRIPT_ENGINE_AGGREGATION_PACKETS                      ScriptEngineAggregationRequest;
+    PSCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS                  ScriptEnginePercpuVariableRequest;
+    PSCRIPT_ENGINE_PROFILE_PACKETS                          ScriptEngineProfileRequest;
     PVOID                                                   BufferToStoreThreadsAndProcessesDetails;
     ULONG                                                   InBuffLength;  // Input buffer length
     ULONG                                                   OutBuffLength; // Output buffer length
@@ -1246,6 +1249,90 @@ DrvDispatchVmmIoControl(PIRP Irp, PIO_STACK_LOCATION IrpStack, BOOLEAN * DoNotCh
 
         break;
 
+    case IOCTL_QUERY_SCRIPT_ENGINE_AGGREGATIONS:
+
+        //
+        // Validate and adjust the parameters, and set the target buffer to the system buffer of the IRP
+        //
+        if (!DrvValidateAndAdjustIoctlParameter(SIZEOF_SCRIPT_ENGINE_AGGREGATION_PACKETS,
+                                                (PVOID *)&ScriptEngineAggregationRequest,
+                                                Irp,
+                                                IrpStack,
+                                                &InBuffLength,
+                                                &OutBuffLength))
+        {
+            Status = STATUS_INVALID_PARAMETER;
+            break;
+        }
+
+        //
+        // Query or clear the aggregation tables (it's not from vmx-root)
+        //
+        ScriptEnginePerformAggregationRequest(ScriptEngineAggregationRequest);
+
+        //
+        // Adjust the status and output size
+        //
+        DrvAdjustStatusAndSetOutputSize(SIZEOF_SCRIPT_ENGINE_AGGREGATION_PACKETS, DoNotChangeInformation, Irp, &Status);
+
+        break;
+
+    case IOCTL_QUERY_SCRIPT_ENGINE_PERCPU_VARIABLE:
+
+        //
+        // Validate and adjust the parameters, and set the target buffer to the system buffer of the IRP
+        //
+        if (!DrvValidateAndAdjustIoctlParameter(SIZEOF_SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS,
+                                                (PVOID *)&ScriptEnginePercpuVariableRequest,
+                                                Irp,
+                                                IrpStack,
+                                                &InBuffLength,
+                                                &OutBuffLength))
+        {
+            Status = STATUS_INVALID_PARAMETER;
+            break;
+        }
+
+        //
+        // Query or clear the percpu variable (it's not from vmx-root)
+        //
+        ScriptEnginePerformPercpuVariableRequest(ScriptEnginePercpuVariableRequest);
+
+        //
+        // Adjust the status and output size
+        //
+        DrvAdjustStatusAndSetOutputSize(SIZEOF_SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS, DoNotChangeInformation, Irp, &Status);
+
+        break;
+
+    case IOCTL_QUERY_SCRIPT_ENGINE_PROFILE:
+
+        //
+        // Validate and adjust the parameters, and set the target buffer to the system buffer of the IRP
+        //
+        if (!DrvValidateAndAdjustIoctlParameter(SIZEOF_SCRIPT_ENGINE_PROFILE_PACKETS,
+                                                (PVOID *)&ScriptEngineProfileRequest,
+                                                Irp,
+                                                IrpStack,
+                                                &InBuffLength,
+                                                &OutBuffLength))
+        {
+            Status = STATUS_INVALID_PARAMETER;
+            break;
+        }
+
+        //
+        // Perform the profile request (it's not from vmx-root)
+        //
+        ScriptEnginePerformProfileRequest(ScriptEngineProfileRequest);
+
+        //
+        // Adjust the status and output size
+        //
+        DrvAdjustStatusAndSetOutputSize(SIZEOF_SCRIPT_ENGINE_PROFILE_PACKETS, DoNotChangeInformation, Irp, &Status);
+
+        break;
+
     case IOCTL_SEND_USER_DEBUGGER_COMMANDS:
 
         //
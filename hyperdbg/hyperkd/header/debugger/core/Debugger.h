@@ -96,6 +96,10 @@ typedef struct _DEBUGGER_EVENT_ACTION
     UINT32 CustomCodeBufferSize;    // if null, means it's not custom code type
     PVOID  CustomCodeBufferAddress; // address of custom code if any
 
+    PVOID LinkedScriptCode; // linked (pre-decoded) code of the script if any
+
+    PSCRIPT_ENGINE_PROFILE_ENTRY ScriptProfile; // profile of the script (an entry per symbol) if any
+
 } DEBUGGER_EVENT_ACTION, *PDEBUGGER_EVENT_ACTION;
 
 /* ==============================================================================================
@@ -154,6 +154,19 @@ typedef struct _DATE_TIME_HOLDER
 
 } DATE_TIME_HOLDER, *PDATE_TIME_HOLDER;
 
+/**
+ * @brief The aggregation table of the script engine for the core
+ * @details Allocated from the pool manager when the core runs its first
+ * aggregation function
+ *
+ */
+typedef struct _SCRIPT_ENGINE_AGGREGATION_TABLE
+{
+    UINT64                          DroppedUpdates;
+    SCRIPT_ENGINE_AGGREGATION_ENTRY Entries[SCRIPT_ENGINE_AGGREGATION_TABLE_SIZE];
+
+} SCRIPT_ENGINE_AGGREGATION_TABLE, *PSCRIPT_ENGINE_AGGREGATION_TABLE;
+
 /**
  * @brief Saves the debugger state
  * @details Each logical processor contains one of this structure which describes about the
@@ -181,6 +194,7 @@ typedef struct _PROCESSOR_DEBUGGING_STATE
     UINT16                                     InstructionLengthHint;
     UINT64                                     HardwareDebugRegisterForStepping;
     UINT64 *                                   ScriptEngineCoreSpecificStackBuffer;
+    PSCRIPT_ENGINE_AGGREGATION_TABLE           ScriptEngineAggregationTable;
     PKDPC                                      KdDpcObject;                       // DPC object to be used in kernel debugger
     CHAR                                       KdRecvBuffer[MaxSerialPacketSize]; // Used for debugging buffers (receiving buffers from serial devices)
 
@@ -26,3 +26,15 @@ ScriptEngineGetTargetCoreTime();
 
 UINT64
 ScriptEngineGetTargetCoreDate();
+
+VOID
+ScriptEngineAggregationUpdate(UINT32 Type, UINT64 Key, UINT32 Bucket, UINT64 Value);
+
+VOID
+ScriptEnginePerformAggregationRequest(PSCRIPT_ENGINE_AGGREGATION_PACKETS AggregationRequest);
+
+VOID
+ScriptEnginePerformPercpuVariableRequest(PSCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS PercpuVariableRequest);
+
+VOID
+ScriptEnginePerformProfileRequest(PSCRIPT_ENGINE_PROFILE_PACKETS ProfileRequest);
@@ -70,6 +70,32 @@ UINT32 g_UserDebuggerWaitingCommandOutputBufferLength;
  */
 UINT64 * g_ScriptGlobalVariables;
 
+/**
+ * @brief Holder of script engines per-core (percpu) variables
+ * @details Each core owns a slice of MAX_VAR_COUNT entries
+ *
+ */
+UINT64 * g_ScriptPercpuVariables;
+
+/**
+ * @brief Holder of the expanded scripts that are received in the compact format
+ *
+ */
+SYMBOL * g_ScriptEngineExpandedCodeBuffer;
+
+/**
+ * @brief Lock for the holder of the expanded scripts
+ *
+ */
+volatile LONG g_ScriptEngineExpandedCodeBufferLock;
+
+/**
+ * @brief Whether the scripts of the events are profiled or not
+ * @details The profiled scripts are interpreted (not run by their linked code)
+ *
+ */
+BOOLEAN g_ScriptEngineProfilingEnabled;
+
 /**
  * @brief State of the trap-flag
  *
@@ -154,6 +154,11 @@
 //
 #include "../script-eval/header/ScriptEngineHeader.h"
 
+//
+// Compact script buffers
+//
+#include "components/bytecode/header/CompactBytecode.h"
+
 //
 // Tracing (hypertrace) headers
 //
@@ -236,16 +236,28 @@ typedef struct GUEST_EXTRA_REGISTERS
     UINT64 RIP;
 } GUEST_EXTRA_REGISTERS, *PGUEST_EXTRA_REGISTERS;
 
+/**
+ * @brief Profile of a symbol of the script engine (the number of executions
+ * of the operator and the cycles that are spent on it)
+ */
+typedef struct _SCRIPT_ENGINE_PROFILE_ENTRY
+{
+    UINT64 Count;
+    UINT64 Cycles;
+} SCRIPT_ENGINE_PROFILE_ENTRY, *PSCRIPT_ENGINE_PROFILE_ENTRY;
+
 /**
  * @brief List of different variables
  */
 typedef struct _SCRIPT_ENGINE_GENERAL_REGISTERS
 {
-    UINT64 * StackBuffer;
-    UINT64 * GlobalVariablesList;
-    UINT64   StackIndx;
-    UINT64   StackBaseIndx;
-    UINT64   ReturnValue;
+    UINT64 *                      StackBuffer;
+    UINT64 *                      GlobalVariablesList;
+    UINT64 *                      PercpuVariablesList; // per-core (percpu) variables of the current core
+    UINT64                        StackIndx;
+    UINT64                        StackBaseIndx;
+    UINT64                        ReturnValue;
+    SCRIPT_ENGINE_PROFILE_ENTRY * Profile; // an entry per symbol of the script, NULL if it's not profiled
 } SCRIPT_ENGINE_GENERAL_REGISTERS, *PSCRIPT_ENGINE_GENERAL_REGISTERS;
 
 /**
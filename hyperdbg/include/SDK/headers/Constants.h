@@ -594,6 +594,18 @@ const UCHAR BuildSignature[] = {
 
 #define MAX_FUNCTION_NAME_LENGTH 32
 
+/**
+ * @brief Number of the entries of the aggregation table of each core
+ * in the script engine (should be a power of two)
+ */
+#define SCRIPT_ENGINE_AGGREGATION_TABLE_SIZE 512
+
+/**
+ * @brief Maximum number of the entries that are checked to find the
+ * entry of a key in the aggregation tables
+ */
+#define SCRIPT_ENGINE_AGGREGATION_MAXIMUM_PROBES 32
+
 //////////////////////////////////////////////////
 //                  Debugger                    //
 //////////////////////////////////////////////////
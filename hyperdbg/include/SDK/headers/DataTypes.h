@@ -92,6 +92,11 @@ typedef enum _POOL_ALLOCATION_INTENTION
     INSTANT_REGULAR_SAFE_BUFFER_FOR_EVENTS,
     INSTANT_BIG_SAFE_BUFFER_FOR_EVENTS,
 
+    //
+    // Per-core tables of the aggregation functions of the script engine
+    //
+    SCRIPT_ENGINE_AGGREGATION_TABLE,
+
 } POOL_ALLOCATION_INTENTION;
 
 //////////////////////////////////////////////////
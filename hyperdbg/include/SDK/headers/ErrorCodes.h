@@ -653,6 +653,36 @@
  */
 #define DEBUGGER_ERROR_CANNOT_INITIALIZE_DEBUGGER 0xc0000065
 
+/**
+ * @brief error, the script buffer is invalid
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_SCRIPT_BUFFER 0xc0000066
+
+/**
+ * @brief error, invalid request for the aggregation tables of the script engine
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_SCRIPT_ENGINE_AGGREGATION_REQUEST 0xc0000067
+
+/**
+ * @brief error, invalid request for the percpu variables of the script engine
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_SCRIPT_ENGINE_PERCPU_VARIABLE_REQUEST 0xc0000068
+
+/**
+ * @brief error, invalid request for the profile of the scripts
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_SCRIPT_ENGINE_PROFILE_REQUEST 0xc0000069
+
+/**
+ * @brief error, the event doesn't have a profiled script
+ *
+ */
+#define DEBUGGER_ERROR_SCRIPT_ENGINE_PROFILE_NOT_FOUND 0xc000006a
+
 //
 // WHEN YOU ADD ANYTHING TO THIS LIST OF ERRORS, THEN
 // MAKE SURE TO ADD AN ERROR MESSAGE TO ShowErrorMessage(UINT32 Error)
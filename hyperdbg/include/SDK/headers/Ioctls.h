@@ -396,6 +396,27 @@
 #define IOCTL_DEBUGGER_CPUID \
     CTL_CODE(FILE_DEVICE_UNKNOWN, IOCTL_VMM_IOCTL + 0x27, METHOD_BUFFERED, FILE_ANY_ACCESS)
 
+/**
+ * @brief ioctl, to query or clear the aggregation tables of the script engine
+ *
+ */
+#define IOCTL_QUERY_SCRIPT_ENGINE_AGGREGATIONS \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, IOCTL_VMM_IOCTL + 0x28, METHOD_BUFFERED, FILE_ANY_ACCESS)
+
+/**
+ * @brief ioctl, to query or clear the percpu variables of the script engine
+ *
+ */
+#define IOCTL_QUERY_SCRIPT_ENGINE_PERCPU_VARIABLE \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, IOCTL_VMM_IOCTL + 0x29, METHOD_BUFFERED, FILE_ANY_ACCESS)
+
+/**
+ * @brief ioctl, to query, clear, enable or disable the profile of the scripts
+ *
+ */
+#define IOCTL_QUERY_SCRIPT_ENGINE_PROFILE \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, IOCTL_VMM_IOCTL + 0x2a, METHOD_BUFFERED, FILE_ANY_ACCESS)
+
 //////////////////////////////////////////////////
 //               HyperTrace IOCTLs              //
 //////////////////////////////////////////////////
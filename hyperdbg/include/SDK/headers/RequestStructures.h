@@ -1537,6 +1537,211 @@ static_assert(sizeof(INTERRUPT_DESCRIPTOR_TABLE_ENTRIES_PACKETS) < PacketChunkSi
 
 // ==============================================================================================
 
+/**
+ * @brief Types of the aggregations of the script engine
+ *
+ */
+typedef enum _SCRIPT_ENGINE_AGGREGATION_TYPE
+{
+    SCRIPT_ENGINE_AGGREGATION_TYPE_EMPTY = 0,
+    SCRIPT_ENGINE_AGGREGATION_TYPE_COUNT,
+    SCRIPT_ENGINE_AGGREGATION_TYPE_SUM,
+    SCRIPT_ENGINE_AGGREGATION_TYPE_MIN,
+    SCRIPT_ENGINE_AGGREGATION_TYPE_MAX,
+    SCRIPT_ENGINE_AGGREGATION_TYPE_HISTOGRAM,
+
+} SCRIPT_ENGINE_AGGREGATION_TYPE;
+
+/**
+ * @brief An entry of the aggregation tables of the script engine
+ * @details The histograms have a separate entry for each bucket of a key,
+ * the bucket of zero is 0 and the bucket of other values is the index of
+ * their highest set bit plus one
+ *
+ */
+typedef struct _SCRIPT_ENGINE_AGGREGATION_ENTRY
+{
+    UINT64 Key;
+    UINT32 Type;
+    UINT32 Bucket;
+    UINT64 Count;
+    UINT64 Value;
+
+} SCRIPT_ENGINE_AGGREGATION_ENTRY, *PSCRIPT_ENGINE_AGGREGATION_ENTRY;
+
+/**
+ * @brief Requests of the aggregation tables of the script engine
+ *
+ */
+typedef enum _SCRIPT_ENGINE_AGGREGATION_REQUEST_TYPE
+{
+    SCRIPT_ENGINE_AGGREGATION_REQUEST_TYPE_QUERY,
+    SCRIPT_ENGINE_AGGREGATION_REQUEST_TYPE_CLEAR,
+
+} SCRIPT_ENGINE_AGGREGATION_REQUEST_TYPE;
+
+/**
+ * @brief Maximum number of the aggregation entries in each packet
+ *
+ */
+#define SCRIPT_ENGINE_AGGREGATION_MAXIMUM_ENTRIES_IN_PACKET 96
+
+/**
+ * @brief The structure of the aggregation tables packet in HyperDbg
+ * @details Each query returns the used entries of the table of CoreId from
+ * StartIndex, the next query of the same core should start from NextIndex
+ * until it reaches SCRIPT_ENGINE_AGGREGATION_TABLE_SIZE
+ *
+ */
+typedef struct _SCRIPT_ENGINE_AGGREGATION_PACKETS
+{
+    SCRIPT_ENGINE_AGGREGATION_REQUEST_TYPE RequestType;
+    UINT32                                 CoreId;
+    UINT32                                 StartIndex;
+    UINT32                                 NextIndex;
+    UINT32                                 NumberOfCores;
+    UINT32                                 NumberOfEntries;
+    UINT64                                 DroppedUpdates;
+    UINT32                                 KernelStatus;
+    SCRIPT_ENGINE_AGGREGATION_ENTRY        Entries[SCRIPT_ENGINE_AGGREGATION_MAXIMUM_ENTRIES_IN_PACKET];
+
+} SCRIPT_ENGINE_AGGREGATION_PACKETS, *PSCRIPT_ENGINE_AGGREGATION_PACKETS;
+
+/**
+ * @brief Debugger size of SCRIPT_ENGINE_AGGREGATION_PACKETS
+ *
+ */
+#define SIZEOF_SCRIPT_ENGINE_AGGREGATION_PACKETS \
+    sizeof(SCRIPT_ENGINE_AGGREGATION_PACKETS)
+
+/**
+ * @brief check so the SCRIPT_ENGINE_AGGREGATION_PACKETS should be smaller than packet size
+ *
+ */
+static_assert(sizeof(SCRIPT_ENGINE_AGGREGATION_PACKETS) < PacketChunkSize,
+              "err (static_assert), size of PacketChunkSize should be bigger than SCRIPT_ENGINE_AGGREGATION_PACKETS");
+
+// ==============================================================================================
+
+/**
+ * @brief Requests of the percpu variables of the script engine
+ *
+ */
+typedef enum _SCRIPT_ENGINE_PERCPU_VARIABLE_REQUEST_TYPE
+{
+    SCRIPT_ENGINE_PERCPU_VARIABLE_REQUEST_TYPE_QUERY,
+    SCRIPT_ENGINE_PERCPU_VARIABLE_REQUEST_TYPE_CLEAR,
+
+} SCRIPT_ENGINE_PERCPU_VARIABLE_REQUEST_TYPE;
+
+/**
+ * @brief Maximum number of the values of the cores in each percpu variable packet
+ *
+ */
+#define SCRIPT_ENGINE_PERCPU_VARIABLE_MAXIMUM_VALUES_IN_PACKET 256
+
+/**
+ * @brief The structure of the percpu variable packet in HyperDbg
+ * @details Each query returns the values of the variable on the cores from
+ * StartCore, the next query should start from StartCore + NumberOfValues
+ * until it reaches NumberOfCores
+ *
+ */
+typedef struct _SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS
+{
+    SCRIPT_ENGINE_PERCPU_VARIABLE_REQUEST_TYPE RequestType;
+    UINT32                                     VariableIndex;
+    UINT32                                     StartCore;
+    UINT32                                     NumberOfCores;
+    UINT32                                     NumberOfValues;
+    UINT32                                     KernelStatus;
+    UINT64                                     Values[SCRIPT_ENGINE_PERCPU_VARIABLE_MAXIMUM_VALUES_IN_PACKET];
+
+} SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS, *PSCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS;
+
+/**
+ * @brief Debugger size of SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS
+ *
+ */
+#define SIZEOF_SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS \
+    sizeof(SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS)
+
+/**
+ * @brief check so the SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS should be smaller than packet size
+ *
+ */
+static_assert(sizeof(SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS) < PacketChunkSize,
+              "err (static_assert), size of PacketChunkSize should be bigger than SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS");
+
+// ==============================================================================================
+
+/**
+ * @brief Requests of the profile of the scripts
+ *
+ */
+typedef enum _SCRIPT_ENGINE_PROFILE_REQUEST_TYPE
+{
+    SCRIPT_ENGINE_PROFILE_REQUEST_TYPE_QUERY,
+    SCRIPT_ENGINE_PROFILE_REQUEST_TYPE_CLEAR,
+    SCRIPT_ENGINE_PROFILE_REQUEST_TYPE_ENABLE,
+    SCRIPT_ENGINE_PROFILE_REQUEST_TYPE_DISABLE,
+
+} SCRIPT_ENGINE_PROFILE_REQUEST_TYPE;
+
+/**
+ * @brief Maximum number of the profiled symbols in each profile packet
+ *
+ */
+#define SCRIPT_ENGINE_PROFILE_MAXIMUM_ENTRIES_IN_PACKET 160
+
+/**
+ * @brief Profile of a symbol of the script in the profile packet
+ *
+ */
+typedef struct _SCRIPT_ENGINE_PROFILE_PACKET_ENTRY
+{
+    UINT32                      Index;
+    SCRIPT_ENGINE_PROFILE_ENTRY Profile;
+
+} SCRIPT_ENGINE_PROFILE_PACKET_ENTRY, *PSCRIPT_ENGINE_PROFILE_PACKET_ENTRY;
+
+/**
+ * @brief The structure of the profile packet in HyperDbg
+ * @details Each query returns the executed symbols of the script of the
+ * event from StartIndex, the next query should start from NextIndex until
+ * it reaches NumberOfSymbols
+ *
+ */
+typedef struct _SCRIPT_ENGINE_PROFILE_PACKETS
+{
+    SCRIPT_ENGINE_PROFILE_REQUEST_TYPE RequestType;
+    UINT64                             Tag;
+    UINT32                             StartIndex;
+    UINT32                             NextIndex;
+    UINT32                             NumberOfSymbols;
+    UINT32                             NumberOfEntries;
+    BOOLEAN                            IsProfilingEnabled;
+    UINT32                             KernelStatus;
+    SCRIPT_ENGINE_PROFILE_PACKET_ENTRY Entries[SCRIPT_ENGINE_PROFILE_MAXIMUM_ENTRIES_IN_PACKET];
+
+} SCRIPT_ENGINE_PROFILE_PACKETS, *PSCRIPT_ENGINE_PROFILE_PACKETS;
+
+/**
+ * @brief Debugger size of SCRIPT_ENGINE_PROFILE_PACKETS
+ *
+ */
+#define SIZEOF_SCRIPT_ENGINE_PROFILE_PACKETS \
+    sizeof(SCRIPT_ENGINE_PROFILE_PACKETS)
+
+/**
+ * @brief check so the SCRIPT_ENGINE_PROFILE_PACKETS should be smaller than packet size
+ *
+ */
+static_assert(sizeof(SCRIPT_ENGINE_PROFILE_PACKETS) < PacketChunkSize,
+              "err (static_assert), size of PacketChunkSize should be bigger than SCRIPT_ENGINE_PROFILE_PACKETS");
+
+// ==============================================================================================
+
 /**
  * @brief The structure of .formats result packet in HyperDbg
  *
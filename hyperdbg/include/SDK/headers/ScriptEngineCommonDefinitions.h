@@ -24,8 +24,47 @@ typedef struct SYMBOL_BUFFER {
     unsigned int Pointer;
     unsigned int Size;
     char* Message;
+    unsigned int* Lines; // source line of each symbol (NULL if not available)
 } SYMBOL_BUFFER, * PSYMBOL_BUFFER;
 
+/**
+ * @brief Header of a compact (variable-length) script buffer
+ *
+ * @details A compact buffer starts with this header and is followed by one
+ * record per symbol: a tag byte (the low 5 bits are the type, 0x1f means the
+ * type follows as a varint, 0x20 means a varint Len follows and the high 2 bits
+ * show how the value is stored), then the varint operands. Strings store their
+ * Len bytes right after the tag and the Len. Buffers without this header are
+ * plain arrays of SYMBOL (the first type of them never has the high bits set).
+ */
+typedef struct SCRIPT_COMPACT_BUFFER_HEADER
+{
+    long long unsigned Magic;
+    unsigned int Version;
+    unsigned int SymbolCount;
+
+} SCRIPT_COMPACT_BUFFER_HEADER, *PSCRIPT_COMPACT_BUFFER_HEADER;
+
+#define SCRIPT_COMPACT_BUFFER_MAGIC 0x5450495243534448ull // "HDSCRIPT"
+#define SCRIPT_COMPACT_BUFFER_VERSION 1
+
+#define SCRIPT_COMPACT_TAG_TYPE_MASK 0x1f
+#define SCRIPT_COMPACT_TAG_TYPE_ESCAPE 0x1f
+#define SCRIPT_COMPACT_TAG_HAS_LEN 0x20
+#define SCRIPT_COMPACT_TAG_VALUE_SHIFT 6
+
+#define SCRIPT_COMPACT_VALUE_ZERO 0
+#define SCRIPT_COMPACT_VALUE_VARINT 1
+#define SCRIPT_COMPACT_VALUE_INVERTED_VARINT 2 // ~Value as a varint (small negative numbers)
+#define SCRIPT_COMPACT_VALUE_RAW 3
+
+/**
+ * @brief A symbol never needs more than 32 bytes in the compact format
+ * (tag + 3 varints of at most 10 bytes)
+ */
+#define SCRIPT_COMPACT_BUFFER_MAXIMUM_SIZE(SymbolCount) \
+    (sizeof(SCRIPT_COMPACT_BUFFER_HEADER) + (SymbolCount) * 32)
+
 typedef struct SYMBOL_MAP
 {
     char* Name;
@@ -62,11 +101,71 @@ typedef struct ACTION_BUFFER {
 #define SYMBOL_REFERENCE_TEMP_TYPE 19
 #define SYMBOL_DEREFERENCE_LOCAL_ID_TYPE 20
 #define SYMBOL_DEREFERENCE_TEMP_TYPE 21
+#define SYMBOL_PERCPU_ID_TYPE 22
 
 #define SYMBOL_VALUE_KIND_INTEGER 0
 #define SYMBOL_VALUE_KIND_FLOAT32 1
 #define SYMBOL_VALUE_KIND_FLOAT64 2
 
+/**
+ * @brief Descriptors of the format specifiers of printf
+ *
+ * @details The compiler keeps the descriptor of the specifier of each argument
+ * of printf in the high 32 bits of the type of the argument: the position of
+ * its '%' in the format, its length and its kind. The high 32 bits of the type
+ * of the variable count symbol keep the id of the format for the deferred
+ * messages (zero if the message is formatted by the evaluator).
+ */
+#define SYMBOL_FORMAT_SPECIFIER_POSITION_SHIFT 32
+#define SYMBOL_FORMAT_SPECIFIER_POSITION_MASK 0xffffff
+#define SYMBOL_FORMAT_SPECIFIER_LENGTH_SHIFT 56
+#define SYMBOL_FORMAT_SPECIFIER_LENGTH_MASK 0xf
+#define SYMBOL_FORMAT_SPECIFIER_KIND_SHIFT 60
+#define SYMBOL_FORMAT_ID_SHIFT 32
+
+#define FORMAT_SPECIFIER_KIND_INTEGER 1
+#define FORMAT_SPECIFIER_KIND_FLOAT 2
+#define FORMAT_SPECIFIER_KIND_STRING 3
+#define FORMAT_SPECIFIER_KIND_WSTRING 4
+
+/**
+ * @brief Header of a deferred printf message, the raw 64-bit values of the
+ * arguments follow it and the debugger formats the message by the id
+ *
+ * @details The indicator is zero, so the message is an empty string for
+ * the readers that don't know the deferred messages
+ */
+typedef struct SCRIPT_DEFERRED_PRINTF_HEADER
+{
+    unsigned int Indicator;
+    unsigned int FormatId;
+
+} SCRIPT_DEFERRED_PRINTF_HEADER, *PSCRIPT_DEFERRED_PRINTF_HEADER;
+
+#define SCRIPT_DEFERRED_PRINTF_INDICATOR 0
+#define SCRIPT_DEFERRED_PRINTF_MAXIMUM_ARGUMENTS 32
+
+/**
+ * @brief Header of a binary record of the emit function, the raw 64-bit
+ * values of the arguments follow it
+ *
+ * @details The indicator is zero and the signature is never a valid format
+ * id, so the record is not taken as a string or as a deferred printf message
+ */
+typedef struct SCRIPT_EMIT_RECORD_HEADER
+{
+    unsigned int       Indicator;
+    unsigned int       Signature;
+    unsigned long long Tag;
+    unsigned long long Tsc;
+    unsigned int       Core;
+    unsigned int       ArgCount;
+
+} SCRIPT_EMIT_RECORD_HEADER, *PSCRIPT_EMIT_RECORD_HEADER;
+
+#define SCRIPT_EMIT_RECORD_SIGNATURE 0xffffffff
+#define SCRIPT_EMIT_RECORD_MAXIMUM_ARGUMENTS 32
+
 #define SCRIPT_ENGINE_ADDRESS_SPACE_LOCAL 1
 #define SCRIPT_ENGINE_ADDRESS_SPACE_REMOTE 2
 
@@ -107,7 +206,8 @@ static const char *const SymbolTypeNames[] = {
 "SYMBOL_REFERENCE_LOCAL_ID_TYPE",
 "SYMBOL_REFERENCE_TEMP_TYPE",
 "SYMBOL_DEREFERENCE_LOCAL_ID_TYPE",
-"SYMBOL_DEREFERENCE_TEMP_TYPE"
+"SYMBOL_DEREFERENCE_TEMP_TYPE",
+"SYMBOL_PERCPU_ID_TYPE"
 };
 
 #define SYMBOL_MEM_VALID_CHECK_MASK (1 << 31)
@@ -162,123 +262,129 @@ static const char *const SymbolTypeNames[] = {
 #define FUNC_SPINLOCK_UNLOCK 43
 #define FUNC_EVENT_SC 44
 #define FUNC_MICROSLEEP 45
-#define FUNC_PRINTF 46
-#define FUNC_PAUSE 47
-#define FUNC_FLUSH 48
-#define FUNC_EVENT_TRACE_STEP 49
-#define FUNC_EVENT_TRACE_STEP_IN 50
-#define FUNC_EVENT_TRACE_STEP_OUT 51
-#define FUNC_EVENT_TRACE_INSTRUMENTATION_STEP 52
-#define FUNC_EVENT_TRACE_INSTRUMENTATION_STEP_IN 53
-#define FUNC_RDTSC 54
-#define FUNC_RDTSCP 55
-#define FUNC_LBR_SAVE 56
-#define FUNC_LBR_DUMP 57
-#define FUNC_LBR_PRINT 58
-#define FUNC_LBR_RESTORE 59
-#define FUNC_LBR_CHECK 60
-#define FUNC_SPINLOCK_LOCK_CUSTOM_WAIT 61
-#define FUNC_EVENT_INJECT 62
-#define FUNC_POI 63
-#define FUNC_DB 64
-#define FUNC_DD 65
-#define FUNC_DW 66
-#define FUNC_DQ 67
-#define FUNC_NEG 68
-#define FUNC_HI 69
-#define FUNC_LOW 70
-#define FUNC_NOT 71
-#define FUNC_CHECK_ADDRESS 72
-#define FUNC_DISASSEMBLE_LEN 73
-#define FUNC_DISASSEMBLE_LEN32 74
-#define FUNC_DISASSEMBLE_LEN64 75
-#define FUNC_INTERLOCKED_INCREMENT 76
-#define FUNC_INTERLOCKED_DECREMENT 77
-#define FUNC_PHYSICAL_TO_VIRTUAL 78
-#define FUNC_VIRTUAL_TO_PHYSICAL 79
-#define FUNC_POI_PA 80
-#define FUNC_HI_PA 81
-#define FUNC_LOW_PA 82
-#define FUNC_DB_PA 83
-#define FUNC_DD_PA 84
-#define FUNC_DW_PA 85
-#define FUNC_DQ_PA 86
-#define FUNC_LBR_RESTORE_BY_FILTER 87
-#define FUNC_ED 88
-#define FUNC_EB 89
-#define FUNC_EQ 90
-#define FUNC_INTERLOCKED_EXCHANGE 91
-#define FUNC_INTERLOCKED_EXCHANGE_ADD 92
-#define FUNC_EB_PA 93
-#define FUNC_ED_PA 94
-#define FUNC_EQ_PA 95
-#define FUNC_INTERLOCKED_COMPARE_EXCHANGE 96
-#define FUNC_STRLEN 97
-#define FUNC_STRCMP 98
-#define FUNC_MEMCMP 99
-#define FUNC_STRNCMP 100
-#define FUNC_WCSLEN 101
-#define FUNC_WCSCMP 102
-#define FUNC_EVENT_INJECT_ERROR_CODE 103
-#define FUNC_MEMCPY 104
-#define FUNC_MEMCPY_PA 105
-#define FUNC_WCSNCMP 106
-#define FUNC_STRUCT_FORWARD_DECLARATION 107
-#define FUNC_STRUCT_DEFINITION_BEGIN 108
-#define FUNC_STRUCT_DEFINITION_END 109
-#define FUNC_STRUCT_VARIABLE_DECLARATION 110
-#define FUNC_STRUCT_MEMBER_DECLARATION 111
-#define FUNC_TYPEDEF_DECLARATION 112
-#define FUNC_STRUCT_POINTER 113
-#define FUNC_STRUCT_ARRAY_DIMENSION 114
-#define FUNC_STRUCT_DECLARATOR_COMPLETE 115
-#define FUNC_TYPED_LOAD 116
-#define FUNC_TYPED_STORE 117
-#define FUNC_AGGREGATE_COPY 118
-#define FUNC_AGGREGATE_ZERO 119
-#define FUNC_STRUCT_INITIALIZER_BEGIN 120
-#define FUNC_STRUCT_INITIALIZER_END 121
-#define FUNC_STRUCT_POINTER_CAST 122
-#define FUNC_MEMBER_ADDRESS 123
-#define FUNC_MEMBER_READ 124
-#define FUNC_MEMBER_DOT_LVALUE 125
-#define FUNC_MEMBER_ARROW_LVALUE 126
-#define FUNC_MEMBER_DOT_READ 127
-#define FUNC_MEMBER_ARROW_READ 128
-#define FUNC_MOV_FLOAT 129
-#define FUNC_NEG_FLOAT 130
-#define FUNC_ADD_FLOAT 131
-#define FUNC_SUB_FLOAT 132
-#define FUNC_MUL_FLOAT 133
-#define FUNC_DIV_FLOAT 134
-#define FUNC_GT_FLOAT 135
-#define FUNC_LT_FLOAT 136
-#define FUNC_EGT_FLOAT 137
-#define FUNC_ELT_FLOAT 138
-#define FUNC_EQUAL_FLOAT 139
-#define FUNC_NEQ_FLOAT 140
-#define FUNC_CONVERT_FLOAT 141
-#define FUNC_CAST_SCALAR 142
-#define FUNC_ADD_TYPED 143
-#define FUNC_SUB_TYPED 144
-#define FUNC_MUL_TYPED 145
-#define FUNC_DIV_TYPED 146
-#define FUNC_MOD_TYPED 147
-#define FUNC_BITWISE_AND_TYPED 148
-#define FUNC_BITWISE_OR_TYPED 149
-#define FUNC_BITWISE_XOR_TYPED 150
-#define FUNC_SHIFT_LEFT_TYPED 151
-#define FUNC_SHIFT_RIGHT_TYPED 152
-#define FUNC_GT_TYPED 153
-#define FUNC_LT_TYPED 154
-#define FUNC_EGT_TYPED 155
-#define FUNC_ELT_TYPED 156
-#define FUNC_EQUAL_TYPED 157
-#define FUNC_NEQ_TYPED 158
-#define FUNC_NEG_TYPED 159
-#define FUNC_BITWISE_NOT_TYPED 160
-#define FUNC_LOGICAL_NOT_TYPED 161
-#define FUNC_POINTER_DIFF 162
+#define FUNC_AGG_COUNT 46
+#define FUNC_PRINTF 47
+#define FUNC_PAUSE 48
+#define FUNC_FLUSH 49
+#define FUNC_EVENT_TRACE_STEP 50
+#define FUNC_EVENT_TRACE_STEP_IN 51
+#define FUNC_EVENT_TRACE_STEP_OUT 52
+#define FUNC_EVENT_TRACE_INSTRUMENTATION_STEP 53
+#define FUNC_EVENT_TRACE_INSTRUMENTATION_STEP_IN 54
+#define FUNC_RDTSC 55
+#define FUNC_RDTSCP 56
+#define FUNC_LBR_SAVE 57
+#define FUNC_LBR_DUMP 58
+#define FUNC_LBR_PRINT 59
+#define FUNC_LBR_RESTORE 60
+#define FUNC_LBR_CHECK 61
+#define FUNC_SPINLOCK_LOCK_CUSTOM_WAIT 62
+#define FUNC_EVENT_INJECT 63
+#define FUNC_AGG_SUM 64
+#define FUNC_AGG_MIN 65
+#define FUNC_AGG_MAX 66
+#define FUNC_AGG_HIST 67
+#define FUNC_POI 68
+#define FUNC_DB 69
+#define FUNC_DD 70
+#define FUNC_DW 71
+#define FUNC_DQ 72
+#define FUNC_NEG 73
+#define FUNC_HI 74
+#define FUNC_LOW 75
+#define FUNC_NOT 76
+#define FUNC_CHECK_ADDRESS 77
+#define FUNC_DISASSEMBLE_LEN 78
+#define FUNC_DISASSEMBLE_LEN32 79
+#define FUNC_DISASSEMBLE_LEN64 80
+#define FUNC_INTERLOCKED_INCREMENT 81
+#define FUNC_INTERLOCKED_DECREMENT 82
+#define FUNC_PHYSICAL_TO_VIRTUAL 83
+#define FUNC_VIRTUAL_TO_PHYSICAL 84
+#define FUNC_POI_PA 85
+#define FUNC_HI_PA 86
+#define FUNC_LOW_PA 87
+#define FUNC_DB_PA 88
+#define FUNC_DD_PA 89
+#define FUNC_DW_PA 90
+#define FUNC_DQ_PA 91
+#define FUNC_LBR_RESTORE_BY_FILTER 92
+#define FUNC_ED 93
+#define FUNC_EB 94
+#define FUNC_EQ 95
+#define FUNC_INTERLOCKED_EXCHANGE 96
+#define FUNC_INTERLOCKED_EXCHANGE_ADD 97
+#define FUNC_EB_PA 98
+#define FUNC_ED_PA 99
+#define FUNC_EQ_PA 100
+#define FUNC_INTERLOCKED_COMPARE_EXCHANGE 101
+#define FUNC_STRLEN 102
+#define FUNC_STRCMP 103
+#define FUNC_MEMCMP 104
+#define FUNC_STRNCMP 105
+#define FUNC_WCSLEN 106
+#define FUNC_WCSCMP 107
+#define FUNC_EVENT_INJECT_ERROR_CODE 108
+#define FUNC_MEMCPY 109
+#define FUNC_MEMCPY_PA 110
+#define FUNC_WCSNCMP 111
+#define FUNC_STRUCT_FORWARD_DECLARATION 112
+#define FUNC_STRUCT_DEFINITION_BEGIN 113
+#define FUNC_STRUCT_DEFINITION_END 114
+#define FUNC_STRUCT_VARIABLE_DECLARATION 115
+#define FUNC_STRUCT_MEMBER_DECLARATION 116
+#define FUNC_TYPEDEF_DECLARATION 117
+#define FUNC_STRUCT_POINTER 118
+#define FUNC_STRUCT_ARRAY_DIMENSION 119
+#define FUNC_STRUCT_DECLARATOR_COMPLETE 120
+#define FUNC_TYPED_LOAD 121
+#define FUNC_TYPED_STORE 122
+#define FUNC_AGGREGATE_COPY 123
+#define FUNC_AGGREGATE_ZERO 124
+#define FUNC_STRUCT_INITIALIZER_BEGIN 125
+#define FUNC_STRUCT_INITIALIZER_END 126
+#define FUNC_STRUCT_POINTER_CAST 127
+#define FUNC_MEMBER_ADDRESS 128
+#define FUNC_MEMBER_READ 129
+#define FUNC_MEMBER_DOT_LVALUE 130
+#define FUNC_MEMBER_ARROW_LVALUE 131
+#define FUNC_MEMBER_DOT_READ 132
+#define FUNC_MEMBER_ARROW_READ 133
+#define FUNC_MOV_FLOAT 134
+#define FUNC_NEG_FLOAT 135
+#define FUNC_ADD_FLOAT 136
+#define FUNC_SUB_FLOAT 137
+#define FUNC_MUL_FLOAT 138
+#define FUNC_DIV_FLOAT 139
+#define FUNC_GT_FLOAT 140
+#define FUNC_LT_FLOAT 141
+#define FUNC_EGT_FLOAT 142
+#define FUNC_ELT_FLOAT 143
+#define FUNC_EQUAL_FLOAT 144
+#define FUNC_NEQ_FLOAT 145
+#define FUNC_CONVERT_FLOAT 146
+#define FUNC_CAST_SCALAR 147
+#define FUNC_ADD_TYPED 148
+#define FUNC_SUB_TYPED 149
+#define FUNC_MUL_TYPED 150
+#define FUNC_DIV_TYPED 151
+#define FUNC_MOD_TYPED 152
+#define FUNC_BITWISE_AND_TYPED 153
+#define FUNC_BITWISE_OR_TYPED 154
+#define FUNC_BITWISE_XOR_TYPED 155
+#define FUNC_SHIFT_LEFT_TYPED 156
+#define FUNC_SHIFT_RIGHT_TYPED 157
+#define FUNC_GT_TYPED 158
+#define FUNC_LT_TYPED 159
+#define FUNC_EGT_TYPED 160
+#define FUNC_ELT_TYPED 161
+#define FUNC_EQUAL_TYPED 162
+#define FUNC_NEQ_TYPED 163
+#define FUNC_NEG_TYPED 164
+#define FUNC_BITWISE_NOT_TYPED 165
+#define FUNC_LOGICAL_NOT_TYPED 166
+#define FUNC_POINTER_DIFF 167
+#define FUNC_EMIT 168
 
 static const char *const FunctionNames[] = {
 "FUNC_UNDEFINED",
@@ -327,6 +433,7 @@ static const char *const FunctionNames[] = {
 "FUNC_SPINLOCK_UNLOCK",
 "FUNC_EVENT_SC",
 "FUNC_MICROSLEEP",
+"FUNC_AGG_COUNT",
 "FUNC_PRINTF",
 "FUNC_PAUSE",
 "FUNC_FLUSH",
@@ -344,6 +451,10 @@ static const char *const FunctionNames[] = {
 "FUNC_LBR_CHECK",
 "FUNC_SPINLOCK_LOCK_CUSTOM_WAIT",
 "FUNC_EVENT_INJECT",
+"FUNC_AGG_SUM",
+"FUNC_AGG_MIN",
+"FUNC_AGG_MAX",
+"FUNC_AGG_HIST",
 "FUNC_POI",
 "FUNC_DB",
 "FUNC_DD",
@@ -444,6 +555,7 @@ static const char *const FunctionNames[] = {
 "FUNC_BITWISE_NOT_TYPED",
 "FUNC_LOGICAL_NOT_TYPED",
 "FUNC_POINTER_DIFF",
+"FUNC_EMIT",
 };
 
 typedef enum REGS_ENUM {
@@ -670,6 +670,14 @@ MemoryMapperReadMemorySafeOnTargetProcess(_In_ UINT64   VaAddressToRead,
                                           _Inout_ PVOID BufferToSaveMemory,
                                           _In_ SIZE_T   SizeToRead);
 
+IMPORT_EXPORT_VMM BOOLEAN
+MemoryMapperReadMemorySafeOnTargetProcessCached(_In_ UINT64   VaAddressToRead,
+                                                _Inout_ PVOID BufferToSaveMemory,
+                                                _In_ SIZE_T   SizeToRead);
+
+IMPORT_EXPORT_VMM VOID
+MemoryMapperInvalidateTranslationCache();
+
 IMPORT_EXPORT_VMM BOOLEAN
 MemoryMapperReadMemorySafeFromVmxNonRootByPhysicalAddress(_In_ UINT64   PaAddressToRead,
                                                           _Inout_ PVOID BufferToSaveMemory,
@@ -707,6 +715,15 @@ MemoryMapperWriteMemorySafeOnTargetProcess(_Inout_ UINT64 Destination,
                                            _In_ PVOID     Source,
                                            _In_ SIZE_T    Size);
 
+IMPORT_EXPORT_VMM BOOLEAN
+MemoryMapperCopyMemorySafeOnTargetProcess(_In_ UINT64 Destination,
+                                          _In_ UINT64 Source,
+                                          _In_ SIZE_T Size);
+
+IMPORT_EXPORT_VMM BOOLEAN
+MemoryMapperZeroMemorySafeOnTargetProcess(_In_ UINT64 Destination,
+                                          _In_ SIZE_T Size);
+
 IMPORT_EXPORT_VMM BOOLEAN
 MemoryMapperWriteMemorySafeByPhysicalAddress(_Inout_ UINT64 DestinationPa,
                                              _In_ UINT64    Source,
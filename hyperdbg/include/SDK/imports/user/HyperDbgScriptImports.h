@@ -71,9 +71,42 @@ HardwareScriptInterpreterFreeHwdbgShortSymbolBuffer(HWDBG_SHORT_SYMBOL * NewShor
 IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE PVOID
 ScriptEngineParse(CHAR * Str);
 
+IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE PVOID
+ScriptEngineCreateCompilerContext(VOID);
+
+IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE VOID
+ScriptEngineFreeCompilerContext(PVOID CompilerContext);
+
+IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE PVOID
+ScriptEngineParseEx(PVOID CompilerContext, CHAR * Str);
+
+IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE BOOLEAN
+ScriptEngineParseBatch(CHAR ** Scripts, PVOID * Results, UINT32 NumberOfScripts, UINT32 NumberOfThreads);
+
 IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE BOOLEAN
 ScriptEngineSetHwdbgInstanceInfo(HWDBG_INSTANCE_INFORMATION * InstancInfo);
 
+IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE VOID
+ScriptEngineSetOptimizationLevel(UINT32 Level);
+
+IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE UINT32
+ScriptEngineGetOptimizationLevel();
+
+IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE BOOLEAN
+ScriptEngineGetPercpuVariableIndex(const CHAR * VariableName, UINT32 * Index);
+
+IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE UINT32
+ScriptEngineEncodeCompactBuffer(PVOID SymbolBuffer, PVOID CompactBuffer, UINT32 CompactBufferSize);
+
+IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE UINT32
+ScriptEngineExpandCompactBuffer(PVOID CompactBuffer, UINT32 CompactBufferSize, PVOID Symbols, UINT32 SymbolsSize);
+
+IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE UINT32
+ScriptEngineAccumulateProfileByLine(PVOID                                SymbolBuffer,
+                                    const SCRIPT_ENGINE_PROFILE_ENTRY * Profile,
+                                    PSCRIPT_ENGINE_PROFILE_ENTRY         LinesProfile,
+                                    UINT32                               NumberOfLines);
+
 IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE VOID
 PrintSymbolBuffer(const PVOID SymbolBuffer);
 
@@ -0,0 +1,397 @@
+/**
+ * @file CompactBytecode.c
+ * @author M.H. Gholamrezaei (mh@hyperdbg.org)
+ * @brief Compact (variable-length) encoding of the script buffers
+ * @details The debugger encodes the script buffers before sending them to
+ * the debuggee and the debuggee expands them back to the SYMBOL arrays that
+ * the script engine evaluates, so the decoder should never trust its input
+ * @version 0.19
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Write an unsigned LEB128 varint
+ *
+ * @param Buffer
+ * @param BufferSize
+ * @param Offset
+ * @param Value
+ *
+ * @return BOOLEAN FALSE if the buffer is not big enough
+ */
+BOOLEAN
+CompactBytecodeWriteVarint(UINT8 * Buffer, UINT32 BufferSize, UINT32 * Offset, UINT64 Value)
+{
+    do
+    {
+        if (*Offset >= BufferSize)
+        {
+            return FALSE;
+        }
+
+        Buffer[(*Offset)++] = (UINT8)((Value & 0x7f) | (Value > 0x7f ? 0x80 : 0));
+        Value >>= 7;
+
+    } while (Value != 0);
+
+    return TRUE;
+}
+
+/**
+ * @brief Read an unsigned LEB128 varint
+ *
+ * @param Buffer
+ * @param BufferSize
+ * @param Offset
+ * @param Value
+ *
+ * @return BOOLEAN FALSE if the varint is truncated or longer than 64 bits
+ */
+BOOLEAN
+CompactBytecodeReadVarint(const UINT8 * Buffer, UINT32 BufferSize, UINT32 * Offset, UINT64 * Value)
+{
+    UINT64 Result = 0;
+    UINT32 Shift  = 0;
+    UINT8  Byte;
+
+    do
+    {
+        if (*Offset >= BufferSize || Shift >= 64)
+        {
+            return FALSE;
+        }
+
+        Byte = Buffer[(*Offset)++];
+        Result |= (UINT64)(Byte & 0x7f) << Shift;
+        Shift += 7;
+
+    } while (Byte & 0x80);
+
+    *Value = Result;
+
+    return TRUE;
+}
+
+/**
+ * @brief Encode a buffer of symbols in the compact format
+ *
+ * @param Symbols
+ * @param SymbolCount
+ * @param Buffer
+ * @param BufferSize SCRIPT_COMPACT_BUFFER_MAXIMUM_SIZE(SymbolCount) is always enough
+ * @param EncodedSize
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CompactBytecodeEncode(const SYMBOL * Symbols,
+                      UINT32         SymbolCount,
+                      PVOID          Buffer,
+                      UINT32         BufferSize,
+                      UINT32 *       EncodedSize)
+{
+    PSCRIPT_COMPACT_BUFFER_HEADER Header = (PSCRIPT_COMPACT_BUFFER_HEADER)Buffer;
+    UINT8 *                       Output = (UINT8 *)Buffer;
+    UINT32                        Offset = sizeof(SCRIPT_COMPACT_BUFFER_HEADER);
+    UINT32                        Index  = 0;
+
+    if (BufferSize < sizeof(SCRIPT_COMPACT_BUFFER_HEADER))
+    {
+        return FALSE;
+    }
+
+    Header->Magic       = SCRIPT_COMPACT_BUFFER_MAGIC;
+    Header->Version     = SCRIPT_COMPACT_BUFFER_VERSION;
+    Header->SymbolCount = SymbolCount;
+
+    while (Index < SymbolCount)
+    {
+        const SYMBOL * Symbol    = &Symbols[Index];
+        UINT8          Tag       = 0;
+        UINT32         TagOffset = Offset++;
+
+        if (TagOffset >= BufferSize)
+        {
+            return FALSE;
+        }
+
+        if (Symbol->Type < SCRIPT_COMPACT_TAG_TYPE_ESCAPE)
+        {
+            Tag = (UINT8)Symbol->Type;
+        }
+        else
+        {
+            Tag = SCRIPT_COMPACT_TAG_TYPE_ESCAPE;
+
+            if (!CompactBytecodeWriteVarint(Output, BufferSize, &Offset, Symbol->Type))
+            {
+                return FALSE;
+            }
+        }
+
+        if (Symbol->Type == SYMBOL_STRING_TYPE || Symbol->Type == SYMBOL_WSTRING_TYPE)
+        {
+            //
+            // The characters start from the value and continue in the next symbols
+            //
+            UINT32 HeapSize = (UINT32)((SIZE_SYMBOL_WITHOUT_LEN + Symbol->Len) / sizeof(SYMBOL) + 1);
+
+            if (HeapSize > SymbolCount - Index)
+            {
+                return FALSE;
+            }
+
+            Tag |= SCRIPT_COMPACT_TAG_HAS_LEN;
+
+            if (!CompactBytecodeWriteVarint(Output, BufferSize, &Offset, Symbol->Len) ||
+                Symbol->Len > BufferSize - Offset)
+            {
+                return FALSE;
+            }
+
+            memcpy(&Output[Offset], &Symbol->Value, (SIZE_T)Symbol->Len);
+            Offset += (UINT32)Symbol->Len;
+
+            Output[TagOffset] = Tag;
+            Index += HeapSize;
+            continue;
+        }
+
+        if (Symbol->Len != 0)
+        {
+            Tag |= SCRIPT_COMPACT_TAG_HAS_LEN;
+
+            if (!CompactBytecodeWriteVarint(Output, BufferSize, &Offset, Symbol->Len))
+            {
+                return FALSE;
+            }
+        }
+
+        if (Symbol->Value == 0)
+        {
+            Tag |= SCRIPT_COMPACT_VALUE_ZERO << SCRIPT_COMPACT_TAG_VALUE_SHIFT;
+        }
+        else if (Symbol->Value < (1ull << 49))
+        {
+            Tag |= SCRIPT_COMPACT_VALUE_VARINT << SCRIPT_COMPACT_TAG_VALUE_SHIFT;
+
+            if (!CompactBytecodeWriteVarint(Output, BufferSize, &Offset, Symbol->Value))
+            {
+                return FALSE;
+            }
+        }
+        else if (~Symbol->Value < (1ull << 49))
+        {
+            Tag |= SCRIPT_COMPACT_VALUE_INVERTED_VARINT << SCRIPT_COMPACT_TAG_VALUE_SHIFT;
+
+            if (!CompactBytecodeWriteVarint(Output, BufferSize, &Offset, ~Symbol->Value))
+            {
+                return FALSE;
+            }
+        }
+        else
+        {
+            //
+            // Addresses and floating-point numbers are shorter in their raw form
+            //
+            Tag |= SCRIPT_COMPACT_VALUE_RAW << SCRIPT_COMPACT_TAG_VALUE_SHIFT;
+
+            if (sizeof(UINT64) > BufferSize - Offset)
+            {
+                return FALSE;
+            }
+
+            memcpy(&Output[Offset], &Symbol->Value, sizeof(UINT64));
+            Offset += sizeof(UINT64);
+        }
+
+        Output[TagOffset] = Tag;
+        Index++;
+    }
+
+    *EncodedSize = Offset;
+
+    return TRUE;
+}
+
+/**
+ * @brief Check whether a script buffer is in the compact format
+ *
+ * @param Buffer
+ * @param BufferSize
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CompactBytecodeIsCompactBuffer(const VOID * Buffer, UINT32 BufferSize)
+{
+    if (BufferSize < sizeof(SCRIPT_COMPACT_BUFFER_HEADER))
+    {
+        return FALSE;
+    }
+
+    return ((const SCRIPT_COMPACT_BUFFER_HEADER *)Buffer)->Magic == SCRIPT_COMPACT_BUFFER_MAGIC;
+}
+
+/**
+ * @brief Get the size of a script buffer (compact or not) once it's expanded
+ *
+ * @param Buffer
+ * @param BufferSize
+ *
+ * @return UINT32 zero if the header of the compact buffer is not valid
+ */
+UINT32
+CompactBytecodeGetExpandedSize(const VOID * Buffer, UINT32 BufferSize)
+{
+    const SCRIPT_COMPACT_BUFFER_HEADER * Header = (const SCRIPT_COMPACT_BUFFER_HEADER *)Buffer;
+
+    if (!CompactBytecodeIsCompactBuffer(Buffer, BufferSize))
+    {
+        return BufferSize;
+    }
+
+    if (Header->Version != SCRIPT_COMPACT_BUFFER_VERSION ||
+        Header->SymbolCount == 0 ||
+        Header->SymbolCount > 0xffffffff / sizeof(SYMBOL))
+    {
+        return 0;
+    }
+
+    return (UINT32)(Header->SymbolCount * sizeof(SYMBOL));
+}
+
+/**
+ * @brief Expand a script buffer (compact or not) to an array of symbols
+ *
+ * @param Buffer
+ * @param BufferSize
+ * @param Symbols
+ * @param SymbolsSize should be at least CompactBytecodeGetExpandedSize
+ *
+ * @return BOOLEAN FALSE if the buffer is malformed
+ */
+BOOLEAN
+CompactBytecodeExpand(const VOID * Buffer, UINT32 BufferSize, PSYMBOL Symbols, UINT32 SymbolsSize)
+{
+    const UINT8 * Input        = (const UINT8 *)Buffer;
+    UINT32        ExpandedSize = CompactBytecodeGetExpandedSize(Buffer, BufferSize);
+    UINT32        SymbolCount;
+    UINT32        Offset = sizeof(SCRIPT_COMPACT_BUFFER_HEADER);
+    UINT32        Index  = 0;
+
+    if (ExpandedSize == 0 || ExpandedSize > SymbolsSize)
+    {
+        return FALSE;
+    }
+
+    if (!CompactBytecodeIsCompactBuffer(Buffer, BufferSize))
+    {
+        //
+        // Plain buffers are used as they are
+        //
+        memcpy(Symbols, Buffer, BufferSize);
+        return TRUE;
+    }
+
+    SymbolCount = ExpandedSize / sizeof(SYMBOL);
+
+    while (Index < SymbolCount)
+    {
+        PSYMBOL Symbol = &Symbols[Index];
+        UINT8   Tag;
+        UINT64  Operand;
+
+        if (Offset >= BufferSize)
+        {
+            return FALSE;
+        }
+
+        Tag = Input[Offset++];
+
+        Symbol->Type  = Tag & SCRIPT_COMPACT_TAG_TYPE_MASK;
+        Symbol->Len   = 0;
+        Symbol->Value = 0;
+
+        if (Symbol->Type == SCRIPT_COMPACT_TAG_TYPE_ESCAPE &&
+            !CompactBytecodeReadVarint(Input, BufferSize, &Offset, &Symbol->Type))
+        {
+            return FALSE;
+        }
+
+        if ((Tag & SCRIPT_COMPACT_TAG_HAS_LEN) &&
+            !CompactBytecodeReadVarint(Input, BufferSize, &Offset, &Symbol->Len))
+        {
+            return FALSE;
+        }
+
+        if (Symbol->Type == SYMBOL_STRING_TYPE || Symbol->Type == SYMBOL_WSTRING_TYPE)
+        {
+            UINT64 HeapSize = (SIZE_SYMBOL_WITHOUT_LEN + Symbol->Len) / sizeof(SYMBOL) + 1;
+
+            if (Symbol->Len > BufferSize - Offset || HeapSize > SymbolCount - Index)
+            {
+                return FALSE;
+            }
+
+            //
+            // The rest of the symbols of the string are zeroed, so the string is
+            // always null-terminated
+            //
+            memset(&Symbol->Value, 0, (SIZE_T)HeapSize * sizeof(SYMBOL) - SIZE_SYMBOL_WITHOUT_LEN);
+            memcpy(&Symbol->Value, &Input[Offset], (SIZE_T)Symbol->Len);
+            Offset += (UINT32)Symbol->Len;
+
+            Index += (UINT32)HeapSize;
+            continue;
+        }
+
+        switch (Tag >> SCRIPT_COMPACT_TAG_VALUE_SHIFT)
+        {
+        case SCRIPT_COMPACT_VALUE_ZERO:
+            break;
+
+        case SCRIPT_COMPACT_VALUE_VARINT:
+
+            if (!CompactBytecodeReadVarint(Input, BufferSize, &Offset, &Operand))
+            {
+                return FALSE;
+            }
+
+            Symbol->Value = Operand;
+            break;
+
+        case SCRIPT_COMPACT_VALUE_INVERTED_VARINT:
+
+            if (!CompactBytecodeReadVarint(Input, BufferSize, &Offset, &Operand))
+            {
+                return FALSE;
+            }
+
+            Symbol->Value = ~Operand;
+            break;
+
+        default:
+
+            if (sizeof(UINT64) > BufferSize - Offset)
+            {
+                return FALSE;
+            }
+
+            memcpy(&Symbol->Value, &Input[Offset], sizeof(UINT64));
+            Offset += sizeof(UINT64);
+            break;
+        }
+
+        Index++;
+    }
+
+    //
+    // Trailing bytes mean that the buffer is corrupted
+    //
+    return Offset == BufferSize;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file CompactBytecode.h
+ * @author M.H. Gholamrezaei (mh@hyperdbg.org)
+ * @brief The header file for the compact encoding of the script buffers
+ * @details
+ * @version 0.19
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+CompactBytecodeWriteVarint(UINT8 * Buffer, UINT32 BufferSize, UINT32 * Offset, UINT64 Value);
+
+BOOLEAN
+CompactBytecodeReadVarint(const UINT8 * Buffer, UINT32 BufferSize, UINT32 * Offset, UINT64 * Value);
+
+BOOLEAN
+CompactBytecodeEncode(const SYMBOL * Symbols,
+                      UINT32         SymbolCount,
+                      PVOID          Buffer,
+                      UINT32         BufferSize,
+                      UINT32 *       EncodedSize);
+
+BOOLEAN
+CompactBytecodeIsCompactBuffer(const VOID * Buffer, UINT32 BufferSize);
+
+UINT32
+CompactBytecodeGetExpandedSize(const VOID * Buffer, UINT32 BufferSize);
+
+BOOLEAN
+CompactBytecodeExpand(const VOID * Buffer, UINT32 BufferSize, PSYMBOL Symbols, UINT32 SymbolsSize);
@@ -23,6 +23,8 @@
 #    include <signal.h>
 #    include <dlfcn.h>
 #    include <time.h> // clock_gettime / CLOCK_MONOTONIC (PlatformQueryPerformanceCounter)
+#    include <pthread.h>
+#    include <sys/mman.h>
 #endif // defined(__linux__)
 
 /**
@@ -687,6 +689,99 @@ PlatformTerminateThread(HANDLE Thread, DWORD ExitCode)
 #endif
 }
 
+#if defined(__linux__)
+
+/**
+ * @brief State of a joinable thread on Linux
+ */
+typedef struct _PLATFORM_JOINABLE_THREAD
+{
+    pthread_t               Thread;
+    PLATFORM_THREAD_ROUTINE Routine;
+    PVOID                   Param;
+} PLATFORM_JOINABLE_THREAD, *PPLATFORM_JOINABLE_THREAD;
+
+/**
+ * @brief Adapts the Win32 thread routine signature to the pthread one
+ *
+ * @param Param the joinable thread state
+ * @return void*
+ */
+static void *
+PlatformJoinableThreadStart(void * Param)
+{
+    PPLATFORM_JOINABLE_THREAD JoinableThread = (PPLATFORM_JOINABLE_THREAD)Param;
+
+    JoinableThread->Routine(JoinableThread->Param);
+
+    return NULL;
+}
+
+#endif // defined(__linux__)
+
+/**
+ * @brief Creates a thread that is waited for by PlatformJoinThread
+ *
+ * @param Routine thread entry point
+ * @param Param   parameter passed to the thread routine
+ * @return HANDLE to the new thread, or NULL on failure
+ */
+HANDLE
+PlatformCreateJoinableThread(PLATFORM_THREAD_ROUTINE Routine, PVOID Param)
+{
+#if defined(_WIN32)
+    return CreateThread(NULL, 0, Routine, Param, 0, NULL);
+#elif defined(__linux__)
+    PPLATFORM_JOINABLE_THREAD JoinableThread = (PPLATFORM_JOINABLE_THREAD)malloc(sizeof(PLATFORM_JOINABLE_THREAD));
+
+    if (JoinableThread == NULL)
+    {
+        return NULL;
+    }
+
+    JoinableThread->Routine = Routine;
+    JoinableThread->Param   = Param;
+
+    if (pthread_create(&JoinableThread->Thread, NULL, PlatformJoinableThreadStart, JoinableThread) != 0)
+    {
+        free(JoinableThread);
+        return NULL;
+    }
+
+    return (HANDLE)JoinableThread;
+#else
+#    error "Unsupported platform"
+#endif
+}
+
+/**
+ * @brief Waits for a thread created by PlatformCreateJoinableThread and
+ * releases its handle
+ *
+ * @param Thread handle to the thread
+ * @return BOOLEAN TRUE on success
+ */
+BOOLEAN
+PlatformJoinThread(HANDLE Thread)
+{
+#if defined(_WIN32)
+    BOOLEAN Result = WaitForSingleObject(Thread, INFINITE) == WAIT_OBJECT_0;
+
+    CloseHandle(Thread);
+
+    return Result;
+#elif defined(__linux__)
+    PPLATFORM_JOINABLE_THREAD JoinableThread = (PPLATFORM_JOINABLE_THREAD)Thread;
+    BOOLEAN                   Result         = pthread_join(JoinableThread->Thread, NULL) == 0;
+
+    free(JoinableThread);
+
+    return Result;
+#else
+#    error "Unsupported platform"
+#endif
+}
+
 /**
  * @brief Platform independent wrapper for GetLastError
  */
@@ -1201,3 +1296,78 @@ PlatformFreeLibrary(HMODULE Module)
 #    error "Unsupported platform"
 #endif
 }
+
+/**
+ * @brief Platform independent wrapper for allocating the pages of the
+ * native code (read/write until PlatformProtectExecutableMemory is called)
+ *
+ * @param Size size of the code
+ * @return PVOID address of the pages, or NULL on failure
+ */
+PVOID
+PlatformAllocateExecutableMemory(SIZE_T Size)
+{
+#if defined(_WIN32)
+    return VirtualAlloc(NULL, Size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#elif defined(__linux__)
+    void * Address = mmap(NULL, Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    return Address == MAP_FAILED ? NULL : Address;
+#else
+#    error "Unsupported platform"
+#endif
+}
+
+/**
+ * @brief Platform independent wrapper for changing the pages of the native
+ * code to read/execute
+ *
+ * @param Address address returned by PlatformAllocateExecutableMemory
+ * @param Size size of the code
+ * @return BOOLEAN TRUE on success
+ */
+BOOLEAN
+PlatformProtectExecutableMemory(PVOID Address, SIZE_T Size)
+{
+#if defined(_WIN32)
+    DWORD OldProtect;
+
+    if (!VirtualProtect(Address, Size, PAGE_EXECUTE_READ, &OldProtect))
+    {
+        return FALSE;
+    }
+
+    //
+    // The instruction cache is coherent on x86, but it's what the
+    // documentation of VirtualProtect asks for
+    //
+    FlushInstructionCache(GetCurrentProcess(), Address, Size);
+
+    return TRUE;
+#elif defined(__linux__)
+    return mprotect(Address, Size, PROT_READ | PROT_EXEC) == 0;
+#else
+#    error "Unsupported platform"
+#endif
+}
+
+/**
+ * @brief Platform independent wrapper for freeing the pages of the native code
+ *
+ * @param Address address returned by PlatformAllocateExecutableMemory
+ * @param Size size of the code
+ * @return VOID
+ */
+VOID
+PlatformFreeExecutableMemory(PVOID Address, SIZE_T Size)
+{
+#if defined(_WIN32)
+    UNREFERENCED_PARAMETER(Size);
+
+    VirtualFree(Address, 0, MEM_RELEASE);
+#elif defined(__linux__)
+    munmap(Address, Size);
+#else
+#    error "Unsupported platform"
+#endif
+}
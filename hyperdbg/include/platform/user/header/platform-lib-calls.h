@@ -145,6 +145,19 @@ PlatformCreateThread(PLATFORM_THREAD_ROUTINE Routine, PVOID Param);
 BOOLEAN
 PlatformTerminateThread(HANDLE Thread, DWORD ExitCode);
 
+//
+// JOINABLE THREADS
+//
+// Unlike PlatformCreateThread, the thread is always started (pthread on
+// Linux) and the handle must be released by PlatformJoinThread, which waits
+// for the thread to return.
+//
+HANDLE
+PlatformCreateJoinableThread(PLATFORM_THREAD_ROUTINE Routine, PVOID Param);
+
+BOOLEAN
+PlatformJoinThread(HANDLE Thread);
+
 //
 // LAST OS ERROR
 //
@@ -273,3 +286,21 @@ PlatformGetProcAddress(HMODULE Module, const CHAR * ProcName);
 
 BOOL
 PlatformFreeLibrary(HMODULE Module);
+
+//
+// EXECUTABLE MEMORY
+//
+// Pages for the native code of the JIT of the script engine. The pages are
+// allocated as read/write, the code is copied into them and then they're
+// changed to read/execute (never writable and executable at the same time).
+// Windows = VirtualAlloc/VirtualProtect/VirtualFree; Linux = mmap/mprotect/
+// munmap.
+//
+PVOID
+PlatformAllocateExecutableMemory(SIZE_T Size);
+
+BOOLEAN
+PlatformProtectExecutableMemory(PVOID Address, SIZE_T Size);
+
+VOID
+PlatformFreeExecutableMemory(PVOID Address, SIZE_T Size);
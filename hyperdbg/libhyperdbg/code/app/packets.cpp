@@ -37,6 +37,7 @@ ReadIrpBasedBuffer()
     DWORD                  ErrorNum;
     HANDLE                 Handle;
     UINT32                 OperationCode;
+    CHAR                   DeferredMessage[PacketChunkSize];
 
     RegisterEvent.hEvent = NULL;
     RegisterEvent.Type   = IRP_BASED;
@@ -280,13 +281,47 @@ ReadIrpBasedBuffer()
                 break;
 
             default:
+            {
+                CHAR * Message       = OutputBuffer + sizeof(UINT32);
+                UINT32 MessageLength = ReturnedLength - sizeof(UINT32) - 1;
+
+                //
+                // The binary records of emit are sent to the output sources or
+                // to the file of the records
+                //
+                if (ScriptEngineWrapperConsumeEmitRecord(OperationCode,
+                                                         Message,
+                                                         ReturnedLength - sizeof(UINT32),
+                                                         DeferredMessage,
+                                                         sizeof(DeferredMessage)))
+                {
+                    if (DeferredMessage[0] != '\0' && !g_BreakPrintingOutput)
+                    {
+                        ShowMessages("%s", DeferredMessage);
+                    }
+
+                    break;
+                }
+
+                //
+                // The deferred messages of printf only contain the values,
+                // they're formatted here
+                //
+                if (ScriptEngineWrapperFormatDeferredMessage(Message,
+                                                             ReturnedLength - sizeof(UINT32),
+                                                             DeferredMessage,
+                                                             sizeof(DeferredMessage)))
+                {
+                    Message       = DeferredMessage;
+                    MessageLength = (UINT32)strlen(DeferredMessage);
+                }
 
                 //
                 // Check if there are available output sources
                 //
                 if (!g_OutputSourcesInitialized || !ForwardingCheckAndPerformEventForwarding(OperationCode,
-                                                                                             OutputBuffer + sizeof(UINT32),
-                                                                                             ReturnedLength - sizeof(UINT32) - 1))
+                                                                                             Message,
+                                                                                             MessageLength))
                 {
                     if (g_BreakPrintingOutput)
                     {
@@ -297,11 +332,12 @@ ReadIrpBasedBuffer()
                         continue;
                     }
 
-                    ShowMessages("%s", OutputBuffer + sizeof(UINT32));
+                    ShowMessages("%s", Message);
                 }
 
                 break;
             }
+            }
         }
     }
     catch (const std::exception &)
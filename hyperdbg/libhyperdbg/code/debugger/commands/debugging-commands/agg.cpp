@@ -0,0 +1,396 @@
+/**
+ * @file agg.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief agg command
+ * @details
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern BOOLEAN g_IsKdModuleLoaded;
+extern BOOLEAN g_IsSerialConnectedToRemoteDebuggee;
+
+/**
+ * @brief help of the agg command
+ *
+ * @return VOID
+ */
+VOID
+CommandAggHelp()
+{
+    ShowMessages("agg : shows or clears the aggregations that are collected by the "
+                 "agg_count, agg_sum, agg_min, agg_max, and agg_hist functions of the script engine.\n");
+    ShowMessages("Note : each core keeps its own aggregation table, the tables of all cores "
+                 "are merged when they are shown.\n\n");
+
+    ShowMessages("syntax : \tagg [show] [clear]\n");
+
+    ShowMessages("\n");
+    ShowMessages("\t\te.g : agg\n");
+    ShowMessages("\t\te.g : agg clear\n");
+    ShowMessages("\t\te.g : agg show clear\n");
+
+    ShowMessages("\n");
+    ShowMessages("script functions:\n");
+    ShowMessages("\tagg_count(key)       : counts the number of times that the key is seen\n");
+    ShowMessages("\tagg_sum(key, value)  : adds the value to the sum of the key\n");
+    ShowMessages("\tagg_min(key, value)  : keeps the minimum (signed) value of the key\n");
+    ShowMessages("\tagg_max(key, value)  : keeps the maximum (signed) value of the key\n");
+    ShowMessages("\tagg_hist(key, value) : adds the value to the power-of-two histogram of the key\n");
+
+    ShowMessages("\n");
+    ShowMessages("\t\te.g : !syscall script { agg_count($context); }\n");
+    ShowMessages("\t\te.g : !epthook nt!ExAllocatePoolWithTag script { agg_hist(@r8, @rdx); }\n");
+}
+
+/**
+ * @brief Send aggregation requests
+ *
+ * @param AggregationRequest
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CommandAggSendRequest(SCRIPT_ENGINE_AGGREGATION_PACKETS * AggregationRequest)
+{
+    BOOL  Status;
+    ULONG ReturnedLength;
+
+    if (g_IsSerialConnectedToRemoteDebuggee)
+    {
+        //
+        // Send the request over serial kernel debugger
+        //
+        if (!KdSendScriptEngineAggregationPacketsToDebuggee(AggregationRequest))
+        {
+            return FALSE;
+        }
+    }
+    else
+    {
+        AssertShowMessageReturnStmt(g_IsKdModuleLoaded, g_DeviceHandle, ASSERT_MESSAGE_KD_NOT_LOADED, ASSERT_MESSAGE_DRIVER_NOT_LOADED, AssertReturnFalse);
+
+        //
+        // Send IOCTL
+        //
+        Status = PlatformDeviceIoControl(
+            g_DeviceHandle,                           // Handle to device
+            IOCTL_QUERY_SCRIPT_ENGINE_AGGREGATIONS,   // IO Control Code (IOCTL)
+            AggregationRequest,                       // Input Buffer to driver.
+            SIZEOF_SCRIPT_ENGINE_AGGREGATION_PACKETS, // Input buffer length
+            AggregationRequest,                       // Output Buffer from driver.
+            SIZEOF_SCRIPT_ENGINE_AGGREGATION_PACKETS, // Length of output buffer in bytes.
+            &ReturnedLength,                          // Bytes placed in buffer.
+            NULL                                      // synchronous call
+        );
+
+        if (!Status)
+        {
+            ShowMessages("ioctl failed with code 0x%x\n", PlatformGetLastError());
+
+            return FALSE;
+        }
+    }
+
+    if (AggregationRequest->KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFUL)
+    {
+        ShowErrorMessage(AggregationRequest->KernelStatus);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Read the aggregation tables of all cores and merge them
+ *
+ * @param MergedEntries The merged entries, sorted by type, key, and bucket
+ * @param DroppedUpdates Number of updates that are dropped on all cores
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CommandAggQueryAndMerge(vector<SCRIPT_ENGINE_AGGREGATION_ENTRY> & MergedEntries, UINT64 * DroppedUpdates)
+{
+    SCRIPT_ENGINE_AGGREGATION_PACKETS                                             AggregationRequest = {};
+    std::map<std::tuple<UINT32, UINT64, UINT32>, SCRIPT_ENGINE_AGGREGATION_ENTRY> Merged;
+    UINT32                                                                        NumberOfCores = 1;
+
+    *DroppedUpdates = 0;
+
+    for (UINT32 CoreId = 0; CoreId < NumberOfCores; CoreId++)
+    {
+        AggregationRequest.StartIndex = 0;
+
+        //
+        // Each request returns the entries from StartIndex and the index
+        // to continue from, so the table is read in multiple rounds
+        //
+        do
+        {
+            AggregationRequest.RequestType = SCRIPT_ENGINE_AGGREGATION_REQUEST_TYPE_QUERY;
+            AggregationRequest.CoreId      = CoreId;
+
+            if (!CommandAggSendRequest(&AggregationRequest))
+            {
+                return FALSE;
+            }
+
+            NumberOfCores = AggregationRequest.NumberOfCores;
+
+            for (UINT32 i = 0; i < AggregationRequest.NumberOfEntries &&
+                               i < SCRIPT_ENGINE_AGGREGATION_MAXIMUM_ENTRIES_IN_PACKET;
+                 i++)
+            {
+                SCRIPT_ENGINE_AGGREGATION_ENTRY * Entry = &AggregationRequest.Entries[i];
+                auto                              Key   = std::make_tuple(Entry->Type, Entry->Key, Entry->Bucket);
+                auto                              It    = Merged.find(Key);
+
+                if (It == Merged.end())
+                {
+                    Merged[Key] = *Entry;
+                    continue;
+                }
+
+                It->second.Count += Entry->Count;
+
+                switch (Entry->Type)
+                {
+                case SCRIPT_ENGINE_AGGREGATION_TYPE_SUM:
+                    It->second.Value += Entry->Value;
+                    break;
+
+                case SCRIPT_ENGINE_AGGREGATION_TYPE_MIN:
+                    if ((INT64)Entry->Value < (INT64)It->second.Value)
+                    {
+                        It->second.Value = Entry->Value;
+                    }
+                    break;
+
+                case SCRIPT_ENGINE_AGGREGATION_TYPE_MAX:
+                    if ((INT64)Entry->Value > (INT64)It->second.Value)
+                    {
+                        It->second.Value = Entry->Value;
+                    }
+                    break;
+
+                default:
+                    break;
+                }
+            }
+
+            AggregationRequest.StartIndex = AggregationRequest.NextIndex;
+
+        } while (AggregationRequest.NextIndex < SCRIPT_ENGINE_AGGREGATION_TABLE_SIZE);
+
+        *DroppedUpdates += AggregationRequest.DroppedUpdates;
+    }
+
+    MergedEntries.clear();
+
+    for (auto & Item : Merged)
+    {
+        MergedEntries.push_back(Item.second);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Show the merged aggregations
+ *
+ * @param MergedEntries
+ * @param DroppedUpdates
+ *
+ * @return VOID
+ */
+VOID
+CommandAggShow(vector<SCRIPT_ENGINE_AGGREGATION_ENTRY> & MergedEntries, UINT64 DroppedUpdates)
+{
+    UINT32 LastType = SCRIPT_ENGINE_AGGREGATION_TYPE_EMPTY;
+    UINT64 LastKey  = 0;
+
+    if (MergedEntries.empty())
+    {
+        ShowMessages("no aggregation is collected\n");
+    }
+
+    for (size_t i = 0; i < MergedEntries.size(); i++)
+    {
+        SCRIPT_ENGINE_AGGREGATION_ENTRY & Entry     = MergedEntries[i];
+        BOOLEAN                           IsNewType = Entry.Type != LastType;
+
+        switch (Entry.Type)
+        {
+        case SCRIPT_ENGINE_AGGREGATION_TYPE_COUNT:
+
+            if (IsNewType)
+            {
+                ShowMessages("agg_count (key : count)\n");
+            }
+
+            ShowMessages("    %s : %llx\n", SeparateTo64BitValue(Entry.Key).c_str(), Entry.Count);
+
+            break;
+
+        case SCRIPT_ENGINE_AGGREGATION_TYPE_SUM:
+
+            if (IsNewType)
+            {
+                ShowMessages("agg_sum (key : sum, count)\n");
+            }
+
+            ShowMessages("    %s : %llx, %llx\n", SeparateTo64BitValue(Entry.Key).c_str(), Entry.Value, Entry.Count);
+
+            break;
+
+        case SCRIPT_ENGINE_AGGREGATION_TYPE_MIN:
+        case SCRIPT_ENGINE_AGGREGATION_TYPE_MAX:
+
+            if (IsNewType)
+            {
+                ShowMessages("%s (key : %s, count)\n",
+                             Entry.Type == SCRIPT_ENGINE_AGGREGATION_TYPE_MIN ? "agg_min" : "agg_max",
+                             Entry.Type == SCRIPT_ENGINE_AGGREGATION_TYPE_MIN ? "min" : "max");
+            }
+
+            ShowMessages("    %s : %llx, %llx\n", SeparateTo64BitValue(Entry.Key).c_str(), Entry.Value, Entry.Count);
+
+            break;
+
+        case SCRIPT_ENGINE_AGGREGATION_TYPE_HISTOGRAM:
+        {
+            UINT64 MaxCount = 0;
+            UINT64 Low;
+            UINT64 High;
+            UINT32 BarLength;
+
+            if (IsNewType)
+            {
+                ShowMessages("agg_hist (key : [range] count)\n");
+            }
+
+            if (IsNewType || Entry.Key != LastKey)
+            {
+                ShowMessages("    %s :\n", SeparateTo64BitValue(Entry.Key).c_str());
+            }
+
+            //
+            // Scale the bars based on the biggest bucket of this key
+            //
+            for (size_t j = i; j < MergedEntries.size() &&
+                               MergedEntries[j].Type == SCRIPT_ENGINE_AGGREGATION_TYPE_HISTOGRAM &&
+                               MergedEntries[j].Key == Entry.Key;
+                 j++)
+            {
+                if (MergedEntries[j].Count > MaxCount)
+                {
+                    MaxCount = MergedEntries[j].Count;
+                }
+            }
+
+            //
+            // Bucket 0 is the value zero, bucket n is [2^(n-1), 2^n)
+            //
+            Low       = Entry.Bucket == 0 ? 0 : 1ull << (Entry.Bucket - 1);
+            High      = Entry.Bucket == 0 ? 0 : (Entry.Bucket >= 64 ? ~0ull : (1ull << Entry.Bucket) - 1);
+            BarLength = MaxCount == 0 ? 0 : (UINT32)((Entry.Count * 40) / MaxCount);
+
+            ShowMessages("        [%016llx, %016llx] %8llx |%-40s|\n",
+                         Low,
+                         High,
+                         Entry.Count,
+                         std::string(BarLength, '@').c_str());
+
+            break;
+        }
+        default:
+            break;
+        }
+
+        LastType = Entry.Type;
+        LastKey  = Entry.Key;
+    }
+
+    if (DroppedUpdates != 0)
+    {
+        ShowMessages("warning, %llx update(s) are dropped as the aggregation tables are full\n",
+                     DroppedUpdates);
+    }
+}
+
+/**
+ * @brief agg command handler
+ *
+ * @param CommandTokens
+ * @param Command
+ *
+ * @return VOID
+ */
+VOID
+CommandAgg(vector<CommandToken> CommandTokens, string Command)
+{
+    SCRIPT_ENGINE_AGGREGATION_PACKETS       AggregationRequest = {};
+    vector<SCRIPT_ENGINE_AGGREGATION_ENTRY> MergedEntries;
+    UINT64                                  DroppedUpdates = 0;
+    BOOLEAN                                 Show           = FALSE;
+    BOOLEAN                                 Clear          = FALSE;
+
+    for (auto Section : CommandTokens)
+    {
+        if (CompareLowerCaseStrings(Section, "agg"))
+        {
+            continue;
+        }
+        else if (CompareLowerCaseStrings(Section, "show") && !Show)
+        {
+            Show = TRUE;
+        }
+        else if (CompareLowerCaseStrings(Section, "clear") && !Clear)
+        {
+            Clear = TRUE;
+        }
+        else
+        {
+            ShowMessages("incorrect use of the '%s'\n\n",
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+            CommandAggHelp();
+            return;
+        }
+    }
+
+    //
+    // Without any parameter, the aggregations are shown
+    //
+    if (!Show && !Clear)
+    {
+        Show = TRUE;
+    }
+
+    if (Show)
+    {
+        if (!CommandAggQueryAndMerge(MergedEntries, &DroppedUpdates))
+        {
+            return;
+        }
+
+        CommandAggShow(MergedEntries, DroppedUpdates);
+    }
+
+    if (Clear)
+    {
+        AggregationRequest.RequestType = SCRIPT_ENGINE_AGGREGATION_REQUEST_TYPE_CLEAR;
+
+        if (CommandAggSendRequest(&AggregationRequest))
+        {
+            ShowMessages("aggregations are cleared\n");
+        }
+    }
+}
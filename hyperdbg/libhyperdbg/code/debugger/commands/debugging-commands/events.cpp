@@ -24,6 +24,8 @@ extern BOOLEAN    g_IsSerialConnectedToRemoteDebuggee;
 extern BOOLEAN    g_IsSerialConnectedToRemoteDebugger;
 extern UINT64     g_EventTag;
 
+extern std::map<UINT64, std::string> g_ScriptSourcesOfEvents;
+
 /**
  * @brief help of the events command
  *
@@ -419,6 +421,11 @@ CommandEventClearEvent(UINT64 Tag)
 
             if (Tag != DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
             {
+                //
+                // The source of the script is not needed anymore
+                //
+                g_ScriptSourcesOfEvents.erase(Tag);
+
                 //
                 // Remove it from the list
                 //
@@ -457,6 +464,8 @@ CommandEventClearEvent(UINT64 Tag)
         // Reinitialize list head
         //
         InitializeListHead(&g_EventTrace);
+
+        g_ScriptSourcesOfEvents.clear();
     }
 
     //
@@ -0,0 +1,220 @@
+/**
+ * @file percpu.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief percpu command
+ * @details
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern BOOLEAN g_IsKdModuleLoaded;
+extern BOOLEAN g_IsSerialConnectedToRemoteDebuggee;
+
+/**
+ * @brief help of the percpu command
+ *
+ * @return VOID
+ */
+VOID
+CommandPercpuHelp()
+{
+    ShowMessages("percpu : shows or clears the values of a percpu variable of the script engine "
+                 "on all cores and reduces them to their sum.\n");
+    ShowMessages("Note : percpu variables are declared in scripts by using 'percpu .name;', each core "
+                 "updates its own copy of the variable without sharing a cache line with the other cores.\n\n");
+
+    ShowMessages("syntax : \tpercpu [Name (string)] [clear]\n");
+
+    ShowMessages("\n");
+    ShowMessages("\t\te.g : percpu .hits\n");
+    ShowMessages("\t\te.g : percpu .hits clear\n");
+
+    ShowMessages("\n");
+    ShowMessages("\t\te.g : !syscall script { percpu .hits; .hits++; }\n");
+}
+
+/**
+ * @brief Send percpu variable requests
+ *
+ * @param PercpuVariableRequest
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CommandPercpuSendRequest(SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS * PercpuVariableRequest)
+{
+    BOOL  Status;
+    ULONG ReturnedLength;
+
+    if (g_IsSerialConnectedToRemoteDebuggee)
+    {
+        //
+        // Send the request over serial kernel debugger
+        //
+        if (!KdSendScriptEnginePercpuVariablePacketsToDebuggee(PercpuVariableRequest))
+        {
+            return FALSE;
+        }
+    }
+    else
+    {
+        AssertShowMessageReturnStmt(g_IsKdModuleLoaded, g_DeviceHandle, ASSERT_MESSAGE_KD_NOT_LOADED, ASSERT_MESSAGE_DRIVER_NOT_LOADED, AssertReturnFalse);
+
+        //
+        // Send IOCTL
+        //
+        Status = PlatformDeviceIoControl(
+            g_DeviceHandle,                               // Handle to device
+            IOCTL_QUERY_SCRIPT_ENGINE_PERCPU_VARIABLE,    // IO Control Code (IOCTL)
+            PercpuVariableRequest,                        // Input Buffer to driver.
+            SIZEOF_SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS, // Input buffer length
+            PercpuVariableRequest,                        // Output Buffer from driver.
+            SIZEOF_SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS, // Length of output buffer in bytes.
+            &ReturnedLength,                              // Bytes placed in buffer.
+            NULL                                          // synchronous call
+        );
+
+        if (!Status)
+        {
+            ShowMessages("ioctl failed with code 0x%x\n", PlatformGetLastError());
+
+            return FALSE;
+        }
+    }
+
+    if (PercpuVariableRequest->KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFUL)
+    {
+        ShowErrorMessage(PercpuVariableRequest->KernelStatus);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Read the values of a percpu variable on all cores and show their sum
+ *
+ * @param VariableName
+ * @param VariableIndex
+ *
+ * @return VOID
+ */
+VOID
+CommandPercpuShow(const string & VariableName, UINT32 VariableIndex)
+{
+    SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS PercpuVariableRequest = {};
+    UINT32                                NumberOfCores         = 1;
+    UINT64                                Sum                   = 0;
+
+    for (UINT32 StartCore = 0; StartCore < NumberOfCores;)
+    {
+        PercpuVariableRequest.RequestType   = SCRIPT_ENGINE_PERCPU_VARIABLE_REQUEST_TYPE_QUERY;
+        PercpuVariableRequest.VariableIndex = VariableIndex;
+        PercpuVariableRequest.StartCore     = StartCore;
+
+        if (!CommandPercpuSendRequest(&PercpuVariableRequest))
+        {
+            return;
+        }
+
+        NumberOfCores = PercpuVariableRequest.NumberOfCores;
+
+        if (PercpuVariableRequest.NumberOfValues == 0 ||
+            PercpuVariableRequest.NumberOfValues > SCRIPT_ENGINE_PERCPU_VARIABLE_MAXIMUM_VALUES_IN_PACKET)
+        {
+            break;
+        }
+
+        for (UINT32 i = 0; i < PercpuVariableRequest.NumberOfValues; i++)
+        {
+            ShowMessages("    core %x : %s\n",
+                         StartCore + i,
+                         SeparateTo64BitValue(PercpuVariableRequest.Values[i]).c_str());
+
+            Sum += PercpuVariableRequest.Values[i];
+        }
+
+        StartCore += PercpuVariableRequest.NumberOfValues;
+    }
+
+    ShowMessages("%s (sum of %x cores) : %s\n",
+                 VariableName.c_str(),
+                 NumberOfCores,
+                 SeparateTo64BitValue(Sum).c_str());
+}
+
+/**
+ * @brief percpu command handler
+ *
+ * @param CommandTokens
+ * @param Command
+ *
+ * @return VOID
+ */
+VOID
+CommandPercpu(vector<CommandToken> CommandTokens, string Command)
+{
+    SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS PercpuVariableRequest = {};
+    string                                VariableName;
+    UINT32                                VariableIndex = 0;
+    BOOLEAN                               Clear         = FALSE;
+
+    if (CommandTokens.size() != 2 && CommandTokens.size() != 3)
+    {
+        ShowMessages("incorrect use of the '%s'\n\n",
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+        CommandPercpuHelp();
+        return;
+    }
+
+    if (CommandTokens.size() == 3)
+    {
+        if (!CompareLowerCaseStrings(CommandTokens.at(2), "clear"))
+        {
+            ShowMessages("incorrect use of the '%s'\n\n",
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+            CommandPercpuHelp();
+            return;
+        }
+
+        Clear = TRUE;
+    }
+
+    //
+    // Global variables of the script engine are named with a leading dot
+    //
+    VariableName = GetCaseSensitiveStringFromCommandToken(CommandTokens.at(1));
+
+    if (VariableName.empty() || VariableName[0] != '.')
+    {
+        VariableName = "." + VariableName;
+    }
+
+    if (!ScriptEngineGetPercpuVariableIndex(VariableName.c_str(), &VariableIndex))
+    {
+        ShowMessages("err, '%s' is not declared as a percpu variable\n", VariableName.c_str());
+        return;
+    }
+
+    if (Clear)
+    {
+        PercpuVariableRequest.RequestType   = SCRIPT_ENGINE_PERCPU_VARIABLE_REQUEST_TYPE_CLEAR;
+        PercpuVariableRequest.VariableIndex = VariableIndex;
+
+        if (CommandPercpuSendRequest(&PercpuVariableRequest))
+        {
+            ShowMessages("percpu variable '%s' is cleared on all cores\n", VariableName.c_str());
+        }
+    }
+    else
+    {
+        CommandPercpuShow(VariableName, VariableIndex);
+    }
+}
@@ -0,0 +1,400 @@
+/**
+ * @file profile.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief profile command
+ * @details
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern BOOLEAN g_IsKdModuleLoaded;
+extern BOOLEAN g_IsSerialConnectedToRemoteDebuggee;
+
+extern std::map<UINT64, std::string> g_ScriptSourcesOfEvents;
+
+/**
+ * @brief help of the profile command
+ *
+ * @return VOID
+ */
+VOID
+CommandProfileHelp()
+{
+    ShowMessages("profile : enables, disables, shows or clears the profile of the scripts of the events.\n");
+    ShowMessages("Note : while the profiling is enabled, the scripts are interpreted and each operator is "
+                 "measured by the time-stamp counter, the measured cycles include the overhead of the measurement.\n\n");
+
+    ShowMessages("syntax : \tprofile [enable|disable]\n");
+    ShowMessages("syntax : \tprofile [EventNumber (hex)] [clear]\n");
+
+    ShowMessages("\n");
+    ShowMessages("\t\te.g : profile enable\n");
+    ShowMessages("\t\te.g : profile 0\n");
+    ShowMessages("\t\te.g : profile 0 clear\n");
+    ShowMessages("\t\te.g : profile disable\n");
+}
+
+/**
+ * @brief Send profile requests
+ *
+ * @param ProfileRequest
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CommandProfileSendRequest(SCRIPT_ENGINE_PROFILE_PACKETS * ProfileRequest)
+{
+    BOOL  Status;
+    ULONG ReturnedLength;
+
+    if (g_IsSerialConnectedToRemoteDebuggee)
+    {
+        //
+        // Send the request over serial kernel debugger
+        //
+        if (!KdSendScriptEngineProfilePacketsToDebuggee(ProfileRequest))
+        {
+            return FALSE;
+        }
+    }
+    else
+    {
+        AssertShowMessageReturnStmt(g_IsKdModuleLoaded, g_DeviceHandle, ASSERT_MESSAGE_KD_NOT_LOADED, ASSERT_MESSAGE_DRIVER_NOT_LOADED, AssertReturnFalse);
+
+        //
+        // Send IOCTL
+        //
+        Status = PlatformDeviceIoControl(
+            g_DeviceHandle,                       // Handle to device
+            IOCTL_QUERY_SCRIPT_ENGINE_PROFILE,    // IO Control Code (IOCTL)
+            ProfileRequest,                       // Input Buffer to driver.
+            SIZEOF_SCRIPT_ENGINE_PROFILE_PACKETS, // Input buffer length
+            ProfileRequest,                       // Output Buffer from driver.
+            SIZEOF_SCRIPT_ENGINE_PROFILE_PACKETS, // Length of output buffer in bytes.
+            &ReturnedLength,                      // Bytes placed in buffer.
+            NULL                                  // synchronous call
+        );
+
+        if (!Status)
+        {
+            ShowMessages("ioctl failed with code 0x%x\n", PlatformGetLastError());
+
+            return FALSE;
+        }
+    }
+
+    if (ProfileRequest->KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFUL)
+    {
+        ShowErrorMessage(ProfileRequest->KernelStatus);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Read the profile of the script of an event
+ * @details Only the symbols that are executed are sent by the debuggee, so
+ * the profile is read in chunks
+ *
+ * @param Tag
+ * @param Profile
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CommandProfileQuery(UINT64 Tag, vector<SCRIPT_ENGINE_PROFILE_ENTRY> & Profile)
+{
+    SCRIPT_ENGINE_PROFILE_PACKETS ProfileRequest  = {};
+    UINT32                        NumberOfSymbols = 1;
+
+    for (UINT32 StartIndex = 0; StartIndex < NumberOfSymbols;)
+    {
+        ProfileRequest.RequestType = SCRIPT_ENGINE_PROFILE_REQUEST_TYPE_QUERY;
+        ProfileRequest.Tag         = Tag;
+        ProfileRequest.StartIndex  = StartIndex;
+
+        if (!CommandProfileSendRequest(&ProfileRequest))
+        {
+            return FALSE;
+        }
+
+        NumberOfSymbols = ProfileRequest.NumberOfSymbols;
+
+        if (Profile.size() != NumberOfSymbols)
+        {
+            Profile.assign(NumberOfSymbols, SCRIPT_ENGINE_PROFILE_ENTRY {});
+        }
+
+        if (ProfileRequest.NumberOfEntries > SCRIPT_ENGINE_PROFILE_MAXIMUM_ENTRIES_IN_PACKET ||
+            ProfileRequest.NextIndex <= StartIndex)
+        {
+            break;
+        }
+
+        for (UINT32 i = 0; i < ProfileRequest.NumberOfEntries; i++)
+        {
+            if (ProfileRequest.Entries[i].Index < NumberOfSymbols)
+            {
+                Profile[ProfileRequest.Entries[i].Index] = ProfileRequest.Entries[i].Profile;
+            }
+        }
+
+        StartIndex = ProfileRequest.NextIndex;
+    }
+
+    if (!ProfileRequest.IsProfilingEnabled)
+    {
+        ShowMessages("profiling is disabled, use 'profile enable' to profile the scripts\n");
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Show the profile of each source line of the script
+ *
+ * @param Source
+ * @param CodeBuffer
+ * @param Profile
+ * @param TotalCycles
+ *
+ * @return VOID
+ */
+VOID
+CommandProfileShowLines(const string & Source, PVOID CodeBuffer, vector<SCRIPT_ENGINE_PROFILE_ENTRY> & Profile, UINT64 TotalCycles)
+{
+    vector<SCRIPT_ENGINE_PROFILE_ENTRY> LinesProfile;
+    UINT32                              NumberOfLines;
+    std::istringstream                  SourceStream(Source);
+    string                              SourceLine;
+
+    NumberOfLines = ScriptEngineAccumulateProfileByLine(CodeBuffer, NULL, NULL, 0);
+
+    if (NumberOfLines == 0)
+    {
+        ShowMessages("err, the lines of the script are not available\n");
+        return;
+    }
+
+    LinesProfile.assign(NumberOfLines, SCRIPT_ENGINE_PROFILE_ENTRY {});
+
+    ScriptEngineAccumulateProfileByLine(CodeBuffer, Profile.data(), LinesProfile.data(), NumberOfLines);
+
+    ShowMessages("line              count             cycles  cycles%%  source\n");
+
+    for (UINT32 Line = 0; std::getline(SourceStream, SourceLine) || Line < NumberOfLines; Line++)
+    {
+        if (Line < NumberOfLines && LinesProfile[Line].Count != 0)
+        {
+            ShowMessages("%4x %18s %18s %7.2f%%  %s\n",
+                         Line + 1,
+                         SeparateTo64BitValue(LinesProfile[Line].Count).c_str(),
+                         SeparateTo64BitValue(LinesProfile[Line].Cycles).c_str(),
+                         TotalCycles ? LinesProfile[Line].Cycles * 100.0 / TotalCycles : 0.0,
+                         SourceLine.c_str());
+        }
+        else
+        {
+            ShowMessages("%4x %18s %18s %8s  %s\n", Line + 1, "", "", "", SourceLine.c_str());
+        }
+
+        SourceLine.clear();
+    }
+}
+
+/**
+ * @brief Show the profile of each operator of the script
+ *
+ * @param CodeBuffer
+ * @param Profile
+ * @param TotalCycles
+ *
+ * @return VOID
+ */
+VOID
+CommandProfileShowOpcodes(PVOID CodeBuffer, vector<SCRIPT_ENGINE_PROFILE_ENTRY> & Profile, UINT64 TotalCycles)
+{
+    PSYMBOL                                                Head = (PSYMBOL)ScriptEngineWrapperGetHead(CodeBuffer);
+    std::map<UINT64, SCRIPT_ENGINE_PROFILE_ENTRY>          Opcodes;
+    vector<std::pair<UINT64, SCRIPT_ENGINE_PROFILE_ENTRY>> SortedOpcodes;
+
+    for (UINT32 i = 0; i < Profile.size(); i++)
+    {
+        if (Profile[i].Count != 0 && Head[i].Type == SYMBOL_SEMANTIC_RULE_TYPE &&
+            Head[i].Value < sizeof(FunctionNames) / sizeof(FunctionNames[0]))
+        {
+            Opcodes[Head[i].Value].Count += Profile[i].Count;
+            Opcodes[Head[i].Value].Cycles += Profile[i].Cycles;
+        }
+    }
+
+    SortedOpcodes.assign(Opcodes.begin(), Opcodes.end());
+
+    std::stable_sort(SortedOpcodes.begin(), SortedOpcodes.end(), [](const auto & First, const auto & Second) {
+        return First.second.Cycles > Second.second.Cycles;
+    });
+
+    ShowMessages("operator                        count             cycles  cycles%%  cycles/op\n");
+
+    for (auto & Opcode : SortedOpcodes)
+    {
+        ShowMessages("%-20s %18s %18s %7.2f%% %10.1f\n",
+                     FunctionNames[Opcode.first],
+                     SeparateTo64BitValue(Opcode.second.Count).c_str(),
+                     SeparateTo64BitValue(Opcode.second.Cycles).c_str(),
+                     TotalCycles ? Opcode.second.Cycles * 100.0 / TotalCycles : 0.0,
+                     (double)Opcode.second.Cycles / Opcode.second.Count);
+    }
+}
+
+/**
+ * @brief Show the profile of the script of an event by its lines and operators
+ * @details The lines of the symbols are not sent to the debuggee, thus, the
+ * source of the script is compiled again, which gives the same symbols as long
+ * as the symbols and the optimization level of the script engine are not changed
+ *
+ * @param Tag
+ *
+ * @return VOID
+ */
+VOID
+CommandProfileShow(UINT64 Tag)
+{
+    vector<SCRIPT_ENGINE_PROFILE_ENTRY> Profile;
+    PVOID                               CodeBuffer;
+    UINT64                              TotalCycles = 0;
+    UINT64                              Executions  = 0;
+
+    if (!CommandProfileQuery(Tag, Profile))
+    {
+        return;
+    }
+
+    for (auto & Entry : Profile)
+    {
+        TotalCycles += Entry.Cycles;
+        Executions += Entry.Count;
+    }
+
+    ShowMessages("executed operators : %s, cycles : %s\n\n",
+                 SeparateTo64BitValue(Executions).c_str(),
+                 SeparateTo64BitValue(TotalCycles).c_str());
+
+    if (Executions == 0)
+    {
+        return;
+    }
+
+    auto Source = g_ScriptSourcesOfEvents.find(Tag);
+
+    if (Source == g_ScriptSourcesOfEvents.end())
+    {
+        ShowMessages("err, the source of the script is not available\n");
+        return;
+    }
+
+    CodeBuffer = ScriptEngineParseWrapper((CHAR *)Source->second.c_str(), FALSE);
+
+    if (CodeBuffer == NULL)
+    {
+        ShowMessages("err, unable to compile the source of the script\n");
+        return;
+    }
+
+    if (ScriptEngineWrapperGetPointer(CodeBuffer) != Profile.size())
+    {
+        ShowMessages("err, the script is compiled differently (either the symbols or the "
+                     "optimization level are changed)\n");
+    }
+    else
+    {
+        CommandProfileShowLines(Source->second, CodeBuffer, Profile, TotalCycles);
+
+        ShowMessages("\n");
+
+        CommandProfileShowOpcodes(CodeBuffer, Profile, TotalCycles);
+    }
+
+    ScriptEngineWrapperRemoveSymbolBuffer(CodeBuffer);
+}
+
+/**
+ * @brief profile command handler
+ *
+ * @param CommandTokens
+ * @param Command
+ *
+ * @return VOID
+ */
+VOID
+CommandProfile(vector<CommandToken> CommandTokens, string Command)
+{
+    SCRIPT_ENGINE_PROFILE_PACKETS ProfileRequest = {};
+    UINT64                        EventId        = 0;
+
+    if (CommandTokens.size() != 2 && CommandTokens.size() != 3)
+    {
+        ShowMessages("incorrect use of the '%s'\n\n",
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+        CommandProfileHelp();
+        return;
+    }
+
+    if (CommandTokens.size() == 2 &&
+        (CompareLowerCaseStrings(CommandTokens.at(1), "enable") || CompareLowerCaseStrings(CommandTokens.at(1), "disable")))
+    {
+        if (CompareLowerCaseStrings(CommandTokens.at(1), "enable"))
+        {
+            ProfileRequest.RequestType = SCRIPT_ENGINE_PROFILE_REQUEST_TYPE_ENABLE;
+        }
+        else
+        {
+            ProfileRequest.RequestType = SCRIPT_ENGINE_PROFILE_REQUEST_TYPE_DISABLE;
+        }
+
+        if (CommandProfileSendRequest(&ProfileRequest))
+        {
+            ShowMessages("profiling of the scripts is %s\n", ProfileRequest.IsProfilingEnabled ? "enabled" : "disabled");
+        }
+
+        return;
+    }
+
+    if (!ConvertTokenToUInt64(CommandTokens.at(1), &EventId))
+    {
+        ShowMessages("please specify a correct hex value for the event number\n\n");
+        CommandProfileHelp();
+        return;
+    }
+
+    if (CommandTokens.size() == 3)
+    {
+        if (!CompareLowerCaseStrings(CommandTokens.at(2), "clear"))
+        {
+            ShowMessages("incorrect use of the '%s'\n\n",
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+            CommandProfileHelp();
+            return;
+        }
+
+        ProfileRequest.RequestType = SCRIPT_ENGINE_PROFILE_REQUEST_TYPE_CLEAR;
+        ProfileRequest.Tag         = EventId + DebuggerEventTagStartSeed;
+
+        if (CommandProfileSendRequest(&ProfileRequest))
+        {
+            ShowMessages("the profile of the script of event %llx is cleared\n", EventId);
+        }
+
+        return;
+    }
+
+    CommandProfileShow(EventId + DebuggerEventTagStartSeed);
+}
@@ -17,6 +17,8 @@
 extern BOOLEAN g_AutoUnpause;
 extern BOOLEAN g_AutoFlush;
 extern BOOLEAN g_AddressConversion;
+extern BOOLEAN g_ScriptEngineJit;
+extern BOOLEAN g_ScriptEngineDeferredPrintf;
 extern BOOLEAN g_IsConnectedToRemoteDebuggee;
 extern UINT32  g_DisassemblerSyntax;
 
@@ -47,6 +49,12 @@ CommandSettingsHelp()
     ShowMessages("\t\te.g : settings syntax intel\n");
     ShowMessages("\t\te.g : settings syntax att\n");
     ShowMessages("\t\te.g : settings syntax masm\n");
+    ShowMessages("\t\te.g : settings optimization O0\n");
+    ShowMessages("\t\te.g : settings optimization O1\n");
+    ShowMessages("\t\te.g : settings jit on\n");
+    ShowMessages("\t\te.g : settings jit off\n");
+    ShowMessages("\t\te.g : settings deferredprintf on\n");
+    ShowMessages("\t\te.g : settings deferredprintf off\n");
 }
 
 /**
@@ -284,6 +292,72 @@ CommandSettingsLoadDefaultValuesFromConfigFile()
             ShowMessages("err, incorrect address conversion settings\n");
         }
     }
+
+    //
+    // Set the optimization level of the script engine
+    //
+    if (CommandSettingsGetValueFromConfigFile("ScriptOptimization", OptionValue))
+    {
+        if (!OptionValue.compare("O0"))
+        {
+            ScriptEngineWrapperSetOptimizationLevel(0);
+        }
+        else if (!OptionValue.compare("O1"))
+        {
+            ScriptEngineWrapperSetOptimizationLevel(1);
+        }
+        else
+        {
+            //
+            // Sth is incorrect
+            //
+            ShowMessages("err, incorrect script optimization settings\n");
+        }
+    }
+
+    //
+    // Set the JIT of the script engine
+    //
+    if (CommandSettingsGetValueFromConfigFile("ScriptJit", OptionValue))
+    {
+        if (!OptionValue.compare("on"))
+        {
+            g_ScriptEngineJit = TRUE;
+        }
+        else if (!OptionValue.compare("off"))
+        {
+            g_ScriptEngineJit = FALSE;
+        }
+        else
+        {
+            //
+            // Sth is incorrect
+            //
+            ShowMessages("err, incorrect script jit settings\n");
+        }
+    }
+
+    //
+    // Set the deferred formatting of printf
+    //
+    if (CommandSettingsGetValueFromConfigFile("ScriptDeferredPrintf", OptionValue))
+    {
+        if (!OptionValue.compare("on"))
+        {
+            g_ScriptEngineDeferredPrintf = TRUE;
+        }
+        else if (!OptionValue.compare("off"))
+        {
+            g_ScriptEngineDeferredPrintf = FALSE;
+        }
+        else
+        {
+            //
+            // Sth is incorrect
+            //
+            ShowMessages("err, incorrect script deferred printf settings\n");
+        }
+    }
 }
 
 /**
@@ -565,6 +639,197 @@ CommandSettingsSyntax(vector<CommandToken> CommandTokens)
     }
 }
 
+/**
+ * @brief set the optimization level of the script engine
+ * and query the current level
+ *
+ * @param CommandTokens
+ * @return VOID
+ */
+VOID
+CommandSettingsOptimization(vector<CommandToken> CommandTokens)
+{
+    if (CommandTokens.size() == 2)
+    {
+        //
+        // It's a query
+        //
+        ShowMessages("script optimization level is : O%d\n", ScriptEngineWrapperGetOptimizationLevel());
+    }
+    else if (CommandTokens.size() == 3)
+    {
+        //
+        // The user tries to set a value as the optimization level
+        //
+        if (CompareLowerCaseStrings(CommandTokens.at(2), "o0"))
+        {
+            ScriptEngineWrapperSetOptimizationLevel(0);
+            CommandSettingsSetValueFromConfigFile("ScriptOptimization", "O0");
+
+            ShowMessages("set script optimization level to O0\n");
+        }
+        else if (CompareLowerCaseStrings(CommandTokens.at(2), "o1"))
+        {
+            ScriptEngineWrapperSetOptimizationLevel(1);
+            CommandSettingsSetValueFromConfigFile("ScriptOptimization", "O1");
+
+            ShowMessages("set script optimization level to O1\n");
+        }
+        else
+        {
+            //
+            // Sth is incorrect
+            //
+            ShowMessages("incorrect use of the '%s', please use 'help %s' for more information\n",
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str(),
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+            return;
+        }
+    }
+    else
+    {
+        //
+        // Sth is incorrect
+        //
+        ShowMessages("incorrect use of the '%s', please use 'help %s' for more information\n",
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str(),
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+        return;
+    }
+}
+
+/**
+ * @brief set the JIT of the script engine enabled and disabled
+ * and query the status of this mode
+ *
+ * @param CommandTokens
+ * @return VOID
+ */
+VOID
+CommandSettingsJit(vector<CommandToken> CommandTokens)
+{
+    if (CommandTokens.size() == 2)
+    {
+        //
+        // It's a query
+        //
+        if (g_ScriptEngineJit)
+        {
+            ShowMessages("script jit is enabled\n");
+        }
+        else
+        {
+            ShowMessages("script jit is disabled\n");
+        }
+    }
+    else if (CommandTokens.size() == 3)
+    {
+        //
+        // The user tries to set a value as the jit
+        //
+        if (CompareLowerCaseStrings(CommandTokens.at(2), "on"))
+        {
+            g_ScriptEngineJit = TRUE;
+            CommandSettingsSetValueFromConfigFile("ScriptJit", "on");
+
+            ShowMessages("set script jit to enabled\n");
+        }
+        else if (CompareLowerCaseStrings(CommandTokens.at(2), "off"))
+        {
+            g_ScriptEngineJit = FALSE;
+            CommandSettingsSetValueFromConfigFile("ScriptJit", "off");
+
+            ShowMessages("set script jit to disabled\n");
+        }
+        else
+        {
+            //
+            // Sth is incorrect
+            //
+            ShowMessages("incorrect use of the '%s', please use 'help %s' for more information\n",
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str(),
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+            return;
+        }
+    }
+    else
+    {
+        //
+        // Sth is incorrect
+        //
+        ShowMessages("incorrect use of the '%s', please use 'help %s' for more information\n",
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str(),
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+        return;
+    }
+}
+
+/**
+ * @brief set the deferred formatting of printf enabled and disabled
+ * and query the status of this mode
+ *
+ * @param CommandTokens
+ * @return VOID
+ */
+VOID
+CommandSettingsDeferredPrintf(vector<CommandToken> CommandTokens)
+{
+    if (CommandTokens.size() == 2)
+    {
+        //
+        // It's a query
+        //
+        if (g_ScriptEngineDeferredPrintf)
+        {
+            ShowMessages("deferred printf is enabled\n");
+        }
+        else
+        {
+            ShowMessages("deferred printf is disabled\n");
+        }
+    }
+    else if (CommandTokens.size() == 3)
+    {
+        //
+        // The user tries to set a value as the deferred printf
+        //
+        if (CompareLowerCaseStrings(CommandTokens.at(2), "on"))
+        {
+            g_ScriptEngineDeferredPrintf = TRUE;
+            CommandSettingsSetValueFromConfigFile("ScriptDeferredPrintf", "on");
+
+            ShowMessages("set deferred printf to enabled (applied to the new events)\n");
+        }
+        else if (CompareLowerCaseStrings(CommandTokens.at(2), "off"))
+        {
+            g_ScriptEngineDeferredPrintf = FALSE;
+            CommandSettingsSetValueFromConfigFile("ScriptDeferredPrintf", "off");
+
+            ShowMessages("set deferred printf to disabled (applied to the new events)\n");
+        }
+        else
+        {
+            //
+            // Sth is incorrect
+            //
+            ShowMessages("incorrect use of the '%s', please use 'help %s' for more information\n",
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str(),
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+            return;
+        }
+    }
+    else
+    {
+        //
+        // Sth is incorrect
+        //
+        ShowMessages("incorrect use of the '%s', please use 'help %s' for more information\n",
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str(),
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+        return;
+    }
+}
+
 /**
  * @brief settings command handler
  *
@@ -647,6 +912,52 @@ CommandSettings(vector<CommandToken> CommandTokens, string Command)
             CommandSettingsAddressConversion(CommandTokens);
         }
     }
+    else if (CompareLowerCaseStrings(CommandTokens.at(1), "optimization"))
+    {
+        //
+        // If it's a remote debugger then we send it to the remote debugger
+        // as the scripts are compiled there
+        //
+        if (g_IsConnectedToRemoteDebuggee)
+        {
+            RemoteConnectionSendCommand(Command.c_str(), (UINT32)Command.length() + 1);
+        }
+        else
+        {
+            //
+            // If it's a connection over serial or a local debugging then
+            // we handle it locally
+            //
+            CommandSettingsOptimization(CommandTokens);
+        }
+    }
+    else if (CompareLowerCaseStrings(CommandTokens.at(1), "jit"))
+    {
+        //
+        // The scripts that are evaluated in user-mode are only executed
+        // locally, so it's always handled locally
+        //
+        CommandSettingsJit(CommandTokens);
+    }
+    else if (CompareLowerCaseStrings(CommandTokens.at(1), "deferredprintf"))
+    {
+        //
+        // If it's a remote debugger then we send it to the remote debugger
+        // as the events are registered (and their messages are formatted) there
+        //
+        if (g_IsConnectedToRemoteDebuggee)
+        {
+            RemoteConnectionSendCommand(Command.c_str(), (UINT32)Command.length() + 1);
+        }
+        else
+        {
+            //
+            // If it's a connection over serial or a local debugging then
+            // we handle it locally
+            //
+            CommandSettingsDeferredPrintf(CommandTokens);
+        }
+    }
     else
     {
         //
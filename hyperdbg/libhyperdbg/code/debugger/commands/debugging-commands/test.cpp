@@ -146,6 +146,18 @@ CommandTestAllFunctionalities()
         return;
     }
 
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_SCRIPT_COMPILE_TIME))
+    {
+        ShowMessages("err, start HyperDbg test process for the script compile-time benchmark\n");
+        return;
+    }
+
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_SCRIPT_OPTIMIZER))
+    {
+        ShowMessages("err, start HyperDbg test process for the script optimizer test cases\n");
+        return;
+    }
+
     //
     // Test script engine (script parser) using semantic tests
     //
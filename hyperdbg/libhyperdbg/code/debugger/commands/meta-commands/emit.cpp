@@ -0,0 +1,93 @@
+/**
+ * @file emit.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief .emit command
+ * @details
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief help of the .emit command
+ *
+ * @return VOID
+ */
+VOID
+CommandEmitHelp()
+{
+    ShowMessages(".emit : writes the binary records of the 'emit' function of the script engine into a file.\n");
+    ShowMessages("Note : each record is written as a frame (a 32-bit length followed by the record), the records "
+                 "of the events that have an output source are sent to the output source instead.\n\n");
+
+    ShowMessages("syntax : \t.emit\n");
+    ShowMessages("syntax : \t.emit [open FilePath (string)]\n");
+    ShowMessages("syntax : \t.emit [close]\n");
+
+    ShowMessages("\n");
+    ShowMessages("\t\te.g : .emit\n");
+    ShowMessages("\t\te.g : .emit open c:\\users\\sina\\desktop\\records.bin\n");
+    ShowMessages("\t\te.g : .emit close\n");
+
+    ShowMessages("\n");
+    ShowMessages("\t\te.g : !syscall script { emit(@rax, @rcx, @rdx); }\n");
+}
+
+/**
+ * @brief .emit command handler
+ *
+ * @param CommandTokens
+ * @param Command
+ *
+ * @return VOID
+ */
+VOID
+CommandEmit(vector<CommandToken> CommandTokens, string Command)
+{
+    string FilePath;
+    UINT64 RecordsCount = 0;
+
+    if (CommandTokens.size() == 1)
+    {
+        if (ScriptEngineWrapperGetEmitFileStatus(FilePath, &RecordsCount))
+        {
+            ShowMessages("emit records are written into file : %s (records: %llx)\n", FilePath.c_str(), RecordsCount);
+        }
+        else
+        {
+            ShowMessages("there is no opened file for the emit records\n");
+        }
+    }
+    else if (CommandTokens.size() == 3 && CompareLowerCaseStrings(CommandTokens.at(1), "open"))
+    {
+        FilePath = GetCaseSensitiveStringFromCommandToken(CommandTokens.at(2));
+
+        if (!ScriptEngineWrapperOpenEmitFile(FilePath))
+        {
+            ShowMessages("unable to open file : %s\n", FilePath.c_str());
+            return;
+        }
+
+        ShowMessages("emit records are written into file : %s\n", FilePath.c_str());
+    }
+    else if (CommandTokens.size() == 2 && CompareLowerCaseStrings(CommandTokens.at(1), "close"))
+    {
+        if (!ScriptEngineWrapperCloseEmitFile(&RecordsCount))
+        {
+            ShowMessages("there is no opened file for the emit records, did you use '.emit open'?\n");
+            return;
+        }
+
+        ShowMessages("the file of the emit records is closed (records: %llx)\n", RecordsCount);
+    }
+    else
+    {
+        ShowMessages("incorrect use of the '%s'\n\n",
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+        CommandEmitHelp();
+        return;
+    }
+}
@@ -0,0 +1,69 @@
+/**
+ * @file scriptcache.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief .scriptcache command
+ * @details
+ * @version 0.19
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief help of the .scriptcache command
+ *
+ * @return VOID
+ */
+VOID
+CommandScriptcacheHelp()
+{
+    ShowMessages(".scriptcache : shows the statistics of the cache of the compiled scripts or flushes it.\n\n");
+
+    ShowMessages("syntax : \t.scriptcache\n");
+    ShowMessages("syntax : \t.scriptcache [flush]\n");
+
+    ShowMessages("\n");
+    ShowMessages("\t\te.g : .scriptcache\n");
+    ShowMessages("\t\te.g : .scriptcache flush\n");
+}
+
+/**
+ * @brief .scriptcache command handler
+ *
+ * @param CommandTokens
+ * @param Command
+ *
+ * @return VOID
+ */
+VOID
+CommandScriptcache(vector<CommandToken> CommandTokens, string Command)
+{
+    SCRIPT_ENGINE_COMPILED_CACHE_STATISTICS Statistics   = {0};
+    UINT32                                  EntriesCount = 0;
+
+    if (CommandTokens.size() == 1)
+    {
+        ScriptEngineWrapperGetCompiledCacheStatistics(&Statistics, &EntriesCount);
+
+        ShowMessages("entries       : %d (maximum: %d)\n", EntriesCount, SCRIPT_ENGINE_COMPILED_CACHE_MAXIMUM_ENTRIES);
+        ShowMessages("hits          : %llu\n", Statistics.Hits);
+        ShowMessages("misses        : %llu\n", Statistics.Misses);
+        ShowMessages("evictions     : %llu\n", Statistics.Evictions);
+        ShowMessages("invalidations : %llu\n", Statistics.Invalidations);
+    }
+    else if (CommandTokens.size() == 2 && CompareLowerCaseStrings(CommandTokens.at(1), "flush"))
+    {
+        ScriptEngineWrapperFlushCompiledCache();
+
+        ShowMessages("the cache of the compiled scripts is flushed\n");
+    }
+    else
+    {
+        ShowMessages("incorrect use of the '%s'\n\n",
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+        CommandScriptcacheHelp();
+        return;
+    }
+}
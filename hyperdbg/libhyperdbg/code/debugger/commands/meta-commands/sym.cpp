@@ -211,6 +211,11 @@ CommandSym(vector<CommandToken> CommandTokens, string Command)
         //
         ScriptEngineUnloadAllSymbolsWrapper();
 
+        //
+        // The objects of the unloaded files are removed from the disassembler
+        //
+        SymbolCreateDisassemblerSymbolMap();
+
         //
         // Size is 3 there is module name (not working ! I don't know why)
         //
@@ -269,7 +274,13 @@ CommandSym(vector<CommandToken> CommandTokens, string Command)
             // Load the pdb file (the validation of pdb file is checked into pdb
             // parsing functions)
             //
-            ScriptEngineLoadFileSymbolWrapper(BaseAddress, PathToPdb.c_str(), NULL);
+            if (ScriptEngineLoadFileSymbolWrapper(BaseAddress, PathToPdb.c_str(), NULL) == 0)
+            {
+                //
+                // Show the objects of the file in the disassembler
+                //
+                SymbolCreateDisassemblerSymbolMap();
+            }
         }
         else
         {
@@ -28,8 +28,11 @@ extern BOOLEAN                  g_IsSerialConnectedToRemoteDebuggee;
 extern BOOLEAN                  g_IsSerialConnectedToRemoteDebugger;
 extern BOOLEAN                  g_IsKdModuleLoaded;
 extern BOOLEAN                  g_IsVmmModuleLoaded;
+extern BOOLEAN                  g_ScriptEngineDeferredPrintf;
 extern ACTIVE_DEBUGGING_PROCESS g_ActiveProcessDebuggingState;
 
+extern std::map<UINT64, std::string> g_ScriptSourcesOfEvents;
+
 /**
  * @brief shows the error message
  *
@@ -638,6 +641,31 @@ ShowErrorMessage(UINT32 Error)
                      Error);
         break;
 
+    case DEBUGGER_ERROR_INVALID_SCRIPT_BUFFER:
+        ShowMessages("err, the script buffer is invalid (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_INVALID_SCRIPT_ENGINE_AGGREGATION_REQUEST:
+        ShowMessages("err, the aggregation request is invalid (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_INVALID_SCRIPT_ENGINE_PERCPU_VARIABLE_REQUEST:
+        ShowMessages("err, the percpu variable request is invalid (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_INVALID_SCRIPT_ENGINE_PROFILE_REQUEST:
+        ShowMessages("err, the profile request is invalid (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_SCRIPT_ENGINE_PROFILE_NOT_FOUND:
+        ShowMessages("err, either the event is not found or its script is not profiled (%x)\n",
+                     Error);
+        break;
+
     default:
         ShowMessages("err, error not found (%x)\n",
                      Error);
@@ -860,6 +888,8 @@ IsTagExist(UINT64 Tag)
  * @param BufferAddress the address that the allocated buffer will be saved on
  * it
  * @param BufferLength the length of the buffer
+ * @param ScriptSource the source of the script (the content of the file
+ * for file scripts)
  * @return BOOLEAN shows whether the interpret was successful (true) or not
  * successful (false)
  */
@@ -869,7 +899,8 @@ InterpretScript(vector<CommandToken> * CommandTokens,
                 PUINT64                BufferAddress,
                 PUINT32                BufferLength,
                 PUINT32                Pointer,
-                PUINT64                ScriptCodeBuffer)
+                PUINT64                ScriptCodeBuffer,
+                string *               ScriptSource)
 {
     BOOLEAN IsTextVisited       = FALSE;
     string  TargetBracketString = "";
@@ -991,6 +1022,7 @@ InterpretScript(vector<CommandToken> * CommandTokens,
     *BufferLength     = ScriptEngineWrapperGetSize(CodeBuffer);
     *Pointer          = ScriptEngineWrapperGetPointer(CodeBuffer);
     *ScriptCodeBuffer = (UINT64)CodeBuffer;
+    *ScriptSource     = TargetBracketString;
 
     //
     // Removing the script indexes from the command
@@ -1767,6 +1799,7 @@ InterpretGeneralEventAndActionsFields(
     UINT32                                ScriptBufferPointer  = 0;
     UINT32                                LengthOfEventBuffer  = 0;
     string                                CommandString;
+    string                                ScriptSource;
     BOOLEAN                               IsAShortCircuitingEventByDefault = FALSE;
     BOOLEAN                               HasConditionBuffer               = FALSE;
     BOOLEAN                               HasOutputPath                    = FALSE;
@@ -1904,7 +1937,8 @@ InterpretGeneralEventAndActionsFields(
                          &ScriptBufferAddress,
                          &ScriptBufferLength,
                          &ScriptBufferPointer,
-                         &ScriptCodeBuffer))
+                         &ScriptCodeBuffer,
+                         &ScriptSource))
     {
         //
         // Indicate code is not available
@@ -2240,6 +2274,17 @@ InterpretGeneralEventAndActionsFields(
         memcpy((PVOID)((UINT64)TempActionScript + sizeof(DEBUGGER_GENERAL_ACTION)),
                (PVOID)ScriptBufferAddress,
                ScriptBufferLength);
+
+        //
+        // The ids of the deferred formats of printf are kept in the copy of the
+        // script (the compiled script is shared with the other callers)
+        //
+        if (g_ScriptEngineDeferredPrintf)
+        {
+            ScriptEngineWrapperAssignDeferredFormats((PVOID)((UINT64)TempActionScript + sizeof(DEBUGGER_GENERAL_ACTION)),
+                                                     ScriptBufferPointer);
+        }
+
         //
         // Set the action Tag
         //
@@ -2261,6 +2306,11 @@ InterpretGeneralEventAndActionsFields(
         //
         TempEvent->CountOfActions = TempEvent->CountOfActions + 1;
 
+        //
+        // Keep the source of the script, so its profile can be shown by lines
+        //
+        g_ScriptSourcesOfEvents[TempEvent->Tag] = ScriptSource;
+
         //
         // Free the buffer of script related functions
         //
@@ -1420,6 +1420,12 @@ InitializeCommandsDictionary()
 
     g_CommandsList["flush"] = {&CommandFlush, &CommandFlushHelp, DEBUGGER_COMMAND_FLUSH_ATTRIBUTES};
 
+    g_CommandsList["agg"] = {&CommandAgg, &CommandAggHelp, DEBUGGER_COMMAND_AGG_ATTRIBUTES};
+
+    g_CommandsList["percpu"] = {&CommandPercpu, &CommandPercpuHelp, DEBUGGER_COMMAND_PERCPU_ATTRIBUTES};
+
+    g_CommandsList["profile"] = {&CommandProfile, &CommandProfileHelp, DEBUGGER_COMMAND_PROFILE_ATTRIBUTES};
+
     g_CommandsList["ucpuid"] = {&CommandUserCpuid, &CommandUserCpuidHelp, DEBUGGER_COMMAND_USER_CPUID_ATTRIBUTES};
     g_CommandsList["cpuid"]  = {&CommandUserCpuid, &CommandUserCpuidHelp, DEBUGGER_COMMAND_USER_CPUID_ATTRIBUTES};
 
@@ -1431,6 +1437,11 @@ InitializeCommandsDictionary()
     g_CommandsList[".script"] = {&CommandScript, &CommandScriptHelp, DEBUGGER_COMMAND_SCRIPT_ATTRIBUTES};
     g_CommandsList["script"]  = {&CommandScript, &CommandScriptHelp, DEBUGGER_COMMAND_SCRIPT_ATTRIBUTES};
 
+    g_CommandsList[".scriptcache"] = {&CommandScriptcache, &CommandScriptcacheHelp, DEBUGGER_COMMAND_SCRIPTCACHE_ATTRIBUTES};
+    g_CommandsList["scriptcache"]  = {&CommandScriptcache, &CommandScriptcacheHelp, DEBUGGER_COMMAND_SCRIPTCACHE_ATTRIBUTES};
+
+    g_CommandsList[".emit"] = {&CommandEmit, &CommandEmitHelp, DEBUGGER_COMMAND_EMIT_ATTRIBUTES};
+
     g_CommandsList["output"] = {&CommandOutput, &CommandOutputHelp, DEBUGGER_COMMAND_OUTPUT_ATTRIBUTES};
 
     g_CommandsList["print"] = {&CommandPrint, &CommandPrintHelp, DEBUGGER_COMMAND_PRINT_ATTRIBUTES};
@@ -772,6 +772,25 @@ KdSendAddActionToEventPacketToDebuggee(PDEBUGGER_GENERAL_ACTION GeneralAction,
 {
     PDEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET Header;
     UINT32                                              Len;
+    UINT32                                              CompactBufferSize = 0;
+    PVOID                                               CompactBuffer     = NULL;
+
+    //
+    // Scripts are sent in the compact format if it's smaller, the debuggee
+    // expands them back to the symbols once the action is added
+    //
+    if (GeneralAction->ActionType == RUN_SCRIPT &&
+        GeneralActionLength == sizeof(DEBUGGER_GENERAL_ACTION) + GeneralAction->ScriptBufferSize)
+    {
+        CompactBuffer = ScriptEngineWrapperEncodeCompactBuffer((UINT64)GeneralAction + sizeof(DEBUGGER_GENERAL_ACTION),
+                                                               GeneralAction->ScriptBufferPointer,
+                                                               &CompactBufferSize);
+    }
+
+    if (CompactBuffer != NULL)
+    {
+        GeneralActionLength = sizeof(DEBUGGER_GENERAL_ACTION) + CompactBufferSize;
+    }
 
     Len = GeneralActionLength +
           sizeof(DEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET);
@@ -780,6 +799,11 @@ KdSendAddActionToEventPacketToDebuggee(PDEBUGGER_GENERAL_ACTION GeneralAction,
 
     if (Header == NULL)
     {
+        if (CompactBuffer != NULL)
+        {
+            free(CompactBuffer);
+        }
+
         return NULL;
     }
 
@@ -793,10 +817,25 @@ KdSendAddActionToEventPacketToDebuggee(PDEBUGGER_GENERAL_ACTION GeneralAction,
     //
     // Move buffer
     //
-    memcpy((PVOID)((UINT64)Header +
-                   sizeof(DEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET)),
-           (PVOID)GeneralAction,
-           GeneralActionLength);
+    if (CompactBuffer != NULL)
+    {
+        PDEBUGGER_GENERAL_ACTION CompactAction = (PDEBUGGER_GENERAL_ACTION)((UINT64)Header +
+                                                                            sizeof(DEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET));
+
+        memcpy(CompactAction, GeneralAction, sizeof(DEBUGGER_GENERAL_ACTION));
+        memcpy((PVOID)((UINT64)CompactAction + sizeof(DEBUGGER_GENERAL_ACTION)), CompactBuffer, CompactBufferSize);
+
+        CompactAction->ScriptBufferSize = CompactBufferSize;
+
+        free(CompactBuffer);
+    }
+    else
+    {
+        memcpy((PVOID)((UINT64)Header +
+                       sizeof(DEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET)),
+               (PVOID)GeneralAction,
+               GeneralActionLength);
+    }
 
     PlatformZeroMemory(&g_DebuggeeResultOfAddingActionsToEvent,
                        sizeof(DEBUGGER_EVENT_AND_ACTION_RESULT));
@@ -1088,6 +1127,117 @@ KdSendSmiPacketsToDebuggee(PSMI_OPERATION_PACKETS SmiOperationRequest, UINT32 Ex
     return TRUE;
 }
 
+/**
+ * @brief Send requests of the aggregation tables of the script engine to the debuggee
+ *
+ * @param AggregationRequest
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendScriptEngineAggregationPacketsToDebuggee(PSCRIPT_ENGINE_AGGREGATION_PACKETS AggregationRequest)
+{
+    //
+    // Set the request data
+    //
+    DbgWaitSetKernelRequestData(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_SCRIPT_ENGINE_AGGREGATIONS_RESULT,
+                                AggregationRequest,
+                                SIZEOF_SCRIPT_ENGINE_AGGREGATION_PACKETS);
+
+    //
+    // Send the aggregation request packets
+    //
+    if (!KdCommandPacketAndBufferToDebuggee(
+            DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGER_TO_DEBUGGEE_EXECUTE_ON_VMX_ROOT,
+            DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_QUERY_SCRIPT_ENGINE_AGGREGATIONS,
+            (CHAR *)AggregationRequest,
+            SIZEOF_SCRIPT_ENGINE_AGGREGATION_PACKETS))
+    {
+        return FALSE;
+    }
+
+    //
+    // Wait until the result of the aggregation request is received
+    //
+    DbgWaitForKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_SCRIPT_ENGINE_AGGREGATIONS_RESULT);
+
+    return TRUE;
+}
+
+/**
+ * @brief Send requests of the percpu variables of the script engine to the debuggee
+ *
+ * @param PercpuVariableRequest
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendScriptEnginePercpuVariablePacketsToDebuggee(PSCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS PercpuVariableRequest)
+{
+    //
+    // Set the request data
+    //
+    DbgWaitSetKernelRequestData(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_SCRIPT_ENGINE_PERCPU_VARIABLE_RESULT,
+                                PercpuVariableRequest,
+                                SIZEOF_SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS);
+
+    //
+    // Send the percpu variable request packets
+    //
+    if (!KdCommandPacketAndBufferToDebuggee(
+            DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGER_TO_DEBUGGEE_EXECUTE_ON_VMX_ROOT,
+            DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_QUERY_SCRIPT_ENGINE_PERCPU_VARIABLE,
+            (CHAR *)PercpuVariableRequest,
+            SIZEOF_SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS))
+    {
+        return FALSE;
+    }
+
+    //
+    // Wait until the result of the percpu variable request is received
+    //
+    DbgWaitForKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_SCRIPT_ENGINE_PERCPU_VARIABLE_RESULT);
+
+    return TRUE;
+}
+
+/**
+ * @brief Send requests of the profile of the scripts to the debuggee
+ *
+ * @param ProfileRequest
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendScriptEngineProfilePacketsToDebuggee(PSCRIPT_ENGINE_PROFILE_PACKETS ProfileRequest)
+{
+    //
+    // Set the request data
+    //
+    DbgWaitSetKernelRequestData(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_SCRIPT_ENGINE_PROFILE_RESULT,
+                                ProfileRequest,
+                                SIZEOF_SCRIPT_ENGINE_PROFILE_PACKETS);
+
+    //
+    // Send the profile request packets
+    //
+    if (!KdCommandPacketAndBufferToDebuggee(
+            DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGER_TO_DEBUGGEE_EXECUTE_ON_VMX_ROOT,
+            DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_QUERY_SCRIPT_ENGINE_PROFILE,
+            (CHAR *)ProfileRequest,
+            SIZEOF_SCRIPT_ENGINE_PROFILE_PACKETS))
+    {
+        return FALSE;
+    }
+
+    //
+    // Wait until the result of the profile request is received
+    //
+    DbgWaitForKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_SCRIPT_ENGINE_PROFILE_RESULT);
+
+    return TRUE;
+}
+
 /**
  * @brief Send requests for HyperTrace LBR dump packet to the debuggee
  *
@@ -1264,7 +1414,21 @@ BOOLEAN
 KdSendScriptPacketToDebuggee(UINT64 BufferAddress, UINT32 BufferLength, UINT32 Pointer, BOOLEAN IsFormat)
 {
     PDEBUGGEE_SCRIPT_PACKET ScriptPacket;
-    UINT32                  SizeOfStruct = 0;
+    UINT32                  SizeOfStruct      = 0;
+    UINT32                  CompactBufferSize = 0;
+    PVOID                   CompactBuffer     = NULL;
+
+    //
+    // Send the script in the compact format if it's smaller, the debuggee
+    // expands it back to the symbols
+    //
+    CompactBuffer = ScriptEngineWrapperEncodeCompactBuffer(BufferAddress, Pointer, &CompactBufferSize);
+
+    if (CompactBuffer != NULL)
+    {
+        BufferAddress = (UINT64)CompactBuffer;
+        BufferLength  = CompactBufferSize;
+    }
 
     SizeOfStruct = sizeof(DEBUGGEE_SCRIPT_PACKET) + BufferLength;
 
@@ -1286,6 +1450,11 @@ KdSendScriptPacketToDebuggee(UINT64 BufferAddress, UINT32 BufferLength, UINT32 P
            (PVOID)BufferAddress,
            BufferLength);
 
+    if (CompactBuffer != NULL)
+    {
+        free(CompactBuffer);
+    }
+
     //
     // Send script packet
     //
@@ -70,6 +70,9 @@ ListeningSerialPortInDebugger()
     PDEBUGGER_SHORT_CIRCUITING_EVENT             ShortCircuitingPacket;
     PDEBUGGER_READ_PAGE_TABLE_ENTRIES_DETAILS    PtePacket;
     PSMI_OPERATION_PACKETS                       SmiOperationPacket;
+    PSCRIPT_ENGINE_AGGREGATION_PACKETS           ScriptEngineAggregationPacket;
+    PSCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS       ScriptEnginePercpuVariablePacket;
+    PSCRIPT_ENGINE_PROFILE_PACKETS               ScriptEngineProfilePacket;
     PHYPERTRACE_LBR_DUMP_PACKETS                 HyperTraceLbrdumpPacket;
     PHYPERTRACE_PT_OPERATION_PACKETS             HyperTracePtOperationPacket;
     PDEBUGGER_PAGE_IN_REQUEST                    PageinPacket;
@@ -81,6 +84,8 @@ ListeningSerialPortInDebugger()
     PDEBUGGEE_PCITREE_REQUEST_RESPONSE_PACKET    PcitreePacket;
     PINTERRUPT_DESCRIPTOR_TABLE_ENTRIES_PACKETS  IdtEntryRequestPacket;
     PDEBUGGEE_PCIDEVINFO_REQUEST_RESPONSE_PACKET PcidevinfoPacket;
+    CHAR *                                       Message;
+    CHAR                                         DeferredMessage[PacketChunkSize];
 
 StartAgain:
 
@@ -199,13 +204,46 @@ StartAgain:
         case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_LOGGING_MECHANISM:
 
             MessagePacket = (DEBUGGEE_MESSAGE_PACKET *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+            Message       = MessagePacket->Message;
+
+            //
+            // The binary records of emit are sent to the output sources or
+            // to the file of the records
+            //
+            if (LengthReceived >= sizeof(DEBUGGER_REMOTE_PACKET) + sizeof(UINT32) &&
+                ScriptEngineWrapperConsumeEmitRecord(MessagePacket->OperationCode,
+                                                     MessagePacket->Message,
+                                                     LengthReceived - sizeof(DEBUGGER_REMOTE_PACKET) - sizeof(UINT32),
+                                                     DeferredMessage,
+                                                     sizeof(DeferredMessage)))
+            {
+                if (DeferredMessage[0] != '\0' && !g_IgnoreNewLoggingMessages)
+                {
+                    ShowMessages("%s", DeferredMessage);
+                }
+
+                break;
+            }
+
+            //
+            // The deferred messages of printf only contain the values,
+            // they're formatted here
+            //
+            if (LengthReceived >= sizeof(DEBUGGER_REMOTE_PACKET) + sizeof(UINT32) &&
+                ScriptEngineWrapperFormatDeferredMessage(MessagePacket->Message,
+                                                         LengthReceived - sizeof(DEBUGGER_REMOTE_PACKET) - sizeof(UINT32),
+                                                         DeferredMessage,
+                                                         sizeof(DeferredMessage)))
+            {
+                Message = DeferredMessage;
+            }
 
             //
             // Check if there are available output sources
             //
             if (!g_OutputSourcesInitialized || !ForwardingCheckAndPerformEventForwarding(MessagePacket->OperationCode,
-                                                                                         MessagePacket->Message,
-                                                                                         (UINT32)strlen(MessagePacket->Message)))
+                                                                                         Message,
+                                                                                         (UINT32)strlen(Message)))
             {
                 //
                 // We check g_IgnoreNewLoggingMessages here because we want to
@@ -213,7 +251,7 @@ StartAgain:
                 //
                 if (!g_IgnoreNewLoggingMessages)
                 {
-                    ShowMessages("%s", MessagePacket->Message);
+                    ShowMessages("%s", Message);
                 }
             }
 
@@ -1031,6 +1069,69 @@ StartAgain:
 
             break;
 
+        case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_SCRIPT_ENGINE_AGGREGATIONS:
+
+            ScriptEngineAggregationPacket = (SCRIPT_ENGINE_AGGREGATION_PACKETS *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+
+            //
+            // Get the address and size of the caller
+            //
+            DbgWaitGetKernelRequestData(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_SCRIPT_ENGINE_AGGREGATIONS_RESULT, &CallerAddress, &CallerSize);
+
+            //
+            // Copy the memory buffer for the caller
+            //
+            memcpy(CallerAddress, ScriptEngineAggregationPacket, CallerSize);
+
+            //
+            // Signal the event relating to receiving result of the aggregation request
+            //
+            DbgReceivedKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_SCRIPT_ENGINE_AGGREGATIONS_RESULT);
+
+            break;
+
+        case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_SCRIPT_ENGINE_PERCPU_VARIABLE:
+
+            ScriptEnginePercpuVariablePacket = (SCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+
+            //
+            // Get the address and size of the caller
+            //
+            DbgWaitGetKernelRequestData(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_SCRIPT_ENGINE_PERCPU_VARIABLE_RESULT, &CallerAddress, &CallerSize);
+
+            //
+            // Copy the memory buffer for the caller
+            //
+            memcpy(CallerAddress, ScriptEnginePercpuVariablePacket, CallerSize);
+
+            //
+            // Signal the event relating to receiving result of the percpu variable request
+            //
+            DbgReceivedKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_SCRIPT_ENGINE_PERCPU_VARIABLE_RESULT);
+
+            break;
+
+        case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_SCRIPT_ENGINE_PROFILE:
+
+            ScriptEngineProfilePacket = (SCRIPT_ENGINE_PROFILE_PACKETS *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+
+            //
+            // Get the address and size of the caller
+            //
+            DbgWaitGetKernelRequestData(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_SCRIPT_ENGINE_PROFILE_RESULT, &CallerAddress, &CallerSize);
+
+            //
+            // Copy the memory buffer for the caller
+            //
+            memcpy(CallerAddress, ScriptEngineProfilePacket, CallerSize);
+
+            //
+            // Signal the event relating to receiving result of the profile request
+            //
+            DbgReceivedKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_SCRIPT_ENGINE_PROFILE_RESULT);
+
+            break;
+
         case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_HYPERTRACE_LBR_DUMP_REQUESTS:
 
             HyperTraceLbrdumpPacket = (HYPERTRACE_LBR_DUMP_PACKETS *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
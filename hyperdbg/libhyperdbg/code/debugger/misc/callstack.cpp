@@ -214,11 +214,10 @@ CallstackShowFrames(PDEBUGGER_SINGLE_CALLSTACK_FRAME  CallstackFrames,
                     DEBUGGER_CALLSTACK_DISPLAY_METHOD DisplayMethod,
                     BOOLEAN                           Is32Bit)
 {
-    UINT32                                                 CallLength;
-    UINT64                                                 TargetAddress;
-    UINT64                                                 UsedBaseAddress;
-    BOOLEAN                                                IsCall = FALSE;
-    std::map<UINT64, LOCAL_FUNCTION_DESCRIPTION>::iterator Iterate;
+    UINT32  CallLength;
+    UINT64  TargetAddress;
+    UINT64  UsedBaseAddress;
+    BOOLEAN IsCall = FALSE;
 
     //
     // Print callstack frames
@@ -39,9 +39,9 @@ all
 //
 // Global Variables
 //
-extern UINT32                                       g_DisassemblerSyntax;
-extern std::map<UINT64, LOCAL_FUNCTION_DESCRIPTION> g_DisassemblerSymbolMap;
-extern BOOLEAN                                      g_AddressConversion;
+extern UINT32       g_DisassemblerSyntax;
+extern SYMBOL_INDEX g_SymbolIndex;
+extern BOOLEAN      g_AddressConversion;
 
 /**
  * @brief Defines the `ZydisSymbol` struct.
@@ -73,8 +73,8 @@ ZydisFormatterPrintAddressAbsolute(const ZydisFormatter *  formatter,
                                    ZydisFormatterBuffer *  buffer,
                                    ZydisFormatterContext * context)
 {
-    ZyanU64                                                address;
-    std::map<UINT64, LOCAL_FUNCTION_DESCRIPTION>::iterator Iterate;
+    ZyanU64             address;
+    SYMBOL_INDEX_OBJECT Object;
 
     ZYAN_CHECK(ZydisCalcAbsoluteAddress(context->instruction, context->operand, context->runtime_address, &address));
 
@@ -86,17 +86,15 @@ ZydisFormatterPrintAddressAbsolute(const ZydisFormatter *  formatter,
         //
         // Check to find the symbol of address
         //
-        Iterate = g_DisassemblerSymbolMap.find(address);
-
-        if (Iterate != g_DisassemblerSymbolMap.end())
+        if (SymbolIndexLookup(&g_SymbolIndex, address, &Object) && Object.Address == address)
         {
             ZYAN_CHECK(ZydisFormatterBufferAppend(buffer, ZYDIS_TOKEN_SYMBOL));
             ZyanString * string;
             ZYAN_CHECK(ZydisFormatterBufferGetString(buffer, &string));
             return ZyanStringAppendFormat(string,
                                           "<%s (%s)>",
-                                          Iterate->second.ObjectName.c_str(),
-                                          SeparateTo64BitValue(Iterate->first).c_str());
+                                          Object.Name,
+                                          SeparateTo64BitValue(Object.Address).c_str());
         }
     }
 
@@ -927,8 +925,8 @@ ZydisFormatterPrintAddressAbsoluteForTrackingInstructions(const ZydisFormatter *
                                                           ZydisFormatterBuffer *  buffer,
                                                           ZydisFormatterContext * context)
 {
-    ZyanU64                                                address;
-    std::map<UINT64, LOCAL_FUNCTION_DESCRIPTION>::iterator Iterate;
+    ZyanU64             address;
+    SYMBOL_INDEX_OBJECT Object;
 
     ZYAN_CHECK(ZydisCalcAbsoluteAddress(context->instruction, context->operand, context->runtime_address, &address));
 
@@ -940,9 +938,7 @@ ZydisFormatterPrintAddressAbsoluteForTrackingInstructions(const ZydisFormatter *
         //
         // Check to find the symbol of address
         //
-        Iterate = g_DisassemblerSymbolMap.find(address);
-
-        if (Iterate != g_DisassemblerSymbolMap.end())
+        if (SymbolIndexLookup(&g_SymbolIndex, address, &Object) && Object.Address == address)
         {
             ZYAN_CHECK(ZydisFormatterBufferAppend(buffer, ZYDIS_TOKEN_SYMBOL));
             ZyanString * string;
@@ -951,12 +947,12 @@ ZydisFormatterPrintAddressAbsoluteForTrackingInstructions(const ZydisFormatter *
             //
             // Call the tracker callback (with function name)
             //
-            CommandTrackHandleReceivedCallInstructions(Iterate->second.ObjectName.c_str(), Iterate->first);
+            CommandTrackHandleReceivedCallInstructions(Object.Name, Object.Address);
 
             return ZyanStringAppendFormat(string,
                                           "<%s (%s)>",
-                                          Iterate->second.ObjectName.c_str(),
-                                          SeparateTo64BitValue(Iterate->first).c_str());
+                                          Object.Name,
+                                          SeparateTo64BitValue(Object.Address).c_str());
         }
     }
 
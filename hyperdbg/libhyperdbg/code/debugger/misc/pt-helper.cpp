@@ -11,6 +11,12 @@
  */
 #include "pch.h"
 
+//
+// Global Variables
+//
+extern BOOLEAN      g_AddressConversion;
+extern SYMBOL_INDEX g_SymbolIndex;
+
 /**
  * @brief Read the process image for PT decoding
  *
@@ -411,14 +417,25 @@ PtHelperDecodeCore(UINT32 Cpu, const UINT8 * Buffer, UINT64 Size, IMAGE_SYMBOL_C
 
             ZydisDisassembledInstruction Disasm;
             ZydisMachineMode             Mode = (Insn.mode == ptem_32bit) ? ZYDIS_MACHINE_MODE_LEGACY_32 : ZYDIS_MACHINE_MODE_LONG_64;
+            SYMBOL_INDEX_OBJECT          Object;
 
-            if (ZYAN_SUCCESS(ZydisDisassembleIntel(Mode, Insn.ip, Insn.raw, Insn.size, &Disasm)))
+            //
+            // The instructions are shown by their functions if the symbols
+            // of the image are loaded (the same as the disassembler)
+            //
+            if (!ZYAN_SUCCESS(ZydisDisassembleIntel(Mode, Insn.ip, Insn.raw, Insn.size, &Disasm)))
+                ShowMessages("    0x%016llx  (undecodable)\n", (UINT64)Insn.ip);
+            else if (g_AddressConversion && SymbolIndexLookup(&g_SymbolIndex, Insn.ip, &Object) && Insn.ip - Object.Address < Object.Size)
+                ShowMessages("    0x%016llx  %s+0x%-6llx  %s\n",
+                             (UINT64)Insn.ip,
+                             Object.Name,
+                             (UINT64)(Insn.ip - Object.Address),
+                             Disasm.text);
+            else
                 ShowMessages("    0x%016llx  exe+0x%-6llx  %s\n",
                              (UINT64)Insn.ip,
                              (UINT64)(Insn.ip - Ctx->ImageBase),
                              Disasm.text);
-            else
-                ShowMessages("    0x%016llx  (undecodable)\n", (UINT64)Insn.ip);
 
             Count++;
         }
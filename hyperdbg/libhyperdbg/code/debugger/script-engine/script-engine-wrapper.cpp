@@ -19,11 +19,28 @@
 // Global Variables
 //
 extern UINT64 * g_ScriptGlobalVariables;
+extern UINT64 * g_ScriptPercpuVariables;
 extern UINT64 * g_ScriptStackBuffer;
 extern UINT64   g_CurrentExprEvalResult;
 extern BOOLEAN  g_CurrentExprEvalResultHasError;
+extern BOOLEAN  g_ScriptEngineJit;
 extern UINT64 * g_HwdbgPinsStatus;
 
+extern std::list<PSCRIPT_ENGINE_COMPILED_CACHE_ENTRY>                             g_ScriptCompiledCacheLruList;
+extern std::map<UINT64, std::list<PSCRIPT_ENGINE_COMPILED_CACHE_ENTRY>::iterator> g_ScriptCompiledCacheIndex;
+extern std::map<PVOID, PSCRIPT_ENGINE_COMPILED_CACHE_ENTRY>                       g_ScriptCompiledCacheBuffers;
+extern SCRIPT_ENGINE_COMPILED_CACHE_STATISTICS                                    g_ScriptCompiledCacheStatistics;
+extern UINT64                                                                     g_ScriptCompiledCacheGeneration;
+extern volatile LONG                                                              g_ScriptCompiledCacheLock;
+extern std::vector<SCRIPT_ENGINE_DEFERRED_FORMAT>                                 g_ScriptDeferredFormats;
+extern std::map<std::string, UINT32>                                              g_ScriptDeferredFormatIds;
+extern volatile LONG                                                              g_ScriptDeferredFormatsLock;
+extern ofstream                                                                   g_ScriptEmitFile;
+extern std::string                                                                g_ScriptEmitFilePath;
+extern UINT64                                                                     g_ScriptEmitFileRecordsCount;
+extern volatile LONG                                                              g_ScriptEmitFileLock;
+extern BOOLEAN                                                                    g_OutputSourcesInitialized;
+
 //
 // Temporary structures used only for testing
 //
@@ -67,7 +84,14 @@ ScriptEngineConvertNameToAddressWrapper(const CHAR * FunctionOrVariableName, PBO
 UINT32
 ScriptEngineLoadFileSymbolWrapper(UINT64 BaseAddress, const CHAR * PdbFileName, const CHAR * CustomModuleName)
 {
-    return ScriptEngineLoadFileSymbol(BaseAddress, PdbFileName, CustomModuleName);
+    UINT32 Result = ScriptEngineLoadFileSymbol(BaseAddress, PdbFileName, CustomModuleName);
+
+    //
+    // Scripts that are compiled before might refer to the previous symbols
+    //
+    ScriptEngineWrapperInvalidateCompiledCache();
+
+    return Result;
 }
 
 /**
@@ -91,7 +115,11 @@ ScriptEngineSetTextMessageCallbackWrapper(PVOID Handler)
 UINT32
 ScriptEngineUnloadAllSymbolsWrapper()
 {
-    return ScriptEngineUnloadAllSymbols();
+    UINT32 Result = ScriptEngineUnloadAllSymbols();
+
+    ScriptEngineWrapperInvalidateCompiledCache();
+
+    return Result;
 }
 
 /**
@@ -103,7 +131,11 @@ ScriptEngineUnloadAllSymbolsWrapper()
 UINT32
 ScriptEngineUnloadModuleSymbolWrapper(CHAR * ModuleName)
 {
-    return ScriptEngineUnloadModuleSymbol(ModuleName);
+    UINT32 Result = ScriptEngineUnloadModuleSymbol(ModuleName);
+
+    ScriptEngineWrapperInvalidateCompiledCache();
+
+    return Result;
 }
 
 /**
@@ -195,7 +227,14 @@ ScriptEngineSymbolInitLoadWrapper(PMODULE_SYMBOL_DETAIL BufferToStoreDetails,
                                   const CHAR *          SymbolPath,
                                   BOOLEAN               IsSilentLoad)
 {
-    return ScriptEngineSymbolInitLoad(BufferToStoreDetails, StoredLength, DownloadIfAvailable, SymbolPath, IsSilentLoad);
+    BOOLEAN Result = ScriptEngineSymbolInitLoad(BufferToStoreDetails, StoredLength, DownloadIfAvailable, SymbolPath, IsSilentLoad);
+
+    //
+    // Type layouts and addresses of the symbols might be changed (e.g., '.sym reload')
+    //
+    ScriptEngineWrapperInvalidateCompiledCache();
+
+    return Result;
 }
 
 /**
@@ -286,8 +325,146 @@ ScriptEngineConvertLoadedModuleToPdbFileAndGuidAndAgeDetailsWrapper(const BYTE *
 // *********************** Function links (wrapper) ***********************
 //
 
+/**
+ * @brief Compute the key of a script in the cache of the compiled scripts
+ * @details FNV-1a hash of the script and the context that it is compiled in
+ * (the generation of the loaded symbols and the optimization level)
+ *
+ * @param Expr
+ *
+ * @return UINT64
+ */
+UINT64
+ScriptEngineWrapperComputeCompiledCacheKey(const CHAR * Expr)
+{
+    UINT64 Hash = 0xcbf29ce484222325;
+
+    for (const CHAR * Current = Expr; *Current != '\0'; Current++)
+    {
+        Hash ^= (UINT8)*Current;
+        Hash *= 0x100000001b3;
+    }
+
+    Hash ^= g_ScriptCompiledCacheGeneration;
+    Hash *= 0x100000001b3;
+    Hash ^= ScriptEngineGetOptimizationLevel();
+    Hash *= 0x100000001b3;
+
+    return Hash;
+}
+
+/**
+ * @brief Remove an entry from the cache of the compiled scripts
+ * @details The cache lock should be held by the caller
+ *
+ * @param Entry
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineWrapperEvictCompiledCacheEntry(PSCRIPT_ENGINE_COMPILED_CACHE_ENTRY Entry)
+{
+    auto Item = g_ScriptCompiledCacheIndex.find(Entry->Hash);
+
+    if (Item != g_ScriptCompiledCacheIndex.end() && *Item->second == Entry)
+    {
+        g_ScriptCompiledCacheLruList.erase(Item->second);
+        g_ScriptCompiledCacheIndex.erase(Item);
+    }
+
+    Entry->IsEvicted = TRUE;
+
+    //
+    // The buffer is freed later if it's still used by a caller
+    //
+    if (Entry->ReferenceCount == 0)
+    {
+        g_ScriptCompiledCacheBuffers.erase(Entry->SymbolBuffer);
+        RemoveSymbolBuffer(Entry->SymbolBuffer);
+        delete Entry;
+    }
+}
+
+/**
+ * @brief Search the cache of the compiled scripts
+ * @details The cache lock should be held by the caller
+ *
+ * @param Hash
+ * @param Expr
+ *
+ * @return PSYMBOL_BUFFER NULL if the script is not in the cache
+ */
+PSYMBOL_BUFFER
+ScriptEngineWrapperLookupCompiledCache(UINT64 Hash, const CHAR * Expr)
+{
+    auto Item = g_ScriptCompiledCacheIndex.find(Hash);
+
+    if (Item == g_ScriptCompiledCacheIndex.end() || (*Item->second)->Script != Expr)
+    {
+        return NULL;
+    }
+
+    PSCRIPT_ENGINE_COMPILED_CACHE_ENTRY Entry = *Item->second;
+
+    //
+    // Move it to the front (most recently used)
+    //
+    g_ScriptCompiledCacheLruList.splice(g_ScriptCompiledCacheLruList.begin(), g_ScriptCompiledCacheLruList, Item->second);
+
+    Entry->ReferenceCount++;
+
+    return Entry->SymbolBuffer;
+}
+
+/**
+ * @brief Add a compiled script to the cache of the compiled scripts
+ * @details The cache lock should be held by the caller
+ *
+ * @param Hash
+ * @param Expr
+ * @param SymbolBuffer
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineWrapperInsertCompiledCache(UINT64 Hash, const CHAR * Expr, PSYMBOL_BUFFER SymbolBuffer)
+{
+    auto Item = g_ScriptCompiledCacheIndex.find(Hash);
+
+    if (Item != g_ScriptCompiledCacheIndex.end())
+    {
+        //
+        // Either another script with the same hash, or the same script that is
+        // compiled by another thread at the same time, the new one replaces it
+        //
+        ScriptEngineWrapperEvictCompiledCacheEntry(*Item->second);
+        g_ScriptCompiledCacheStatistics.Evictions++;
+    }
+
+    while (g_ScriptCompiledCacheLruList.size() >= SCRIPT_ENGINE_COMPILED_CACHE_MAXIMUM_ENTRIES)
+    {
+        ScriptEngineWrapperEvictCompiledCacheEntry(g_ScriptCompiledCacheLruList.back());
+        g_ScriptCompiledCacheStatistics.Evictions++;
+    }
+
+    PSCRIPT_ENGINE_COMPILED_CACHE_ENTRY Entry = new SCRIPT_ENGINE_COMPILED_CACHE_ENTRY;
+
+    Entry->Hash           = Hash;
+    Entry->Script         = Expr;
+    Entry->SymbolBuffer   = SymbolBuffer;
+    Entry->ReferenceCount = 1;
+    Entry->IsEvicted      = FALSE;
+
+    g_ScriptCompiledCacheLruList.push_front(Entry);
+    g_ScriptCompiledCacheIndex[Hash]           = g_ScriptCompiledCacheLruList.begin();
+    g_ScriptCompiledCacheBuffers[SymbolBuffer] = Entry;
+}
+
 /**
  * @brief ScriptEngineParse wrapper
+ * @details The compiled scripts are cached, so the same script is not compiled
+ * again (e.g., re-arming events or re-running a '.script' file) until the symbols
+ * change; the returned buffer is shared and should not be modified
  *
  * @param Expr
  * @param ShowErrorMessageIfAny
@@ -298,6 +475,38 @@ PVOID
 ScriptEngineParseWrapper(CHAR * Expr, BOOLEAN ShowErrorMessageIfAny)
 {
     PSYMBOL_BUFFER SymbolBuffer;
+    UINT64         Hash = 0;
+    BOOLEAN        IsCacheable;
+
+    //
+    // Included files might be changed without changing the script itself
+    //
+    IsCacheable = strstr(Expr, "#include") == NULL;
+
+    if (IsCacheable)
+    {
+        SpinlockLock(&g_ScriptCompiledCacheLock);
+
+        Hash         = ScriptEngineWrapperComputeCompiledCacheKey(Expr);
+        SymbolBuffer = ScriptEngineWrapperLookupCompiledCache(Hash, Expr);
+
+        if (SymbolBuffer != NULL)
+        {
+            g_ScriptCompiledCacheStatistics.Hits++;
+        }
+        else
+        {
+            g_ScriptCompiledCacheStatistics.Misses++;
+        }
+
+        SpinlockUnlock(&g_ScriptCompiledCacheLock);
+
+        if (SymbolBuffer != NULL)
+        {
+            return SymbolBuffer;
+        }
+    }
+
     SymbolBuffer = (PSYMBOL_BUFFER)ScriptEngineParse(Expr);
 
     //
@@ -305,6 +514,21 @@ ScriptEngineParseWrapper(CHAR * Expr, BOOLEAN ShowErrorMessageIfAny)
     //
     if (SymbolBuffer->Message == NULL)
     {
+        if (IsCacheable)
+        {
+            SpinlockLock(&g_ScriptCompiledCacheLock);
+
+            //
+            // Symbols might be changed while the script was compiling
+            //
+            if (Hash == ScriptEngineWrapperComputeCompiledCacheKey(Expr))
+            {
+                ScriptEngineWrapperInsertCompiledCache(Hash, Expr, SymbolBuffer);
+            }
+
+            SpinlockUnlock(&g_ScriptCompiledCacheLock);
+        }
+
         return SymbolBuffer;
     }
     else
@@ -365,6 +589,24 @@ ScriptEngineEvalWrapper(PGUEST_REGS GuestRegs,
         PlatformZeroMemory(g_ScriptGlobalVariables, MAX_VAR_COUNT * sizeof(UINT64));
     }
 
+    //
+    // Allocate percpu variables holder, user-mode scripts are evaluated on
+    // a single logical core, thus, a single slice is enough
+    //
+    if (!g_ScriptPercpuVariables)
+    {
+        g_ScriptPercpuVariables = (UINT64 *)malloc(MAX_VAR_COUNT * sizeof(UINT64));
+
+        if (g_ScriptPercpuVariables == NULL)
+        {
+            ShowMessages("err, could not allocate memory for user-mode percpu variables");
+
+            return;
+        }
+
+        PlatformZeroMemory(g_ScriptPercpuVariables, MAX_VAR_COUNT * sizeof(UINT64));
+    }
+
     //
     // Allocate stack buffer holder, actually in reality each core should
     // have its own set of stack buffer but as we never run multi-core scripts
@@ -403,6 +645,7 @@ ScriptEngineEvalWrapper(PGUEST_REGS GuestRegs,
 
     ScriptGeneralRegisters.StackBuffer         = g_ScriptStackBuffer;
     ScriptGeneralRegisters.GlobalVariablesList = g_ScriptGlobalVariables;
+    ScriptGeneralRegisters.PercpuVariablesList = g_ScriptPercpuVariables;
     PlatformZeroMemory(g_ScriptStackBuffer, MAX_STACK_BUFFER_COUNT * sizeof(UINT64));
 
     if (CodeBuffer->Message == NULL)
@@ -411,6 +654,69 @@ ScriptEngineEvalWrapper(PGUEST_REGS GuestRegs,
         printf("\nScriptEngineExecute:\n");
 #endif
         UINT64 i = 0;
+
+#ifndef _SCRIPT_ENGINE_CODEEXEC_DBG_EN
+        //
+        // Execute the linked code (the same as the events in the debuggee), if
+        // the script cannot be linked then it's interpreted
+        //
+        UINT32 LinkedCodeSize = ScriptEngineGetLinkedCodeSize(CodeBuffer->Pointer);
+        PVOID  LinkedCode     = LinkedCodeSize != 0 ? malloc(LinkedCodeSize) : NULL;
+        PVOID  JitCode        = NULL;
+
+        if (LinkedCode != NULL && ScriptEngineLink(CodeBuffer, LinkedCode, LinkedCodeSize))
+        {
+            //
+            // If the JIT is enabled, the linked code is translated to native
+            // code (if it cannot be translated then the linked code is executed)
+            //
+            if (g_ScriptEngineJit)
+            {
+                JitCode = ScriptEngineJitCompile(LinkedCode);
+            }
+
+            switch (JitCode != NULL ? ScriptEngineJitExecute(GuestRegs, &ActionBuffer, &ScriptGeneralRegisters, JitCode, &ErrorSymbol) : ScriptEngineExecuteLinked(GuestRegs, &ActionBuffer, &ScriptGeneralRegisters, LinkedCode, &ErrorSymbol))
+            {
+            case ScriptEngineLinkedExecutionError:
+                ShowMessages("err, ScriptEngineExecute, function = %s\n",
+                             FunctionNames[ErrorSymbol.Value]);
+                g_CurrentExprEvalResultHasError = TRUE;
+                g_CurrentExprEvalResult         = NULL;
+                break;
+
+            case ScriptEngineLinkedExecutionStackOverflow:
+                ShowMessages("err, stack buffer overflow (more information: https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/change-script-engine-limitations)\n");
+                g_CurrentExprEvalResultHasError = TRUE;
+                g_CurrentExprEvalResult         = NULL;
+                break;
+
+            case ScriptEngineLinkedExecutionExecutionCountExceeded:
+                ShowMessages("err, exceeding the max execution count (more information: https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/change-script-engine-limitations)\n");
+                g_CurrentExprEvalResultHasError = TRUE;
+                g_CurrentExprEvalResult         = NULL;
+                break;
+
+            default:
+                break;
+            }
+
+            //
+            // The script is already executed
+            //
+            i = CodeBuffer->Pointer;
+        }
+
+        if (JitCode != NULL)
+        {
+            ScriptEngineJitFree(JitCode);
+        }
+
+        if (LinkedCode != NULL)
+        {
+            free(LinkedCode);
+        }
+#endif
+
         for (; i < CodeBuffer->Pointer;)
         {
             //
@@ -852,6 +1158,9 @@ ScriptEngineWrapperGetPointer(PVOID SymbolBuffer)
 
 /**
  * @brief wrapper for removing symbol buffer
+ * @details Buffers of the cache of the compiled scripts are only released
+ * and freed once they are evicted from the cache and no longer used
+ *
  * @param SymbolBuffer
  *
  * @return UINT32
@@ -859,5 +1168,594 @@ ScriptEngineWrapperGetPointer(PVOID SymbolBuffer)
 VOID
 ScriptEngineWrapperRemoveSymbolBuffer(PVOID SymbolBuffer)
 {
+    SpinlockLock(&g_ScriptCompiledCacheLock);
+
+    auto Item = g_ScriptCompiledCacheBuffers.find(SymbolBuffer);
+
+    if (Item != g_ScriptCompiledCacheBuffers.end())
+    {
+        PSCRIPT_ENGINE_COMPILED_CACHE_ENTRY Entry = Item->second;
+
+        if (Entry->ReferenceCount != 0)
+        {
+            Entry->ReferenceCount--;
+        }
+
+        if (Entry->ReferenceCount == 0 && Entry->IsEvicted)
+        {
+            g_ScriptCompiledCacheBuffers.erase(Item);
+            RemoveSymbolBuffer(Entry->SymbolBuffer);
+            delete Entry;
+        }
+
+        SpinlockUnlock(&g_ScriptCompiledCacheLock);
+        return;
+    }
+
+    SpinlockUnlock(&g_ScriptCompiledCacheLock);
+
     RemoveSymbolBuffer((PSYMBOL_BUFFER)SymbolBuffer);
 }
+
+/**
+ * @brief wrapper for setting the optimization level of the script engine
+ * @param Level 0 (-O0) or 1 (-O1)
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineWrapperSetOptimizationLevel(UINT32 Level)
+{
+    ScriptEngineSetOptimizationLevel(Level);
+}
+
+/**
+ * @brief wrapper for getting the optimization level of the script engine
+ *
+ * @return UINT32
+ */
+UINT32
+ScriptEngineWrapperGetOptimizationLevel()
+{
+    return ScriptEngineGetOptimizationLevel();
+}
+
+/**
+ * @brief Encode the symbols of a script in the compact format to be sent
+ * to the debuggee
+ * @details The caller should free the returned buffer, NULL means that the
+ * symbols should be sent as they are
+ *
+ * @param BufferAddress
+ * @param Pointer
+ * @param CompactBufferSize
+ *
+ * @return PVOID
+ */
+PVOID
+ScriptEngineWrapperEncodeCompactBuffer(UINT64 BufferAddress, UINT32 Pointer, UINT32 * CompactBufferSize)
+{
+    SYMBOL_BUFFER CodeBuffer = {0};
+    PVOID         CompactBuffer;
+    UINT32        MaximumSize;
+
+    //
+    // The debuggee expands the script to a buffer of MaxSerialPacketSize
+    //
+    if (Pointer == 0 || Pointer > MaxSerialPacketSize / sizeof(SYMBOL))
+    {
+        return NULL;
+    }
+
+    CodeBuffer.Head    = (PSYMBOL)BufferAddress;
+    CodeBuffer.Pointer = Pointer;
+    CodeBuffer.Size    = Pointer;
+
+    MaximumSize   = (UINT32)SCRIPT_COMPACT_BUFFER_MAXIMUM_SIZE(Pointer);
+    CompactBuffer = malloc(MaximumSize);
+
+    if (CompactBuffer == NULL)
+    {
+        return NULL;
+    }
+
+    *CompactBufferSize = ScriptEngineEncodeCompactBuffer(&CodeBuffer, CompactBuffer, MaximumSize);
+
+    if (*CompactBufferSize == 0)
+    {
+        free(CompactBuffer);
+        return NULL;
+    }
+
+    return CompactBuffer;
+}
+
+/**
+ * @brief Invalidate the compiled scripts of the cache
+ * @details Should be called whenever the symbols or the types that the
+ * scripts are compiled with are changed
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineWrapperInvalidateCompiledCache()
+{
+    SpinlockLock(&g_ScriptCompiledCacheLock);
+
+    g_ScriptCompiledCacheGeneration++;
+    g_ScriptCompiledCacheStatistics.Invalidations++;
+
+    while (!g_ScriptCompiledCacheLruList.empty())
+    {
+        ScriptEngineWrapperEvictCompiledCacheEntry(g_ScriptCompiledCacheLruList.back());
+    }
+
+    SpinlockUnlock(&g_ScriptCompiledCacheLock);
+}
+
+/**
+ * @brief Remove all the compiled scripts from the cache and reset its statistics
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineWrapperFlushCompiledCache()
+{
+    SpinlockLock(&g_ScriptCompiledCacheLock);
+
+    while (!g_ScriptCompiledCacheLruList.empty())
+    {
+        ScriptEngineWrapperEvictCompiledCacheEntry(g_ScriptCompiledCacheLruList.back());
+    }
+
+    g_ScriptCompiledCacheStatistics = {0};
+
+    SpinlockUnlock(&g_ScriptCompiledCacheLock);
+}
+
+/**
+ * @brief Get the statistics of the cache of the compiled scripts
+ * @param Statistics
+ * @param EntriesCount
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineWrapperGetCompiledCacheStatistics(PSCRIPT_ENGINE_COMPILED_CACHE_STATISTICS Statistics,
+                                              UINT32 *                                 EntriesCount)
+{
+    SpinlockLock(&g_ScriptCompiledCacheLock);
+
+    *Statistics   = g_ScriptCompiledCacheStatistics;
+    *EntriesCount = (UINT32)g_ScriptCompiledCacheLruList.size();
+
+    SpinlockUnlock(&g_ScriptCompiledCacheLock);
+}
+
+/**
+ * @brief Get the id of a deferred format of printf (the format is added
+ * to the deferred formats if it's not already added)
+ *
+ * @param Format
+ * @param FirstArg
+ * @param ArgCount
+ *
+ * @return UINT32 zero if the format can't be deferred
+ */
+static UINT32
+ScriptEngineWrapperGetDeferredFormatId(const CHAR * Format, PSYMBOL FirstArg, UINT32 ArgCount)
+{
+    SCRIPT_ENGINE_DEFERRED_FORMAT DeferredFormat;
+    std::string                   Key;
+    UINT64                        MaximumLength;
+    UINT32                        FormatId;
+
+    if (ArgCount > SCRIPT_DEFERRED_PRINTF_MAXIMUM_ARGUMENTS)
+    {
+        return 0;
+    }
+
+    DeferredFormat.Format = Format;
+    Key                   = DeferredFormat.Format;
+    Key.push_back('\0');
+
+    //
+    // The message should have the same result as formatting it in the debuggee,
+    // so the strings (that are read from the memory of the debuggee), the
+    // floating-point values and the messages that may not fit in a packet
+    // are formatted in the debuggee
+    //
+    MaximumLength = DeferredFormat.Format.length() + 1 +
+                    (UINT64)ArgCount * SCRIPT_ENGINE_DEFERRED_FORMAT_MAXIMUM_INTEGER_LENGTH;
+
+    if (MaximumLength >= PacketChunkSize)
+    {
+        return 0;
+    }
+
+    for (UINT32 i = 0; i < ArgCount; i++)
+    {
+        SYMBOL Argument = FirstArg[i];
+
+        if ((Argument.Type >> SYMBOL_FORMAT_SPECIFIER_KIND_SHIFT) != FORMAT_SPECIFIER_KIND_INTEGER ||
+            Argument.Len != SYMBOL_VALUE_KIND_INTEGER)
+        {
+            return 0;
+        }
+
+        Argument.Value = 0;
+
+        DeferredFormat.Arguments.push_back(Argument);
+        Key.append((const CHAR *)&Argument, sizeof(SYMBOL));
+    }
+
+    SpinlockLock(&g_ScriptDeferredFormatsLock);
+
+    auto Item = g_ScriptDeferredFormatIds.find(Key);
+
+    if (Item != g_ScriptDeferredFormatIds.end())
+    {
+        FormatId = Item->second;
+    }
+    else
+    {
+        g_ScriptDeferredFormats.push_back(DeferredFormat);
+
+        FormatId                       = (UINT32)g_ScriptDeferredFormats.size();
+        g_ScriptDeferredFormatIds[Key] = FormatId;
+    }
+
+    SpinlockUnlock(&g_ScriptDeferredFormatsLock);
+
+    return FormatId;
+}
+
+/**
+ * @brief Assign the ids of the deferred formats to the printf functions
+ * of a script, so the debuggee only sends the values of the arguments
+ * @details The ids are kept in the variable count symbols, so the buffer
+ * should be a copy of the script (the symbol buffers that are returned by
+ * ScriptEngineParseWrapper are shared and should not be modified)
+ *
+ * @param BufferAddress
+ * @param Pointer
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineWrapperAssignDeferredFormats(PVOID BufferAddress, UINT32 Pointer)
+{
+    PSYMBOL Head  = (PSYMBOL)BufferAddress;
+    UINT64  Index = 0;
+
+    //
+    // The same as the linker, each instruction starts with an operator
+    // and the characters of the strings are skipped
+    //
+    while (Index < Pointer)
+    {
+        UINT64 Type = Head[Index].Type & 0x7fffffff;
+
+        if (Head[Index].Type == SYMBOL_SEMANTIC_RULE_TYPE && Head[Index].Value == FUNC_PRINTF &&
+            Index + 1 < Pointer && Head[Index + 1].Type == SYMBOL_STRING_TYPE &&
+            Head[Index + 1].Len != 0 && Head[Index + 1].Len <= (UINT64)(Pointer - Index - 1) * sizeof(SYMBOL))
+        {
+            PSYMBOL Format     = &Head[Index + 1];
+            UINT64  CountIndex = Index + 2 + (SIZE_SYMBOL_WITHOUT_LEN + Format->Len) / sizeof(SYMBOL);
+
+            if (memchr(&Format->Value, '\0', (SIZE_T)Format->Len) != NULL && CountIndex < Pointer &&
+                Head[CountIndex].Type == SYMBOL_VARIABLE_COUNT_TYPE &&
+                Head[CountIndex].Value <= Pointer - CountIndex - 1)
+            {
+                UINT32 FormatId = ScriptEngineWrapperGetDeferredFormatId((const CHAR *)&Format->Value,
+                                                                         &Head[CountIndex + 1],
+                                                                         (UINT32)Head[CountIndex].Value);
+
+                Head[CountIndex].Type |= (UINT64)FormatId << SYMBOL_FORMAT_ID_SHIFT;
+            }
+        }
+
+        if (Type == SYMBOL_STRING_TYPE || Type == SYMBOL_WSTRING_TYPE)
+        {
+            if (Head[Index].Len > (UINT64)Pointer * sizeof(SYMBOL))
+            {
+                break;
+            }
+
+            Index += (SIZE_SYMBOL_WITHOUT_LEN + Head[Index].Len) / sizeof(SYMBOL) + 1;
+        }
+        else
+        {
+            Index++;
+        }
+    }
+}
+
+/**
+ * @brief Format a deferred message of printf that is received from the debuggee
+ *
+ * @param Message
+ * @param MessageLength
+ * @param FinalBuffer
+ * @param SizeOfFinalBuffer
+ *
+ * @return BOOLEAN TRUE if the message is a deferred message (the result,
+ * or an error if the format is not known, is in FinalBuffer)
+ */
+BOOLEAN
+ScriptEngineWrapperFormatDeferredMessage(const CHAR * Message,
+                                         UINT32       MessageLength,
+                                         CHAR *       FinalBuffer,
+                                         UINT32       SizeOfFinalBuffer)
+{
+    SCRIPT_DEFERRED_PRINTF_HEADER Header;
+    UINT32                        CurrentPositionInFinalBuffer              = 0;
+    UINT32                        CurrentProcessedPositionFromStartOfFormat = 0;
+    UINT32                        LenOfFormats;
+    BOOLEAN                       Result = TRUE;
+
+    //
+    // The other messages are strings, so they are never longer than their
+    // first null character
+    //
+    if (MessageLength < sizeof(SCRIPT_DEFERRED_PRINTF_HEADER) ||
+        (MessageLength - sizeof(SCRIPT_DEFERRED_PRINTF_HEADER)) % sizeof(UINT64) != 0)
+    {
+        return FALSE;
+    }
+
+    memcpy(&Header, Message, sizeof(SCRIPT_DEFERRED_PRINTF_HEADER));
+
+    if (Header.Indicator != SCRIPT_DEFERRED_PRINTF_INDICATOR)
+    {
+        return FALSE;
+    }
+
+    memset(FinalBuffer, 0, SizeOfFinalBuffer);
+
+    SpinlockLock(&g_ScriptDeferredFormatsLock);
+
+    if (Header.FormatId == 0 || Header.FormatId > g_ScriptDeferredFormats.size() ||
+        MessageLength != sizeof(SCRIPT_DEFERRED_PRINTF_HEADER) +
+                             g_ScriptDeferredFormats[Header.FormatId - 1].Arguments.size() * sizeof(UINT64))
+    {
+        Result = FALSE;
+    }
+    else
+    {
+        PSCRIPT_ENGINE_DEFERRED_FORMAT DeferredFormat = &g_ScriptDeferredFormats[Header.FormatId - 1];
+
+        LenOfFormats = (UINT32)DeferredFormat->Format.length() + 1;
+
+        for (UINT32 i = 0; i < DeferredFormat->Arguments.size() && Result; i++)
+        {
+            UINT64 Val;
+
+            memcpy(&Val, Message + sizeof(SCRIPT_DEFERRED_PRINTF_HEADER) + i * sizeof(UINT64), sizeof(UINT64));
+
+            Result = ScriptEngineFormatPrintfArgument(DeferredFormat->Format.c_str(),
+                                                      LenOfFormats,
+                                                      &DeferredFormat->Arguments[i],
+                                                      Val,
+                                                      FinalBuffer,
+                                                      &CurrentProcessedPositionFromStartOfFormat,
+                                                      &CurrentPositionInFinalBuffer,
+                                                      SizeOfFinalBuffer);
+        }
+
+        Result = Result && ScriptEngineFormatPrintfRemainder(DeferredFormat->Format.c_str(),
+                                                             LenOfFormats,
+                                                             FinalBuffer,
+                                                             CurrentProcessedPositionFromStartOfFormat,
+                                                             CurrentPositionInFinalBuffer,
+                                                             SizeOfFinalBuffer);
+    }
+
+    SpinlockUnlock(&g_ScriptDeferredFormatsLock);
+
+    if (!Result)
+    {
+        snprintf(FinalBuffer, SizeOfFinalBuffer, "err, unable to format the deferred message (format id: %x)\n", Header.FormatId);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Consume a binary record of the emit function that is received
+ * from the debuggee
+ * @details The record is sent as a length-prefixed frame (a 32-bit length
+ * followed by the record) to the output sources of the event, or written
+ * to the file of the '.emit' command, otherwise it's formatted as a text
+ *
+ * @param OperationCode The tag of the event
+ * @param Message
+ * @param MessageLength
+ * @param FinalBuffer The text that should be shown (empty if the record is
+ * already delivered)
+ * @param SizeOfFinalBuffer
+ *
+ * @return BOOLEAN TRUE if the message is a record of the emit function
+ */
+BOOLEAN
+ScriptEngineWrapperConsumeEmitRecord(UINT32       OperationCode,
+                                     const CHAR * Message,
+                                     UINT32       MessageLength,
+                                     CHAR *       FinalBuffer,
+                                     UINT32       SizeOfFinalBuffer)
+{
+    SCRIPT_EMIT_RECORD_HEADER Header;
+    CHAR                      Frame[sizeof(UINT32) + sizeof(SCRIPT_EMIT_RECORD_HEADER) + SCRIPT_EMIT_RECORD_MAXIMUM_ARGUMENTS * sizeof(UINT64)];
+    UINT32                    FrameLength;
+    UINT32                    CurrentPositionInFinalBuffer;
+    BOOLEAN                   WrittenToFile = FALSE;
+
+    if (MessageLength < sizeof(SCRIPT_EMIT_RECORD_HEADER))
+    {
+        return FALSE;
+    }
+
+    memcpy(&Header, Message, sizeof(SCRIPT_EMIT_RECORD_HEADER));
+
+    if (Header.Indicator != 0 || Header.Signature != SCRIPT_EMIT_RECORD_SIGNATURE)
+    {
+        return FALSE;
+    }
+
+    memset(FinalBuffer, 0, SizeOfFinalBuffer);
+
+    if (Header.ArgCount > SCRIPT_EMIT_RECORD_MAXIMUM_ARGUMENTS ||
+        MessageLength != sizeof(SCRIPT_EMIT_RECORD_HEADER) + Header.ArgCount * sizeof(UINT64))
+    {
+        snprintf(FinalBuffer, SizeOfFinalBuffer, "err, invalid emit record (length: %x)\n", MessageLength);
+        return TRUE;
+    }
+
+    FrameLength = sizeof(UINT32) + MessageLength;
+
+    memcpy(Frame, &MessageLength, sizeof(UINT32));
+    memcpy(Frame + sizeof(UINT32), Message, MessageLength);
+
+    //
+    // The output sources of the event take the frames
+    //
+    if (g_OutputSourcesInitialized && ForwardingCheckAndPerformEventForwarding(OperationCode, Frame, FrameLength))
+    {
+        return TRUE;
+    }
+
+    SpinlockLock(&g_ScriptEmitFileLock);
+
+    if (g_ScriptEmitFile.is_open())
+    {
+        g_ScriptEmitFile.write(Frame, FrameLength);
+        g_ScriptEmitFileRecordsCount++;
+
+        WrittenToFile = TRUE;
+    }
+
+    SpinlockUnlock(&g_ScriptEmitFileLock);
+
+    if (WrittenToFile)
+    {
+        return TRUE;
+    }
+
+    //
+    // Nobody takes the record, so it's shown as a text
+    //
+    CurrentPositionInFinalBuffer = snprintf(FinalBuffer,
+                                            SizeOfFinalBuffer,
+                                            "emit (tag: %llx, tsc: %llx, core: %x) :",
+                                            Header.Tag,
+                                            Header.Tsc,
+                                            Header.Core);
+
+    for (UINT32 i = 0; i < Header.ArgCount && CurrentPositionInFinalBuffer < SizeOfFinalBuffer; i++)
+    {
+        UINT64 Val;
+
+        memcpy(&Val, Message + sizeof(SCRIPT_EMIT_RECORD_HEADER) + i * sizeof(UINT64), sizeof(UINT64));
+
+        CurrentPositionInFinalBuffer += snprintf(FinalBuffer + CurrentPositionInFinalBuffer,
+                                                 SizeOfFinalBuffer - CurrentPositionInFinalBuffer,
+                                                 " %llx",
+                                                 Val);
+    }
+
+    if (CurrentPositionInFinalBuffer < SizeOfFinalBuffer)
+    {
+        snprintf(FinalBuffer + CurrentPositionInFinalBuffer, SizeOfFinalBuffer - CurrentPositionInFinalBuffer, "\n");
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Open the file that the records of the emit function are written to
+ *
+ * @param FilePath
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ScriptEngineWrapperOpenEmitFile(const string & FilePath)
+{
+    BOOLEAN Result;
+
+    SpinlockLock(&g_ScriptEmitFileLock);
+
+    if (g_ScriptEmitFile.is_open())
+    {
+        g_ScriptEmitFile.close();
+    }
+
+    g_ScriptEmitFile.open(FilePath.c_str(), ios::out | ios::binary | ios::trunc);
+
+    Result                       = g_ScriptEmitFile.is_open();
+    g_ScriptEmitFilePath         = Result ? FilePath : "";
+    g_ScriptEmitFileRecordsCount = 0;
+
+    SpinlockUnlock(&g_ScriptEmitFileLock);
+
+    return Result;
+}
+
+/**
+ * @brief Close the file of the records of the emit function
+ *
+ * @param RecordsCount Number of the records that are written to the file
+ *
+ * @return BOOLEAN FALSE if there was no opened file
+ */
+BOOLEAN
+ScriptEngineWrapperCloseEmitFile(UINT64 * RecordsCount)
+{
+    BOOLEAN Result = FALSE;
+
+    SpinlockLock(&g_ScriptEmitFileLock);
+
+    if (g_ScriptEmitFile.is_open())
+    {
+        g_ScriptEmitFile.close();
+
+        *RecordsCount = g_ScriptEmitFileRecordsCount;
+        Result        = TRUE;
+    }
+
+    g_ScriptEmitFilePath.clear();
+    g_ScriptEmitFileRecordsCount = 0;
+
+    SpinlockUnlock(&g_ScriptEmitFileLock);
+
+    return Result;
+}
+
+/**
+ * @brief Get the status of the file of the records of the emit function
+ *
+ * @param FilePath
+ * @param RecordsCount
+ *
+ * @return BOOLEAN FALSE if there is no opened file
+ */
+BOOLEAN
+ScriptEngineWrapperGetEmitFileStatus(string & FilePath, UINT64 * RecordsCount)
+{
+    BOOLEAN Result = FALSE;
+
+    SpinlockLock(&g_ScriptEmitFileLock);
+
+    if (g_ScriptEmitFile.is_open())
+    {
+        g_ScriptEmitFile.flush();
+
+        FilePath      = g_ScriptEmitFilePath;
+        *RecordsCount = g_ScriptEmitFileRecordsCount;
+        Result        = TRUE;
+    }
+
+    SpinlockUnlock(&g_ScriptEmitFileLock);
+
+    return Result;
+}
@@ -0,0 +1,348 @@
+/**
+ * @file symbol-index.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Sorted address index of the symbols
+ * @details The objects of the loaded symbols are delivered (module by module)
+ * by the script engine, sorted once, and then the addresses of 'u', 'k',
+ * '!pt' and the other commands are resolved by binary searches on the index
+ * (without calling the symbol parser)
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern BOOLEAN      g_AddressConversion;
+extern SYMBOL_INDEX g_SymbolIndex;
+
+/**
+ * @brief Remove all of the objects of the index
+ *
+ * @param Index
+ *
+ * @return VOID
+ */
+VOID
+SymbolIndexClear(PSYMBOL_INDEX Index)
+{
+    //
+    // The memory of the vectors is released (the index of the kernel has
+    // hundreds of thousands of objects)
+    //
+    std::vector<SYMBOL_INDEX_MODULE>().swap(Index->Modules);
+    std::vector<SYMBOL_INDEX_ENTRY>().swap(Index->Entries);
+    std::vector<CHAR>().swap(Index->Names);
+    std::vector<SYMBOL_INDEX_PENDING_OBJECT>().swap(Index->PendingObjects);
+
+    Index->LastModuleName.clear();
+    Index->LastModuleId = 0;
+}
+
+/**
+ * @brief Add an object to the index
+ * @details The object is not found by SymbolIndexLookup until the index
+ * is built by SymbolIndexBuild
+ *
+ * @param Index
+ * @param Address
+ * @param ModuleName
+ * @param ObjectName
+ * @param ObjectSize
+ *
+ * @return VOID
+ */
+VOID
+SymbolIndexAddObject(PSYMBOL_INDEX Index,
+                     UINT64        Address,
+                     const CHAR *  ModuleName,
+                     const CHAR *  ObjectName,
+                     UINT32        ObjectSize)
+{
+    SYMBOL_INDEX_PENDING_OBJECT Object = {};
+
+    if (ObjectSize == 0)
+    {
+        ObjectSize = DISASSEMBLY_MAXIMUM_DISTANCE_FROM_OBJECT_NAME;
+    }
+
+    //
+    // The objects of a module are delivered together, so a new module is
+    // started when the name of the module is changed
+    //
+    if (ModuleName == NULL)
+    {
+        ModuleName = "";
+    }
+
+    if (Index->PendingObjects.empty() || Index->LastModuleName != ModuleName)
+    {
+        Index->LastModuleName = ModuleName;
+        Index->LastModuleId++;
+    }
+
+    Object.Address    = Address;
+    Object.Size       = ObjectSize;
+    Object.NameOffset = (UINT32)Index->Names.size();
+    Object.ModuleId   = Index->LastModuleId;
+
+    //
+    // The name is saved as "module!object"
+    //
+    if (ModuleName[0] != '\0')
+    {
+        Index->Names.insert(Index->Names.end(), ModuleName, ModuleName + strlen(ModuleName));
+        Index->Names.push_back('!');
+    }
+
+    if (ObjectName != NULL)
+    {
+        Index->Names.insert(Index->Names.end(), ObjectName, ObjectName + strlen(ObjectName));
+    }
+
+    Index->Names.push_back('\0');
+
+    Index->PendingObjects.push_back(Object);
+}
+
+/**
+ * @brief Sort the objects that are added to the index
+ * @details The objects of the previous build are replaced, and if more than
+ * one object has the same address, the last one is used (the same as the
+ * previous map of the disassembler)
+ *
+ * @param Index
+ *
+ * @return VOID
+ */
+VOID
+SymbolIndexBuild(PSYMBOL_INDEX Index)
+{
+    std::vector<SYMBOL_INDEX_PENDING_OBJECT> & Objects  = Index->PendingObjects;
+    UINT32                                     ModuleId = 0;
+
+    std::stable_sort(Objects.begin(),
+                     Objects.end(),
+                     [](const SYMBOL_INDEX_PENDING_OBJECT & First, const SYMBOL_INDEX_PENDING_OBJECT & Second) {
+                         return First.Address < Second.Address;
+                     });
+
+    Index->Modules.clear();
+    Index->Entries.clear();
+    Index->Entries.reserve(Objects.size());
+
+    for (SIZE_T i = 0; i < Objects.size(); i++)
+    {
+        const SYMBOL_INDEX_PENDING_OBJECT & Object = Objects[i];
+        SYMBOL_INDEX_ENTRY                  Entry;
+
+        if (i + 1 < Objects.size() && Objects[i + 1].Address == Object.Address)
+        {
+            continue;
+        }
+
+        //
+        // A new range is started for each module, and if the objects of a
+        // module are too far from its base address
+        //
+        if (Index->Modules.empty() || ModuleId != Object.ModuleId ||
+            Object.Address - Index->Modules.back().BaseAddress > UINT32_MAX)
+        {
+            SYMBOL_INDEX_MODULE Module;
+
+            Module.BaseAddress  = Object.Address;
+            Module.FirstEntry   = (UINT32)Index->Entries.size();
+            Module.EntriesCount = 0;
+
+            Index->Modules.push_back(Module);
+            ModuleId = Object.ModuleId;
+        }
+
+        Entry.Rva        = (UINT32)(Object.Address - Index->Modules.back().BaseAddress);
+        Entry.Size       = Object.Size;
+        Entry.NameOffset = Object.NameOffset;
+
+        Index->Entries.push_back(Entry);
+        Index->Modules.back().EntriesCount++;
+    }
+
+    std::vector<SYMBOL_INDEX_PENDING_OBJECT>().swap(Index->PendingObjects);
+    Index->LastModuleName.clear();
+}
+
+/**
+ * @brief Find the object of an address
+ * @details The object with the highest address that is not above the address
+ * is found; the binary searches are branchless (the comparisons are compiled
+ * to conditional moves), so the random addresses of the callstacks and the
+ * traces are not slowed down by the mispredicted branches
+ *
+ * @param Index
+ * @param Address
+ * @param Object
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymbolIndexLookup(const SYMBOL_INDEX * Index, UINT64 Address, PSYMBOL_INDEX_OBJECT Object)
+{
+    const SYMBOL_INDEX_MODULE * Module;
+    const SYMBOL_INDEX_ENTRY *  Entry;
+    SIZE_T                      Count;
+    UINT64                      Distance;
+    UINT32                      Rva;
+
+    if (Index->Modules.empty())
+    {
+        return FALSE;
+    }
+
+    //
+    // Find the module
+    //
+    Module = Index->Modules.data();
+    Count  = Index->Modules.size();
+
+    while (Count > 1)
+    {
+        SIZE_T Half = Count / 2;
+
+        Module = (Module[Half].BaseAddress <= Address) ? Module + Half : Module;
+        Count -= Half;
+    }
+
+    if (Module->BaseAddress > Address)
+    {
+        return FALSE;
+    }
+
+    //
+    // Find the object in the module (the addresses that are after the
+    // module are resolved to its last object)
+    //
+    Distance = Address - Module->BaseAddress;
+    Rva      = Distance > UINT32_MAX ? UINT32_MAX : (UINT32)Distance;
+    Entry    = Index->Entries.data() + Module->FirstEntry;
+    Count    = Module->EntriesCount;
+
+    while (Count > 1)
+    {
+        SIZE_T Half = Count / 2;
+
+        Entry = (Entry[Half].Rva <= Rva) ? Entry + Half : Entry;
+        Count -= Half;
+    }
+
+    Object->Address = Module->BaseAddress + Entry->Rva;
+    Object->Size    = Entry->Size;
+    Object->Name    = Index->Names.data() + Entry->NameOffset;
+
+    return TRUE;
+}
+
+/**
+ * @brief Callback for creating symbol map for disassembler
+ *
+ * @param Address
+ * @param ModuleName
+ * @param ObjectName
+ * @param ObjectSize
+ *
+ * @return VOID
+ */
+VOID
+SymbolCreateDisassemblerMapCallback(UINT64 Address,
+                                    CHAR * ModuleName,
+                                    CHAR * ObjectName,
+                                    UINT32 ObjectSize)
+{
+    SymbolIndexAddObject(&g_SymbolIndex, Address, ModuleName, ObjectName, ObjectSize);
+}
+
+/**
+ * @brief Update (or create) symbol map for the disassembler
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymbolCreateDisassemblerSymbolMap()
+{
+    //
+    // Clear the map table
+    //
+    SymbolIndexClear(&g_SymbolIndex);
+
+    //
+    // Get all the symbols in the callback
+    //
+    ScriptEngineCreateSymbolTableForDisassemblerWrapper((PVOID)SymbolCreateDisassemblerMapCallback);
+
+    SymbolIndexBuild(&g_SymbolIndex);
+
+    return TRUE;
+}
+
+/**
+ * @brief shows the functions' name for the disassembler
+ * @param Address
+ * @param UsedBaseAddress
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymbolShowFunctionNameBasedOnAddress(UINT64 Address, PUINT64 UsedBaseAddress)
+{
+    SYMBOL_INDEX_OBJECT Object;
+    UINT64              Diff;
+
+    //
+    // Check if showing function (object) names is not prohibited
+    // form settings command
+    //
+    if (!g_AddressConversion)
+    {
+        return FALSE;
+    }
+
+    if (!SymbolIndexLookup(&g_SymbolIndex, Address, &Object))
+    {
+        return FALSE;
+    }
+
+    if (*UsedBaseAddress == Object.Address)
+    {
+        return FALSE;
+    }
+
+    Diff = Address - Object.Address;
+
+    if (Diff == 0)
+    {
+        ShowMessages("%s", Object.Name);
+    }
+    else if (Object.Size >= Diff)
+    {
+        ShowMessages("%s+0x%llx", Object.Name, Diff);
+    }
+    else if (DISASSEMBLY_MAXIMUM_DISTANCE_FROM_OBJECT_NAME >= Diff)
+    {
+        //
+        // We add the logic of adding Name+X+X to show that a address is x bytes
+        // after the Object Name and not within the size of the function but x
+        // bytes from the above of the function
+        //
+        ShowMessages("%s+0x%llx+0x%llx", Object.Name, Diff, Diff - Object.Size);
+    }
+    else
+    {
+        return FALSE;
+    }
+
+    *UsedBaseAddress = Object.Address;
+
+    return TRUE;
+}
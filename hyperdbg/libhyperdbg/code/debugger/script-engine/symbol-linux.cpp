@@ -1,14 +1,15 @@
 /**
  * @file symbol-linux.cpp
  * @author Max Raulea (max.raulea@hyperdbg.org)
- * @brief Linux stub implementations of the symbol subsystem
+ * @brief Linux implementations of the symbol subsystem
  * @details The Windows implementation uses DbgHelp + PDB files (symbol-parser/).
- *          Linux uses ELF/DWARF which requires a separate implementation.
- *          These stubs allow the library to compile and link on Linux while
- *          keeping all call sites intact.
- *
- *          TODO: implement a real ELF/DWARF symbol parser for Linux
- *                (libdw / libelf / libbfd) and replace these stubs.
+ *          Linux uses the ELF (DWARF) and the PDB readers of the script
+ *          engine for the symbols of the files that are loaded by '.sym add',
+ *          and the symbol index of the disassembler is created from them
+ *          (symbol-index.cpp).
+ *          The symbol table of the modules of the debuggee (.sym reload)
+ *          is not supported yet; these stubs allow the library to compile
+ *          and link on Linux while keeping all call sites intact.
  *
  * @version 0.1
  * @date 2026-06-08
@@ -26,12 +27,6 @@ SymbolBuildAndShowSymbolTable()
     ShowMessages("err, symbol table is not supported on Linux yet\n");
 }
 
-BOOLEAN
-SymbolShowFunctionNameBasedOnAddress(UINT64 Address, PUINT64 UsedBaseAddress)
-{
-    return FALSE;
-}
-
 BOOLEAN
 SymbolLoadOrDownloadSymbols(BOOLEAN IsDownload, BOOLEAN SilentLoad)
 {
@@ -43,13 +38,17 @@ SymbolLoadOrDownloadSymbols(BOOLEAN IsDownload, BOOLEAN SilentLoad)
 /**
  * @brief Attempt to resolve a name or expression to an address.
  *
- * On Linux, full symbol resolution (ELF/DWARF) is not yet implemented.
- * This stub handles the common case of a plain hex/decimal literal so that
- * numeric addresses still work everywhere in the debugger.
+ * On Linux, expressions are not evaluated yet. This handles the plain
+ * hex/decimal literals so that numeric addresses still work everywhere in
+ * the debugger, and the names of the symbols of the PDB files that are
+ * loaded by '.sym add' (resolved by the PDB reader of the script engine).
  */
 BOOLEAN
 SymbolConvertNameOrExprToAddress(const string & TextToConvert, PUINT64 Result)
 {
+    BOOLEAN IsFound = FALSE;
+    UINT64  Address = NULL64_ZERO;
+
     try
     {
         *Result = std::stoull(TextToConvert, nullptr, 0);
@@ -57,8 +56,19 @@ SymbolConvertNameOrExprToAddress(const string & TextToConvert, PUINT64 Result)
     }
     catch (...)
     {
-        return FALSE;
     }
+
+    //
+    // Check for symbol object names
+    //
+    Address = ScriptEngineConvertNameToAddressWrapper(TextToConvert.c_str(), &IsFound);
+
+    if (IsFound)
+    {
+        *Result = Address;
+    }
+
+    return IsFound;
 }
 
 BOOLEAN
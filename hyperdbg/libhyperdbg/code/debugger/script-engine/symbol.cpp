@@ -15,12 +15,10 @@
 //
 // Global Variables
 //
-extern PMODULE_SYMBOL_DETAIL                        g_SymbolTable;
-extern UINT32                                       g_SymbolTableSize;
-extern UINT32                                       g_SymbolTableCurrentIndex;
-extern BOOLEAN                                      g_IsExecutingSymbolLoadingRoutines;
-extern BOOLEAN                                      g_AddressConversion;
-extern std::map<UINT64, LOCAL_FUNCTION_DESCRIPTION> g_DisassemblerSymbolMap;
+extern PMODULE_SYMBOL_DETAIL g_SymbolTable;
+extern UINT32                g_SymbolTableSize;
+extern UINT32                g_SymbolTableCurrentIndex;
+extern BOOLEAN               g_IsExecutingSymbolLoadingRoutines;
 
 using namespace std;
 
@@ -74,184 +72,6 @@ SymbolPrepareDebuggerWithSymbolInfo(UINT32 UserProcessId)
     SymbolBuildSymbolTable(&g_SymbolTable, &g_SymbolTableSize, UserProcessId, TRUE);
 }
 
-/**
- * @brief Callback for creating symbol map for disassembler
- *
- * @param Address
- * @param ModuleName
- * @param ObjectName
- * @param ObjectSize
- *
- * @return VOID
- */
-VOID
-SymbolCreateDisassemblerMapCallback(UINT64 Address,
-                                    CHAR * ModuleName,
-                                    CHAR * ObjectName,
-                                    UINT32 ObjectSize)
-{
-    //
-    // It has a string, should not be initialized with zero
-    //
-    LOCAL_FUNCTION_DESCRIPTION LocalFunctionDescription = {};
-    string                     FinalModuleName          = "";
-
-    if (ObjectSize == 0)
-    {
-        ObjectSize = DISASSEMBLY_MAXIMUM_DISTANCE_FROM_OBJECT_NAME;
-    }
-
-    //
-    // Convert module name to string
-    //
-    if (ModuleName != NULL)
-    {
-        FinalModuleName += std::string(ModuleName) + "!";
-    }
-
-    //
-    // Convert object name to string
-    //
-    if (ObjectName != NULL)
-    {
-        FinalModuleName += std::string(ObjectName);
-    }
-
-    //
-    // Create the structure
-    //
-    LocalFunctionDescription.ObjectName = std::move(FinalModuleName);
-    LocalFunctionDescription.ObjectSize = ObjectSize;
-
-    //
-    // Add to disassembler map
-    //
-    g_DisassemblerSymbolMap[Address] = LocalFunctionDescription;
-}
-
-/**
- * @brief Update (or create) symbol map for the disassembler
- *
- * @return BOOLEAN
- */
-BOOLEAN
-SymbolCreateDisassemblerSymbolMap()
-{
-    //
-    // Clear the map table
-    //
-    g_DisassemblerSymbolMap.clear();
-
-    //
-    // Get all the symbols in the callback
-    //
-    ScriptEngineCreateSymbolTableForDisassemblerWrapper(SymbolCreateDisassemblerMapCallback);
-
-    return TRUE;
-}
-
-/**
- * @brief shows the functions' name for the disassembler
- * @param Address
- * @param UsedBaseAddress
- *
- * @return BOOLEAN
- */
-BOOLEAN
-SymbolShowFunctionNameBasedOnAddress(UINT64 Address, PUINT64 UsedBaseAddress)
-{
-    std::map<UINT64, LOCAL_FUNCTION_DESCRIPTION>::iterator Low, Prev;
-    UINT64                                                 Pos = Address;
-
-    //
-    // Check if showing function (object) names is not prohibited
-    // form settings command
-    //
-    if (!g_AddressConversion)
-    {
-        return FALSE;
-    }
-
-    //
-    // Check if we already built the symbol map for disassembler or not
-    //
-    if (!g_DisassemblerSymbolMap.empty())
-    {
-        Low = g_DisassemblerSymbolMap.lower_bound(Pos);
-
-        if (Low == g_DisassemblerSymbolMap.end())
-        {
-            //
-            // Nothing found, maybe use rbegin()
-            //
-            return FALSE;
-        }
-        else if (Low == g_DisassemblerSymbolMap.begin() && Low->first > Address)
-        {
-            //
-            // Nothing to do, address is below the lowest entry in symbol table
-            //
-            return FALSE;
-        }
-        else if (Low->first == Address)
-        {
-            if (*UsedBaseAddress != Address)
-            {
-                ShowMessages("%s", Low->second.ObjectName.c_str());
-                *UsedBaseAddress = Address;
-                return TRUE;
-            }
-
-            return FALSE;
-        }
-        else
-        {
-            Prev        = std::prev(Low);
-            UINT64 Diff = Address - Prev->first;
-
-            //
-            // Check, so we have a threshold boundary to add +xx to the
-            // symbols function name, in otherwords, the maximum number of
-            // bytes that a function could contain (it's definitely not the
-            // best option to find start and end of function, it's an approximate
-            // and not always might be true)
-            //
-            if (Prev->second.ObjectSize >= Diff)
-            {
-                if (*UsedBaseAddress != Prev->first)
-                {
-                    ShowMessages("%s+0x%x", Prev->second.ObjectName.c_str(), Diff);
-                    *UsedBaseAddress = Prev->first;
-                    return TRUE;
-                }
-
-                return FALSE;
-            }
-            else if (DISASSEMBLY_MAXIMUM_DISTANCE_FROM_OBJECT_NAME >= Diff)
-            {
-                //
-                // We add the logic of adding Name+X+X to show that a address is x bytes
-                // after the Object Name and not within the size of the function but x
-                // bytes from the above of the function
-                //
-                if (*UsedBaseAddress != Prev->first)
-                {
-                    ShowMessages("%s+0x%x+0x%x", Prev->second.ObjectName.c_str(), Diff, Diff - Prev->second.ObjectSize);
-                    *UsedBaseAddress = Prev->first;
-                    return TRUE;
-                }
-
-                return FALSE;
-            }
-        }
-    }
-
-    //
-    // Nothing is showed
-    //
-    return FALSE;
-}
-
 /**
  * @brief Build and show symbol table details
  * @param BuildLocalSymTable Should this function call to build local symbol
@@ -127,6 +127,11 @@ HwdbgInterpretPacket(PVOID BufferReceived, UINT32 LengthReceived)
             //
             ScriptEngineSetHwdbgInstanceInfo(&g_HwdbgInstanceInfo);
 
+            //
+            // Registers of the scripts are interpreted based on the instance info
+            //
+            ScriptEngineWrapperInvalidateCompiledCache();
+
             break;
 
         default:
@@ -301,6 +301,15 @@ typedef std::map<std::string, COMMAND_DETAIL> CommandType;
 #define DEBUGGER_COMMAND_FLUSH_ATTRIBUTES \
     DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
 
+#define DEBUGGER_COMMAND_AGG_ATTRIBUTES \
+    DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
+
+#define DEBUGGER_COMMAND_PERCPU_ATTRIBUTES \
+    DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
+
+#define DEBUGGER_COMMAND_PROFILE_ATTRIBUTES \
+    DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
+
 #define DEBUGGER_COMMAND_USER_CPUID_ATTRIBUTES \
     DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
 
@@ -438,6 +447,12 @@ typedef std::map<std::string, COMMAND_DETAIL> CommandType;
 #define DEBUGGER_COMMAND_SYM_ATTRIBUTES \
     DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
 
+#define DEBUGGER_COMMAND_SCRIPTCACHE_ATTRIBUTES \
+    DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
+
+#define DEBUGGER_COMMAND_EMIT_ATTRIBUTES \
+    DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
+
 #define DEBUGGER_COMMAND_X_ATTRIBUTES \
     DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
 
@@ -647,6 +662,15 @@ CommandSettings(vector<CommandToken> CommandTokens, string Command);
 VOID
 CommandFlush(vector<CommandToken> CommandTokens, string Command);
 
+VOID
+CommandAgg(vector<CommandToken> CommandTokens, string Command);
+
+VOID
+CommandPercpu(vector<CommandToken> CommandTokens, string Command);
+
+VOID
+CommandProfile(vector<CommandToken> CommandTokens, string Command);
+
 VOID
 CommandUserCpuid(vector<CommandToken> CommandTokens, string Command);
 
@@ -731,6 +755,12 @@ CommandSympath(vector<CommandToken> CommandTokens, string Command);
 VOID
 CommandSym(vector<CommandToken> CommandTokens, string Command);
 
+VOID
+CommandScriptcache(vector<CommandToken> CommandTokens, string Command);
+
+VOID
+CommandEmit(vector<CommandToken> CommandTokens, string Command);
+
 VOID
 CommandX(vector<CommandToken> CommandTokens, string Command);
 
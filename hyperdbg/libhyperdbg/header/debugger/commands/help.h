@@ -171,6 +171,15 @@ CommandSettingsHelp();
 VOID
 CommandFlushHelp();
 
+VOID
+CommandAggHelp();
+
+VOID
+CommandPercpuHelp();
+
+VOID
+CommandProfileHelp();
+
 VOID
 CommandUserCpuidHelp();
 
@@ -261,6 +270,12 @@ CommandSympathHelp();
 VOID
 CommandSymHelp();
 
+VOID
+CommandScriptcacheHelp();
+
+VOID
+CommandEmitHelp();
+
 VOID
 CommandXHelp();
 
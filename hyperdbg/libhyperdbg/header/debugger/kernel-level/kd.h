@@ -177,6 +177,15 @@ KdSendApicActionPacketsToDebuggee(PDEBUGGER_APIC_REQUEST ApicRequest, UINT32 Exp
 BOOLEAN
 KdSendSmiPacketsToDebuggee(PSMI_OPERATION_PACKETS SmiOperationRequest, UINT32 ExpectedRequestSize);
 
+BOOLEAN
+KdSendScriptEngineAggregationPacketsToDebuggee(PSCRIPT_ENGINE_AGGREGATION_PACKETS AggregationRequest);
+
+BOOLEAN
+KdSendScriptEnginePercpuVariablePacketsToDebuggee(PSCRIPT_ENGINE_PERCPU_VARIABLE_PACKETS PercpuVariableRequest);
+
+BOOLEAN
+KdSendScriptEngineProfilePacketsToDebuggee(PSCRIPT_ENGINE_PROFILE_PACKETS ProfileRequest);
+
 BOOLEAN
 KdSendHyperTraceLbrdumpPacketsToDebuggee(PHYPERTRACE_LBR_DUMP_PACKETS HyperTraceLbrdumpRequest, UINT32 ExpectedRequestSize);
 
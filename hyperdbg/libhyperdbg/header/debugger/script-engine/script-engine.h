@@ -11,6 +11,74 @@
  */
 #pragma once
 
+//////////////////////////////////////////////////
+//			        Definitions		            //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum number of compiled scripts that are kept in the cache
+ *
+ */
+#define SCRIPT_ENGINE_COMPILED_CACHE_MAXIMUM_ENTRIES 64
+
+/**
+ * @brief Maximum length of the text of an integer format specifier of printf
+ * (the size of the temporary buffer of ApplyFormatSpecifier)
+ *
+ */
+#define SCRIPT_ENGINE_DEFERRED_FORMAT_MAXIMUM_INTEGER_LENGTH 50
+
+//////////////////////////////////////////////////
+//			        Structures		            //
+//////////////////////////////////////////////////
+
+/**
+ * @brief An entry of the cache of the compiled scripts
+ *
+ * @details The symbol buffer of an entry is shared between all the callers
+ * of ScriptEngineParseWrapper that compiled the same script, so it should
+ * not be modified; each of them releases its reference by calling
+ * ScriptEngineWrapperRemoveSymbolBuffer
+ *
+ */
+typedef struct _SCRIPT_ENGINE_COMPILED_CACHE_ENTRY
+{
+    UINT64         Hash;
+    std::string    Script;
+    PSYMBOL_BUFFER SymbolBuffer;
+    UINT32         ReferenceCount;
+    BOOLEAN        IsEvicted; // removed from the cache, but still referenced
+
+} SCRIPT_ENGINE_COMPILED_CACHE_ENTRY, *PSCRIPT_ENGINE_COMPILED_CACHE_ENTRY;
+
+/**
+ * @brief Statistics of the cache of the compiled scripts
+ *
+ */
+typedef struct _SCRIPT_ENGINE_COMPILED_CACHE_STATISTICS
+{
+    UINT64 Hits;
+    UINT64 Misses;
+    UINT64 Evictions;
+    UINT64 Invalidations;
+
+} SCRIPT_ENGINE_COMPILED_CACHE_STATISTICS, *PSCRIPT_ENGINE_COMPILED_CACHE_STATISTICS;
+
+/**
+ * @brief A format of printf that is formatted by the debugger (deferred),
+ * the id of the format is its index in the list of the formats plus one
+ *
+ * @details The arguments keep the descriptors of the format specifiers and
+ * the kinds of the values (their values are not used)
+ *
+ */
+typedef struct _SCRIPT_ENGINE_DEFERRED_FORMAT
+{
+    std::string         Format;
+    std::vector<SYMBOL> Arguments;
+
+} SCRIPT_ENGINE_DEFERRED_FORMAT, *PSCRIPT_ENGINE_DEFERRED_FORMAT;
+
 //////////////////////////////////////////////////
 //    Pdb Parser Wrapper (from script-engine)   //
 //////////////////////////////////////////////////
@@ -107,6 +175,50 @@ ScriptEngineWrapperGetPointer(PVOID SymbolBuffer);
 VOID
 ScriptEngineWrapperRemoveSymbolBuffer(PVOID SymbolBuffer);
 
+VOID
+ScriptEngineWrapperSetOptimizationLevel(UINT32 Level);
+
+UINT32
+ScriptEngineWrapperGetOptimizationLevel();
+
+PVOID
+ScriptEngineWrapperEncodeCompactBuffer(UINT64 BufferAddress, UINT32 Pointer, UINT32 * CompactBufferSize);
+
+VOID
+ScriptEngineWrapperInvalidateCompiledCache();
+
+VOID
+ScriptEngineWrapperFlushCompiledCache();
+
+VOID
+ScriptEngineWrapperGetCompiledCacheStatistics(PSCRIPT_ENGINE_COMPILED_CACHE_STATISTICS Statistics,
+                                              UINT32 *                                 EntriesCount);
+
+VOID
+ScriptEngineWrapperAssignDeferredFormats(PVOID BufferAddress, UINT32 Pointer);
+
+BOOLEAN
+ScriptEngineWrapperFormatDeferredMessage(const CHAR * Message,
+                                         UINT32       MessageLength,
+                                         CHAR *       FinalBuffer,
+                                         UINT32       SizeOfFinalBuffer);
+
+BOOLEAN
+ScriptEngineWrapperConsumeEmitRecord(UINT32       OperationCode,
+                                     const CHAR * Message,
+                                     UINT32       MessageLength,
+                                     CHAR *       FinalBuffer,
+                                     UINT32       SizeOfFinalBuffer);
+
+BOOLEAN
+ScriptEngineWrapperOpenEmitFile(const string & FilePath);
+
+BOOLEAN
+ScriptEngineWrapperCloseEmitFile(UINT64 * RecordsCount);
+
+BOOLEAN
+ScriptEngineWrapperGetEmitFileStatus(string & FilePath, UINT64 * RecordsCount);
+
 UINT64
 ScriptEngineEvalUInt64StyleExpressionWrapper(const string & Expr, PBOOLEAN HasError);
 
@@ -0,0 +1,110 @@
+/**
+ * @file symbol-index.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Sorted address index of the symbols (headers)
+ * @details
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//			        Structures		            //
+//////////////////////////////////////////////////
+
+/**
+ * @brief An object (function or variable) of the index
+ * @details The address of the object is relative to the base address of
+ * its module, and its name ("module!object") is in the names of the index
+ *
+ */
+typedef struct _SYMBOL_INDEX_ENTRY
+{
+    UINT32 Rva;
+    UINT32 Size;
+    UINT32 NameOffset;
+
+} SYMBOL_INDEX_ENTRY, *PSYMBOL_INDEX_ENTRY;
+
+/**
+ * @brief A module of the index
+ * @details The objects of a module are sorted by their addresses, and the
+ * modules (that are larger than 4 GB) are split into more than one range
+ *
+ */
+typedef struct _SYMBOL_INDEX_MODULE
+{
+    UINT64 BaseAddress;
+    UINT32 FirstEntry;
+    UINT32 EntriesCount;
+
+} SYMBOL_INDEX_MODULE, *PSYMBOL_INDEX_MODULE;
+
+/**
+ * @brief An object that is added to the index before it's built
+ *
+ */
+typedef struct _SYMBOL_INDEX_PENDING_OBJECT
+{
+    UINT64 Address;
+    UINT32 Size;
+    UINT32 NameOffset;
+    UINT32 ModuleId;
+
+} SYMBOL_INDEX_PENDING_OBJECT, *PSYMBOL_INDEX_PENDING_OBJECT;
+
+/**
+ * @brief The sorted address index of the symbols
+ *
+ */
+typedef struct _SYMBOL_INDEX
+{
+    std::vector<SYMBOL_INDEX_MODULE>         Modules;
+    std::vector<SYMBOL_INDEX_ENTRY>          Entries;
+    std::vector<CHAR>                        Names;
+    std::vector<SYMBOL_INDEX_PENDING_OBJECT> PendingObjects;
+    std::string                              LastModuleName;
+    UINT32                                   LastModuleId;
+
+} SYMBOL_INDEX, *PSYMBOL_INDEX;
+
+/**
+ * @brief The object that is found in the index
+ *
+ */
+typedef struct _SYMBOL_INDEX_OBJECT
+{
+    UINT64       Address;
+    UINT32       Size;
+    const CHAR * Name;
+
+} SYMBOL_INDEX_OBJECT, *PSYMBOL_INDEX_OBJECT;
+
+//////////////////////////////////////////////////
+//					Functions                   //
+//////////////////////////////////////////////////
+
+VOID
+SymbolIndexClear(PSYMBOL_INDEX Index);
+
+VOID
+SymbolIndexAddObject(PSYMBOL_INDEX Index,
+                     UINT64        Address,
+                     const CHAR *  ModuleName,
+                     const CHAR *  ObjectName,
+                     UINT32        ObjectSize);
+
+VOID
+SymbolIndexBuild(PSYMBOL_INDEX Index);
+
+BOOLEAN
+SymbolIndexLookup(const SYMBOL_INDEX * Index, UINT64 Address, PSYMBOL_INDEX_OBJECT Object);
+
+BOOLEAN
+SymbolCreateDisassemblerSymbolMap();
+
+BOOLEAN
+SymbolShowFunctionNameBasedOnAddress(UINT64 Address, PUINT64 UsedBaseAddress);
@@ -15,17 +15,6 @@
 //			        Structures		            //
 //////////////////////////////////////////////////
 
-/**
- * @brief Save the local function symbols' description
- *
- */
-typedef struct _LOCAL_FUNCTION_DESCRIPTION
-{
-    std::string ObjectName;
-    UINT32      ObjectSize;
-
-} LOCAL_FUNCTION_DESCRIPTION, *PLOCAL_FUNCTION_DESCRIPTION;
-
 /**
  * @brief Save the local module symbols' description
  *
@@ -86,9 +75,6 @@ typedef LONG(NTAPI * PFN_NT_QIT)(HANDLE, ULONG, PVOID, ULONG, PULONG);
 VOID
 SymbolBuildAndShowSymbolTable();
 
-BOOLEAN
-SymbolShowFunctionNameBasedOnAddress(UINT64 Address, PUINT64 UsedBaseAddress);
-
 BOOLEAN
 SymbolLoadOrDownloadSymbols(BOOLEAN IsDownload, BOOLEAN SilentLoad);
 
@@ -367,12 +367,103 @@ CommandType g_CommandsList;
  */
 UINT64 * g_ScriptGlobalVariables;
 
+/**
+ * @brief Holder of percpu variables for script engine
+ *
+ */
+UINT64 * g_ScriptPercpuVariables;
+
 /**
  * @brief Holder of stack buffer for script engine
  *
  */
 UINT64 * g_ScriptStackBuffer;
 
+/**
+ * @brief Compiled scripts of the cache, the most recently used entry
+ * is at the front of the list
+ *
+ */
+std::list<PSCRIPT_ENGINE_COMPILED_CACHE_ENTRY> g_ScriptCompiledCacheLruList;
+
+/**
+ * @brief Entries of the cache of the compiled scripts (indexed by the hash
+ * of the script and the context that it is compiled in)
+ *
+ */
+std::map<UINT64, std::list<PSCRIPT_ENGINE_COMPILED_CACHE_ENTRY>::iterator> g_ScriptCompiledCacheIndex;
+
+/**
+ * @brief Entries of the cache of the compiled scripts (indexed by the
+ * symbol buffers that are given to the callers)
+ *
+ */
+std::map<PVOID, PSCRIPT_ENGINE_COMPILED_CACHE_ENTRY> g_ScriptCompiledCacheBuffers;
+
+/**
+ * @brief Statistics of the cache of the compiled scripts
+ *
+ */
+SCRIPT_ENGINE_COMPILED_CACHE_STATISTICS g_ScriptCompiledCacheStatistics = {0};
+
+/**
+ * @brief Generation of the symbols and types that the scripts are compiled
+ * with, it changes each time symbols are loaded or unloaded
+ *
+ */
+UINT64 g_ScriptCompiledCacheGeneration = 0;
+
+/**
+ * @brief Lock of the cache of the compiled scripts
+ *
+ */
+volatile LONG g_ScriptCompiledCacheLock;
+
+/**
+ * @brief Formats of printf that are formatted by the debugger (deferred),
+ * the id of a format is its index plus one
+ *
+ */
+std::vector<SCRIPT_ENGINE_DEFERRED_FORMAT> g_ScriptDeferredFormats;
+
+/**
+ * @brief Ids of the deferred formats (indexed by the format and the
+ * descriptors of its arguments)
+ *
+ */
+std::map<std::string, UINT32> g_ScriptDeferredFormatIds;
+
+/**
+ * @brief Lock of the deferred formats
+ *
+ */
+volatile LONG g_ScriptDeferredFormatsLock;
+
+/**
+ * @brief The file of the records of the emit function ('.emit' command)
+ *
+ */
+ofstream g_ScriptEmitFile;
+
+/**
+ * @brief Path of the file of the records of the emit function
+ *
+ */
+std::string g_ScriptEmitFilePath;
+
+/**
+ * @brief Number of the records that are written to the file of the emit
+ * function
+ *
+ */
+UINT64 g_ScriptEmitFileRecordsCount = 0;
+
+/**
+ * @brief Lock of the file of the records of the emit function
+ *
+ */
+volatile LONG g_ScriptEmitFileLock;
+
 /**
  * @brief Is list of command initialized
  *
@@ -398,6 +489,13 @@ UINT32 g_ProcessIdOfLatestStartingProcess = NULL;
  */
 UINT64 g_EventTag = DebuggerEventTagStartSeed;
 
+/**
+ * @brief The source of the scripts of the events (by the tag of the
+ * event), it's used to map the profile of the scripts to their lines
+ *
+ */
+std::map<UINT64, std::string> g_ScriptSourcesOfEvents;
+
 /**
  * @brief This variable holds the trace and generate numbers
  * for unique tag of the output resources
@@ -530,10 +628,11 @@ BOOLEAN g_BreakPrintingOutput = FALSE;
 BOOLEAN g_IsExecutingSymbolLoadingRoutines = FALSE;
 
 /**
- * @brief Symbol table for disassembler
+ * @brief Sorted address index of the symbols (for the disassembler, the
+ * callstacks and the traces)
  *
  */
-std::map<UINT64, LOCAL_FUNCTION_DESCRIPTION> g_DisassemblerSymbolMap;
+SYMBOL_INDEX g_SymbolIndex;
 
 /**
  * @brief Shows whether the user executed and mesaured '!measure'
@@ -614,6 +713,22 @@ BOOLEAN g_AddressConversion = TRUE;
  */
 BOOLEAN g_AutoFlush = FALSE;
 
+/**
+ * @brief Whether the scripts that are evaluated in user-mode are translated
+ * to native code (JIT) or not
+ * @details it is disabled by default
+ *
+ */
+BOOLEAN g_ScriptEngineJit = FALSE;
+
+/**
+ * @brief Whether the messages of printf in the events are formatted by the
+ * debugger (deferred) or by the debuggee
+ * @details it is disabled by default
+ *
+ */
+BOOLEAN g_ScriptEngineDeferredPrintf = FALSE;
+
 /**
  * @brief Shows the syntax used in !u !u2 u u2 commands
  * @details INTEL = 1, ATT = 2, MASM = 3
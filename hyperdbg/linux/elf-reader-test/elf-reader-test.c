@@ -0,0 +1,400 @@
+/**
+ * @file elf-reader-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Tests of the ELF reader
+ * @details An ELF file is loaded by SymLoadFileSymbol (as the 'vmlinux'
+ * module), the names, the fields, the sizes of the types and the addresses
+ * of the queries are resolved by the Sym* functions, and then each symbol of
+ * the file is resolved by its name and compared with its address
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The base address of the module
+ */
+#define TEST_MODULE_BASE 0xffffffff81000000ull
+
+/**
+ * @brief An object of the symbol map of the disassembler
+ */
+typedef struct _TEST_MAP_OBJECT
+{
+    UINT64 Address;
+    UINT32 Size;
+    CHAR * Name;
+
+} TEST_MAP_OBJECT, *PTEST_MAP_OBJECT;
+
+/**
+ * @brief Statistics of the symbols that are resolved by their names
+ */
+typedef struct _TEST_SYMBOLS_CONTEXT
+{
+    UINT64 Count;
+    UINT64 NotFound;
+    UINT64 Duplicates;
+    UINT64 Nanoseconds;
+
+} TEST_SYMBOLS_CONTEXT, *PTEST_SYMBOLS_CONTEXT;
+
+//
+// Global Variables
+//
+static PTEST_MAP_OBJECT g_MapObjects         = NULL;
+static UINT32           g_MapObjectsCount    = 0;
+static UINT32           g_MapObjectsCapacity = 0;
+
+VOID
+ShowMessages(const char * Fmt, ...)
+{
+    va_list ArgList;
+
+    va_start(ArgList, Fmt);
+    vprintf(Fmt, ArgList);
+    va_end(ArgList);
+}
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestNanoseconds()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + (UINT64)Time.tv_nsec;
+}
+
+/**
+ * @brief Add an object to the symbol map of the disassembler
+ *
+ * @param Address
+ * @param ModuleName
+ * @param ObjectName
+ * @param ObjectSize
+ * @return VOID
+ */
+static VOID
+TestMapCallback(UINT64 Address, char * ModuleName, char * ObjectName, unsigned int ObjectSize)
+{
+    PTEST_MAP_OBJECT Object;
+
+    if (g_MapObjectsCount == g_MapObjectsCapacity)
+    {
+        g_MapObjectsCapacity = g_MapObjectsCapacity == 0 ? 1024 : g_MapObjectsCapacity * 2;
+        g_MapObjects         = realloc(g_MapObjects, g_MapObjectsCapacity * sizeof(TEST_MAP_OBJECT));
+
+        if (g_MapObjects == NULL)
+        {
+            abort();
+        }
+    }
+
+    Object          = &g_MapObjects[g_MapObjectsCount++];
+    Object->Address = Address;
+    Object->Size    = ObjectSize;
+    Object->Name    = malloc(strlen(ModuleName) + strlen(ObjectName) + 2);
+
+    if (Object->Name == NULL)
+    {
+        abort();
+    }
+
+    sprintf(Object->Name, "%s!%s", ModuleName, ObjectName);
+}
+
+/**
+ * @brief Compare the objects of the symbol map by their addresses
+ *
+ * @param First
+ * @param Second
+ * @return int
+ */
+static int
+TestCompareMapObjects(const void * First, const void * Second)
+{
+    UINT64 FirstAddress  = ((const TEST_MAP_OBJECT *)First)->Address;
+    UINT64 SecondAddress = ((const TEST_MAP_OBJECT *)Second)->Address;
+
+    return FirstAddress < SecondAddress ? -1 : FirstAddress > SecondAddress;
+}
+
+/**
+ * @brief Show the object and the line of an address
+ * @details The object is found in the symbol map of the disassembler, the
+ * same as SymbolShowFunctionNameBasedOnAddress
+ *
+ * @param Address
+ * @return VOID
+ */
+static VOID
+TestShowAddress(UINT64 Address)
+{
+    CHAR   FileName[MAX_PATH];
+    UINT32 Line;
+    UINT32 Low  = 0;
+    UINT32 High = g_MapObjectsCount;
+
+    while (Low < High)
+    {
+        UINT32 Middle = Low + (High - Low) / 2;
+
+        if (g_MapObjects[Middle].Address <= Address)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    printf("%016llx:", (unsigned long long)Address);
+
+    if (Low != 0)
+    {
+        PTEST_MAP_OBJECT Object = &g_MapObjects[Low - 1];
+
+        if (Object->Address == Address)
+        {
+            printf(" %s", Object->Name);
+        }
+        else
+        {
+            printf(" %s+0x%llx", Object->Name, (unsigned long long)(Address - Object->Address));
+        }
+    }
+
+    if (SymGetLineFromAddress(Address, FileName, sizeof(FileName), &Line))
+    {
+        printf(" [%s @ %u]", FileName, Line);
+    }
+}
+
+/**
+ * @brief Resolve a query
+ * @details The masks ('*' or '?') are searched, Type.Field is the offset of a
+ * field, @Name is the object and the line of the address of a symbol, and
+ * the other queries are the address of a symbol or the size of a type
+ *
+ * @param Query
+ * @return VOID
+ */
+static VOID
+TestQuery(const char * Query)
+{
+    CHAR    Type[MAX_PATH];
+    CHAR *  Field;
+    UINT64  Start = TestNanoseconds();
+    UINT64  Address;
+    UINT64  Size;
+    UINT32  Offset;
+    BOOLEAN WasFound;
+    BOOLEAN IsSize;
+
+    if (strlen(Query) >= sizeof(Type))
+    {
+        printf("%s: too long\n", Query);
+        return;
+    }
+
+    strcpy(Type, Query);
+
+    if (strchr(Query, '*') != NULL || strchr(Query, '?') != NULL)
+    {
+        printf("%s:\n", Query);
+
+        if (SymSearchSymbolForMask(Query) != 0)
+        {
+            printf("  module not found\n");
+        }
+
+        printf("  (%.3f ms)\n", (TestNanoseconds() - Start) / 1e6);
+        return;
+    }
+
+    if (Query[0] == '@')
+    {
+        CHAR * End;
+
+        Address = strtoull(Query + 1, &End, 16);
+
+        if (*End != '\0')
+        {
+            Address = SymConvertNameToAddress(Query + 1, &WasFound);
+
+            if (!WasFound)
+            {
+                printf("%s: not found\n", Query);
+                return;
+            }
+        }
+
+        TestShowAddress(Address);
+
+        printf(" (%.3f ms)\n", (TestNanoseconds() - Start) / 1e6);
+        return;
+    }
+
+    Field = strchr(Type, '.');
+
+    if (Field != NULL)
+    {
+        *Field++ = '\0';
+
+        if (SymGetFieldOffset(Type, Field, &Offset))
+        {
+            printf("%s: offset 0x%x (%.3f ms)\n", Query, Offset, (TestNanoseconds() - Start) / 1e6);
+        }
+        else
+        {
+            printf("%s: not found (%.3f ms)\n", Query, (TestNanoseconds() - Start) / 1e6);
+        }
+
+        return;
+    }
+
+    Address = SymConvertNameToAddress(Query, &WasFound);
+    IsSize  = SymGetDataTypeSize(Type, &Size);
+
+    if (WasFound)
+    {
+        printf("%s: address %016llx", Query, (unsigned long long)Address);
+    }
+
+    if (IsSize)
+    {
+        printf("%s size 0x%llx", WasFound ? "," : Query, (unsigned long long)Size);
+    }
+
+    if (!WasFound && !IsSize)
+    {
+        printf("%s: not found", Query);
+    }
+
+    printf(" (%.3f ms)\n", (TestNanoseconds() - Start) / 1e6);
+}
+
+/**
+ * @brief Resolve a symbol by its name and compare it with its address
+ *
+ * @param Name
+ * @param Rva
+ * @param Size
+ * @param Context
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSymbolCallback(const CHAR * Name, UINT64 Rva, UINT64 Size, PVOID Context)
+{
+    PTEST_SYMBOLS_CONTEXT SymbolsContext = (PTEST_SYMBOLS_CONTEXT)Context;
+    UINT64                Start          = TestNanoseconds();
+    BOOLEAN               WasFound;
+    UINT64                Address;
+
+    (void)Size;
+
+    Address = SymConvertNameToAddress(Name, &WasFound);
+
+    SymbolsContext->Nanoseconds += TestNanoseconds() - Start;
+    SymbolsContext->Count++;
+
+    if (!WasFound)
+    {
+        printf("err, %s is not found\n", Name);
+        SymbolsContext->NotFound++;
+    }
+    else if (Address != TEST_MODULE_BASE + Rva)
+    {
+        //
+        // The local symbols (and the aliases) may have the same name
+        //
+        SymbolsContext->Duplicates++;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Main function
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int
+main(int argc, char ** argv)
+{
+    TEST_SYMBOLS_CONTEXT Context = {0};
+    PELF_FILE            Elf;
+    UINT64               Start;
+
+    if (argc < 2)
+    {
+        printf("usage: %s <elf file> [symbol | type | type.field | @symbol | @address | mask]...\n", argv[0]);
+        return 1;
+    }
+
+    Start = TestNanoseconds();
+
+    if (SymLoadFileSymbol(TEST_MODULE_BASE, argv[1], "vmlinux") != 0)
+    {
+        return 1;
+    }
+
+    printf("loaded %s in %.3f ms\n", argv[1], (TestNanoseconds() - Start) / 1e6);
+
+    //
+    // Build the symbol map of the disassembler
+    //
+    Start = TestNanoseconds();
+
+    SymCreateSymbolTableForDisassembler(TestMapCallback);
+    qsort(g_MapObjects, g_MapObjectsCount, sizeof(TEST_MAP_OBJECT), TestCompareMapObjects);
+
+    printf("symbol map: %u objects (%.3f ms)\n", g_MapObjectsCount, (TestNanoseconds() - Start) / 1e6);
+
+    for (int i = 2; i < argc; i++)
+    {
+        TestQuery(argv[i]);
+    }
+
+    //
+    // Resolve all of the symbols by their names
+    //
+    Elf = ElfOpen(argv[1]);
+
+    if (Elf == NULL)
+    {
+        return 1;
+    }
+
+    ElfEnumerateSymbols(Elf, TestSymbolCallback, &Context);
+    ElfClose(Elf);
+
+    SymUnloadAllSymbols();
+
+    for (UINT32 i = 0; i < g_MapObjectsCount; i++)
+    {
+        free(g_MapObjects[i].Name);
+    }
+
+    free(g_MapObjects);
+
+    printf("symbols: %llu, not found: %llu, duplicates: %llu, %.1f ns/lookup\n",
+           (unsigned long long)Context.Count,
+           (unsigned long long)Context.NotFound,
+           (unsigned long long)Context.Duplicates,
+           Context.Count == 0 ? 0.0 : (double)Context.Nanoseconds / Context.Count);
+
+    return Context.NotFound == 0 ? 0 : 1;
+}
@@ -0,0 +1,52 @@
+/**
+ * @file pch.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Header for the tests of the ELF reader
+ * @details
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#ifndef PCH_H
+#define PCH_H
+
+//
+// Scope definitions
+//
+#define HYPERDBG_USER_MODE
+#define HYPERDBG_LINUX
+
+#include "platform/general/header/Environment.h"
+
+#include <ctype.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <assert.h>
+
+//
+// SDK headers
+//
+#include "SDK/HyperDbgSdk.h"
+#include "SDK/imports/user/HyperDbgSymImports.h"
+
+//
+// ELF and PDB readers and the symbol backend of the script engine
+//
+#include "../../script-engine/header/elf-reader.h"
+#include "../../script-engine/header/pdb-reader.h"
+#include "../../script-engine/header/symbol-linux.h"
+
+//
+// Functions of the script engine that are used by the symbol backend
+//
+VOID
+ShowMessages(const char * Fmt, ...);
+
+#endif // PCH_H
@@ -0,0 +1,231 @@
+/**
+ * @file pdb-reader-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Tests of the PDB reader
+ * @details A PDB file is loaded by SymLoadFileSymbol (as the 'nt' module),
+ * the names, the fields and the sizes of the queries are resolved by the
+ * Sym* functions, and then each symbol of the file is resolved by its name
+ * and compared with its address
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The base address of the module
+ */
+#define TEST_MODULE_BASE 0xfffff80012000000ull
+
+/**
+ * @brief Statistics of the symbols that are resolved by their names
+ */
+typedef struct _TEST_SYMBOLS_CONTEXT
+{
+    UINT64 Count;
+    UINT64 NotFound;
+    UINT64 Duplicates;
+    UINT64 Nanoseconds;
+
+} TEST_SYMBOLS_CONTEXT, *PTEST_SYMBOLS_CONTEXT;
+
+VOID
+ShowMessages(const char * Fmt, ...)
+{
+    va_list ArgList;
+
+    va_start(ArgList, Fmt);
+    vprintf(Fmt, ArgList);
+    va_end(ArgList);
+}
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestNanoseconds()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + (UINT64)Time.tv_nsec;
+}
+
+/**
+ * @brief Resolve a query
+ * @details The masks ('*' or '?') are searched, Type.Field is the offset of a
+ * field, and the other queries are the address of a symbol or the size of a
+ * type
+ *
+ * @param Query
+ * @return VOID
+ */
+static VOID
+TestQuery(const char * Query)
+{
+    CHAR    Type[MAX_PATH];
+    CHAR *  Field;
+    UINT64  Start = TestNanoseconds();
+    UINT64  Address;
+    UINT64  Size;
+    UINT32  Offset;
+    BOOLEAN WasFound;
+    BOOLEAN IsSize;
+
+    if (strlen(Query) >= sizeof(Type))
+    {
+        printf("%s: too long\n", Query);
+        return;
+    }
+
+    strcpy(Type, Query);
+
+    if (strchr(Query, '*') != NULL || strchr(Query, '?') != NULL)
+    {
+        printf("%s:\n", Query);
+
+        if (SymSearchSymbolForMask(Query) != 0)
+        {
+            printf("  module not found\n");
+        }
+
+        printf("  (%.3f ms)\n", (TestNanoseconds() - Start) / 1e6);
+        return;
+    }
+
+    Field = strchr(Type, '.');
+
+    if (Field != NULL)
+    {
+        *Field++ = '\0';
+
+        if (SymGetFieldOffset(Type, Field, &Offset))
+        {
+            printf("%s: offset 0x%x (%.3f ms)\n", Query, Offset, (TestNanoseconds() - Start) / 1e6);
+        }
+        else
+        {
+            printf("%s: not found (%.3f ms)\n", Query, (TestNanoseconds() - Start) / 1e6);
+        }
+
+        return;
+    }
+
+    Address = SymConvertNameToAddress(Query, &WasFound);
+    IsSize  = SymGetDataTypeSize(Type, &Size);
+
+    if (WasFound)
+    {
+        printf("%s: address %016llx", Query, (unsigned long long)Address);
+    }
+    else if (IsSize)
+    {
+        printf("%s: size 0x%llx", Query, (unsigned long long)Size);
+    }
+    else
+    {
+        printf("%s: not found", Query);
+    }
+
+    printf(" (%.3f ms)\n", (TestNanoseconds() - Start) / 1e6);
+}
+
+/**
+ * @brief Resolve a symbol by its name and compare it with its address
+ *
+ * @param Name
+ * @param Rva
+ * @param Context
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSymbolCallback(const CHAR * Name, UINT32 Rva, PVOID Context)
+{
+    PTEST_SYMBOLS_CONTEXT SymbolsContext = (PTEST_SYMBOLS_CONTEXT)Context;
+    UINT64                Start          = TestNanoseconds();
+    BOOLEAN               WasFound;
+    UINT64                Address;
+
+    Address = SymConvertNameToAddress(Name, &WasFound);
+
+    SymbolsContext->Nanoseconds += TestNanoseconds() - Start;
+    SymbolsContext->Count++;
+
+    if (!WasFound)
+    {
+        printf("err, %s is not found\n", Name);
+        SymbolsContext->NotFound++;
+    }
+    else if (Address != TEST_MODULE_BASE + Rva)
+    {
+        //
+        // The local symbols of the modules may have the same name
+        //
+        SymbolsContext->Duplicates++;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Main function
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int
+main(int argc, char ** argv)
+{
+    TEST_SYMBOLS_CONTEXT Context = {0};
+    PPDB_FILE            Pdb;
+    UINT64               Start;
+
+    if (argc < 2)
+    {
+        printf("usage: %s <pdb file> [symbol | type | type.field | mask]...\n", argv[0]);
+        return 1;
+    }
+
+    Start = TestNanoseconds();
+
+    if (SymLoadFileSymbol(TEST_MODULE_BASE, argv[1], "nt") != 0)
+    {
+        return 1;
+    }
+
+    printf("loaded %s in %.3f ms\n", argv[1], (TestNanoseconds() - Start) / 1e6);
+
+    for (int i = 2; i < argc; i++)
+    {
+        TestQuery(argv[i]);
+    }
+
+    //
+    // Resolve all of the symbols by their names
+    //
+    Pdb = PdbOpen(argv[1]);
+
+    if (Pdb == NULL)
+    {
+        return 1;
+    }
+
+    PdbEnumerateSymbols(Pdb, TestSymbolCallback, &Context);
+    PdbClose(Pdb);
+
+    SymUnloadAllSymbols();
+
+    printf("symbols: %llu, not found: %llu, duplicates: %llu, %.1f ns/lookup\n",
+           (unsigned long long)Context.Count,
+           (unsigned long long)Context.NotFound,
+           (unsigned long long)Context.Duplicates,
+           Context.Count == 0 ? 0.0 : (double)Context.Nanoseconds / Context.Count);
+
+    return Context.NotFound == 0 ? 0 : 1;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file pch.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Header for the tests of the page-granular safe string functions
+ * @details
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#ifndef PCH_H
+#define PCH_H
+
+//
+// Scope definitions
+//
+#define HYPERDBG_USER_MODE
+#define HYPERDBG_LINUX
+
+#include "platform/general/header/Environment.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+
+//
+// SDK headers
+//
+#include "SDK/HyperDbgSdk.h"
+
+//
+// Definitions of the WDK that are used by the safe string functions
+//
+#define PAGE_SIZE      0x1000
+#define PAGE_ALIGN(Va) ((PVOID)((ULONG_PTR)(Va) & ~((ULONG_PTR)PAGE_SIZE - 1)))
+
+//
+// Safe string functions
+//
+#include "../../hyperhv/header/memory/SafeString.h"
+
+//
+// Functions of hyperhv that are mocked by the tests
+//
+BOOLEAN
+CheckAccessValidityAndSafety(UINT64 TargetAddress, UINT32 Size);
+
+BOOLEAN
+MemoryMapperReadMemorySafe(UINT64 VaAddressToRead, PVOID BufferToSaveMemory, SIZE_T SizeToRead);
+
+#endif // PCH_H
@@ -0,0 +1,509 @@
+/**
+ * @file safe-string-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Tests of the page-granular safe string functions
+ * @details The safe-read layer of hyperhv (CheckAccessValidityAndSafety and
+ * MemoryMapperReadMemorySafe) is mocked by a few pages that can be marked as
+ * invalid, the results are compared with a character-at-a-time reference
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of the pages of the mocked memory
+ */
+#define TEST_PAGE_COUNT 4
+
+/**
+ * @brief The mocked memory and the validity of its pages
+ */
+static CHAR *  TestMemory;
+static BOOLEAN TestPageIsValid[TEST_PAGE_COUNT];
+
+/**
+ * @brief Statistics of the mocked safe-read layer
+ */
+static UINT64 TestValidations;
+static UINT64 TestReads;
+static UINT64 TestUnsafeReads;
+
+/**
+ * @brief State of the random number generator
+ */
+static UINT64 TestState;
+
+/**
+ * @brief Number of the failed checks
+ */
+static UINT64 TestFailures;
+
+/**
+ * @brief Check whether all of the pages of a range are valid
+ *
+ * @param Address
+ * @param Size
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestIsRangeValid(UINT64 Address, UINT64 Size)
+{
+    UINT64 Start = (UINT64)TestMemory;
+
+    if (Size == 0)
+    {
+        return TRUE;
+    }
+
+    if (Address < Start || Address + Size > Start + TEST_PAGE_COUNT * PAGE_SIZE)
+    {
+        return FALSE;
+    }
+
+    for (UINT64 Page = (Address - Start) / PAGE_SIZE; Page <= (Address + Size - 1 - Start) / PAGE_SIZE; Page++)
+    {
+        if (!TestPageIsValid[Page])
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+BOOLEAN
+CheckAccessValidityAndSafety(UINT64 TargetAddress, UINT32 Size)
+{
+    TestValidations++;
+
+    return TestIsRangeValid(TargetAddress, Size);
+}
+
+BOOLEAN
+MemoryMapperReadMemorySafe(UINT64 VaAddressToRead, PVOID BufferToSaveMemory, SIZE_T SizeToRead)
+{
+    TestReads++;
+
+    if (!TestIsRangeValid(VaAddressToRead, SizeToRead))
+    {
+        //
+        // The safe functions should never read an invalid page
+        //
+        TestUnsafeReads++;
+        return FALSE;
+    }
+
+    memcpy(BufferToSaveMemory, (PVOID)VaAddressToRead, SizeToRead);
+
+    return TRUE;
+}
+
+/**
+ * @brief Returns a random number (xorshift64)
+ *
+ * @return UINT64
+ */
+static UINT64
+TestRandom(void)
+{
+    TestState ^= TestState << 13;
+    TestState ^= TestState >> 7;
+    TestState ^= TestState << 17;
+
+    return TestState;
+}
+
+/**
+ * @brief Returns a random number that is less than Bound
+ *
+ * @param Bound
+ * @return UINT32
+ */
+static UINT32
+TestChoose(UINT32 Bound)
+{
+    return (UINT32)(TestRandom() % Bound);
+}
+
+/**
+ * @brief Read a character if its pages are valid
+ *
+ * @param Address
+ * @param CharSize
+ * @param Character
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestReadCharacter(UINT64 Address, UINT32 CharSize, INT32 * Character)
+{
+    WCHAR WideCharacter;
+
+    if (!TestIsRangeValid(Address, CharSize))
+    {
+        return FALSE;
+    }
+
+    if (CharSize == sizeof(CHAR))
+    {
+        *Character = *(CHAR *)Address;
+    }
+    else
+    {
+        memcpy(&WideCharacter, (PVOID)Address, sizeof(WCHAR));
+        *Character = WideCharacter;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Character-at-a-time reference of SafeStringLength
+ *
+ * @param Address
+ * @param CharSize
+ * @param Length
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestReferenceLength(UINT64 Address, UINT32 CharSize, UINT32 * Length)
+{
+    INT32 Character;
+
+    for (*Length = 0;; (*Length)++, Address += CharSize)
+    {
+        if (!TestReadCharacter(Address, CharSize, &Character))
+        {
+            return FALSE;
+        }
+
+        if (Character == 0)
+        {
+            return TRUE;
+        }
+    }
+}
+
+/**
+ * @brief Character-at-a-time reference of SafeStringCompare
+ *
+ * @param Address1
+ * @param Address2
+ * @param CharSize
+ * @param Count
+ * @param IsBounded
+ * @param StopOnNull
+ * @param Result
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestReferenceCompare(UINT64  Address1,
+                     UINT64  Address2,
+                     UINT32  CharSize,
+                     UINT64  Count,
+                     BOOLEAN IsBounded,
+                     BOOLEAN StopOnNull,
+                     INT32 * Result)
+{
+    INT32 Character1;
+    INT32 Character2;
+
+    *Result = 0;
+
+    for (; !IsBounded || Count != 0; Count--, Address1 += CharSize, Address2 += CharSize)
+    {
+        if (!TestReadCharacter(Address1, CharSize, &Character1) ||
+            !TestReadCharacter(Address2, CharSize, &Character2))
+        {
+            return FALSE;
+        }
+
+        if (Character1 != Character2)
+        {
+            *Result = Character1 < Character2 ? -1 : 1;
+            return TRUE;
+        }
+
+        if (StopOnNull && Character2 == 0)
+        {
+            return TRUE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Check a condition of a test
+ *
+ * @param Condition
+ * @param Name
+ * @return VOID
+ */
+static VOID
+TestCheck(BOOLEAN Condition, const CHAR * Name)
+{
+    if (!Condition)
+    {
+        printf("failed : %s\n", Name);
+        TestFailures++;
+    }
+}
+
+/**
+ * @brief Mark all of the pages as valid and reset the statistics
+ *
+ * @return VOID
+ */
+static VOID
+TestReset(void)
+{
+    for (UINT32 i = 0; i < TEST_PAGE_COUNT; i++)
+    {
+        TestPageIsValid[i] = TRUE;
+    }
+
+    memset(TestMemory, 'A', TEST_PAGE_COUNT * PAGE_SIZE);
+
+    TestValidations = 0;
+    TestReads       = 0;
+}
+
+/**
+ * @brief Tests of the page boundaries and the faults
+ *
+ * @return VOID
+ */
+static VOID
+TestBoundaries(void)
+{
+    UINT64 Page1 = (UINT64)TestMemory + PAGE_SIZE;
+    UINT32 Length;
+    INT32  Result;
+
+    //
+    // A string in a single page is validated and read once
+    //
+    TestReset();
+    TestMemory[PAGE_SIZE + 0x100 + 200] = '\0';
+
+    TestCheck(SafeStringLength(Page1 + 0x100, sizeof(CHAR), &Length) && Length == 200, "strlen in a page");
+    TestCheck(TestValidations == 1 && TestReads == 1, "strlen in a page is validated and read once");
+
+    //
+    // A string on two pages validates each page once
+    //
+    TestReset();
+    TestMemory[2 * PAGE_SIZE + 10] = '\0';
+
+    TestCheck(SafeStringLength(Page1 + PAGE_SIZE - 20, sizeof(CHAR), &Length) && Length == 30, "strlen on two pages");
+    TestCheck(TestValidations == 2 && TestReads == 2, "strlen on two pages validates two pages");
+
+    //
+    // The null character is the last character of a page and the next page
+    // is not valid
+    //
+    TestReset();
+    TestPageIsValid[2]                = FALSE;
+    TestMemory[2 * PAGE_SIZE - 1] = '\0';
+
+    TestCheck(SafeStringLength(Page1 + PAGE_SIZE - 50, sizeof(CHAR), &Length) && Length == 49, "strlen at the end of a page");
+
+    //
+    // The string runs into a page that is not valid
+    //
+    TestMemory[2 * PAGE_SIZE - 1] = 'A';
+
+    TestCheck(!SafeStringLength(Page1 + PAGE_SIZE - 50, sizeof(CHAR), &Length), "strlen faults on an invalid page");
+
+    //
+    // The first page is not valid
+    //
+    TestCheck(!SafeStringLength(Page1 + PAGE_SIZE, sizeof(CHAR), &Length), "strlen faults on an invalid first page");
+
+    //
+    // A wide character is placed on two pages
+    //
+    TestReset();
+    TestMemory[2 * PAGE_SIZE + 1] = '\0';
+    TestMemory[2 * PAGE_SIZE + 2] = '\0';
+
+    TestCheck(SafeStringLength(Page1 + PAGE_SIZE - 5, sizeof(WCHAR), &Length) && Length == 3, "wcslen on two pages");
+
+    TestPageIsValid[2] = FALSE;
+
+    TestCheck(!SafeStringLength(Page1 + PAGE_SIZE - 5, sizeof(WCHAR), &Length), "wcslen faults on a character on two pages");
+
+    //
+    // The strings differ after the end of the valid page of the first string
+    // but the second string ends before it
+    //
+    TestReset();
+    TestPageIsValid[2]                = FALSE;
+    TestMemory[PAGE_SIZE + 0x800 + 7] = '\0';
+
+    TestCheck(SafeStringCompare(Page1 + PAGE_SIZE - 8, Page1 + 0x800, sizeof(CHAR), 0, FALSE, TRUE, &Result) && Result == 1,
+              "strcmp stops at the null character");
+
+    //
+    // The same buffers continue to an invalid page
+    //
+    TestMemory[PAGE_SIZE + 0x800 + 7] = 'A';
+
+    TestCheck(!SafeStringCompare(Page1 + PAGE_SIZE - 8, Page1 + 0x800, sizeof(CHAR), 100, TRUE, FALSE, &Result),
+              "memcmp faults on an invalid page");
+
+    TestCheck(SafeStringCompare(Page1 + PAGE_SIZE - 8, Page1 + 0x800, sizeof(CHAR), 8, TRUE, FALSE, &Result) && Result == 0,
+              "memcmp doesn't read after the count");
+
+    TestCheck(TestUnsafeReads == 0, "invalid pages are never read");
+}
+
+/**
+ * @brief Get a random address of the mocked memory, most of them are near
+ * the boundaries of the pages
+ *
+ * @return UINT64
+ */
+static UINT64
+TestRandomAddress(void)
+{
+    UINT32 Page = TestChoose(TEST_PAGE_COUNT);
+
+    if (TestChoose(2))
+    {
+        return (UINT64)TestMemory + Page * PAGE_SIZE + PAGE_SIZE - 1 - TestChoose(2 * SAFE_STRING_CHUNK_SIZE);
+    }
+
+    return (UINT64)TestMemory + Page * PAGE_SIZE + TestChoose(PAGE_SIZE);
+}
+
+/**
+ * @brief Randomized tests that are compared with the reference
+ *
+ * @param Iterations
+ * @return VOID
+ */
+static VOID
+TestRandomized(UINT64 Iterations)
+{
+    for (UINT64 Iteration = 0; Iteration < Iterations && TestFailures == 0; Iteration++)
+    {
+        UINT32  CharSize   = TestChoose(2) ? sizeof(CHAR) : sizeof(WCHAR);
+        UINT64  Address1   = TestRandomAddress();
+        UINT64  Address2   = TestRandomAddress();
+        UINT64  Count      = TestChoose(3 * SAFE_STRING_CHUNK_SIZE);
+        BOOLEAN IsBounded  = TestChoose(2);
+        BOOLEAN StopOnNull = TestChoose(2);
+        UINT32  Density    = 1 + TestChoose(2000);
+        UINT32  Length;
+        UINT32  ReferenceLength;
+        BOOLEAN Status;
+        BOOLEAN ReferenceStatus;
+        INT32   Result;
+        INT32   ReferenceResult;
+
+        //
+        // Random characters (zero with a random density), the second buffer
+        // starts with a copy of the first one
+        //
+        for (UINT32 i = 0; i < TEST_PAGE_COUNT * PAGE_SIZE; i++)
+        {
+            TestMemory[i] = TestChoose(Density) == 0 ? 0 : (CHAR)(1 + TestChoose(255));
+        }
+
+        UINT64 Copied = TestChoose(2 * SAFE_STRING_CHUNK_SIZE);
+        UINT64 End    = (UINT64)TestMemory + TEST_PAGE_COUNT * PAGE_SIZE;
+
+        for (UINT64 i = 0; i < Copied && Address1 + i < End && Address2 + i < End; i++)
+        {
+            *(CHAR *)(Address2 + i) = *(CHAR *)(Address1 + i);
+        }
+
+        for (UINT32 i = 0; i < TEST_PAGE_COUNT; i++)
+        {
+            TestPageIsValid[i] = TestChoose(6) != 0;
+        }
+
+        if (!StopOnNull && !IsBounded)
+        {
+            IsBounded = TRUE;
+        }
+
+        Status          = SafeStringLength(Address1, CharSize, &Length);
+        ReferenceStatus = TestReferenceLength(Address1, CharSize, &ReferenceLength);
+
+        if (Status != ReferenceStatus || (Status && Length != ReferenceLength))
+        {
+            printf("failed : length (iteration: %llu, char size: %u, offset: %llx)\n",
+                   Iteration,
+                   CharSize,
+                   Address1 - (UINT64)TestMemory);
+            TestFailures++;
+        }
+
+        Status          = SafeStringCompare(Address1, Address2, CharSize, Count, IsBounded, StopOnNull, &Result);
+        ReferenceStatus = TestReferenceCompare(Address1, Address2, CharSize, Count, IsBounded, StopOnNull, &ReferenceResult);
+
+        if (Status != ReferenceStatus || (Status && Result != ReferenceResult))
+        {
+            printf("failed : compare (iteration: %llu, char size: %u, offsets: %llx %llx, count: %llx, bounded: %d, stop on null: %d)\n",
+                   Iteration,
+                   CharSize,
+                   Address1 - (UINT64)TestMemory,
+                   Address2 - (UINT64)TestMemory,
+                   Count,
+                   IsBounded,
+                   StopOnNull);
+            TestFailures++;
+        }
+
+        if (TestUnsafeReads != 0)
+        {
+            printf("failed : an invalid page is read (iteration: %llu)\n", Iteration);
+            TestFailures++;
+        }
+    }
+}
+
+/**
+ * @brief main function
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int
+main(int argc, char ** argv)
+{
+    UINT64 Seed       = argc > 1 ? strtoull(argv[1], NULL, 0) : (UINT64)time(NULL);
+    UINT64 Iterations = argc > 2 ? strtoull(argv[2], NULL, 0) : 10000;
+
+    TestState  = Seed != 0 ? Seed : 1;
+    TestMemory = aligned_alloc(PAGE_SIZE, TEST_PAGE_COUNT * PAGE_SIZE);
+
+    if (TestMemory == NULL)
+    {
+        printf("err, unable to allocate the memory\n");
+        return 1;
+    }
+
+    printf("seed: %llu, iterations: %llu\n", Seed, Iterations);
+
+    TestBoundaries();
+    TestRandomized(Iterations);
+
+    free(TestMemory);
+
+    if (TestFailures != 0)
+    {
+        printf("%llu checks are failed\n", TestFailures);
+        return 1;
+    }
+
+    printf("all checks are passed\n");
+
+    return 0;
+}
@@ -0,0 +1,35 @@
+/**
+ * @file pch.h
+ * @author M.H. Gholamrezaei (mh@hyperdbg.org)
+ * @brief Header for the script engine compile benchmark
+ * @details
+ * @version 0.19
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#ifndef PCH_H
+#define PCH_H
+
+//
+// Scope definitions
+//
+#define HYPERDBG_USER_MODE
+#define HYPERDBG_LINUX
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <assert.h>
+
+//
+// SDK headers
+//
+#include "../../include/SDK/HyperDbgSdk.h"
+#include "../../include/SDK/imports/user/HyperDbgScriptImports.h"
+
+#endif // PCH_H
@@ -0,0 +1,207 @@
+/**
+ * @file script-engine-bench.c
+ * @author M.H. Gholamrezaei (mh@hyperdbg.org)
+ * @brief Benchmark of compiling a batch of scripts by a pool of threads
+ * @details
+ * @version 0.19
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of scripts in the batch
+ */
+#define BENCH_NUMBER_OF_SCRIPTS 512
+
+/**
+ * @brief Number of local variables of each script
+ */
+#define BENCH_NUMBER_OF_VARIABLES 48
+
+/**
+ * @brief Returns the monotonic time in seconds
+ *
+ * @return double
+ */
+static double
+BenchNow(void)
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return Time.tv_sec + Time.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Creates an event script that looks like the scripts which are
+ * compiled at the start of a session
+ *
+ * @param Index
+ * @return CHAR*
+ */
+static CHAR *
+BenchCreateScript(UINT32 Index)
+{
+    size_t BufferSize = 256 + BENCH_NUMBER_OF_VARIABLES * 160;
+    CHAR * Script     = malloc(BufferSize);
+    size_t Length     = 0;
+
+    Length += snprintf(Script + Length, BufferSize - Length, "{ if ($pid == %u) { .hits%u = $tid; } ", Index, Index % 8);
+
+    for (UINT32 i = 0; i < BENCH_NUMBER_OF_VARIABLES; i++)
+    {
+        Length += snprintf(Script + Length,
+                           BufferSize - Length,
+                           "event%uVar%u = @rax + %u; if (event%uVar%u > 0x%x) { event%uVar%u = event%uVar%u - 1; } ",
+                           Index,
+                           i,
+                           i,
+                           Index,
+                           i,
+                           i * 16,
+                           Index,
+                           i,
+                           Index,
+                           i);
+    }
+
+    snprintf(Script + Length, BufferSize - Length, "printf(\"event %u: %%llx\\n\", event%uVar0); }", Index, Index);
+
+    return Script;
+}
+
+/**
+ * @brief Compiles the batch by the given number of threads
+ *
+ * @param Scripts
+ * @param NumberOfThreads
+ * @param Seconds
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BenchCompileBatch(CHAR ** Scripts, UINT32 NumberOfThreads, double * Seconds)
+{
+    PVOID   Results[BENCH_NUMBER_OF_SCRIPTS] = {0};
+    BOOLEAN Status;
+    double  Start = BenchNow();
+
+    Status = ScriptEngineParseBatch(Scripts, Results, BENCH_NUMBER_OF_SCRIPTS, NumberOfThreads);
+
+    *Seconds = BenchNow() - Start;
+
+    for (UINT32 i = 0; i < BENCH_NUMBER_OF_SCRIPTS; i++)
+    {
+        if (Results[i])
+        {
+            if (((PSYMBOL_BUFFER)Results[i])->Message)
+            {
+                printf("err, unable to compile script %u: %s\n", i, ((PSYMBOL_BUFFER)Results[i])->Message);
+            }
+
+            RemoveSymbolBuffer(Results[i]);
+        }
+    }
+
+    return Status;
+}
+
+/**
+ * @brief Compiles the batch by the given number of threads and shows the result
+ *
+ * @param Scripts
+ * @param NumberOfThreads
+ * @param SingleThreadSeconds
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BenchShowScaling(CHAR ** Scripts, UINT32 NumberOfThreads, double * SingleThreadSeconds)
+{
+    double Seconds;
+
+    if (!BenchCompileBatch(Scripts, NumberOfThreads, &Seconds))
+    {
+        return FALSE;
+    }
+
+    if (NumberOfThreads == 1)
+    {
+        *SingleThreadSeconds = Seconds;
+    }
+
+    printf("%7u %12.1f %12.0f %9.2fx\n",
+           NumberOfThreads,
+           Seconds * 1000,
+           BENCH_NUMBER_OF_SCRIPTS / Seconds,
+           *SingleThreadSeconds / Seconds);
+
+    return TRUE;
+}
+
+/**
+ * @brief Usage: script-engine-bench [maximum number of threads]
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int
+main(int argc, char ** argv)
+{
+    CHAR * Scripts[BENCH_NUMBER_OF_SCRIPTS];
+    UINT32 MaximumNumberOfThreads = (UINT32)sysconf(_SC_NPROCESSORS_ONLN);
+    UINT32 NumberOfThreads;
+    double SingleThreadSeconds;
+
+    if (argc > 1)
+    {
+        MaximumNumberOfThreads = (UINT32)strtoul(argv[1], NULL, 0);
+    }
+
+    for (UINT32 i = 0; i < BENCH_NUMBER_OF_SCRIPTS; i++)
+    {
+        Scripts[i] = BenchCreateScript(i);
+    }
+
+    //
+    // Warm up (and create the table of global variables)
+    //
+    if (!BenchCompileBatch(Scripts, 1, &SingleThreadSeconds))
+    {
+        return 1;
+    }
+
+    printf("compiling %u scripts (%u variables each) by up to %u threads\n\n",
+           BENCH_NUMBER_OF_SCRIPTS,
+           BENCH_NUMBER_OF_VARIABLES,
+           MaximumNumberOfThreads);
+
+    printf("threads    time (ms)    scripts/s    speedup\n");
+
+    for (NumberOfThreads = 1; NumberOfThreads <= MaximumNumberOfThreads; NumberOfThreads *= 2)
+    {
+        if (!BenchShowScaling(Scripts, NumberOfThreads, &SingleThreadSeconds))
+        {
+            return 1;
+        }
+    }
+
+    //
+    // Also measure all the threads if it is not a power of two
+    //
+    if (NumberOfThreads / 2 != MaximumNumberOfThreads &&
+        !BenchShowScaling(Scripts, MaximumNumberOfThreads, &SingleThreadSeconds))
+    {
+        return 1;
+    }
+
+    for (UINT32 i = 0; i < BENCH_NUMBER_OF_SCRIPTS; i++)
+    {
+        free(Scripts[i]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file pch.h
+ * @author M.H. Gholamrezaei (mh@hyperdbg.org)
+ * @brief Header for the script evaluator benchmark
+ * @details
+ * @version 0.19
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#ifndef PCH_H
+#define PCH_H
+
+//
+// Scope definitions
+//
+#define HYPERDBG_USER_MODE
+#define HYPERDBG_LINUX
+#define SCRIPT_ENGINE_USER_MODE
+
+#include "platform/general/header/Environment.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+#include <assert.h>
+#include <wchar.h>
+#include <pthread.h>
+
+//
+// Configuration and SDK headers
+//
+#include "config/Configuration.h"
+#include "config/Definition.h"
+#include "SDK/HyperDbgSdk.h"
+#include "SDK/imports/user/HyperDbgScriptImports.h"
+
+//
+// Platform headers
+//
+#include "platform/user/header/platform-lib-calls.h"
+#include "platform/user/header/platform-intrinsics.h"
+
+//
+// Script evaluator
+//
+#include "../script-eval/header/ScriptEngineHeader.h"
+
+//
+// Functions of libhyperdbg that are used by the evaluator
+//
+VOID
+ShowMessages(const char * Fmt, ...);
+
+BOOLEAN
+CheckAccessValidityAndSafety(UINT64 TargetAddress, UINT32 Size);
+
+UINT32
+HyperDbgLengthDisassemblerEngine(unsigned char * Address, UINT64 MaxLength, BOOLEAN Is32Bit);
+
+VOID
+SpinlockLock(volatile LONG * Lock);
+
+VOID
+SpinlockUnlock(volatile LONG * Lock);
+
+VOID
+SpinlockLockWithCustomWait(volatile LONG * Lock, unsigned MaximumWait);
+
+#endif // PCH_H
@@ -0,0 +1,746 @@
+/**
+ * @file script-eval-bench.c
+ * @author M.H. Gholamrezaei (mh@hyperdbg.org)
+ * @brief Benchmark of executing the scripts by ScriptEngineExecute, by the
+ * linked (pre-decoded) code and by the native code of the JIT
+ * @details
+ * @version 0.19
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Minimum time of measuring each script (in seconds)
+ */
+#define BENCH_MINIMUM_SECONDS 0.5
+
+/**
+ * @brief Default number of the threads of the counter benchmark
+ */
+#define BENCH_COUNTER_DEFAULT_THREADS 4
+
+/**
+ * @brief Maximum number of the threads of the counter benchmark
+ */
+#define BENCH_COUNTER_MAXIMUM_THREADS 64
+
+/**
+ * @brief Number of the times that each thread of the counter benchmark runs the script
+ */
+#define BENCH_COUNTER_RUNS 2000000
+
+/**
+ * @brief Size of the buffers of the copy benchmark (the largest copied structure)
+ */
+#define BENCH_COPY_BUFFER_SIZE 0x10000
+
+//
+// Variables and functions of libhyperdbg that are used by the evaluator
+//
+UINT64  g_CurrentExprEvalResult;
+BOOLEAN g_CurrentExprEvalResultHasError;
+
+VOID
+ShowMessages(const char * Fmt, ...)
+{
+    va_list ArgList;
+
+    va_start(ArgList, Fmt);
+    vprintf(Fmt, ArgList);
+    va_end(ArgList);
+}
+
+/**
+ * @brief Buffers of the copy benchmark and the number of the checked ranges
+ */
+static BYTE * BenchCopySource;
+static BYTE * BenchCopyDestination;
+static UINT64 BenchCheckedRanges;
+
+/**
+ * @brief Checks whether a range is in a buffer
+ *
+ * @param Address
+ * @param Size
+ * @param Buffer
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BenchIsInBuffer(UINT64 Address, UINT32 Size, BYTE * Buffer)
+{
+    return Buffer != NULL && Address >= (UINT64)Buffer && Size <= BENCH_COPY_BUFFER_SIZE &&
+           Address - (UINT64)Buffer <= BENCH_COPY_BUFFER_SIZE - Size;
+}
+
+BOOLEAN
+CheckAccessValidityAndSafety(UINT64 TargetAddress, UINT32 Size)
+{
+    BenchCheckedRanges++;
+
+    //
+    // Only the buffers of the copy benchmark are valid
+    //
+    return BenchIsInBuffer(TargetAddress, Size, BenchCopySource) ||
+           BenchIsInBuffer(TargetAddress, Size, BenchCopyDestination);
+}
+
+UINT32
+HyperDbgLengthDisassemblerEngine(unsigned char * Address, UINT64 MaxLength, BOOLEAN Is32Bit)
+{
+    UNREFERENCED_PARAMETER(Address);
+    UNREFERENCED_PARAMETER(MaxLength);
+    UNREFERENCED_PARAMETER(Is32Bit);
+
+    return 0;
+}
+
+VOID
+SpinlockLock(volatile LONG * Lock)
+{
+    while (__sync_lock_test_and_set(Lock, 1))
+    {
+    }
+}
+
+VOID
+SpinlockUnlock(volatile LONG * Lock)
+{
+    __sync_lock_release(Lock);
+}
+
+VOID
+SpinlockLockWithCustomWait(volatile LONG * Lock, unsigned MaximumWait)
+{
+    UNREFERENCED_PARAMETER(MaximumWait);
+
+    SpinlockLock(Lock);
+}
+
+/**
+ * @brief Scripts of the benchmark
+ */
+static const CHAR * BenchScripts[] = {
+    "{ if (@rcx == 0x1234 && $pid == 4) { benchHits = $tid; } }",
+    "{ if (@rcx == 0x1234 && @rdx == 4) { benchHits = @rax; } }",
+    "{ if (@rcx > 0x1000 && @rcx < 0x2000 && @rax != 0) { benchRange = @rdx; } }",
+    "{ benchSum = 0; for (benchIndex = 0; benchIndex < 2000; benchIndex++) { benchSum = benchSum + benchIndex; } }",
+    "{ int total = 0; for (int idx = 0; idx < 2000; idx++) { if (idx % 3 == 0) { total += idx; } } benchTotal = total; }",
+    "{ int fibonacci(int num) { if (num < 2) { return num; } return fibonacci(num - 1) + fibonacci(num - 2); } benchFibonacci = fibonacci(15); }",
+};
+
+static UINT64 BenchStackBuffer[MAX_STACK_BUFFER_COUNT];
+static UINT64 BenchGlobalVariables[MAX_VAR_COUNT];
+
+/**
+ * @brief Scripts of the counter benchmark, the first one increments a global
+ * variable that is shared by the threads and the second one increments a
+ * percpu variable that each thread keeps in its own slice
+ */
+static const struct
+{
+    const CHAR * Script;
+    BOOLEAN      IsPercpu;
+} BenchCounterScripts[] = {
+    {"{ .benchShared++; }", FALSE},
+    {"{ percpu .benchPercpu; .benchPercpu++; }", TRUE},
+};
+
+/**
+ * @brief Scripts of the copy benchmark, each of them assigns a structure of
+ * the source buffer (@rdi) to a structure of the destination buffer (@rsi)
+ */
+static const struct
+{
+    const CHAR * Script;
+    UINT32       Size;
+} BenchCopyScripts[] = {
+    {"{ struct bench4k { int arr[1024]; }; struct wrap4k { struct bench4k body; }; "
+     "struct wrap4k *dst; struct wrap4k *src; dst = (struct wrap4k *)@rsi; src = (struct wrap4k *)@rdi; "
+     "dst->body = src->body; }",
+     0x1000},
+    {"{ struct bench64k { int arr[16384]; }; struct wrap64k { struct bench64k body; }; "
+     "struct wrap64k *dst; struct wrap64k *src; dst = (struct wrap64k *)@rsi; src = (struct wrap64k *)@rdi; "
+     "dst->body = src->body; }",
+     0x10000},
+};
+
+/**
+ * @brief Details of each thread of the counter benchmark
+ */
+typedef struct _BENCH_COUNTER_THREAD
+{
+    pthread_t Thread;
+    PVOID     LinkedCode;
+    PVOID     JitCode;
+    UINT64 *  StackBuffer;
+    UINT64 *  PercpuVariables;
+    BOOLEAN   Succeeded;
+
+} BENCH_COUNTER_THREAD;
+
+/**
+ * @brief Registers of the guest (set by main, so the conditions of the scripts are true)
+ */
+static GUEST_REGS BenchGuestRegs;
+
+/**
+ * @brief Returns the monotonic time in seconds
+ *
+ * @return double
+ */
+static double
+BenchNow(void)
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return Time.tv_sec + Time.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Resets the registers of the script engine before each run
+ *
+ * @param Registers
+ * @param StackUsage Number of the entries of the stack buffer that are zeroed
+ * (the same as the debugger)
+ * @return VOID
+ */
+static VOID
+BenchResetRegisters(SCRIPT_ENGINE_GENERAL_REGISTERS * Registers, UINT32 StackUsage)
+{
+    memset(Registers, 0, sizeof(SCRIPT_ENGINE_GENERAL_REGISTERS));
+    memset(BenchStackBuffer, 0, StackUsage * sizeof(UINT64));
+
+    Registers->StackBuffer         = BenchStackBuffer;
+    Registers->GlobalVariablesList = BenchGlobalVariables;
+}
+
+/**
+ * @brief Runs a script by ScriptEngineExecute (the same loop as the debugger)
+ *
+ * @param CodeBuffer
+ * @param ExecutedInstructions
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BenchRunInterpreted(PSYMBOL_BUFFER CodeBuffer, UINT64 * ExecutedInstructions)
+{
+    SCRIPT_ENGINE_GENERAL_REGISTERS Registers;
+    ACTION_BUFFER                   ActionBuffer = {0};
+    SYMBOL                          ErrorSymbol  = {0};
+    UINT64                          ExecuteNumber = 0;
+
+    BenchResetRegisters(&Registers, MAX_STACK_BUFFER_COUNT);
+
+    for (UINT64 i = 0; i < CodeBuffer->Pointer;)
+    {
+        if (ScriptEngineExecute(&BenchGuestRegs, &ActionBuffer, &Registers, CodeBuffer, &i, &ErrorSymbol) == TRUE ||
+            Registers.StackIndx >= MAX_STACK_BUFFER_COUNT ||
+            ExecuteNumber >= MAX_EXECUTION_COUNT)
+        {
+            return FALSE;
+        }
+
+        ExecuteNumber++;
+    }
+
+    *ExecutedInstructions = ExecuteNumber;
+
+    return TRUE;
+}
+
+/**
+ * @brief Runs a script by the linked code
+ *
+ * @param LinkedCode
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BenchRunLinked(PVOID LinkedCode)
+{
+    SCRIPT_ENGINE_GENERAL_REGISTERS Registers;
+    ACTION_BUFFER                   ActionBuffer = {0};
+    SYMBOL                          ErrorSymbol  = {0};
+
+    BenchResetRegisters(&Registers, ScriptEngineGetLinkedStackUsage(LinkedCode));
+
+    return ScriptEngineExecuteLinked(&BenchGuestRegs, &ActionBuffer, &Registers, LinkedCode, &ErrorSymbol) ==
+           ScriptEngineLinkedExecutionCompleted;
+}
+
+/**
+ * @brief Runs a script by the native code of the JIT
+ *
+ * @param LinkedCode
+ * @param JitCode
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BenchRunJit(PVOID LinkedCode, PVOID JitCode)
+{
+    SCRIPT_ENGINE_GENERAL_REGISTERS Registers;
+    ACTION_BUFFER                   ActionBuffer = {0};
+    SYMBOL                          ErrorSymbol  = {0};
+
+    BenchResetRegisters(&Registers, ScriptEngineGetLinkedStackUsage(LinkedCode));
+
+    return ScriptEngineJitExecute(&BenchGuestRegs, &ActionBuffer, &Registers, JitCode, &ErrorSymbol) ==
+           ScriptEngineLinkedExecutionCompleted;
+}
+
+/**
+ * @brief Measures a script in all of the modes and shows the result
+ *
+ * @param Script
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BenchMeasureScript(const CHAR * Script)
+{
+    PSYMBOL_BUFFER CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse((CHAR *)Script);
+    PVOID          LinkedCode;
+    PVOID          JitCode;
+    UINT32         LinkedCodeSize;
+    UINT64         ExecutedInstructions = 0;
+    UINT64         Runs;
+    double         Start;
+    double         InterpretedSeconds;
+    double         LinkedSeconds;
+    double         JitSeconds;
+
+    if (CodeBuffer == NULL || CodeBuffer->Message)
+    {
+        printf("err, unable to compile the script: %s\n", CodeBuffer ? CodeBuffer->Message : "");
+        return FALSE;
+    }
+
+    LinkedCodeSize = ScriptEngineGetLinkedCodeSize(CodeBuffer->Pointer);
+    LinkedCode     = malloc(LinkedCodeSize);
+
+    if (LinkedCode == NULL || !ScriptEngineLink(CodeBuffer, LinkedCode, LinkedCodeSize))
+    {
+        printf("err, unable to link the script\n");
+        free(LinkedCode);
+        RemoveSymbolBuffer(CodeBuffer);
+        return FALSE;
+    }
+
+    JitCode = ScriptEngineJitCompile(LinkedCode);
+
+    if (JitCode == NULL)
+    {
+        printf("err, unable to translate the script to native code\n");
+        free(LinkedCode);
+        RemoveSymbolBuffer(CodeBuffer);
+        return FALSE;
+    }
+
+    //
+    // All of the modes run the script the same number of times
+    //
+    Start = BenchNow();
+
+    for (Runs = 0; BenchNow() - Start < BENCH_MINIMUM_SECONDS; Runs++)
+    {
+        if (!BenchRunInterpreted(CodeBuffer, &ExecutedInstructions))
+        {
+            printf("err, unable to run the script\n");
+            ScriptEngineJitFree(JitCode);
+            free(LinkedCode);
+            RemoveSymbolBuffer(CodeBuffer);
+            return FALSE;
+        }
+    }
+
+    InterpretedSeconds = BenchNow() - Start;
+    Start              = BenchNow();
+
+    for (UINT64 i = 0; i < Runs; i++)
+    {
+        if (!BenchRunLinked(LinkedCode))
+        {
+            printf("err, unable to run the linked script\n");
+            ScriptEngineJitFree(JitCode);
+            free(LinkedCode);
+            RemoveSymbolBuffer(CodeBuffer);
+            return FALSE;
+        }
+    }
+
+    LinkedSeconds = BenchNow() - Start;
+    Start         = BenchNow();
+
+    for (UINT64 i = 0; i < Runs; i++)
+    {
+        if (!BenchRunJit(LinkedCode, JitCode))
+        {
+            printf("err, unable to run the native code of the script\n");
+            ScriptEngineJitFree(JitCode);
+            free(LinkedCode);
+            RemoveSymbolBuffer(CodeBuffer);
+            return FALSE;
+        }
+    }
+
+    JitSeconds = BenchNow() - Start;
+
+    printf("%-60.60s %10llu %10.2f %10.2f %10.2f %8.2fx %8.2fx %10.1f %10.1f\n",
+           Script,
+           ExecutedInstructions,
+           InterpretedSeconds * 1e9 / (Runs * ExecutedInstructions),
+           LinkedSeconds * 1e9 / (Runs * ExecutedInstructions),
+           JitSeconds * 1e9 / (Runs * ExecutedInstructions),
+           InterpretedSeconds / LinkedSeconds,
+           InterpretedSeconds / JitSeconds,
+           LinkedSeconds * 1e9 / Runs,
+           JitSeconds * 1e9 / Runs);
+
+    ScriptEngineJitFree(JitCode);
+    free(LinkedCode);
+    RemoveSymbolBuffer(CodeBuffer);
+
+    return TRUE;
+}
+
+/**
+ * @brief Runs the native code of a counter script on a thread (simulates a core)
+ *
+ * @param Parameter BENCH_COUNTER_THREAD of the thread
+ * @return PVOID
+ */
+static PVOID
+BenchCounterThread(PVOID Parameter)
+{
+    BENCH_COUNTER_THREAD *          CounterThread = (BENCH_COUNTER_THREAD *)Parameter;
+    UINT32                          StackUsage    = ScriptEngineGetLinkedStackUsage(CounterThread->LinkedCode);
+    SCRIPT_ENGINE_GENERAL_REGISTERS Registers;
+    ACTION_BUFFER                   ActionBuffer = {0};
+    SYMBOL                          ErrorSymbol  = {0};
+
+    CounterThread->Succeeded = TRUE;
+
+    for (UINT32 i = 0; i < BENCH_COUNTER_RUNS; i++)
+    {
+        memset(&Registers, 0, sizeof(SCRIPT_ENGINE_GENERAL_REGISTERS));
+        memset(CounterThread->StackBuffer, 0, StackUsage * sizeof(UINT64));
+
+        Registers.StackBuffer         = CounterThread->StackBuffer;
+        Registers.GlobalVariablesList = BenchGlobalVariables;
+        Registers.PercpuVariablesList = CounterThread->PercpuVariables;
+
+        if (ScriptEngineJitExecute(&BenchGuestRegs, &ActionBuffer, &Registers, CounterThread->JitCode, &ErrorSymbol) !=
+            ScriptEngineLinkedExecutionCompleted)
+        {
+            CounterThread->Succeeded = FALSE;
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Runs a counter script on the threads at the same time and shows
+ * the time of each increment and the value of the counter
+ *
+ * @param Script
+ * @param IsPercpu Whether the counter is a percpu variable
+ * @param NumberOfThreads
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BenchMeasureCounter(const CHAR * Script, BOOLEAN IsPercpu, UINT32 NumberOfThreads)
+{
+    BENCH_COUNTER_THREAD CounterThreads[BENCH_COUNTER_MAXIMUM_THREADS] = {0};
+    PSYMBOL_BUFFER       CodeBuffer                                    = (PSYMBOL_BUFFER)ScriptEngineParse((CHAR *)Script);
+    UINT64 *             PercpuVariables                               = NULL;
+    UINT64 *             StackBuffers                                  = NULL;
+    PVOID                LinkedCode                                    = NULL;
+    PVOID                JitCode                                       = NULL;
+    UINT32               LinkedCodeSize;
+    UINT32               VariableIndex;
+    UINT64               Counter   = 0;
+    BOOLEAN              Succeeded = FALSE;
+    double               Start;
+    double               Seconds;
+
+    if (CodeBuffer == NULL || CodeBuffer->Message)
+    {
+        printf("err, unable to compile the script: %s\n", CodeBuffer ? CodeBuffer->Message : "");
+        return FALSE;
+    }
+
+    //
+    // Each thread has its own slice of MAX_VAR_COUNT percpu variables (the same
+    // as each core in the debugger), so the slices don't share cache lines
+    //
+    LinkedCodeSize  = ScriptEngineGetLinkedCodeSize(CodeBuffer->Pointer);
+    LinkedCode      = malloc(LinkedCodeSize);
+    PercpuVariables = aligned_alloc(64, NumberOfThreads * MAX_VAR_COUNT * sizeof(UINT64));
+    StackBuffers    = aligned_alloc(64, NumberOfThreads * MAX_STACK_BUFFER_COUNT * sizeof(UINT64));
+
+    if (LinkedCode == NULL || PercpuVariables == NULL || StackBuffers == NULL ||
+        !ScriptEngineLink(CodeBuffer, LinkedCode, LinkedCodeSize) ||
+        (JitCode = ScriptEngineJitCompile(LinkedCode)) == NULL)
+    {
+        printf("err, unable to translate the script to native code\n");
+        goto Cleanup;
+    }
+
+    memset(BenchGlobalVariables, 0, sizeof(BenchGlobalVariables));
+    memset(PercpuVariables, 0, NumberOfThreads * MAX_VAR_COUNT * sizeof(UINT64));
+
+    Start = BenchNow();
+
+    for (UINT32 i = 0; i < NumberOfThreads; i++)
+    {
+        CounterThreads[i].LinkedCode      = LinkedCode;
+        CounterThreads[i].JitCode         = JitCode;
+        CounterThreads[i].StackBuffer     = &StackBuffers[i * MAX_STACK_BUFFER_COUNT];
+        CounterThreads[i].PercpuVariables = &PercpuVariables[i * MAX_VAR_COUNT];
+
+        if (pthread_create(&CounterThreads[i].Thread, NULL, BenchCounterThread, &CounterThreads[i]) != 0)
+        {
+            printf("err, unable to create the threads\n");
+            NumberOfThreads = i;
+            break;
+        }
+    }
+
+    Succeeded = NumberOfThreads != 0;
+
+    for (UINT32 i = 0; i < NumberOfThreads; i++)
+    {
+        pthread_join(CounterThreads[i].Thread, NULL);
+        Succeeded = Succeeded && CounterThreads[i].Succeeded;
+    }
+
+    Seconds = BenchNow() - Start;
+
+    if (!Succeeded)
+    {
+        printf("err, unable to run the native code of the script\n");
+        goto Cleanup;
+    }
+
+    //
+    // The shared counter loses the increments of the threads that race with
+    // each other (it's the only global variable that the script changes), the
+    // percpu counter is reduced by summing the slices
+    //
+    if (IsPercpu && ScriptEngineGetPercpuVariableIndex(".benchPercpu", &VariableIndex))
+    {
+        for (UINT32 i = 0; i < NumberOfThreads; i++)
+        {
+            Counter += PercpuVariables[i * MAX_VAR_COUNT + VariableIndex];
+        }
+    }
+    else
+    {
+        for (UINT32 i = 0; i < MAX_VAR_COUNT; i++)
+        {
+            Counter += BenchGlobalVariables[i];
+        }
+    }
+
+    printf("%-60.60s %10u %10.2f %14llu %14llu\n",
+           Script,
+           NumberOfThreads,
+           Seconds * 1e9 / ((UINT64)NumberOfThreads * BENCH_COUNTER_RUNS),
+           Counter,
+           (UINT64)NumberOfThreads * BENCH_COUNTER_RUNS);
+
+Cleanup:
+    if (JitCode != NULL)
+    {
+        ScriptEngineJitFree(JitCode);
+    }
+
+    free(StackBuffers);
+    free(PercpuVariables);
+    free(LinkedCode);
+    RemoveSymbolBuffer(CodeBuffer);
+
+    return Succeeded;
+}
+
+/**
+ * @brief Measures a script of the copy benchmark by the linked code and shows the result
+ *
+ * @param Script
+ * @param Size Size of the copied structure
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BenchMeasureCopy(const CHAR * Script, UINT32 Size)
+{
+    PSYMBOL_BUFFER CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse((CHAR *)Script);
+    PVOID          LinkedCode = NULL;
+    UINT32         LinkedCodeSize;
+    UINT64         Runs;
+    UINT64         CheckedRanges;
+    BOOLEAN        Succeeded = FALSE;
+    double         Start;
+    double         Seconds;
+
+    if (CodeBuffer == NULL || CodeBuffer->Message)
+    {
+        printf("err, unable to compile the script: %s\n", CodeBuffer ? CodeBuffer->Message : "");
+        return FALSE;
+    }
+
+    LinkedCodeSize = ScriptEngineGetLinkedCodeSize(CodeBuffer->Pointer);
+    LinkedCode     = malloc(LinkedCodeSize);
+
+    if (LinkedCode == NULL || !ScriptEngineLink(CodeBuffer, LinkedCode, LinkedCodeSize))
+    {
+        printf("err, unable to link the script\n");
+        goto Cleanup;
+    }
+
+    for (UINT32 i = 0; i < BENCH_COPY_BUFFER_SIZE; i++)
+    {
+        BenchCopySource[i] = (BYTE)(i * 7 + 1);
+    }
+
+    memset(BenchCopyDestination, 0, BENCH_COPY_BUFFER_SIZE);
+
+    BenchCheckedRanges = 0;
+    Start              = BenchNow();
+
+    for (Runs = 0; BenchNow() - Start < BENCH_MINIMUM_SECONDS; Runs++)
+    {
+        if (!BenchRunLinked(LinkedCode))
+        {
+            printf("err, unable to run the linked script\n");
+            goto Cleanup;
+        }
+    }
+
+    Seconds       = BenchNow() - Start;
+    CheckedRanges = BenchCheckedRanges;
+
+    //
+    // Only the structure should be copied
+    //
+    if (memcmp(BenchCopyDestination, BenchCopySource, Size) != 0 ||
+        (Size < BENCH_COPY_BUFFER_SIZE && BenchCopyDestination[Size] != 0))
+    {
+        printf("err, the structure is not copied correctly\n");
+        goto Cleanup;
+    }
+
+    printf("%-60.60s %10u %12.1f %10.2f %12.1f\n",
+           Script,
+           Size,
+           Seconds * 1e9 / Runs,
+           (double)Size * Runs / Seconds / 1e9,
+           (double)CheckedRanges / Runs);
+
+    Succeeded = TRUE;
+
+Cleanup:
+    free(LinkedCode);
+    RemoveSymbolBuffer(CodeBuffer);
+
+    return Succeeded;
+}
+
+/**
+ * @brief Usage: script-eval-bench [number of the threads of the counter benchmark]
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int
+main(int argc, char ** argv)
+{
+    UINT32 NumberOfThreads = argc > 1 ? (UINT32)strtoul(argv[1], NULL, 0) : BENCH_COUNTER_DEFAULT_THREADS;
+
+    if (NumberOfThreads == 0 || NumberOfThreads > BENCH_COUNTER_MAXIMUM_THREADS)
+    {
+        printf("err, the number of the threads should be between 1 and %d\n", BENCH_COUNTER_MAXIMUM_THREADS);
+        return 1;
+    }
+
+    BenchGuestRegs.rax = 0x1;
+    BenchGuestRegs.rcx = 0x1234;
+    BenchGuestRegs.rdx = 0x4;
+
+    printf("%-60s %10s %10s %10s %10s %9s %9s %10s %10s\n",
+           "script",
+           "instrs",
+           "ns/instr",
+           "linked",
+           "jit",
+           "linked-x",
+           "jit-x",
+           "linked/run",
+           "jit/run");
+
+    for (UINT32 i = 0; i < sizeof(BenchScripts) / sizeof(BenchScripts[0]); i++)
+    {
+        if (!BenchMeasureScript(BenchScripts[i]))
+        {
+            return 1;
+        }
+    }
+
+    //
+    // The global variables should be assigned before they are read, so the
+    // shared counter is defined by a separate script
+    //
+    RemoveSymbolBuffer(ScriptEngineParse("{ .benchShared = 0; }"));
+
+    printf("\n%-60s %10s %10s %14s %14s\n",
+           "counter script",
+           "threads",
+           "ns/incr",
+           "counter",
+           "increments");
+
+    for (UINT32 i = 0; i < sizeof(BenchCounterScripts) / sizeof(BenchCounterScripts[0]); i++)
+    {
+        if (!BenchMeasureCounter(BenchCounterScripts[i].Script, BenchCounterScripts[i].IsPercpu, NumberOfThreads))
+        {
+            return 1;
+        }
+    }
+
+    BenchCopySource      = aligned_alloc(0x1000, BENCH_COPY_BUFFER_SIZE);
+    BenchCopyDestination = aligned_alloc(0x1000, BENCH_COPY_BUFFER_SIZE);
+
+    if (BenchCopySource == NULL || BenchCopyDestination == NULL)
+    {
+        printf("err, unable to allocate the buffers of the copy benchmark\n");
+        return 1;
+    }
+
+    BenchGuestRegs.rdi = (UINT64)BenchCopySource;
+    BenchGuestRegs.rsi = (UINT64)BenchCopyDestination;
+
+    printf("\n%-60s %10s %12s %10s %12s\n",
+           "copy script",
+           "bytes",
+           "ns/run",
+           "GB/s",
+           "checks/run");
+
+    for (UINT32 i = 0; i < sizeof(BenchCopyScripts) / sizeof(BenchCopyScripts[0]); i++)
+    {
+        if (!BenchMeasureCopy(BenchCopyScripts[i].Script, BenchCopyScripts[i].Size))
+        {
+            return 1;
+        }
+    }
+
+    free(BenchCopyDestination);
+    free(BenchCopySource);
+
+    return 0;
+}
@@ -0,0 +1,905 @@
+/**
+ * @file script-eval-fuzz.c
+ * @author M.H. Gholamrezaei (mh@hyperdbg.org)
+ * @brief Differential fuzzer of the script evaluator
+ * @details Generates random scripts and checks that ScriptEngineExecute, the
+ * linked code and the native code of the JIT have the same results (in both
+ * of the optimization levels)
+ * @version 0.19
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Maximum size of the generated scripts
+ */
+#define FUZZ_MAXIMUM_SCRIPT_SIZE 0x10000
+
+/**
+ * @brief Maximum size of the messages of each execution
+ */
+#define FUZZ_MAXIMUM_OUTPUT_SIZE 0x4000
+
+/**
+ * @brief Maximum number of the variables that are visible to a statement
+ */
+#define FUZZ_MAXIMUM_VARIABLES 32
+
+/**
+ * @brief Value of the entries of the stack buffer that are not zeroed before
+ * running the linked code (the entries after the stack usage)
+ */
+#define FUZZ_STACK_GARBAGE 0xcccccccccccccccc
+
+#define FUZZ_GLOBAL_COUNT   4
+#define FUZZ_PERCPU_COUNT   2
+#define FUZZ_LOCAL_COUNT    4
+#define FUZZ_FUNCTION_COUNT 2
+
+//
+// Variables and functions of libhyperdbg that are used by the evaluator
+//
+UINT64  g_CurrentExprEvalResult;
+BOOLEAN g_CurrentExprEvalResultHasError;
+
+/**
+ * @brief Messages of the current execution
+ */
+static CHAR   FuzzOutput[FUZZ_MAXIMUM_OUTPUT_SIZE];
+static UINT32 FuzzOutputSize;
+
+VOID
+ShowMessages(const char * Fmt, ...)
+{
+    va_list ArgList;
+    int     Length;
+
+    if (FuzzOutputSize >= sizeof(FuzzOutput) - 1)
+    {
+        return;
+    }
+
+    va_start(ArgList, Fmt);
+    Length = vsnprintf(FuzzOutput + FuzzOutputSize, sizeof(FuzzOutput) - FuzzOutputSize, Fmt, ArgList);
+    va_end(ArgList);
+
+    if (Length > 0)
+    {
+        FuzzOutputSize += (UINT32)Length;
+
+        if (FuzzOutputSize >= sizeof(FuzzOutput))
+        {
+            FuzzOutputSize = sizeof(FuzzOutput) - 1;
+        }
+    }
+}
+
+BOOLEAN
+CheckAccessValidityAndSafety(UINT64 TargetAddress, UINT32 Size)
+{
+    UNREFERENCED_PARAMETER(TargetAddress);
+    UNREFERENCED_PARAMETER(Size);
+
+    return FALSE;
+}
+
+UINT32
+HyperDbgLengthDisassemblerEngine(unsigned char * Address, UINT64 MaxLength, BOOLEAN Is32Bit)
+{
+    UNREFERENCED_PARAMETER(Address);
+    UNREFERENCED_PARAMETER(MaxLength);
+    UNREFERENCED_PARAMETER(Is32Bit);
+
+    return 0;
+}
+
+VOID
+SpinlockLock(volatile LONG * Lock)
+{
+    while (__sync_lock_test_and_set(Lock, 1))
+    {
+    }
+}
+
+VOID
+SpinlockUnlock(volatile LONG * Lock)
+{
+    __sync_lock_release(Lock);
+}
+
+VOID
+SpinlockLockWithCustomWait(volatile LONG * Lock, unsigned MaximumWait)
+{
+    UNREFERENCED_PARAMETER(MaximumWait);
+
+    SpinlockLock(Lock);
+}
+
+/**
+ * @brief Modes of executing a script
+ */
+typedef enum _FUZZ_MODE
+{
+    FuzzModeInterpreted = 0,
+    FuzzModeLinked,
+    FuzzModeJit,
+    FuzzModeCount,
+
+} FUZZ_MODE;
+
+static const CHAR * FuzzModeNames[] = {"interpreted", "linked", "jit"};
+
+/**
+ * @brief State of the script engine after executing a script
+ */
+typedef struct _FUZZ_RESULT
+{
+    SCRIPT_ENGINE_LINKED_EXECUTION_RESULT Result;
+    UINT64                                ErrorOperator; // only valid if the result is an error
+    UINT64                                StackIndx;
+    UINT64                                StackBaseIndx;
+    BOOLEAN                               IsStackUsageExceeded; // an entry after the stack usage is changed
+    UINT64                                StackBuffer[MAX_STACK_BUFFER_COUNT];
+    UINT64                                GlobalVariables[MAX_VAR_COUNT];
+    UINT64                                PercpuVariables[MAX_VAR_COUNT];
+    CHAR                                  Output[FUZZ_MAXIMUM_OUTPUT_SIZE];
+
+} FUZZ_RESULT, *PFUZZ_RESULT;
+
+/**
+ * @brief State of generating a script
+ */
+typedef struct _FUZZ_GENERATOR
+{
+    CHAR *       Script;
+    UINT32       Size;
+    const CHAR * Variables[FUZZ_MAXIMUM_VARIABLES];  // readable variables
+    BOOLEAN      Assignable[FUZZ_MAXIMUM_VARIABLES]; // the loop counters are not assigned
+    UINT32       VariableCount;
+    UINT32       FunctionCount; // functions that can be called
+    UINT32       LoopCount;     // used for the names of the loop counters
+    CHAR         Names[64][32]; // storage of the names of the loop counters
+
+} FUZZ_GENERATOR, *PFUZZ_GENERATOR;
+
+static UINT64      FuzzState;
+static CHAR        FuzzScript[FUZZ_MAXIMUM_SCRIPT_SIZE];
+static UINT64      FuzzStackBuffer[MAX_STACK_BUFFER_COUNT];
+static UINT64      FuzzGlobalVariables[MAX_VAR_COUNT];
+static UINT64      FuzzPercpuVariables[MAX_VAR_COUNT];
+static GUEST_REGS  FuzzGuestRegs;
+static FUZZ_RESULT FuzzResults[2][FuzzModeCount];
+static UINT64      FuzzSkippedScripts;
+
+static const CHAR * FuzzGlobalNames[FUZZ_GLOBAL_COUNT] = {".fuzzGlobal0", ".fuzzGlobal1", ".fuzzGlobal2", ".fuzzGlobal3"};
+static const CHAR * FuzzPercpuNames[FUZZ_PERCPU_COUNT] = {".fuzzPercpu0", ".fuzzPercpu1"};
+static const CHAR * FuzzLocalNames[FUZZ_LOCAL_COUNT]   = {"fuzzLocal0", "fuzzLocal1", "fuzzLocal2", "fuzzLocal3"};
+static const CHAR * FuzzParameterNames[]               = {"fuzzParameter0", "fuzzParameter1"};
+
+static const CHAR * FuzzTypes[] = {
+    "int",
+    "unsigned int",
+    "char",
+    "unsigned char",
+    "short",
+    "unsigned short",
+    "long long",
+    "unsigned long long",
+    "bool",
+};
+
+static const CHAR * FuzzBinaryOperators[] = {"+", "-", "*", "/", "%", "&", "|", "^", "<<", ">>"};
+
+//
+// The comparisons and the logical operators are only allowed in the conditions
+//
+static const CHAR * FuzzComparisonOperators[] = {"<", ">", "<=", ">=", "==", "!="};
+
+static const CHAR * FuzzLogicalOperators[] = {"&&", "||"};
+
+static const CHAR * FuzzUnaryOperators[] = {"-", "~", "!"};
+
+static const CHAR * FuzzRegisters[] = {"@rax", "@rcx", "@rdx", "@rbx", "@rsi", "@rdi", "@r8", "@r15"};
+
+/**
+ * @brief Returns a random number (xorshift64)
+ *
+ * @return UINT64
+ */
+static UINT64
+FuzzRandom(void)
+{
+    FuzzState ^= FuzzState << 13;
+    FuzzState ^= FuzzState >> 7;
+    FuzzState ^= FuzzState << 17;
+
+    return FuzzState;
+}
+
+/**
+ * @brief Returns a random number that is less than Bound
+ *
+ * @param Bound
+ * @return UINT32
+ */
+static UINT32
+FuzzChoose(UINT32 Bound)
+{
+    return (UINT32)(FuzzRandom() % Bound);
+}
+
+/**
+ * @brief Appends a formatted string to the script
+ *
+ * @param Generator
+ * @param Fmt
+ * @return VOID
+ */
+static VOID
+FuzzAppend(PFUZZ_GENERATOR Generator, const CHAR * Fmt, ...)
+{
+    va_list ArgList;
+    int     Length;
+
+    va_start(ArgList, Fmt);
+    Length = vsnprintf(Generator->Script + Generator->Size, FUZZ_MAXIMUM_SCRIPT_SIZE - Generator->Size, Fmt, ArgList);
+    va_end(ArgList);
+
+    if (Length > 0 && Generator->Size + Length < FUZZ_MAXIMUM_SCRIPT_SIZE)
+    {
+        Generator->Size += Length;
+    }
+}
+
+/**
+ * @brief Appends a random number (small numbers, boundaries of the types and
+ * random 64-bit numbers)
+ *
+ * @param Generator
+ * @return VOID
+ */
+static VOID
+FuzzNumber(PFUZZ_GENERATOR Generator)
+{
+    static const UINT64 Boundaries[] = {
+        0x7f, 0x80, 0xff, 0x7fff, 0x8000, 0xffff, 0x7fffffff, 0x80000000, 0xffffffff, 0x7fffffffffffffff, 0x8000000000000000, 0xffffffffffffffff};
+
+    switch (FuzzChoose(4))
+    {
+    case 0:
+    case 1:
+        FuzzAppend(Generator, "0x%llx", FuzzRandom() % 0x10);
+        break;
+    case 2:
+        FuzzAppend(Generator, "0x%llx", Boundaries[FuzzChoose(sizeof(Boundaries) / sizeof(Boundaries[0]))]);
+        break;
+    default:
+        FuzzAppend(Generator, "0x%llx", FuzzRandom());
+        break;
+    }
+}
+
+/**
+ * @brief Appends a random expression
+ *
+ * @param Generator
+ * @param Depth
+ * @return VOID
+ */
+static VOID
+FuzzExpression(PFUZZ_GENERATOR Generator, UINT32 Depth)
+{
+    UINT32 Choice = FuzzChoose(Depth == 0 ? 4 : 8);
+
+    switch (Choice)
+    {
+    case 0:
+        FuzzNumber(Generator);
+        break;
+    case 1:
+    case 2:
+        FuzzAppend(Generator, "%s", Generator->Variables[FuzzChoose(Generator->VariableCount)]);
+        break;
+    case 3:
+        FuzzAppend(Generator, "%s", FuzzChoose(8) == 0 ? "$pid" : FuzzRegisters[FuzzChoose(sizeof(FuzzRegisters) / sizeof(FuzzRegisters[0]))]);
+        break;
+    case 4:
+        FuzzAppend(Generator, "%s(", FuzzUnaryOperators[FuzzChoose(sizeof(FuzzUnaryOperators) / sizeof(FuzzUnaryOperators[0]))]);
+        FuzzExpression(Generator, Depth - 1);
+        FuzzAppend(Generator, ")");
+        break;
+    default:
+        if (Choice == 5 && Generator->FunctionCount != 0)
+        {
+            FuzzAppend(Generator, "fuzzFunction%u(", FuzzChoose(Generator->FunctionCount));
+            FuzzExpression(Generator, Depth - 1);
+            FuzzAppend(Generator, ", ");
+            FuzzExpression(Generator, Depth - 1);
+            FuzzAppend(Generator, ")");
+        }
+        else
+        {
+            FuzzAppend(Generator, "(");
+            FuzzExpression(Generator, Depth - 1);
+            FuzzAppend(Generator, " %s ", FuzzBinaryOperators[FuzzChoose(sizeof(FuzzBinaryOperators) / sizeof(FuzzBinaryOperators[0]))]);
+            FuzzExpression(Generator, Depth - 1);
+            FuzzAppend(Generator, ")");
+        }
+        break;
+    }
+}
+
+/**
+ * @brief Appends a random condition (of the if statements)
+ *
+ * @param Generator
+ * @param Depth
+ * @return VOID
+ */
+static VOID
+FuzzCondition(PFUZZ_GENERATOR Generator, UINT32 Depth)
+{
+    switch (FuzzChoose(Depth == 0 ? 2 : 4))
+    {
+    case 0:
+        FuzzExpression(Generator, 2);
+        break;
+    case 1:
+        FuzzAppend(Generator, "(");
+        FuzzExpression(Generator, 2);
+        FuzzAppend(Generator, " %s ", FuzzComparisonOperators[FuzzChoose(sizeof(FuzzComparisonOperators) / sizeof(FuzzComparisonOperators[0]))]);
+        FuzzExpression(Generator, 2);
+        FuzzAppend(Generator, ")");
+        break;
+    case 2:
+        FuzzAppend(Generator, "!(");
+        FuzzCondition(Generator, Depth - 1);
+        FuzzAppend(Generator, ")");
+        break;
+    default:
+        FuzzAppend(Generator, "(");
+        FuzzCondition(Generator, Depth - 1);
+        FuzzAppend(Generator, " %s ", FuzzLogicalOperators[FuzzChoose(sizeof(FuzzLogicalOperators) / sizeof(FuzzLogicalOperators[0]))]);
+        FuzzCondition(Generator, Depth - 1);
+        FuzzAppend(Generator, ")");
+        break;
+    }
+}
+
+/**
+ * @brief Appends the name of a random variable that can be assigned
+ *
+ * @param Generator
+ * @return BOOLEAN FALSE if there is no such variable
+ */
+static BOOLEAN
+FuzzAssignableVariable(PFUZZ_GENERATOR Generator)
+{
+    UINT32 Start = FuzzChoose(Generator->VariableCount);
+
+    for (UINT32 i = 0; i < Generator->VariableCount; i++)
+    {
+        UINT32 Index = (Start + i) % Generator->VariableCount;
+
+        if (Generator->Assignable[Index])
+        {
+            FuzzAppend(Generator, "%s", Generator->Variables[Index]);
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Adds a variable to the visible variables
+ *
+ * @param Generator
+ * @param Name
+ * @param Assignable
+ * @return VOID
+ */
+static VOID
+FuzzAddVariable(PFUZZ_GENERATOR Generator, const CHAR * Name, BOOLEAN Assignable)
+{
+    if (Generator->VariableCount < FUZZ_MAXIMUM_VARIABLES)
+    {
+        Generator->Variables[Generator->VariableCount]  = Name;
+        Generator->Assignable[Generator->VariableCount] = Assignable;
+        Generator->VariableCount++;
+    }
+}
+
+static VOID
+FuzzStatements(PFUZZ_GENERATOR Generator, UINT32 Depth, UINT32 Count);
+
+/**
+ * @brief Appends a random statement
+ *
+ * @param Generator
+ * @param Depth
+ * @return VOID
+ */
+static VOID
+FuzzStatement(PFUZZ_GENERATOR Generator, UINT32 Depth)
+{
+    static const CHAR * CompoundOperators[] = {"+=", "-=", "*=", "&=", "|=", "^=", "<<=", ">>="};
+
+    UINT32 VariableCount = Generator->VariableCount;
+    CHAR * Counter;
+
+    switch (FuzzChoose(Depth == 0 ? 4 : 7))
+    {
+    case 0:
+    case 1:
+        if (FuzzAssignableVariable(Generator))
+        {
+            FuzzAppend(Generator, " = ");
+            FuzzExpression(Generator, 3);
+            FuzzAppend(Generator, "; ");
+        }
+        break;
+
+    case 2:
+        if (FuzzAssignableVariable(Generator))
+        {
+            switch (FuzzChoose(3))
+            {
+            case 0:
+                FuzzAppend(Generator, "++; ");
+                break;
+            case 1:
+                FuzzAppend(Generator, "--; ");
+                break;
+            default:
+                FuzzAppend(Generator, " %s ", CompoundOperators[FuzzChoose(sizeof(CompoundOperators) / sizeof(CompoundOperators[0]))]);
+                FuzzExpression(Generator, 2);
+                FuzzAppend(Generator, "; ");
+                break;
+            }
+        }
+        break;
+
+    case 3:
+        FuzzAppend(Generator, "printf(\"%%llx\\n\", ");
+        FuzzExpression(Generator, 2);
+        FuzzAppend(Generator, "); ");
+        break;
+
+    case 4:
+    case 5:
+        FuzzAppend(Generator, "if (");
+        FuzzCondition(Generator, 2);
+        FuzzAppend(Generator, ") { ");
+        FuzzStatements(Generator, Depth - 1, 1 + FuzzChoose(3));
+        FuzzAppend(Generator, "} ");
+
+        if (FuzzChoose(2))
+        {
+            FuzzAppend(Generator, "else { ");
+            FuzzStatements(Generator, Depth - 1, 1 + FuzzChoose(3));
+            FuzzAppend(Generator, "} ");
+        }
+        break;
+
+    default:
+
+        //
+        // The loops are bounded, so the counters are not assigned by the body
+        //
+        if (Generator->LoopCount >= sizeof(Generator->Names) / sizeof(Generator->Names[0]))
+        {
+            break;
+        }
+
+        Counter = Generator->Names[Generator->LoopCount];
+        snprintf(Counter, sizeof(Generator->Names[0]), "fuzzCounter%u", Generator->LoopCount);
+        Generator->LoopCount++;
+
+        FuzzAppend(Generator, "for (int %s = 0; %s < 0x%x; %s++) { ", Counter, Counter, FuzzChoose(8), Counter);
+        FuzzAddVariable(Generator, Counter, FALSE);
+        FuzzStatements(Generator, Depth - 1, 1 + FuzzChoose(3));
+        FuzzAppend(Generator, "} ");
+        break;
+    }
+
+    Generator->VariableCount = VariableCount;
+}
+
+/**
+ * @brief Appends random statements
+ *
+ * @param Generator
+ * @param Depth
+ * @param Count
+ * @return VOID
+ */
+static VOID
+FuzzStatements(PFUZZ_GENERATOR Generator, UINT32 Depth, UINT32 Count)
+{
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        FuzzStatement(Generator, Depth);
+    }
+}
+
+/**
+ * @brief Generates a random script
+ *
+ * @details The globals are assigned before they're used, the functions only
+ * use their parameters and the globals (and only call the previous functions)
+ *
+ * @return VOID
+ */
+static VOID
+FuzzGenerateScript(void)
+{
+    FUZZ_GENERATOR Generator = {0};
+    UINT32         FunctionCount;
+
+    Generator.Script = FuzzScript;
+
+    FuzzAppend(&Generator, "{ percpu %s, %s; ", FuzzPercpuNames[0], FuzzPercpuNames[1]);
+
+    for (UINT32 i = 0; i < FUZZ_GLOBAL_COUNT; i++)
+    {
+        FuzzAppend(&Generator, "%s = ", FuzzGlobalNames[i]);
+        FuzzNumber(&Generator);
+        FuzzAppend(&Generator, "; ");
+        FuzzAddVariable(&Generator, FuzzGlobalNames[i], TRUE);
+    }
+
+    for (UINT32 i = 0; i < FUZZ_PERCPU_COUNT; i++)
+    {
+        FuzzAppend(&Generator, "%s = ", FuzzPercpuNames[i]);
+        FuzzNumber(&Generator);
+        FuzzAppend(&Generator, "; ");
+        FuzzAddVariable(&Generator, FuzzPercpuNames[i], TRUE);
+    }
+
+    FunctionCount = FuzzChoose(FUZZ_FUNCTION_COUNT + 1);
+
+    for (UINT32 i = 0; i < FunctionCount; i++)
+    {
+        UINT32 VariableCount = Generator.VariableCount;
+
+        FuzzAppend(&Generator, "int fuzzFunction%u(int %s, int %s) { ", i, FuzzParameterNames[0], FuzzParameterNames[1]);
+        FuzzAddVariable(&Generator, FuzzParameterNames[0], TRUE);
+        FuzzAddVariable(&Generator, FuzzParameterNames[1], TRUE);
+        FuzzStatements(&Generator, 2, FuzzChoose(3));
+        FuzzAppend(&Generator, "return ");
+        FuzzExpression(&Generator, 2);
+        FuzzAppend(&Generator, "; } ");
+
+        Generator.VariableCount = VariableCount;
+        Generator.FunctionCount++;
+    }
+
+    for (UINT32 i = 0; i < FUZZ_LOCAL_COUNT; i++)
+    {
+        FuzzAppend(&Generator, "%s %s = ", FuzzTypes[FuzzChoose(sizeof(FuzzTypes) / sizeof(FuzzTypes[0]))], FuzzLocalNames[i]);
+        FuzzExpression(&Generator, 1);
+        FuzzAppend(&Generator, "; ");
+        FuzzAddVariable(&Generator, FuzzLocalNames[i], TRUE);
+    }
+
+    FuzzStatements(&Generator, 3, 2 + FuzzChoose(8));
+
+    FuzzAppend(&Generator, "}");
+}
+
+/**
+ * @brief Resets the registers of the script engine before each run
+ *
+ * @param Registers
+ * @param StackUsage Number of the entries of the stack buffer that are zeroed
+ * (the same as the debugger)
+ * @return VOID
+ */
+static VOID
+FuzzResetRegisters(SCRIPT_ENGINE_GENERAL_REGISTERS * Registers, UINT32 StackUsage)
+{
+    memset(Registers, 0, sizeof(SCRIPT_ENGINE_GENERAL_REGISTERS));
+    memset(FuzzStackBuffer, 0, StackUsage * sizeof(UINT64));
+
+    for (UINT32 i = StackUsage; i < MAX_STACK_BUFFER_COUNT; i++)
+    {
+        FuzzStackBuffer[i] = FUZZ_STACK_GARBAGE;
+    }
+
+    memset(FuzzGlobalVariables, 0, sizeof(FuzzGlobalVariables));
+    memset(FuzzPercpuVariables, 0, sizeof(FuzzPercpuVariables));
+
+    Registers->StackBuffer         = FuzzStackBuffer;
+    Registers->GlobalVariablesList = FuzzGlobalVariables;
+    Registers->PercpuVariablesList = FuzzPercpuVariables;
+
+    FuzzOutputSize = 0;
+    FuzzOutput[0]  = '\0';
+}
+
+/**
+ * @brief Runs a script in a mode and saves the state of the script engine
+ *
+ * @param CodeBuffer
+ * @param LinkedCode
+ * @param JitCode
+ * @param Mode
+ * @param Result
+ * @return VOID
+ */
+static VOID
+FuzzRun(PSYMBOL_BUFFER CodeBuffer, PVOID LinkedCode, PVOID JitCode, FUZZ_MODE Mode, PFUZZ_RESULT Result)
+{
+    SCRIPT_ENGINE_GENERAL_REGISTERS Registers;
+    ACTION_BUFFER                   ActionBuffer  = {0};
+    SYMBOL                          ErrorSymbol   = {0};
+    UINT64                          ExecuteNumber = 0;
+    UINT32                          StackUsage    = MAX_STACK_BUFFER_COUNT;
+
+    //
+    // The linked code is run with only the used entries of the stack
+    // buffer zeroed, the other entries should not be changed
+    //
+    if (Mode != FuzzModeInterpreted)
+    {
+        StackUsage = ScriptEngineGetLinkedStackUsage(LinkedCode);
+    }
+
+    FuzzResetRegisters(&Registers, StackUsage);
+
+    Result->Result = ScriptEngineLinkedExecutionCompleted;
+
+    switch (Mode)
+    {
+    case FuzzModeInterpreted:
+
+        //
+        // The same loop as the debugger
+        //
+        for (UINT64 i = 0; i < CodeBuffer->Pointer;)
+        {
+            if (ScriptEngineExecute(&FuzzGuestRegs, &ActionBuffer, &Registers, CodeBuffer, &i, &ErrorSymbol) == TRUE)
+            {
+                Result->Result = ScriptEngineLinkedExecutionError;
+                break;
+            }
+
+            if (Registers.StackIndx >= MAX_STACK_BUFFER_COUNT)
+            {
+                Result->Result = ScriptEngineLinkedExecutionStackOverflow;
+                break;
+            }
+
+            if (ExecuteNumber++ >= MAX_EXECUTION_COUNT)
+            {
+                Result->Result = ScriptEngineLinkedExecutionExecutionCountExceeded;
+                break;
+            }
+        }
+        break;
+
+    case FuzzModeLinked:
+        Result->Result = ScriptEngineExecuteLinked(&FuzzGuestRegs, &ActionBuffer, &Registers, LinkedCode, &ErrorSymbol);
+        break;
+
+    default:
+        Result->Result = ScriptEngineJitExecute(&FuzzGuestRegs, &ActionBuffer, &Registers, JitCode, &ErrorSymbol);
+        break;
+    }
+
+    Result->ErrorOperator = Result->Result == ScriptEngineLinkedExecutionError ? ErrorSymbol.Value : 0;
+    Result->StackIndx     = Registers.StackIndx;
+    Result->StackBaseIndx = Registers.StackBaseIndx;
+
+    memcpy(Result->StackBuffer, FuzzStackBuffer, sizeof(FuzzStackBuffer));
+
+    Result->IsStackUsageExceeded = FALSE;
+
+    for (UINT32 i = StackUsage; i < MAX_STACK_BUFFER_COUNT; i++)
+    {
+        if (Result->StackBuffer[i] != FUZZ_STACK_GARBAGE)
+        {
+            Result->IsStackUsageExceeded = TRUE;
+        }
+
+        Result->StackBuffer[i] = 0;
+    }
+    memcpy(Result->GlobalVariables, FuzzGlobalVariables, sizeof(FuzzGlobalVariables));
+    memcpy(Result->PercpuVariables, FuzzPercpuVariables, sizeof(FuzzPercpuVariables));
+    memcpy(Result->Output, FuzzOutput, FuzzOutputSize + 1);
+}
+
+/**
+ * @brief Compares the results of two executions
+ *
+ * @param First
+ * @param Second
+ * @return const CHAR* The name of the first difference, NULL if they're the same
+ */
+static const CHAR *
+FuzzCompare(PFUZZ_RESULT First, PFUZZ_RESULT Second)
+{
+    if (First->Result != Second->Result)
+    {
+        return "result";
+    }
+
+    if (First->ErrorOperator != Second->ErrorOperator)
+    {
+        return "error operator";
+    }
+
+    if (memcmp(First->GlobalVariables, Second->GlobalVariables, sizeof(First->GlobalVariables)) != 0)
+    {
+        return "globals";
+    }
+
+    if (memcmp(First->PercpuVariables, Second->PercpuVariables, sizeof(First->PercpuVariables)) != 0)
+    {
+        return "percpu variables";
+    }
+
+    if (First->IsStackUsageExceeded || Second->IsStackUsageExceeded)
+    {
+        return "stack usage";
+    }
+
+    if (First->StackIndx != Second->StackIndx || First->StackBaseIndx != Second->StackBaseIndx ||
+        memcmp(First->StackBuffer, Second->StackBuffer, sizeof(First->StackBuffer)) != 0)
+    {
+        return "stack";
+    }
+
+    if (strcmp(First->Output, Second->Output) != 0)
+    {
+        return "output";
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Generates a script and checks all of the modes
+ *
+ * @param Iteration
+ * @return BOOLEAN FALSE if the modes have different results
+ */
+static BOOLEAN
+FuzzIteration(UINT64 Iteration)
+{
+    PSYMBOL_BUFFER CodeBuffer;
+    PVOID          LinkedCode;
+    PVOID          JitCode;
+    UINT32         LinkedCodeSize;
+    const CHAR *   Difference;
+
+    FuzzGenerateScript();
+
+    for (UINT32 k = 0; k < sizeof(GUEST_REGS) / sizeof(UINT64); k++)
+    {
+        ((UINT64 *)&FuzzGuestRegs)[k] = FuzzChoose(2) ? FuzzRandom() : FuzzRandom() % 0x10;
+    }
+
+    for (UINT32 Level = 0; Level < 2; Level++)
+    {
+        ScriptEngineSetOptimizationLevel(Level);
+
+        CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse(FuzzScript);
+
+        if (CodeBuffer == NULL)
+        {
+            printf("err, unable to compile the script (iteration %llu)\n%s\n", Iteration, FuzzScript);
+            return FALSE;
+        }
+
+        if (CodeBuffer->Message)
+        {
+            //
+            // The generator doesn't know all of the rules of the compiler
+            // (e.g., the shifts of the constants), these scripts are skipped
+            //
+            FuzzSkippedScripts++;
+            RemoveSymbolBuffer(CodeBuffer);
+            return TRUE;
+        }
+
+        LinkedCodeSize = ScriptEngineGetLinkedCodeSize(CodeBuffer->Pointer);
+        LinkedCode     = malloc(LinkedCodeSize);
+
+        if (LinkedCode == NULL || !ScriptEngineLink(CodeBuffer, LinkedCode, LinkedCodeSize))
+        {
+            printf("err, unable to link the script (iteration %llu)\n%s\n", Iteration, FuzzScript);
+            free(LinkedCode);
+            RemoveSymbolBuffer(CodeBuffer);
+            return FALSE;
+        }
+
+        JitCode = ScriptEngineJitCompile(LinkedCode);
+
+        if (JitCode == NULL)
+        {
+            printf("err, unable to translate the script to native code (iteration %llu)\n%s\n", Iteration, FuzzScript);
+            free(LinkedCode);
+            RemoveSymbolBuffer(CodeBuffer);
+            return FALSE;
+        }
+
+        for (UINT32 Mode = 0; Mode < FuzzModeCount; Mode++)
+        {
+            FuzzRun(CodeBuffer, LinkedCode, JitCode, (FUZZ_MODE)Mode, &FuzzResults[Level][Mode]);
+        }
+
+        ScriptEngineJitFree(JitCode);
+        free(LinkedCode);
+        RemoveSymbolBuffer(CodeBuffer);
+
+        for (UINT32 Mode = 1; Mode < FuzzModeCount; Mode++)
+        {
+            Difference = FuzzCompare(&FuzzResults[Level][FuzzModeInterpreted], &FuzzResults[Level][Mode]);
+
+            if (Difference != NULL)
+            {
+                printf("err, different %s of %s and %s at O%u (iteration %llu)\n%s\n",
+                       Difference,
+                       FuzzModeNames[FuzzModeInterpreted],
+                       FuzzModeNames[Mode],
+                       Level,
+                       Iteration,
+                       FuzzScript);
+                return FALSE;
+            }
+        }
+    }
+
+    //
+    // The optimizer may change the temps, but not the results
+    //
+    if (FuzzResults[0][FuzzModeInterpreted].Result != FuzzResults[1][FuzzModeInterpreted].Result ||
+        memcmp(FuzzResults[0][FuzzModeInterpreted].GlobalVariables,
+               FuzzResults[1][FuzzModeInterpreted].GlobalVariables,
+               sizeof(FuzzResults[0][FuzzModeInterpreted].GlobalVariables)) != 0 ||
+        memcmp(FuzzResults[0][FuzzModeInterpreted].PercpuVariables,
+               FuzzResults[1][FuzzModeInterpreted].PercpuVariables,
+               sizeof(FuzzResults[0][FuzzModeInterpreted].PercpuVariables)) != 0 ||
+        strcmp(FuzzResults[0][FuzzModeInterpreted].Output, FuzzResults[1][FuzzModeInterpreted].Output) != 0)
+    {
+        printf("err, different results of O0 and O1 (iteration %llu)\n%s\n", Iteration, FuzzScript);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Usage: script-eval-fuzz [seed] [iterations]
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int
+main(int argc, char ** argv)
+{
+    UINT64 Seed       = argc > 1 ? strtoull(argv[1], NULL, 0) : (UINT64)time(NULL);
+    UINT64 Iterations = argc > 2 ? strtoull(argv[2], NULL, 0) : 10000;
+
+    FuzzState = Seed != 0 ? Seed : 1;
+
+    printf("seed: %llu, iterations: %llu\n", Seed, Iterations);
+
+    for (UINT64 i = 0; i < Iterations; i++)
+    {
+        if (!FuzzIteration(i))
+        {
+            return 1;
+        }
+    }
+
+    printf("no differences (%llu of %llu scripts are skipped)\n", FuzzSkippedScripts, Iterations);
+
+    return 0;
+}
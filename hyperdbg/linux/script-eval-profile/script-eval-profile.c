@@ -0,0 +1,440 @@
+/**
+ * @file script-eval-profile.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Profiler of the scripts in the user-mode evaluator
+ * @details The script is run by ScriptEngineExecute with a profile entry for
+ * each symbol, then the executions and the cycles of the operators are shown
+ * per source line (by the line map of the compiler) and per opcode
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Default number of the runs of the script
+ */
+#define PROFILE_DEFAULT_RUNS 1000
+
+/**
+ * @brief Maximum size of the script file
+ */
+#define PROFILE_MAXIMUM_SCRIPT_SIZE 0x100000
+
+//
+// Variables and functions of libhyperdbg that are used by the evaluator
+//
+UINT64  g_CurrentExprEvalResult;
+BOOLEAN g_CurrentExprEvalResultHasError;
+
+VOID
+ShowMessages(const char * Fmt, ...)
+{
+    va_list ArgList;
+
+    va_start(ArgList, Fmt);
+    vprintf(Fmt, ArgList);
+    va_end(ArgList);
+}
+
+BOOLEAN
+CheckAccessValidityAndSafety(UINT64 TargetAddress, UINT32 Size)
+{
+    UNREFERENCED_PARAMETER(TargetAddress);
+    UNREFERENCED_PARAMETER(Size);
+
+    return FALSE;
+}
+
+UINT32
+HyperDbgLengthDisassemblerEngine(unsigned char * Address, UINT64 MaxLength, BOOLEAN Is32Bit)
+{
+    UNREFERENCED_PARAMETER(Address);
+    UNREFERENCED_PARAMETER(MaxLength);
+    UNREFERENCED_PARAMETER(Is32Bit);
+
+    return 0;
+}
+
+VOID
+SpinlockLock(volatile LONG * Lock)
+{
+    while (__sync_lock_test_and_set(Lock, 1))
+    {
+    }
+}
+
+VOID
+SpinlockUnlock(volatile LONG * Lock)
+{
+    __sync_lock_release(Lock);
+}
+
+VOID
+SpinlockLockWithCustomWait(volatile LONG * Lock, unsigned MaximumWait)
+{
+    UNREFERENCED_PARAMETER(MaximumWait);
+
+    SpinlockLock(Lock);
+}
+
+/**
+ * @brief The script that is profiled if no script file is given
+ */
+static const CHAR * ProfileDefaultScript =
+    "int total = 0;\n"
+    "\n"
+    "for (int idx = 0; idx < 200; idx++) {\n"
+    "    if (idx % 3 == 0) {\n"
+    "        total += idx * idx;\n"
+    "    } else {\n"
+    "        total = total ^ @rcx;\n"
+    "    }\n"
+    "}\n"
+    "\n"
+    "profileTotal = total;\n";
+
+static UINT64 ProfileStackBuffer[MAX_STACK_BUFFER_COUNT];
+static UINT64 ProfileGlobalVariables[MAX_VAR_COUNT];
+
+/**
+ * @brief Registers of the guest
+ */
+static GUEST_REGS ProfileGuestRegs;
+
+/**
+ * @brief Profile of an opcode
+ */
+typedef struct _PROFILE_OPCODE
+{
+    UINT64                      Opcode;
+    SCRIPT_ENGINE_PROFILE_ENTRY Profile;
+
+} PROFILE_OPCODE, *PPROFILE_OPCODE;
+
+/**
+ * @brief Reads the script file
+ *
+ * @param FileName
+ * @return CHAR * The script (should be freed) or NULL
+ */
+static CHAR *
+ProfileReadScript(const CHAR * FileName)
+{
+    FILE * File;
+    CHAR * Script;
+    size_t Size;
+
+    File = fopen(FileName, "rb");
+
+    if (File == NULL)
+    {
+        return NULL;
+    }
+
+    Script = malloc(PROFILE_MAXIMUM_SCRIPT_SIZE + 1);
+
+    if (Script == NULL)
+    {
+        fclose(File);
+        return NULL;
+    }
+
+    Size         = fread(Script, 1, PROFILE_MAXIMUM_SCRIPT_SIZE, File);
+    Script[Size] = '\0';
+
+    fclose(File);
+
+    return Script;
+}
+
+/**
+ * @brief Runs a script by ScriptEngineExecute (the same loop as the debugger)
+ * with the profile entries
+ *
+ * @param CodeBuffer
+ * @param Profile
+ * @param ExecutedInstructions
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ProfileRun(PSYMBOL_BUFFER CodeBuffer, PSCRIPT_ENGINE_PROFILE_ENTRY Profile, UINT64 * ExecutedInstructions)
+{
+    SCRIPT_ENGINE_GENERAL_REGISTERS Registers     = {0};
+    ACTION_BUFFER                   ActionBuffer  = {0};
+    SYMBOL                          ErrorSymbol   = {0};
+    UINT64                          ExecuteNumber = 0;
+
+    memset(ProfileStackBuffer, 0, sizeof(ProfileStackBuffer));
+
+    Registers.StackBuffer         = ProfileStackBuffer;
+    Registers.GlobalVariablesList = ProfileGlobalVariables;
+    Registers.Profile             = Profile;
+
+    for (UINT64 i = 0; i < CodeBuffer->Pointer;)
+    {
+        if (ScriptEngineExecute(&ProfileGuestRegs, &ActionBuffer, &Registers, CodeBuffer, &i, &ErrorSymbol) == TRUE)
+        {
+            printf("err, ScriptEngineExecute, function = %s\n", FunctionNames[ErrorSymbol.Value]);
+            return FALSE;
+        }
+        else if (Registers.StackIndx >= MAX_STACK_BUFFER_COUNT || ExecuteNumber >= MAX_EXECUTION_COUNT)
+        {
+            printf("err, the script exceeds the limits of the script engine\n");
+            return FALSE;
+        }
+
+        ExecuteNumber++;
+    }
+
+    *ExecutedInstructions += ExecuteNumber;
+
+    return TRUE;
+}
+
+/**
+ * @brief Shows the profile of each source line of the script
+ *
+ * @param Script
+ * @param CodeBuffer
+ * @param Profile
+ * @param TotalCycles
+ * @return UINT64 The sum of the executions of the lines
+ */
+static UINT64
+ProfileShowLines(const CHAR * Script, PSYMBOL_BUFFER CodeBuffer, PSCRIPT_ENGINE_PROFILE_ENTRY Profile, UINT64 TotalCycles)
+{
+    PSCRIPT_ENGINE_PROFILE_ENTRY LinesProfile;
+    UINT32                       NumberOfLines;
+    UINT64                       Executions = 0;
+    const CHAR *                 LineStart  = Script;
+
+    NumberOfLines = ScriptEngineAccumulateProfileByLine(CodeBuffer, NULL, NULL, 0);
+    LinesProfile  = calloc(NumberOfLines + 1, sizeof(SCRIPT_ENGINE_PROFILE_ENTRY));
+
+    if (LinesProfile == NULL)
+    {
+        return 0;
+    }
+
+    ScriptEngineAccumulateProfileByLine(CodeBuffer, Profile, LinesProfile, NumberOfLines);
+
+    printf("line        count       cycles  cycles%%  source\n");
+
+    for (UINT32 Line = 0; *LineStart != '\0' || Line < NumberOfLines; Line++)
+    {
+        const CHAR * LineEnd = strchr(LineStart, '\n');
+        int          Length  = LineEnd ? (int)(LineEnd - LineStart) : (int)strlen(LineStart);
+
+        if (Line < NumberOfLines && LinesProfile[Line].Count != 0)
+        {
+            printf("%4u %12llu %12llu %7.2f%%  %.*s\n",
+                   Line + 1,
+                   LinesProfile[Line].Count,
+                   LinesProfile[Line].Cycles,
+                   TotalCycles ? LinesProfile[Line].Cycles * 100.0 / TotalCycles : 0.0,
+                   Length,
+                   LineStart);
+
+            Executions += LinesProfile[Line].Count;
+        }
+        else
+        {
+            printf("%4u %12s %12s %8s  %.*s\n", Line + 1, "", "", "", Length, LineStart);
+        }
+
+        LineStart = LineEnd ? LineEnd + 1 : LineStart + Length;
+    }
+
+    free(LinesProfile);
+
+    return Executions;
+}
+
+/**
+ * @brief Compares the profiles of two opcodes by their cycles (descending)
+ *
+ * @param First
+ * @param Second
+ * @return int
+ */
+static int
+ProfileCompareOpcodes(const void * First, const void * Second)
+{
+    const PROFILE_OPCODE * FirstOpcode  = First;
+    const PROFILE_OPCODE * SecondOpcode = Second;
+
+    if (FirstOpcode->Profile.Cycles != SecondOpcode->Profile.Cycles)
+    {
+        return FirstOpcode->Profile.Cycles < SecondOpcode->Profile.Cycles ? 1 : -1;
+    }
+
+    return FirstOpcode->Opcode < SecondOpcode->Opcode ? -1 : FirstOpcode->Opcode > SecondOpcode->Opcode;
+}
+
+/**
+ * @brief Shows the profile of each opcode of the script
+ *
+ * @param CodeBuffer
+ * @param Profile
+ * @param TotalCycles
+ * @return UINT64 The sum of the executions of the opcodes
+ */
+static UINT64
+ProfileShowOpcodes(PSYMBOL_BUFFER CodeBuffer, PSCRIPT_ENGINE_PROFILE_ENTRY Profile, UINT64 TotalCycles)
+{
+    const UINT32     NumberOfOpcodes = sizeof(FunctionNames) / sizeof(FunctionNames[0]);
+    PPROFILE_OPCODE  Opcodes;
+    UINT64           Executions = 0;
+
+    Opcodes = calloc(NumberOfOpcodes, sizeof(PROFILE_OPCODE));
+
+    if (Opcodes == NULL)
+    {
+        return 0;
+    }
+
+    for (UINT32 i = 0; i < NumberOfOpcodes; i++)
+    {
+        Opcodes[i].Opcode = i;
+    }
+
+    for (UINT32 i = 0; i < CodeBuffer->Pointer; i++)
+    {
+        if (Profile[i].Count != 0 && CodeBuffer->Head[i].Type == SYMBOL_SEMANTIC_RULE_TYPE &&
+            CodeBuffer->Head[i].Value < NumberOfOpcodes)
+        {
+            Opcodes[CodeBuffer->Head[i].Value].Profile.Count += Profile[i].Count;
+            Opcodes[CodeBuffer->Head[i].Value].Profile.Cycles += Profile[i].Cycles;
+        }
+    }
+
+    qsort(Opcodes, NumberOfOpcodes, sizeof(PROFILE_OPCODE), ProfileCompareOpcodes);
+
+    printf("opcode                                count       cycles  cycles%%  cycles/op\n");
+
+    for (UINT32 i = 0; i < NumberOfOpcodes && Opcodes[i].Profile.Count != 0; i++)
+    {
+        printf("%-30s %12llu %12llu %7.2f%% %10.1f\n",
+               FunctionNames[Opcodes[i].Opcode],
+               Opcodes[i].Profile.Count,
+               Opcodes[i].Profile.Cycles,
+               TotalCycles ? Opcodes[i].Profile.Cycles * 100.0 / TotalCycles : 0.0,
+               (double)Opcodes[i].Profile.Cycles / Opcodes[i].Profile.Count);
+
+        Executions += Opcodes[i].Profile.Count;
+    }
+
+    free(Opcodes);
+
+    return Executions;
+}
+
+/**
+ * @brief Main function of the profiler
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int
+main(int argc, char ** argv)
+{
+    CHAR *                       Script               = (CHAR *)ProfileDefaultScript;
+    UINT32                       Runs                 = PROFILE_DEFAULT_RUNS;
+    UINT64                       ExecutedInstructions = 0;
+    UINT64                       TotalCycles          = 0;
+    UINT64                       LineExecutions;
+    UINT64                       OpcodeExecutions;
+    PSYMBOL_BUFFER               CodeBuffer;
+    PSCRIPT_ENGINE_PROFILE_ENTRY Profile;
+    int                          Status = 0;
+
+    if (argc > 1 && strcmp(argv[1], "-") != 0)
+    {
+        Script = ProfileReadScript(argv[1]);
+
+        if (Script == NULL)
+        {
+            printf("err, unable to read the script file '%s'\n", argv[1]);
+            return 1;
+        }
+    }
+
+    if (argc > 2)
+    {
+        Runs = (UINT32)strtoul(argv[2], NULL, 0);
+    }
+
+    if (argc > 3)
+    {
+        ScriptEngineSetOptimizationLevel((UINT32)strtoul(argv[3], NULL, 0));
+    }
+
+    ProfileGuestRegs.rcx = 0x1234;
+
+    CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse(Script);
+
+    if (CodeBuffer->Message != NULL)
+    {
+        printf("%s\n", CodeBuffer->Message);
+        return 1;
+    }
+
+    Profile = calloc(CodeBuffer->Pointer, sizeof(SCRIPT_ENGINE_PROFILE_ENTRY));
+
+    if (Profile == NULL)
+    {
+        return 1;
+    }
+
+    for (UINT32 Run = 0; Run < Runs; Run++)
+    {
+        if (!ProfileRun(CodeBuffer, Profile, &ExecutedInstructions))
+        {
+            return 1;
+        }
+    }
+
+    for (UINT32 i = 0; i < CodeBuffer->Pointer; i++)
+    {
+        TotalCycles += Profile[i].Cycles;
+    }
+
+    printf("runs: %u, executed instructions: %llu, cycles: %llu (%.1f cycles/run)\n\n",
+           Runs,
+           ExecutedInstructions,
+           TotalCycles,
+           Runs ? (double)TotalCycles / Runs : 0.0);
+
+    LineExecutions = ProfileShowLines(Script, CodeBuffer, Profile, TotalCycles);
+
+    printf("\n");
+
+    OpcodeExecutions = ProfileShowOpcodes(CodeBuffer, Profile, TotalCycles);
+
+    //
+    // Each executed instruction should be counted once for its line and
+    // once for its opcode
+    //
+    if (LineExecutions != ExecutedInstructions || OpcodeExecutions != ExecutedInstructions)
+    {
+        printf("\nerr, the profile doesn't match the executed instructions (lines: %llu, opcodes: %llu)\n",
+               LineExecutions,
+               OpcodeExecutions);
+
+        Status = 1;
+    }
+
+    free(Profile);
+    RemoveSymbolBuffer(CodeBuffer);
+
+    if (Script != ProfileDefaultScript)
+    {
+        free(Script);
+    }
+
+    return Status;
+}
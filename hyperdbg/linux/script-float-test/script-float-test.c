@@ -0,0 +1,512 @@
+/**
+ * @file script-float-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Differential tests of the floating-point backends of the evaluator
+ * @details The operators are executed by the software-float path (the path
+ * of the kernel) and by the native float and double (the path of the user
+ * mode), the errors and the raw bits of the results should be the same
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+#ifndef SCRIPT_ENGINE_NATIVE_FLOAT
+#    error "the native floating-point backend is not available on this architecture"
+#endif
+
+/**
+ * @brief Number of the shown differences
+ */
+#define TEST_MAXIMUM_SHOWN_DIFFERENCES 20
+
+//
+// Variables and functions of libhyperdbg that are used by the evaluator
+//
+UINT64  g_CurrentExprEvalResult;
+BOOLEAN g_CurrentExprEvalResultHasError;
+
+VOID
+ShowMessages(const char * Fmt, ...)
+{
+    va_list ArgList;
+
+    va_start(ArgList, Fmt);
+    vprintf(Fmt, ArgList);
+    va_end(ArgList);
+}
+
+BOOLEAN
+CheckAccessValidityAndSafety(UINT64 TargetAddress, UINT32 Size)
+{
+    UNREFERENCED_PARAMETER(TargetAddress);
+    UNREFERENCED_PARAMETER(Size);
+
+    return FALSE;
+}
+
+UINT32
+HyperDbgLengthDisassemblerEngine(unsigned char * Address, UINT64 MaxLength, BOOLEAN Is32Bit)
+{
+    UNREFERENCED_PARAMETER(Address);
+    UNREFERENCED_PARAMETER(MaxLength);
+    UNREFERENCED_PARAMETER(Is32Bit);
+
+    return 0;
+}
+
+VOID
+SpinlockLock(volatile LONG * Lock)
+{
+    while (__sync_lock_test_and_set(Lock, 1))
+    {
+    }
+}
+
+VOID
+SpinlockUnlock(volatile LONG * Lock)
+{
+    __sync_lock_release(Lock);
+}
+
+VOID
+SpinlockLockWithCustomWait(volatile LONG * Lock, unsigned MaximumWait)
+{
+    UNREFERENCED_PARAMETER(MaximumWait);
+
+    SpinlockLock(Lock);
+}
+
+/**
+ * @brief The tested operators
+ */
+static const struct
+{
+    UINT64       Opcode;
+    const CHAR * Name;
+    BOOLEAN      IsComparison;
+} TestOperators[] = {
+    {FUNC_ADD_FLOAT, "add", FALSE},
+    {FUNC_SUB_FLOAT, "sub", FALSE},
+    {FUNC_MUL_FLOAT, "mul", FALSE},
+    {FUNC_DIV_FLOAT, "div", FALSE},
+    {FUNC_GT_FLOAT, "gt", TRUE},
+    {FUNC_LT_FLOAT, "lt", TRUE},
+    {FUNC_EGT_FLOAT, "egt", TRUE},
+    {FUNC_ELT_FLOAT, "elt", TRUE},
+    {FUNC_EQUAL_FLOAT, "equal", TRUE},
+    {FUNC_NEQ_FLOAT, "neq", TRUE},
+};
+
+/**
+ * @brief The tested kinds of the operands and the results, a float result of
+ * a double operand is not generated by the compiler, but it is still tested
+ */
+static const struct
+{
+    UINT64 LeftKind;
+    UINT64 RightKind;
+    UINT64 ResultKind;
+} TestKinds[] = {
+    {SYMBOL_VALUE_KIND_FLOAT32, SYMBOL_VALUE_KIND_FLOAT32, SYMBOL_VALUE_KIND_FLOAT32},
+    {SYMBOL_VALUE_KIND_FLOAT32, SYMBOL_VALUE_KIND_FLOAT64, SYMBOL_VALUE_KIND_FLOAT64},
+    {SYMBOL_VALUE_KIND_FLOAT64, SYMBOL_VALUE_KIND_FLOAT32, SYMBOL_VALUE_KIND_FLOAT64},
+    {SYMBOL_VALUE_KIND_FLOAT64, SYMBOL_VALUE_KIND_FLOAT64, SYMBOL_VALUE_KIND_FLOAT64},
+    {SYMBOL_VALUE_KIND_FLOAT32, SYMBOL_VALUE_KIND_FLOAT32, SYMBOL_VALUE_KIND_FLOAT64},
+    {SYMBOL_VALUE_KIND_FLOAT64, SYMBOL_VALUE_KIND_FLOAT64, SYMBOL_VALUE_KIND_FLOAT32},
+};
+
+/**
+ * @brief State of the random number generator
+ */
+static UINT64 TestState;
+
+/**
+ * @brief Statistics of the tests
+ */
+static UINT64 TestExecutions;
+static UINT64 TestErrors;
+static UINT64 TestDifferences;
+
+/**
+ * @brief Returns a random number (xorshift64)
+ *
+ * @return UINT64
+ */
+static UINT64
+TestRandom(void)
+{
+    TestState ^= TestState << 13;
+    TestState ^= TestState >> 7;
+    TestState ^= TestState << 17;
+
+    return TestState;
+}
+
+/**
+ * @brief Returns a random number that is less than Bound
+ *
+ * @param Bound
+ * @return UINT32
+ */
+static UINT32
+TestChoose(UINT32 Bound)
+{
+    return (UINT32)(TestRandom() % Bound);
+}
+
+/**
+ * @brief Returns the raw bits of a random operand
+ * @details Most of the operands are near each other, near one or at the ends
+ * of the range of the exponents (subnormals, overflows and underflows), so
+ * the cancellations and the rounding of the results are tested
+ *
+ * @param ValueKind
+ * @param Other The other operand
+ * @return UINT64
+ */
+static UINT64
+TestOperand(UINT64 ValueKind, double Other)
+{
+    BOOLEAN IsSingle     = ValueKind == SYMBOL_VALUE_KIND_FLOAT32;
+    UINT32  ExponentBits = IsSingle ? 8 : 11;
+    UINT32  FractionBits = IsSingle ? 23 : 52;
+    UINT64  ExponentMask = (1ULL << ExponentBits) - 1;
+    UINT64  FractionMask = (1ULL << FractionBits) - 1;
+    UINT64  Sign         = TestRandom() & 1;
+    UINT64  Fraction     = TestRandom() & FractionMask;
+    UINT64  Exponent;
+    UINT64  Bits;
+    float   Single;
+
+    switch (TestChoose(8))
+    {
+    case 0:
+        //
+        // Any exponent (including the infinities and the NaNs)
+        //
+        Exponent = TestRandom() & ExponentMask;
+        break;
+
+    case 1:
+        //
+        // Zeros and subnormals
+        //
+        Exponent = 0;
+        if (TestChoose(4) == 0)
+        {
+            Fraction = 0;
+        }
+        else if (TestChoose(2) == 0)
+        {
+            Fraction = Fraction >> TestChoose(FractionBits);
+        }
+        break;
+
+    case 2:
+        //
+        // Near the largest exponent
+        //
+        Exponent = ExponentMask - 1 - TestChoose(4);
+        break;
+
+    case 3:
+        //
+        // Near the smallest normal exponent
+        //
+        Exponent = 1 + TestChoose(4);
+        break;
+
+    case 4:
+    case 5:
+        //
+        // Near the other operand (the same value with a few changed bits)
+        //
+        if (IsSingle)
+        {
+            Single = (float)Other;
+            memcpy(&Bits, &Single, sizeof(Single));
+            Bits &= 0xffffffffULL;
+        }
+        else
+        {
+            memcpy(&Bits, &Other, sizeof(Bits));
+        }
+
+        Bits = Bits ^ (TestRandom() & ((1ULL << TestChoose(FractionBits / 2 + 1)) - 1));
+
+        if (TestChoose(4) == 0)
+        {
+            Bits = Bits ^ (1ULL << (FractionBits + ExponentBits));
+        }
+
+        return Bits;
+
+    default:
+        //
+        // Near one
+        //
+        Exponent = (ExponentMask >> 1) - 8 + TestChoose(17);
+        if (TestChoose(2) == 0)
+        {
+            Fraction = Fraction & ~((1ULL << TestChoose(FractionBits)) - 1);
+        }
+        break;
+    }
+
+    Bits = (Sign << (FractionBits + ExponentBits)) | (Exponent << FractionBits) | Fraction;
+
+    return Bits;
+}
+
+/**
+ * @brief Returns a raw value as a double
+ *
+ * @param ValueKind
+ * @param Bits
+ * @return double
+ */
+static double
+TestToDouble(UINT64 ValueKind, UINT64 Bits)
+{
+    UINT32 Single32 = (UINT32)Bits;
+    float  Single;
+    double Double;
+
+    if (ValueKind == SYMBOL_VALUE_KIND_FLOAT32)
+    {
+        memcpy(&Single, &Single32, sizeof(Single));
+        return Single;
+    }
+
+    memcpy(&Double, &Bits, sizeof(Double));
+    return Double;
+}
+
+/**
+ * @brief Execute an operator by both of the backends and compare the results
+ *
+ * @param Operator Index of the operator
+ * @param Kinds Index of the kinds
+ * @param LeftBits
+ * @param RightBits
+ * @return VOID
+ */
+static VOID
+TestCompare(UINT32 Operator, UINT32 Kinds, UINT64 LeftBits, UINT64 RightBits)
+{
+    UINT64  ResultKind   = TestOperators[Operator].IsComparison ? SYMBOL_VALUE_KIND_INTEGER : TestKinds[Kinds].ResultKind;
+    UINT64  SoftResult   = 0;
+    UINT64  NativeResult = 0;
+    BOOLEAN SoftSucceeded;
+    BOOLEAN NativeSucceeded;
+
+    SoftSucceeded   = ScriptEngineSoftFloatExecuteBinary(TestOperators[Operator].Opcode,
+                                                       TestKinds[Kinds].LeftKind,
+                                                       LeftBits,
+                                                       TestKinds[Kinds].RightKind,
+                                                       RightBits,
+                                                       ResultKind,
+                                                       &SoftResult);
+    NativeSucceeded = ScriptEngineNativeFloatExecuteBinary(TestOperators[Operator].Opcode,
+                                                           TestKinds[Kinds].LeftKind,
+                                                           LeftBits,
+                                                           TestKinds[Kinds].RightKind,
+                                                           RightBits,
+                                                           ResultKind,
+                                                           &NativeResult);
+
+    TestExecutions++;
+
+    if (!SoftSucceeded)
+    {
+        TestErrors++;
+    }
+
+    if (SoftSucceeded == NativeSucceeded && (!SoftSucceeded || SoftResult == NativeResult))
+    {
+        return;
+    }
+
+    if (TestDifferences++ < TEST_MAXIMUM_SHOWN_DIFFERENCES)
+    {
+        printf("difference: %s %s %llx, %s %llx -> %s: soft %s %llx, native %s %llx\n",
+               TestOperators[Operator].Name,
+               TestKinds[Kinds].LeftKind == SYMBOL_VALUE_KIND_FLOAT32 ? "f32" : "f64",
+               LeftBits,
+               TestKinds[Kinds].RightKind == SYMBOL_VALUE_KIND_FLOAT32 ? "f32" : "f64",
+               RightBits,
+               ResultKind == SYMBOL_VALUE_KIND_INTEGER ? "int" : (ResultKind == SYMBOL_VALUE_KIND_FLOAT32 ? "f32" : "f64"),
+               SoftSucceeded ? "ok" : "error",
+               SoftResult,
+               NativeSucceeded ? "ok" : "error",
+               NativeResult);
+    }
+}
+
+/**
+ * @brief Compare the backends for the operands that are always tested (the
+ * zeros, the ends of the ranges, the infinities and the NaNs)
+ *
+ * @return VOID
+ */
+static VOID
+TestDirected(void)
+{
+    static const UINT64 Singles[] = {
+        0x00000000, 0x80000000, 0x00000001, 0x80000001, 0x007fffff, 0x00800000, 0x3f800000,
+        0xbf800000, 0x3f800001, 0x3effffff, 0x40490fdb, 0x7f7fffff, 0xff7fffff, 0x7f800000,
+        0xff800000, 0x7fc00000, 0x7f800001, 0x33800000, 0x34000000, 0x4b800000,
+    };
+    static const UINT64 Doubles[] = {
+        0x0000000000000000ULL, 0x8000000000000000ULL, 0x0000000000000001ULL, 0x000fffffffffffffULL,
+        0x0010000000000000ULL, 0x3ff0000000000000ULL, 0xbff0000000000000ULL, 0x3ff0000000000001ULL,
+        0x3fefffffffffffffULL, 0x400921fb54442d18ULL, 0x7fefffffffffffffULL, 0xffefffffffffffffULL,
+        0x7ff0000000000000ULL, 0xfff0000000000000ULL, 0x7ff8000000000000ULL, 0x3ca0000000000000ULL,
+        0x47efffffe0000000ULL, 0x36a0000000000000ULL, 0x3810000000000000ULL, 0x4340000000000000ULL,
+    };
+
+    for (UINT32 Operator = 0; Operator < sizeof(TestOperators) / sizeof(TestOperators[0]); Operator++)
+    {
+        for (UINT32 Kinds = 0; Kinds < sizeof(TestKinds) / sizeof(TestKinds[0]); Kinds++)
+        {
+            const UINT64 * Left      = TestKinds[Kinds].LeftKind == SYMBOL_VALUE_KIND_FLOAT32 ? Singles : Doubles;
+            const UINT64 * Right     = TestKinds[Kinds].RightKind == SYMBOL_VALUE_KIND_FLOAT32 ? Singles : Doubles;
+            UINT32         LeftSize  = TestKinds[Kinds].LeftKind == SYMBOL_VALUE_KIND_FLOAT32 ? sizeof(Singles) / sizeof(Singles[0]) : sizeof(Doubles) / sizeof(Doubles[0]);
+            UINT32         RightSize = TestKinds[Kinds].RightKind == SYMBOL_VALUE_KIND_FLOAT32 ? sizeof(Singles) / sizeof(Singles[0]) : sizeof(Doubles) / sizeof(Doubles[0]);
+
+            for (UINT32 i = 0; i < LeftSize; i++)
+            {
+                for (UINT32 j = 0; j < RightSize; j++)
+                {
+                    TestCompare(Operator, Kinds, Left[i], Right[j]);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Compare the backends for random operands
+ *
+ * @param Iterations
+ * @return VOID
+ */
+static VOID
+TestRandomized(UINT64 Iterations)
+{
+    for (UINT64 i = 0; i < Iterations; i++)
+    {
+        UINT32 Operator  = TestChoose(sizeof(TestOperators) / sizeof(TestOperators[0]));
+        UINT32 Kinds     = TestChoose(sizeof(TestKinds) / sizeof(TestKinds[0]));
+        UINT64 LeftBits  = TestOperand(TestKinds[Kinds].LeftKind, 1.0);
+        UINT64 RightBits = TestOperand(TestKinds[Kinds].RightKind, TestToDouble(TestKinds[Kinds].LeftKind, LeftBits));
+
+        TestCompare(Operator, Kinds, LeftBits, RightBits);
+    }
+}
+
+/**
+ * @brief Returns the current time in seconds
+ *
+ * @return double
+ */
+static double
+TestNow(void)
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (double)Time.tv_sec + (double)Time.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Shows the time of each operation of both of the backends
+ *
+ * @return VOID
+ */
+static VOID
+TestMeasure(void)
+{
+    BOOLEAN (*Backends[])(UINT64, UINT64, UINT64, UINT64, UINT64, UINT64, PUINT64) = {
+        ScriptEngineSoftFloatExecuteBinary,
+        ScriptEngineNativeFloatExecuteBinary,
+    };
+    static const CHAR * BackendNames[] = {"soft", "native"};
+    UINT64              Operands[256];
+    volatile UINT64     Sink = 0;
+
+    for (UINT32 i = 0; i < sizeof(Operands) / sizeof(Operands[0]); i++)
+    {
+        Operands[i] = TestOperand(SYMBOL_VALUE_KIND_FLOAT64, 1.0);
+    }
+
+    printf("\n%-8s %-8s %10s\n", "backend", "operator", "ns/op");
+
+    for (UINT32 Backend = 0; Backend < 2; Backend++)
+    {
+        for (UINT32 Operator = 0; Operator < 4; Operator++)
+        {
+            UINT64 Result = 0;
+            UINT64 Runs   = 0;
+            double Start  = TestNow();
+            double Seconds;
+
+            do
+            {
+                for (UINT32 i = 0; i < sizeof(Operands) / sizeof(Operands[0]); i++)
+                {
+                    Backends[Backend](TestOperators[Operator].Opcode,
+                                      SYMBOL_VALUE_KIND_FLOAT64,
+                                      Operands[i],
+                                      SYMBOL_VALUE_KIND_FLOAT64,
+                                      Operands[(i + 1) % (sizeof(Operands) / sizeof(Operands[0]))],
+                                      SYMBOL_VALUE_KIND_FLOAT64,
+                                      &Result);
+                    Sink = Sink + Result;
+                }
+
+                Runs    = Runs + sizeof(Operands) / sizeof(Operands[0]);
+                Seconds = TestNow() - Start;
+
+            } while (Seconds < 0.2);
+
+            printf("%-8s %-8s %10.2f\n", BackendNames[Backend], TestOperators[Operator].Name, Seconds * 1e9 / Runs);
+        }
+    }
+}
+
+/**
+ * @brief Usage: script-float-test [seed] [iterations]
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int
+main(int argc, char ** argv)
+{
+    UINT64 Seed       = argc > 1 ? strtoull(argv[1], NULL, 0) : (UINT64)time(NULL);
+    UINT64 Iterations = argc > 2 ? strtoull(argv[2], NULL, 0) : 1000000;
+
+    TestState = Seed != 0 ? Seed : 1;
+
+    printf("seed: %llu, iterations: %llu\n", Seed, Iterations);
+
+    TestDirected();
+    TestRandomized(Iterations);
+
+    printf("operations: %llu, errors: %llu, differences: %llu\n", TestExecutions, TestErrors, TestDifferences);
+
+    if (TestDifferences != 0)
+    {
+        return 1;
+    }
+
+    TestMeasure();
+
+    return 0;
+}
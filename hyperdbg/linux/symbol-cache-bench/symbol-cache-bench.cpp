@@ -0,0 +1,597 @@
+/**
+ * @file symbol-cache-bench.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Benchmark of the symbol cache
+ * @details The symbols and the types of a kernel-sized set of modules (one
+ * large module and many small modules) are saved to the cache files (the
+ * first load of the PDB files), and then the cache files are opened (the
+ * next reloads) and the names, the sizes of the types and the offsets of
+ * the fields are resolved from them and compared with the delivered ones
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief A type of the symbols of the benchmark
+ */
+typedef struct _BENCH_TYPE
+{
+    std::string                                 Name;
+    UINT64                                      Size;
+    std::vector<std::pair<std::string, UINT32>> Fields;
+
+} BENCH_TYPE, *PBENCH_TYPE;
+
+/**
+ * @brief A symbol of the benchmark
+ */
+typedef struct _BENCH_SYMBOL
+{
+    std::string Name;
+    UINT64      Rva;
+    UINT32      Size;
+
+} BENCH_SYMBOL, *PBENCH_SYMBOL;
+
+/**
+ * @brief A module of the symbols of the benchmark
+ */
+typedef struct _BENCH_MODULE
+{
+    std::string               Name;
+    std::string               GuidAndAge;
+    std::string               CachePath;
+    UINT64                    PdbFileSize;
+    std::vector<BENCH_SYMBOL> Symbols;
+    std::vector<BENCH_TYPE>   Types;
+    PSYMBOL_CACHE             Cache;
+
+} BENCH_MODULE, *PBENCH_MODULE;
+
+//
+// Global Variables
+//
+static std::vector<BENCH_MODULE> g_Modules;
+static UINT64                    g_Random = 0x9e3779b97f4a7c15ull;
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+BenchNanoseconds()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + (UINT64)Time.tv_nsec;
+}
+
+/**
+ * @brief Get a random number (xorshift64)
+ *
+ * @return UINT64
+ */
+static UINT64
+BenchRandom()
+{
+    g_Random ^= g_Random << 13;
+    g_Random ^= g_Random >> 7;
+    g_Random ^= g_Random << 17;
+
+    return g_Random;
+}
+
+/**
+ * @brief Convert a name to lowercase (the names are case-insensitive)
+ *
+ * @param Name
+ *
+ * @return std::string
+ */
+static std::string
+BenchLowercase(const std::string & Name)
+{
+    std::string Result = Name;
+
+    std::transform(Result.begin(), Result.end(), Result.begin(), [](unsigned char c) { return (char)tolower(c); });
+
+    return Result;
+}
+
+/**
+ * @brief Create the modules and their symbols and types
+ * @details Some of the symbols have the same name (case-insensitive) as the
+ * other symbols, and some of the types have a forward declaration (without
+ * a size and fields) before them, the same as the PDB files
+ *
+ * @param ModulesCount
+ * @param KernelSymbolsCount
+ * @param ModuleSymbolsCount
+ * @param KernelTypesCount
+ * @param ModuleTypesCount
+ *
+ * @return VOID
+ */
+static VOID
+BenchCreateModules(UINT32 ModulesCount,
+                   UINT32 KernelSymbolsCount,
+                   UINT32 ModuleSymbolsCount,
+                   UINT32 KernelTypesCount,
+                   UINT32 ModuleTypesCount)
+{
+    for (UINT32 i = 0; i < ModulesCount; i++)
+    {
+        BENCH_MODULE Module       = {};
+        UINT32       SymbolsCount = i == 0 ? KernelSymbolsCount : ModuleSymbolsCount;
+        UINT32       TypesCount   = i == 0 ? KernelTypesCount : ModuleTypesCount;
+        UINT64       Rva          = 0x1000;
+        CHAR         Name[64];
+
+        Module.Name = i == 0 ? "ntkrnlmp" : "driver" + std::to_string(i);
+
+        snprintf(Name, sizeof(Name), "%016llx%016llx1", (unsigned long long)BenchRandom(), (unsigned long long)BenchRandom());
+
+        Module.GuidAndAge  = BenchLowercase(Name);
+        Module.PdbFileSize = 0x100000 + BenchRandom() % 0x4000000;
+
+        for (UINT32 j = 0; j < SymbolsCount; j++)
+        {
+            BENCH_SYMBOL Symbol;
+
+            snprintf(Name, sizeof(Name), "%sFunction%u", i == 0 ? "Ki" : "Drv", j);
+
+            Symbol.Name = Name;
+            Symbol.Rva  = Rva;
+            Symbol.Size = (UINT32)(BenchRandom() % 512);
+
+            Module.Symbols.push_back(Symbol);
+
+            if (BenchRandom() % 128 == 0)
+            {
+                //
+                // A symbol with the same name (in uppercase)
+                //
+                Symbol.Name = BenchLowercase(Symbol.Name);
+                Symbol.Rva += 8;
+                std::transform(Symbol.Name.begin(), Symbol.Name.end(), Symbol.Name.begin(), [](unsigned char c) { return (char)toupper(c); });
+                Module.Symbols.push_back(Symbol);
+            }
+
+            Rva += 16 + BenchRandom() % 496;
+        }
+
+        for (SIZE_T j = Module.Symbols.size(); j > 1; j--)
+        {
+            std::swap(Module.Symbols[j - 1], Module.Symbols[BenchRandom() % j]);
+        }
+
+        for (UINT32 j = 0; j < TypesCount; j++)
+        {
+            BENCH_TYPE Type;
+            UINT32     Offset = 0;
+
+            snprintf(Name, sizeof(Name), "_%s_STRUCT_%u", i == 0 ? "K" : "DRV", j);
+
+            Type.Name = Name;
+            Type.Size = 0;
+
+            if (BenchRandom() % 16 == 0)
+            {
+                //
+                // The forward declaration of the type
+                //
+                Module.Types.push_back(Type);
+            }
+
+            for (UINT32 k = 0, Count = 1 + (UINT32)(BenchRandom() % (i == 0 ? 48 : 16)); k < Count; k++)
+            {
+                snprintf(Name, sizeof(Name), "Field%u", k);
+
+                Type.Fields.push_back({Name, (BenchRandom() % 8 == 0) ? (UINT32)(BenchRandom() % 64) : Offset});
+                Offset += 8;
+            }
+
+            Type.Size = Offset;
+
+            Module.Types.push_back(Type);
+        }
+
+        g_Modules.push_back(std::move(Module));
+    }
+}
+
+/**
+ * @brief Save the symbols and the types of the modules to their cache files
+ *
+ * @param Directory
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BenchWriteCaches(const CHAR * Directory)
+{
+    for (BENCH_MODULE & Module : g_Modules)
+    {
+        SYMBOL_CACHE_BUILDER Builder;
+
+        for (BENCH_SYMBOL & Symbol : Module.Symbols)
+        {
+            SymCacheBuilderAddSymbol(&Builder, Symbol.Name.c_str(), Symbol.Rva, Symbol.Size);
+        }
+
+        for (BENCH_TYPE & Type : Module.Types)
+        {
+            SymCacheBuilderAddType(&Builder, Type.Name.c_str(), Type.Size);
+
+            for (auto & Field : Type.Fields)
+            {
+                SymCacheBuilderAddField(&Builder, Field.first.c_str(), Field.second);
+            }
+        }
+
+        Module.CachePath = std::string(Directory) + "/" + Module.Name + SYMBOL_CACHE_FILE_EXTENSION;
+
+        if (!SymCacheWrite(&Builder, Module.CachePath.c_str(), Module.GuidAndAge.c_str(), Module.PdbFileSize))
+        {
+            printf("err, unable to write '%s'\n", Module.CachePath.c_str());
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Callback of the enumeration of the symbols of a cache
+ *
+ * @param Name
+ * @param Rva
+ * @param Size
+ * @param Context
+ *
+ * @return VOID
+ */
+static VOID
+BenchEnumerateCallback(const CHAR * Name, UINT64 Rva, UINT32 Size, PVOID Context)
+{
+    std::vector<BENCH_SYMBOL> * Symbols = (std::vector<BENCH_SYMBOL> *)Context;
+
+    Symbols->push_back({Name, Rva, Size});
+}
+
+/**
+ * @brief Compare the symbols and the types of a module with its cache
+ *
+ * @param Module
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BenchCompareModule(BENCH_MODULE & Module)
+{
+    std::map<std::string, UINT64>       Symbols;
+    std::map<std::string, BENCH_TYPE *> Types;
+    std::vector<BENCH_SYMBOL>           Enumerated;
+    UINT64                              Rva;
+    UINT64                              Size;
+    UINT32                              Offset;
+
+    //
+    // The first symbol with a name is used (the same as DbgHelp), and the
+    // types with the fields are used instead of their forward declarations
+    //
+    for (BENCH_SYMBOL & Symbol : Module.Symbols)
+    {
+        Symbols.insert({BenchLowercase(Symbol.Name), Symbol.Rva});
+    }
+
+    for (BENCH_TYPE & Type : Module.Types)
+    {
+        BENCH_TYPE *& Item = Types[BenchLowercase(Type.Name)];
+
+        if (Item == NULL || (Item->Fields.empty() && Item->Size == 0))
+        {
+            Item = &Type;
+        }
+    }
+
+    for (auto & Symbol : Symbols)
+    {
+        if (!SymCacheFindSymbol(Module.Cache, Symbol.first.c_str(), &Rva) || Rva != Symbol.second)
+        {
+            printf("err, the symbol '%s!%s' is different\n", Module.Name.c_str(), Symbol.first.c_str());
+            return FALSE;
+        }
+    }
+
+    for (auto & Type : Types)
+    {
+        if (!SymCacheGetDataTypeSize(Module.Cache, Type.second->Name.c_str(), &Size) || Size != Type.second->Size)
+        {
+            printf("err, the size of '%s!%s' is different\n", Module.Name.c_str(), Type.second->Name.c_str());
+            return FALSE;
+        }
+
+        for (auto & Field : Type.second->Fields)
+        {
+            if (!SymCacheGetFieldOffset(Module.Cache, Type.first.c_str(), Field.first.c_str(), &Offset) || Offset != Field.second)
+            {
+                printf("err, the field '%s!%s.%s' is different\n", Module.Name.c_str(), Type.second->Name.c_str(), Field.first.c_str());
+                return FALSE;
+            }
+        }
+
+        //
+        // The names of the fields are case-sensitive
+        //
+        if (SymCacheGetFieldOffset(Module.Cache, Type.first.c_str(), "field0", &Offset) ||
+            SymCacheGetFieldOffset(Module.Cache, Type.first.c_str(), "NotAField", &Offset))
+        {
+            printf("err, a field of '%s!%s' is found\n", Module.Name.c_str(), Type.second->Name.c_str());
+            return FALSE;
+        }
+    }
+
+    if (SymCacheFindSymbol(Module.Cache, "NotASymbol", &Rva) ||
+        SymCacheFindSymbol(Module.Cache, "", &Rva) ||
+        SymCacheGetDataTypeSize(Module.Cache, "_NOT_A_TYPE", &Size))
+    {
+        printf("err, a name of '%s' is found\n", Module.Name.c_str());
+        return FALSE;
+    }
+
+    //
+    // The symbols are enumerated in the order that they were added (for the
+    // map of the disassembler)
+    //
+    SymCacheEnumerateSymbols(Module.Cache, BenchEnumerateCallback, &Enumerated);
+
+    if (Enumerated.size() != Module.Symbols.size())
+    {
+        printf("err, the symbols of '%s' are not enumerated\n", Module.Name.c_str());
+        return FALSE;
+    }
+
+    for (SIZE_T i = 0; i < Enumerated.size(); i++)
+    {
+        if (Enumerated[i].Name != Module.Symbols[i].Name || Enumerated[i].Rva != Module.Symbols[i].Rva ||
+            Enumerated[i].Size != Module.Symbols[i].Size)
+        {
+            printf("err, the symbol '%s!%s' is not enumerated\n", Module.Name.c_str(), Module.Symbols[i].Name.c_str());
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Check that the cache files of the other PDB files (and the damaged
+ * cache files) are not opened
+ *
+ * @param Directory
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BenchCheckRejectedCaches(const CHAR * Directory)
+{
+    BENCH_MODULE &    Module   = g_Modules.back();
+    std::string       Path     = std::string(Directory) + "/damaged" + SYMBOL_CACHE_FILE_EXTENSION;
+    std::string       Identity = Module.GuidAndAge;
+    PSYMBOL_CACHE     Cache;
+    FILE *            File;
+    std::vector<BYTE> Content;
+    struct stat       FileStat;
+
+    Identity[0] = Identity[0] == '0' ? '1' : '0';
+
+    if (SymCacheOpen(Module.CachePath.c_str(), Identity.c_str(), Module.PdbFileSize) != NULL ||
+        SymCacheOpen(Module.CachePath.c_str(), Module.GuidAndAge.c_str(), Module.PdbFileSize + 1) != NULL ||
+        SymCacheOpen(Path.c_str(), Module.GuidAndAge.c_str(), Module.PdbFileSize) != NULL)
+    {
+        printf("err, the cache of another PDB file is opened\n");
+        return FALSE;
+    }
+
+    if (stat(Module.CachePath.c_str(), &FileStat) != 0 || (File = fopen(Module.CachePath.c_str(), "rb")) == NULL)
+    {
+        return FALSE;
+    }
+
+    Content.resize(FileStat.st_size);
+
+    if (fread(Content.data(), 1, Content.size(), File) != Content.size())
+    {
+        fclose(File);
+        return FALSE;
+    }
+
+    fclose(File);
+
+    //
+    // A truncated file, and a file whose first symbol has an invalid name
+    //
+    for (UINT32 i = 0; i < 2; i++)
+    {
+        std::vector<BYTE> Damaged = Content;
+
+        if (i == 0)
+        {
+            Damaged.resize(Damaged.size() - 1);
+        }
+        else
+        {
+            const SYMBOL_CACHE_HEADER * Header = (const SYMBOL_CACHE_HEADER *)Damaged.data();
+
+            ((PSYMBOL_CACHE_SYMBOL)(Damaged.data() + Header->SymbolsOffset))->NameOffset = Header->NamesSize;
+        }
+
+        File = fopen(Path.c_str(), "wb");
+
+        if (File == NULL || fwrite(Damaged.data(), 1, Damaged.size(), File) != Damaged.size())
+        {
+            return FALSE;
+        }
+
+        fclose(File);
+
+        Cache = SymCacheOpen(Path.c_str(), Module.GuidAndAge.c_str(), Module.PdbFileSize);
+
+        if (Cache != NULL)
+        {
+            printf("err, a damaged cache is opened\n");
+            SymCacheClose(Cache);
+            return FALSE;
+        }
+    }
+
+    remove(Path.c_str());
+
+    return TRUE;
+}
+
+/**
+ * @brief Main function
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int
+main(int argc, char ** argv)
+{
+    CHAR                                         Directory[] = "/tmp/symbol-cache-bench.XXXXXX";
+    std::vector<std::pair<PSYMBOL_CACHE, CHAR *>> Names;
+    UINT64                                       Start;
+    UINT64                                       WriteTime;
+    UINT64                                       OpenTime;
+    UINT64                                       LookupTime;
+    UINT64                                       Checksum     = 0;
+    UINT64                                       SymbolsCount = 0;
+    UINT64                                       TypesCount   = 0;
+    UINT64                                       FilesSize    = 0;
+    UINT64                                       LookupsCount = argc > 1 ? strtoull(argv[1], NULL, 0) : 1000000;
+    BOOLEAN                                      Result       = TRUE;
+
+    if (mkdtemp(Directory) == NULL)
+    {
+        printf("err, unable to create the directory of the cache files\n");
+        return 1;
+    }
+
+    BenchCreateModules(151, 150000, 500, 6000, 40);
+
+    for (BENCH_MODULE & Module : g_Modules)
+    {
+        SymbolsCount += Module.Symbols.size();
+        TypesCount += Module.Types.size();
+    }
+
+    //
+    // The first load (the cache files are created)
+    //
+    Start = BenchNanoseconds();
+
+    if (!BenchWriteCaches(Directory))
+    {
+        return 1;
+    }
+
+    WriteTime = BenchNanoseconds() - Start;
+
+    //
+    // The next reloads (the cache files are opened)
+    //
+    Start = BenchNanoseconds();
+
+    for (BENCH_MODULE & Module : g_Modules)
+    {
+        Module.Cache = SymCacheOpen(Module.CachePath.c_str(), Module.GuidAndAge.c_str(), Module.PdbFileSize);
+
+        if (Module.Cache == NULL)
+        {
+            printf("err, unable to open '%s'\n", Module.CachePath.c_str());
+            return 1;
+        }
+    }
+
+    OpenTime = BenchNanoseconds() - Start;
+
+    for (BENCH_MODULE & Module : g_Modules)
+    {
+        FilesSize += Module.Cache->MappingSize;
+    }
+
+    printf("modules: %zu, symbols: %llu, types: %llu\n",
+           g_Modules.size(),
+           (unsigned long long)SymbolsCount,
+           (unsigned long long)TypesCount);
+    printf("created: %.3f ms (%.1f MB)\n", (double)WriteTime / 1000000, (double)FilesSize / (1024 * 1024));
+    printf("opened:  %.3f ms (%.1f us per module)\n", (double)OpenTime / 1000000, (double)OpenTime / 1000 / g_Modules.size());
+
+    //
+    // The names of the scripts and the commands (half of them are in the
+    // kernel), the module is found by its name before the lookup
+    //
+    for (UINT64 i = 0; i < LookupsCount; i++)
+    {
+        BENCH_MODULE & Module = g_Modules[BenchRandom() % 2 == 0 ? 0 : BenchRandom() % g_Modules.size()];
+
+        Names.push_back({Module.Cache, (CHAR *)Module.Symbols[BenchRandom() % Module.Symbols.size()].Name.c_str()});
+    }
+
+    Start = BenchNanoseconds();
+
+    for (auto & Name : Names)
+    {
+        UINT64 Rva = 0;
+
+        SymCacheFindSymbol(Name.first, Name.second, &Rva);
+
+        Checksum += Rva;
+    }
+
+    LookupTime = BenchNanoseconds() - Start;
+
+    printf("names:   %llu lookups, %.1f ns per lookup (%llx)\n",
+           (unsigned long long)LookupsCount,
+           (double)LookupTime / LookupsCount,
+           (unsigned long long)Checksum);
+
+    //
+    // Compare the results
+    //
+    for (BENCH_MODULE & Module : g_Modules)
+    {
+        if (!BenchCompareModule(Module))
+        {
+            Result = FALSE;
+            break;
+        }
+    }
+
+    if (Result && !BenchCheckRejectedCaches(Directory))
+    {
+        Result = FALSE;
+    }
+
+    for (BENCH_MODULE & Module : g_Modules)
+    {
+        SymCacheClose(Module.Cache);
+        remove(Module.CachePath.c_str());
+    }
+
+    rmdir(Directory);
+
+    printf(Result ? "\nno differences\n" : "\ndifferences found\n");
+
+    return Result ? 0 : 1;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file pch.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Header for the benchmark of the symbol index
+ * @details
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#ifndef PCH_H
+#define PCH_H
+
+//
+// Scope definitions
+//
+#define HYPERDBG_USER_MODE
+#define HYPERDBG_LINUX
+
+#include "platform/general/header/Environment.h"
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+//
+// SDK headers
+//
+#include "SDK/HyperDbgSdk.h"
+
+//
+// Symbol index of libhyperdbg
+//
+#include "../../libhyperdbg/header/debugger/script-engine/symbol-index.h"
+
+//
+// Functions of libhyperdbg that are used by the symbol index
+//
+VOID
+ShowMessages(const char * Fmt, ...);
+
+BOOLEAN
+ScriptEngineCreateSymbolTableForDisassemblerWrapper(PVOID CallbackFunction);
+
+#endif // PCH_H
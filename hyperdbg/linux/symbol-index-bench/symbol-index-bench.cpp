@@ -0,0 +1,472 @@
+/**
+ * @file symbol-index-bench.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Benchmark of the symbol index
+ * @details A kernel-sized set of symbols (one large module and many small
+ * modules) is delivered to SymbolCreateDisassemblerSymbolMap, and then the
+ * random addresses are resolved by the symbol index and by the map of the
+ * disassembler that was used before it; the results of both of them are
+ * compared
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+#include <malloc.h>
+
+/**
+ * @brief The description of the objects of the previous map of the disassembler
+ */
+typedef struct _BENCH_MAP_OBJECT
+{
+    std::string ObjectName;
+    UINT32      ObjectSize;
+
+} BENCH_MAP_OBJECT, *PBENCH_MAP_OBJECT;
+
+/**
+ * @brief An object of the symbols of the benchmark
+ */
+typedef struct _BENCH_OBJECT
+{
+    UINT64      Address;
+    UINT32      Size;
+    std::string Name;
+
+} BENCH_OBJECT, *PBENCH_OBJECT;
+
+/**
+ * @brief A module of the symbols of the benchmark
+ */
+typedef struct _BENCH_MODULE
+{
+    std::string               Name;
+    UINT64                    BaseAddress;
+    UINT64                    Size;
+    std::vector<BENCH_OBJECT> Objects;
+
+} BENCH_MODULE, *PBENCH_MODULE;
+
+/**
+ * @brief The callback of the symbols
+ */
+typedef VOID (*BENCH_MAP_CALLBACK)(UINT64 Address, CHAR * ModuleName, CHAR * ObjectName, UINT32 ObjectSize);
+
+//
+// Global Variables
+//
+BOOLEAN      g_AddressConversion = TRUE;
+SYMBOL_INDEX g_SymbolIndex;
+
+static std::vector<BENCH_MODULE>          g_Modules;
+static std::map<UINT64, BENCH_MAP_OBJECT> g_Map;
+static UINT64                             g_Random = 0x9e3779b97f4a7c15ull;
+
+VOID
+ShowMessages(const char * Fmt, ...)
+{
+    va_list ArgList;
+
+    va_start(ArgList, Fmt);
+    vprintf(Fmt, ArgList);
+    va_end(ArgList);
+}
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+BenchNanoseconds()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + (UINT64)Time.tv_nsec;
+}
+
+/**
+ * @brief Get the allocated memory of the heap (and the large allocations
+ * that are mapped separately)
+ *
+ * @return UINT64
+ */
+static UINT64
+BenchAllocatedMemory()
+{
+    struct mallinfo2 Info = mallinfo2();
+
+    return (UINT64)Info.uordblks + (UINT64)Info.hblkhd;
+}
+
+/**
+ * @brief Get a random number (xorshift64)
+ *
+ * @return UINT64
+ */
+static UINT64
+BenchRandom()
+{
+    g_Random ^= g_Random << 13;
+    g_Random ^= g_Random >> 7;
+    g_Random ^= g_Random << 17;
+
+    return g_Random;
+}
+
+/**
+ * @brief Create the modules and their objects
+ * @details The objects of each module are shuffled (the same as the order
+ * of the symbols of the PDB files), some of them don't have a size, and some
+ * of them are the aliases of the other objects (with the same address)
+ *
+ * @param ModulesCount
+ * @param KernelObjectsCount
+ * @param ModuleObjectsCount
+ *
+ * @return UINT64 the number of the objects
+ */
+static UINT64
+BenchCreateModules(UINT32 ModulesCount, UINT32 KernelObjectsCount, UINT32 ModuleObjectsCount)
+{
+    UINT64 Count = 0;
+
+    for (UINT32 i = 0; i < ModulesCount; i++)
+    {
+        BENCH_MODULE Module;
+        UINT32       ObjectsCount = i == 0 ? KernelObjectsCount : ModuleObjectsCount;
+        UINT64       Address;
+        CHAR         Name[64];
+
+        if (i == 0)
+        {
+            Module.Name        = "nt";
+            Module.BaseAddress = 0xfffff80012000000ull;
+        }
+        else
+        {
+            snprintf(Name, sizeof(Name), "driver%u", i);
+
+            Module.Name        = Name;
+            Module.BaseAddress = 0xfffff80040000000ull + (UINT64)i * 0x400000;
+        }
+
+        Address = Module.BaseAddress + 0x1000;
+
+        for (UINT32 j = 0; j < ObjectsCount; j++)
+        {
+            BENCH_OBJECT Object;
+            UINT32       Gap = 16 + (UINT32)(BenchRandom() % 496);
+
+            snprintf(Name, sizeof(Name), "%sFunction%u", i == 0 ? "Ki" : "Drv", j);
+
+            Object.Address = Address;
+            Object.Size    = (BenchRandom() % 8 == 0) ? 0 : (UINT32)(BenchRandom() % (Gap + 32));
+            Object.Name    = Name;
+
+            Module.Objects.push_back(Object);
+
+            if (BenchRandom() % 64 == 0)
+            {
+                Object.Name += "Alias";
+                Module.Objects.push_back(Object);
+            }
+
+            Address += Gap;
+        }
+
+        Module.Size = Address - Module.BaseAddress;
+        Count += Module.Objects.size();
+
+        for (SIZE_T j = Module.Objects.size(); j > 1; j--)
+        {
+            std::swap(Module.Objects[j - 1], Module.Objects[BenchRandom() % j]);
+        }
+
+        g_Modules.push_back(std::move(Module));
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Deliver the objects of the modules (instead of the script engine)
+ *
+ * @param CallbackFunction
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ScriptEngineCreateSymbolTableForDisassemblerWrapper(PVOID CallbackFunction)
+{
+    BENCH_MAP_CALLBACK Callback = (BENCH_MAP_CALLBACK)CallbackFunction;
+
+    for (BENCH_MODULE & Module : g_Modules)
+    {
+        for (BENCH_OBJECT & Object : Module.Objects)
+        {
+            Callback(Object.Address, (CHAR *)Module.Name.c_str(), (CHAR *)Object.Name.c_str(), Object.Size);
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Add an object to the previous map of the disassembler
+ *
+ * @param Address
+ * @param ModuleName
+ * @param ObjectName
+ * @param ObjectSize
+ *
+ * @return VOID
+ */
+static VOID
+BenchMapCallback(UINT64 Address, CHAR * ModuleName, CHAR * ObjectName, UINT32 ObjectSize)
+{
+    BENCH_MAP_OBJECT Object = {};
+
+    if (ObjectSize == 0)
+    {
+        ObjectSize = DISASSEMBLY_MAXIMUM_DISTANCE_FROM_OBJECT_NAME;
+    }
+
+    Object.ObjectName = std::string(ModuleName) + "!" + std::string(ObjectName);
+    Object.ObjectSize = ObjectSize;
+
+    g_Map[Address] = Object;
+}
+
+/**
+ * @brief Find the object of an address in the previous map of the disassembler
+ *
+ * @param Address
+ * @param Object
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BenchMapLookup(UINT64 Address, PSYMBOL_INDEX_OBJECT Object)
+{
+    std::map<UINT64, BENCH_MAP_OBJECT>::iterator Iterate = g_Map.upper_bound(Address);
+
+    if (Iterate == g_Map.begin())
+    {
+        return FALSE;
+    }
+
+    Iterate--;
+
+    Object->Address = Iterate->first;
+    Object->Size    = Iterate->second.ObjectSize;
+    Object->Name    = Iterate->second.ObjectName.c_str();
+
+    return TRUE;
+}
+
+/**
+ * @brief Create the random addresses
+ * @details Most of the addresses are in the modules, and the others are
+ * anywhere in the kernel address space
+ *
+ * @param Addresses
+ * @param Count
+ * @param IsExact whether the addresses are the addresses of the objects
+ *
+ * @return VOID
+ */
+static VOID
+BenchCreateAddresses(std::vector<UINT64> & Addresses, UINT64 Count, BOOLEAN IsExact)
+{
+    Addresses.resize(Count);
+
+    for (UINT64 i = 0; i < Count; i++)
+    {
+        //
+        // Half of the addresses are in the kernel (the same as the callstacks)
+        //
+        BENCH_MODULE & Module = g_Modules[BenchRandom() % 2 == 0 ? 0 : BenchRandom() % g_Modules.size()];
+
+        if (IsExact)
+        {
+            Addresses[i] = Module.Objects[BenchRandom() % Module.Objects.size()].Address;
+        }
+        else if (BenchRandom() % 10 != 0)
+        {
+            Addresses[i] = Module.BaseAddress + BenchRandom() % (Module.Size + 0x1000);
+        }
+        else
+        {
+            Addresses[i] = 0xfffff80000000000ull + BenchRandom() % 0x80000000ull;
+        }
+    }
+}
+
+/**
+ * @brief Resolve the addresses by the symbol index and by the map
+ *
+ * @param Title
+ * @param Addresses
+ *
+ * @return BOOLEAN whether the results are the same
+ */
+static BOOLEAN
+BenchLookups(const CHAR * Title, const std::vector<UINT64> & Addresses)
+{
+    SYMBOL_INDEX_OBJECT IndexObject;
+    SYMBOL_INDEX_OBJECT MapObject;
+    UINT64              IndexChecksum = 0;
+    UINT64              MapChecksum   = 0;
+    UINT64              Start;
+    UINT64              MapTime;
+    UINT64              IndexTime;
+    UINT64              Found = 0;
+
+    Start = BenchNanoseconds();
+
+    for (UINT64 Address : Addresses)
+    {
+        if (BenchMapLookup(Address, &MapObject))
+        {
+            MapChecksum += MapObject.Address + MapObject.Size + (UINT8)MapObject.Name[3];
+        }
+    }
+
+    MapTime = BenchNanoseconds() - Start;
+    Start   = BenchNanoseconds();
+
+    for (UINT64 Address : Addresses)
+    {
+        if (SymbolIndexLookup(&g_SymbolIndex, Address, &IndexObject))
+        {
+            IndexChecksum += IndexObject.Address + IndexObject.Size + (UINT8)IndexObject.Name[3];
+        }
+    }
+
+    IndexTime = BenchNanoseconds() - Start;
+
+    printf("%-8s %10zu %12.1f %12.1f %9.2fx\n",
+           Title,
+           Addresses.size(),
+           (double)MapTime / Addresses.size(),
+           (double)IndexTime / Addresses.size(),
+           (double)MapTime / IndexTime);
+
+    //
+    // Compare the results
+    //
+    for (UINT64 Address : Addresses)
+    {
+        BOOLEAN IsMapFound   = BenchMapLookup(Address, &MapObject);
+        BOOLEAN IsIndexFound = SymbolIndexLookup(&g_SymbolIndex, Address, &IndexObject);
+
+        if (IsMapFound != IsIndexFound ||
+            (IsMapFound && (MapObject.Address != IndexObject.Address || MapObject.Size != IndexObject.Size ||
+                            strcmp(MapObject.Name, IndexObject.Name) != 0)))
+        {
+            printf("err, the results of %016llx are different (%s, %s)\n",
+                   (unsigned long long)Address,
+                   IsMapFound ? MapObject.Name : "none",
+                   IsIndexFound ? IndexObject.Name : "none");
+            return FALSE;
+        }
+
+        Found += IsIndexFound;
+    }
+
+    if (IndexChecksum != MapChecksum)
+    {
+        printf("err, the checksums are different\n");
+        return FALSE;
+    }
+
+    return Found != 0;
+}
+
+/**
+ * @brief Main function
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int
+main(int argc, char ** argv)
+{
+    std::vector<UINT64> Addresses;
+    UINT64              LookupsCount = argc > 1 ? strtoull(argv[1], NULL, 0) : 10000000;
+    UINT64              ObjectsCount;
+    UINT64              Start;
+    UINT64              Memory;
+    UINT64              UsedBaseAddress = 0;
+    UINT64              SampleAddress;
+    BOOLEAN             IsSame;
+
+    //
+    // A kernel (150000 objects) and 150 drivers (500 objects for each of them)
+    //
+    ObjectsCount = BenchCreateModules(151, 150000, 500);
+
+    printf("modules: %zu, objects: %llu\n", g_Modules.size(), (unsigned long long)ObjectsCount);
+
+    Memory = BenchAllocatedMemory();
+    Start  = BenchNanoseconds();
+
+    ScriptEngineCreateSymbolTableForDisassemblerWrapper((PVOID)BenchMapCallback);
+
+    printf("map:   built in %.3f ms, %.1f MB, %zu objects\n",
+           (BenchNanoseconds() - Start) / 1e6,
+           (BenchAllocatedMemory() - Memory) / 1048576.0,
+           g_Map.size());
+
+    Memory = BenchAllocatedMemory();
+    Start  = BenchNanoseconds();
+
+    SymbolCreateDisassemblerSymbolMap();
+
+    printf("index: built in %.3f ms, %.1f MB, %zu objects, %zu ranges\n",
+           (BenchNanoseconds() - Start) / 1e6,
+           (BenchAllocatedMemory() - Memory) / 1048576.0,
+           g_SymbolIndex.Entries.size(),
+           g_SymbolIndex.Modules.size());
+
+    printf("\n%-8s %10s %12s %12s %10s\n", "lookups", "count", "map ns", "index ns", "speedup");
+
+    BenchCreateAddresses(Addresses, LookupsCount, FALSE);
+    IsSame = BenchLookups("random", Addresses);
+
+    BenchCreateAddresses(Addresses, LookupsCount, TRUE);
+    IsSame = BenchLookups("exact", Addresses) && IsSame;
+
+    //
+    // Show a few addresses the same as the disassembler and the callstacks
+    //
+    printf("\n");
+
+    SampleAddress = g_Modules[0].Objects[0].Address;
+
+    for (UINT64 Address : {SampleAddress, SampleAddress + 4, SampleAddress + 0x20000, g_Modules[1].BaseAddress - 1})
+    {
+        printf("%016llx: ", (unsigned long long)Address);
+
+        if (!SymbolShowFunctionNameBasedOnAddress(Address, &UsedBaseAddress))
+        {
+            printf("-");
+        }
+
+        printf("\n");
+        UsedBaseAddress = 0;
+    }
+
+    SymbolIndexClear(&g_SymbolIndex);
+
+    printf("\n%s\n", IsSame ? "no differences" : "err, the results are different");
+
+    return IsSame ? 0 : 1;
+}
@@ -0,0 +1,394 @@
+/**
+ * @file symbol-load-bench.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Benchmark of the parallel loading of the symbols
+ * @details The modules of a kernel-sized snapshot (one large module and many
+ * small modules) are reloaded by the loader of the symbol-parser with
+ * different numbers of threads, and the order of the merged modules, their
+ * symbols and the aborted reloads are checked
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief A module of the snapshot
+ */
+typedef struct _BENCH_MODULE
+{
+    std::string Name;
+    std::string GuidAndAge;
+    std::string CachePath;
+    std::string ProbeName; // a symbol that is resolved when the module is merged
+    UINT64      ProbeRva;
+    UINT64      PdbFileSize;
+
+} BENCH_MODULE, *PBENCH_MODULE;
+
+/**
+ * @brief The state of a reload of the snapshot
+ */
+typedef struct _BENCH_RELOAD
+{
+    UINT32                     Latency;    // the latency of preparing each module (us)
+    UINT32                     AbortAfter; // the reload is aborted after merging this module
+    volatile BOOLEAN           Abort;
+    std::vector<PSYMBOL_CACHE> Prepared; // the caches that are opened by the threads
+    std::vector<PSYMBOL_CACHE> Loaded;   // the caches that are taken by the merged modules
+    std::atomic<UINT32>        OpenedCount;
+    UINT32                     MergedCount;
+    BOOLEAN                    IsOrdered;
+    BOOLEAN                    IsResolved;
+    UINT64                     Checksum;
+
+} BENCH_RELOAD, *PBENCH_RELOAD;
+
+//
+// Global Variables
+//
+static std::vector<BENCH_MODULE> g_Modules;
+static UINT64                    g_Random = 0x9e3779b97f4a7c15ull;
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+BenchNanoseconds()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + (UINT64)Time.tv_nsec;
+}
+
+/**
+ * @brief Get a random number (xorshift64)
+ *
+ * @return UINT64
+ */
+static UINT64
+BenchRandom()
+{
+    g_Random ^= g_Random << 13;
+    g_Random ^= g_Random >> 7;
+    g_Random ^= g_Random << 17;
+
+    return g_Random;
+}
+
+/**
+ * @brief Create the modules of the snapshot and save their cache files (the
+ * first load of the PDB files)
+ *
+ * @param Directory
+ * @param ModulesCount
+ * @param KernelSymbolsCount
+ * @param ModuleSymbolsCount
+ * @param FilesSize
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BenchCreateModules(const CHAR * Directory,
+                   UINT32       ModulesCount,
+                   UINT32       KernelSymbolsCount,
+                   UINT32       ModuleSymbolsCount,
+                   UINT64 *     FilesSize)
+{
+    for (UINT32 i = 0; i < ModulesCount; i++)
+    {
+        BENCH_MODULE         Module       = {};
+        SYMBOL_CACHE_BUILDER Builder;
+        UINT32               SymbolsCount = i == 0 ? KernelSymbolsCount : ModuleSymbolsCount;
+        UINT32               Probe        = (UINT32)(BenchRandom() % SymbolsCount);
+        UINT64               Rva          = 0x1000;
+        struct stat          FileStat;
+        CHAR                 Name[64];
+
+        Module.Name = i == 0 ? "ntkrnlmp" : "driver" + std::to_string(i);
+
+        snprintf(Name, sizeof(Name), "%016llx%016llx1", (unsigned long long)BenchRandom(), (unsigned long long)BenchRandom());
+
+        Module.GuidAndAge  = Name;
+        Module.PdbFileSize = 0x100000 + BenchRandom() % 0x4000000;
+        Module.CachePath   = std::string(Directory) + "/" + Module.Name + SYMBOL_CACHE_FILE_EXTENSION;
+
+        for (UINT32 j = 0; j < SymbolsCount; j++)
+        {
+            snprintf(Name, sizeof(Name), "%sFunction%u", i == 0 ? "Ki" : "Drv", j);
+
+            if (j == Probe)
+            {
+                Module.ProbeName = Name;
+                Module.ProbeRva  = Rva;
+            }
+
+            SymCacheBuilderAddSymbol(&Builder, Name, Rva, (UINT32)(BenchRandom() % 512));
+
+            Rva += 16 + BenchRandom() % 496;
+        }
+
+        for (UINT32 j = 0; j < SymbolsCount / 25; j++)
+        {
+            snprintf(Name, sizeof(Name), "_%s_STRUCT_%u", i == 0 ? "K" : "DRV", j);
+
+            SymCacheBuilderAddType(&Builder, Name, 8 * (1 + BenchRandom() % 16));
+            SymCacheBuilderAddField(&Builder, "Field0", 0);
+        }
+
+        if (!SymCacheWrite(&Builder, Module.CachePath.c_str(), Module.GuidAndAge.c_str(), Module.PdbFileSize) ||
+            stat(Module.CachePath.c_str(), &FileStat) != 0)
+        {
+            printf("err, unable to write '%s'\n", Module.CachePath.c_str());
+            return FALSE;
+        }
+
+        *FilesSize += FileStat.st_size;
+
+        g_Modules.push_back(std::move(Module));
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Prepare a module (called by the threads of the loader)
+ * @details The latency stands for downloading the PDB file from the symbol
+ * server (or reading it from the disk), which is what the threads wait for
+ *
+ * @param Index
+ * @param Context
+ *
+ * @return VOID
+ */
+static VOID
+BenchPrepareModule(UINT32 Index, PVOID Context)
+{
+    PBENCH_RELOAD  Reload = (PBENCH_RELOAD)Context;
+    BENCH_MODULE & Module = g_Modules[Index];
+
+    if (Reload->Latency != 0)
+    {
+        usleep(Reload->Latency);
+    }
+
+    Reload->Prepared[Index] = SymCacheOpen(Module.CachePath.c_str(), Module.GuidAndAge.c_str(), Module.PdbFileSize);
+
+    if (Reload->Prepared[Index] != NULL)
+    {
+        Reload->OpenedCount++;
+    }
+}
+
+/**
+ * @brief Merge a prepared module (called by the thread of the loader, in the
+ * order of the modules)
+ *
+ * @param Index
+ * @param Context
+ *
+ * @return VOID
+ */
+static VOID
+BenchMergeModule(UINT32 Index, PVOID Context)
+{
+    PBENCH_RELOAD  Reload = (PBENCH_RELOAD)Context;
+    BENCH_MODULE & Module = g_Modules[Index];
+    UINT64         Rva    = 0;
+
+    if (Index != Reload->MergedCount)
+    {
+        Reload->IsOrdered = FALSE;
+    }
+
+    Reload->MergedCount++;
+
+    if (Reload->Prepared[Index] == NULL ||
+        !SymCacheFindSymbol(Reload->Prepared[Index], Module.ProbeName.c_str(), &Rva) ||
+        Rva != Module.ProbeRva)
+    {
+        Reload->IsResolved = FALSE;
+    }
+
+    Reload->Checksum = Reload->Checksum * 31 + (Rva ^ Index);
+
+    //
+    // The cache is taken by the merged module
+    //
+    Reload->Loaded.push_back(Reload->Prepared[Index]);
+    Reload->Prepared[Index] = NULL;
+
+    if (Index == Reload->AbortAfter)
+    {
+        Reload->Abort = TRUE;
+    }
+}
+
+/**
+ * @brief Reload the modules of the snapshot
+ *
+ * @param Reload
+ * @param NumberOfThreads
+ *
+ * @return BOOLEAN the result of the loader (FALSE if the reload is aborted)
+ */
+static BOOLEAN
+BenchReload(PBENCH_RELOAD Reload, UINT32 NumberOfThreads)
+{
+    BOOLEAN Result;
+    UINT32  ClosedCount = 0;
+
+    Reload->Abort       = FALSE;
+    Reload->OpenedCount = 0;
+    Reload->MergedCount = 0;
+    Reload->IsOrdered   = TRUE;
+    Reload->IsResolved  = TRUE;
+    Reload->Checksum    = 0;
+    Reload->Loaded.clear();
+    Reload->Prepared.assign(g_Modules.size(), NULL);
+
+    Result = SymLoaderRun((UINT32)g_Modules.size(), NumberOfThreads, BenchPrepareModule, BenchMergeModule, Reload, &Reload->Abort);
+
+    //
+    // Close the caches of the modules that are prepared but not merged (the
+    // same as SymbolInitLoad), and the caches of the merged modules (the same
+    // as unloading them)
+    //
+    for (PSYMBOL_CACHE Cache : Reload->Prepared)
+    {
+        if (Cache != NULL)
+        {
+            SymCacheClose(Cache);
+            ClosedCount++;
+        }
+    }
+
+    for (PSYMBOL_CACHE Cache : Reload->Loaded)
+    {
+        if (Cache != NULL)
+        {
+            SymCacheClose(Cache);
+            ClosedCount++;
+        }
+    }
+
+    if (ClosedCount != Reload->OpenedCount)
+    {
+        printf("err, %u caches are opened but %u caches are closed\n", Reload->OpenedCount.load(), ClosedCount);
+        Reload->IsResolved = FALSE;
+    }
+
+    return Result;
+}
+
+/**
+ * @brief Main function
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int
+main(int argc, char ** argv)
+{
+    CHAR         Directory[]    = "/tmp/symbol-load-bench.XXXXXX";
+    UINT32       Latencies[]    = {0, argc > 1 ? (UINT32)strtoul(argv[1], NULL, 0) : 2000};
+    UINT32       ThreadCounts[] = {1, 2, 4, SYMBOL_LOADER_MAXIMUM_THREADS};
+    BENCH_RELOAD Reload;
+    UINT64       FilesSize = 0;
+    UINT64       Checksum  = 0;
+    BOOLEAN      Result    = TRUE;
+
+    if (mkdtemp(Directory) == NULL)
+    {
+        printf("err, unable to create the directory of the cache files\n");
+        return 1;
+    }
+
+    if (!BenchCreateModules(Directory, 151, 150000, 500, &FilesSize))
+    {
+        return 1;
+    }
+
+    printf("modules: %zu, cache files: %.1f MB\n\n", g_Modules.size(), (double)FilesSize / (1024 * 1024));
+    printf("latency us   threads    reload ms    speedup\n");
+
+    Reload.AbortAfter = (UINT32)-1;
+
+    for (UINT32 Latency : Latencies)
+    {
+        double SerialTime = 0;
+
+        Reload.Latency = Latency;
+
+        for (UINT32 Threads : ThreadCounts)
+        {
+            UINT64 Start = BenchNanoseconds();
+            double Time;
+
+            if (!BenchReload(&Reload, Threads) || !Reload.IsOrdered || !Reload.IsResolved ||
+                Reload.MergedCount != g_Modules.size())
+            {
+                printf("err, the modules are not merged in order (%u threads)\n", Threads);
+                Result = FALSE;
+            }
+
+            Time = (double)(BenchNanoseconds() - Start) / 1000000;
+
+            //
+            // The modules are merged in the same order with any number of threads
+            //
+            if (Checksum == 0)
+            {
+                Checksum = Reload.Checksum;
+            }
+            else if (Checksum != Reload.Checksum)
+            {
+                printf("err, the merged modules are different (%u threads)\n", Threads);
+                Result = FALSE;
+            }
+
+            if (Threads == 1)
+            {
+                SerialTime = Time;
+            }
+
+            printf("%-12u %-10u %9.3f    %6.2fx\n", Latency, Threads, Time, SerialTime / Time);
+        }
+    }
+
+    //
+    // Abort the reload after merging the half of the modules, the next modules
+    // must not be merged and their caches must be closed
+    //
+    Reload.Latency    = Latencies[1];
+    Reload.AbortAfter = (UINT32)g_Modules.size() / 2;
+
+    if (BenchReload(&Reload, SYMBOL_LOADER_MAXIMUM_THREADS) || !Reload.IsOrdered || !Reload.IsResolved ||
+        Reload.MergedCount != Reload.AbortAfter + 1)
+    {
+        printf("err, the aborted reload merged %u modules\n", Reload.MergedCount);
+        Result = FALSE;
+    }
+    else
+    {
+        printf("\naborted after %u modules (%u caches opened and closed)\n", Reload.MergedCount, Reload.OpenedCount.load());
+    }
+
+    for (BENCH_MODULE & Module : g_Modules)
+    {
+        remove(Module.CachePath.c_str());
+    }
+
+    rmdir(Directory);
+
+    printf("\n%s\n", Result ? "no differences" : "differences found");
+
+    return Result ? 0 : 1;
+}
@@ -0,0 +1,502 @@
+/**
+ * @file translation-cache-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Tests of the translation cache
+ * @details The page-table walker of hyperhv (CheckAccessValidityAndSafety and
+ * VirtualAddressToPhysicalAddressByProcessCr3) is mocked by the page tables of
+ * a few processes, the reads are compared with a byte-at-a-time reference
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of the processes, the virtual pages and the physical pages
+ * of the mocked page tables
+ */
+#define TEST_PROCESS_COUNT       2
+#define TEST_VIRTUAL_PAGE_COUNT  64
+#define TEST_PHYSICAL_PAGE_COUNT 24
+
+/**
+ * @brief The first virtual address and the first physical address of the
+ * mocked memory
+ */
+#define TEST_VIRTUAL_BASE  0xfffff80012340000ull
+#define TEST_PHYSICAL_BASE 0x100000ull
+
+/**
+ * @brief A virtual page that is not present
+ */
+#define TEST_NOT_PRESENT ((UINT32)-1)
+
+/**
+ * @brief The mocked physical memory and page tables
+ */
+static BYTE   TestPhysicalMemory[TEST_PHYSICAL_PAGE_COUNT * PAGE_SIZE];
+static UINT32 TestPageTables[TEST_PROCESS_COUNT][TEST_VIRTUAL_PAGE_COUNT];
+static UINT64 TestCr3s[TEST_PROCESS_COUNT] = {0x1aa000, 0x2bb000};
+
+/**
+ * @brief The current process
+ */
+static UINT32 TestCurrentProcess;
+
+/**
+ * @brief Statistics of the mocked page-table walker
+ */
+static UINT64 TestValidations;
+static UINT64 TestTranslations;
+static UINT64 TestUnsafeReads;
+
+/**
+ * @brief State of the random number generator
+ */
+static UINT64 TestState;
+
+/**
+ * @brief Number of the failed checks
+ */
+static UINT64 TestFailures;
+
+/**
+ * @brief Translate a virtual address by the mocked page tables
+ *
+ * @param Process
+ * @param Address
+ * @param PhysicalAddress
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestWalk(UINT32 Process, UINT64 Address, UINT64 * PhysicalAddress)
+{
+    UINT64 Page;
+
+    if (Address < TEST_VIRTUAL_BASE || Address - TEST_VIRTUAL_BASE >= TEST_VIRTUAL_PAGE_COUNT * PAGE_SIZE)
+    {
+        return FALSE;
+    }
+
+    Page = (Address - TEST_VIRTUAL_BASE) / PAGE_SIZE;
+
+    if (TestPageTables[Process][Page] == TEST_NOT_PRESENT)
+    {
+        return FALSE;
+    }
+
+    *PhysicalAddress = TEST_PHYSICAL_BASE + TestPageTables[Process][Page] * PAGE_SIZE + (Address & (PAGE_SIZE - 1));
+
+    return TRUE;
+}
+
+BOOLEAN
+CheckAccessValidityAndSafety(UINT64 TargetAddress, UINT32 Size)
+{
+    UINT64 PhysicalAddress;
+
+    TestValidations++;
+
+    for (UINT64 Address = TargetAddress; Address < TargetAddress + Size; Address++)
+    {
+        if (!TestWalk(TestCurrentProcess, Address, &PhysicalAddress))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+UINT64
+VirtualAddressToPhysicalAddressByProcessCr3(PVOID VirtualAddress, CR3_TYPE TargetCr3)
+{
+    UINT64 PhysicalAddress;
+
+    TestTranslations++;
+
+    for (UINT32 i = 0; i < TEST_PROCESS_COUNT; i++)
+    {
+        if (TestCr3s[i] == TargetCr3.Flags && TestWalk(i, (UINT64)VirtualAddress, &PhysicalAddress))
+        {
+            return PhysicalAddress;
+        }
+    }
+
+    return NULL64_ZERO;
+}
+
+BOOLEAN
+MemoryMapperReadMemorySafeByPhysicalAddress(UINT64 PaAddressToRead, UINT64 BufferToSaveMemory, SIZE_T SizeToRead)
+{
+    if (PaAddressToRead < TEST_PHYSICAL_BASE ||
+        PaAddressToRead + SizeToRead > TEST_PHYSICAL_BASE + sizeof(TestPhysicalMemory) ||
+        (PaAddressToRead & ~(PAGE_SIZE - 1)) != ((PaAddressToRead + SizeToRead - 1) & ~(PAGE_SIZE - 1)))
+    {
+        //
+        // A read should be in a single physical page
+        //
+        TestUnsafeReads++;
+        return FALSE;
+    }
+
+    memcpy((PVOID)BufferToSaveMemory, &TestPhysicalMemory[PaAddressToRead - TEST_PHYSICAL_BASE], SizeToRead);
+
+    return TRUE;
+}
+
+/**
+ * @brief Returns a random number (xorshift64)
+ *
+ * @return UINT64
+ */
+static UINT64
+TestRandom(void)
+{
+    TestState ^= TestState << 13;
+    TestState ^= TestState >> 7;
+    TestState ^= TestState << 17;
+
+    return TestState;
+}
+
+/**
+ * @brief Returns a random number that is less than Bound
+ *
+ * @param Bound
+ * @return UINT32
+ */
+static UINT32
+TestChoose(UINT32 Bound)
+{
+    return (UINT32)(TestRandom() % Bound);
+}
+
+/**
+ * @brief Byte-at-a-time reference of TranslationCacheReadMemory
+ *
+ * @param Address
+ * @param Buffer
+ * @param Size
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestReferenceRead(UINT64 Address, BYTE * Buffer, UINT32 Size)
+{
+    UINT64 PhysicalAddress;
+
+    for (UINT32 i = 0; i < Size; i++)
+    {
+        if (!TestWalk(TestCurrentProcess, Address + i, &PhysicalAddress))
+        {
+            return FALSE;
+        }
+
+        Buffer[i] = TestPhysicalMemory[PhysicalAddress - TEST_PHYSICAL_BASE];
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Read the memory by the cache in the current process
+ *
+ * @param Cache
+ * @param Address
+ * @param Buffer
+ * @param Size
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestRead(PTRANSLATION_CACHE Cache, UINT64 Address, BYTE * Buffer, UINT32 Size)
+{
+    CR3_TYPE Cr3 = {0};
+
+    Cr3.Flags = TestCr3s[TestCurrentProcess];
+
+    return TranslationCacheReadMemory(Cache, Cr3, Address, Buffer, Size);
+}
+
+/**
+ * @brief Check a condition of a test
+ *
+ * @param Condition
+ * @param Name
+ * @return VOID
+ */
+static VOID
+TestCheck(BOOLEAN Condition, const CHAR * Name)
+{
+    if (!Condition)
+    {
+        printf("failed : %s\n", Name);
+        TestFailures++;
+    }
+}
+
+/**
+ * @brief Check a read against the reference
+ *
+ * @param Cache
+ * @param Address
+ * @param Size
+ * @param Name
+ * @return BOOLEAN the result of the read
+ */
+static BOOLEAN
+TestCheckRead(PTRANSLATION_CACHE Cache, UINT64 Address, UINT32 Size, const CHAR * Name)
+{
+    BYTE    Buffer[64];
+    BYTE    Reference[64];
+    BOOLEAN Result;
+    BOOLEAN ReferenceResult;
+
+    Result          = TestRead(Cache, Address, Buffer, Size);
+    ReferenceResult = TestReferenceRead(Address, Reference, Size);
+
+    TestCheck(Result == ReferenceResult, Name);
+
+    if (Result && ReferenceResult)
+    {
+        TestCheck(memcmp(Buffer, Reference, Size) == 0, Name);
+    }
+
+    return Result;
+}
+
+/**
+ * @brief Reset the mocked memory, each process maps the virtual pages to
+ * different physical pages
+ *
+ * @return VOID
+ */
+static VOID
+TestResetMemory(void)
+{
+    for (UINT32 i = 0; i < sizeof(TestPhysicalMemory); i++)
+    {
+        TestPhysicalMemory[i] = (BYTE)TestRandom();
+    }
+
+    for (UINT32 i = 0; i < TEST_PROCESS_COUNT; i++)
+    {
+        for (UINT32 j = 0; j < TEST_VIRTUAL_PAGE_COUNT; j++)
+        {
+            TestPageTables[i][j] = (j * 7 + i * 5) % TEST_PHYSICAL_PAGE_COUNT;
+        }
+    }
+
+    TestCurrentProcess = 0;
+    TestValidations    = 0;
+    TestTranslations   = 0;
+}
+
+/**
+ * @brief Test the hits, the misses and the invalid pages
+ *
+ * @return VOID
+ */
+static VOID
+TestHitsAndMisses(void)
+{
+    TRANSLATION_CACHE Cache = {0};
+    UINT64            Address;
+
+    TestResetMemory();
+    TranslationCacheInvalidate(&Cache);
+
+    //
+    // The page is walked once
+    //
+    Address = TEST_VIRTUAL_BASE + 3 * PAGE_SIZE + 0x10;
+
+    for (UINT32 i = 0; i < 100; i++)
+    {
+        TestCheck(TestCheckRead(&Cache, Address + i * 8, 8, "hit: read"), "hit: result");
+    }
+
+    TestCheck(TestTranslations == 1, "hit: single translation");
+    TestCheck(TestValidations == 1, "hit: single validation");
+
+    //
+    // A read on two pages walks the next page once
+    //
+    Address = TEST_VIRTUAL_BASE + 4 * PAGE_SIZE - 3;
+
+    TestCheck(TestCheckRead(&Cache, Address, 8, "page crossing: read"), "page crossing: result");
+    TestCheck(TestCheckRead(&Cache, Address, 8, "page crossing: second read"), "page crossing: second result");
+    TestCheck(TestTranslations == 2, "page crossing: translations");
+
+    //
+    // Pages that share an entry replace each other
+    //
+    Address = TEST_VIRTUAL_BASE + (3 + TRANSLATION_CACHE_ENTRIES_COUNT) * PAGE_SIZE;
+
+    TestCheck(TestCheckRead(&Cache, Address, 8, "conflict: read"), "conflict: result");
+    TestCheck(TestCheckRead(&Cache, TEST_VIRTUAL_BASE + 3 * PAGE_SIZE, 8, "conflict: previous page"), "conflict: previous result");
+    TestCheck(TestTranslations == 4, "conflict: translations");
+
+    //
+    // The invalid pages fail and they are not cached
+    //
+    TestPageTables[0][10] = TEST_NOT_PRESENT;
+    Address               = TEST_VIRTUAL_BASE + 10 * PAGE_SIZE;
+
+    TestCheck(!TestCheckRead(&Cache, Address, 8, "invalid: read"), "invalid: result");
+    TestCheck(!TestCheckRead(&Cache, Address - 4, 8, "invalid: read from the previous page"), "invalid: previous page result");
+    TestCheck(!TestCheckRead(&Cache, TEST_VIRTUAL_BASE - 8, 8, "invalid: out of the memory"), "invalid: out of the memory result");
+
+    TestPageTables[0][10] = 1;
+
+    TestCheck(TestCheckRead(&Cache, Address, 8, "invalid: read after mapping"), "invalid: result after mapping");
+}
+
+/**
+ * @brief Test the cr3 tags and the invalidation
+ *
+ * @return VOID
+ */
+static VOID
+TestTagsAndInvalidation(void)
+{
+    TRANSLATION_CACHE Cache = {0};
+    UINT64            Address;
+    UINT64            Translations;
+    BYTE              Buffer[8];
+    BYTE              Reference[8];
+
+    TestResetMemory();
+
+    Address = TEST_VIRTUAL_BASE + 5 * PAGE_SIZE + 0x20;
+
+    //
+    // The same virtual address is translated for each process
+    //
+    TestCheck(TestCheckRead(&Cache, Address, 8, "cr3: first process"), "cr3: first process result");
+
+    TestCurrentProcess = 1;
+    Translations       = TestTranslations;
+
+    TestCheck(TestCheckRead(&Cache, Address, 8, "cr3: second process"), "cr3: second process result");
+    TestCheck(TestTranslations == Translations + 1, "cr3: second process is walked");
+
+    TestPageTables[1][6] = TEST_NOT_PRESENT;
+    TestCheck(!TestCheckRead(&Cache, Address + PAGE_SIZE, 8, "cr3: page that is only present in the first process"),
+              "cr3: page that is only present in the first process result");
+
+    TestCurrentProcess = 0;
+
+    TestCheck(TestCheckRead(&Cache, Address + PAGE_SIZE, 8, "cr3: page of the first process"), "cr3: page of the first process result");
+
+    //
+    // The translations remain until the cache is invalidated
+    //
+    TestCheck(TestCheckRead(&Cache, Address, 8, "invalidation: read"), "invalidation: result");
+
+    TestPageTables[0][5] = (TestPageTables[0][5] + 1) % TEST_PHYSICAL_PAGE_COUNT;
+    Translations         = TestTranslations;
+
+    TestCheck(TestRead(&Cache, Address, Buffer, sizeof(Buffer)), "invalidation: cached read");
+    TestCheck(TestTranslations == Translations, "invalidation: cached read is not walked");
+
+    TranslationCacheInvalidate(&Cache);
+
+    TestCheck(TestRead(&Cache, Address, Buffer, sizeof(Buffer)) &&
+                  TestReferenceRead(Address, Reference, sizeof(Reference)) &&
+                  memcmp(Buffer, Reference, sizeof(Buffer)) == 0,
+              "invalidation: read after the invalidation");
+    TestCheck(TestTranslations == Translations + 1, "invalidation: read after the invalidation is walked");
+}
+
+/**
+ * @brief Compare random reads with the reference
+ *
+ * @param Iterations
+ * @return VOID
+ */
+static VOID
+TestRandomized(UINT64 Iterations)
+{
+    TRANSLATION_CACHE Cache = {0};
+    UINT64            Address;
+    UINT32            Size;
+    UINT64            Reads = 0;
+
+    TestResetMemory();
+
+    for (UINT64 i = 0; i < Iterations; i++)
+    {
+        switch (TestChoose(20))
+        {
+        case 0:
+
+            //
+            // Switch to another process (the cache is not invalidated)
+            //
+            TestCurrentProcess = TestChoose(TEST_PROCESS_COUNT);
+            break;
+
+        case 1:
+
+            //
+            // Change a page and invalidate the cache (the same as a new run)
+            //
+            TestPageTables[TestChoose(TEST_PROCESS_COUNT)][TestChoose(TEST_VIRTUAL_PAGE_COUNT)] =
+                TestChoose(8) == 0 ? TEST_NOT_PRESENT : TestChoose(TEST_PHYSICAL_PAGE_COUNT);
+
+            TranslationCacheInvalidate(&Cache);
+            break;
+
+        default:
+
+            Size = 1 + TestChoose(64);
+
+            if (TestChoose(2) == 0)
+            {
+                //
+                // Near the boundary of a page
+                //
+                Address = TEST_VIRTUAL_BASE + TestChoose(TEST_VIRTUAL_PAGE_COUNT + 1) * PAGE_SIZE - TestChoose(64);
+            }
+            else
+            {
+                Address = TEST_VIRTUAL_BASE + TestChoose(TEST_VIRTUAL_PAGE_COUNT * PAGE_SIZE);
+            }
+
+            TestCheckRead(&Cache, Address, Size, "random: read");
+            Reads++;
+            break;
+        }
+    }
+
+    TestCheck(TestUnsafeReads == 0, "random: unsafe reads");
+
+    printf("reads: %llu, translations: %llu\n", Reads, TestTranslations);
+}
+
+int
+main(int argc, char ** argv)
+{
+    UINT64 Seed       = argc > 1 ? strtoull(argv[1], NULL, 0) : (UINT64)time(NULL);
+    UINT64 Iterations = argc > 2 ? strtoull(argv[2], NULL, 0) : 100000;
+
+    TestState = Seed != 0 ? Seed : 1;
+
+    printf("seed: %llu, iterations: %llu\n", Seed, Iterations);
+
+    TestHitsAndMisses();
+    TestTagsAndInvalidation();
+    TestRandomized(Iterations);
+
+    if (TestFailures != 0)
+    {
+        printf("%llu checks are failed\n", TestFailures);
+        return 1;
+    }
+
+    printf("all checks are passed\n");
+
+    return 0;
+}
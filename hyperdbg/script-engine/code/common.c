@@ -11,6 +11,170 @@
  */
 #include "pch.h"
 
+/**
+ * @brief Allocates zeroed memory from an arena
+ *
+ * @param Arena the arena to allocate from
+ * @param Size the size of the allocation
+ * @return PVOID the allocated memory or NULL
+ */
+PVOID
+ArenaAllocate(PSCRIPT_ENGINE_ARENA Arena, size_t Size)
+{
+    PSCRIPT_ENGINE_ARENA_CHUNK Chunk      = Arena->Head;
+    size_t                     HeaderSize = (sizeof(SCRIPT_ENGINE_ARENA_CHUNK) + TOKEN_ARENA_ALIGNMENT - 1) & ~((size_t)TOKEN_ARENA_ALIGNMENT - 1);
+    PVOID                      Memory;
+
+    Size = (Size + TOKEN_ARENA_ALIGNMENT - 1) & ~((size_t)TOKEN_ARENA_ALIGNMENT - 1);
+
+    if (Chunk == NULL || Chunk->Size - Chunk->Used < Size)
+    {
+        //
+        // Chunks are zeroed once and never reused, so each allocation
+        // is already zeroed (the same as calloc)
+        //
+        size_t ChunkSize = Size > TOKEN_ARENA_CHUNK_SIZE ? Size : TOKEN_ARENA_CHUNK_SIZE;
+
+        Chunk = (PSCRIPT_ENGINE_ARENA_CHUNK)calloc(1, HeaderSize + ChunkSize);
+
+        if (Chunk == NULL)
+        {
+            //
+            // There was an error allocating buffer
+            //
+            return NULL;
+        }
+
+        Chunk->Size = ChunkSize;
+        Chunk->Used = 0;
+
+        //
+        // A large allocation that fills its own chunk is placed after the
+        // current chunk, so the free space of the current chunk is kept
+        //
+        if (Arena->Head != NULL && ChunkSize > TOKEN_ARENA_CHUNK_SIZE)
+        {
+            Chunk->Next       = Arena->Head->Next;
+            Arena->Head->Next = Chunk;
+        }
+        else
+        {
+            Chunk->Next = Arena->Head;
+            Arena->Head = Chunk;
+        }
+
+#ifdef _DEBUG
+        Arena->ChunkCount++;
+#endif
+    }
+
+    Memory = (PVOID)((char *)Chunk + HeaderSize + Chunk->Used);
+    Chunk->Used += Size;
+
+#ifdef _DEBUG
+    Arena->AllocationCount++;
+    Arena->AllocatedBytes += Size;
+#endif
+
+    return Memory;
+}
+
+/**
+ * @brief Frees all the memory of an arena
+ *
+ * @param Arena the arena to release
+ * @return VOID
+ */
+VOID
+ArenaRelease(PSCRIPT_ENGINE_ARENA Arena)
+{
+    PSCRIPT_ENGINE_ARENA_CHUNK Chunk = Arena->Head;
+
+#ifdef _DEBUG
+    if (Arena->AllocationCount)
+    {
+        printf("token arena: %llu allocations, %llu bytes, %llu chunks\n",
+               Arena->AllocationCount,
+               Arena->AllocatedBytes,
+               Arena->ChunkCount);
+    }
+#endif
+
+    while (Chunk != NULL)
+    {
+        PSCRIPT_ENGINE_ARENA_CHUNK Next = Chunk->Next;
+
+        free(Chunk);
+        Chunk = Next;
+    }
+
+    PlatformZeroMemory(Arena, sizeof(SCRIPT_ENGINE_ARENA));
+}
+
+/**
+ * @brief Sets the arena that the tokens and token lists of the current
+ * compilation are allocated from
+ *
+ * @param Arena the new arena or NULL for allocating from the heap
+ * @return PSCRIPT_ENGINE_ARENA the previous arena
+ */
+PSCRIPT_ENGINE_ARENA
+SwitchTokenArena(PSCRIPT_ENGINE_ARENA Arena)
+{
+    PSCRIPT_ENGINE_ARENA PreviousArena;
+
+    if (g_CompilerContext == NULL)
+    {
+        return NULL;
+    }
+
+    PreviousArena                       = g_CompilerContext->ActiveTokenArena;
+    g_CompilerContext->ActiveTokenArena = Arena;
+
+    return PreviousArena;
+}
+
+/**
+ * @brief Returns the arena that new tokens are allocated from
+ *
+ * @return PSCRIPT_ENGINE_ARENA the arena or NULL for the heap
+ */
+static PSCRIPT_ENGINE_ARENA
+GetTokenArena(VOID)
+{
+    return g_CompilerContext ? g_CompilerContext->ActiveTokenArena : NULL;
+}
+
+/**
+ * @brief Allocates zeroed memory for a token or a token list
+ *
+ * @param Arena the arena to allocate from or NULL for the heap
+ * @param Size the size of the allocation
+ * @return PVOID the allocated memory or NULL
+ */
+static PVOID
+TokenAllocate(PSCRIPT_ENGINE_ARENA Arena, size_t Size)
+{
+    return Arena ? ArenaAllocate(Arena, Size) : calloc(1, Size);
+}
+
+/**
+ * @brief Frees the memory of a token or a token list
+ * @details the memory of an arena is only freed by ArenaRelease
+ *
+ * @param Arena the arena of the memory or NULL for the heap
+ * @param Memory the memory to free
+ * @return VOID
+ */
+static VOID
+TokenFree(PSCRIPT_ENGINE_ARENA Arena, PVOID Memory)
+{
+    if (Arena == NULL)
+    {
+        free(Memory);
+    }
+}
+
 /**
  * @brief Allocates a new token
  *
@@ -19,12 +183,13 @@
 PSCRIPT_ENGINE_TOKEN
 NewUnknownToken()
 {
+    PSCRIPT_ENGINE_ARENA Arena = GetTokenArena();
     PSCRIPT_ENGINE_TOKEN Token;
 
     //
     // Allocate memory for token and its value
     //
-    Token = (PSCRIPT_ENGINE_TOKEN)malloc(sizeof(SCRIPT_ENGINE_TOKEN));
+    Token = (PSCRIPT_ENGINE_TOKEN)TokenAllocate(Arena, sizeof(SCRIPT_ENGINE_TOKEN));
 
     if (Token == NULL)
     {
@@ -34,14 +199,14 @@ NewUnknownToken()
         return NULL;
     }
 
-    Token->Value = (char *)calloc(TOKEN_VALUE_MAX_LEN + 1, sizeof(char));
+    Token->Value = (char *)TokenAllocate(Arena, (TOKEN_VALUE_MAX_LEN + 1) * sizeof(char));
 
     if (Token->Value == NULL)
     {
         //
         // There was an error allocating buffer
         //
-        free(Token);
+        TokenFree(Arena, Token);
         return NULL;
     }
 
@@ -49,14 +214,18 @@ NewUnknownToken()
     // Init fields
     //
     strcpy(Token->Value, "");
-    Token->Type              = UNKNOWN;
-    Token->Len               = 0;
-    Token->MaxLen            = TOKEN_VALUE_MAX_LEN;
-    Token->VariableType      = (VARIABLE_TYPE *)VARIABLE_TYPE_LONG;
-    Token->VariableMemoryIdx = 0;
-    Token->AddressSpace      = 0;
-    Token->IsAddress         = FALSE;
-    Token->IsImplicitType    = FALSE;
+    Token->Type                = UNKNOWN;
+    Token->Len                 = 0;
+    Token->MaxLen              = TOKEN_VALUE_MAX_LEN;
+    Token->VariableType        = (VARIABLE_TYPE *)VARIABLE_TYPE_LONG;
+    Token->VariableMemoryIdx   = 0;
+    Token->AddressSpace        = 0;
+    Token->IsAddress           = FALSE;
+    Token->IsImplicitType      = FALSE;
+    Token->IsPercpu            = FALSE;
+    Token->TerminalIdCache     = 0;
+    Token->LalrTerminalIdCache = 0;
+    Token->Arena               = Arena;
 
     return Token;
 }
@@ -71,10 +240,12 @@ NewUnknownToken()
 PSCRIPT_ENGINE_TOKEN
 NewToken(SCRIPT_ENGINE_TOKEN_TYPE Type, char * Value)
 {
+    PSCRIPT_ENGINE_ARENA Arena = GetTokenArena();
+
     //
     // Allocate memory for token]
     //
-    PSCRIPT_ENGINE_TOKEN Token = (PSCRIPT_ENGINE_TOKEN)malloc(sizeof(SCRIPT_ENGINE_TOKEN));
+    PSCRIPT_ENGINE_TOKEN Token = (PSCRIPT_ENGINE_TOKEN)TokenAllocate(Arena, sizeof(SCRIPT_ENGINE_TOKEN));
 
     if (Token == NULL)
     {
@@ -91,23 +262,27 @@ NewToken(SCRIPT_ENGINE_TOKEN_TYPE Type, char * Value)
     // test for a full buffer with 'Len >= MaxLen - 1' on an unsigned type, so a zero
     // MaxLen would wrap around and let those routines write past the allocation
     //
-    unsigned int Len         = (unsigned int)strlen(Value);
-    Token->Type              = Type;
-    Token->Len               = Len;
-    Token->MaxLen            = Len > TOKEN_VALUE_MAX_LEN ? Len : TOKEN_VALUE_MAX_LEN;
-    Token->Value             = (char *)calloc(Token->MaxLen + 1, sizeof(char));
-    Token->VariableType      = (VARIABLE_TYPE *)VARIABLE_TYPE_LONG;
-    Token->VariableMemoryIdx = 0;
-    Token->AddressSpace      = 0;
-    Token->IsAddress         = FALSE;
-    Token->IsImplicitType    = FALSE;
+    unsigned int Len           = (unsigned int)strlen(Value);
+    Token->Type                = Type;
+    Token->Len                 = Len;
+    Token->MaxLen              = Len > TOKEN_VALUE_MAX_LEN ? Len : TOKEN_VALUE_MAX_LEN;
+    Token->Value               = (char *)TokenAllocate(Arena, (Token->MaxLen + 1) * sizeof(char));
+    Token->VariableType        = (VARIABLE_TYPE *)VARIABLE_TYPE_LONG;
+    Token->VariableMemoryIdx   = 0;
+    Token->AddressSpace        = 0;
+    Token->IsAddress           = FALSE;
+    Token->IsImplicitType      = FALSE;
+    Token->IsPercpu            = FALSE;
+    Token->TerminalIdCache     = 0;
+    Token->LalrTerminalIdCache = 0;
+    Token->Arena               = Arena;
 
     if (Token->Value == NULL)
     {
         //
         // There was an error allocating buffer
         //
-        free(Token);
+        TokenFree(Arena, Token);
         return NULL;
     }
 
@@ -125,8 +300,11 @@ NewToken(SCRIPT_ENGINE_TOKEN_TYPE Type, char * Value)
 void
 RemoveToken(PSCRIPT_ENGINE_TOKEN * Token)
 {
-    free((*Token)->Value);
-    free(*Token);
+    //
+    // Tokens of an arena are freed when the arena is released
+    //
+    TokenFree((*Token)->Arena, (*Token)->Value);
+    TokenFree((*Token)->Arena, *Token);
     *Token = NULL;
     return;
 }
@@ -261,7 +439,7 @@ AppendByte(PSCRIPT_ENGINE_TOKEN Token, char c)
         // Double the length of the allocated space for the string
         //
         unsigned int NewMaxLen = Token->MaxLen * 2;
-        char *       NewValue  = (char *)calloc(NewMaxLen + 1, sizeof(char));
+        char *       NewValue  = (char *)TokenAllocate(Token->Arena, (NewMaxLen + 1) * sizeof(char));
 
         if (NewValue == NULL)
         {
@@ -278,7 +456,7 @@ AppendByte(PSCRIPT_ENGINE_TOKEN Token, char c)
         // Free Old buffer and update the pointer
         //
         memcpy(NewValue, Token->Value, Token->Len);
-        free(Token->Value);
+        TokenFree(Token->Arena, Token->Value);
         Token->Value  = NewValue;
         Token->MaxLen = NewMaxLen;
     }
@@ -309,7 +487,7 @@ AppendWchar(PSCRIPT_ENGINE_TOKEN Token, wchar_t c)
         // Double the length of the allocated space for the wstring
         //
         unsigned int NewMaxLen = Token->MaxLen * 2;
-        char *       NewValue  = (char *)calloc(NewMaxLen + 2, sizeof(char));
+        char *       NewValue  = (char *)TokenAllocate(Token->Arena, (NewMaxLen + 2) * sizeof(char));
 
         if (NewValue == NULL)
         {
@@ -325,7 +503,7 @@ AppendWchar(PSCRIPT_ENGINE_TOKEN Token, wchar_t c)
         // Free Old buffer and update the pointer
         //
         memcpy(NewValue, Token->Value, Token->Len);
-        free(Token->Value);
+        TokenFree(Token->Arena, Token->Value);
         Token->Value  = NewValue;
         Token->MaxLen = NewMaxLen;
     }
@@ -346,7 +524,8 @@ AppendWchar(PSCRIPT_ENGINE_TOKEN Token, wchar_t c)
 PSCRIPT_ENGINE_TOKEN
 CopyToken(PSCRIPT_ENGINE_TOKEN Token)
 {
-    PSCRIPT_ENGINE_TOKEN TokenCopy = (PSCRIPT_ENGINE_TOKEN)malloc(sizeof(SCRIPT_ENGINE_TOKEN));
+    PSCRIPT_ENGINE_ARENA Arena     = GetTokenArena();
+    PSCRIPT_ENGINE_TOKEN TokenCopy = (PSCRIPT_ENGINE_TOKEN)TokenAllocate(Arena, sizeof(SCRIPT_ENGINE_TOKEN));
 
     if (TokenCopy == NULL)
     {
@@ -383,19 +562,28 @@ CopyToken(PSCRIPT_ENGINE_TOKEN Token)
     //
     TokenCopy->MaxLen            = MaxLen;
     TokenCopy->Len               = Token->Len;
-    TokenCopy->Value             = (char *)calloc(MaxLen + 2, sizeof(char));
+    TokenCopy->Value             = (char *)TokenAllocate(Arena, (MaxLen + 2) * sizeof(char));
     TokenCopy->VariableType      = Token->VariableType;
     TokenCopy->VariableMemoryIdx = Token->VariableMemoryIdx;
     TokenCopy->AddressSpace      = Token->AddressSpace;
     TokenCopy->IsAddress         = Token->IsAddress;
     TokenCopy->IsImplicitType    = Token->IsImplicitType;
+    TokenCopy->IsPercpu          = Token->IsPercpu;
+
+    //
+    // Semantic rules may change the type of the copy, so its terminal ids
+    // are resolved again if they are needed
+    //
+    TokenCopy->TerminalIdCache     = 0;
+    TokenCopy->LalrTerminalIdCache = 0;
+    TokenCopy->Arena               = Arena;
 
     if (TokenCopy->Value == NULL)
     {
         //
         // There was an error allocating buffer
         //
-        free(TokenCopy);
+        TokenFree(Arena, TokenCopy);
         return NULL;
     }
 
@@ -412,12 +600,13 @@ CopyToken(PSCRIPT_ENGINE_TOKEN Token)
 PSCRIPT_ENGINE_TOKEN_LIST
 NewTokenList(void)
 {
+    PSCRIPT_ENGINE_ARENA      Arena     = GetTokenArena();
     PSCRIPT_ENGINE_TOKEN_LIST TokenList = NULL;
 
     //
     // Allocation of memory for SCRIPT_ENGINE_TOKEN_LIST structure
     //
-    TokenList = (PSCRIPT_ENGINE_TOKEN_LIST)malloc(sizeof(*TokenList));
+    TokenList = (PSCRIPT_ENGINE_TOKEN_LIST)TokenAllocate(Arena, sizeof(*TokenList));
 
     if (TokenList == NULL)
     {
@@ -432,18 +621,19 @@ NewTokenList(void)
     //
     TokenList->Pointer = 0;
     TokenList->Size    = TOKEN_LIST_INIT_SIZE;
+    TokenList->Arena   = Arena;
 
     //
     // Allocation of memory for SCRIPT_ENGINE_TOKEN_LIST buffer
     //
-    TokenList->Head = (PSCRIPT_ENGINE_TOKEN *)malloc(TokenList->Size * sizeof(PSCRIPT_ENGINE_TOKEN));
+    TokenList->Head = (PSCRIPT_ENGINE_TOKEN *)TokenAllocate(Arena, TokenList->Size * sizeof(PSCRIPT_ENGINE_TOKEN));
 
     if (TokenList->Head == NULL)
     {
         //
         // There was an error allocating buffer
         //
-        free(TokenList);
+        TokenFree(Arena, TokenList);
         return NULL;
     }
 
@@ -465,8 +655,8 @@ RemoveTokenList(PSCRIPT_ENGINE_TOKEN_LIST TokenList)
         Token = *(TokenList->Head + i);
         RemoveToken(&Token);
     }
-    free(TokenList->Head);
-    free(TokenList);
+    TokenFree(TokenList->Arena, TokenList->Head);
+    TokenFree(TokenList->Arena, TokenList);
 
     return;
 }
@@ -523,7 +713,7 @@ Push(PSCRIPT_ENGINE_TOKEN_LIST TokenList, PSCRIPT_ENGINE_TOKEN Token)
         //
         // Allocate a new buffer for string list with doubled length
         //
-        PSCRIPT_ENGINE_TOKEN * NewHead = (PSCRIPT_ENGINE_TOKEN *)malloc(2 * TokenList->Size * sizeof(PSCRIPT_ENGINE_TOKEN));
+        PSCRIPT_ENGINE_TOKEN * NewHead = (PSCRIPT_ENGINE_TOKEN *)TokenAllocate(TokenList->Arena, 2 * TokenList->Size * sizeof(PSCRIPT_ENGINE_TOKEN));
 
         if (NewHead == NULL)
         {
@@ -539,7 +729,7 @@ Push(PSCRIPT_ENGINE_TOKEN_LIST TokenList, PSCRIPT_ENGINE_TOKEN Token)
         //
         // Free old buffer
         //
-        free(TokenList->Head);
+        TokenFree(TokenList->Arena, TokenList->Head);
 
         //
         // Update Head and size of TokenList
@@ -607,6 +797,198 @@ TopIndexed(PSCRIPT_ENGINE_TOKEN_LIST TokenList, int Index)
     return *ReadAddr;
 }
 
+/**
+ * @brief Computes the hash of an identifier name (FNV-1a)
+ *
+ * @param Name the null-terminated identifier name
+ * @return unsigned int
+ */
+static unsigned int
+IdTableHash(const char * Name)
+{
+    unsigned int Hash = 2166136261u;
+
+    while (*Name)
+    {
+        Hash ^= (unsigned char)*Name++;
+        Hash *= 16777619u;
+    }
+
+    return Hash;
+}
+
+/**
+ * @brief Inserts an index of the identifier list into the hash index
+ * @details the caller makes sure that there is at least one free bucket
+ *
+ * @param Buckets the bucket array
+ * @param BucketCount number of buckets (a power of two)
+ * @param Name the identifier name
+ * @param Index the index of the identifier in the list
+ * @return VOID
+ */
+static VOID
+IdTableInsertIndex(unsigned int * Buckets, unsigned int BucketCount, const char * Name, unsigned int Index)
+{
+    unsigned int Mask = BucketCount - 1;
+    unsigned int Slot = IdTableHash(Name) & Mask;
+
+    //
+    // Linear probing until an empty bucket is found
+    //
+    while (Buckets[Slot] != 0)
+    {
+        Slot = (Slot + 1) & Mask;
+    }
+
+    Buckets[Slot] = Index + 1;
+}
+
+/**
+ * @brief Allocates a new SCRIPT_ENGINE_ID_TABLE
+ *
+ * @return PSCRIPT_ENGINE_ID_TABLE the allocated identifier table
+ */
+PSCRIPT_ENGINE_ID_TABLE
+NewIdTable(void)
+{
+    PSCRIPT_ENGINE_ID_TABLE IdTable = (PSCRIPT_ENGINE_ID_TABLE)malloc(sizeof(*IdTable));
+
+    if (IdTable == NULL)
+    {
+        //
+        // There was an error allocating buffer
+        //
+        return NULL;
+    }
+
+    IdTable->List        = NewTokenList();
+    IdTable->BucketCount = ID_TABLE_INIT_BUCKET_COUNT;
+    IdTable->Buckets     = (unsigned int *)calloc(IdTable->BucketCount, sizeof(unsigned int));
+
+    if (IdTable->List == NULL || IdTable->Buckets == NULL)
+    {
+        //
+        // There was an error allocating buffer
+        //
+        if (IdTable->List)
+            RemoveTokenList(IdTable->List);
+
+        free(IdTable->Buckets);
+        free(IdTable);
+        return NULL;
+    }
+
+    return IdTable;
+}
+
+/**
+ * @brief Removes allocated memory of a SCRIPT_ENGINE_ID_TABLE and its tokens
+ *
+ * @param IdTable
+ * @return VOID
+ */
+VOID
+RemoveIdTable(PSCRIPT_ENGINE_ID_TABLE IdTable)
+{
+    RemoveTokenList(IdTable->List);
+    free(IdTable->Buckets);
+    free(IdTable);
+}
+
+/**
+ * @brief Appends an identifier to the table
+ * @details the table takes the ownership of the token. If the name is
+ * already in the table, the earlier declaration is the one that is found
+ * by the lookups, which is the same behavior as a linear scan of the list
+ *
+ * @param IdTable
+ * @param Token the identifier token
+ * @return int the index of the identifier in the declaration order
+ */
+int
+IdTableAdd(PSCRIPT_ENGINE_ID_TABLE IdTable, PSCRIPT_ENGINE_TOKEN Token)
+{
+    unsigned int Index = IdTable->List->Pointer;
+
+    //
+    // Keep the load factor under one half, so probe sequences stay short
+    //
+    if ((Index + 1) * 2 > IdTable->BucketCount)
+    {
+        unsigned int   NewBucketCount = IdTable->BucketCount * 2;
+        unsigned int * NewBuckets     = (unsigned int *)calloc(NewBucketCount, sizeof(unsigned int));
+
+        if (NewBuckets == NULL)
+        {
+            printf("err, could not allocate buffer");
+            return -1;
+        }
+
+        //
+        // Re-insert the first declaration of each name (the list order makes
+        // sure that the earlier declaration wins the lookup)
+        //
+        for (unsigned int i = 0; i < Index; i++)
+        {
+            const char * Name = IdTable->List->Head[i]->Value;
+
+            if (IdTableFind(IdTable, Name, NULL) == IdTable->List->Head[i])
+            {
+                IdTableInsertIndex(NewBuckets, NewBucketCount, Name, i);
+            }
+        }
+
+        free(IdTable->Buckets);
+        IdTable->Buckets     = NewBuckets;
+        IdTable->BucketCount = NewBucketCount;
+    }
+
+    if (IdTableFind(IdTable, Token->Value, NULL) == NULL)
+    {
+        IdTableInsertIndex(IdTable->Buckets, IdTable->BucketCount, Token->Value, Index);
+    }
+
+    Push(IdTable->List, Token);
+
+    return (int)Index;
+}
+
+/**
+ * @brief Finds the first declaration of an identifier in the table
+ *
+ * @param IdTable
+ * @param Name the identifier name
+ * @param Index if not NULL, receives the index of the identifier (or -1)
+ * @return PSCRIPT_ENGINE_TOKEN the identifier token or NULL if not found
+ */
+PSCRIPT_ENGINE_TOKEN
+IdTableFind(PSCRIPT_ENGINE_ID_TABLE IdTable, const char * Name, int * Index)
+{
+    unsigned int Mask = IdTable->BucketCount - 1;
+    unsigned int Slot = IdTableHash(Name) & Mask;
+
+    while (IdTable->Buckets[Slot] != 0)
+    {
+        PSCRIPT_ENGINE_TOKEN CurrentToken = IdTable->List->Head[IdTable->Buckets[Slot] - 1];
+
+        if (!strcmp(Name, CurrentToken->Value))
+        {
+            if (Index)
+                *Index = (int)(IdTable->Buckets[Slot] - 1);
+
+            return CurrentToken;
+        }
+
+        Slot = (Slot + 1) & Mask;
+    }
+
+    if (Index)
+        *Index = -1;
+
+    return NULL;
+}
+
 /**
  * @brief Checks whether input char belongs to hexadecimal digit-set or not
  *
@@ -706,14 +1088,13 @@ IsOctal(char c)
 PSCRIPT_ENGINE_TOKEN
 NewTemp(PSCRIPT_ENGINE_ERROR_TYPE Error)
 {
-    static unsigned int TempID = 0;
     int                 i;
     for (i = 0; i < MAX_TEMP_COUNT; i++)
     {
-        if (CurrentUserDefinedFunction->TempMap[i] == 0)
+        if (g_CompilerContext->CurrentUserDefinedFunction->TempMap[i] == 0)
         {
-            TempID                                 = i;
-            CurrentUserDefinedFunction->TempMap[i] = 1;
+            g_CompilerContext->TempId                                 = i;
+            g_CompilerContext->CurrentUserDefinedFunction->TempMap[i] = 1;
             break;
         }
     }
@@ -723,13 +1104,13 @@ NewTemp(PSCRIPT_ENGINE_ERROR_TYPE Error)
     }
     PSCRIPT_ENGINE_TOKEN Temp = NewUnknownToken();
     char                 TempValue[8];
-    sprintf(TempValue, "%d", TempID);
+    sprintf(TempValue, "%d", g_CompilerContext->TempId);
     strcpy(Temp->Value, TempValue);
     Temp->Type = TEMP;
 
-    if (CurrentUserDefinedFunction->MaxTempNumber < (i + 1))
+    if (g_CompilerContext->CurrentUserDefinedFunction->MaxTempNumber < (i + 1))
     {
-        CurrentUserDefinedFunction->MaxTempNumber = i + 1;
+        g_CompilerContext->CurrentUserDefinedFunction->MaxTempNumber = i + 1;
     }
 
     return Temp;
@@ -757,7 +1138,7 @@ FreeTemp(PSCRIPT_ENGINE_TOKEN Temp)
 
     if (Id >= 0 && Id < MAX_TEMP_COUNT)
     {
-        CurrentUserDefinedFunction->TempMap[Id] = 0;
+        g_CompilerContext->CurrentUserDefinedFunction->TempMap[Id] = 0;
     }
 }
 
@@ -1101,6 +1482,26 @@ IsType16Func(PSCRIPT_ENGINE_TOKEN Operator)
     return 0;
 }
 
+/**
+ * @brief Checks whether this Token type is VarArgFunc2
+ *
+ * @param Operator the token to check
+ * @return char
+ */
+char
+IsType17Func(PSCRIPT_ENGINE_TOKEN Operator)
+{
+    unsigned int n = VARARGFUNC2_LENGTH;
+    for (unsigned int i = 0; i < n; i++)
+    {
+        if (!strcmp(Operator->Value, VarArgFunc2[i]))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
 /**
  * @brief Checks whether this Token type is assignment operator
  *
@@ -1153,6 +1554,120 @@ IsSemanticRule(PSCRIPT_ENGINE_TOKEN Token)
         return 0;
 }
 
+/**
+ * @brief Computes the hash of a name for the perfect hash tables
+ * @details FNV-1a, must be the same as PerfectHashFunction in perfect_hash.py
+ *
+ * @param Name the name to hash
+ * @return unsigned int the hash of the name
+ */
+static unsigned int
+PerfectHashFunction(const char * Name)
+{
+    unsigned int Hash = 2166136261u;
+
+    while (*Name)
+    {
+        Hash ^= (unsigned char)*Name++;
+        Hash *= 16777619u;
+    }
+
+    return Hash;
+}
+
+/**
+ * @brief Mixes the hash of a name with a seed of a perfect hash table
+ * @details must be the same as PerfectHashMix in perfect_hash.py
+ *
+ * @param Hash the hash of the name
+ * @param Seed the seed of the bucket (zero for finding the bucket)
+ * @return unsigned int the mixed hash
+ */
+static unsigned int
+PerfectHashMix(unsigned int Hash, unsigned int Seed)
+{
+    Hash ^= Seed;
+    Hash ^= Hash >> 16;
+    Hash *= 0x7feb352du;
+    Hash ^= Hash >> 15;
+    Hash *= 0x846ca68bu;
+    Hash ^= Hash >> 16;
+
+    return Hash;
+}
+
+/**
+ * @brief Finds a name in a perfect hash table
+ *
+ * @param Table the perfect hash table (created by the generator)
+ * @param Name the name to find
+ * @return long long unsigned the value of the name or INVALID
+ */
+long long unsigned
+PerfectHashLookup(const PERFECT_HASH_TABLE * Table, const char * Name)
+{
+    unsigned int       Hash  = PerfectHashFunction(Name);
+    unsigned int       Seed  = Table->Seeds[PerfectHashMix(Hash, 0) & Table->SeedMask];
+    const SYMBOL_MAP * Entry = &Table->Entries[PerfectHashMix(Hash, Seed) & Table->EntryMask];
+
+    //
+    // Each name can only be in one entry, names that are not in the
+    // table land on an empty entry or on an entry of another name
+    //
+    if (Entry->Name != NULL && !strcmp(Entry->Name, Name))
+    {
+        return Entry->Type;
+    }
+
+    return INVALID;
+}
+
+/**
+ * @brief Gets the name of the terminal that matches the token
+ *
+ * @param Token the token to get the terminal name of
+ * @return const char * the name of the terminal
+ */
+static const char *
+GetTerminalName(PSCRIPT_ENGINE_TOKEN Token)
+{
+    switch (Token->Type)
+    {
+    case HEX:
+        return "_hex";
+    case FLOAT_LITERAL:
+        return "_float";
+    case GLOBAL_ID:
+    case GLOBAL_UNRESOLVED_ID:
+        return "_global_id";
+    case LOCAL_ID:
+    case LOCAL_UNRESOLVED_ID:
+        return "_local_id";
+    case FUNCTION_ID:
+        return "_function_id";
+    case FUNCTION_PARAMETER_ID:
+        return "_function_parameter_id";
+    case REGISTER:
+        return "_register";
+    case PSEUDO_REGISTER:
+        return "_pseudo_register";
+    case SCRIPT_VARIABLE_TYPE:
+        return "_script_variable_type";
+    case DECIMAL:
+        return "_decimal";
+    case BINARY:
+        return "_binary";
+    case OCTAL:
+        return "_octal";
+    case STRING:
+        return "_string";
+    case WSTRING:
+        return "_wstring";
+    default: // Keyword
+        return Token->Value;
+    }
+}
+
 /**
  * @brief Gets the Non Terminal Id object
  *
@@ -1162,16 +1677,13 @@ IsSemanticRule(PSCRIPT_ENGINE_TOKEN Token)
 int
 GetNonTerminalId(PSCRIPT_ENGINE_TOKEN Token)
 {
-    for (int i = 0; i < NONETERMINAL_COUNT; i++)
-    {
-        if (!strcmp(Token->Value, NoneTerminalMap[i]))
-            return i;
-    }
-    return INVALID;
+    return (int)PerfectHashLookup(&NonTerminalHashTable, Token->Value);
 }
 
 /**
  * @brief Gets the Terminal Id object
+ * @details the id is cached in the token as the LL(1) parser asks for the
+ * terminal id of the current input token once for each expanded rule
  *
  * @param Token the token to get the terminal ID of
  * @return int the terminal ID or INVALID
@@ -1179,109 +1691,12 @@ GetNonTerminalId(PSCRIPT_ENGINE_TOKEN Token)
 int
 GetTerminalId(PSCRIPT_ENGINE_TOKEN Token)
 {
-    for (int i = 0; i < TERMINAL_COUNT; i++)
+    if (Token->TerminalIdCache == 0)
     {
-        if (Token->Type == HEX)
-        {
-            if (!strcmp("_hex", TerminalMap[i]))
-                return i;
-        }
-        else if (Token->Type == FLOAT_LITERAL)
-        {
-            if (!strcmp("_float", TerminalMap[i]))
-                return i;
-        }
-        else if (Token->Type == GLOBAL_ID || Token->Type == GLOBAL_UNRESOLVED_ID)
-        {
-            if (!strcmp("_global_id", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == LOCAL_ID || Token->Type == LOCAL_UNRESOLVED_ID)
-        {
-            if (!strcmp("_local_id", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == FUNCTION_ID)
-        {
-            if (!strcmp("_function_id", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == FUNCTION_PARAMETER_ID)
-        {
-            if (!strcmp("_function_parameter_id", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == REGISTER)
-        {
-            if (!strcmp("_register", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == PSEUDO_REGISTER)
-        {
-            if (!strcmp("_pseudo_register", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == SCRIPT_VARIABLE_TYPE)
-        {
-            if (!strcmp("_script_variable_type", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == DECIMAL)
-        {
-            if (!strcmp("_decimal", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == BINARY)
-        {
-            if (!strcmp("_binary", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == OCTAL)
-        {
-            if (!strcmp("_octal", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == STRING)
-        {
-            if (!strcmp("_string", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == WSTRING)
-        {
-            if (!strcmp("_wstring", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else // Keyword
-        {
-            if (!strcmp(Token->Value, TerminalMap[i]))
-                return i;
-        }
+        Token->TerminalIdCache = (int)PerfectHashLookup(&TerminalHashTable, GetTerminalName(Token)) + 1;
     }
-    return INVALID;
+
+    return Token->TerminalIdCache - 1;
 }
 
 /**
@@ -1293,16 +1708,13 @@ GetTerminalId(PSCRIPT_ENGINE_TOKEN Token)
 int
 LalrGetNonTerminalId(PSCRIPT_ENGINE_TOKEN Token)
 {
-    for (int i = 0; i < LALR_NONTERMINAL_COUNT; i++)
-    {
-        if (!strcmp(Token->Value, LalrNoneTerminalMap[i]))
-            return i;
-    }
-    return INVALID;
+    return (int)PerfectHashLookup(&LalrNonTerminalHashTable, Token->Value);
 }
 
 /**
  * @brief Gets the Terminal Id object
+ * @details the id is cached in the token as the LALR(1) parser asks for the
+ * terminal id of the current input token once for each reduction
  *
  * @param Token the token to get the terminal ID of
  * @return int the terminal ID or INVALID
@@ -1310,109 +1722,12 @@ LalrGetNonTerminalId(PSCRIPT_ENGINE_TOKEN Token)
 int
 LalrGetTerminalId(PSCRIPT_ENGINE_TOKEN Token)
 {
-    for (int i = 0; i < LALR_TERMINAL_COUNT; i++)
+    if (Token->LalrTerminalIdCache == 0)
     {
-        if (Token->Type == HEX)
-        {
-            if (!strcmp("_hex", LalrTerminalMap[i]))
-                return i;
-        }
-        else if (Token->Type == FLOAT_LITERAL)
-        {
-            if (!strcmp("_float", LalrTerminalMap[i]))
-                return i;
-        }
-        else if (Token->Type == GLOBAL_ID || Token->Type == GLOBAL_UNRESOLVED_ID)
-        {
-            if (!strcmp("_global_id", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == LOCAL_ID || Token->Type == LOCAL_UNRESOLVED_ID)
-        {
-            if (!strcmp("_local_id", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == FUNCTION_ID)
-        {
-            if (!strcmp("_function_id", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == FUNCTION_PARAMETER_ID)
-        {
-            if (!strcmp("_function_parameter_id", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == SCRIPT_VARIABLE_TYPE)
-        {
-            if (!strcmp("_script_variable_type", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == REGISTER)
-        {
-            if (!strcmp("_register", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == PSEUDO_REGISTER)
-        {
-            if (!strcmp("_pseudo_register", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == DECIMAL)
-        {
-            if (!strcmp("_decimal", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == BINARY)
-        {
-            if (!strcmp("_binary", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == OCTAL)
-        {
-            if (!strcmp("_octal", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == STRING)
-        {
-            if (!strcmp("_string", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == WSTRING)
-        {
-            if (!strcmp("_wstring", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else // Keyword
-        {
-            if (!strcmp(Token->Value, LalrTerminalMap[i]))
-                return i;
-        }
+        Token->LalrTerminalIdCache = (int)PerfectHashLookup(&LalrTerminalHashTable, GetTerminalName(Token)) + 1;
     }
-    return INVALID;
+
+    return Token->LalrTerminalIdCache - 1;
 }
 
 /**
@@ -1632,3 +1947,51 @@ RotateLeftStringOnce(char * str)
     }
     str[Length - 1] = Temp;
 }
+
+/**
+ * @brief Tries to get the lock and won't return until successfully get the lock
+ *
+ * @param Lock Lock variable
+ * @return VOID
+ */
+VOID
+ScriptEngineSpinlockLock(volatile LONG * Lock)
+{
+    UINT32 Wait = 1;
+
+    while ((*Lock) || CpuInterlockedBitTestAndSet(Lock, 0))
+    {
+        for (UINT32 i = 0; i < Wait; ++i)
+        {
+            CpuPause();
+        }
+
+        //
+        // Don't call "pause" too many times. If the wait becomes too big,
+        // clamp it to the maximum wait
+        //
+        if (Wait * 2 <= 65536)
+        {
+            Wait = Wait * 2;
+        }
+    }
+}
+
+/**
+ * @brief Release the lock
+ *
+ * @param Lock Lock variable
+ * @return VOID
+ */
+VOID
+ScriptEngineSpinlockUnlock(volatile LONG * Lock)
+{
+    //
+    // The stores of the protected data must not be moved after the release
+    //
+#ifdef _WIN32
+    InterlockedExchange(Lock, 0);
+#else
+    __atomic_store_n(Lock, 0, __ATOMIC_RELEASE);
+#endif
+}
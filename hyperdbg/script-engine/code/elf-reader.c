@@ -0,0 +1,2955 @@
+/**
+ * @file elf-reader.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Memory-mapped reader of the ELF files and their DWARF debug information
+ * @details The symbol backend of Linux reads the Linux debuggees (vmlinux,
+ * the kernel modules and the user-mode binaries) by this reader. The file is
+ * mapped and only the headers of its sections are read when it's opened; the
+ * symbols (.symtab) are hashed when they are first looked up, and the units
+ * of the debug information (.debug_info) are indexed one by one until the
+ * name that is looked up is found, so a vmlinux with full debug information
+ * is never parsed up front. The addresses are converted to the lines by the
+ * line program (.debug_line) of the unit of the address only
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+#ifdef __linux__
+
+#    include <fcntl.h>
+#    include <strings.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+
+/**
+ * @brief Read a 16-bit value of the file
+ *
+ * @param Data
+ * @return UINT16
+ */
+static UINT16
+ElfRead16(const BYTE * Data)
+{
+    UINT16 Value;
+
+    memcpy(&Value, Data, sizeof(Value));
+
+    return Value;
+}
+
+/**
+ * @brief Read a 32-bit value of the file
+ *
+ * @param Data
+ * @return UINT32
+ */
+static UINT32
+ElfRead32(const BYTE * Data)
+{
+    UINT32 Value;
+
+    memcpy(&Value, Data, sizeof(Value));
+
+    return Value;
+}
+
+/**
+ * @brief Read a 64-bit value of the file
+ *
+ * @param Data
+ * @return UINT64
+ */
+static UINT64
+ElfRead64(const BYTE * Data)
+{
+    UINT64 Value;
+
+    memcpy(&Value, Data, sizeof(Value));
+
+    return Value;
+}
+
+/**
+ * @brief Check whether the range [Offset, Offset + Length) is in a buffer
+ *
+ * @param Size
+ * @param Offset
+ * @param Length
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfHasRange(UINT64 Size, UINT64 Offset, UINT64 Length)
+{
+    return Offset <= Size && Length <= Size - Offset;
+}
+
+/**
+ * @brief Hash of the names
+ * @details The hash is case-insensitive (FNV-1a of the lowercase name), so
+ * the names can be looked up in both ways
+ *
+ * @param Name
+ * @return UINT32
+ */
+static UINT32
+ElfHashName(const CHAR * Name)
+{
+    UINT32 Result = 0x811c9dc5;
+
+    for (; *Name != '\0'; Name++)
+    {
+        Result ^= (UINT32)tolower((unsigned char)*Name);
+        Result *= 0x01000193;
+    }
+
+    return Result;
+}
+
+/**
+ * @brief Initialize a cursor of a section
+ *
+ * @param Reader
+ * @param Data
+ * @param Size
+ * @param Offset
+ * @return VOID
+ */
+static VOID
+ElfInitializeReader(PELF_READER Reader, const BYTE * Data, UINT64 Size, UINT64 Offset)
+{
+    Reader->Data    = Data;
+    Reader->Size    = Size;
+    Reader->Offset  = Offset;
+    Reader->IsValid = Data != NULL && Offset <= Size;
+}
+
+/**
+ * @brief Check whether the cursor has the next bytes
+ *
+ * @param Reader
+ * @param Length
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfReaderHas(PELF_READER Reader, UINT64 Length)
+{
+    if (!Reader->IsValid || !ElfHasRange(Reader->Size, Reader->Offset, Length))
+    {
+        Reader->IsValid = FALSE;
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Skip the next bytes of the cursor
+ *
+ * @param Reader
+ * @param Length
+ * @return VOID
+ */
+static VOID
+ElfSkip(PELF_READER Reader, UINT64 Length)
+{
+    if (ElfReaderHas(Reader, Length))
+    {
+        Reader->Offset += Length;
+    }
+}
+
+/**
+ * @brief Read a little-endian value of 1 to 8 bytes
+ *
+ * @param Reader
+ * @param Length
+ * @return UINT64
+ */
+static UINT64
+ElfReadFixed(PELF_READER Reader, UINT32 Length)
+{
+    UINT64 Value = 0;
+
+    if (Length > sizeof(UINT64) || !ElfReaderHas(Reader, Length))
+    {
+        Reader->IsValid = FALSE;
+        return 0;
+    }
+
+    for (UINT32 i = 0; i < Length; i++)
+    {
+        Value |= (UINT64)Reader->Data[Reader->Offset + i] << (i * 8);
+    }
+
+    Reader->Offset += Length;
+
+    return Value;
+}
+
+/**
+ * @brief Read an unsigned LEB128 value
+ *
+ * @param Reader
+ * @return UINT64
+ */
+static UINT64
+ElfReadUleb(PELF_READER Reader)
+{
+    UINT64 Value = 0;
+    UINT32 Shift = 0;
+    BYTE   Byte;
+
+    do
+    {
+        if (!ElfReaderHas(Reader, 1))
+        {
+            return 0;
+        }
+
+        Byte = Reader->Data[Reader->Offset++];
+
+        if (Shift < 64)
+        {
+            Value |= (UINT64)(Byte & 0x7f) << Shift;
+        }
+
+        Shift += 7;
+
+    } while (Byte & 0x80);
+
+    return Value;
+}
+
+/**
+ * @brief Read a signed LEB128 value
+ *
+ * @param Reader
+ * @return INT64
+ */
+static INT64
+ElfReadSleb(PELF_READER Reader)
+{
+    UINT64 Value = 0;
+    UINT32 Shift = 0;
+    BYTE   Byte;
+
+    do
+    {
+        if (!ElfReaderHas(Reader, 1))
+        {
+            return 0;
+        }
+
+        Byte = Reader->Data[Reader->Offset++];
+
+        if (Shift < 64)
+        {
+            Value |= (UINT64)(Byte & 0x7f) << Shift;
+        }
+
+        Shift += 7;
+
+    } while (Byte & 0x80);
+
+    if (Shift < 64 && (Byte & 0x40))
+    {
+        Value |= ~0ull << Shift;
+    }
+
+    return (INT64)Value;
+}
+
+/**
+ * @brief Read a null-terminated string
+ *
+ * @param Reader
+ * @return const CHAR * NULL if the string is not terminated in the section
+ */
+static const CHAR *
+ElfReadString(PELF_READER Reader)
+{
+    const BYTE * End;
+    const CHAR * String;
+
+    if (!ElfReaderHas(Reader, 1))
+    {
+        return NULL;
+    }
+
+    End = memchr(Reader->Data + Reader->Offset, '\0', Reader->Size - Reader->Offset);
+
+    if (End == NULL)
+    {
+        Reader->IsValid = FALSE;
+        return NULL;
+    }
+
+    String         = (const CHAR *)Reader->Data + Reader->Offset;
+    Reader->Offset = (UINT64)(End - Reader->Data) + 1;
+
+    return String;
+}
+
+/**
+ * @brief Get a null-terminated string of a section
+ *
+ * @param Section
+ * @param Offset
+ * @return const CHAR * NULL if the string is not in the section
+ */
+static const CHAR *
+ElfGetSectionString(const ELF_SECTION * Section, UINT64 Offset)
+{
+    if (Section->Data == NULL || Offset >= Section->Size ||
+        memchr(Section->Data + Offset, '\0', Section->Size - Offset) == NULL)
+    {
+        return NULL;
+    }
+
+    return (const CHAR *)Section->Data + Offset;
+}
+
+/**
+ * @brief Get the data of a section by its index
+ * @details The sections without data and the compressed sections are
+ * treated as they are not present
+ *
+ * @param Elf
+ * @param Index
+ * @param Section
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfGetSection(PELF_FILE Elf, UINT32 Index, PELF_SECTION Section)
+{
+    const BYTE * Header;
+    UINT64       Offset;
+    UINT64       Size;
+
+    if (Index >= Elf->SectionsCount)
+    {
+        return FALSE;
+    }
+
+    Header = Elf->SectionHeaders + (SIZE_T)Index * ELF_SECTION_HEADER_SIZE;
+    Offset = ElfRead64(Header + 24);
+    Size   = ElfRead64(Header + 32);
+
+    if (ElfRead32(Header + 4) == ELF_SHT_NOBITS || (ElfRead64(Header + 8) & ELF_SHF_COMPRESSED) ||
+        !ElfHasRange(Elf->MappingSize, Offset, Size))
+    {
+        return FALSE;
+    }
+
+    Section->Data = Elf->Mapping + Offset;
+    Section->Size = Size;
+
+    return TRUE;
+}
+
+/**
+ * @brief Apply the relocations of the debug sections of a relocatable object
+ * @details The offsets of the strings, the lines and the units of the debug
+ * information of the relocatable objects (the kernel modules) are the addends
+ * of their relocations, and they're written to the (private) mapping of the
+ * file, so the pages of the debug sections are copied on write
+ *
+ * @param Elf
+ * @return VOID
+ */
+static VOID
+ElfApplyRelocations(PELF_FILE Elf)
+{
+    if (ElfRead16(Elf->Mapping + 18) != ELF_MACHINE_X86_64)
+    {
+        return;
+    }
+
+    for (UINT32 i = 1; i < Elf->SectionsCount; i++)
+    {
+        const BYTE * SectionHeader = Elf->SectionHeaders + (SIZE_T)i * ELF_SECTION_HEADER_SIZE;
+        ELF_SECTION  Relocations;
+        ELF_SECTION  Symbols;
+        ELF_SECTION  Target;
+
+        if (ElfRead32(SectionHeader + 4) != ELF_SHT_RELA ||
+            !ElfGetSection(Elf, i, &Relocations) ||
+            !ElfGetSection(Elf, ElfRead32(SectionHeader + 40), &Symbols) ||
+            !ElfGetSection(Elf, ElfRead32(SectionHeader + 44), &Target))
+        {
+            continue;
+        }
+
+        //
+        // Only the debug sections (that are not loaded) are relocated
+        //
+        if (Target.Data != Elf->DebugInfo.Data && Target.Data != Elf->DebugLine.Data &&
+            Target.Data != Elf->DebugAranges.Data && Target.Data != Elf->DebugStrOffsets.Data &&
+            Target.Data != Elf->DebugAddr.Data)
+        {
+            continue;
+        }
+
+        for (UINT64 Offset = 0; Offset + ELF_RELA_SIZE <= Relocations.Size; Offset += ELF_RELA_SIZE)
+        {
+            const BYTE * Relocation = Relocations.Data + Offset;
+            UINT64       Location   = ElfRead64(Relocation);
+            UINT64       Info       = ElfRead64(Relocation + 8);
+            UINT64       Value      = ElfRead64(Relocation + 16);
+            UINT64       Symbol     = (Info >> 32) * ELF_SYMBOL_SIZE;
+            UINT32       Type       = (UINT32)Info;
+            BYTE *       Data       = (BYTE *)Target.Data + Location;
+
+            if (!ElfHasRange(Symbols.Size, Symbol, ELF_SYMBOL_SIZE))
+            {
+                continue;
+            }
+
+            Value += ElfRead64(Symbols.Data + Symbol + 8);
+
+            if (Type == ELF_R_X86_64_64 && ElfHasRange(Target.Size, Location, 8))
+            {
+                memcpy(Data, &Value, 8);
+            }
+            else if ((Type == ELF_R_X86_64_32 || Type == ELF_R_X86_64_32S) && ElfHasRange(Target.Size, Location, 4))
+            {
+                UINT32 Value32 = (UINT32)Value;
+
+                memcpy(Data, &Value32, 4);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Read the headers of the file and find its sections
+ *
+ * @param Elf
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfReadHeaders(PELF_FILE Elf)
+{
+    const BYTE * Header = Elf->Mapping;
+    UINT64       ProgramHeaders;
+    UINT16       ProgramHeadersCount;
+    UINT64       SectionHeaders;
+    UINT32       SectionNamesIndex;
+    ELF_SECTION  SectionNames;
+    ELF_SECTION  Symbols;
+    ELF_SECTION  SymbolNames;
+    UINT32       SymbolsIndex  = 0;
+    UINT32       DynamicsIndex = 0;
+
+    if (Header[4] != ELF_CLASS_64 || Header[5] != ELF_DATA_LITTLE)
+    {
+        return FALSE;
+    }
+
+    Elf->Type           = ElfRead16(Header + 16);
+    ProgramHeaders      = ElfRead64(Header + 32);
+    SectionHeaders      = ElfRead64(Header + 40);
+    ProgramHeadersCount = ElfRead16(Header + 56);
+    Elf->SectionsCount  = ElfRead16(Header + 60);
+    SectionNamesIndex   = ElfRead16(Header + 62);
+
+    //
+    // The addresses are relative to the first loaded segment (the image base
+    // of the kernel or the executable), the relocatable objects (the kernel
+    // modules) are relative to their sections
+    //
+    if (Elf->Type != ELF_TYPE_RELOCATE && ElfRead16(Header + 54) == ELF_PROGRAM_HEADER_SIZE &&
+        ElfHasRange(Elf->MappingSize, ProgramHeaders, (UINT64)ProgramHeadersCount * ELF_PROGRAM_HEADER_SIZE))
+    {
+        for (UINT16 i = 0; i < ProgramHeadersCount; i++)
+        {
+            const BYTE * ProgramHeader = Elf->Mapping + ProgramHeaders + (SIZE_T)i * ELF_PROGRAM_HEADER_SIZE;
+
+            if (ElfRead32(ProgramHeader) == ELF_PT_LOAD)
+            {
+                Elf->ImageBase = ElfRead64(ProgramHeader + 16);
+                break;
+            }
+        }
+    }
+
+    if (SectionHeaders == 0 || ElfRead16(Header + 58) != ELF_SECTION_HEADER_SIZE ||
+        !ElfHasRange(Elf->MappingSize, SectionHeaders, ELF_SECTION_HEADER_SIZE))
+    {
+        return FALSE;
+    }
+
+    //
+    // The number of the sections and the index of the names of the sections
+    // are in the first section if they are too large
+    //
+    if (Elf->SectionsCount == 0)
+    {
+        Elf->SectionsCount = (UINT32)ElfRead64(Elf->Mapping + SectionHeaders + 32);
+    }
+
+    if (SectionNamesIndex == ELF_SHN_XINDEX)
+    {
+        SectionNamesIndex = ElfRead32(Elf->Mapping + SectionHeaders + 40);
+    }
+
+    if (!ElfHasRange(Elf->MappingSize, SectionHeaders, (UINT64)Elf->SectionsCount * ELF_SECTION_HEADER_SIZE))
+    {
+        return FALSE;
+    }
+
+    Elf->SectionHeaders = Elf->Mapping + SectionHeaders;
+
+    if (!ElfGetSection(Elf, SectionNamesIndex, &SectionNames))
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 1; i < Elf->SectionsCount; i++)
+    {
+        const BYTE * SectionHeader = Elf->SectionHeaders + (SIZE_T)i * ELF_SECTION_HEADER_SIZE;
+        const CHAR * Name          = ElfGetSectionString(&SectionNames, ElfRead32(SectionHeader));
+        UINT32       Type          = ElfRead32(SectionHeader + 4);
+        PELF_SECTION Section       = NULL;
+
+        if (Type == ELF_SHT_SYMTAB)
+        {
+            SymbolsIndex = i;
+        }
+        else if (Type == ELF_SHT_DYNSYM)
+        {
+            DynamicsIndex = i;
+        }
+
+        if (Name == NULL || strncmp(Name, ".debug_", 7) != 0)
+        {
+            continue;
+        }
+
+        if (strcmp(Name, ".debug_info") == 0)
+        {
+            Section = &Elf->DebugInfo;
+        }
+        else if (strcmp(Name, ".debug_abbrev") == 0)
+        {
+            Section = &Elf->DebugAbbrev;
+        }
+        else if (strcmp(Name, ".debug_str") == 0)
+        {
+            Section = &Elf->DebugStr;
+        }
+        else if (strcmp(Name, ".debug_line_str") == 0)
+        {
+            Section = &Elf->DebugLineStr;
+        }
+        else if (strcmp(Name, ".debug_str_offsets") == 0)
+        {
+            Section = &Elf->DebugStrOffsets;
+        }
+        else if (strcmp(Name, ".debug_addr") == 0)
+        {
+            Section = &Elf->DebugAddr;
+        }
+        else if (strcmp(Name, ".debug_line") == 0)
+        {
+            Section = &Elf->DebugLine;
+        }
+        else if (strcmp(Name, ".debug_aranges") == 0)
+        {
+            Section = &Elf->DebugAranges;
+        }
+
+        if (Section != NULL)
+        {
+            ElfGetSection(Elf, i, Section);
+        }
+    }
+
+    //
+    // The full symbol table is preferred to the dynamic symbols
+    //
+    if (SymbolsIndex == 0)
+    {
+        SymbolsIndex = DynamicsIndex;
+    }
+
+    if (SymbolsIndex != 0 && ElfGetSection(Elf, SymbolsIndex, &Symbols) &&
+        ElfGetSection(Elf, ElfRead32(Elf->SectionHeaders + (SIZE_T)SymbolsIndex * ELF_SECTION_HEADER_SIZE + 40), &SymbolNames))
+    {
+        Elf->Symbols         = Symbols.Data;
+        Elf->SymbolsCount    = (UINT32)(Symbols.Size / ELF_SYMBOL_SIZE);
+        Elf->SymbolNames     = (const CHAR *)SymbolNames.Data;
+        Elf->SymbolNamesSize = SymbolNames.Size;
+    }
+
+    if (Elf->DebugAbbrev.Data == NULL)
+    {
+        Elf->DebugInfo.Data = NULL;
+        Elf->DebugInfo.Size = 0;
+    }
+
+    if (Elf->Type == ELF_TYPE_RELOCATE)
+    {
+        ElfApplyRelocations(Elf);
+    }
+
+    //
+    // A file without symbols and debug information is not useful
+    //
+    return Elf->SymbolsCount != 0 || Elf->DebugInfo.Data != NULL;
+}
+
+/**
+ * @brief Open an ELF file
+ *
+ * @param FilePath
+ * @return PELF_FILE NULL if the file is not a valid ELF file
+ */
+PELF_FILE
+ElfOpen(const CHAR * FilePath)
+{
+    PELF_FILE   Elf;
+    struct stat FileStat;
+    int         Fd;
+    void *      Mapping;
+
+    Fd = open(FilePath, O_RDONLY | O_CLOEXEC);
+
+    if (Fd < 0)
+    {
+        return NULL;
+    }
+
+    if (fstat(Fd, &FileStat) != 0 || FileStat.st_size < ELF_HEADER_SIZE)
+    {
+        close(Fd);
+        return NULL;
+    }
+
+    //
+    // The mapping is private and writable, as the relocations of the debug
+    // sections of the relocatable objects are applied to it
+    //
+    Mapping = mmap(NULL, (SIZE_T)FileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, Fd, 0);
+    close(Fd);
+
+    if (Mapping == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    if (memcmp(Mapping, ELF_MAGIC, ELF_MAGIC_SIZE) != 0)
+    {
+        munmap(Mapping, (SIZE_T)FileStat.st_size);
+        return NULL;
+    }
+
+    Elf = calloc(1, sizeof(ELF_FILE));
+
+    if (Elf == NULL)
+    {
+        munmap(Mapping, (SIZE_T)FileStat.st_size);
+        return NULL;
+    }
+
+    Elf->Mapping     = Mapping;
+    Elf->MappingSize = (SIZE_T)FileStat.st_size;
+
+    if (!ElfReadHeaders(Elf))
+    {
+        ElfClose(Elf);
+        return NULL;
+    }
+
+    return Elf;
+}
+
+/**
+ * @brief Close an ELF file
+ *
+ * @param Elf
+ * @return VOID
+ */
+VOID
+ElfClose(PELF_FILE Elf)
+{
+    if (Elf == NULL)
+    {
+        return;
+    }
+
+    for (UINT32 i = 0; i < Elf->UnitsCount; i++)
+    {
+        free(Elf->Units[i].Abbrevs);
+        free(Elf->Units[i].Attributes);
+    }
+
+    free(Elf->Units);
+    free(Elf->Names);
+    free(Elf->NameHashHeads);
+    free(Elf->Ranges);
+    free(Elf->SymbolHashHeads);
+    free(Elf->SymbolHashNext);
+
+    if (Elf->Mapping != NULL)
+    {
+        munmap(Elf->Mapping, Elf->MappingSize);
+    }
+
+    free(Elf);
+}
+
+/**
+ * @brief Get a symbol of the symbol table
+ * @details Only the functions, the objects and the labels (without type)
+ * that are defined in a section are used
+ *
+ * @param Elf
+ * @param Index
+ * @param Rva
+ * @param Size
+ * @param Binding
+ * @return const CHAR * NULL if the symbol is not used
+ */
+static const CHAR *
+ElfGetSymbol(PELF_FILE Elf, UINT32 Index, UINT64 * Rva, UINT64 * Size, BYTE * Binding)
+{
+    const BYTE * Symbol = Elf->Symbols + (SIZE_T)Index * ELF_SYMBOL_SIZE;
+    UINT32       Name   = ElfRead32(Symbol);
+    BYTE         Type   = Symbol[4] & 0xf;
+    UINT16       Section;
+
+    Section = ElfRead16(Symbol + 6);
+
+    if ((Type != ELF_STT_NOTYPE && Type != ELF_STT_OBJECT && Type != ELF_STT_FUNC) ||
+        Section == ELF_SHN_UNDEF || Section == ELF_SHN_ABS || Name == 0 || Name >= Elf->SymbolNamesSize ||
+        memchr(Elf->SymbolNames + Name, '\0', Elf->SymbolNamesSize - Name) == NULL)
+    {
+        return NULL;
+    }
+
+    *Rva     = ElfRead64(Symbol + 8) - Elf->ImageBase;
+    *Size    = ElfRead64(Symbol + 16);
+    *Binding = Symbol[4] >> 4;
+
+    return Elf->SymbolNames + Name;
+}
+
+/**
+ * @brief Hash the names of the symbols
+ * @details The symbols are hashed when they are first looked up
+ *
+ * @param Elf
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfLoadSymbols(PELF_FILE Elf)
+{
+    UINT32 BucketsCount = 16;
+
+    if (Elf->IsSymbolsLoaded)
+    {
+        return Elf->SymbolHashHeads != NULL;
+    }
+
+    Elf->IsSymbolsLoaded = TRUE;
+
+    if (Elf->SymbolsCount == 0)
+    {
+        return FALSE;
+    }
+
+    while (BucketsCount < Elf->SymbolsCount && BucketsCount < 0x40000000)
+    {
+        BucketsCount <<= 1;
+    }
+
+    Elf->SymbolHashHeads = malloc(BucketsCount * sizeof(UINT32));
+    Elf->SymbolHashNext  = malloc(Elf->SymbolsCount * sizeof(UINT32));
+
+    if (Elf->SymbolHashHeads == NULL || Elf->SymbolHashNext == NULL)
+    {
+        free(Elf->SymbolHashHeads);
+        free(Elf->SymbolHashNext);
+
+        Elf->SymbolHashHeads = NULL;
+        Elf->SymbolHashNext  = NULL;
+
+        return FALSE;
+    }
+
+    memset(Elf->SymbolHashHeads, 0xff, BucketsCount * sizeof(UINT32));
+
+    Elf->SymbolHashBucketsCount = BucketsCount;
+
+    //
+    // The chains are in the order of the symbol table
+    //
+    for (UINT32 i = Elf->SymbolsCount; i-- > 0;)
+    {
+        UINT64       Rva;
+        UINT64       Size;
+        BYTE         Binding;
+        const CHAR * Name = ElfGetSymbol(Elf, i, &Rva, &Size, &Binding);
+        UINT32       Bucket;
+
+        if (Name == NULL)
+        {
+            continue;
+        }
+
+        Bucket = ElfHashName(Name) & (BucketsCount - 1);
+
+        Elf->SymbolHashNext[i]       = Elf->SymbolHashHeads[Bucket];
+        Elf->SymbolHashHeads[Bucket] = i;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Enumerate the symbols of the file
+ *
+ * @param Elf
+ * @param Callback
+ * @param Context
+ * @return VOID
+ */
+VOID
+ElfEnumerateSymbols(PELF_FILE Elf, ELF_SYMBOL_CALLBACK Callback, PVOID Context)
+{
+    for (UINT32 i = 0; i < Elf->SymbolsCount; i++)
+    {
+        UINT64       Rva;
+        UINT64       Size;
+        BYTE         Binding;
+        const CHAR * Name = ElfGetSymbol(Elf, i, &Rva, &Size, &Binding);
+
+        if (Name != NULL && !Callback(Name, Rva, Size, Context))
+        {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Read the value of an attribute
+ *
+ * @param Elf
+ * @param Reader
+ * @param Unit
+ * @param Form
+ * @param ImplicitConst
+ * @param Value
+ * @return BOOLEAN FALSE if the form is not known (so the rest of the
+ * attributes cannot be read)
+ */
+static BOOLEAN
+ElfReadForm(PELF_FILE        Elf,
+            PELF_READER      Reader,
+            PELF_DWARF_UNIT  Unit,
+            UINT16           Form,
+            INT64            ImplicitConst,
+            PELF_DWARF_VALUE Value)
+{
+    memset(Value, 0, sizeof(ELF_DWARF_VALUE));
+
+    //
+    // The form of the indirect attributes is in the DIE
+    //
+    while (Form == ELF_DW_FORM_INDIRECT && Reader->IsValid)
+    {
+        Form = (UINT16)ElfReadUleb(Reader);
+    }
+
+    switch (Form)
+    {
+    case ELF_DW_FORM_ADDR:
+        Value->Constant  = ElfReadFixed(Reader, Unit->AddressSize);
+        Value->IsAddress = TRUE;
+        break;
+
+    case ELF_DW_FORM_DATA1:
+    case ELF_DW_FORM_FLAG:
+        Value->Constant   = ElfReadFixed(Reader, 1);
+        Value->IsConstant = TRUE;
+        break;
+
+    case ELF_DW_FORM_DATA2:
+        Value->Constant   = ElfReadFixed(Reader, 2);
+        Value->IsConstant = TRUE;
+        break;
+
+    case ELF_DW_FORM_DATA4:
+        Value->Constant   = ElfReadFixed(Reader, 4);
+        Value->IsConstant = TRUE;
+        break;
+
+    case ELF_DW_FORM_DATA8:
+        Value->Constant   = ElfReadFixed(Reader, 8);
+        Value->IsConstant = TRUE;
+        break;
+
+    case ELF_DW_FORM_SDATA:
+        Value->Constant   = (UINT64)ElfReadSleb(Reader);
+        Value->IsConstant = TRUE;
+        break;
+
+    case ELF_DW_FORM_UDATA:
+        Value->Constant   = ElfReadUleb(Reader);
+        Value->IsConstant = TRUE;
+        break;
+
+    case ELF_DW_FORM_IMPLICIT_CONST:
+        Value->Constant   = (UINT64)ImplicitConst;
+        Value->IsConstant = TRUE;
+        break;
+
+    case ELF_DW_FORM_FLAG_PRESENT:
+        Value->Constant   = 1;
+        Value->IsConstant = TRUE;
+        break;
+
+    case ELF_DW_FORM_REF1:
+    case ELF_DW_FORM_REF2:
+    case ELF_DW_FORM_REF4:
+    case ELF_DW_FORM_REF8:
+        Value->Constant    = Unit->Offset + ElfReadFixed(Reader, Form == ELF_DW_FORM_REF1 ? 1 : Form == ELF_DW_FORM_REF2 ? 2
+                                                                                           : Form == ELF_DW_FORM_REF4   ? 4
+                                                                                                                        : 8);
+        Value->IsReference = TRUE;
+        break;
+
+    case ELF_DW_FORM_REF_UDATA:
+        Value->Constant    = Unit->Offset + ElfReadUleb(Reader);
+        Value->IsReference = TRUE;
+        break;
+
+    case ELF_DW_FORM_REF_ADDR:
+        Value->Constant    = ElfReadFixed(Reader, Unit->Version == 2 ? Unit->AddressSize : Unit->OffsetSize);
+        Value->IsReference = TRUE;
+        break;
+
+    case ELF_DW_FORM_REF_SIG8:
+    case ELF_DW_FORM_REF_SUP8:
+        ElfSkip(Reader, 8);
+        break;
+
+    case ELF_DW_FORM_REF_SUP4:
+        ElfSkip(Reader, 4);
+        break;
+
+    case ELF_DW_FORM_DATA16:
+        ElfSkip(Reader, 16);
+        break;
+
+    case ELF_DW_FORM_STRING:
+        Value->String = ElfReadString(Reader);
+        break;
+
+    case ELF_DW_FORM_STRP:
+        Value->String = ElfGetSectionString(&Elf->DebugStr, ElfReadFixed(Reader, Unit->OffsetSize));
+        break;
+
+    case ELF_DW_FORM_LINE_STRP:
+        Value->String = ElfGetSectionString(&Elf->DebugLineStr, ElfReadFixed(Reader, Unit->OffsetSize));
+        break;
+
+    case ELF_DW_FORM_STRP_SUP:
+    case ELF_DW_FORM_SEC_OFFSET:
+        Value->Constant = ElfReadFixed(Reader, Unit->OffsetSize);
+        break;
+
+    case ELF_DW_FORM_STRX:
+    case ELF_DW_FORM_STRX1:
+    case ELF_DW_FORM_STRX2:
+    case ELF_DW_FORM_STRX3:
+    case ELF_DW_FORM_STRX4:
+        Value->Constant      = Form == ELF_DW_FORM_STRX ? ElfReadUleb(Reader) : ElfReadFixed(Reader, Form - ELF_DW_FORM_STRX1 + 1);
+        Value->IsStringIndex = TRUE;
+        break;
+
+    case ELF_DW_FORM_ADDRX:
+    case ELF_DW_FORM_ADDRX1:
+    case ELF_DW_FORM_ADDRX2:
+    case ELF_DW_FORM_ADDRX3:
+    case ELF_DW_FORM_ADDRX4:
+        Value->Constant       = Form == ELF_DW_FORM_ADDRX ? ElfReadUleb(Reader) : ElfReadFixed(Reader, Form - ELF_DW_FORM_ADDRX1 + 1);
+        Value->IsAddressIndex = TRUE;
+        break;
+
+    case ELF_DW_FORM_LOCLISTX:
+    case ELF_DW_FORM_RNGLISTX:
+        Value->Constant = ElfReadUleb(Reader);
+        break;
+
+    case ELF_DW_FORM_EXPRLOC:
+    case ELF_DW_FORM_BLOCK:
+    case ELF_DW_FORM_BLOCK1:
+    case ELF_DW_FORM_BLOCK2:
+    case ELF_DW_FORM_BLOCK4:
+        Value->BlockSize = Form == ELF_DW_FORM_BLOCK1 ? ElfReadFixed(Reader, 1) : Form == ELF_DW_FORM_BLOCK2 ? ElfReadFixed(Reader, 2)
+                                                                              : Form == ELF_DW_FORM_BLOCK4   ? ElfReadFixed(Reader, 4)
+                                                                                                             : ElfReadUleb(Reader);
+
+        if (ElfReaderHas(Reader, Value->BlockSize))
+        {
+            Value->Block = Reader->Data + Reader->Offset;
+            Reader->Offset += Value->BlockSize;
+        }
+        break;
+
+    default:
+        return FALSE;
+    }
+
+    return Reader->IsValid;
+}
+
+/**
+ * @brief Get a string of the string offsets table of a unit (DW_FORM_strx)
+ *
+ * @param Elf
+ * @param Unit
+ * @param Index
+ * @return const CHAR *
+ */
+static const CHAR *
+ElfGetIndexedString(PELF_FILE Elf, PELF_DWARF_UNIT Unit, UINT64 Index)
+{
+    ELF_READER Reader;
+    UINT64     Offset;
+
+    ElfInitializeReader(&Reader, Elf->DebugStrOffsets.Data, Elf->DebugStrOffsets.Size, 0);
+    ElfSkip(&Reader, Unit->StrOffsetsBase);
+    ElfSkip(&Reader, Index * Unit->OffsetSize);
+
+    Offset = ElfReadFixed(&Reader, Unit->OffsetSize);
+
+    return Reader.IsValid ? ElfGetSectionString(&Elf->DebugStr, Offset) : NULL;
+}
+
+/**
+ * @brief Get an address of the address table of a unit (DW_FORM_addrx)
+ *
+ * @param Elf
+ * @param Unit
+ * @param Index
+ * @param Address
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfGetIndexedAddress(PELF_FILE Elf, PELF_DWARF_UNIT Unit, UINT64 Index, UINT64 * Address)
+{
+    ELF_READER Reader;
+
+    ElfInitializeReader(&Reader, Elf->DebugAddr.Data, Elf->DebugAddr.Size, 0);
+    ElfSkip(&Reader, Unit->AddrBase);
+    ElfSkip(&Reader, Index * Unit->AddressSize);
+
+    *Address = ElfReadFixed(&Reader, Unit->AddressSize);
+
+    return Reader.IsValid;
+}
+
+/**
+ * @brief Read the headers of the units of the debug information
+ * @details Only the headers are read (by their lengths), the DIEs of the
+ * units are not read
+ *
+ * @param Elf
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfLoadUnits(PELF_FILE Elf)
+{
+    ELF_READER Reader;
+    UINT32     Capacity = 0;
+
+    if (Elf->IsUnitsLoaded)
+    {
+        return Elf->UnitsCount != 0;
+    }
+
+    Elf->IsUnitsLoaded = TRUE;
+
+    ElfInitializeReader(&Reader, Elf->DebugInfo.Data, Elf->DebugInfo.Size, 0);
+
+    while (Reader.IsValid && Reader.Offset < Reader.Size)
+    {
+        ELF_DWARF_UNIT Unit = {0};
+        UINT64         Length;
+
+        Unit.Offset     = Reader.Offset;
+        Unit.OffsetSize = 4;
+
+        Length = ElfReadFixed(&Reader, 4);
+
+        if (Length == 0xffffffff)
+        {
+            Unit.OffsetSize = 8;
+            Length          = ElfReadFixed(&Reader, 8);
+        }
+
+        if (!ElfReaderHas(&Reader, Length))
+        {
+            break;
+        }
+
+        Unit.End     = Reader.Offset + Length;
+        Unit.Version = (UINT16)ElfReadFixed(&Reader, 2);
+
+        if (Unit.Version >= 5)
+        {
+            Unit.UnitType     = (BYTE)ElfReadFixed(&Reader, 1);
+            Unit.AddressSize  = (BYTE)ElfReadFixed(&Reader, 1);
+            Unit.AbbrevOffset = ElfReadFixed(&Reader, Unit.OffsetSize);
+
+            if (Unit.UnitType == ELF_DW_UT_SKELETON || Unit.UnitType == ELF_DW_UT_SPLIT_COMPILE)
+            {
+                ElfSkip(&Reader, 8);
+            }
+            else if (Unit.UnitType == ELF_DW_UT_TYPE || Unit.UnitType == ELF_DW_UT_SPLIT_TYPE)
+            {
+                ElfSkip(&Reader, 8 + Unit.OffsetSize);
+            }
+        }
+        else
+        {
+            Unit.UnitType     = ELF_DW_UT_COMPILE;
+            Unit.AbbrevOffset = ElfReadFixed(&Reader, Unit.OffsetSize);
+            Unit.AddressSize  = (BYTE)ElfReadFixed(&Reader, 1);
+        }
+
+        Unit.DieOffset = Reader.Offset;
+
+        if (Reader.IsValid && Unit.Version >= 2 && Unit.Version <= 5 && Unit.DieOffset <= Unit.End &&
+            (Unit.AddressSize == 4 || Unit.AddressSize == 8))
+        {
+            if (Elf->UnitsCount == Capacity)
+            {
+                UINT32          NewCapacity = Capacity == 0 ? 64 : Capacity * 2;
+                PELF_DWARF_UNIT Units       = realloc(Elf->Units, NewCapacity * sizeof(ELF_DWARF_UNIT));
+
+                if (Units == NULL)
+                {
+                    break;
+                }
+
+                Elf->Units = Units;
+                Capacity   = NewCapacity;
+            }
+
+            Elf->Units[Elf->UnitsCount++] = Unit;
+        }
+
+        Reader.IsValid = TRUE;
+        Reader.Offset  = Unit.End;
+    }
+
+    return Elf->UnitsCount != 0;
+}
+
+/**
+ * @brief Find the unit of a DIE
+ *
+ * @param Elf
+ * @param Offset an offset in the unit (in .debug_info)
+ * @return PELF_DWARF_UNIT
+ */
+static PELF_DWARF_UNIT
+ElfFindUnit(PELF_FILE Elf, UINT64 Offset)
+{
+    UINT32 Low  = 0;
+    UINT32 High = Elf->UnitsCount;
+
+    while (Low < High)
+    {
+        UINT32 Middle = Low + (High - Low) / 2;
+
+        if (Elf->Units[Middle].End <= Offset)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    if (Low == Elf->UnitsCount || Offset < Elf->Units[Low].Offset)
+    {
+        return NULL;
+    }
+
+    return &Elf->Units[Low];
+}
+
+/**
+ * @brief Read the abbreviations of a unit
+ * @details The abbreviations are read when the DIEs of the unit are first
+ * read, and they're indexed by their codes
+ *
+ * @param Elf
+ * @param Unit
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfLoadAbbrevs(PELF_FILE Elf, PELF_DWARF_UNIT Unit)
+{
+    ELF_READER Reader;
+    UINT64     MaxCode         = 0;
+    UINT32     AttributesCount = 0;
+
+    if (Unit->IsAbbrevsLoaded)
+    {
+        return Unit->Abbrevs != NULL;
+    }
+
+    Unit->IsAbbrevsLoaded = TRUE;
+
+    //
+    // Count the abbreviations and their attributes
+    //
+    ElfInitializeReader(&Reader, Elf->DebugAbbrev.Data, Elf->DebugAbbrev.Size, Unit->AbbrevOffset);
+
+    for (;;)
+    {
+        UINT64 Code = ElfReadUleb(&Reader);
+
+        if (Code == 0 || !Reader.IsValid)
+        {
+            break;
+        }
+
+        if (Code > MaxCode)
+        {
+            MaxCode = Code;
+        }
+
+        ElfReadUleb(&Reader);
+        ElfSkip(&Reader, 1);
+
+        for (;;)
+        {
+            UINT64 Name = ElfReadUleb(&Reader);
+            UINT64 Form = ElfReadUleb(&Reader);
+
+            if ((Name == 0 && Form == 0) || !Reader.IsValid)
+            {
+                break;
+            }
+
+            if (Form == ELF_DW_FORM_IMPLICIT_CONST)
+            {
+                ElfReadSleb(&Reader);
+            }
+
+            AttributesCount++;
+        }
+    }
+
+    if (!Reader.IsValid || MaxCode == 0 || MaxCode >= ELF_DWARF_MAX_ABBREV_CODE)
+    {
+        return FALSE;
+    }
+
+    Unit->Abbrevs    = calloc(MaxCode + 1, sizeof(ELF_DWARF_ABBREV));
+    Unit->Attributes = calloc(AttributesCount + 1, sizeof(ELF_DWARF_ATTRIBUTE));
+
+    if (Unit->Abbrevs == NULL || Unit->Attributes == NULL)
+    {
+        free(Unit->Abbrevs);
+        free(Unit->Attributes);
+
+        Unit->Abbrevs    = NULL;
+        Unit->Attributes = NULL;
+
+        return FALSE;
+    }
+
+    Unit->AbbrevsCount = (UINT32)MaxCode + 1;
+    AttributesCount    = 0;
+
+    //
+    // Read them
+    //
+    ElfInitializeReader(&Reader, Elf->DebugAbbrev.Data, Elf->DebugAbbrev.Size, Unit->AbbrevOffset);
+
+    for (;;)
+    {
+        UINT64            Code = ElfReadUleb(&Reader);
+        PELF_DWARF_ABBREV Abbrev;
+
+        if (Code == 0 || !Reader.IsValid)
+        {
+            break;
+        }
+
+        Abbrev              = &Unit->Abbrevs[Code];
+        Abbrev->Tag         = (UINT16)ElfReadUleb(&Reader);
+        Abbrev->HasChildren = ElfReadFixed(&Reader, 1) != 0;
+        Abbrev->Attributes  = &Unit->Attributes[AttributesCount];
+
+        Abbrev->AttributesCount = 0;
+
+        for (;;)
+        {
+            PELF_DWARF_ATTRIBUTE Attribute = &Unit->Attributes[AttributesCount];
+            UINT64               Name      = ElfReadUleb(&Reader);
+            UINT64               Form      = ElfReadUleb(&Reader);
+
+            if ((Name == 0 && Form == 0) || !Reader.IsValid)
+            {
+                break;
+            }
+
+            Attribute->Name = (UINT16)Name;
+            Attribute->Form = (UINT16)Form;
+
+            if (Form == ELF_DW_FORM_IMPLICIT_CONST)
+            {
+                Attribute->ImplicitConst = ElfReadSleb(&Reader);
+            }
+
+            Abbrev->AttributesCount++;
+            AttributesCount++;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Read a DIE
+ * @details The DIE of the unit is read first, so the bases of the string
+ * offsets and the addresses of the unit are known
+ *
+ * @param Elf
+ * @param Unit
+ * @param Offset
+ * @param Die the tag is zero for the null entries (the end of the children)
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfReadDie(PELF_FILE Elf, PELF_DWARF_UNIT Unit, UINT64 Offset, PELF_DWARF_DIE Die)
+{
+    ELF_READER        Reader;
+    PELF_DWARF_ABBREV Abbrev;
+    UINT64            Code;
+    UINT64            NameIndex      = 0;
+    UINT64            AddressIndex   = 0;
+    BOOLEAN           IsNameIndex    = FALSE;
+    BOOLEAN           IsAddressIndex = FALSE;
+
+    memset(Die, 0, sizeof(ELF_DWARF_DIE));
+
+    if (!ElfLoadAbbrevs(Elf, Unit))
+    {
+        return FALSE;
+    }
+
+    if (!Unit->IsRead && Offset != Unit->DieOffset)
+    {
+        ELF_DWARF_DIE UnitDie;
+
+        if (!ElfReadDie(Elf, Unit, Unit->DieOffset, &UnitDie))
+        {
+            return FALSE;
+        }
+    }
+
+    ElfInitializeReader(&Reader, Elf->DebugInfo.Data, Unit->End, Offset);
+
+    Die->Offset = Offset;
+    Die->Unit   = Unit;
+
+    Code = ElfReadUleb(&Reader);
+
+    if (!Reader.IsValid)
+    {
+        return FALSE;
+    }
+
+    if (Code == 0)
+    {
+        Die->Next = Reader.Offset;
+        return TRUE;
+    }
+
+    if (Code >= Unit->AbbrevsCount || Unit->Abbrevs[Code].Tag == 0)
+    {
+        return FALSE;
+    }
+
+    Abbrev = &Unit->Abbrevs[Code];
+
+    Die->Tag         = Abbrev->Tag;
+    Die->HasChildren = Abbrev->HasChildren;
+
+    for (UINT32 i = 0; i < Abbrev->AttributesCount; i++)
+    {
+        PELF_DWARF_ATTRIBUTE Attribute = &Abbrev->Attributes[i];
+        ELF_DWARF_VALUE      Value;
+
+        if (!ElfReadForm(Elf, &Reader, Unit, Attribute->Form, Attribute->ImplicitConst, &Value))
+        {
+            return FALSE;
+        }
+
+        switch (Attribute->Name)
+        {
+        case ELF_DW_AT_NAME:
+            Die->Name   = Value.String;
+            NameIndex   = Value.Constant;
+            IsNameIndex = Value.IsStringIndex;
+            break;
+
+        case ELF_DW_AT_TYPE:
+            Die->Type    = Value.Constant;
+            Die->HasType = Value.IsReference;
+            break;
+
+        case ELF_DW_AT_SIBLING:
+            Die->Sibling    = Value.Constant;
+            Die->HasSibling = Value.IsReference;
+            break;
+
+        case ELF_DW_AT_BYTE_SIZE:
+            Die->ByteSize    = Value.Constant;
+            Die->HasByteSize = Value.IsConstant;
+            break;
+
+        case ELF_DW_AT_BIT_SIZE:
+            Die->BitSize    = Value.Constant;
+            Die->HasBitSize = Value.IsConstant;
+            break;
+
+        case ELF_DW_AT_BIT_OFFSET:
+            Die->BitOffset    = Value.Constant;
+            Die->HasBitOffset = Value.IsConstant;
+            break;
+
+        case ELF_DW_AT_DATA_BIT_OFFSET:
+            Die->DataBitOffset    = Value.Constant;
+            Die->HasDataBitOffset = Value.IsConstant;
+            break;
+
+        case ELF_DW_AT_DATA_MEMBER_LOCATION:
+            if (Value.IsConstant)
+            {
+                Die->MemberLocation    = Value.Constant;
+                Die->HasMemberLocation = TRUE;
+            }
+            else if (Value.Block != NULL && Value.BlockSize != 0 && Value.Block[0] == ELF_DW_OP_PLUS_UCONST)
+            {
+                ELF_READER Expression;
+
+                //
+                // The location of the members of DWARF 2
+                //
+                ElfInitializeReader(&Expression, Value.Block, Value.BlockSize, 1);
+
+                Die->MemberLocation    = ElfReadUleb(&Expression);
+                Die->HasMemberLocation = Expression.IsValid;
+            }
+            break;
+
+        case ELF_DW_AT_UPPER_BOUND:
+            Die->UpperBound    = (INT64)Value.Constant;
+            Die->HasUpperBound = Value.IsConstant;
+            break;
+
+        case ELF_DW_AT_COUNT:
+            Die->Count    = Value.Constant;
+            Die->HasCount = Value.IsConstant;
+            break;
+
+        case ELF_DW_AT_LOW_PC:
+            Die->Address    = Value.Constant;
+            Die->HasAddress = Value.IsAddress;
+            AddressIndex    = Value.Constant;
+            IsAddressIndex  = Value.IsAddressIndex;
+            break;
+
+        case ELF_DW_AT_LOCATION:
+            if (Value.Block != NULL && Value.BlockSize == 1 + (UINT64)Unit->AddressSize && Value.Block[0] == ELF_DW_OP_ADDR)
+            {
+                ELF_READER Expression;
+
+                //
+                // Only the variables at fixed addresses
+                //
+                ElfInitializeReader(&Expression, Value.Block, Value.BlockSize, 1);
+
+                Die->Address    = ElfReadFixed(&Expression, Unit->AddressSize);
+                Die->HasAddress = TRUE;
+            }
+            else if (Value.Block != NULL && Value.BlockSize > 1 && Value.Block[0] == ELF_DW_OP_ADDRX)
+            {
+                ELF_READER Expression;
+
+                ElfInitializeReader(&Expression, Value.Block, Value.BlockSize, 1);
+
+                AddressIndex   = ElfReadUleb(&Expression);
+                IsAddressIndex = Expression.IsValid && Expression.Offset == Value.BlockSize;
+            }
+            break;
+
+        case ELF_DW_AT_DECLARATION:
+            Die->IsDeclaration = Value.Constant != 0;
+            break;
+
+        case ELF_DW_AT_STMT_LIST:
+            Die->StmtList    = Value.Constant;
+            Die->HasStmtList = TRUE;
+            break;
+
+        case ELF_DW_AT_STR_OFFSETS_BASE:
+            Die->StrOffsetsBase    = Value.Constant;
+            Die->HasStrOffsetsBase = TRUE;
+            break;
+
+        case ELF_DW_AT_ADDR_BASE:
+            Die->AddrBase    = Value.Constant;
+            Die->HasAddrBase = TRUE;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    Die->Next = Reader.Offset;
+
+    if (Offset == Unit->DieOffset && !Unit->IsRead)
+    {
+        //
+        // The bases of the unit (the headers of the contributions of
+        // DWARF 5 are 8 bytes)
+        //
+        Unit->StrOffsetsBase = Die->HasStrOffsetsBase ? Die->StrOffsetsBase : (Unit->Version >= 5 ? 8 : 0);
+        Unit->AddrBase       = Die->HasAddrBase ? Die->AddrBase : (Unit->Version >= 5 ? 8 : 0);
+        Unit->StmtList       = Die->StmtList;
+        Unit->HasStmtList    = Die->HasStmtList;
+        Unit->IsRead         = TRUE;
+    }
+
+    if (IsNameIndex)
+    {
+        Die->Name = ElfGetIndexedString(Elf, Unit, NameIndex);
+    }
+
+    if (IsAddressIndex)
+    {
+        Die->HasAddress = ElfGetIndexedAddress(Elf, Unit, AddressIndex, &Die->Address);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Read a DIE by its offset in .debug_info
+ *
+ * @param Elf
+ * @param Offset
+ * @param Die
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfReadDieAt(PELF_FILE Elf, UINT64 Offset, PELF_DWARF_DIE Die)
+{
+    PELF_DWARF_UNIT Unit = ElfFindUnit(Elf, Offset);
+
+    if (Unit == NULL || Offset < Unit->DieOffset)
+    {
+        return FALSE;
+    }
+
+    return ElfReadDie(Elf, Unit, Offset, Die) && Die->Tag != 0;
+}
+
+/**
+ * @brief Get the offset of the next sibling of a DIE
+ * @details The children of the DIE are skipped
+ *
+ * @param Elf
+ * @param Die
+ * @param Offset
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfGetSiblingOffset(PELF_FILE Elf, PELF_DWARF_DIE Die, UINT64 * Offset)
+{
+    ELF_DWARF_DIE Child;
+    UINT64        Depth = 1;
+
+    if (!Die->HasChildren)
+    {
+        *Offset = Die->Next;
+        return TRUE;
+    }
+
+    if (Die->HasSibling && Die->Sibling > Die->Offset && Die->Sibling <= Die->Unit->End)
+    {
+        *Offset = Die->Sibling;
+        return TRUE;
+    }
+
+    *Offset = Die->Next;
+
+    while (Depth != 0)
+    {
+        if (*Offset >= Die->Unit->End || !ElfReadDie(Elf, Die->Unit, *Offset, &Child))
+        {
+            return FALSE;
+        }
+
+        if (Child.Tag == 0)
+        {
+            Depth--;
+        }
+        else if (Child.HasChildren)
+        {
+            if (Child.HasSibling && Child.Sibling > Child.Offset && Child.Sibling <= Die->Unit->End)
+            {
+                *Offset = Child.Sibling;
+                continue;
+            }
+
+            Depth++;
+        }
+
+        *Offset = Child.Next;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Read the first child of a DIE
+ *
+ * @param Elf
+ * @param Parent
+ * @param Child
+ * @return BOOLEAN FALSE if the DIE has no children
+ */
+static BOOLEAN
+ElfGetFirstChild(PELF_FILE Elf, PELF_DWARF_DIE Parent, PELF_DWARF_DIE Child)
+{
+    if (!Parent->HasChildren || Parent->Next >= Parent->Unit->End)
+    {
+        return FALSE;
+    }
+
+    return ElfReadDie(Elf, Parent->Unit, Parent->Next, Child) && Child->Tag != 0;
+}
+
+/**
+ * @brief Read the next sibling of a DIE
+ *
+ * @param Elf
+ * @param Die the DIE that is replaced by its sibling
+ * @return BOOLEAN FALSE if it's the last child of its parent
+ */
+static BOOLEAN
+ElfGetNextSibling(PELF_FILE Elf, PELF_DWARF_DIE Die)
+{
+    PELF_DWARF_UNIT Unit = Die->Unit;
+    UINT64          Offset;
+
+    if (!ElfGetSiblingOffset(Elf, Die, &Offset) || Offset >= Unit->End)
+    {
+        return FALSE;
+    }
+
+    return ElfReadDie(Elf, Unit, Offset, Die) && Die->Tag != 0;
+}
+
+/**
+ * @brief Check whether a tag is a type whose name is indexed
+ *
+ * @param Tag
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfIsTypeTag(UINT16 Tag)
+{
+    switch (Tag)
+    {
+    case ELF_DW_TAG_STRUCTURE_TYPE:
+    case ELF_DW_TAG_UNION_TYPE:
+    case ELF_DW_TAG_CLASS_TYPE:
+    case ELF_DW_TAG_ENUMERATION_TYPE:
+    case ELF_DW_TAG_TYPEDEF:
+    case ELF_DW_TAG_BASE_TYPE:
+        return TRUE;
+
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Look up a name in the names of the indexed units
+ *
+ * @param Elf
+ * @param Name
+ * @param IsType whether a type, or a variable or a function is looked up
+ * @param Tag the tag of the type (zero for any tag)
+ * @param DieOffset
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfLookupName(PELF_FILE Elf, const CHAR * Name, BOOLEAN IsType, UINT16 Tag, UINT64 * DieOffset)
+{
+    UINT32 Hash = ElfHashName(Name);
+
+    if (Elf->NameHashHeads == NULL)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = Elf->NameHashHeads[Hash & (Elf->NameHashBucketsCount - 1)]; i != 0xffffffff; i = Elf->Names[i].Next)
+    {
+        PELF_DWARF_NAME Entry = &Elf->Names[i];
+
+        if (Entry->Hash == Hash && ElfIsTypeTag(Entry->Tag) == IsType && (Tag == 0 || Entry->Tag == Tag) &&
+            strcmp(Entry->Name, Name) == 0)
+        {
+            *DieOffset = Entry->DieOffset;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Add a name to the index of the names of the DIEs
+ * @details Each name is added once for each tag, so the types that are
+ * repeated in the units are not added again
+ *
+ * @param Elf
+ * @param Name
+ * @param Tag
+ * @param DieOffset
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfAddName(PELF_FILE Elf, const CHAR * Name, UINT16 Tag, UINT64 DieOffset)
+{
+    UINT32          Hash = ElfHashName(Name);
+    UINT32          Bucket;
+    PELF_DWARF_NAME Entry;
+
+    if (Elf->NameHashHeads == NULL)
+    {
+        Elf->NameHashHeads = malloc(ELF_DWARF_NAME_BUCKETS * sizeof(UINT32));
+
+        if (Elf->NameHashHeads == NULL)
+        {
+            return FALSE;
+        }
+
+        memset(Elf->NameHashHeads, 0xff, ELF_DWARF_NAME_BUCKETS * sizeof(UINT32));
+
+        Elf->NameHashBucketsCount = ELF_DWARF_NAME_BUCKETS;
+    }
+
+    for (UINT32 i = Elf->NameHashHeads[Hash & (Elf->NameHashBucketsCount - 1)]; i != 0xffffffff; i = Elf->Names[i].Next)
+    {
+        if (Elf->Names[i].Hash == Hash && Elf->Names[i].Tag == Tag && strcmp(Elf->Names[i].Name, Name) == 0)
+        {
+            return TRUE;
+        }
+    }
+
+    if (Elf->NamesCount == Elf->NamesCapacity)
+    {
+        UINT32          Capacity = Elf->NamesCapacity == 0 ? 1024 : Elf->NamesCapacity * 2;
+        PELF_DWARF_NAME Names    = realloc(Elf->Names, Capacity * sizeof(ELF_DWARF_NAME));
+
+        if (Names == NULL)
+        {
+            return FALSE;
+        }
+
+        Elf->Names         = Names;
+        Elf->NamesCapacity = Capacity;
+    }
+
+    //
+    // Grow the hash table when the chains are long
+    //
+    if (Elf->NamesCount >= Elf->NameHashBucketsCount * 2 && Elf->NameHashBucketsCount < 0x40000000)
+    {
+        UINT32   BucketsCount = Elf->NameHashBucketsCount * 2;
+        UINT32 * Heads        = malloc(BucketsCount * sizeof(UINT32));
+
+        if (Heads != NULL)
+        {
+            memset(Heads, 0xff, BucketsCount * sizeof(UINT32));
+
+            for (UINT32 i = Elf->NamesCount; i-- > 0;)
+            {
+                Bucket              = Elf->Names[i].Hash & (BucketsCount - 1);
+                Elf->Names[i].Next  = Heads[Bucket];
+                Heads[Bucket]       = i;
+            }
+
+            free(Elf->NameHashHeads);
+
+            Elf->NameHashHeads        = Heads;
+            Elf->NameHashBucketsCount = BucketsCount;
+        }
+    }
+
+    Bucket = Hash & (Elf->NameHashBucketsCount - 1);
+    Entry  = &Elf->Names[Elf->NamesCount];
+
+    Entry->Name      = Name;
+    Entry->DieOffset = DieOffset;
+    Entry->Hash      = Hash;
+    Entry->Tag       = Tag;
+
+    //
+    // The first name stays the first of its chain
+    //
+    Entry->Next = 0xffffffff;
+
+    if (Elf->NameHashHeads[Bucket] == 0xffffffff)
+    {
+        Elf->NameHashHeads[Bucket] = Elf->NamesCount;
+    }
+    else
+    {
+        UINT32 Last = Elf->NameHashHeads[Bucket];
+
+        while (Elf->Names[Last].Next != 0xffffffff)
+        {
+            Last = Elf->Names[Last].Next;
+        }
+
+        Elf->Names[Last].Next = Elf->NamesCount;
+    }
+
+    Elf->NamesCount++;
+
+    return TRUE;
+}
+
+/**
+ * @brief Index the names of the DIEs of a unit
+ * @details The named types, and the variables and the functions at fixed
+ * addresses, that are the children of the DIE of the unit are indexed
+ *
+ * @param Elf
+ * @param Unit
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfIndexUnit(PELF_FILE Elf, PELF_DWARF_UNIT Unit)
+{
+    ELF_DWARF_DIE Die;
+    BOOLEAN       IsChild;
+
+    if (!ElfReadDie(Elf, Unit, Unit->DieOffset, &Die) ||
+        (Die.Tag != ELF_DW_TAG_COMPILE_UNIT && Die.Tag != ELF_DW_TAG_PARTIAL_UNIT))
+    {
+        return FALSE;
+    }
+
+    for (IsChild = ElfGetFirstChild(Elf, &Die, &Die); IsChild; IsChild = ElfGetNextSibling(Elf, &Die))
+    {
+        if (Die.Name == NULL)
+        {
+            continue;
+        }
+
+        if ((ElfIsTypeTag(Die.Tag) && !Die.IsDeclaration) ||
+            ((Die.Tag == ELF_DW_TAG_VARIABLE || Die.Tag == ELF_DW_TAG_SUBPROGRAM) && Die.HasAddress))
+        {
+            if (!ElfAddName(Elf, Die.Name, Die.Tag, Die.Offset))
+            {
+                return FALSE;
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Find a DIE by its name
+ * @details The names of the units that are already indexed are looked up
+ * first, and then the rest of the units are indexed one by one until the
+ * name is found
+ *
+ * @param Elf
+ * @param Name
+ * @param IsType whether a type, or a variable or a function is looked up
+ * @param Tag the tag of the type (zero for any tag)
+ * @param Die
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfFindDie(PELF_FILE Elf, const CHAR * Name, BOOLEAN IsType, UINT16 Tag, PELF_DWARF_DIE Die)
+{
+    UINT64 DieOffset;
+
+    if (!ElfLoadUnits(Elf))
+    {
+        return FALSE;
+    }
+
+    for (;;)
+    {
+        if (ElfLookupName(Elf, Name, IsType, Tag, &DieOffset))
+        {
+            return ElfReadDieAt(Elf, DieOffset, Die);
+        }
+
+        if (Elf->IndexedUnitsCount == Elf->UnitsCount)
+        {
+            return FALSE;
+        }
+
+        ElfIndexUnit(Elf, &Elf->Units[Elf->IndexedUnitsCount++]);
+    }
+}
+
+/**
+ * @brief Find the definition of a type
+ * @details The typedefs and the modifiers are followed, and the declarations
+ * of the structures are replaced by their definitions (in other units)
+ *
+ * @param Elf
+ * @param Die
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfResolveType(PELF_FILE Elf, PELF_DWARF_DIE Die)
+{
+    for (UINT32 Depth = 0; Depth < ELF_MAX_TYPE_DEPTH; Depth++)
+    {
+        switch (Die->Tag)
+        {
+        case ELF_DW_TAG_TYPEDEF:
+        case ELF_DW_TAG_CONST_TYPE:
+        case ELF_DW_TAG_VOLATILE_TYPE:
+        case ELF_DW_TAG_RESTRICT_TYPE:
+        case ELF_DW_TAG_ATOMIC_TYPE:
+            if (!Die->HasType || !ElfReadDieAt(Elf, Die->Type, Die))
+            {
+                return FALSE;
+            }
+            break;
+
+        case ELF_DW_TAG_STRUCTURE_TYPE:
+        case ELF_DW_TAG_UNION_TYPE:
+        case ELF_DW_TAG_CLASS_TYPE:
+        case ELF_DW_TAG_ENUMERATION_TYPE:
+            if (!Die->IsDeclaration)
+            {
+                return TRUE;
+            }
+
+            if (Die->Name == NULL || !ElfFindDie(Elf, Die->Name, TRUE, Die->Tag, Die))
+            {
+                return FALSE;
+            }
+            break;
+
+        default:
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Get the size of a type
+ *
+ * @param Elf
+ * @param Die
+ * @param TypeSize
+ * @param Depth
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfGetDieSize(PELF_FILE Elf, PELF_DWARF_DIE Die, UINT64 * TypeSize, UINT32 Depth)
+{
+    ELF_DWARF_DIE Type = *Die;
+    ELF_DWARF_DIE Child;
+    UINT64        ElementSize;
+    UINT64        Count = 1;
+
+    if (Depth >= ELF_MAX_TYPE_DEPTH || !ElfResolveType(Elf, &Type))
+    {
+        return FALSE;
+    }
+
+    switch (Type.Tag)
+    {
+    case ELF_DW_TAG_POINTER_TYPE:
+    case ELF_DW_TAG_REFERENCE_TYPE:
+    case ELF_DW_TAG_RVALUE_REF_TYPE:
+        *TypeSize = Type.HasByteSize ? Type.ByteSize : Type.Unit->AddressSize;
+        return TRUE;
+
+    case ELF_DW_TAG_ARRAY_TYPE:
+        if (Type.HasByteSize)
+        {
+            *TypeSize = Type.ByteSize;
+            return TRUE;
+        }
+
+        if (!Type.HasType || !ElfReadDieAt(Elf, Type.Type, &Child) ||
+            !ElfGetDieSize(Elf, &Child, &ElementSize, Depth + 1))
+        {
+            return FALSE;
+        }
+
+        //
+        // The number of the elements of each dimension, the flexible
+        // arrays have no elements
+        //
+        for (BOOLEAN IsChild = ElfGetFirstChild(Elf, &Type, &Child); IsChild; IsChild = ElfGetNextSibling(Elf, &Child))
+        {
+            if (Child.Tag != ELF_DW_TAG_SUBRANGE_TYPE)
+            {
+                continue;
+            }
+
+            if (Child.HasCount)
+            {
+                Count *= Child.Count;
+            }
+            else if (Child.HasUpperBound && Child.UpperBound >= 0)
+            {
+                Count *= (UINT64)Child.UpperBound + 1;
+            }
+            else
+            {
+                Count = 0;
+            }
+        }
+
+        *TypeSize = ElementSize * Count;
+        return TRUE;
+
+    default:
+        if (Type.HasByteSize)
+        {
+            *TypeSize = Type.ByteSize;
+            return TRUE;
+        }
+
+        //
+        // The enumerations may only have their underlying type
+        //
+        if (Type.Tag == ELF_DW_TAG_ENUMERATION_TYPE && Type.HasType && ElfReadDieAt(Elf, Type.Type, &Child))
+        {
+            return ElfGetDieSize(Elf, &Child, TypeSize, Depth + 1);
+        }
+
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Find a member of a structure or a union
+ * @details The members of the anonymous structures and unions are found
+ * in their parents. The same as the PDB files, the position of the bit is
+ * returned for the fields of one bit, and the offset of the storage unit
+ * is returned for the other bit-fields
+ *
+ * @param Elf
+ * @param Type
+ * @param FieldName
+ * @param BaseOffset the offset of the structure in the type that is queried
+ * @param FieldOffset
+ * @param Depth
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfFindMember(PELF_FILE      Elf,
+              PELF_DWARF_DIE Type,
+              const CHAR *   FieldName,
+              UINT64         BaseOffset,
+              UINT32 *       FieldOffset,
+              UINT32         Depth)
+{
+    ELF_DWARF_DIE Member;
+    ELF_DWARF_DIE MemberType;
+
+    if (Depth >= ELF_MAX_TYPE_DEPTH)
+    {
+        return FALSE;
+    }
+
+    for (BOOLEAN IsChild = ElfGetFirstChild(Elf, Type, &Member); IsChild; IsChild = ElfGetNextSibling(Elf, &Member))
+    {
+        UINT64 Offset = BaseOffset + Member.MemberLocation;
+        UINT64 StorageSize;
+        UINT64 Bit;
+
+        if (Member.Tag != ELF_DW_TAG_MEMBER)
+        {
+            continue;
+        }
+
+        if (Member.Name == NULL)
+        {
+            if (Member.HasType && ElfReadDieAt(Elf, Member.Type, &MemberType) && ElfResolveType(Elf, &MemberType) &&
+                (MemberType.Tag == ELF_DW_TAG_STRUCTURE_TYPE || MemberType.Tag == ELF_DW_TAG_UNION_TYPE ||
+                 MemberType.Tag == ELF_DW_TAG_CLASS_TYPE) &&
+                ElfFindMember(Elf, &MemberType, FieldName, Offset, FieldOffset, Depth + 1))
+            {
+                return TRUE;
+            }
+
+            continue;
+        }
+
+        if (strcmp(Member.Name, FieldName) != 0)
+        {
+            continue;
+        }
+
+        if (!Member.HasBitSize)
+        {
+            *FieldOffset = (UINT32)Offset;
+            return TRUE;
+        }
+
+        //
+        // The size of the storage unit of the bit-field
+        //
+        if (Member.HasByteSize)
+        {
+            StorageSize = Member.ByteSize;
+        }
+        else if (!Member.HasType || !ElfReadDieAt(Elf, Member.Type, &MemberType) ||
+                 !ElfGetDieSize(Elf, &MemberType, &StorageSize, Depth + 1))
+        {
+            StorageSize = 1;
+        }
+
+        if (StorageSize == 0 || StorageSize > sizeof(UINT64))
+        {
+            StorageSize = 1;
+        }
+
+        if (Member.HasDataBitOffset)
+        {
+            Bit = BaseOffset * 8 + Member.DataBitOffset;
+        }
+        else if (Member.HasBitOffset)
+        {
+            //
+            // The offset of DWARF 2 to 4 is from the most significant bit
+            //
+            Bit = Offset * 8 + StorageSize * 8 - Member.BitOffset - Member.BitSize;
+        }
+        else
+        {
+            Bit = Offset * 8;
+        }
+
+        if (Member.BitSize == 1)
+        {
+            *FieldOffset = (UINT32)(Bit % (StorageSize * 8));
+        }
+        else
+        {
+            *FieldOffset = (UINT32)(Bit / (StorageSize * 8) * StorageSize);
+        }
+
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Find a symbol by its name
+ * @details The symbol table is used first, the global symbols are preferred
+ * to the local symbols with the same name, and the names are matched
+ * case-insensitively if they're not matched exactly. The variables and the
+ * functions of the debug information are used if they're not in the symbol
+ * table
+ *
+ * @param Elf
+ * @param Name
+ * @param Rva
+ * @return BOOLEAN
+ */
+BOOLEAN
+ElfFindSymbol(PELF_FILE Elf, const CHAR * Name, UINT64 * Rva)
+{
+    ELF_DWARF_DIE Die;
+    UINT32        Rank = 0;
+
+    if (ElfLoadSymbols(Elf))
+    {
+        UINT32 Bucket = ElfHashName(Name) & (Elf->SymbolHashBucketsCount - 1);
+
+        for (UINT32 i = Elf->SymbolHashHeads[Bucket]; i != 0xffffffff && Rank != 3; i = Elf->SymbolHashNext[i])
+        {
+            UINT64       SymbolRva;
+            UINT64       Size;
+            BYTE         Binding;
+            const CHAR * SymbolName = ElfGetSymbol(Elf, i, &SymbolRva, &Size, &Binding);
+            UINT32       SymbolRank;
+
+            if (strcmp(SymbolName, Name) == 0)
+            {
+                SymbolRank = Binding == ELF_STB_LOCAL ? 2 : 3;
+            }
+            else if (strcasecmp(SymbolName, Name) == 0)
+            {
+                SymbolRank = 1;
+            }
+            else
+            {
+                continue;
+            }
+
+            if (SymbolRank > Rank)
+            {
+                Rank = SymbolRank;
+                *Rva = SymbolRva;
+            }
+        }
+
+        if (Rank != 0)
+        {
+            return TRUE;
+        }
+    }
+
+    if (ElfFindDie(Elf, Name, FALSE, 0, &Die) && Die.HasAddress)
+    {
+        *Rva = Die.Address - Elf->ImageBase;
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Get the offset of a field of a type
+ *
+ * @param Elf
+ * @param TypeName
+ * @param FieldName
+ * @param FieldOffset
+ * @return BOOLEAN
+ */
+BOOLEAN
+ElfGetFieldOffset(PELF_FILE Elf, const CHAR * TypeName, const CHAR * FieldName, UINT32 * FieldOffset)
+{
+    ELF_DWARF_DIE Type;
+
+    if (!ElfFindDie(Elf, TypeName, TRUE, 0, &Type) || !ElfResolveType(Elf, &Type) ||
+        (Type.Tag != ELF_DW_TAG_STRUCTURE_TYPE && Type.Tag != ELF_DW_TAG_UNION_TYPE && Type.Tag != ELF_DW_TAG_CLASS_TYPE))
+    {
+        return FALSE;
+    }
+
+    return ElfFindMember(Elf, &Type, FieldName, 0, FieldOffset, 0);
+}
+
+/**
+ * @brief Get the size of a type
+ *
+ * @param Elf
+ * @param TypeName
+ * @param TypeSize
+ * @return BOOLEAN
+ */
+BOOLEAN
+ElfGetTypeSize(PELF_FILE Elf, const CHAR * TypeName, UINT64 * TypeSize)
+{
+    ELF_DWARF_DIE Type;
+
+    if (!ElfFindDie(Elf, TypeName, TRUE, 0, &Type))
+    {
+        return FALSE;
+    }
+
+    return ElfGetDieSize(Elf, &Type, TypeSize, 0);
+}
+
+/**
+ * @brief Compare the address ranges by their addresses
+ *
+ * @param First
+ * @param Second
+ * @return int
+ */
+static int
+ElfCompareRanges(const void * First, const void * Second)
+{
+    UINT64 FirstAddress  = ((const ELF_DWARF_RANGE *)First)->Address;
+    UINT64 SecondAddress = ((const ELF_DWARF_RANGE *)Second)->Address;
+
+    return FirstAddress < SecondAddress ? -1 : FirstAddress > SecondAddress;
+}
+
+/**
+ * @brief Read the address ranges of the units (.debug_aranges)
+ * @details The ranges are read and sorted when an address is first
+ * converted to its line
+ *
+ * @param Elf
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfLoadRanges(PELF_FILE Elf)
+{
+    ELF_READER Reader;
+    UINT32     Capacity = 0;
+
+    if (Elf->IsRangesLoaded)
+    {
+        return Elf->RangesCount != 0;
+    }
+
+    Elf->IsRangesLoaded = TRUE;
+
+    ElfInitializeReader(&Reader, Elf->DebugAranges.Data, Elf->DebugAranges.Size, 0);
+
+    while (Reader.IsValid && Reader.Offset < Reader.Size)
+    {
+        UINT64 Start = Reader.Offset;
+        UINT64 Length;
+        UINT64 End;
+        UINT64 UnitOffset;
+        UINT32 OffsetSize = 4;
+        UINT32 AddressSize;
+
+        Length = ElfReadFixed(&Reader, 4);
+
+        if (Length == 0xffffffff)
+        {
+            OffsetSize = 8;
+            Length     = ElfReadFixed(&Reader, 8);
+        }
+
+        if (!ElfReaderHas(&Reader, Length))
+        {
+            break;
+        }
+
+        End = Reader.Offset + Length;
+
+        ElfSkip(&Reader, 2);
+
+        UnitOffset  = ElfReadFixed(&Reader, OffsetSize);
+        AddressSize = (UINT32)ElfReadFixed(&Reader, 1);
+
+        ElfSkip(&Reader, 1);
+
+        if (AddressSize != 4 && AddressSize != 8)
+        {
+            Reader.Offset = End;
+            continue;
+        }
+
+        //
+        // The tuples are aligned to their size
+        //
+        Reader.Offset = Start + (Reader.Offset - Start + AddressSize * 2 - 1) / (AddressSize * 2) * (AddressSize * 2);
+
+        while (Reader.IsValid && Reader.Offset + AddressSize * 2 <= End)
+        {
+            UINT64 Address      = ElfReadFixed(&Reader, AddressSize);
+            UINT64 RangeLength  = ElfReadFixed(&Reader, AddressSize);
+
+            if (Address == 0 && RangeLength == 0)
+            {
+                break;
+            }
+
+            if (Elf->RangesCount == Capacity)
+            {
+                UINT32           NewCapacity = Capacity == 0 ? 1024 : Capacity * 2;
+                PELF_DWARF_RANGE Ranges      = realloc(Elf->Ranges, NewCapacity * sizeof(ELF_DWARF_RANGE));
+
+                if (Ranges == NULL)
+                {
+                    break;
+                }
+
+                Elf->Ranges = Ranges;
+                Capacity    = NewCapacity;
+            }
+
+            Elf->Ranges[Elf->RangesCount].Address    = Address;
+            Elf->Ranges[Elf->RangesCount].Length     = RangeLength;
+            Elf->Ranges[Elf->RangesCount].UnitOffset = UnitOffset;
+
+            Elf->RangesCount++;
+        }
+
+        Reader.IsValid = TRUE;
+        Reader.Offset  = End;
+    }
+
+    if (Elf->RangesCount != 0)
+    {
+        qsort(Elf->Ranges, Elf->RangesCount, sizeof(ELF_DWARF_RANGE), ElfCompareRanges);
+    }
+
+    return Elf->RangesCount != 0;
+}
+
+
+/**
+ * @brief Read the formats of the entries of the directories or the files of
+ * the header of a line program (DWARF 5)
+ *
+ * @param Reader
+ * @param Formats the pairs of the contents and the forms
+ * @param FormatsCount
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfReadLineFormats(PELF_READER Reader, UINT64 * Formats, UINT32 * FormatsCount)
+{
+    *FormatsCount = (UINT32)ElfReadFixed(Reader, 1);
+
+    if (*FormatsCount > ELF_DWARF_MAX_LINE_FORMATS)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < *FormatsCount; i++)
+    {
+        Formats[i * 2]     = ElfReadUleb(Reader);
+        Formats[i * 2 + 1] = ElfReadUleb(Reader);
+    }
+
+    return Reader->IsValid;
+}
+
+/**
+ * @brief Read an entry of the directories or the files of the header of a
+ * line program (DWARF 5)
+ *
+ * @param Elf
+ * @param Unit
+ * @param Reader
+ * @param Formats
+ * @param FormatsCount
+ * @param Path
+ * @param DirectoryIndex
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfReadLineEntry(PELF_FILE       Elf,
+                 PELF_DWARF_UNIT Unit,
+                 PELF_READER     Reader,
+                 const UINT64 *  Formats,
+                 UINT32          FormatsCount,
+                 const CHAR **   Path,
+                 UINT64 *        DirectoryIndex)
+{
+    ELF_DWARF_VALUE Value;
+
+    *Path           = NULL;
+    *DirectoryIndex = 0;
+
+    for (UINT32 i = 0; i < FormatsCount; i++)
+    {
+        if (!ElfReadForm(Elf, Reader, Unit, (UINT16)Formats[i * 2 + 1], 0, &Value))
+        {
+            return FALSE;
+        }
+
+        if (Formats[i * 2] == ELF_DW_LNCT_PATH)
+        {
+            *Path = Value.String;
+        }
+        else if (Formats[i * 2] == ELF_DW_LNCT_DIRECTORY_INDEX)
+        {
+            *DirectoryIndex = Value.Constant;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Get the name of a file of the header of a line program
+ * @details The directory of the file is added to its name, except for the
+ * directory of the compilation
+ *
+ * @param Elf
+ * @param Unit the unit with the version and the sizes of the line program
+ * @param Reader the cursor at the directories of the header
+ * @param FileIndex
+ * @param FileName
+ * @param FileNameSize
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfGetLineFileName(PELF_FILE       Elf,
+                   PELF_DWARF_UNIT Unit,
+                   PELF_READER     Reader,
+                   UINT64          FileIndex,
+                   CHAR *          FileName,
+                   SIZE_T          FileNameSize)
+{
+    const CHAR * Directory      = NULL;
+    const CHAR * Name           = NULL;
+    const CHAR * Path;
+    UINT64       DirectoryIndex = 0;
+    UINT64       DirectoriesOffset;
+    UINT64       DirectoriesCount;
+    UINT64       FilesCount;
+    UINT64       Index;
+    UINT64       DirectoryFormats[ELF_DWARF_MAX_LINE_FORMATS * 2];
+    UINT64       FileFormats[ELF_DWARF_MAX_LINE_FORMATS * 2];
+    UINT32       DirectoryFormatsCount;
+    UINT32       FileFormatsCount;
+
+    if (Unit->Version >= 5)
+    {
+        //
+        // The entries are described by their formats, and the indexes of
+        // the directories and the files start from zero
+        //
+        if (!ElfReadLineFormats(Reader, DirectoryFormats, &DirectoryFormatsCount))
+        {
+            return FALSE;
+        }
+
+        DirectoriesCount  = ElfReadUleb(Reader);
+        DirectoriesOffset = Reader->Offset;
+
+        for (UINT64 Entry = 0; Entry < DirectoriesCount; Entry++)
+        {
+            if (!ElfReadLineEntry(Elf, Unit, Reader, DirectoryFormats, DirectoryFormatsCount, &Path, &Index))
+            {
+                return FALSE;
+            }
+        }
+
+        if (!ElfReadLineFormats(Reader, FileFormats, &FileFormatsCount))
+        {
+            return FALSE;
+        }
+
+        FilesCount = ElfReadUleb(Reader);
+
+        for (UINT64 Entry = 0; Entry < FilesCount && Entry <= FileIndex; Entry++)
+        {
+            if (!ElfReadLineEntry(Elf, Unit, Reader, FileFormats, FileFormatsCount, &Path, &Index))
+            {
+                return FALSE;
+            }
+
+            if (Entry == FileIndex)
+            {
+                Name           = Path;
+                DirectoryIndex = Index;
+            }
+        }
+
+        Reader->Offset = DirectoriesOffset;
+
+        for (UINT64 Entry = 0; Name != NULL && DirectoryIndex != 0 && Entry <= DirectoryIndex && Entry < DirectoriesCount; Entry++)
+        {
+            if (!ElfReadLineEntry(Elf, Unit, Reader, DirectoryFormats, DirectoryFormatsCount, &Path, &Index))
+            {
+                return FALSE;
+            }
+
+            Directory = Path;
+        }
+    }
+    else
+    {
+        //
+        // The include directories and then the files, their indexes start
+        // from one
+        //
+        DirectoriesOffset = Reader->Offset;
+
+        do
+        {
+            Path = ElfReadString(Reader);
+
+        } while (Path != NULL && *Path != '\0');
+
+        for (UINT64 Entry = 1; Reader->IsValid && Entry <= FileIndex; Entry++)
+        {
+            Path = ElfReadString(Reader);
+
+            if (Path == NULL || *Path == '\0')
+            {
+                break;
+            }
+
+            Index = ElfReadUleb(Reader);
+
+            ElfReadUleb(Reader);
+            ElfReadUleb(Reader);
+
+            if (Entry == FileIndex)
+            {
+                Name           = Path;
+                DirectoryIndex = Index;
+            }
+        }
+
+        Reader->Offset = DirectoriesOffset;
+
+        for (UINT64 Entry = 1; Name != NULL && DirectoryIndex != 0 && Entry <= DirectoryIndex; Entry++)
+        {
+            Path = ElfReadString(Reader);
+
+            if (Path == NULL || *Path == '\0')
+            {
+                break;
+            }
+
+            if (Entry == DirectoryIndex)
+            {
+                Directory = Path;
+            }
+        }
+    }
+
+    if (Name == NULL)
+    {
+        return FALSE;
+    }
+
+    if (Directory == NULL || Name[0] == '/')
+    {
+        snprintf(FileName, FileNameSize, "%s", Name);
+    }
+    else
+    {
+        snprintf(FileName, FileNameSize, "%s/%s", Directory, Name);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Find the line of an address in the line program of a unit
+ *
+ * @param Elf
+ * @param Unit
+ * @param Address
+ * @param FileName
+ * @param FileNameSize
+ * @param Line
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ElfFindLine(PELF_FILE       Elf,
+            PELF_DWARF_UNIT Unit,
+            UINT64          Address,
+            CHAR *          FileName,
+            SIZE_T          FileNameSize,
+            UINT32 *        Line)
+{
+    ELF_READER     Reader;
+    ELF_DWARF_UNIT LineUnit;
+    ELF_DWARF_DIE  UnitDie;
+    UINT64         Length;
+    UINT64         End;
+    UINT64         ProgramOffset;
+    UINT64         TablesOffset;
+    const BYTE *   OpcodeLengths;
+    BYTE           MinimumInstructionLength;
+    INT8           LineBase;
+    BYTE           LineRange;
+    BYTE           OpcodeBase;
+    UINT64         RowAddress      = 0;
+    UINT64         RowFile         = 1;
+    INT64          RowLine         = 1;
+    UINT64         PreviousAddress = 0;
+    UINT64         PreviousFile    = 0;
+    INT64          PreviousLine    = 0;
+    BOOLEAN        HasPrevious     = FALSE;
+
+    if ((!Unit->IsRead && !ElfReadDie(Elf, Unit, Unit->DieOffset, &UnitDie)) || !Unit->HasStmtList)
+    {
+        return FALSE;
+    }
+
+    //
+    // The header of the line program
+    //
+    LineUnit            = *Unit;
+    LineUnit.OffsetSize = 4;
+
+    ElfInitializeReader(&Reader, Elf->DebugLine.Data, Elf->DebugLine.Size, Unit->StmtList);
+
+    Length = ElfReadFixed(&Reader, 4);
+
+    if (Length == 0xffffffff)
+    {
+        LineUnit.OffsetSize = 8;
+        Length              = ElfReadFixed(&Reader, 8);
+    }
+
+    if (!ElfReaderHas(&Reader, Length))
+    {
+        return FALSE;
+    }
+
+    End         = Reader.Offset + Length;
+    Reader.Size = End;
+
+    LineUnit.Version = (UINT16)ElfReadFixed(&Reader, 2);
+
+    if (LineUnit.Version < 2 || LineUnit.Version > 5)
+    {
+        return FALSE;
+    }
+
+    if (LineUnit.Version >= 5)
+    {
+        LineUnit.AddressSize = (BYTE)ElfReadFixed(&Reader, 1);
+        ElfSkip(&Reader, 1);
+    }
+
+    ProgramOffset            = ElfReadFixed(&Reader, LineUnit.OffsetSize);
+    ProgramOffset            = Reader.Offset + ProgramOffset;
+    MinimumInstructionLength = (BYTE)ElfReadFixed(&Reader, 1);
+
+    if (LineUnit.Version >= 4)
+    {
+        ElfSkip(&Reader, 1);
+    }
+
+    ElfSkip(&Reader, 1);
+
+    LineBase      = (INT8)ElfReadFixed(&Reader, 1);
+    LineRange     = (BYTE)ElfReadFixed(&Reader, 1);
+    OpcodeBase    = (BYTE)ElfReadFixed(&Reader, 1);
+    OpcodeLengths = Reader.Data + Reader.Offset;
+
+    ElfSkip(&Reader, OpcodeBase == 0 ? 0 : OpcodeBase - 1);
+
+    TablesOffset = Reader.Offset;
+
+    if (!Reader.IsValid || LineRange == 0 || OpcodeBase == 0 || ProgramOffset > End)
+    {
+        return FALSE;
+    }
+
+    //
+    // Run the line program until the rows of the address are found
+    //
+    Reader.Offset = ProgramOffset;
+
+    while (Reader.IsValid && Reader.Offset < End)
+    {
+        BYTE    Opcode        = (BYTE)ElfReadFixed(&Reader, 1);
+        BOOLEAN IsRow         = FALSE;
+        BOOLEAN IsEndSequence = FALSE;
+
+        if (Opcode >= OpcodeBase)
+        {
+            BYTE Adjusted = Opcode - OpcodeBase;
+
+            RowAddress += (UINT64)(Adjusted / LineRange) * MinimumInstructionLength;
+            RowLine += LineBase + Adjusted % LineRange;
+            IsRow = TRUE;
+        }
+        else if (Opcode == 0)
+        {
+            UINT64 InstructionLength = ElfReadUleb(&Reader);
+            UINT64 InstructionEnd;
+
+            if (InstructionLength == 0 || !ElfReaderHas(&Reader, InstructionLength))
+            {
+                break;
+            }
+
+            InstructionEnd = Reader.Offset + InstructionLength;
+
+            switch (ElfReadFixed(&Reader, 1))
+            {
+            case ELF_DW_LNE_END_SEQUENCE:
+                IsRow         = TRUE;
+                IsEndSequence = TRUE;
+                break;
+
+            case ELF_DW_LNE_SET_ADDRESS:
+                RowAddress = ElfReadFixed(&Reader, (UINT32)(InstructionLength - 1));
+                break;
+
+            default:
+                break;
+            }
+
+            Reader.Offset = InstructionEnd;
+        }
+        else
+        {
+            switch (Opcode)
+            {
+            case ELF_DW_LNS_COPY:
+                IsRow = TRUE;
+                break;
+
+            case ELF_DW_LNS_ADVANCE_PC:
+                RowAddress += ElfReadUleb(&Reader) * MinimumInstructionLength;
+                break;
+
+            case ELF_DW_LNS_ADVANCE_LINE:
+                RowLine += ElfReadSleb(&Reader);
+                break;
+
+            case ELF_DW_LNS_SET_FILE:
+                RowFile = ElfReadUleb(&Reader);
+                break;
+
+            case ELF_DW_LNS_CONST_ADD_PC:
+                RowAddress += (UINT64)((255 - OpcodeBase) / LineRange) * MinimumInstructionLength;
+                break;
+
+            case ELF_DW_LNS_FIXED_ADVANCE_PC:
+                RowAddress += ElfReadFixed(&Reader, 2);
+                break;
+
+            default:
+                //
+                // Skip the operands of the other opcodes
+                //
+                for (BYTE i = 0; i < OpcodeLengths[Opcode - 1]; i++)
+                {
+                    ElfReadUleb(&Reader);
+                }
+                break;
+            }
+        }
+
+        if (!IsRow)
+        {
+            continue;
+        }
+
+        //
+        // The previous row covers the addresses until this row
+        //
+        if (HasPrevious && PreviousAddress <= Address && Address < RowAddress)
+        {
+            Reader.Offset = TablesOffset;
+            *Line         = (UINT32)PreviousLine;
+
+            return ElfGetLineFileName(Elf, &LineUnit, &Reader, PreviousFile, FileName, FileNameSize);
+        }
+
+        if (IsEndSequence)
+        {
+            HasPrevious = FALSE;
+            RowAddress  = 0;
+            RowFile     = 1;
+            RowLine     = 1;
+        }
+        else
+        {
+            HasPrevious     = TRUE;
+            PreviousAddress = RowAddress;
+            PreviousFile    = RowFile;
+            PreviousLine    = RowLine;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Get the file and the line of an address
+ * @details The unit of the address is found by the address ranges of the
+ * units, so only the line program of that unit is run. Without the address
+ * ranges (.debug_aranges), the line programs of the units are searched
+ *
+ * @param Elf
+ * @param Rva
+ * @param FileName
+ * @param FileNameSize
+ * @param Line
+ * @return BOOLEAN
+ */
+BOOLEAN
+ElfGetLineFromAddress(PELF_FILE Elf, UINT64 Rva, CHAR * FileName, SIZE_T FileNameSize, UINT32 * Line)
+{
+    UINT64           Address = Rva + Elf->ImageBase;
+    PELF_DWARF_RANGE Range;
+    PELF_DWARF_UNIT  Unit;
+    UINT32           Low = 0;
+    UINT32           High;
+
+    if (!ElfLoadUnits(Elf) || Elf->DebugLine.Data == NULL)
+    {
+        return FALSE;
+    }
+
+    if (!ElfLoadRanges(Elf))
+    {
+        for (UINT32 i = 0; i < Elf->UnitsCount; i++)
+        {
+            if (ElfFindLine(Elf, &Elf->Units[i], Address, FileName, FileNameSize, Line))
+            {
+                return TRUE;
+            }
+        }
+
+        return FALSE;
+    }
+
+    //
+    // The last range that starts at or below the address
+    //
+    High = Elf->RangesCount;
+
+    while (Low < High)
+    {
+        UINT32 Middle = Low + (High - Low) / 2;
+
+        if (Elf->Ranges[Middle].Address <= Address)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    if (Low == 0)
+    {
+        return FALSE;
+    }
+
+    Range = &Elf->Ranges[Low - 1];
+    Unit  = ElfFindUnit(Elf, Range->UnitOffset);
+
+    if (Address - Range->Address >= Range->Length || Unit == NULL)
+    {
+        return FALSE;
+    }
+
+    return ElfFindLine(Elf, Unit, Address, FileName, FileNameSize, Line);
+}
+
+#endif // __linux__
@@ -11,14 +11,12 @@
  */
 #include "pch.h"
 
-PSCRIPT_ENGINE_TOKEN_LIST   GlobalIdTable;
-PUSER_DEFINED_FUNCTION_NODE UserDefinedFunctionHead;
-PUSER_DEFINED_FUNCTION_NODE CurrentUserDefinedFunction;
-PINCLUDE_NODE               IncludeHead;
-unsigned int                InputIdx;
-unsigned int                CurrentLine;
-unsigned int                CurrentLineIdx;
-unsigned int                CurrentTokenIdx;
-HWDBG_INSTANCE_INFORMATION  g_HwdbgInstanceInfo;
-BOOLEAN                     g_HwdbgInstanceInfoIsValid;
-PVOID                       g_MessageHandler;
+PSCRIPT_ENGINE_ID_TABLE    GlobalIdTable;
+volatile LONG              GlobalIdTableLock;
+volatile LONG              SymbolParserLock;
+HWDBG_INSTANCE_INFORMATION g_HwdbgInstanceInfo;
+BOOLEAN                    g_HwdbgInstanceInfoIsValid;
+PVOID                      g_MessageHandler;
+UINT32                     g_ScriptEngineOptimizationLevel;
+
+SCRIPT_ENGINE_THREAD_LOCAL PSCRIPT_ENGINE_COMPILER_CONTEXT g_CompilerContext;
@@ -0,0 +1,1683 @@
+/**
+ * @file optimizer.c
+ * @author M.H. Gholamrezaei (mh@hyperdbg.org)
+ *
+ * @details Optimizer of the generated code of the script engine
+ * @version 0.19
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Returns the type of a symbol without the flags of the arguments of
+ * printf-like functions
+ *
+ * @param Symbol
+ * @return UINT64
+ */
+static UINT64
+OptimizerGetSymbolType(PSYMBOL Symbol)
+{
+    return Symbol->Type & 0x7fffffff;
+}
+
+/**
+ * @brief Checks whether the symbol is a temp that is read or written as an integer
+ *
+ * @param Symbol
+ * @return BOOLEAN
+ */
+static BOOLEAN
+OptimizerIsIntegerTemp(PSYMBOL Symbol)
+{
+    return Symbol->Type == SYMBOL_TEMP_TYPE && Symbol->Len == SYMBOL_VALUE_KIND_INTEGER;
+}
+
+/**
+ * @brief Checks whether the symbol is a constant
+ *
+ * @param Symbol
+ * @return BOOLEAN
+ */
+static BOOLEAN
+OptimizerIsConstant(PSYMBOL Symbol)
+{
+    return Symbol->Type == SYMBOL_NUM_TYPE;
+}
+
+/**
+ * @brief Checks whether reading the symbol has no side effects and never fails
+ *
+ * @param Symbol
+ * @return BOOLEAN
+ */
+static BOOLEAN
+OptimizerIsPureOperand(PSYMBOL Symbol)
+{
+    switch (Symbol->Type)
+    {
+    case SYMBOL_NUM_TYPE:
+    case SYMBOL_TEMP_TYPE:
+    case SYMBOL_GLOBAL_ID_TYPE:
+    case SYMBOL_PERCPU_ID_TYPE:
+    case SYMBOL_REGISTER_TYPE:
+    case SYMBOL_FUNCTION_PARAMETER_ID_TYPE:
+    case SYMBOL_RETURN_VALUE_TYPE:
+    case SYMBOL_STACK_INDEX_TYPE:
+    case SYMBOL_STACK_BASE_INDEX_TYPE:
+        return TRUE;
+
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Returns the index of the symbol after an operand (strings take
+ * more than one symbol)
+ *
+ * @param CodeBuffer
+ * @param Index
+ * @return UINT32
+ */
+static UINT32
+OptimizerNextOperand(PSYMBOL_BUFFER CodeBuffer, UINT32 Index)
+{
+    PSYMBOL Symbol = CodeBuffer->Head + Index;
+    UINT64  Type   = OptimizerGetSymbolType(Symbol);
+
+    if (Type == SYMBOL_STRING_TYPE || Type == SYMBOL_WSTRING_TYPE)
+    {
+        return Index + GetSymbolHeapSize(Symbol);
+    }
+
+    return Index + 1;
+}
+
+/**
+ * @brief Returns the kind of the instruction of an operator
+ *
+ * @param Operator
+ * @return OPTIMIZER_INSTRUCTION_KIND
+ */
+static OPTIMIZER_INSTRUCTION_KIND
+OptimizerGetInstructionKind(UINT64 Operator)
+{
+    switch (Operator)
+    {
+    case FUNC_MOV:
+        return OptimizerInstructionMove;
+
+    case FUNC_NEG:
+    case FUNC_NOT:
+        return OptimizerInstructionUnary;
+
+    case FUNC_OR:
+    case FUNC_XOR:
+    case FUNC_AND:
+    case FUNC_ASR:
+    case FUNC_ASL:
+    case FUNC_ADD:
+    case FUNC_SUB:
+    case FUNC_MUL:
+    case FUNC_DIV:
+    case FUNC_MOD:
+    case FUNC_GT:
+    case FUNC_LT:
+    case FUNC_EGT:
+    case FUNC_ELT:
+    case FUNC_EQUAL:
+    case FUNC_NEQ:
+        return OptimizerInstructionBinary;
+
+    case FUNC_NEG_TYPED:
+    case FUNC_BITWISE_NOT_TYPED:
+    case FUNC_LOGICAL_NOT_TYPED:
+        return OptimizerInstructionTypedUnary;
+
+    case FUNC_ADD_TYPED:
+    case FUNC_SUB_TYPED:
+    case FUNC_MUL_TYPED:
+    case FUNC_DIV_TYPED:
+    case FUNC_MOD_TYPED:
+    case FUNC_BITWISE_AND_TYPED:
+    case FUNC_BITWISE_OR_TYPED:
+    case FUNC_BITWISE_XOR_TYPED:
+    case FUNC_SHIFT_LEFT_TYPED:
+    case FUNC_SHIFT_RIGHT_TYPED:
+    case FUNC_GT_TYPED:
+    case FUNC_LT_TYPED:
+    case FUNC_EGT_TYPED:
+    case FUNC_ELT_TYPED:
+    case FUNC_EQUAL_TYPED:
+    case FUNC_NEQ_TYPED:
+        return OptimizerInstructionTypedBinary;
+
+    case FUNC_CAST_SCALAR:
+        return OptimizerInstructionCast;
+
+    case FUNC_JMP:
+        return OptimizerInstructionJump;
+
+    case FUNC_JZ:
+    case FUNC_JNZ:
+        return OptimizerInstructionConditionalJump;
+
+    case FUNC_CALL:
+        return OptimizerInstructionCall;
+
+    case FUNC_RET:
+        return OptimizerInstructionReturn;
+
+    case FUNC_PUSH:
+        return OptimizerInstructionPush;
+
+    default:
+        return OptimizerInstructionUnknown;
+    }
+}
+
+/**
+ * @brief Returns the number of symbols of an instruction (zero if it is
+ * not known)
+ *
+ * @param Kind
+ * @return UINT32
+ */
+static UINT32
+OptimizerGetInstructionLength(OPTIMIZER_INSTRUCTION_KIND Kind)
+{
+    switch (Kind)
+    {
+    case OptimizerInstructionReturn:
+        return 1;
+
+    case OptimizerInstructionJump:
+    case OptimizerInstructionCall:
+    case OptimizerInstructionPush:
+        return 2;
+
+    case OptimizerInstructionMove:
+    case OptimizerInstructionUnary:
+    case OptimizerInstructionConditionalJump:
+        return 3;
+
+    case OptimizerInstructionBinary:
+    case OptimizerInstructionTypedUnary:
+        return 4;
+
+    case OptimizerInstructionTypedBinary:
+    case OptimizerInstructionCast:
+        return 5;
+
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Returns the offset of the destination operand of an instruction
+ * (zero if it has no destination)
+ *
+ * @param Kind
+ * @return UINT32
+ */
+static UINT32
+OptimizerGetDestinationOffset(OPTIMIZER_INSTRUCTION_KIND Kind)
+{
+    switch (Kind)
+    {
+    case OptimizerInstructionMove:
+    case OptimizerInstructionUnary:
+    case OptimizerInstructionTypedUnary:
+    case OptimizerInstructionCast:
+        return 2;
+
+    case OptimizerInstructionBinary:
+    case OptimizerInstructionTypedBinary:
+        return 3;
+
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Checks whether an operand of a known instruction is a source (is read
+ * by GetValue), the jump targets are not sources
+ *
+ * @param Kind
+ * @param Offset
+ * @return BOOLEAN
+ */
+static BOOLEAN
+OptimizerIsSourceOffset(OPTIMIZER_INSTRUCTION_KIND Kind, UINT32 Offset)
+{
+    if (Kind == OptimizerInstructionUnknown || Offset == 0 || Offset >= OptimizerGetInstructionLength(Kind))
+    {
+        return FALSE;
+    }
+
+    if (Kind == OptimizerInstructionJump || Kind == OptimizerInstructionCall ||
+        Kind == OptimizerInstructionConditionalJump)
+    {
+        return Offset == 2;
+    }
+
+    return Offset != OptimizerGetDestinationOffset(Kind);
+}
+
+/**
+ * @brief Checks whether an operator is never optimized
+ *
+ * @details These operators are only used while parsing, the optimizer does not
+ * know whether their operands are indexes of the code buffer or not
+ *
+ * @param Operator
+ * @return BOOLEAN
+ */
+static BOOLEAN
+OptimizerIsUnsupportedOperator(UINT64 Operator)
+{
+    return Operator == FUNC_UNDEFINED ||
+           (Operator >= FUNC_START_OF_DO_WHILE && Operator <= FUNC_IGNORE_LVALUE);
+}
+
+/**
+ * @brief Checks whether an operator may access the temps by their address
+ * (references and struct objects)
+ *
+ * @param Operator
+ * @return BOOLEAN
+ */
+static BOOLEAN
+OptimizerMayAccessTempsByAddress(UINT64 Operator)
+{
+    return Operator == FUNC_REFERENCE ||
+           Operator == FUNC_POINTER_DIFF ||
+           (Operator >= FUNC_STRUCT_FORWARD_DECLARATION && Operator <= FUNC_MEMBER_ARROW_READ);
+}
+
+//////////////////////////////////////////////////
+//          Integer semantics of the evaluator  //
+//////////////////////////////////////////////////
+
+//
+// The following functions must have the same result as the typed operators
+// of ScriptEngineEval.c, otherwise the optimized script behaves differently
+//
+
+/**
+ * @brief Checks whether the scalar type is an integer type
+ *
+ * @param TypeId
+ * @return BOOLEAN
+ */
+static BOOLEAN
+OptimizerScalarTypeIsInteger(UINT64 TypeId)
+{
+    return TypeId >= SCRIPT_SCALAR_TYPE_BOOL && TypeId <= SCRIPT_SCALAR_TYPE_U64;
+}
+
+/**
+ * @brief Checks whether the scalar type is a signed integer type
+ *
+ * @param TypeId
+ * @return BOOLEAN
+ */
+static BOOLEAN
+OptimizerScalarTypeIsSigned(UINT64 TypeId)
+{
+    return TypeId == SCRIPT_SCALAR_TYPE_I8 || TypeId == SCRIPT_SCALAR_TYPE_I16 ||
+           TypeId == SCRIPT_SCALAR_TYPE_I32 || TypeId == SCRIPT_SCALAR_TYPE_I64;
+}
+
+/**
+ * @brief Checks whether the scalar type is an integer type or a pointer
+ *
+ * @param TypeId
+ * @return BOOLEAN
+ */
+static BOOLEAN
+OptimizerScalarTypeIsIntegerOrPointer(UINT64 TypeId)
+{
+    return OptimizerScalarTypeIsInteger(TypeId) || TypeId == SCRIPT_SCALAR_TYPE_POINTER;
+}
+
+/**
+ * @brief Returns the width of an integer scalar type in bits
+ *
+ * @param TypeId
+ * @return UINT32
+ */
+static UINT32
+OptimizerScalarTypeWidth(UINT64 TypeId)
+{
+    switch (TypeId)
+    {
+    case SCRIPT_SCALAR_TYPE_BOOL:
+    case SCRIPT_SCALAR_TYPE_I8:
+    case SCRIPT_SCALAR_TYPE_U8:
+        return 8;
+    case SCRIPT_SCALAR_TYPE_I16:
+    case SCRIPT_SCALAR_TYPE_U16:
+        return 16;
+    case SCRIPT_SCALAR_TYPE_I32:
+    case SCRIPT_SCALAR_TYPE_U32:
+        return 32;
+    default:
+        return 64;
+    }
+}
+
+/**
+ * @brief Truncates and sign-extends a value to an integer scalar type
+ * (ScriptEngineNormalizeInteger)
+ *
+ * @param Value
+ * @param TypeId
+ * @return UINT64
+ */
+static UINT64
+OptimizerNormalizeInteger(UINT64 Value, UINT64 TypeId)
+{
+    UINT32 Width = OptimizerScalarTypeWidth(TypeId);
+    UINT64 Mask;
+
+    if (TypeId == SCRIPT_SCALAR_TYPE_BOOL)
+        return Value != 0;
+    if (Width == 64)
+        return Value;
+    Mask  = (1ULL << Width) - 1;
+    Value &= Mask;
+    if (OptimizerScalarTypeIsSigned(TypeId) && (Value & (1ULL << (Width - 1))))
+        Value |= ~Mask;
+    return Value;
+}
+
+/**
+ * @brief Checks whether a typed binary operator with the given right operand
+ * never fails (ScriptEngineExecuteTypedBinary)
+ *
+ * @param Operator
+ * @param Right
+ * @param TypeId
+ * @return BOOLEAN
+ */
+static BOOLEAN
+OptimizerTypedBinaryCannotFail(UINT64 Operator, PSYMBOL Right, UINT64 TypeId)
+{
+    UINT64 Value;
+
+    if (TypeId == SCRIPT_SCALAR_TYPE_POINTER)
+    {
+        return Operator >= FUNC_GT_TYPED && Operator <= FUNC_NEQ_TYPED;
+    }
+
+    if (!OptimizerScalarTypeIsInteger(TypeId))
+    {
+        return FALSE;
+    }
+
+    switch (Operator)
+    {
+    case FUNC_DIV_TYPED:
+    case FUNC_MOD_TYPED:
+
+        //
+        // The division of the minimum signed value by -1 also fails
+        //
+        if (!OptimizerIsConstant(Right))
+            return FALSE;
+        Value = OptimizerNormalizeInteger(Right->Value, TypeId);
+        return Value != 0 && !(OptimizerScalarTypeIsSigned(TypeId) && Value == ~0ULL);
+
+    case FUNC_SHIFT_LEFT_TYPED:
+    case FUNC_SHIFT_RIGHT_TYPED:
+
+        if (!OptimizerIsConstant(Right))
+            return FALSE;
+        return OptimizerNormalizeInteger(Right->Value, TypeId) < OptimizerScalarTypeWidth(TypeId);
+
+    default:
+        return TRUE;
+    }
+}
+
+/**
+ * @brief Computes a typed binary operator (ScriptEngineExecuteTypedBinary)
+ *
+ * @param Operator
+ * @param Right
+ * @param Left
+ * @param TypeId
+ * @param Result
+ * @return BOOLEAN FALSE if the operator fails at runtime
+ */
+static BOOLEAN
+OptimizerExecuteTypedBinary(UINT64 Operator, UINT64 Right, UINT64 Left, UINT64 TypeId, PUINT64 Result)
+{
+    UINT32 Width;
+    UINT64 SignedMinimum;
+
+    if (TypeId == SCRIPT_SCALAR_TYPE_POINTER)
+    {
+        if (Operator == FUNC_GT_TYPED) *Result = Left > Right;
+        else if (Operator == FUNC_LT_TYPED) *Result = Left < Right;
+        else if (Operator == FUNC_EGT_TYPED) *Result = Left >= Right;
+        else if (Operator == FUNC_ELT_TYPED) *Result = Left <= Right;
+        else if (Operator == FUNC_EQUAL_TYPED) *Result = Left == Right;
+        else if (Operator == FUNC_NEQ_TYPED) *Result = Left != Right;
+        else return FALSE;
+        return TRUE;
+    }
+    if (!OptimizerScalarTypeIsInteger(TypeId))
+        return FALSE;
+    Width = OptimizerScalarTypeWidth(TypeId);
+    Left  = OptimizerNormalizeInteger(Left, TypeId);
+    Right = OptimizerNormalizeInteger(Right, TypeId);
+
+    switch (Operator)
+    {
+    case FUNC_ADD_TYPED: *Result = Left + Right; break;
+    case FUNC_SUB_TYPED: *Result = Left - Right; break;
+    case FUNC_MUL_TYPED: *Result = Left * Right; break;
+    case FUNC_DIV_TYPED:
+    case FUNC_MOD_TYPED:
+        if (!Right) return FALSE;
+        if (OptimizerScalarTypeIsSigned(TypeId))
+        {
+            SignedMinimum = Width == 64 ? 0x8000000000000000ULL : (1ULL << (Width - 1));
+            SignedMinimum = OptimizerNormalizeInteger(SignedMinimum, TypeId);
+            if (Left == SignedMinimum && Right == ~0ULL) return FALSE;
+            *Result = Operator == FUNC_DIV_TYPED ?
+                          (UINT64)((INT64)Left / (INT64)Right) :
+                          (UINT64)((INT64)Left % (INT64)Right);
+        }
+        else
+        {
+            *Result = Operator == FUNC_DIV_TYPED ? Left / Right : Left % Right;
+        }
+        break;
+    case FUNC_BITWISE_AND_TYPED: *Result = Left & Right; break;
+    case FUNC_BITWISE_OR_TYPED: *Result = Left | Right; break;
+    case FUNC_BITWISE_XOR_TYPED: *Result = Left ^ Right; break;
+    case FUNC_SHIFT_LEFT_TYPED:
+        if (Right >= Width) return FALSE;
+        *Result = Left << Right;
+        break;
+    case FUNC_SHIFT_RIGHT_TYPED:
+        if (Right >= Width) return FALSE;
+        *Result = OptimizerScalarTypeIsSigned(TypeId) ?
+                      (UINT64)((INT64)Left >> Right) : Left >> Right;
+        break;
+    case FUNC_GT_TYPED: *Result = OptimizerScalarTypeIsSigned(TypeId) ? (INT64)Left > (INT64)Right : Left > Right; return TRUE;
+    case FUNC_LT_TYPED: *Result = OptimizerScalarTypeIsSigned(TypeId) ? (INT64)Left < (INT64)Right : Left < Right; return TRUE;
+    case FUNC_EGT_TYPED: *Result = OptimizerScalarTypeIsSigned(TypeId) ? (INT64)Left >= (INT64)Right : Left >= Right; return TRUE;
+    case FUNC_ELT_TYPED: *Result = OptimizerScalarTypeIsSigned(TypeId) ? (INT64)Left <= (INT64)Right : Left <= Right; return TRUE;
+    case FUNC_EQUAL_TYPED: *Result = Left == Right; return TRUE;
+    case FUNC_NEQ_TYPED: *Result = Left != Right; return TRUE;
+    default: return FALSE;
+    }
+
+    *Result = OptimizerNormalizeInteger(*Result, TypeId);
+    return TRUE;
+}
+
+/**
+ * @brief Computes an untyped binary operator
+ *
+ * @param Operator
+ * @param SrcVal0
+ * @param SrcVal1
+ * @param Result
+ * @return BOOLEAN FALSE if the operator fails at runtime or its result
+ * depends on the processor
+ */
+static BOOLEAN
+OptimizerExecuteBinary(UINT64 Operator, UINT64 SrcVal0, UINT64 SrcVal1, PUINT64 Result)
+{
+    switch (Operator)
+    {
+    case FUNC_OR: *Result = SrcVal1 | SrcVal0; return TRUE;
+    case FUNC_XOR: *Result = SrcVal1 ^ SrcVal0; return TRUE;
+    case FUNC_AND: *Result = SrcVal1 & SrcVal0; return TRUE;
+    case FUNC_ADD: *Result = SrcVal1 + SrcVal0; return TRUE;
+    case FUNC_SUB: *Result = SrcVal1 - SrcVal0; return TRUE;
+    case FUNC_MUL: *Result = SrcVal1 * SrcVal0; return TRUE;
+    case FUNC_GT: *Result = (INT64)SrcVal1 > (INT64)SrcVal0; return TRUE;
+    case FUNC_LT: *Result = (INT64)SrcVal1 < (INT64)SrcVal0; return TRUE;
+    case FUNC_EGT: *Result = (INT64)SrcVal1 >= (INT64)SrcVal0; return TRUE;
+    case FUNC_ELT: *Result = (INT64)SrcVal1 <= (INT64)SrcVal0; return TRUE;
+    case FUNC_EQUAL: *Result = SrcVal1 == SrcVal0; return TRUE;
+    case FUNC_NEQ: *Result = SrcVal1 != SrcVal0; return TRUE;
+
+    case FUNC_ASR:
+    case FUNC_ASL:
+
+        //
+        // Shifting by 64 or more is left to the processor
+        //
+        if (SrcVal0 >= 64)
+            return FALSE;
+        *Result = Operator == FUNC_ASR ? SrcVal1 >> SrcVal0 : SrcVal1 << SrcVal0;
+        return TRUE;
+
+    case FUNC_DIV:
+    case FUNC_MOD:
+
+        if (SrcVal0 == 0)
+            return FALSE;
+        *Result = Operator == FUNC_DIV ? SrcVal1 / SrcVal0 : SrcVal1 % SrcVal0;
+        return TRUE;
+
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Checks whether the typed operands of an instruction are accepted by
+ * the evaluator (integer sources and an integer temp as the destination)
+ *
+ * @param Instruction
+ * @param Operands
+ * @return BOOLEAN
+ */
+static BOOLEAN
+OptimizerHasIntegerOperands(POPTIMIZER_INSTRUCTION Instruction, PSYMBOL Operands)
+{
+    UINT32 DestinationOffset = OptimizerGetDestinationOffset(Instruction->Kind);
+    UINT32 TypeOffset        = DestinationOffset + 1;
+
+    for (UINT32 Offset = 1; Offset < DestinationOffset; Offset++)
+    {
+        if (Operands[Offset].Len != SYMBOL_VALUE_KIND_INTEGER)
+            return FALSE;
+    }
+
+    for (UINT32 Offset = TypeOffset; Offset < Instruction->Length; Offset++)
+    {
+        if (!OptimizerIsConstant(&Operands[Offset]))
+            return FALSE;
+    }
+
+    return OptimizerIsIntegerTemp(&Operands[DestinationOffset]);
+}
+
+/**
+ * @brief Checks whether an instruction can be removed when its destination
+ * is not used (it has no side effects and never fails)
+ *
+ * @param Instruction
+ * @param Operands
+ * @return BOOLEAN
+ */
+static BOOLEAN
+OptimizerIsRemovable(POPTIMIZER_INSTRUCTION Instruction, PSYMBOL Operands)
+{
+    UINT64 Operator = Operands[0].Value;
+
+    for (UINT32 Offset = 1; Offset < Instruction->Length; Offset++)
+    {
+        if (OptimizerIsSourceOffset(Instruction->Kind, Offset) && !OptimizerIsPureOperand(&Operands[Offset]))
+            return FALSE;
+    }
+
+    switch (Instruction->Kind)
+    {
+    case OptimizerInstructionMove:
+    case OptimizerInstructionUnary:
+        return TRUE;
+
+    case OptimizerInstructionBinary:
+        if (Operator == FUNC_DIV || Operator == FUNC_MOD)
+            return OptimizerIsConstant(&Operands[1]) && Operands[1].Value != 0;
+        return TRUE;
+
+    case OptimizerInstructionTypedBinary:
+        return OptimizerHasIntegerOperands(Instruction, Operands) &&
+               OptimizerTypedBinaryCannotFail(Operator, &Operands[1], Operands[4].Value);
+
+    case OptimizerInstructionTypedUnary:
+        return OptimizerHasIntegerOperands(Instruction, Operands) &&
+               OptimizerScalarTypeIsIntegerOrPointer(Operands[3].Value);
+
+    case OptimizerInstructionCast:
+        return OptimizerHasIntegerOperands(Instruction, Operands) &&
+               OptimizerScalarTypeIsIntegerOrPointer(Operands[3].Value) &&
+               OptimizerScalarTypeIsIntegerOrPointer(Operands[4].Value);
+
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Computes the result of an instruction whose sources are constants
+ *
+ * @param Instruction
+ * @param Operands
+ * @param Result
+ * @return BOOLEAN FALSE if it cannot be computed at compile time
+ */
+static BOOLEAN
+OptimizerEvaluate(POPTIMIZER_INSTRUCTION Instruction, PSYMBOL Operands, PUINT64 Result)
+{
+    UINT64 Operator = Operands[0].Value;
+    UINT64 TypeId;
+
+    for (UINT32 Offset = 1; Offset < Instruction->Length; Offset++)
+    {
+        if (OptimizerIsSourceOffset(Instruction->Kind, Offset) && !OptimizerIsConstant(&Operands[Offset]))
+            return FALSE;
+    }
+
+    switch (Instruction->Kind)
+    {
+    case OptimizerInstructionUnary:
+
+        *Result = Operator == FUNC_NEG ? 0ULL - Operands[1].Value : ~Operands[1].Value;
+        return TRUE;
+
+    case OptimizerInstructionBinary:
+
+        return OptimizerExecuteBinary(Operator, Operands[1].Value, Operands[2].Value, Result);
+
+    case OptimizerInstructionTypedBinary:
+
+        return OptimizerHasIntegerOperands(Instruction, Operands) &&
+               OptimizerExecuteTypedBinary(Operator, Operands[1].Value, Operands[2].Value, Operands[4].Value, Result);
+
+    case OptimizerInstructionTypedUnary:
+
+        TypeId = Operands[3].Value;
+        if (!OptimizerHasIntegerOperands(Instruction, Operands) || !OptimizerScalarTypeIsIntegerOrPointer(TypeId))
+            return FALSE;
+
+        if (Operator == FUNC_LOGICAL_NOT_TYPED)
+            *Result = Operands[1].Value == 0;
+        else if (Operator == FUNC_NEG_TYPED)
+            *Result = OptimizerNormalizeInteger(0ULL - Operands[1].Value, TypeId);
+        else
+            *Result = OptimizerNormalizeInteger(~Operands[1].Value, TypeId);
+        return TRUE;
+
+    case OptimizerInstructionCast:
+
+        TypeId = Operands[4].Value;
+        if (!OptimizerHasIntegerOperands(Instruction, Operands) ||
+            !OptimizerScalarTypeIsIntegerOrPointer(Operands[3].Value) ||
+            !OptimizerScalarTypeIsIntegerOrPointer(TypeId))
+            return FALSE;
+
+        *Result = TypeId == SCRIPT_SCALAR_TYPE_POINTER ? Operands[1].Value : OptimizerNormalizeInteger(Operands[1].Value, TypeId);
+        return TRUE;
+
+    default:
+        return FALSE;
+    }
+}
+
+//////////////////////////////////////////////////
+//               Control flow                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Returns the first instruction which is not removed, starting from
+ * the given instruction
+ *
+ * @param Context
+ * @param Index
+ * @return UINT32 InstructionCount if it is the end of the code
+ */
+static UINT32
+OptimizerResolveInstruction(POPTIMIZER_CONTEXT Context, UINT32 Index)
+{
+    while (Index < Context->InstructionCount && Context->Instructions[Index].IsRemoved)
+    {
+        Index++;
+    }
+
+    return Index;
+}
+
+/**
+ * @brief Returns the instruction which is executed after the given instruction
+ * (if it does not jump)
+ *
+ * @param Context
+ * @param Index
+ * @return UINT32 InstructionCount if it is the end of the code
+ */
+static UINT32
+OptimizerNextInstruction(POPTIMIZER_CONTEXT Context, UINT32 Index)
+{
+    return OptimizerResolveInstruction(Context, Index + 1);
+}
+
+/**
+ * @brief Returns the successors of an instruction in the current function
+ * (calls continue with the next instruction)
+ *
+ * @param Context
+ * @param Index
+ * @param Successors
+ * @return UINT32 number of the successors
+ */
+static UINT32
+OptimizerGetSuccessors(POPTIMIZER_CONTEXT Context, UINT32 Index, UINT32 Successors[2])
+{
+    POPTIMIZER_INSTRUCTION Instruction = &Context->Instructions[Index];
+    UINT32                 Count       = 0;
+
+    switch (Instruction->Kind)
+    {
+    case OptimizerInstructionReturn:
+        break;
+
+    case OptimizerInstructionJump:
+        Successors[Count++] = OptimizerResolveInstruction(Context, Instruction->Target);
+        break;
+
+    case OptimizerInstructionConditionalJump:
+        Successors[Count++] = OptimizerResolveInstruction(Context, Instruction->Target);
+        Successors[Count++] = OptimizerNextInstruction(Context, Index);
+        break;
+
+    default:
+        Successors[Count++] = OptimizerNextInstruction(Context, Index);
+        break;
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Marks the instructions which are the target of a jump or a call
+ *
+ * @param Context
+ * @return VOID
+ */
+static VOID
+OptimizerFindLeaders(POPTIMIZER_CONTEXT Context)
+{
+    for (UINT32 i = 0; i < Context->InstructionCount; i++)
+    {
+        Context->Instructions[i].IsLeader = FALSE;
+    }
+
+    for (UINT32 i = 0; i < Context->InstructionCount; i++)
+    {
+        POPTIMIZER_INSTRUCTION Instruction = &Context->Instructions[i];
+        UINT32                 Target;
+
+        if (Instruction->IsRemoved ||
+            (Instruction->Kind != OptimizerInstructionJump && Instruction->Kind != OptimizerInstructionConditionalJump &&
+             Instruction->Kind != OptimizerInstructionCall))
+        {
+            continue;
+        }
+
+        Target = OptimizerResolveInstruction(Context, Instruction->Target);
+
+        if (Target < Context->InstructionCount)
+        {
+            Context->Instructions[Target].IsLeader = TRUE;
+        }
+    }
+}
+
+//////////////////////////////////////////////////
+//                  Passes                      //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Forgets the known values of all the temps
+ *
+ * @param Context
+ * @return VOID
+ */
+static VOID
+OptimizerForgetKnownValues(POPTIMIZER_CONTEXT Context)
+{
+    if (Context->CanOptimizeTemps)
+    {
+        memset(Context->IsValueKnown, 0, Context->TempCount * sizeof(BOOLEAN));
+    }
+}
+
+/**
+ * @brief Forgets the known value of a temp and the temps which are its copy
+ *
+ * @param Context
+ * @param Temp
+ * @return VOID
+ */
+static VOID
+OptimizerForgetKnownValue(POPTIMIZER_CONTEXT Context, UINT64 Temp)
+{
+    Context->IsValueKnown[Temp] = FALSE;
+
+    for (UINT32 i = 0; i < Context->TempCount; i++)
+    {
+        if (Context->IsValueKnown[i] && Context->KnownValues[i].Type == SYMBOL_TEMP_TYPE &&
+            Context->KnownValues[i].Value == Temp)
+        {
+            Context->IsValueKnown[i] = FALSE;
+        }
+    }
+}
+
+/**
+ * @brief Replaces the temps that are read by an instruction with the constant
+ * or the temp that they are a copy of
+ *
+ * @param Context
+ * @param Instruction
+ * @return BOOLEAN TRUE if an operand is replaced
+ */
+static BOOLEAN
+OptimizerPropagateCopies(POPTIMIZER_CONTEXT Context, POPTIMIZER_INSTRUCTION Instruction)
+{
+    PSYMBOL Operands = Context->CodeBuffer->Head + Instruction->Start;
+    BOOLEAN Changed  = FALSE;
+
+    for (UINT32 Offset = 1; Offset < Instruction->Length; Offset++)
+    {
+        PSYMBOL Operand = &Operands[Offset];
+
+        if (OptimizerIsSourceOffset(Instruction->Kind, Offset) && OptimizerIsIntegerTemp(Operand) &&
+            Context->IsValueKnown[Operand->Value])
+        {
+            *Operand = Context->KnownValues[Operand->Value];
+            Changed  = TRUE;
+        }
+    }
+
+    return Changed;
+}
+
+/**
+ * @brief Updates the known values of the temps after an instruction
+ *
+ * @param Context
+ * @param Instruction
+ * @return VOID
+ */
+static VOID
+OptimizerUpdateKnownValues(POPTIMIZER_CONTEXT Context, POPTIMIZER_INSTRUCTION Instruction)
+{
+    PSYMBOL Operands          = Context->CodeBuffer->Head + Instruction->Start;
+    UINT32  DestinationOffset = OptimizerGetDestinationOffset(Instruction->Kind);
+    PSYMBOL Source;
+    PSYMBOL Destination;
+
+    if (Instruction->Kind == OptimizerInstructionUnknown)
+    {
+        //
+        // Any temp operand of an unknown operator might be written
+        //
+        for (UINT32 Index = Instruction->Start + 1; Index < Instruction->Start + Instruction->Length;
+             Index = OptimizerNextOperand(Context->CodeBuffer, Index))
+        {
+            if (OptimizerGetSymbolType(Context->CodeBuffer->Head + Index) == SYMBOL_TEMP_TYPE)
+            {
+                OptimizerForgetKnownValue(Context, Context->CodeBuffer->Head[Index].Value);
+            }
+        }
+
+        return;
+    }
+
+    if (DestinationOffset == 0 || Operands[DestinationOffset].Type != SYMBOL_TEMP_TYPE)
+    {
+        return;
+    }
+
+    Destination = &Operands[DestinationOffset];
+    OptimizerForgetKnownValue(Context, Destination->Value);
+
+    if (Instruction->Kind != OptimizerInstructionMove || !OptimizerIsIntegerTemp(Destination))
+    {
+        return;
+    }
+
+    Source = &Operands[1];
+
+    if ((OptimizerIsConstant(Source) && Source->Len == SYMBOL_VALUE_KIND_INTEGER) ||
+        (OptimizerIsIntegerTemp(Source) && Source->Value != Destination->Value))
+    {
+        Context->KnownValues[Destination->Value]  = *Source;
+        Context->IsValueKnown[Destination->Value] = TRUE;
+    }
+}
+
+/**
+ * @brief Folds an instruction whose sources are constants
+ *
+ * @details Operators are replaced by a move of their result and conditional
+ * jumps are replaced by a jump or removed
+ *
+ * @param Context
+ * @param Instruction
+ * @return BOOLEAN TRUE if the instruction is folded
+ */
+static BOOLEAN
+OptimizerFoldInstruction(POPTIMIZER_CONTEXT Context, POPTIMIZER_INSTRUCTION Instruction)
+{
+    PSYMBOL Operands = Context->CodeBuffer->Head + Instruction->Start;
+    UINT64  Result;
+
+    switch (Instruction->Kind)
+    {
+    case OptimizerInstructionConditionalJump:
+
+        if (!OptimizerIsConstant(&Operands[2]))
+        {
+            return FALSE;
+        }
+
+        if ((Operands[2].Value == 0) == (Operands[0].Value == FUNC_JZ))
+        {
+            Operands[0].Value   = FUNC_JMP;
+            Instruction->Kind   = OptimizerInstructionJump;
+            Instruction->Length = OptimizerGetInstructionLength(OptimizerInstructionJump);
+        }
+        else
+        {
+            Instruction->IsRemoved = TRUE;
+        }
+
+        return TRUE;
+
+    case OptimizerInstructionUnary:
+    case OptimizerInstructionBinary:
+    case OptimizerInstructionTypedUnary:
+    case OptimizerInstructionTypedBinary:
+    case OptimizerInstructionCast:
+
+        if (!OptimizerEvaluate(Instruction, Operands, &Result))
+        {
+            return FALSE;
+        }
+
+        //
+        // MOV [Result] [Des]
+        //
+        Operands[2]       = Operands[OptimizerGetDestinationOffset(Instruction->Kind)];
+        Operands[1].Type  = SYMBOL_NUM_TYPE;
+        Operands[1].Len   = SYMBOL_VALUE_KIND_INTEGER;
+        Operands[1].Value = Result;
+        Operands[0].Value = FUNC_MOV;
+
+        Instruction->Kind   = OptimizerInstructionMove;
+        Instruction->Length = OptimizerGetInstructionLength(OptimizerInstructionMove);
+
+        return TRUE;
+
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Constant folding and (forward) copy propagation in each basic block
+ *
+ * @param Context
+ * @return BOOLEAN TRUE if the code is changed
+ */
+static BOOLEAN
+OptimizerFoldConstants(POPTIMIZER_CONTEXT Context)
+{
+    BOOLEAN Changed = FALSE;
+
+    OptimizerFindLeaders(Context);
+    OptimizerForgetKnownValues(Context);
+
+    for (UINT32 i = 0; i < Context->InstructionCount; i++)
+    {
+        POPTIMIZER_INSTRUCTION Instruction = &Context->Instructions[i];
+
+        if (Instruction->IsRemoved)
+        {
+            continue;
+        }
+
+        if (Instruction->IsLeader)
+        {
+            OptimizerForgetKnownValues(Context);
+        }
+
+        if (Context->CanOptimizeTemps)
+        {
+            Changed |= OptimizerPropagateCopies(Context, Instruction);
+        }
+
+        Changed |= OptimizerFoldInstruction(Context, Instruction);
+
+        if (Instruction->IsRemoved)
+        {
+            continue;
+        }
+
+        if (Instruction->Kind == OptimizerInstructionCall)
+        {
+            OptimizerForgetKnownValues(Context);
+        }
+        else if (Context->CanOptimizeTemps)
+        {
+            OptimizerUpdateKnownValues(Context, Instruction);
+        }
+    }
+
+    return Changed;
+}
+
+/**
+ * @brief Jump threading, jumps to other jumps are redirected to the final
+ * target and jumps to the next instruction are removed
+ *
+ * @param Context
+ * @return BOOLEAN TRUE if the code is changed
+ */
+static BOOLEAN
+OptimizerThreadJumps(POPTIMIZER_CONTEXT Context)
+{
+    BOOLEAN Changed = FALSE;
+
+    for (UINT32 i = 0; i < Context->InstructionCount; i++)
+    {
+        POPTIMIZER_INSTRUCTION Instruction = &Context->Instructions[i];
+        UINT32                 Target;
+        UINT32                 Hops = 0;
+
+        if (Instruction->IsRemoved ||
+            (Instruction->Kind != OptimizerInstructionJump && Instruction->Kind != OptimizerInstructionConditionalJump))
+        {
+            continue;
+        }
+
+        Target = OptimizerResolveInstruction(Context, Instruction->Target);
+
+        //
+        // The number of hops is limited because of the infinite loops
+        //
+        while (Target < Context->InstructionCount && Context->Instructions[Target].Kind == OptimizerInstructionJump &&
+               Target != i && Hops++ < Context->InstructionCount)
+        {
+            Target = OptimizerResolveInstruction(Context, Context->Instructions[Target].Target);
+        }
+
+        if (Target != OptimizerResolveInstruction(Context, Instruction->Target))
+        {
+            Instruction->Target = Target;
+            Changed             = TRUE;
+        }
+
+        if (Target == OptimizerNextInstruction(Context, i) &&
+            (Instruction->Kind == OptimizerInstructionJump ||
+             OptimizerIsPureOperand(Context->CodeBuffer->Head + Instruction->Start + 2)))
+        {
+            Instruction->IsRemoved = TRUE;
+            Changed                = TRUE;
+        }
+    }
+
+    return Changed;
+}
+
+/**
+ * @brief Removes the instructions which are not reachable from the entry
+ * point or from a called function
+ *
+ * @param Context
+ * @return BOOLEAN TRUE if the code is changed
+ */
+static BOOLEAN
+OptimizerRemoveUnreachableCode(POPTIMIZER_CONTEXT Context)
+{
+    BOOLEAN Changed       = FALSE;
+    UINT32  WorklistCount = 0;
+
+    memset(Context->IsReachable, 0, Context->InstructionCount * sizeof(BOOLEAN));
+
+    Context->Worklist[WorklistCount++] = OptimizerResolveInstruction(Context, 0);
+
+    while (WorklistCount)
+    {
+        UINT32 Index = Context->Worklist[--WorklistCount];
+        UINT32 Successors[2];
+        UINT32 SuccessorCount;
+
+        if (Index >= Context->InstructionCount || Context->IsReachable[Index])
+        {
+            continue;
+        }
+
+        Context->IsReachable[Index] = TRUE;
+
+        SuccessorCount = OptimizerGetSuccessors(Context, Index, Successors);
+
+        for (UINT32 i = 0; i < SuccessorCount; i++)
+        {
+            Context->Worklist[WorklistCount++] = Successors[i];
+        }
+
+        if (Context->Instructions[Index].Kind == OptimizerInstructionCall)
+        {
+            Context->Worklist[WorklistCount++] = OptimizerResolveInstruction(Context, Context->Instructions[Index].Target);
+        }
+    }
+
+    for (UINT32 i = 0; i < Context->InstructionCount; i++)
+    {
+        if (!Context->Instructions[i].IsRemoved && !Context->IsReachable[i])
+        {
+            Context->Instructions[i].IsRemoved = TRUE;
+            Changed                            = TRUE;
+        }
+    }
+
+    return Changed;
+}
+
+/**
+ * @brief Finds the temps that are read and written by an instruction
+ *
+ * @param Context
+ * @param Instruction
+ * @return VOID
+ */
+static VOID
+OptimizerGetUsesAndDefinitions(POPTIMIZER_CONTEXT Context, POPTIMIZER_INSTRUCTION Instruction)
+{
+    PSYMBOL Operands          = Context->CodeBuffer->Head + Instruction->Start;
+    UINT32  DestinationOffset = OptimizerGetDestinationOffset(Instruction->Kind);
+
+    memset(Context->Uses, 0, Context->BitmapSize * sizeof(UINT64));
+    memset(Context->Definitions, 0, Context->BitmapSize * sizeof(UINT64));
+
+    if (Instruction->Kind == OptimizerInstructionUnknown)
+    {
+        //
+        // Every temp operand of an unknown operator is assumed to be read
+        //
+        for (UINT32 Index = Instruction->Start + 1; Index < Instruction->Start + Instruction->Length;
+             Index = OptimizerNextOperand(Context->CodeBuffer, Index))
+        {
+            if (OptimizerGetSymbolType(Context->CodeBuffer->Head + Index) == SYMBOL_TEMP_TYPE)
+            {
+                UINT64 Temp = Context->CodeBuffer->Head[Index].Value;
+                Context->Uses[Temp / 64] |= 1ULL << (Temp % 64);
+            }
+        }
+
+        return;
+    }
+
+    for (UINT32 Offset = 1; Offset < Instruction->Length; Offset++)
+    {
+        if (Operands[Offset].Type != SYMBOL_TEMP_TYPE)
+        {
+            continue;
+        }
+
+        if (Offset == DestinationOffset)
+        {
+            Context->Definitions[Operands[Offset].Value / 64] |= 1ULL << (Operands[Offset].Value % 64);
+        }
+        else if (OptimizerIsSourceOffset(Instruction->Kind, Offset))
+        {
+            Context->Uses[Operands[Offset].Value / 64] |= 1ULL << (Operands[Offset].Value % 64);
+        }
+    }
+}
+
+/**
+ * @brief Computes the live temps after each instruction (backward data-flow
+ * analysis in each function)
+ *
+ * @details The frame of the temps is discarded when the function returns (or
+ * the script ends) and calls cannot access the temps of the caller, so no temp
+ * is live at the end of the functions and around the calls
+ *
+ * @param Context
+ * @return VOID
+ */
+static VOID
+OptimizerComputeLiveness(POPTIMIZER_CONTEXT Context)
+{
+    BOOLEAN Changed;
+    SIZE_T  Size = (SIZE_T)Context->InstructionCount * Context->BitmapSize * sizeof(UINT64);
+
+    memset(Context->LiveIn, 0, Size);
+    memset(Context->LiveOut, 0, Size);
+
+    do
+    {
+        Changed = FALSE;
+
+        for (UINT32 i = Context->InstructionCount; i-- > 0;)
+        {
+            UINT64 * LiveIn  = Context->LiveIn + (SIZE_T)i * Context->BitmapSize;
+            UINT64 * LiveOut = Context->LiveOut + (SIZE_T)i * Context->BitmapSize;
+            UINT32   Successors[2];
+            UINT32   SuccessorCount;
+
+            if (Context->Instructions[i].IsRemoved)
+            {
+                continue;
+            }
+
+            SuccessorCount = OptimizerGetSuccessors(Context, i, Successors);
+            OptimizerGetUsesAndDefinitions(Context, &Context->Instructions[i]);
+
+            for (UINT32 Word = 0; Word < Context->BitmapSize; Word++)
+            {
+                UINT64 Out = 0;
+                UINT64 In;
+
+                for (UINT32 j = 0; j < SuccessorCount; j++)
+                {
+                    if (Successors[j] < Context->InstructionCount)
+                    {
+                        Out |= Context->LiveIn[(SIZE_T)Successors[j] * Context->BitmapSize + Word];
+                    }
+                }
+
+                In = Context->Uses[Word] | (Out & ~Context->Definitions[Word]);
+
+                if (Out != LiveOut[Word] || In != LiveIn[Word])
+                {
+                    LiveOut[Word] = Out;
+                    LiveIn[Word]  = In;
+                    Changed       = TRUE;
+                }
+            }
+        }
+    } while (Changed);
+}
+
+/**
+ * @brief Checks whether a temp is live after an instruction
+ *
+ * @param Context
+ * @param Index
+ * @param Temp
+ * @return BOOLEAN
+ */
+static BOOLEAN
+OptimizerIsLiveOut(POPTIMIZER_CONTEXT Context, UINT32 Index, UINT64 Temp)
+{
+    return (Context->LiveOut[(SIZE_T)Index * Context->BitmapSize + Temp / 64] >> (Temp % 64)) & 1;
+}
+
+/**
+ * @brief Checks whether the result of an instruction can be written to
+ * the destination of a move instead of its temp
+ *
+ * @param Instruction
+ * @param Destination
+ * @return BOOLEAN
+ */
+static BOOLEAN
+OptimizerCanWriteTo(POPTIMIZER_INSTRUCTION Instruction, PSYMBOL Destination)
+{
+    switch (Instruction->Kind)
+    {
+    case OptimizerInstructionMove:
+    case OptimizerInstructionUnary:
+    case OptimizerInstructionBinary:
+        return Destination->Type == SYMBOL_TEMP_TYPE || Destination->Type == SYMBOL_GLOBAL_ID_TYPE ||
+               Destination->Type == SYMBOL_PERCPU_ID_TYPE || Destination->Type == SYMBOL_RETURN_VALUE_TYPE;
+
+    default:
+
+        //
+        // Typed operators only write integer temps
+        //
+        return OptimizerIsIntegerTemp(Destination);
+    }
+}
+
+/**
+ * @brief Dead-code elimination and (backward) copy propagation
+ *
+ * @details The instructions whose result is not used are removed and
+ * "OP ... -> Temp; MOV Temp -> X" becomes "OP ... -> X" if Temp is not used
+ * after the move
+ *
+ * @param Context
+ * @return BOOLEAN TRUE if the code is changed
+ */
+static BOOLEAN
+OptimizerRemoveDeadCode(POPTIMIZER_CONTEXT Context)
+{
+    BOOLEAN Changed = FALSE;
+
+    OptimizerComputeLiveness(Context);
+    OptimizerFindLeaders(Context);
+
+    for (UINT32 i = 0; i < Context->InstructionCount; i++)
+    {
+        POPTIMIZER_INSTRUCTION Instruction       = &Context->Instructions[i];
+        PSYMBOL                Operands          = Context->CodeBuffer->Head + Instruction->Start;
+        UINT32                 DestinationOffset = OptimizerGetDestinationOffset(Instruction->Kind);
+        PSYMBOL                Destination;
+        UINT32                 Next;
+
+        if (Instruction->IsRemoved || DestinationOffset == 0 || Operands[DestinationOffset].Type != SYMBOL_TEMP_TYPE)
+        {
+            continue;
+        }
+
+        Destination = &Operands[DestinationOffset];
+
+        if (!OptimizerIsLiveOut(Context, i, Destination->Value))
+        {
+            if (OptimizerIsRemovable(Instruction, Operands))
+            {
+                Instruction->IsRemoved = TRUE;
+                Changed                = TRUE;
+            }
+
+            continue;
+        }
+
+        //
+        // The move must not be the target of a jump, otherwise the other
+        // paths to it would skip the instruction
+        //
+        Next = OptimizerNextInstruction(Context, i);
+
+        if (Next < Context->InstructionCount && !Context->Instructions[Next].IsLeader &&
+            Context->Instructions[Next].Kind == OptimizerInstructionMove && OptimizerIsIntegerTemp(Destination))
+        {
+            PSYMBOL Move = Context->CodeBuffer->Head + Context->Instructions[Next].Start;
+
+            if (OptimizerIsIntegerTemp(&Move[1]) && Move[1].Value == Destination->Value &&
+                !OptimizerIsLiveOut(Context, Next, Destination->Value) &&
+                OptimizerCanWriteTo(Instruction, &Move[2]))
+            {
+                *Destination                        = Move[2];
+                Context->Instructions[Next].IsRemoved = TRUE;
+                Changed                             = TRUE;
+            }
+        }
+    }
+
+    return Changed;
+}
+
+/**
+ * @brief Removes the removed instructions from the code buffer and relocates
+ * the targets of the jumps and the calls
+ *
+ * @param Context
+ * @return VOID
+ */
+static VOID
+OptimizerCompact(POPTIMIZER_CONTEXT Context)
+{
+    PSYMBOL_BUFFER CodeBuffer = Context->CodeBuffer;
+    UINT32         Pointer    = 0;
+
+    //
+    // Removed instructions are relocated to the next instruction
+    //
+    for (UINT32 i = 0; i < Context->InstructionCount; i++)
+    {
+        Context->NewStarts[i] = Pointer;
+
+        if (!Context->Instructions[i].IsRemoved)
+        {
+            Pointer += Context->Instructions[i].Length;
+        }
+    }
+
+    Context->NewStarts[Context->InstructionCount] = Pointer;
+
+    for (UINT32 i = 0; i < Context->InstructionCount; i++)
+    {
+        POPTIMIZER_INSTRUCTION Instruction = &Context->Instructions[i];
+
+        if (Instruction->IsRemoved)
+        {
+            continue;
+        }
+
+        memmove(CodeBuffer->Head + Context->NewStarts[i], CodeBuffer->Head + Instruction->Start, Instruction->Length * sizeof(SYMBOL));
+
+        if (CodeBuffer->Lines != NULL)
+        {
+            memmove(CodeBuffer->Lines + Context->NewStarts[i], CodeBuffer->Lines + Instruction->Start, Instruction->Length * sizeof(unsigned int));
+        }
+
+        if (Instruction->Kind == OptimizerInstructionJump || Instruction->Kind == OptimizerInstructionConditionalJump ||
+            Instruction->Kind == OptimizerInstructionCall)
+        {
+            CodeBuffer->Head[Context->NewStarts[i] + 1].Value = Context->NewStarts[Instruction->Target];
+        }
+    }
+
+    memset(CodeBuffer->Head + Pointer, 0, (CodeBuffer->Pointer - Pointer) * sizeof(SYMBOL));
+    CodeBuffer->Pointer = Pointer;
+}
+
+/**
+ * @brief Splits the code buffer into instructions and allocates the
+ * state of the optimizer
+ *
+ * @param Context
+ * @return BOOLEAN FALSE if the code cannot be optimized
+ */
+static BOOLEAN
+OptimizerDecode(POPTIMIZER_CONTEXT Context)
+{
+    PSYMBOL_BUFFER CodeBuffer = Context->CodeBuffer;
+    UINT32 *       InstructionOfSymbol;
+    UINT32         Index  = 0;
+    UINT32         Count  = 0;
+    BOOLEAN        Result = TRUE;
+
+    Context->CanOptimizeTemps = TRUE;
+    Context->Instructions     = (POPTIMIZER_INSTRUCTION)calloc(CodeBuffer->Pointer + 1, sizeof(OPTIMIZER_INSTRUCTION));
+    InstructionOfSymbol       = (UINT32 *)malloc((CodeBuffer->Pointer + 1) * sizeof(UINT32));
+
+    if (!Context->Instructions || !InstructionOfSymbol)
+    {
+        free(InstructionOfSymbol);
+        return FALSE;
+    }
+
+    memset(InstructionOfSymbol, 0xff, (CodeBuffer->Pointer + 1) * sizeof(UINT32));
+
+    while (Index < CodeBuffer->Pointer)
+    {
+        POPTIMIZER_INSTRUCTION Instruction = &Context->Instructions[Count];
+        PSYMBOL                Operator    = CodeBuffer->Head + Index;
+        UINT32                 Next        = Index + 1;
+
+        if (Operator->Type != SYMBOL_SEMANTIC_RULE_TYPE || OptimizerIsUnsupportedOperator(Operator->Value))
+        {
+            Result = FALSE;
+            break;
+        }
+
+        if (OptimizerMayAccessTempsByAddress(Operator->Value))
+        {
+            Context->CanOptimizeTemps = FALSE;
+        }
+
+        while (Next < CodeBuffer->Pointer && CodeBuffer->Head[Next].Type != SYMBOL_SEMANTIC_RULE_TYPE)
+        {
+            PSYMBOL Operand = CodeBuffer->Head + Next;
+
+            switch (OptimizerGetSymbolType(Operand))
+            {
+            case SYMBOL_TEMP_TYPE:
+
+                if (Operand->Value >= OPTIMIZER_MAX_TEMP_COUNT)
+                    Context->CanOptimizeTemps = FALSE;
+                else if (Operand->Value >= Context->TempCount)
+                    Context->TempCount = (UINT32)Operand->Value + 1;
+                break;
+
+            case SYMBOL_LOCAL_ID_TYPE:
+            case SYMBOL_REFERENCE_LOCAL_ID_TYPE:
+            case SYMBOL_REFERENCE_TEMP_TYPE:
+            case SYMBOL_DEREFERENCE_LOCAL_ID_TYPE:
+            case SYMBOL_DEREFERENCE_TEMP_TYPE:
+
+                Context->CanOptimizeTemps = FALSE;
+                break;
+            }
+
+            Next = OptimizerNextOperand(CodeBuffer, Next);
+        }
+
+        Instruction->Start  = Index;
+        Instruction->Length = Next - Index;
+        Instruction->Kind   = OptimizerGetInstructionKind(Operator->Value);
+
+        if (Next > CodeBuffer->Pointer ||
+            (Instruction->Kind != OptimizerInstructionUnknown &&
+             Instruction->Length != OptimizerGetInstructionLength(Instruction->Kind)))
+        {
+            Result = FALSE;
+            break;
+        }
+
+        InstructionOfSymbol[Index] = Count++;
+        Index                      = Next;
+    }
+
+    InstructionOfSymbol[CodeBuffer->Pointer] = Count;
+    Context->InstructionCount                = Count;
+
+    //
+    // The targets of the jumps and the calls must be constants which point
+    // to an instruction (or the end of the code)
+    //
+    for (UINT32 i = 0; Result && i < Count; i++)
+    {
+        POPTIMIZER_INSTRUCTION Instruction = &Context->Instructions[i];
+        PSYMBOL                Target      = CodeBuffer->Head + Instruction->Start + 1;
+
+        if (Instruction->Kind != OptimizerInstructionJump && Instruction->Kind != OptimizerInstructionConditionalJump &&
+            Instruction->Kind != OptimizerInstructionCall)
+        {
+            continue;
+        }
+
+        if (!OptimizerIsConstant(Target) || Target->Value > CodeBuffer->Pointer ||
+            InstructionOfSymbol[Target->Value] == 0xffffffff)
+        {
+            Result = FALSE;
+            break;
+        }
+
+        Instruction->Target = InstructionOfSymbol[Target->Value];
+    }
+
+    free(InstructionOfSymbol);
+
+    if (!Result || Count == 0)
+    {
+        return FALSE;
+    }
+
+    if (Context->TempCount == 0)
+    {
+        Context->CanOptimizeTemps = FALSE;
+    }
+
+    Context->IsReachable = (BOOLEAN *)calloc(Count, sizeof(BOOLEAN));
+    Context->Worklist    = (UINT32 *)calloc((SIZE_T)Count * 2 + 1, sizeof(UINT32));
+    Context->NewStarts   = (UINT32 *)calloc((SIZE_T)Count + 1, sizeof(UINT32));
+
+    if (!Context->IsReachable || !Context->Worklist || !Context->NewStarts)
+    {
+        return FALSE;
+    }
+
+    if (Context->CanOptimizeTemps)
+    {
+        Context->BitmapSize   = (Context->TempCount + 63) / 64;
+        Context->LiveIn       = (UINT64 *)calloc((SIZE_T)Count * Context->BitmapSize, sizeof(UINT64));
+        Context->LiveOut      = (UINT64 *)calloc((SIZE_T)Count * Context->BitmapSize, sizeof(UINT64));
+        Context->Uses         = (UINT64 *)calloc(Context->BitmapSize, sizeof(UINT64));
+        Context->Definitions  = (UINT64 *)calloc(Context->BitmapSize, sizeof(UINT64));
+        Context->KnownValues  = (PSYMBOL)calloc(Context->TempCount, sizeof(SYMBOL));
+        Context->IsValueKnown = (BOOLEAN *)calloc(Context->TempCount, sizeof(BOOLEAN));
+
+        if (!Context->LiveIn || !Context->LiveOut || !Context->Uses || !Context->Definitions ||
+            !Context->KnownValues || !Context->IsValueKnown)
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Optimizes the generated code of a script (-O1)
+ *
+ * @details The passes are constant folding, copy propagation, dead-code
+ * elimination and jump threading. The code is left as it is if it has
+ * anything that the optimizer does not understand (e.g., computed jumps)
+ *
+ * @param CodeBuffer
+ * @return BOOLEAN TRUE if the code is optimized
+ */
+BOOLEAN
+OptimizeSymbolBuffer(PSYMBOL_BUFFER CodeBuffer)
+{
+    OPTIMIZER_CONTEXT Context = {0};
+    BOOLEAN           Result  = FALSE;
+
+    Context.CodeBuffer = CodeBuffer;
+
+    if (OptimizerDecode(&Context))
+    {
+        for (UINT32 Round = 0; Round < OPTIMIZER_MAX_ROUNDS; Round++)
+        {
+            BOOLEAN Changed = FALSE;
+
+            Changed |= OptimizerFoldConstants(&Context);
+            Changed |= OptimizerThreadJumps(&Context);
+            Changed |= OptimizerRemoveUnreachableCode(&Context);
+
+            if (Context.CanOptimizeTemps)
+            {
+                Changed |= OptimizerRemoveDeadCode(&Context);
+            }
+
+            if (!Changed)
+            {
+                break;
+            }
+        }
+
+        OptimizerCompact(&Context);
+        Result = TRUE;
+    }
+
+    free(Context.Instructions);
+    free(Context.IsReachable);
+    free(Context.Worklist);
+    free(Context.NewStarts);
+    free(Context.LiveIn);
+    free(Context.LiveOut);
+    free(Context.Uses);
+    free(Context.Definitions);
+    free(Context.KnownValues);
+    free(Context.IsValueKnown);
+
+    return Result;
+}
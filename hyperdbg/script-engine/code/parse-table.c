@@ -17,6 +17,9 @@ const struct _SCRIPT_ENGINE_TOKEN Lhs[RULES_COUNT]=
 	{NON_TERMINAL, "STATEMENT"},
 	{NON_TERMINAL, "STATEMENT"},
 	{NON_TERMINAL, "STATEMENT"},
+	{NON_TERMINAL, "STATEMENT"},
+	{NON_TERMINAL, "PERCPU_DECLARATION_LIST"},
+	{NON_TERMINAL, "PERCPU_DECLARATION_LIST"},
 	{NON_TERMINAL, "S2"},
 	{NON_TERMINAL, "S2"},
 	{NON_TERMINAL, "S2"},
@@ -189,6 +192,12 @@ const struct _SCRIPT_ENGINE_TOKEN Lhs[RULES_COUNT]=
 	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
 	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
 	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
 	{NON_TERMINAL, "VA"},
 	{NON_TERMINAL, "VA"},
 	{NON_TERMINAL, "IF_STATEMENT"},
@@ -375,6 +384,9 @@ const struct _SCRIPT_ENGINE_TOKEN Rhs[RULES_COUNT][MAX_RHS_LEN]=
 	{{NON_TERMINAL, "STRUCT_DECLARATION"}},
 	{{NON_TERMINAL, "TYPEDEF_DECLARATION"}},
 	{{KEYWORD, "#include"},{NON_TERMINAL, "STRING"},{SEMANTIC_RULE, "@INCLUDE"},{SPECIAL_TOKEN, ";"}},
+	{{KEYWORD, "percpu"},{SEMANTIC_RULE, "@PUSH"},{GLOBAL_ID, "_global_id"},{SEMANTIC_RULE, "@PERCPU_DECLARATION"},{NON_TERMINAL, "PERCPU_DECLARATION_LIST"},{SPECIAL_TOKEN, ";"}},
+	{{SPECIAL_TOKEN, ","},{SEMANTIC_RULE, "@PUSH"},{GLOBAL_ID, "_global_id"},{SEMANTIC_RULE, "@PERCPU_DECLARATION"},{NON_TERMINAL, "PERCPU_DECLARATION_LIST"}},
+	{{EPSILON, "eps"}},
 	{{NON_TERMINAL, "STATEMENT2"},{NON_TERMINAL, "S2"}},
 	{{SPECIAL_TOKEN, "{"},{NON_TERMINAL, "STATEMENT2"},{NON_TERMINAL, "S2"},{SPECIAL_TOKEN, "}"}},
 	{{EPSILON, "eps"}},
@@ -485,7 +497,9 @@ const struct _SCRIPT_ENGINE_TOKEN Rhs[RULES_COUNT][MAX_RHS_LEN]=
 	{{KEYWORD, "spinlock_unlock"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@SPINLOCK_UNLOCK"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "event_sc"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@EVENT_SC"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "microsleep"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MICROSLEEP"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "agg_count"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@AGG_COUNT"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "printf"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "STRING"},{SEMANTIC_RULE, "@VARGSTART"},{NON_TERMINAL, "VA"},{SEMANTIC_RULE, "@PRINTF"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "emit"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@VARGSTART"},{NON_TERMINAL, "EXPRESSION"},{NON_TERMINAL, "VA"},{SEMANTIC_RULE, "@EMIT"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "pause"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@PAUSE"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "flush"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@FLUSH"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "event_trace_step"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@EVENT_TRACE_STEP"},{SPECIAL_TOKEN, ")"}},
@@ -502,6 +516,10 @@ const struct _SCRIPT_ENGINE_TOKEN Rhs[RULES_COUNT][MAX_RHS_LEN]=
 	{{KEYWORD, "lbr_check"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@LBR_CHECK"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
 	{{KEYWORD, "spinlock_lock_custom_wait"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@SPINLOCK_LOCK_CUSTOM_WAIT"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "event_inject"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@EVENT_INJECT"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "agg_sum"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@AGG_SUM"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "agg_min"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@AGG_MIN"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "agg_max"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@AGG_MAX"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "agg_hist"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@AGG_HIST"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "poi"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@POI"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
 	{{KEYWORD, "db"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@DB"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
 	{{KEYWORD, "dd"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@DD"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
@@ -733,6 +751,9 @@ const unsigned int RhsSize[RULES_COUNT]=
 1,
 1,
 4,
+6,
+5,
+1,
 2,
 4,
 1,
@@ -843,6 +864,8 @@ const unsigned int RhsSize[RULES_COUNT]=
 5,
 5,
 5,
+5,
+7,
 7,
 4,
 4,
@@ -860,6 +883,10 @@ const unsigned int RhsSize[RULES_COUNT]=
 5,
 7,
 7,
+7,
+7,
+7,
+7,
 6,
 6,
 6,
@@ -1123,6 +1150,7 @@ const char* NoneTerminalMap[NONETERMINAL_COUNT]=
 "MULTIPLE_ASSIGNMENT",
 "MULTIPLE_ASSIGNMENT2",
 "PAREN_EXPRESSION",
+"PERCPU_DECLARATION_LIST",
 "RETURN",
 "S",
 "S2",
@@ -1215,6 +1243,11 @@ const char* TerminalMap[TERMINAL_COUNT]=
 "_script_variable_type",
 "_string",
 "_wstring",
+"agg_count",
+"agg_hist",
+"agg_max",
+"agg_min",
+"agg_sum",
 "break",
 "check_address",
 "continue",
@@ -1236,6 +1269,7 @@ const char* TerminalMap[TERMINAL_COUNT]=
 "ed_pa",
 "else",
 "elsif",
+"emit",
 "eq",
 "eq_pa",
 "event_clear",
@@ -1275,6 +1309,7 @@ const char* TerminalMap[TERMINAL_COUNT]=
 "neg",
 "not",
 "pause",
+"percpu",
 "physical_to_virtual",
 "poi",
 "poi_pa",
@@ -1307,97 +1342,98 @@ const char* TerminalMap[TERMINAL_COUNT]=
 };
 const int ParseTable[NONETERMINAL_COUNT][TERMINAL_COUNT]= 
 {
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,43		,2147483648		,2147483648		,42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,325		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,327		,2147483648		,327		,2147483648		,2147483648		,327		,327		,2147483648		,327		,2147483648		,2147483648		,327		,327		,2147483648		,2147483648		,2147483648		,2147483648		,327		,2147483648		,327		,327		,2147483648		,327		,327		,2147483648		,326		,327		,327		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,327		,2147483648		,327		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,324		,2147483648		,324		,2147483648		,2147483648		,324		,324		,2147483648		,324		,2147483648		,2147483648		,324		,324		,2147483648		,2147483648		,2147483648		,2147483648		,324		,2147483648		,324		,324		,2147483648		,324		,324		,2147483648		,323		,324		,324		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,324		,2147483648		,324		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,100		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,102		,2147483648		,102		,2147483648		,2147483648		,2147483648		,102		,2147483648		,102		,102		,2147483648		,2147483648		,102		,102		,2147483648		,2147483648		,2147483648		,102		,2147483648		,2147483648		,102		,102		,2147483648		,102		,101		,2147483648		,2147483648		,102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,102		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,99		,2147483648		,99		,2147483648		,2147483648		,2147483648		,99		,2147483648		,99		,99		,2147483648		,2147483648		,99		,99		,2147483648		,2147483648		,2147483648		,99		,2147483648		,2147483648		,99		,99		,2147483648		,99		,98		,2147483648		,2147483648		,99		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,99		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,44		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,93		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,94		,94		,2147483648		,94		,2147483648		,2147483648		,94		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,110		,2147483648		,113		,2147483648		,2147483648		,2147483648		,108		,2147483648		,103		,106		,2147483648		,2147483648		,104		,107		,2147483648		,2147483648		,2147483648		,109		,2147483648		,2147483648		,111		,105		,2147483648		,112		,2147483648		,2147483648		,2147483648		,114		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,115		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,218		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,218		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,152		,2147483648		,144		,164		,145		,165		,153		,154		,155		,2147483648		,147		,167		,146		,166		,170		,174		,169		,175		,2147483648		,2147483648		,171		,176		,120		,119		,118		,142		,184		,124		,132		,133		,129		,130		,131		,128		,2147483648		,117		,149		,162		,2147483648		,177		,157		,172		,173		,156		,140		,137		,138		,139		,168		,136		,150		,163		,180		,185		,186		,125		,148		,151		,127		,159		,143		,161		,116		,126		,134		,135		,158		,2147483648		,2147483648		,122		,141		,123		,179		,178		,181		,2147483648		,121		,2147483648		,160		,183		,182		,187		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,302		,301		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,300		,299		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,298		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,331		,329		,332		,2147483648		,2147483648		,2147483648		,328		,2147483648		,330		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,198		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,225		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,225		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,225		,2147483648		,2147483648		,225		,2147483648		,2147483648		,2147483648		,225		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,224		,2147483648		,225		,2147483648	},
-	{226		,2147483648		,2147483648		,2147483648		,2147483648		,226		,2147483648		,226		,2147483648		,226		,2147483648		,226		,2147483648		,2147483648		,2147483648		,226		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,226		,226		,226		,226		,226		,226		,226		,226		,226		,226		,226		,2147483648		,2147483648		,2147483648		,2147483648		,226		,2147483648		,226		,226		,226		,226		,226		,226		,226		,2147483648		,226		,226		,226		,226		,226		,226		,226		,226		,2147483648		,2147483648		,226		,226		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,226		,226		,2147483648		,226		,226		,226		,226		,226		,226		,226		,226		,226		,226		,226		,226		,226		,226		,2147483648		,2147483648		,2147483648		,226		,226		,2147483648		,226		,226		,226		,2147483648		,2147483648		,226		,226		,226		,2147483648		,226		,2147483648		,2147483648		,2147483648		,226		,226		,226		,2147483648		,2147483648		,2147483648		,226		,226		,226		,226		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,226	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,228		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,228		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,228		,2147483648		,2147483648		,228		,2147483648		,2147483648		,2147483648		,228		,227		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,228		,2147483648		,228		,2147483648	},
-	{338		,2147483648		,2147483648		,2147483648		,2147483648		,340		,2147483648		,294		,2147483648		,339		,2147483648		,336		,2147483648		,2147483648		,2147483648		,335		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,333		,333		,333		,322		,318		,318		,333		,318		,333		,334		,318		,2147483648		,2147483648		,2147483648		,2147483648		,261		,2147483648		,253		,273		,254		,274		,262		,263		,264		,2147483648		,256		,276		,255		,275		,279		,283		,278		,284		,2147483648		,2147483648		,280		,285		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,258		,271		,2147483648		,286		,266		,281		,282		,265		,251		,248		,249		,250		,277		,247		,259		,272		,289		,2147483648		,2147483648		,2147483648		,257		,260		,2147483648		,268		,252		,270		,2147483648		,2147483648		,245		,246		,267		,2147483648		,303		,2147483648		,2147483648		,2147483648		,288		,287		,290		,2147483648		,2147483648		,2147483648		,269		,292		,291		,293		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,337	},
-	{229		,2147483648		,2147483648		,2147483648		,2147483648		,229		,2147483648		,229		,2147483648		,229		,2147483648		,229		,2147483648		,2147483648		,2147483648		,229		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,229		,229		,229		,229		,229		,229		,229		,229		,229		,229		,229		,2147483648		,2147483648		,2147483648		,2147483648		,229		,2147483648		,229		,229		,229		,229		,229		,229		,229		,2147483648		,229		,229		,229		,229		,229		,229		,229		,229		,2147483648		,2147483648		,229		,229		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,229		,229		,2147483648		,229		,229		,229		,229		,229		,229		,229		,229		,229		,229		,229		,229		,229		,229		,2147483648		,2147483648		,2147483648		,229		,229		,2147483648		,229		,229		,229		,2147483648		,2147483648		,229		,229		,229		,2147483648		,229		,2147483648		,2147483648		,2147483648		,229		,229		,229		,2147483648		,2147483648		,2147483648		,229		,229		,229		,229		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,229	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,230		,2147483648		,2147483648		,231		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,231		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,231		,2147483648		,2147483648		,231		,2147483648		,2147483648		,2147483648		,231		,231		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,231		,2147483648		,231		,2147483648	},
-	{232		,2147483648		,2147483648		,2147483648		,2147483648		,232		,2147483648		,232		,2147483648		,232		,2147483648		,232		,2147483648		,2147483648		,2147483648		,232		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,232		,232		,232		,232		,232		,232		,232		,232		,232		,232		,232		,2147483648		,2147483648		,2147483648		,2147483648		,232		,2147483648		,232		,232		,232		,232		,232		,232		,232		,2147483648		,232		,232		,232		,232		,232		,232		,232		,232		,2147483648		,2147483648		,232		,232		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,232		,232		,2147483648		,232		,232		,232		,232		,232		,232		,232		,232		,232		,232		,232		,232		,232		,232		,2147483648		,2147483648		,2147483648		,232		,232		,2147483648		,232		,232		,232		,2147483648		,2147483648		,232		,232		,232		,2147483648		,232		,2147483648		,2147483648		,2147483648		,232		,232		,232		,2147483648		,2147483648		,2147483648		,232		,232		,232		,232		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,232	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,235		,2147483648		,2147483648		,235		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,235		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,235		,234		,2147483648		,235		,233		,2147483648		,2147483648		,235		,235		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,235		,2147483648		,235		,2147483648	},
-	{236		,2147483648		,2147483648		,2147483648		,2147483648		,236		,2147483648		,236		,2147483648		,236		,2147483648		,236		,2147483648		,2147483648		,2147483648		,236		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,236		,236		,236		,236		,236		,236		,236		,236		,236		,236		,236		,2147483648		,2147483648		,2147483648		,2147483648		,236		,2147483648		,236		,236		,236		,236		,236		,236		,236		,2147483648		,236		,236		,236		,236		,236		,236		,236		,236		,2147483648		,2147483648		,236		,236		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,236		,236		,2147483648		,236		,236		,236		,236		,236		,236		,236		,236		,236		,236		,236		,236		,236		,236		,2147483648		,2147483648		,2147483648		,236		,236		,2147483648		,236		,236		,236		,2147483648		,2147483648		,236		,236		,236		,2147483648		,236		,2147483648		,2147483648		,2147483648		,236		,236		,236		,2147483648		,2147483648		,2147483648		,236		,236		,236		,236		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,236	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,239		,2147483648		,2147483648		,239		,2147483648		,2147483648		,237		,2147483648		,2147483648		,239		,238		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,239		,239		,2147483648		,239		,239		,2147483648		,2147483648		,239		,239		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,239		,2147483648		,239		,2147483648	},
-	{240		,2147483648		,2147483648		,2147483648		,2147483648		,240		,2147483648		,240		,2147483648		,240		,2147483648		,240		,2147483648		,2147483648		,2147483648		,240		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,240		,240		,240		,240		,240		,240		,240		,240		,240		,240		,240		,2147483648		,2147483648		,2147483648		,2147483648		,240		,2147483648		,240		,240		,240		,240		,240		,240		,240		,2147483648		,240		,240		,240		,240		,240		,240		,240		,240		,2147483648		,2147483648		,240		,240		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,240		,240		,2147483648		,240		,240		,240		,240		,240		,240		,240		,240		,240		,240		,240		,240		,240		,240		,2147483648		,2147483648		,2147483648		,240		,240		,2147483648		,240		,240		,240		,2147483648		,2147483648		,240		,240		,240		,2147483648		,240		,2147483648		,2147483648		,2147483648		,240		,240		,240		,2147483648		,2147483648		,2147483648		,240		,240		,240		,240		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,240	},
-	{2147483648		,2147483648		,2147483648		,242		,2147483648		,244		,2147483648		,2147483648		,244		,243		,2147483648		,244		,2147483648		,2147483648		,244		,244		,2147483648		,2147483648		,2147483648		,2147483648		,241		,2147483648		,244		,244		,2147483648		,244		,244		,2147483648		,2147483648		,244		,244		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,244		,2147483648		,244		,2147483648	},
-	{2147483648		,195		,195		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,195		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,195		,195		,195		,2147483648		,195		,2147483648		,2147483648		,195		,195		,2147483648		,2147483648		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,194		,2147483648		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,2147483648		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,195		,2147483648		,2147483648		,195		,2147483648	},
-	{2147483648		,192		,192		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,192		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,192		,192		,192		,2147483648		,192		,2147483648		,2147483648		,192		,192		,2147483648		,2147483648		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,191		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,2147483648		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,192		,2147483648		,2147483648		,192		,2147483648	},
-	{2147483648		,193		,193		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,193		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,193		,193		,193		,2147483648		,193		,2147483648		,2147483648		,193		,193		,2147483648		,2147483648		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,2147483648		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,2147483648		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,193		,2147483648		,2147483648		,193		,2147483648	},
-	{2147483648		,196		,196		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,196		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,196		,196		,196		,2147483648		,196		,2147483648		,2147483648		,196		,196		,2147483648		,2147483648		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,2147483648		,2147483648		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,2147483648		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,196		,2147483648		,2147483648		,196		,2147483648	},
-	{223		,2147483648		,2147483648		,2147483648		,2147483648		,223		,2147483648		,223		,2147483648		,223		,2147483648		,223		,2147483648		,2147483648		,2147483648		,223		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,223		,223		,223		,223		,223		,223		,223		,223		,223		,223		,223		,2147483648		,2147483648		,2147483648		,2147483648		,223		,2147483648		,223		,223		,223		,223		,223		,223		,223		,2147483648		,223		,223		,223		,223		,223		,223		,223		,223		,2147483648		,2147483648		,223		,223		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,223		,223		,2147483648		,223		,223		,223		,223		,223		,223		,223		,223		,223		,223		,223		,223		,223		,223		,2147483648		,2147483648		,2147483648		,223		,223		,2147483648		,223		,223		,223		,2147483648		,2147483648		,223		,223		,223		,2147483648		,223		,2147483648		,2147483648		,2147483648		,223		,223		,223		,2147483648		,2147483648		,2147483648		,223		,223		,223		,223		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,223	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,199		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,190		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,203		,203		,2147483648		,203		,2147483648		,2147483648		,203		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,211		,2147483648		,214		,2147483648		,217		,2147483648		,209		,2147483648		,204		,207		,2147483648		,2147483648		,205		,208		,2147483648		,2147483648		,2147483648		,210		,217		,2147483648		,212		,206		,2147483648		,213		,2147483648		,2147483648		,2147483648		,215		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,216		,2147483648		,2147483648	},
-	{47		,2147483648		,2147483648		,2147483648		,2147483648		,47		,2147483648		,47		,2147483648		,47		,2147483648		,47		,2147483648		,2147483648		,2147483648		,47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,47		,47		,47		,47		,47		,47		,47		,47		,47		,47		,47		,2147483648		,2147483648		,2147483648		,2147483648		,47		,2147483648		,47		,47		,47		,47		,47		,47		,47		,2147483648		,47		,47		,47		,47		,47		,47		,47		,47		,2147483648		,2147483648		,47		,47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,47		,47		,2147483648		,47		,47		,47		,47		,47		,47		,47		,47		,47		,47		,47		,47		,47		,47		,2147483648		,2147483648		,2147483648		,47		,47		,2147483648		,47		,47		,47		,2147483648		,2147483648		,47		,47		,47		,2147483648		,47		,2147483648		,2147483648		,2147483648		,47		,47		,47		,2147483648		,2147483648		,2147483648		,47		,47		,47		,47		,2147483648		,46		,2147483648		,2147483648		,2147483648		,47	},
-	{45		,2147483648		,2147483648		,2147483648		,2147483648		,45		,2147483648		,45		,2147483648		,45		,2147483648		,45		,2147483648		,2147483648		,2147483648		,45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,45		,45		,45		,45		,45		,45		,45		,45		,45		,45		,45		,2147483648		,2147483648		,2147483648		,2147483648		,45		,2147483648		,45		,45		,45		,45		,45		,45		,45		,2147483648		,45		,45		,45		,45		,45		,45		,45		,45		,2147483648		,2147483648		,45		,45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,45		,45		,2147483648		,45		,45		,45		,45		,45		,45		,45		,45		,45		,45		,45		,45		,45		,45		,2147483648		,2147483648		,2147483648		,45		,45		,2147483648		,45		,45		,45		,2147483648		,2147483648		,45		,45		,45		,2147483648		,45		,2147483648		,2147483648		,2147483648		,45		,45		,45		,2147483648		,2147483648		,2147483648		,45		,45		,45		,45		,2147483648		,45		,2147483648		,2147483648		,2147483648		,45	},
-	{50		,2147483648		,2147483648		,2147483648		,2147483648		,50		,2147483648		,50		,2147483648		,50		,2147483648		,50		,2147483648		,2147483648		,2147483648		,50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,50		,50		,50		,50		,50		,50		,50		,50		,50		,50		,50		,2147483648		,2147483648		,2147483648		,2147483648		,50		,2147483648		,50		,50		,50		,50		,50		,50		,50		,2147483648		,50		,50		,50		,50		,50		,50		,50		,50		,2147483648		,2147483648		,50		,50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,50		,50		,2147483648		,50		,50		,50		,50		,50		,50		,50		,50		,50		,50		,50		,50		,50		,50		,2147483648		,2147483648		,2147483648		,50		,50		,2147483648		,50		,50		,50		,2147483648		,2147483648		,50		,50		,50		,2147483648		,50		,2147483648		,2147483648		,2147483648		,50		,50		,50		,2147483648		,2147483648		,2147483648		,50		,50		,50		,50		,2147483648		,50		,2147483648		,2147483648		,51		,50	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,49		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,346		,343		,2147483648		,344		,2147483648		,2147483648		,345		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,97		,2147483648		,97		,2147483648		,2147483648		,2147483648		,97		,2147483648		,97		,97		,2147483648		,2147483648		,97		,97		,96		,95		,2147483648		,97		,2147483648		,2147483648		,97		,97		,2147483648		,97		,97		,2147483648		,2147483648		,97		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,97		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,321		,2147483648		,321		,2147483648		,2147483648		,321		,321		,2147483648		,321		,2147483648		,2147483648		,321		,321		,2147483648		,2147483648		,320		,319		,321		,2147483648		,321		,321		,2147483648		,321		,321		,2147483648		,321		,321		,321		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,321		,2147483648		,321		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,219		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,219		,2147483648		,2147483648		,220		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,222		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,222		,2147483648		,2147483648		,221		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{297		,2147483648		,2147483648		,2147483648		,2147483648		,297		,2147483648		,297		,2147483648		,297		,2147483648		,297		,2147483648		,2147483648		,2147483648		,297		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,297		,297		,297		,297		,297		,297		,297		,297		,297		,297		,297		,295		,2147483648		,2147483648		,2147483648		,297		,2147483648		,297		,297		,297		,297		,297		,297		,297		,2147483648		,297		,297		,297		,297		,297		,297		,297		,297		,2147483648		,2147483648		,297		,297		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,297		,297		,2147483648		,297		,297		,297		,297		,297		,297		,297		,297		,297		,297		,297		,297		,297		,297		,2147483648		,2147483648		,2147483648		,297		,297		,2147483648		,297		,297		,297		,2147483648		,2147483648		,297		,297		,297		,2147483648		,297		,2147483648		,2147483648		,2147483648		,297		,297		,297		,296		,2147483648		,2147483648		,297		,297		,297		,297		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,297	},
-	{33		,2147483648		,2147483648		,2147483648		,2147483648		,33		,2147483648		,33		,2147483648		,33		,2147483648		,33		,2147483648		,2147483648		,2147483648		,33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,33		,33		,33		,33		,33		,33		,33		,33		,33		,33		,33		,2147483648		,2147483648		,2147483648		,2147483648		,33		,2147483648		,33		,33		,33		,33		,33		,33		,33		,2147483648		,33		,33		,33		,33		,33		,33		,33		,33		,2147483648		,2147483648		,33		,33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,33		,33		,2147483648		,33		,33		,33		,33		,33		,33		,33		,33		,33		,33		,33		,33		,33		,33		,2147483648		,2147483648		,2147483648		,33		,33		,2147483648		,33		,33		,33		,2147483648		,2147483648		,33		,33		,33		,2147483648		,33		,2147483648		,2147483648		,2147483648		,33		,33		,33		,2147483648		,2147483648		,2147483648		,33		,33		,33		,33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,33	},
-	{2147483648		,0		,2		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,0		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,0		,0		,0		,2147483648		,0		,2147483648		,2147483648		,0		,0		,2147483648		,2147483648		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,2147483648		,2147483648		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,2147483648		,2147483648		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,1		,2147483648		,2147483648		,2		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,16		,16		,16		,2147483648		,16		,2147483648		,2147483648		,16		,16		,2147483648		,2147483648		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,2147483648		,2147483648		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,2147483648		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,16		,17		,2147483648		,2147483648		,18		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,202		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,202		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,201		,201		,2147483648		,201		,2147483648		,2147483648		,201		,200		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{305		,2147483648		,2147483648		,2147483648		,2147483648		,305		,2147483648		,304		,2147483648		,305		,2147483648		,305		,2147483648		,2147483648		,2147483648		,305		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,305		,305		,305		,2147483648		,305		,305		,305		,305		,305		,305		,305		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,305	},
-	{308		,2147483648		,2147483648		,2147483648		,2147483648		,308		,2147483648		,308		,2147483648		,308		,2147483648		,308		,2147483648		,2147483648		,2147483648		,308		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,308		,308		,308		,308		,308		,308		,308		,308		,308		,308		,308		,306		,2147483648		,2147483648		,2147483648		,308		,2147483648		,308		,308		,308		,308		,308		,308		,308		,2147483648		,308		,308		,308		,308		,308		,308		,308		,308		,2147483648		,2147483648		,308		,308		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,308		,308		,2147483648		,308		,308		,308		,308		,308		,308		,308		,308		,308		,308		,308		,308		,308		,308		,2147483648		,2147483648		,2147483648		,308		,308		,2147483648		,308		,308		,308		,2147483648		,2147483648		,308		,308		,308		,2147483648		,308		,2147483648		,2147483648		,2147483648		,308		,308		,308		,307		,2147483648		,2147483648		,308		,308		,308		,308		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,308	},
-	{315		,2147483648		,2147483648		,2147483648		,2147483648		,317		,2147483648		,2147483648		,2147483648		,316		,2147483648		,313		,2147483648		,2147483648		,2147483648		,312		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,310		,310		,310		,2147483648		,309		,309		,310		,309		,310		,311		,309		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,314	},
-	{2147483648		,15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,7		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,8		,7		,7		,2147483648		,7		,2147483648		,2147483648		,7		,12		,2147483648		,2147483648		,10		,9		,11		,9		,9		,9		,9		,9		,9		,9		,5		,9		,9		,9		,9		,9		,9		,9		,9		,2147483648		,2147483648		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,6		,9		,9		,9		,3		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,2147483648		,2147483648		,9		,9		,9		,9		,9		,9		,13		,9		,14		,9		,9		,9		,9		,4		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,24		,23		,23		,2147483648		,23		,2147483648		,2147483648		,23		,28		,2147483648		,2147483648		,26		,25		,27		,25		,25		,25		,25		,25		,25		,25		,21		,25		,25		,25		,25		,25		,25		,25		,25		,2147483648		,2147483648		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,22		,25		,25		,25		,19		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,25		,31		,2147483648		,25		,25		,25		,25		,25		,25		,29		,25		,30		,25		,25		,25		,25		,20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,341		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,89		,2147483648		,2147483648		,89		,2147483648		,2147483648		,88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,59		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,63		,2147483648		,2147483648		,64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,65		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,83		,2147483648		,2147483648		,83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{71		,2147483648		,2147483648		,2147483648		,2147483648		,71		,2147483648		,71		,2147483648		,71		,2147483648		,71		,2147483648		,2147483648		,2147483648		,71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,71		,71		,71		,71		,71		,71		,71		,71		,71		,71		,71		,2147483648		,2147483648		,2147483648		,2147483648		,71		,2147483648		,71		,71		,71		,71		,71		,71		,71		,2147483648		,71		,71		,71		,71		,71		,71		,71		,71		,2147483648		,2147483648		,71		,71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,71		,71		,2147483648		,71		,71		,71		,71		,71		,71		,71		,71		,71		,71		,71		,71		,71		,71		,2147483648		,2147483648		,2147483648		,71		,71		,2147483648		,71		,71		,71		,2147483648		,2147483648		,71		,71		,71		,2147483648		,71		,2147483648		,2147483648		,2147483648		,71		,71		,71		,2147483648		,2147483648		,2147483648		,71		,71		,71		,71		,2147483648		,72		,2147483648		,2147483648		,2147483648		,71	},
-	{67		,2147483648		,2147483648		,2147483648		,2147483648		,67		,2147483648		,67		,2147483648		,67		,2147483648		,67		,2147483648		,2147483648		,2147483648		,67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,67		,67		,67		,67		,67		,67		,67		,67		,67		,67		,67		,2147483648		,2147483648		,2147483648		,2147483648		,67		,2147483648		,67		,67		,67		,67		,67		,67		,67		,2147483648		,67		,67		,67		,67		,67		,67		,67		,67		,2147483648		,2147483648		,67		,67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,67		,67		,2147483648		,67		,67		,67		,67		,67		,67		,67		,67		,67		,67		,67		,67		,67		,67		,2147483648		,2147483648		,2147483648		,67		,67		,2147483648		,67		,67		,67		,2147483648		,2147483648		,67		,67		,67		,2147483648		,67		,2147483648		,2147483648		,2147483648		,67		,67		,67		,2147483648		,2147483648		,2147483648		,67		,67		,67		,67		,2147483648		,67		,2147483648		,2147483648		,68		,67	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,70		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,74		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,87		,86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,80		,80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,80		,2147483648		,2147483648		,2147483648		,79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{351		,2147483648		,2147483648		,2147483648		,2147483648		,351		,2147483648		,351		,2147483648		,351		,2147483648		,351		,2147483648		,2147483648		,2147483648		,351		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,351		,351		,351		,351		,351		,351		,351		,351		,351		,351		,351		,2147483648		,352		,2147483648		,2147483648		,351		,2147483648		,351		,351		,351		,351		,351		,351		,351		,2147483648		,351		,351		,351		,351		,351		,351		,351		,351		,2147483648		,2147483648		,351		,351		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,351		,351		,2147483648		,351		,351		,351		,351		,351		,351		,351		,351		,351		,351		,351		,351		,351		,351		,2147483648		,2147483648		,2147483648		,351		,351		,2147483648		,351		,351		,351		,2147483648		,2147483648		,351		,351		,351		,2147483648		,351		,2147483648		,2147483648		,2147483648		,351		,351		,351		,2147483648		,2147483648		,2147483648		,351		,351		,351		,351		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,351	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,189		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,188		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{348		,2147483648		,2147483648		,2147483648		,2147483648		,348		,2147483648		,348		,347		,348		,2147483648		,348		,2147483648		,2147483648		,2147483648		,348		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,348		,348		,348		,348		,348		,348		,348		,348		,348		,348		,348		,2147483648		,2147483648		,2147483648		,2147483648		,348		,2147483648		,348		,348		,348		,348		,348		,348		,348		,2147483648		,348		,348		,348		,348		,348		,348		,348		,348		,2147483648		,2147483648		,348		,348		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,348		,348		,2147483648		,348		,348		,348		,348		,348		,348		,348		,348		,348		,348		,348		,348		,348		,348		,2147483648		,2147483648		,2147483648		,348		,348		,2147483648		,348		,348		,348		,2147483648		,2147483648		,348		,348		,348		,2147483648		,348		,2147483648		,2147483648		,2147483648		,348		,348		,348		,2147483648		,2147483648		,2147483648		,348		,348		,348		,348		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,348	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,350		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,349		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,37		,37		,2147483648		,37		,2147483648		,2147483648		,37		,35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,39		,2147483648		,2147483648		,40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,197		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,342		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{353		,2147483648		,2147483648		,2147483648		,2147483648		,353		,2147483648		,353		,2147483648		,353		,2147483648		,353		,2147483648		,2147483648		,2147483648		,353		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,353		,353		,353		,353		,353		,353		,353		,353		,353		,353		,353		,2147483648		,2147483648		,354		,2147483648		,353		,2147483648		,353		,353		,353		,353		,353		,353		,353		,2147483648		,353		,353		,353		,353		,353		,353		,353		,353		,2147483648		,2147483648		,353		,353		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,353		,353		,2147483648		,353		,353		,353		,353		,353		,353		,353		,353		,353		,353		,353		,353		,353		,353		,2147483648		,2147483648		,2147483648		,353		,353		,2147483648		,353		,353		,353		,2147483648		,2147483648		,353		,353		,353		,2147483648		,353		,2147483648		,2147483648		,2147483648		,353		,353		,353		,2147483648		,2147483648		,2147483648		,353		,353		,353		,353		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,353	}
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,46		,2147483648		,2147483648		,45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,334		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,336		,2147483648		,336		,2147483648		,2147483648		,336		,336		,2147483648		,336		,2147483648		,2147483648		,336		,336		,2147483648		,2147483648		,2147483648		,2147483648		,336		,2147483648		,336		,336		,2147483648		,336		,336		,2147483648		,335		,336		,336		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,336		,2147483648		,336		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,333		,2147483648		,333		,2147483648		,2147483648		,333		,333		,2147483648		,333		,2147483648		,2147483648		,333		,333		,2147483648		,2147483648		,2147483648		,2147483648		,333		,2147483648		,333		,333		,2147483648		,333		,333		,2147483648		,332		,333		,333		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,333		,2147483648		,333		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,103		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,105		,2147483648		,105		,2147483648		,2147483648		,2147483648		,105		,2147483648		,105		,105		,2147483648		,2147483648		,105		,105		,2147483648		,2147483648		,2147483648		,105		,2147483648		,2147483648		,105		,105		,2147483648		,105		,104		,2147483648		,2147483648		,105		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,105		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,102		,2147483648		,102		,2147483648		,2147483648		,2147483648		,102		,2147483648		,102		,102		,2147483648		,2147483648		,102		,102		,2147483648		,2147483648		,2147483648		,102		,2147483648		,2147483648		,102		,102		,2147483648		,102		,101		,2147483648		,2147483648		,102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,102		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,47		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,96		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,97		,97		,2147483648		,97		,2147483648		,2147483648		,97		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,113		,2147483648		,116		,2147483648		,2147483648		,2147483648		,111		,2147483648		,106		,109		,2147483648		,2147483648		,107		,110		,2147483648		,2147483648		,2147483648		,112		,2147483648		,2147483648		,114		,108		,2147483648		,115		,2147483648		,2147483648		,2147483648		,117		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,118		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,227		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,227		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,129		,151		,150		,149		,148		,2147483648		,161		,2147483648		,153		,173		,154		,174		,162		,163		,164		,2147483648		,156		,176		,155		,175		,179		,183		,178		,184		,2147483648		,2147483648		,131		,180		,185		,123		,122		,121		,147		,193		,127		,137		,138		,134		,135		,136		,133		,2147483648		,120		,158		,171		,2147483648		,186		,166		,181		,182		,165		,145		,142		,143		,144		,177		,141		,159		,172		,189		,194		,195		,128		,157		,160		,132		,2147483648		,168		,152		,170		,119		,130		,139		,140		,167		,2147483648		,2147483648		,125		,146		,126		,188		,187		,190		,2147483648		,124		,2147483648		,169		,192		,191		,196		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,311		,310		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,309		,308		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,307		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,340		,338		,341		,2147483648		,2147483648		,2147483648		,337		,2147483648		,339		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,207		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,234		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,234		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,234		,2147483648		,2147483648		,234		,2147483648		,2147483648		,2147483648		,234		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,233		,2147483648		,234		,2147483648	},
+	{235		,2147483648		,2147483648		,2147483648		,2147483648		,235		,2147483648		,235		,2147483648		,235		,2147483648		,235		,2147483648		,2147483648		,2147483648		,235		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,235		,235		,235		,235		,235		,235		,235		,235		,235		,235		,235		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,235		,2147483648		,235		,235		,235		,235		,235		,235		,235		,2147483648		,235		,235		,235		,235		,235		,235		,235		,235		,2147483648		,2147483648		,2147483648		,235		,235		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,235		,235		,2147483648		,235		,235		,235		,235		,235		,235		,235		,235		,235		,235		,235		,235		,235		,235		,2147483648		,2147483648		,2147483648		,235		,235		,2147483648		,2147483648		,235		,235		,235		,2147483648		,2147483648		,235		,235		,235		,2147483648		,235		,2147483648		,2147483648		,2147483648		,235		,235		,235		,2147483648		,2147483648		,2147483648		,235		,235		,235		,235		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,235	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,237		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,237		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,237		,2147483648		,2147483648		,237		,2147483648		,2147483648		,2147483648		,237		,236		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,237		,2147483648		,237		,2147483648	},
+	{347		,2147483648		,2147483648		,2147483648		,2147483648		,349		,2147483648		,303		,2147483648		,348		,2147483648		,345		,2147483648		,2147483648		,2147483648		,344		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,342		,342		,342		,331		,327		,327		,342		,327		,342		,343		,327		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,270		,2147483648		,262		,282		,263		,283		,271		,272		,273		,2147483648		,265		,285		,264		,284		,288		,292		,287		,293		,2147483648		,2147483648		,2147483648		,289		,294		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,267		,280		,2147483648		,295		,275		,290		,291		,274		,260		,257		,258		,259		,286		,256		,268		,281		,298		,2147483648		,2147483648		,2147483648		,266		,269		,2147483648		,2147483648		,277		,261		,279		,2147483648		,2147483648		,254		,255		,276		,2147483648		,312		,2147483648		,2147483648		,2147483648		,297		,296		,299		,2147483648		,2147483648		,2147483648		,278		,301		,300		,302		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,346	},
+	{238		,2147483648		,2147483648		,2147483648		,2147483648		,238		,2147483648		,238		,2147483648		,238		,2147483648		,238		,2147483648		,2147483648		,2147483648		,238		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,238		,238		,238		,238		,238		,238		,238		,238		,238		,238		,238		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,238		,2147483648		,238		,238		,238		,238		,238		,238		,238		,2147483648		,238		,238		,238		,238		,238		,238		,238		,238		,2147483648		,2147483648		,2147483648		,238		,238		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,238		,238		,2147483648		,238		,238		,238		,238		,238		,238		,238		,238		,238		,238		,238		,238		,238		,238		,2147483648		,2147483648		,2147483648		,238		,238		,2147483648		,2147483648		,238		,238		,238		,2147483648		,2147483648		,238		,238		,238		,2147483648		,238		,2147483648		,2147483648		,2147483648		,238		,238		,238		,2147483648		,2147483648		,2147483648		,238		,238		,238		,238		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,238	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,239		,2147483648		,2147483648		,240		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,240		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,240		,2147483648		,2147483648		,240		,2147483648		,2147483648		,2147483648		,240		,240		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,240		,2147483648		,240		,2147483648	},
+	{241		,2147483648		,2147483648		,2147483648		,2147483648		,241		,2147483648		,241		,2147483648		,241		,2147483648		,241		,2147483648		,2147483648		,2147483648		,241		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,241		,241		,241		,241		,241		,241		,241		,241		,241		,241		,241		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,241		,2147483648		,241		,241		,241		,241		,241		,241		,241		,2147483648		,241		,241		,241		,241		,241		,241		,241		,241		,2147483648		,2147483648		,2147483648		,241		,241		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,241		,241		,2147483648		,241		,241		,241		,241		,241		,241		,241		,241		,241		,241		,241		,241		,241		,241		,2147483648		,2147483648		,2147483648		,241		,241		,2147483648		,2147483648		,241		,241		,241		,2147483648		,2147483648		,241		,241		,241		,2147483648		,241		,2147483648		,2147483648		,2147483648		,241		,241		,241		,2147483648		,2147483648		,2147483648		,241		,241		,241		,241		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,241	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,244		,2147483648		,2147483648		,244		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,244		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,244		,243		,2147483648		,244		,242		,2147483648		,2147483648		,244		,244		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,244		,2147483648		,244		,2147483648	},
+	{245		,2147483648		,2147483648		,2147483648		,2147483648		,245		,2147483648		,245		,2147483648		,245		,2147483648		,245		,2147483648		,2147483648		,2147483648		,245		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,245		,245		,245		,245		,245		,245		,245		,245		,245		,245		,245		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,245		,2147483648		,245		,245		,245		,245		,245		,245		,245		,2147483648		,245		,245		,245		,245		,245		,245		,245		,245		,2147483648		,2147483648		,2147483648		,245		,245		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,245		,245		,2147483648		,245		,245		,245		,245		,245		,245		,245		,245		,245		,245		,245		,245		,245		,245		,2147483648		,2147483648		,2147483648		,245		,245		,2147483648		,2147483648		,245		,245		,245		,2147483648		,2147483648		,245		,245		,245		,2147483648		,245		,2147483648		,2147483648		,2147483648		,245		,245		,245		,2147483648		,2147483648		,2147483648		,245		,245		,245		,245		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,245	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,248		,2147483648		,2147483648		,248		,2147483648		,2147483648		,246		,2147483648		,2147483648		,248		,247		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,248		,248		,2147483648		,248		,248		,2147483648		,2147483648		,248		,248		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,248		,2147483648		,248		,2147483648	},
+	{249		,2147483648		,2147483648		,2147483648		,2147483648		,249		,2147483648		,249		,2147483648		,249		,2147483648		,249		,2147483648		,2147483648		,2147483648		,249		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,249		,249		,249		,249		,249		,249		,249		,249		,249		,249		,249		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,249		,2147483648		,249		,249		,249		,249		,249		,249		,249		,2147483648		,249		,249		,249		,249		,249		,249		,249		,249		,2147483648		,2147483648		,2147483648		,249		,249		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,249		,249		,2147483648		,249		,249		,249		,249		,249		,249		,249		,249		,249		,249		,249		,249		,249		,249		,2147483648		,2147483648		,2147483648		,249		,249		,2147483648		,2147483648		,249		,249		,249		,2147483648		,2147483648		,249		,249		,249		,2147483648		,249		,2147483648		,2147483648		,2147483648		,249		,249		,249		,2147483648		,2147483648		,2147483648		,249		,249		,249		,249		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,249	},
+	{2147483648		,2147483648		,2147483648		,251		,2147483648		,253		,2147483648		,2147483648		,253		,252		,2147483648		,253		,2147483648		,2147483648		,253		,253		,2147483648		,2147483648		,2147483648		,2147483648		,250		,2147483648		,253		,253		,2147483648		,253		,253		,2147483648		,2147483648		,253		,253		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,253		,2147483648		,253		,2147483648	},
+	{2147483648		,204		,204		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,204		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,204		,204		,204		,2147483648		,204		,2147483648		,2147483648		,204		,204		,2147483648		,2147483648		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,203		,2147483648		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,2147483648		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,204		,2147483648		,2147483648		,204		,2147483648	},
+	{2147483648		,201		,201		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,201		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,201		,201		,201		,2147483648		,201		,2147483648		,2147483648		,201		,201		,2147483648		,2147483648		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,200		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,2147483648		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,201		,2147483648		,2147483648		,201		,2147483648	},
+	{2147483648		,202		,202		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,202		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,202		,202		,202		,2147483648		,202		,2147483648		,2147483648		,202		,202		,2147483648		,2147483648		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,2147483648		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,2147483648		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,202		,2147483648		,2147483648		,202		,2147483648	},
+	{2147483648		,205		,205		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,205		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,205		,205		,205		,2147483648		,205		,2147483648		,2147483648		,205		,205		,2147483648		,2147483648		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,2147483648		,2147483648		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,2147483648		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,205		,2147483648		,2147483648		,205		,2147483648	},
+	{232		,2147483648		,2147483648		,2147483648		,2147483648		,232		,2147483648		,232		,2147483648		,232		,2147483648		,232		,2147483648		,2147483648		,2147483648		,232		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,232		,232		,232		,232		,232		,232		,232		,232		,232		,232		,232		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,232		,2147483648		,232		,232		,232		,232		,232		,232		,232		,2147483648		,232		,232		,232		,232		,232		,232		,232		,232		,2147483648		,2147483648		,2147483648		,232		,232		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,232		,232		,2147483648		,232		,232		,232		,232		,232		,232		,232		,232		,232		,232		,232		,232		,232		,232		,2147483648		,2147483648		,2147483648		,232		,232		,2147483648		,2147483648		,232		,232		,232		,2147483648		,2147483648		,232		,232		,232		,2147483648		,232		,2147483648		,2147483648		,2147483648		,232		,232		,232		,2147483648		,2147483648		,2147483648		,232		,232		,232		,232		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,232	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,208		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,199		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,212		,212		,2147483648		,212		,2147483648		,2147483648		,212		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,220		,2147483648		,223		,2147483648		,226		,2147483648		,218		,2147483648		,213		,216		,2147483648		,2147483648		,214		,217		,2147483648		,2147483648		,2147483648		,219		,226		,2147483648		,221		,215		,2147483648		,222		,2147483648		,2147483648		,2147483648		,224		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,225		,2147483648		,2147483648	},
+	{50		,2147483648		,2147483648		,2147483648		,2147483648		,50		,2147483648		,50		,2147483648		,50		,2147483648		,50		,2147483648		,2147483648		,2147483648		,50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,50		,50		,50		,50		,50		,50		,50		,50		,50		,50		,50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,50		,2147483648		,50		,50		,50		,50		,50		,50		,50		,2147483648		,50		,50		,50		,50		,50		,50		,50		,50		,2147483648		,2147483648		,2147483648		,50		,50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,50		,50		,2147483648		,50		,50		,50		,50		,50		,50		,50		,50		,50		,50		,50		,50		,50		,50		,2147483648		,2147483648		,2147483648		,50		,50		,2147483648		,2147483648		,50		,50		,50		,2147483648		,2147483648		,50		,50		,50		,2147483648		,50		,2147483648		,2147483648		,2147483648		,50		,50		,50		,2147483648		,2147483648		,2147483648		,50		,50		,50		,50		,2147483648		,49		,2147483648		,2147483648		,2147483648		,50	},
+	{48		,2147483648		,2147483648		,2147483648		,2147483648		,48		,2147483648		,48		,2147483648		,48		,2147483648		,48		,2147483648		,2147483648		,2147483648		,48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,48		,48		,48		,48		,48		,48		,48		,48		,48		,48		,48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,48		,2147483648		,48		,48		,48		,48		,48		,48		,48		,2147483648		,48		,48		,48		,48		,48		,48		,48		,48		,2147483648		,2147483648		,2147483648		,48		,48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,48		,48		,2147483648		,48		,48		,48		,48		,48		,48		,48		,48		,48		,48		,48		,48		,48		,48		,2147483648		,2147483648		,2147483648		,48		,48		,2147483648		,2147483648		,48		,48		,48		,2147483648		,2147483648		,48		,48		,48		,2147483648		,48		,2147483648		,2147483648		,2147483648		,48		,48		,48		,2147483648		,2147483648		,2147483648		,48		,48		,48		,48		,2147483648		,48		,2147483648		,2147483648		,2147483648		,48	},
+	{53		,2147483648		,2147483648		,2147483648		,2147483648		,53		,2147483648		,53		,2147483648		,53		,2147483648		,53		,2147483648		,2147483648		,2147483648		,53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,53		,53		,53		,53		,53		,53		,53		,53		,53		,53		,53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,53		,2147483648		,53		,53		,53		,53		,53		,53		,53		,2147483648		,53		,53		,53		,53		,53		,53		,53		,53		,2147483648		,2147483648		,2147483648		,53		,53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,53		,53		,2147483648		,53		,53		,53		,53		,53		,53		,53		,53		,53		,53		,53		,53		,53		,53		,2147483648		,2147483648		,2147483648		,53		,53		,2147483648		,2147483648		,53		,53		,53		,2147483648		,2147483648		,53		,53		,53		,2147483648		,53		,2147483648		,2147483648		,2147483648		,53		,53		,53		,2147483648		,2147483648		,2147483648		,53		,53		,53		,53		,2147483648		,53		,2147483648		,2147483648		,54		,53	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,52		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,355		,352		,2147483648		,353		,2147483648		,2147483648		,354		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,100		,2147483648		,100		,2147483648		,2147483648		,2147483648		,100		,2147483648		,100		,100		,2147483648		,2147483648		,100		,100		,99		,98		,2147483648		,100		,2147483648		,2147483648		,100		,100		,2147483648		,100		,100		,2147483648		,2147483648		,100		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,100		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,330		,2147483648		,330		,2147483648		,2147483648		,330		,330		,2147483648		,330		,2147483648		,2147483648		,330		,330		,2147483648		,2147483648		,329		,328		,330		,2147483648		,330		,330		,2147483648		,330		,330		,2147483648		,330		,330		,330		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,330		,2147483648		,330		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,228		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,228		,2147483648		,2147483648		,229		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,231		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,231		,2147483648		,2147483648		,230		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{306		,2147483648		,2147483648		,2147483648		,2147483648		,306		,2147483648		,306		,2147483648		,306		,2147483648		,306		,2147483648		,2147483648		,2147483648		,306		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,306		,306		,306		,306		,306		,306		,306		,306		,306		,306		,306		,304		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,306		,2147483648		,306		,306		,306		,306		,306		,306		,306		,2147483648		,306		,306		,306		,306		,306		,306		,306		,306		,2147483648		,2147483648		,2147483648		,306		,306		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,306		,306		,2147483648		,306		,306		,306		,306		,306		,306		,306		,306		,306		,306		,306		,306		,306		,306		,2147483648		,2147483648		,2147483648		,306		,306		,2147483648		,2147483648		,306		,306		,306		,2147483648		,2147483648		,306		,306		,306		,2147483648		,306		,2147483648		,2147483648		,2147483648		,306		,306		,306		,305		,2147483648		,2147483648		,306		,306		,306		,306		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,306	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{36		,2147483648		,2147483648		,2147483648		,2147483648		,36		,2147483648		,36		,2147483648		,36		,2147483648		,36		,2147483648		,2147483648		,2147483648		,36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,36		,36		,36		,36		,36		,36		,36		,36		,36		,36		,36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,36		,2147483648		,36		,36		,36		,36		,36		,36		,36		,2147483648		,36		,36		,36		,36		,36		,36		,36		,36		,2147483648		,2147483648		,2147483648		,36		,36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,36		,36		,2147483648		,36		,36		,36		,36		,36		,36		,36		,36		,36		,36		,36		,36		,36		,36		,2147483648		,2147483648		,2147483648		,36		,36		,2147483648		,2147483648		,36		,36		,36		,2147483648		,2147483648		,36		,36		,36		,2147483648		,36		,2147483648		,2147483648		,2147483648		,36		,36		,36		,2147483648		,2147483648		,2147483648		,36		,36		,36		,36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,36	},
+	{2147483648		,0		,2		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,0		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,0		,0		,0		,2147483648		,0		,2147483648		,2147483648		,0		,0		,2147483648		,2147483648		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,2147483648		,2147483648		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,2147483648		,2147483648		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,1		,2147483648		,2147483648		,2		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,19		,19		,19		,2147483648		,19		,2147483648		,2147483648		,19		,19		,2147483648		,2147483648		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,2147483648		,2147483648		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,2147483648		,19		,19		,19		,19		,19		,19		,19		,19		,19		,2147483648		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,19		,20		,2147483648		,2147483648		,21		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,211		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,211		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,210		,210		,2147483648		,210		,2147483648		,2147483648		,210		,209		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{314		,2147483648		,2147483648		,2147483648		,2147483648		,314		,2147483648		,313		,2147483648		,314		,2147483648		,314		,2147483648		,2147483648		,2147483648		,314		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,314		,314		,314		,2147483648		,314		,314		,314		,314		,314		,314		,314		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,314	},
+	{317		,2147483648		,2147483648		,2147483648		,2147483648		,317		,2147483648		,317		,2147483648		,317		,2147483648		,317		,2147483648		,2147483648		,2147483648		,317		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,317		,317		,317		,317		,317		,317		,317		,317		,317		,317		,317		,315		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,317		,2147483648		,317		,317		,317		,317		,317		,317		,317		,2147483648		,317		,317		,317		,317		,317		,317		,317		,317		,2147483648		,2147483648		,2147483648		,317		,317		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,317		,317		,2147483648		,317		,317		,317		,317		,317		,317		,317		,317		,317		,317		,317		,317		,317		,317		,2147483648		,2147483648		,2147483648		,317		,317		,2147483648		,2147483648		,317		,317		,317		,2147483648		,2147483648		,317		,317		,317		,2147483648		,317		,2147483648		,2147483648		,2147483648		,317		,317		,317		,316		,2147483648		,2147483648		,317		,317		,317		,317		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,317	},
+	{324		,2147483648		,2147483648		,2147483648		,2147483648		,326		,2147483648		,2147483648		,2147483648		,325		,2147483648		,322		,2147483648		,2147483648		,2147483648		,321		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,319		,319		,319		,2147483648		,318		,318		,319		,318		,319		,320		,318		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,323	},
+	{2147483648		,15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,7		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,8		,7		,7		,2147483648		,7		,2147483648		,2147483648		,7		,12		,2147483648		,2147483648		,9		,9		,9		,9		,9		,10		,9		,11		,9		,9		,9		,9		,9		,9		,9		,5		,9		,9		,9		,9		,9		,9		,9		,9		,2147483648		,2147483648		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,6		,9		,9		,9		,3		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,9		,16		,9		,9		,9		,9		,9		,9		,9		,9		,2147483648		,2147483648		,9		,9		,9		,9		,9		,9		,13		,9		,14		,9		,9		,9		,9		,4		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,27		,26		,26		,2147483648		,26		,2147483648		,2147483648		,26		,31		,2147483648		,2147483648		,28		,28		,28		,28		,28		,29		,28		,30		,28		,28		,28		,28		,28		,28		,28		,24		,28		,28		,28		,28		,28		,28		,28		,28		,2147483648		,2147483648		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,25		,28		,28		,28		,22		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,28		,2147483648		,28		,28		,28		,28		,28		,28		,28		,28		,34		,2147483648		,28		,28		,28		,28		,28		,28		,32		,28		,33		,28		,28		,28		,28		,23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,350		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,92		,2147483648		,2147483648		,92		,2147483648		,2147483648		,91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,62		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,66		,2147483648		,2147483648		,67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,68		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,86		,2147483648		,2147483648		,86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{74		,2147483648		,2147483648		,2147483648		,2147483648		,74		,2147483648		,74		,2147483648		,74		,2147483648		,74		,2147483648		,2147483648		,2147483648		,74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,74		,74		,74		,74		,74		,74		,74		,74		,74		,74		,74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,74		,2147483648		,74		,74		,74		,74		,74		,74		,74		,2147483648		,74		,74		,74		,74		,74		,74		,74		,74		,2147483648		,2147483648		,2147483648		,74		,74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,74		,74		,2147483648		,74		,74		,74		,74		,74		,74		,74		,74		,74		,74		,74		,74		,74		,74		,2147483648		,2147483648		,2147483648		,74		,74		,2147483648		,2147483648		,74		,74		,74		,2147483648		,2147483648		,74		,74		,74		,2147483648		,74		,2147483648		,2147483648		,2147483648		,74		,74		,74		,2147483648		,2147483648		,2147483648		,74		,74		,74		,74		,2147483648		,75		,2147483648		,2147483648		,2147483648		,74	},
+	{70		,2147483648		,2147483648		,2147483648		,2147483648		,70		,2147483648		,70		,2147483648		,70		,2147483648		,70		,2147483648		,2147483648		,2147483648		,70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,70		,70		,70		,70		,70		,70		,70		,70		,70		,70		,70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,70		,2147483648		,70		,70		,70		,70		,70		,70		,70		,2147483648		,70		,70		,70		,70		,70		,70		,70		,70		,2147483648		,2147483648		,2147483648		,70		,70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,70		,70		,2147483648		,70		,70		,70		,70		,70		,70		,70		,70		,70		,70		,70		,70		,70		,70		,2147483648		,2147483648		,2147483648		,70		,70		,2147483648		,2147483648		,70		,70		,70		,2147483648		,2147483648		,70		,70		,70		,2147483648		,70		,2147483648		,2147483648		,2147483648		,70		,70		,70		,2147483648		,2147483648		,2147483648		,70		,70		,70		,70		,2147483648		,70		,2147483648		,2147483648		,71		,70	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,73		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,77		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,90		,89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,83		,83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,83		,2147483648		,2147483648		,2147483648		,82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{360		,2147483648		,2147483648		,2147483648		,2147483648		,360		,2147483648		,360		,2147483648		,360		,2147483648		,360		,2147483648		,2147483648		,2147483648		,360		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,360		,360		,360		,360		,360		,360		,360		,360		,360		,360		,360		,2147483648		,361		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,360		,2147483648		,360		,360		,360		,360		,360		,360		,360		,2147483648		,360		,360		,360		,360		,360		,360		,360		,360		,2147483648		,2147483648		,2147483648		,360		,360		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,360		,360		,2147483648		,360		,360		,360		,360		,360		,360		,360		,360		,360		,360		,360		,360		,360		,360		,2147483648		,2147483648		,2147483648		,360		,360		,2147483648		,2147483648		,360		,360		,360		,2147483648		,2147483648		,360		,360		,360		,2147483648		,360		,2147483648		,2147483648		,2147483648		,360		,360		,360		,2147483648		,2147483648		,2147483648		,360		,360		,360		,360		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,360	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,94		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,95		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,93		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,198		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,197		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{357		,2147483648		,2147483648		,2147483648		,2147483648		,357		,2147483648		,357		,356		,357		,2147483648		,357		,2147483648		,2147483648		,2147483648		,357		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,357		,357		,357		,357		,357		,357		,357		,357		,357		,357		,357		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,357		,2147483648		,357		,357		,357		,357		,357		,357		,357		,2147483648		,357		,357		,357		,357		,357		,357		,357		,357		,2147483648		,2147483648		,2147483648		,357		,357		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,357		,357		,2147483648		,357		,357		,357		,357		,357		,357		,357		,357		,357		,357		,357		,357		,357		,357		,2147483648		,2147483648		,2147483648		,357		,357		,2147483648		,2147483648		,357		,357		,357		,2147483648		,2147483648		,357		,357		,357		,2147483648		,357		,2147483648		,2147483648		,2147483648		,357		,357		,357		,2147483648		,2147483648		,2147483648		,357		,357		,357		,357		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,357	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,359		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,358		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,40		,40		,2147483648		,40		,2147483648		,2147483648		,40		,38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,42		,2147483648		,2147483648		,43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,206		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,351		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{362		,2147483648		,2147483648		,2147483648		,2147483648		,362		,2147483648		,362		,2147483648		,362		,2147483648		,362		,2147483648		,2147483648		,2147483648		,362		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,362		,362		,362		,362		,362		,362		,362		,362		,362		,362		,362		,2147483648		,2147483648		,363		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,362		,2147483648		,362		,362		,362		,362		,362		,362		,362		,2147483648		,362		,362		,362		,362		,362		,362		,362		,362		,2147483648		,2147483648		,2147483648		,362		,362		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,362		,362		,2147483648		,362		,362		,362		,362		,362		,362		,362		,362		,362		,362		,362		,362		,362		,362		,2147483648		,2147483648		,2147483648		,362		,362		,2147483648		,2147483648		,362		,362		,362		,2147483648		,2147483648		,362		,362		,362		,2147483648		,362		,2147483648		,2147483648		,2147483648		,362		,362		,362		,2147483648		,2147483648		,2147483648		,362		,362		,362		,362		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,362	}
 };
 const char* KeywordList[]= {
 "print",
@@ -1410,7 +1446,9 @@ const char* KeywordList[]= {
 "spinlock_unlock",
 "event_sc",
 "microsleep",
+"agg_count",
 "printf",
+"emit",
 "pause",
 "flush",
 "event_trace_step",
@@ -1427,6 +1465,10 @@ const char* KeywordList[]= {
 "lbr_check",
 "spinlock_lock_custom_wait",
 "event_inject",
+"agg_sum",
+"agg_min",
+"agg_max",
+"agg_hist",
 "poi",
 "db",
 "dd",
@@ -1578,6 +1620,10 @@ const char* TwoOpFunc1[] = {
 const char* TwoOpFunc2[] = {
 "@SPINLOCK_LOCK_CUSTOM_WAIT",
 "@EVENT_INJECT",
+"@AGG_SUM",
+"@AGG_MIN",
+"@AGG_MAX",
+"@AGG_HIST",
 };
 const char* OneOpFunc1[] = {
 "@POI",
@@ -1618,6 +1664,7 @@ const char* OneOpFunc2[] = {
 "@SPINLOCK_UNLOCK",
 "@EVENT_SC",
 "@MICROSLEEP",
+"@AGG_COUNT",
 };
 const char* OneOpFunc3[] = {
 "@STRLEN"
@@ -1659,6 +1706,9 @@ const char* ZeroOpFunc2[] = {
 const char* VarArgFunc1[] = {
 "@PRINTF"
 };
+const char* VarArgFunc2[] = {
+"@EMIT"
+};
 const SYMBOL_MAP SemanticRulesMapList[]= {
 {"@INC", FUNC_INC},
 {"@DEC", FUNC_DEC},
@@ -1750,7 +1800,9 @@ const SYMBOL_MAP SemanticRulesMapList[]= {
 {"@SPINLOCK_UNLOCK", FUNC_SPINLOCK_UNLOCK},
 {"@EVENT_SC", FUNC_EVENT_SC},
 {"@MICROSLEEP", FUNC_MICROSLEEP},
+{"@AGG_COUNT", FUNC_AGG_COUNT},
 {"@PRINTF", FUNC_PRINTF},
+{"@EMIT", FUNC_EMIT},
 {"@PAUSE", FUNC_PAUSE},
 {"@FLUSH", FUNC_FLUSH},
 {"@EVENT_TRACE_STEP", FUNC_EVENT_TRACE_STEP},
@@ -1767,6 +1819,10 @@ const SYMBOL_MAP SemanticRulesMapList[]= {
 {"@LBR_CHECK", FUNC_LBR_CHECK},
 {"@SPINLOCK_LOCK_CUSTOM_WAIT", FUNC_SPINLOCK_LOCK_CUSTOM_WAIT},
 {"@EVENT_INJECT", FUNC_EVENT_INJECT},
+{"@AGG_SUM", FUNC_AGG_SUM},
+{"@AGG_MIN", FUNC_AGG_MIN},
+{"@AGG_MAX", FUNC_AGG_MAX},
+{"@AGG_HIST", FUNC_AGG_HIST},
 {"@POI", FUNC_POI},
 {"@DB", FUNC_DB},
 {"@DD", FUNC_DD},
@@ -2024,6 +2080,2023 @@ const char* ScriptVariableTypeList[]= {
 "float",
 "double"
 };
+const unsigned int KeywordHashTableSeeds[64]= 
+{
+	0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 2, 1, 3, 1, 1,
+	1, 1, 2, 1, 1, 1, 2, 1, 1, 2, 3, 1, 0, 0, 1, 1,
+	1, 3, 1, 1, 3, 1, 4, 1, 1, 1, 1, 3, 5, 1, 0, 2,
+	3, 1, 1, 1, 1, 0, 1, 1, 1, 0, 4, 1, 2, 1, 2, 4
+};
+const SYMBOL_MAP KeywordHashTableEntries[512]= 
+{
+	{"lbr_dump", 23},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"flush", 14},
+	{"_register", 120},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_hex", 116},
+	{NULL, 0},
+	{NULL, 0},
+	{"percpu", 131},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{".", 97},
+	{"lbr_print", 24},
+	{NULL, 0},
+	{"not", 41},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"-=", 95},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_binary", 110},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"db", 34},
+	{")", 86},
+	{NULL, 0},
+	{"if", 130},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_pseudo_register", 119},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{">>", 104},
+	{"rdtsc", 20},
+	{NULL, 0},
+	{NULL, 0},
+	{"_octal", 118},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"!", 78},
+	{NULL, 0},
+	{NULL, 0},
+	{"rdtscp", 21},
+	{NULL, 0},
+	{NULL, 0},
+	{"check_address", 42},
+	{"pause", 13},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"spinlock_lock", 6},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"ed", 59},
+	{"event_sc", 8},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_decimal", 111},
+	{NULL, 0},
+	{NULL, 0},
+	{"^", 108},
+	{NULL, 0},
+	{"interlocked_exchange", 62},
+	{NULL, 0},
+	{NULL, 0},
+	{"dd_pa", 55},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"dq", 37},
+	{NULL, 0},
+	{"++", 90},
+	{NULL, 0},
+	{"hi_pa", 52},
+	{"event_trace_step_in", 16},
+	{NULL, 0},
+	{"lbr_restore_by_filter", 58},
+	{"event_enable", 2},
+	{NULL, 0},
+	{"]", 107},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"{", 137},
+	{"event_trace_instrumentation_step", 18},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"eq", 61},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"formats", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"strcmp", 69},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"lbr_check", 26},
+	{"agg_hist", 32},
+	{NULL, 0},
+	{"agg_min", 30},
+	{NULL, 0},
+	{"agg_max", 31},
+	{NULL, 0},
+	{"struct", 134},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"neg", 38},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"typedef", 135},
+	{"wcsncmp", 77},
+	{"&=", 84},
+	{NULL, 0},
+	{"_function_id", 113},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"+=", 91},
+	{"elsif", 128},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"%", 81},
+	{NULL, 0},
+	{NULL, 0},
+	{"_string", 122},
+	{"lbr_save", 22},
+	{NULL, 0},
+	{"virtual_to_physical", 50},
+	{NULL, 0},
+	{"+", 89},
+	{"event_trace_instrumentation_step_in", 19},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"hi", 39},
+	{NULL, 0},
+	{NULL, 0},
+	{"db_pa", 54},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"event_inject_error_code", 74},
+	{"_local_id", 117},
+	{NULL, 0},
+	{"interlocked_decrement", 47},
+	{"eb_pa", 64},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"dq_pa", 57},
+	{"_wstring", 123},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"microsleep", 9},
+	{NULL, 0},
+	{"while", 136},
+	{"dw", 36},
+	{"dd", 35},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"print", 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{">>=", 105},
+	{NULL, 0},
+	{NULL, 0},
+	{"emit", 12},
+	{NULL, 0},
+	{NULL, 0},
+	{"#include", 79},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"lbr_restore", 25},
+	{NULL, 0},
+	{"disassemble_len64", 45},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_script_variable_type", 121},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"event_trace_step", 15},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{",", 92},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"event_inject", 28},
+	{"wcslen", 72},
+	{"/=", 99},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"sizeof", 133},
+	{"_global_id", 115},
+	{"test_statement", 5},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"$", 80},
+	{"}", 140},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"printf", 11},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"ed_pa", 65},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_function_parameter_id", 114},
+	{NULL, 0},
+	{"agg_count", 10},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"low", 40},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"|", 138},
+	{NULL, 0},
+	{"physical_to_virtual", 49},
+	{"memcpy", 75},
+	{"[", 106},
+	{NULL, 0},
+	{"poi_pa", 51},
+	{NULL, 0},
+	{"strlen", 68},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"/", 98},
+	{"disassemble_len32", 44},
+	{"event_clear", 4},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"interlocked_exchange_add", 63},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"%=", 82},
+	{NULL, 0},
+	{NULL, 0},
+	{"--", 94},
+	{"else", 127},
+	{NULL, 0},
+	{NULL, 0},
+	{"for", 129},
+	{NULL, 0},
+	{NULL, 0},
+	{"<<", 101},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"->", 96},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"interlocked_compare_exchange", 67},
+	{"disassemble_len", 43},
+	{"interlocked_increment", 46},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"*=", 88},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"reference", 48},
+	{NULL, 0},
+	{"*", 87},
+	{"low_pa", 53},
+	{"wcscmp", 73},
+	{";", 100},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"event_disable", 3},
+	{"eb", 60},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"continue", 125},
+	{NULL, 0},
+	{"-", 93},
+	{NULL, 0},
+	{"memcpy_pa", 76},
+	{NULL, 0},
+	{"memcmp", 70},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"&", 83},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"=", 103},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"event_trace_step_out", 17},
+	{"eq_pa", 66},
+	{NULL, 0},
+	{NULL, 0},
+	{"do", 126},
+	{NULL, 0},
+	{"strncmp", 71},
+	{"~", 141},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_float", 112},
+	{NULL, 0},
+	{"break", 124},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"return", 132},
+	{NULL, 0},
+	{NULL, 0},
+	{"poi", 33},
+	{"<<=", 102},
+	{"spinlock_lock_custom_wait", 27},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"spinlock_unlock", 7},
+	{NULL, 0},
+	{"|=", 139},
+	{"^=", 109},
+	{NULL, 0},
+	{"(", 85},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"agg_sum", 29},
+	{"dw_pa", 56},
+	{NULL, 0}
+};
+const PERFECT_HASH_TABLE KeywordHashTable= {KeywordHashTableSeeds, 63, KeywordHashTableEntries, 511};
+const unsigned int RegisterHashTableSeeds[32]= 
+{
+	3, 2, 3, 1, 1, 3, 1, 3, 1, 3, 1, 3, 1, 2, 3, 1,
+	1, 2, 6, 8, 4, 6, 1, 2, 1, 1, 6, 1, 3, 3, 2, 3
+};
+const SYMBOL_MAP RegisterHashTableEntries[256]= 
+{
+	{NULL, 0},
+	{"r9l", REGISTER_R9L},
+	{"dx", REGISTER_DX},
+	{NULL, 0},
+	{"r9w", REGISTER_R9W},
+	{NULL, 0},
+	{"af", REGISTER_AF},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"r14h", REGISTER_R14H},
+	{NULL, 0},
+	{"gs", REGISTER_GS},
+	{"r15h", REGISTER_R15H},
+	{"cr8", REGISTER_CR8},
+	{"cr0", REGISTER_CR0},
+	{"r10l", REGISTER_R10L},
+	{NULL, 0},
+	{"r8l", REGISTER_R8L},
+	{"sp", REGISTER_SP},
+	{"bh", REGISTER_BH},
+	{"cr3", REGISTER_CR3},
+	{NULL, 0},
+	{"r15l", REGISTER_R15L},
+	{NULL, 0},
+	{"spl", REGISTER_SPL},
+	{"r13", REGISTER_R13},
+	{"esi", REGISTER_ESI},
+	{"if", REGISTER_IF},
+	{"ldtr", REGISTER_LDTR},
+	{"r11d", REGISTER_R11D},
+	{"ss", REGISTER_SS},
+	{"bpl", REGISTER_BPL},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"r13d", REGISTER_R13D},
+	{"rsp", REGISTER_RSP},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"of", REGISTER_OF},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"iopl", REGISTER_IOPL},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"rcx", REGISTER_RCX},
+	{NULL, 0},
+	{NULL, 0},
+	{"r13h", REGISTER_R13H},
+	{"eax", REGISTER_EAX},
+	{"cx", REGISTER_CX},
+	{"r15", REGISTER_R15},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"r11l", REGISTER_R11L},
+	{NULL, 0},
+	{"si", REGISTER_SI},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"r10d", REGISTER_R10D},
+	{NULL, 0},
+	{"tf", REGISTER_TF},
+	{"rflags", REGISTER_RFLAGS},
+	{"r11w", REGISTER_R11W},
+	{NULL, 0},
+	{"cf", REGISTER_CF},
+	{NULL, 0},
+	{NULL, 0},
+	{"ac", REGISTER_AC},
+	{"tr", REGISTER_TR},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"eip", REGISTER_EIP},
+	{"dr1", REGISTER_DR1},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"al", REGISTER_AL},
+	{NULL, 0},
+	{"rsi", REGISTER_RSI},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"r11h", REGISTER_R11H},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"r12w", REGISTER_R12W},
+	{"cr2", REGISTER_CR2},
+	{NULL, 0},
+	{"vip", REGISTER_VIP},
+	{NULL, 0},
+	{NULL, 0},
+	{"cl", REGISTER_CL},
+	{"rf", REGISTER_RF},
+	{"r9h", REGISTER_R9H},
+	{NULL, 0},
+	{NULL, 0},
+	{"ax", REGISTER_AX},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"ip", REGISTER_IP},
+	{"pf", REGISTER_PF},
+	{"rdx", REGISTER_RDX},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"rax", REGISTER_RAX},
+	{"r10h", REGISTER_R10H},
+	{NULL, 0},
+	{NULL, 0},
+	{"dr2", REGISTER_DR2},
+	{"r14l", REGISTER_R14L},
+	{NULL, 0},
+	{"r13l", REGISTER_R13L},
+	{NULL, 0},
+	{"r8w", REGISTER_R8W},
+	{NULL, 0},
+	{"r8h", REGISTER_R8H},
+	{"r9", REGISTER_R9},
+	{"ch", REGISTER_CH},
+	{NULL, 0},
+	{"nt", REGISTER_NT},
+	{NULL, 0},
+	{"rbp", REGISTER_RBP},
+	{"r14", REGISTER_R14},
+	{NULL, 0},
+	{"dr0", REGISTER_DR0},
+	{"fs", REGISTER_FS},
+	{"zf", REGISTER_ZF},
+	{"dr7", REGISTER_DR7},
+	{NULL, 0},
+	{"idtr", REGISTER_IDTR},
+	{"dh", REGISTER_DH},
+	{NULL, 0},
+	{NULL, 0},
+	{"r13w", REGISTER_R13W},
+	{"id", REGISTER_ID},
+	{NULL, 0},
+	{"ecx", REGISTER_ECX},
+	{"esp", REGISTER_ESP},
+	{NULL, 0},
+	{"eflags", REGISTER_EFLAGS},
+	{"r10", REGISTER_R10},
+	{NULL, 0},
+	{"di", REGISTER_DI},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"r9d", REGISTER_R9D},
+	{NULL, 0},
+	{NULL, 0},
+	{"sf", REGISTER_SF},
+	{NULL, 0},
+	{"r8", REGISTER_R8},
+	{NULL, 0},
+	{"r15d", REGISTER_R15D},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"bp", REGISTER_BP},
+	{NULL, 0},
+	{NULL, 0},
+	{"ds", REGISTER_DS},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"r14w", REGISTER_R14W},
+	{"r15w", REGISTER_R15W},
+	{NULL, 0},
+	{"edx", REGISTER_EDX},
+	{"bx", REGISTER_BX},
+	{NULL, 0},
+	{"edi", REGISTER_EDI},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"dil", REGISTER_DIL},
+	{"es", REGISTER_ES},
+	{NULL, 0},
+	{"ebp", REGISTER_EBP},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"r12d", REGISTER_R12D},
+	{NULL, 0},
+	{"cs", REGISTER_CS},
+	{"bl", REGISTER_BL},
+	{"gdtr", REGISTER_GDTR},
+	{"dl", REGISTER_DL},
+	{"cr4", REGISTER_CR4},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"r8d", REGISTER_R8D},
+	{NULL, 0},
+	{"vif", REGISTER_VIF},
+	{"r10w", REGISTER_R10W},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"r12", REGISTER_R12},
+	{"r12h", REGISTER_R12H},
+	{"sil", REGISTER_SIL},
+	{"rip", REGISTER_RIP},
+	{"r14d", REGISTER_R14D},
+	{NULL, 0},
+	{"dr3", REGISTER_DR3},
+	{NULL, 0},
+	{"rbx", REGISTER_RBX},
+	{NULL, 0},
+	{"r12l", REGISTER_R12L},
+	{"r11", REGISTER_R11},
+	{"vm", REGISTER_VM},
+	{"rdi", REGISTER_RDI},
+	{"flags", REGISTER_FLAGS},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"ebx", REGISTER_EBX},
+	{NULL, 0},
+	{"ah", REGISTER_AH},
+	{"dr6", REGISTER_DR6},
+	{"df", REGISTER_DF}
+};
+const PERFECT_HASH_TABLE RegisterHashTable= {RegisterHashTableSeeds, 31, RegisterHashTableEntries, 255};
+const unsigned int PseudoRegisterHashTableSeeds[4]= 
+{
+	6, 3, 1, 7
+};
+const SYMBOL_MAP PseudoRegisterHashTableEntries[32]= 
+{
+	{"event_tag", PSEUDO_REGISTER_EVENT_TAG},
+	{NULL, 0},
+	{NULL, 0},
+	{"context", PSEUDO_REGISTER_CONTEXT},
+	{"ip", PSEUDO_REGISTER_IP},
+	{"teb", PSEUDO_REGISTER_TEB},
+	{NULL, 0},
+	{NULL, 0},
+	{"proc", PSEUDO_REGISTER_PROC},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"tid", PSEUDO_REGISTER_TID},
+	{"date", PSEUDO_REGISTER_DATE},
+	{NULL, 0},
+	{"core", PSEUDO_REGISTER_CORE},
+	{NULL, 0},
+	{"time", PSEUDO_REGISTER_TIME},
+	{"event_id", PSEUDO_REGISTER_EVENT_ID},
+	{NULL, 0},
+	{"pid", PSEUDO_REGISTER_PID},
+	{NULL, 0},
+	{"thread", PSEUDO_REGISTER_THREAD},
+	{NULL, 0},
+	{"pname", PSEUDO_REGISTER_PNAME},
+	{NULL, 0},
+	{"event_stage", PSEUDO_REGISTER_EVENT_STAGE},
+	{NULL, 0},
+	{"peb", PSEUDO_REGISTER_PEB},
+	{NULL, 0},
+	{"buffer", PSEUDO_REGISTER_BUFFER}
+};
+const PERFECT_HASH_TABLE PseudoRegisterHashTable= {PseudoRegisterHashTableSeeds, 3, PseudoRegisterHashTableEntries, 31};
+const unsigned int TerminalHashTableSeeds[64]= 
+{
+	0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 2, 1, 3, 1, 1,
+	1, 1, 2, 1, 1, 1, 2, 1, 1, 2, 3, 1, 0, 0, 1, 1,
+	1, 3, 1, 1, 3, 1, 4, 1, 1, 1, 1, 3, 5, 1, 0, 2,
+	3, 1, 1, 1, 1, 0, 1, 1, 1, 0, 4, 1, 2, 1, 2, 4
+};
+const SYMBOL_MAP TerminalHashTableEntries[512]= 
+{
+	{"lbr_dump", 98},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"flush", 86},
+	{"_register", 42},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_hex", 38},
+	{NULL, 0},
+	{NULL, 0},
+	{"percpu", 112},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{".", 19},
+	{"lbr_print", 99},
+	{NULL, 0},
+	{"not", 110},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"-=", 17},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_binary", 32},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"db", 54},
+	{")", 8},
+	{NULL, 0},
+	{"if", 91},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_pseudo_register", 41},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{">>", 26},
+	{"rdtsc", 118},
+	{NULL, 0},
+	{NULL, 0},
+	{"_octal", 40},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"!", 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"rdtscp", 119},
+	{NULL, 0},
+	{NULL, 0},
+	{"check_address", 52},
+	{"pause", 111},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"spinlock_lock", 123},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"ed", 68},
+	{"event_sc", 80},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_decimal", 33},
+	{NULL, 0},
+	{NULL, 0},
+	{"^", 30},
+	{NULL, 0},
+	{"interlocked_exchange", 94},
+	{NULL, 0},
+	{NULL, 0},
+	{"dd_pa", 57},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"dq", 62},
+	{NULL, 0},
+	{"++", 12},
+	{NULL, 0},
+	{"hi_pa", 90},
+	{"event_trace_step_in", 84},
+	{NULL, 0},
+	{"lbr_restore_by_filter", 101},
+	{"event_enable", 77},
+	{NULL, 0},
+	{"]", 29},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"{", 137},
+	{"event_trace_instrumentation_step", 81},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"eq", 73},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"formats", 88},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"strcmp", 126},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"lbr_check", 97},
+	{"agg_hist", 47},
+	{NULL, 0},
+	{"agg_min", 49},
+	{NULL, 0},
+	{"agg_max", 48},
+	{NULL, 0},
+	{"struct", 129},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"neg", 109},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"typedef", 131},
+	{"wcsncmp", 135},
+	{"&=", 6},
+	{NULL, 0},
+	{"_function_id", 35},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"+=", 13},
+	{"elsif", 71},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"%", 3},
+	{NULL, 0},
+	{NULL, 0},
+	{"_string", 44},
+	{"lbr_save", 102},
+	{NULL, 0},
+	{"virtual_to_physical", 132},
+	{NULL, 0},
+	{"+", 11},
+	{"event_trace_instrumentation_step_in", 82},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"hi", 89},
+	{NULL, 0},
+	{NULL, 0},
+	{"db_pa", 55},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"event_inject_error_code", 79},
+	{"_local_id", 39},
+	{NULL, 0},
+	{"interlocked_decrement", 93},
+	{"eb_pa", 67},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"dq_pa", 63},
+	{"_wstring", 45},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"microsleep", 108},
+	{NULL, 0},
+	{"while", 136},
+	{"dw", 64},
+	{"dd", 56},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"print", 116},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{">>=", 27},
+	{NULL, 0},
+	{NULL, 0},
+	{"emit", 72},
+	{NULL, 0},
+	{NULL, 0},
+	{"#include", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"lbr_restore", 100},
+	{NULL, 0},
+	{"disassemble_len64", 60},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_script_variable_type", 43},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"event_trace_step", 83},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{",", 14},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"event_inject", 78},
+	{"wcslen", 134},
+	{"/=", 21},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"sizeof", 122},
+	{"_global_id", 37},
+	{"test_statement", 130},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"$", 2},
+	{"}", 140},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"printf", 117},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"ed_pa", 69},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_function_parameter_id", 36},
+	{NULL, 0},
+	{"agg_count", 46},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"low", 103},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"|", 138},
+	{NULL, 0},
+	{"physical_to_virtual", 113},
+	{"memcpy", 106},
+	{"[", 28},
+	{NULL, 0},
+	{"poi_pa", 115},
+	{NULL, 0},
+	{"strlen", 127},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"/", 20},
+	{"disassemble_len32", 59},
+	{"event_clear", 75},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"interlocked_exchange_add", 95},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"%=", 4},
+	{NULL, 0},
+	{NULL, 0},
+	{"--", 16},
+	{"else", 70},
+	{NULL, 0},
+	{NULL, 0},
+	{"for", 87},
+	{NULL, 0},
+	{NULL, 0},
+	{"<<", 23},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"->", 18},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"interlocked_compare_exchange", 92},
+	{"disassemble_len", 58},
+	{"interlocked_increment", 96},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"*=", 10},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"reference", 120},
+	{NULL, 0},
+	{"*", 9},
+	{"low_pa", 104},
+	{"wcscmp", 133},
+	{";", 22},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"event_disable", 76},
+	{"eb", 66},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"continue", 53},
+	{NULL, 0},
+	{"-", 15},
+	{NULL, 0},
+	{"memcpy_pa", 107},
+	{NULL, 0},
+	{"memcmp", 105},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"&", 5},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"=", 25},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"event_trace_step_out", 85},
+	{"eq_pa", 74},
+	{NULL, 0},
+	{NULL, 0},
+	{"do", 61},
+	{NULL, 0},
+	{"strncmp", 128},
+	{"~", 141},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_float", 34},
+	{NULL, 0},
+	{"break", 51},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"return", 121},
+	{NULL, 0},
+	{NULL, 0},
+	{"poi", 114},
+	{"<<=", 24},
+	{"spinlock_lock_custom_wait", 124},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"spinlock_unlock", 125},
+	{NULL, 0},
+	{"|=", 139},
+	{"^=", 31},
+	{NULL, 0},
+	{"(", 7},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"agg_sum", 50},
+	{"dw_pa", 65},
+	{NULL, 0}
+};
+const PERFECT_HASH_TABLE TerminalHashTable= {TerminalHashTableSeeds, 63, TerminalHashTableEntries, 511};
+const unsigned int NonTerminalHashTableSeeds[32]= 
+{
+	1, 1, 2, 0, 1, 5, 4, 1, 1, 1, 1, 1, 2, 2, 1, 1,
+	3, 1, 0, 0, 2, 4, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1
+};
+const SYMBOL_MAP NonTerminalHashTableEntries[256]= 
+{
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"E2", 21},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"VARIABLE_TYPE2", 84},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"VA", 80},
+	{NULL, 0},
+	{NULL, 0},
+	{"TYPEDEF_DECLARATION", 79},
+	{"INIT_ITEM", 38},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"VARIABLE_TYPE1", 83},
+	{"VARIABLE_TYPE5", 87},
+	{"STATEMENT2", 57},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"STRUCT_ARRAY_DIMS", 59},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"SIMPLE_ASSIGNMENT", 52},
+	{NULL, 0},
+	{"ARRAY_DIMS_WRITE", 5},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"CONST_NUMBER", 15},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"ARRAY_DIMS_READ_OPT", 4},
+	{NULL, 0},
+	{"END_OF_IF", 32},
+	{NULL, 0},
+	{"ARRAY_DIMS_WRITE_OPT", 7},
+	{"STRING", 58},
+	{NULL, 0},
+	{"STRUCT_DECLARATOR", 64},
+	{"E5'", 28},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"SIZEOF_UNPAREN", 55},
+	{"CALL_FUNC_STATEMENT", 12},
+	{"STRUCT_INITIALIZER_ITEM", 68},
+	{"RETURN", 49},
+	{"E5", 27},
+	{"STRUCT_SCALAR_TYPE2", 76},
+	{"S2", 51},
+	{"INC_DEC'", 37},
+	{"ASSIGNMENT_STATEMENT", 9},
+	{"STRUCT_INITIALIZER_LIST2", 70},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"STATEMENT", 56},
+	{NULL, 0},
+	{NULL, 0},
+	{"VA2", 81},
+	{NULL, 0},
+	{"STRUCT_MEMBER_LIST", 72},
+	{NULL, 0},
+	{NULL, 0},
+	{"STRUCT_DECLARATION2", 61},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"DO_WHILE_STATEMENT", 16},
+	{NULL, 0},
+	{"STRUCT_DECLARATION", 60},
+	{"ARRAY_DIMS_WRITE2", 6},
+	{NULL, 0},
+	{"ARRAY_INIT", 8},
+	{NULL, 0},
+	{"STRUCT_MEMBER_TYPE", 73},
+	{NULL, 0},
+	{"ARRAY_DIMS2", 1},
+	{"STRUCT_DECLARATOR_LIST2", 66},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"E1", 18},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"STRUCT_SCALAR_TYPE", 75},
+	{NULL, 0},
+	{"WHILE_STATEMENT", 89},
+	{NULL, 0},
+	{"CAST_POINTERS", 13},
+	{NULL, 0},
+	{NULL, 0},
+	{"INIT_LIST_CONT", 40},
+	{NULL, 0},
+	{"L_VALUE", 42},
+	{"ASSIGNMENT_STATEMENT'", 10},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"E2'", 22},
+	{NULL, 0},
+	{"ELSIF_STATEMENT'", 31},
+	{"WSTRING", 90},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"CAST_TYPE_REST", 14},
+	{NULL, 0},
+	{"FOR_STATEMENT", 34},
+	{NULL, 0},
+	{NULL, 0},
+	{"MULTIPLE_ASSIGNMENT2", 46},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"ARRAY_DIMS_READ2", 3},
+	{NULL, 0},
+	{"PAREN_EXPRESSION", 47},
+	{NULL, 0},
+	{"ELSIF_STATEMENT", 30},
+	{NULL, 0},
+	{NULL, 0},
+	{"STRUCT_DECLARATION_END", 62},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"E4", 25},
+	{"E4'", 26},
+	{"StringNumber", 77},
+	{NULL, 0},
+	{"INC_DEC", 36},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"STRUCT_DECLARATION_INITIALIZER", 63},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"SIZEOF_PAREN", 54},
+	{NULL, 0},
+	{"EXPRESSION", 33},
+	{"ELSE_STATEMENT", 29},
+	{NULL, 0},
+	{"MULTIPLE_ASSIGNMENT", 45},
+	{NULL, 0},
+	{"STRUCT_DECLARATOR_LIST", 65},
+	{NULL, 0},
+	{"SIZEOF_OPERAND", 53},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"E0'", 17},
+	{"STRUCT_DEFINITION_TAIL", 67},
+	{"MEMBER_LVALUE_SUFFIX", 43},
+	{NULL, 0},
+	{"STRUCT_POINTERS", 74},
+	{NULL, 0},
+	{"E1'", 19},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"E12", 20},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"ARRAY_DIMS", 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"ARRAY_DIMS_READ", 2},
+	{NULL, 0},
+	{"INIT_LIST", 39},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"E3'", 24},
+	{NULL, 0},
+	{"VARIABLE_TYPE6", 88},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"VARIABLE_TYPE3", 85},
+	{"BOOLEAN_EXPRESSION", 11},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"MEMBER_READ_SUFFIX", 44},
+	{"E3", 23},
+	{NULL, 0},
+	{"STRUCT_INITIALIZER_LIST", 69},
+	{"S", 50},
+	{NULL, 0},
+	{"INIT_LIST_TAIL", 41},
+	{"PERCPU_DECLARATION_LIST", 48},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"VARIABLE_TYPE4", 86},
+	{NULL, 0},
+	{NULL, 0},
+	{"VA3", 82},
+	{"WstringNumber", 91},
+	{"STRUCT_MEMBER", 71},
+	{"TYPEDEF_BASE_TYPE", 78},
+	{"IF_STATEMENT", 35},
+	{NULL, 0}
+};
+const PERFECT_HASH_TABLE NonTerminalHashTable= {NonTerminalHashTableSeeds, 31, NonTerminalHashTableEntries, 255};
+const unsigned int LalrTerminalHashTableSeeds[32]= 
+{
+	1, 1, 1, 2, 2, 1, 4, 4, 3, 1, 1, 2, 2, 1, 1, 1,
+	1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 4, 5, 2, 1, 7, 4
+};
+const SYMBOL_MAP LalrTerminalHashTableEntries[256]= 
+{
+	{"lbr_dump", 65},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_hex", 31},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_register", 35},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"struct", 85},
+	{"lbr_restore", 67},
+	{NULL, 0},
+	{"disassemble_len64", 46},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_script_variable_type", 36},
+	{NULL, 0},
+	{".", 13},
+	{"lbr_print", 66},
+	{NULL, 0},
+	{"not", 74},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"lbr_check", 64},
+	{NULL, 0},
+	{NULL, 0},
+	{"db", 40},
+	{"_binary", 25},
+	{"eb", 51},
+	{NULL, 0},
+	{NULL, 0},
+	{"!=", 1},
+	{"wcslen", 88},
+	{"_wstring", 38},
+	{NULL, 0},
+	{NULL, 0},
+	{")", 7},
+	{NULL, 0},
+	{"|", 90},
+	{NULL, 0},
+	{NULL, 0},
+	{"sizeof", 81},
+	{"_global_id", 30},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_pseudo_register", 34},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"neg", 73},
+	{NULL, 0},
+	{NULL, 0},
+	{"rdtsc", 78},
+	{NULL, 0},
+	{NULL, 0},
+	{"_octal", 33},
+	{NULL, 0},
+	{"interlocked_compare_exchange", 59},
+	{NULL, 0},
+	{">=", 20},
+	{NULL, 0},
+	{"!", 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"rdtscp", 79},
+	{"dw", 49},
+	{NULL, 0},
+	{"check_address", 39},
+	{NULL, 0},
+	{"<", 15},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"ed", 53},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"wcscmp", 87},
+	{"_decimal", 26},
+	{"physical_to_virtual", 75},
+	{NULL, 0},
+	{"^", 24},
+	{NULL, 0},
+	{"interlocked_exchange", 61},
+	{NULL, 0},
+	{"strlen", 83},
+	{"dd_pa", 43},
+	{NULL, 0},
+	{NULL, 0},
+	{"/", 14},
+	{"disassemble_len32", 45},
+	{"poi", 76},
+	{NULL, 0},
+	{NULL, 0},
+	{"dq", 47},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"hi_pa", 58},
+	{"eb_pa", 52},
+	{NULL, 0},
+	{"lbr_restore_by_filter", 68},
+	{"low", 70},
+	{"~", 92},
+	{"]", 23},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"<<", 16},
+	{NULL, 0},
+	{">>", 21},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"ed_pa", 54},
+	{NULL, 0},
+	{NULL, 0},
+	{"interlocked_increment", 63},
+	{NULL, 0},
+	{"disassemble_len", 44},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"reference", 80},
+	{NULL, 0},
+	{"*", 8},
+	{"low_pa", 71},
+	{"eq", 55},
+	{"->", 12},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_string", 37},
+	{NULL, 0},
+	{NULL, 0},
+	{"==", 18},
+	{NULL, 0},
+	{"wcsncmp", 89},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{",", 10},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"-", 11},
+	{NULL, 0},
+	{"_function_id", 28},
+	{"<=", 17},
+	{"memcmp", 72},
+	{NULL, 0},
+	{"strcmp", 82},
+	{NULL, 0},
+	{"&", 4},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"||", 91},
+	{NULL, 0},
+	{"interlocked_exchange_add", 62},
+	{"[", 22},
+	{NULL, 0},
+	{NULL, 0},
+	{"lbr_save", 69},
+	{NULL, 0},
+	{"%", 3},
+	{"eq_pa", 56},
+	{"+", 9},
+	{"strncmp", 84},
+	{NULL, 0},
+	{NULL, 0},
+	{">", 19},
+	{"hi", 57},
+	{"$", 2},
+	{"poi_pa", 77},
+	{"db_pa", 41},
+	{NULL, 0},
+	{"&&", 5},
+	{NULL, 0},
+	{NULL, 0},
+	{"_local_id", 32},
+	{"dw_pa", 50},
+	{"interlocked_decrement", 60},
+	{NULL, 0},
+	{"_float", 27},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_function_parameter_id", 29},
+	{NULL, 0},
+	{"dq_pa", 48},
+	{"(", 6},
+	{"virtual_to_physical", 86},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"dd", 42}
+};
+const PERFECT_HASH_TABLE LalrTerminalHashTable= {LalrTerminalHashTableSeeds, 31, LalrTerminalHashTableEntries, 255};
+const unsigned int LalrNonTerminalHashTableSeeds[16]= 
+{
+	3, 1, 2, 1, 0, 3, 1, 1, 1, 0, 2, 1, 1, 3, 2, 1
+};
+const SYMBOL_MAP LalrNonTerminalHashTableEntries[128]= 
+{
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"CAST_TYPE_REST", 14},
+	{NULL, 0},
+	{NULL, 0},
+	{"VA3", 34},
+	{NULL, 0},
+	{"WSTRING", 35},
+	{NULL, 0},
+	{NULL, 0},
+	{"BE", 10},
+	{"B4", 7},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"B6", 9},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"CMP", 15},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"E4", 20},
+	{NULL, 0},
+	{"E10", 16},
+	{"E3", 19},
+	{"STRUCT_CAST_TYPE", 31},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"StringNumber", 32},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"ARRAY4", 3},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"ARRAY1", 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"CAST_OR_BOOLEAN", 11},
+	{NULL, 0},
+	{"LOGICAL_AND_BEGIN", 23},
+	{"STRING", 30},
+	{"E13", 18},
+	{"ARRAY3", 2},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"VA2", 33},
+	{"E12", 17},
+	{NULL, 0},
+	{NULL, 0},
+	{"SIZEOF_BEGIN", 27},
+	{NULL, 0},
+	{"B2", 5},
+	{"CAST_TYPE", 13},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"EXP", 22},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"LOGICAL_OR_BEGIN", 24},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"B5", 8},
+	{"SIZEOF_VALUE", 29},
+	{NULL, 0},
+	{"B3", 6},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"E5", 21},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"S", 26},
+	{NULL, 0},
+	{"ARRAY2", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"SIZEOF_PAREN", 28},
+	{"CAST_POINTERS", 12},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"WstringNumber", 36},
+	{NULL, 0},
+	{"MEMBER_NAME", 25},
+	{NULL, 0},
+	{"B1", 4}
+};
+const PERFECT_HASH_TABLE LalrNonTerminalHashTable= {LalrNonTerminalHashTableSeeds, 15, LalrNonTerminalHashTableEntries, 127};
 const struct _SCRIPT_ENGINE_TOKEN LalrLhs[RULES_COUNT]= 
 {
 	{NON_TERMINAL, "S"},
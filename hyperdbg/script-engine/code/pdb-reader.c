@@ -0,0 +1,1806 @@
+/**
+ * @file pdb-reader.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Memory-mapped reader of the PDB (MSF) files
+ * @details The symbol backend of Linux reads the PDB files of the Windows
+ * debuggees by this reader instead of DbgHelp. The file is mapped and only
+ * its directory is read when it's opened; the publics, the globals, the
+ * symbol records, the modules and the types (TPI) are read and indexed when
+ * they are first used. The streams whose blocks are contiguous in the file
+ * are used in place, so most of the streams are never copied
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+#ifdef __linux__
+
+#    include <fcntl.h>
+#    include <strings.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+
+/**
+ * @brief Read a 16-bit value of the file
+ *
+ * @param Data
+ * @return UINT16
+ */
+static UINT16
+PdbRead16(const BYTE * Data)
+{
+    UINT16 Value;
+
+    memcpy(&Value, Data, sizeof(Value));
+
+    return Value;
+}
+
+/**
+ * @brief Read a 32-bit value of the file
+ *
+ * @param Data
+ * @return UINT32
+ */
+static UINT32
+PdbRead32(const BYTE * Data)
+{
+    UINT32 Value;
+
+    memcpy(&Value, Data, sizeof(Value));
+
+    return Value;
+}
+
+/**
+ * @brief Check whether the range [Offset, Offset + Length) is in a buffer
+ *
+ * @param Size
+ * @param Offset
+ * @param Length
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbHasRange(UINT64 Size, UINT64 Offset, UINT64 Length)
+{
+    return Offset <= Size && Length <= Size - Offset;
+}
+
+/**
+ * @brief Get the length of a null-terminated name of a record
+ *
+ * @param Data
+ * @param Size the size of the record after the name
+ * @param Length the length of the name (without the null)
+ * @return BOOLEAN FALSE if the name is not terminated in the record
+ */
+static BOOLEAN
+PdbGetNameLength(const BYTE * Data, UINT32 Size, UINT32 * Length)
+{
+    const BYTE * End = memchr(Data, '\0', Size);
+
+    if (End == NULL)
+    {
+        return FALSE;
+    }
+
+    *Length = (UINT32)(End - Data);
+
+    return TRUE;
+}
+
+/**
+ * @brief Hash of the names (hashStringV1 of the PDB files)
+ * @details The hash is case-insensitive for the letters, the same as the
+ * lookups of DbgHelp
+ *
+ * @param Name
+ * @param Length
+ * @return UINT32
+ */
+static UINT32
+PdbHashName(const CHAR * Name, UINT32 Length)
+{
+    const BYTE * Data   = (const BYTE *)Name;
+    UINT32       Result = 0;
+
+    while (Length >= 4)
+    {
+        Result ^= PdbRead32(Data);
+        Data += 4;
+        Length -= 4;
+    }
+
+    if (Length >= 2)
+    {
+        Result ^= PdbRead16(Data);
+        Data += 2;
+        Length -= 2;
+    }
+
+    if (Length == 1)
+    {
+        Result ^= *Data;
+    }
+
+    Result |= 0x20202020;
+    Result ^= (Result >> 11);
+
+    return Result ^ (Result >> 16);
+}
+
+/**
+ * @brief Read a numeric leaf of the type records
+ *
+ * @param Data
+ * @param Size
+ * @param Value
+ * @param Length the length of the leaf
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbReadNumeric(const BYTE * Data, UINT32 Size, UINT64 * Value, UINT32 * Length)
+{
+    UINT16 Leaf;
+
+    if (Size < sizeof(UINT16))
+    {
+        return FALSE;
+    }
+
+    Leaf = PdbRead16(Data);
+
+    if (Leaf < PDB_LF_NUMERIC)
+    {
+        *Value  = Leaf;
+        *Length = sizeof(UINT16);
+        return TRUE;
+    }
+
+    switch (Leaf)
+    {
+    case PDB_LF_CHAR:
+        *Length = 3;
+        break;
+    case PDB_LF_SHORT:
+    case PDB_LF_USHORT:
+        *Length = 4;
+        break;
+    case PDB_LF_LONG:
+    case PDB_LF_ULONG:
+        *Length = 6;
+        break;
+    case PDB_LF_QUADWORD:
+    case PDB_LF_UQUADWORD:
+        *Length = 10;
+        break;
+    default:
+        return FALSE;
+    }
+
+    if (Size < *Length)
+    {
+        return FALSE;
+    }
+
+    switch (Leaf)
+    {
+    case PDB_LF_CHAR:
+        *Value = (UINT64)(INT64)(INT8)Data[2];
+        break;
+    case PDB_LF_SHORT:
+        *Value = (UINT64)(INT64)(INT16)PdbRead16(Data + 2);
+        break;
+    case PDB_LF_USHORT:
+        *Value = PdbRead16(Data + 2);
+        break;
+    case PDB_LF_LONG:
+        *Value = (UINT64)(INT64)(INT32)PdbRead32(Data + 2);
+        break;
+    case PDB_LF_ULONG:
+        *Value = PdbRead32(Data + 2);
+        break;
+    default:
+        memcpy(Value, Data + 2, sizeof(UINT64));
+        break;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Get a stream of the file
+ * @details The stream is read when it's first used
+ *
+ * @param Pdb
+ * @param Index
+ * @return PPDB_STREAM NULL if the stream is not present or it's invalid
+ */
+static PPDB_STREAM
+PdbGetStream(PPDB_FILE Pdb, UINT32 Index)
+{
+    PPDB_STREAM    Stream;
+    const UINT32 * Blocks;
+    UINT32         Size;
+    UINT32         BlocksCount;
+    BOOLEAN        IsContiguous = TRUE;
+    BYTE *         Buffer;
+
+    if (Index >= Pdb->StreamsCount)
+    {
+        return NULL;
+    }
+
+    Stream = &Pdb->Streams[Index];
+
+    if (Stream->IsLoaded)
+    {
+        return Stream->Data == NULL && Stream->Size != 0 ? NULL : Stream;
+    }
+
+    Stream->IsLoaded = TRUE;
+
+    Size = Pdb->StreamSizes[Index];
+
+    if (Size == 0 || Size == 0xffffffff)
+    {
+        return Stream;
+    }
+
+    Blocks      = Pdb->StreamBlocks + Pdb->StreamFirstBlocks[Index];
+    BlocksCount = (UINT32)(((UINT64)Size + Pdb->BlockSize - 1) / Pdb->BlockSize);
+
+    for (UINT32 i = 0; i < BlocksCount; i++)
+    {
+        if (Blocks[i] >= Pdb->BlocksCount)
+        {
+            Stream->Size = Size;
+            return NULL;
+        }
+
+        if (i != 0 && Blocks[i] != Blocks[i - 1] + 1)
+        {
+            IsContiguous = FALSE;
+        }
+    }
+
+    if (IsContiguous && PdbHasRange(Pdb->MappingSize, (UINT64)Blocks[0] * Pdb->BlockSize, Size))
+    {
+        //
+        // The stream is used in place
+        //
+        Stream->Data = Pdb->Mapping + (SIZE_T)Blocks[0] * Pdb->BlockSize;
+        Stream->Size = Size;
+
+        return Stream;
+    }
+
+    Buffer = malloc(Size);
+
+    if (Buffer == NULL)
+    {
+        Stream->Size = Size;
+        return NULL;
+    }
+
+    for (UINT32 i = 0; i < BlocksCount; i++)
+    {
+        UINT32 Offset = i * Pdb->BlockSize;
+        UINT32 Length = Size - Offset < Pdb->BlockSize ? Size - Offset : Pdb->BlockSize;
+
+        if (!PdbHasRange(Pdb->MappingSize, (UINT64)Blocks[i] * Pdb->BlockSize, Length))
+        {
+            free(Buffer);
+            Stream->Size = Size;
+            return NULL;
+        }
+
+        memcpy(Buffer + Offset, Pdb->Mapping + (SIZE_T)Blocks[i] * Pdb->BlockSize, Length);
+    }
+
+    Stream->Data        = Buffer;
+    Stream->Size        = Size;
+    Stream->IsAllocated = TRUE;
+
+    return Stream;
+}
+
+/**
+ * @brief Read the directory of the MSF container
+ *
+ * @param Pdb
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbReadDirectory(PPDB_FILE Pdb)
+{
+    const BYTE * Header = Pdb->Mapping;
+    UINT32       DirectorySize;
+    UINT32       DirectoryBlocksCount;
+    UINT32       BlockMapBlock;
+    const BYTE * BlockMap;
+    UINT32       TotalBlocks = 0;
+    UINT32       Offset;
+
+    Pdb->BlockSize   = PdbRead32(Header + 32);
+    Pdb->BlocksCount = PdbRead32(Header + 40);
+    DirectorySize    = PdbRead32(Header + 44);
+    BlockMapBlock    = PdbRead32(Header + 52);
+
+    if (Pdb->BlockSize != 512 && Pdb->BlockSize != 1024 && Pdb->BlockSize != 2048 && Pdb->BlockSize != 4096)
+    {
+        return FALSE;
+    }
+
+    if ((UINT64)Pdb->BlocksCount * Pdb->BlockSize > Pdb->MappingSize)
+    {
+        Pdb->BlocksCount = (UINT32)(Pdb->MappingSize / Pdb->BlockSize);
+    }
+
+    DirectoryBlocksCount = (DirectorySize + Pdb->BlockSize - 1) / Pdb->BlockSize;
+
+    if (DirectorySize < sizeof(UINT32) ||
+        BlockMapBlock >= Pdb->BlocksCount ||
+        !PdbHasRange(Pdb->BlockSize, 0, (UINT64)DirectoryBlocksCount * sizeof(UINT32)))
+    {
+        return FALSE;
+    }
+
+    //
+    // Read the directory by the block map
+    //
+    BlockMap = Pdb->Mapping + (SIZE_T)BlockMapBlock * Pdb->BlockSize;
+
+    for (UINT32 i = 0; i < DirectoryBlocksCount; i++)
+    {
+        if (PdbRead32(BlockMap + i * sizeof(UINT32)) >= Pdb->BlocksCount)
+        {
+            return FALSE;
+        }
+    }
+
+    Pdb->Directory = malloc(DirectorySize);
+
+    if (Pdb->Directory == NULL)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < DirectoryBlocksCount; i++)
+    {
+        UINT32 Block  = PdbRead32(BlockMap + i * sizeof(UINT32));
+        UINT32 Length = DirectorySize - i * Pdb->BlockSize;
+
+        if (Length > Pdb->BlockSize)
+        {
+            Length = Pdb->BlockSize;
+        }
+
+        memcpy(Pdb->Directory + i * Pdb->BlockSize, Pdb->Mapping + (SIZE_T)Block * Pdb->BlockSize, Length);
+    }
+
+    //
+    // The directory is the number of the streams, their sizes and then the
+    // blocks of each stream
+    //
+    Pdb->StreamsCount = PdbRead32(Pdb->Directory);
+
+    if (!PdbHasRange(DirectorySize, sizeof(UINT32), (UINT64)Pdb->StreamsCount * sizeof(UINT32)))
+    {
+        return FALSE;
+    }
+
+    Pdb->StreamSizes       = (UINT32 *)(Pdb->Directory + sizeof(UINT32));
+    Pdb->StreamBlocks      = Pdb->StreamSizes + Pdb->StreamsCount;
+    Pdb->StreamFirstBlocks = malloc(Pdb->StreamsCount * sizeof(UINT32));
+    Pdb->Streams           = calloc(Pdb->StreamsCount, sizeof(PDB_STREAM));
+
+    if (Pdb->StreamFirstBlocks == NULL || Pdb->Streams == NULL)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < Pdb->StreamsCount; i++)
+    {
+        UINT32 Size = Pdb->StreamSizes[i];
+
+        Pdb->StreamFirstBlocks[i] = TotalBlocks;
+
+        if (Size != 0xffffffff)
+        {
+            TotalBlocks += (Size + Pdb->BlockSize - 1) / Pdb->BlockSize;
+        }
+    }
+
+    Offset = (1 + Pdb->StreamsCount) * sizeof(UINT32);
+
+    return PdbHasRange(DirectorySize, Offset, (UINT64)TotalBlocks * sizeof(UINT32));
+}
+
+/**
+ * @brief Read the PDB information stream and the header of the DBI stream
+ *
+ * @param Pdb
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbReadDbi(PPDB_FILE Pdb)
+{
+    PPDB_STREAM  Info = PdbGetStream(Pdb, PDB_STREAM_PDB_INFO);
+    PPDB_STREAM  Dbi  = PdbGetStream(Pdb, PDB_STREAM_DBI);
+    const BYTE * Data;
+    UINT64       Offset;
+    UINT32       ModulesInfoSize;
+    UINT32       DebugHeaderSize;
+
+    if (Info == NULL || Info->Size < 28 || Dbi == NULL || Dbi->Size < PDB_DBI_HEADER_SIZE)
+    {
+        return FALSE;
+    }
+
+    Pdb->Age = PdbRead32(Info->Data + 8);
+    memcpy(Pdb->Guid, Info->Data + 12, sizeof(Pdb->Guid));
+
+    Data = Dbi->Data;
+
+    Pdb->GlobalsStreamIndex        = PdbRead16(Data + 12);
+    Pdb->PublicsStreamIndex        = PdbRead16(Data + 16);
+    Pdb->SymbolRecordsStreamIndex  = PdbRead16(Data + 20);
+    Pdb->SectionHeadersStreamIndex = PDB_INVALID_STREAM;
+
+    //
+    // The substreams are the modules, the section contributions, the section
+    // map, the source files, the type servers, EC and then the optional
+    // debug header
+    //
+    ModulesInfoSize = PdbRead32(Data + 24);
+    DebugHeaderSize = PdbRead32(Data + 48);
+    Offset          = (UINT64)PDB_DBI_HEADER_SIZE + ModulesInfoSize + PdbRead32(Data + 28) +
+             PdbRead32(Data + 32) + PdbRead32(Data + 36) + PdbRead32(Data + 40) + PdbRead32(Data + 52);
+
+    if (PdbHasRange(Dbi->Size, PDB_DBI_HEADER_SIZE, ModulesInfoSize))
+    {
+        Pdb->ModulesInfo     = Data + PDB_DBI_HEADER_SIZE;
+        Pdb->ModulesInfoSize = ModulesInfoSize;
+    }
+
+    if (DebugHeaderSize >= (PDB_DBI_DEBUG_SECTION_INDEX + 1) * sizeof(UINT16) &&
+        PdbHasRange(Dbi->Size, Offset, DebugHeaderSize))
+    {
+        Pdb->SectionHeadersStreamIndex = PdbRead16(Data + Offset + PDB_DBI_DEBUG_SECTION_INDEX * sizeof(UINT16));
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Open a PDB file
+ *
+ * @param FilePath
+ * @return PPDB_FILE NULL if the file is not a valid PDB file
+ */
+PPDB_FILE
+PdbOpen(const CHAR * FilePath)
+{
+    PPDB_FILE   Pdb;
+    struct stat FileStat;
+    int         Fd;
+    void *      Mapping;
+
+    Fd = open(FilePath, O_RDONLY | O_CLOEXEC);
+
+    if (Fd < 0)
+    {
+        return NULL;
+    }
+
+    if (fstat(Fd, &FileStat) != 0 || FileStat.st_size < PDB_MSF_HEADER_SIZE)
+    {
+        close(Fd);
+        return NULL;
+    }
+
+    Mapping = mmap(NULL, (SIZE_T)FileStat.st_size, PROT_READ, MAP_PRIVATE, Fd, 0);
+    close(Fd);
+
+    if (Mapping == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    if (memcmp(Mapping, PDB_MSF_MAGIC, PDB_MSF_MAGIC_SIZE) != 0)
+    {
+        munmap(Mapping, (SIZE_T)FileStat.st_size);
+        return NULL;
+    }
+
+    Pdb = calloc(1, sizeof(PDB_FILE));
+
+    if (Pdb == NULL)
+    {
+        munmap(Mapping, (SIZE_T)FileStat.st_size);
+        return NULL;
+    }
+
+    Pdb->Mapping     = Mapping;
+    Pdb->MappingSize = (SIZE_T)FileStat.st_size;
+
+    if (!PdbReadDirectory(Pdb) || !PdbReadDbi(Pdb))
+    {
+        PdbClose(Pdb);
+        return NULL;
+    }
+
+    return Pdb;
+}
+
+/**
+ * @brief Close a PDB file
+ *
+ * @param Pdb
+ * @return VOID
+ */
+VOID
+PdbClose(PPDB_FILE Pdb)
+{
+    if (Pdb == NULL)
+    {
+        return;
+    }
+
+    if (Pdb->Streams != NULL)
+    {
+        for (UINT32 i = 0; i < Pdb->StreamsCount; i++)
+        {
+            if (Pdb->Streams[i].IsAllocated)
+            {
+                free((PVOID)Pdb->Streams[i].Data);
+            }
+        }
+
+        free(Pdb->Streams);
+    }
+
+    free(Pdb->Publics.BucketBegins);
+    free(Pdb->Publics.BucketEnds);
+    free(Pdb->Globals.BucketBegins);
+    free(Pdb->Globals.BucketEnds);
+    free(Pdb->ModuleStreams);
+    free(Pdb->TypeOffsets);
+    free(Pdb->TypeHashHeads);
+    free(Pdb->TypeHashNext);
+    free(Pdb->StreamFirstBlocks);
+
+    free(Pdb->Directory);
+
+    munmap(Pdb->Mapping, Pdb->MappingSize);
+
+    free(Pdb);
+}
+
+/**
+ * @brief Read the hash table of the publics or the globals stream
+ * @details The bitmap of the buckets is expanded to the first and the last
+ * hash record of each bucket
+ *
+ * @param Pdb
+ * @param Gsi
+ * @param StreamIndex
+ * @param HeaderSize the size of the header before the hash table
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbLoadGsi(PPDB_FILE Pdb, PPDB_GSI Gsi, UINT16 StreamIndex, UINT32 HeaderSize)
+{
+    PPDB_STREAM  Stream;
+    const BYTE * Data;
+    const BYTE * Bitmap;
+    const BYTE * Buckets;
+    UINT32       HashRecordsSize;
+    UINT32       BucketsSize;
+    UINT32       BucketsCount;
+    UINT32       Bucket = 0;
+    UINT32       Next;
+
+    if (Gsi->IsLoaded)
+    {
+        return Gsi->BucketBegins != NULL;
+    }
+
+    Gsi->IsLoaded = TRUE;
+
+    if (PdbGetStream(Pdb, Pdb->SymbolRecordsStreamIndex) == NULL)
+    {
+        return FALSE;
+    }
+
+    Stream = PdbGetStream(Pdb, StreamIndex);
+
+    if (Stream == NULL || !PdbHasRange(Stream->Size, HeaderSize, PDB_GSI_HEADER_SIZE))
+    {
+        return FALSE;
+    }
+
+    Data            = Stream->Data + HeaderSize;
+    HashRecordsSize = PdbRead32(Data + 8);
+    BucketsSize     = PdbRead32(Data + 12);
+
+    if (PdbRead32(Data) != PDB_GSI_SIGNATURE || PdbRead32(Data + 4) != PDB_GSI_VERSION ||
+        !PdbHasRange(Stream->Size - HeaderSize - PDB_GSI_HEADER_SIZE, 0, (UINT64)HashRecordsSize + BucketsSize) ||
+        BucketsSize < PDB_GSI_BITMAP_WORDS * sizeof(UINT32))
+    {
+        return FALSE;
+    }
+
+    Gsi->HashRecords      = Data + PDB_GSI_HEADER_SIZE;
+    Gsi->HashRecordsCount = HashRecordsSize / PDB_GSI_HASH_RECORD_SIZE;
+
+    Bitmap       = Gsi->HashRecords + HashRecordsSize;
+    Buckets      = Bitmap + PDB_GSI_BITMAP_WORDS * sizeof(UINT32);
+    BucketsCount = (BucketsSize - PDB_GSI_BITMAP_WORDS * sizeof(UINT32)) / sizeof(UINT32);
+
+    Gsi->BucketBegins = malloc((PDB_GSI_HASH_BUCKETS + 1) * sizeof(UINT32));
+    Gsi->BucketEnds   = malloc((PDB_GSI_HASH_BUCKETS + 1) * sizeof(UINT32));
+
+    if (Gsi->BucketBegins == NULL || Gsi->BucketEnds == NULL)
+    {
+        free(Gsi->BucketBegins);
+        free(Gsi->BucketEnds);
+        Gsi->BucketBegins = NULL;
+        Gsi->BucketEnds   = NULL;
+        return FALSE;
+    }
+
+    //
+    // Each set bit of the bitmap has the first hash record of its bucket
+    // (in the units of the 12-byte records of the memory of MSVC), and the
+    // bucket ends at the first hash record of the next bucket
+    //
+    for (UINT32 i = 0; i <= PDB_GSI_HASH_BUCKETS; i++)
+    {
+        if ((PdbRead32(Bitmap + (i / 32) * sizeof(UINT32)) & (1u << (i % 32))) && Bucket < BucketsCount)
+        {
+            UINT32 Begin = PdbRead32(Buckets + Bucket * sizeof(UINT32)) / PDB_GSI_BUCKET_ENTRY_SIZE;
+
+            Gsi->BucketBegins[i] = Begin < Gsi->HashRecordsCount ? Begin : Gsi->HashRecordsCount;
+            Bucket++;
+        }
+        else
+        {
+            Gsi->BucketBegins[i] = 0xffffffff;
+        }
+    }
+
+    Next = Gsi->HashRecordsCount;
+
+    for (INT32 i = PDB_GSI_HASH_BUCKETS; i >= 0; i--)
+    {
+        if (Gsi->BucketBegins[i] == 0xffffffff)
+        {
+            Gsi->BucketBegins[i] = 0;
+            Gsi->BucketEnds[i]   = 0;
+        }
+        else
+        {
+            if (Gsi->BucketBegins[i] > Next)
+            {
+                Gsi->BucketBegins[i] = Next;
+            }
+
+            Gsi->BucketEnds[i] = Next;
+            Next               = Gsi->BucketBegins[i];
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Get a record of the symbol records stream
+ *
+ * @param Pdb
+ * @param Offset
+ * @param Kind
+ * @param Size the size of the record (with its header)
+ * @return const BYTE * NULL if the record is invalid
+ */
+static const BYTE *
+PdbGetSymbolRecord(PPDB_FILE Pdb, UINT32 Offset, UINT16 * Kind, UINT32 * Size)
+{
+    PPDB_STREAM Stream = &Pdb->Streams[Pdb->SymbolRecordsStreamIndex];
+
+    if (!PdbHasRange(Stream->Size, Offset, 2 * sizeof(UINT16)))
+    {
+        return NULL;
+    }
+
+    *Size = PdbRead16(Stream->Data + Offset) + sizeof(UINT16);
+    *Kind = PdbRead16(Stream->Data + Offset + sizeof(UINT16));
+
+    if (!PdbHasRange(Stream->Size, Offset, *Size))
+    {
+        return NULL;
+    }
+
+    return Stream->Data + Offset;
+}
+
+/**
+ * @brief Get the name of a symbol record
+ *
+ * @param Record
+ * @param Kind
+ * @param Size
+ * @return const CHAR * NULL if the record doesn't have a name
+ */
+static const CHAR *
+PdbGetSymbolRecordName(const BYTE * Record, UINT16 Kind, UINT32 Size)
+{
+    UINT32 Offset;
+    UINT32 Length;
+
+    switch (Kind)
+    {
+    case PDB_S_PUB32:
+    case PDB_S_GDATA32:
+    case PDB_S_LDATA32:
+    case PDB_S_PROCREF:
+    case PDB_S_LPROCREF:
+        Offset = 14;
+        break;
+    case PDB_S_UDT:
+        Offset = 8;
+        break;
+    default:
+        return NULL;
+    }
+
+    if (Size <= Offset || !PdbGetNameLength(Record + Offset, Size - Offset, &Length))
+    {
+        return NULL;
+    }
+
+    return (const CHAR *)Record + Offset;
+}
+
+/**
+ * @brief Convert a section and an offset to a relative virtual address
+ * @details The section headers of the image are read when they're first used
+ *
+ * @param Pdb
+ * @param Section
+ * @param Offset
+ * @param Rva
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbSectionOffsetToRva(PPDB_FILE Pdb, UINT16 Section, UINT32 Offset, UINT32 * Rva)
+{
+    if (Pdb->SectionHeaders == NULL)
+    {
+        PPDB_STREAM Stream = PdbGetStream(Pdb, Pdb->SectionHeadersStreamIndex);
+
+        if (Stream == NULL || Stream->Size < PDB_SECTION_HEADER_SIZE)
+        {
+            return FALSE;
+        }
+
+        Pdb->SectionHeaders = Stream->Data;
+        Pdb->SectionsCount  = Stream->Size / PDB_SECTION_HEADER_SIZE;
+    }
+
+    if (Section == 0 || Section > Pdb->SectionsCount)
+    {
+        return FALSE;
+    }
+
+    //
+    // VirtualAddress of IMAGE_SECTION_HEADER
+    //
+    *Rva = PdbRead32(Pdb->SectionHeaders + (Section - 1) * PDB_SECTION_HEADER_SIZE + 12) + Offset;
+
+    return TRUE;
+}
+
+/**
+ * @brief Get the symbols stream of a module of the DBI stream
+ * @details The modules are indexed when they're first used
+ *
+ * @param Pdb
+ * @param Module the (zero-based) index of the module
+ * @return PPDB_STREAM
+ */
+static PPDB_STREAM
+PdbGetModuleStream(PPDB_FILE Pdb, UINT32 Module)
+{
+    if (Pdb->ModuleStreams == NULL)
+    {
+        UINT32 Offset = 0;
+        UINT32 Count  = 0;
+
+        //
+        // Each module is a fixed header and the names of the module and its
+        // object file, aligned to 4 bytes
+        //
+        Pdb->ModuleStreams = malloc((Pdb->ModulesInfoSize / PDB_DBI_MODULE_HEADER_SIZE + 1) * sizeof(UINT16));
+
+        if (Pdb->ModuleStreams == NULL)
+        {
+            return NULL;
+        }
+
+        while (PdbHasRange(Pdb->ModulesInfoSize, Offset, PDB_DBI_MODULE_HEADER_SIZE))
+        {
+            UINT32 Length;
+            UINT32 NamesOffset = Offset + PDB_DBI_MODULE_HEADER_SIZE;
+
+            Pdb->ModuleStreams[Count++] = PdbRead16(Pdb->ModulesInfo + Offset + 34);
+
+            for (UINT32 Name = 0; Name < 2; Name++)
+            {
+                if (!PdbGetNameLength(Pdb->ModulesInfo + NamesOffset, Pdb->ModulesInfoSize - NamesOffset, &Length))
+                {
+                    NamesOffset = Pdb->ModulesInfoSize;
+                    break;
+                }
+
+                NamesOffset += Length + 1;
+            }
+
+            Offset = (NamesOffset + 3) & ~3u;
+        }
+
+        Pdb->ModulesCount = Count;
+    }
+
+    if (Module >= Pdb->ModulesCount)
+    {
+        return NULL;
+    }
+
+    return PdbGetStream(Pdb, Pdb->ModuleStreams[Module]);
+}
+
+/**
+ * @brief Get the relative virtual address of a symbol record
+ * @details The references to the procedures are resolved by the symbols
+ * of their modules
+ *
+ * @param Pdb
+ * @param Record
+ * @param Kind
+ * @param Size
+ * @param Rva
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbGetSymbolRecordRva(PPDB_FILE Pdb, const BYTE * Record, UINT16 Kind, UINT32 Size, UINT32 * Rva)
+{
+    PPDB_STREAM Stream;
+    UINT32      Offset;
+    UINT16      ProcedureKind;
+
+    switch (Kind)
+    {
+    case PDB_S_PUB32:
+    case PDB_S_GDATA32:
+    case PDB_S_LDATA32:
+        return Size >= 14 && PdbSectionOffsetToRva(Pdb, PdbRead16(Record + 12), PdbRead32(Record + 8), Rva);
+
+    case PDB_S_PROCREF:
+    case PDB_S_LPROCREF:
+        if (Size < 14 || PdbRead16(Record + 12) == 0)
+        {
+            return FALSE;
+        }
+
+        Stream = PdbGetModuleStream(Pdb, PdbRead16(Record + 12) - 1);
+        Offset = PdbRead32(Record + 8);
+
+        if (Stream == NULL || !PdbHasRange(Stream->Size, Offset, 38))
+        {
+            return FALSE;
+        }
+
+        ProcedureKind = PdbRead16(Stream->Data + Offset + 2);
+
+        if (ProcedureKind != PDB_S_GPROC32 && ProcedureKind != PDB_S_LPROC32 &&
+            ProcedureKind != PDB_S_GPROC32_ID && ProcedureKind != PDB_S_LPROC32_ID)
+        {
+            return FALSE;
+        }
+
+        return PdbSectionOffsetToRva(Pdb, PdbRead16(Stream->Data + Offset + 36), PdbRead32(Stream->Data + Offset + 32), Rva);
+
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Find a record in the hash table of the publics or the globals
+ *
+ * @param Pdb
+ * @param Gsi
+ * @param Name
+ * @param IsType whether a type (S_UDT) or an address is searched
+ * @param Kind
+ * @param Size
+ * @return const BYTE * NULL if the name is not found
+ */
+static const BYTE *
+PdbFindGsiRecord(PPDB_FILE Pdb, PPDB_GSI Gsi, const CHAR * Name, BOOLEAN IsType, UINT16 * Kind, UINT32 * Size)
+{
+    UINT32 Bucket = PdbHashName(Name, (UINT32)strlen(Name)) % PDB_GSI_HASH_BUCKETS;
+
+    for (UINT32 i = Gsi->BucketBegins[Bucket]; i < Gsi->BucketEnds[Bucket]; i++)
+    {
+        UINT32       Offset = PdbRead32(Gsi->HashRecords + i * PDB_GSI_HASH_RECORD_SIZE);
+        const BYTE * Record;
+        const CHAR * RecordName;
+
+        if (Offset == 0)
+        {
+            continue;
+        }
+
+        Record = PdbGetSymbolRecord(Pdb, Offset - 1, Kind, Size);
+
+        if (Record == NULL || (*Kind == PDB_S_UDT) != IsType)
+        {
+            continue;
+        }
+
+        RecordName = PdbGetSymbolRecordName(Record, *Kind, *Size);
+
+        if (RecordName != NULL && strcasecmp(RecordName, Name) == 0)
+        {
+            return Record;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Find the address of a symbol
+ * @details The publics are searched first, and then the global data and
+ * the procedures of the globals
+ *
+ * @param Pdb
+ * @param Name
+ * @param Rva
+ * @return BOOLEAN
+ */
+BOOLEAN
+PdbFindSymbol(PPDB_FILE Pdb, const CHAR * Name, UINT32 * Rva)
+{
+    const BYTE * Record;
+    UINT16       Kind = 0;
+    UINT32       Size = 0;
+
+    if (PdbLoadGsi(Pdb, &Pdb->Publics, Pdb->PublicsStreamIndex, PDB_PUBLICS_HEADER_SIZE))
+    {
+        Record = PdbFindGsiRecord(Pdb, &Pdb->Publics, Name, FALSE, &Kind, &Size);
+
+        if (Record != NULL && PdbGetSymbolRecordRva(Pdb, Record, Kind, Size, Rva))
+        {
+            return TRUE;
+        }
+    }
+
+    if (PdbLoadGsi(Pdb, &Pdb->Globals, Pdb->GlobalsStreamIndex, 0))
+    {
+        Record = PdbFindGsiRecord(Pdb, &Pdb->Globals, Name, FALSE, &Kind, &Size);
+
+        if (Record != NULL && PdbGetSymbolRecordRva(Pdb, Record, Kind, Size, Rva))
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Enumerate the symbols that have an address
+ * @details The publics are enumerated first, and then the global data and
+ * the procedures of the globals that are not publics
+ *
+ * @param Pdb
+ * @param Callback
+ * @param Context
+ * @return VOID
+ */
+VOID
+PdbEnumerateSymbols(PPDB_FILE Pdb, PDB_SYMBOL_CALLBACK Callback, PVOID Context)
+{
+    BOOLEAN HasPublics = PdbLoadGsi(Pdb, &Pdb->Publics, Pdb->PublicsStreamIndex, PDB_PUBLICS_HEADER_SIZE);
+    BOOLEAN HasGlobals = PdbLoadGsi(Pdb, &Pdb->Globals, Pdb->GlobalsStreamIndex, 0);
+
+    for (UINT32 Table = 0; Table < 2; Table++)
+    {
+        PPDB_GSI Gsi = Table == 0 ? &Pdb->Publics : &Pdb->Globals;
+
+        if (Table == 0 ? !HasPublics : !HasGlobals)
+        {
+            continue;
+        }
+
+        for (UINT32 i = 0; i < Gsi->HashRecordsCount; i++)
+        {
+            UINT32       Offset = PdbRead32(Gsi->HashRecords + i * PDB_GSI_HASH_RECORD_SIZE);
+            const BYTE * Record;
+            const CHAR * Name;
+            UINT16       Kind;
+            UINT32       Size;
+            UINT32       Rva;
+
+            if (Offset == 0)
+            {
+                continue;
+            }
+
+            Record = PdbGetSymbolRecord(Pdb, Offset - 1, &Kind, &Size);
+
+            if (Record == NULL || Kind == PDB_S_UDT)
+            {
+                continue;
+            }
+
+            Name = PdbGetSymbolRecordName(Record, Kind, Size);
+
+            if (Name == NULL || !PdbGetSymbolRecordRva(Pdb, Record, Kind, Size, &Rva))
+            {
+                continue;
+            }
+
+            if (Table == 1 && HasPublics)
+            {
+                UINT16 PublicKind;
+                UINT32 PublicSize;
+
+                if (PdbFindGsiRecord(Pdb, &Pdb->Publics, Name, FALSE, &PublicKind, &PublicSize) != NULL)
+                {
+                    continue;
+                }
+            }
+
+            if (!Callback(Name, Rva, Context))
+            {
+                return;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Get a record of the types (TPI) stream
+ *
+ * @param Pdb
+ * @param TypeIndex
+ * @param Kind
+ * @param Size the size of the record after its kind
+ * @return const BYTE * the record after its kind, NULL if the type index is
+ * not a record
+ */
+static const BYTE *
+PdbGetTypeRecord(PPDB_FILE Pdb, UINT32 TypeIndex, UINT16 * Kind, UINT32 * Size)
+{
+    const BYTE * Record;
+
+    *Kind = 0;
+    *Size = 0;
+
+    if (TypeIndex < Pdb->TypeIndexBegin || TypeIndex >= Pdb->TypeIndexEnd)
+    {
+        return NULL;
+    }
+
+    Record = Pdb->TypeRecords + Pdb->TypeOffsets[TypeIndex - Pdb->TypeIndexBegin];
+    *Size  = PdbRead16(Record) - sizeof(UINT16);
+    *Kind  = PdbRead16(Record + sizeof(UINT16));
+
+    return Record + 2 * sizeof(UINT16);
+}
+
+/**
+ * @brief Parse a record of a user-defined type (structure, class,
+ * interface, union or enum)
+ *
+ * @param Kind
+ * @param Record
+ * @param Size
+ * @param Properties
+ * @param FieldList
+ * @param TypeSize the size of the type, or the underlying type of the enums
+ * @param Name
+ * @return BOOLEAN FALSE if the record is not a user-defined type
+ */
+static BOOLEAN
+PdbParseUdt(UINT16        Kind,
+            const BYTE *  Record,
+            UINT32        Size,
+            UINT16 *      Properties,
+            UINT32 *      FieldList,
+            UINT64 *      TypeSize,
+            const CHAR ** Name)
+{
+    UINT32 Offset;
+    UINT32 Length;
+
+    switch (Kind)
+    {
+    case PDB_LF_STRUCTURE:
+    case PDB_LF_CLASS:
+    case PDB_LF_INTERFACE:
+        Offset = 16;
+        break;
+    case PDB_LF_UNION:
+        Offset = 8;
+        break;
+    case PDB_LF_ENUM:
+        Offset = 12;
+        break;
+    default:
+        return FALSE;
+    }
+
+    if (Size < Offset)
+    {
+        return FALSE;
+    }
+
+    *Properties = PdbRead16(Record + 2);
+
+    if (Kind == PDB_LF_ENUM)
+    {
+        *TypeSize  = PdbRead32(Record + 4);
+        *FieldList = PdbRead32(Record + 8);
+    }
+    else
+    {
+        *FieldList = PdbRead32(Record + 4);
+
+        if (!PdbReadNumeric(Record + Offset, Size - Offset, TypeSize, &Length))
+        {
+            return FALSE;
+        }
+
+        Offset += Length;
+    }
+
+    if (Size <= Offset || !PdbGetNameLength(Record + Offset, Size - Offset, &Length))
+    {
+        return FALSE;
+    }
+
+    *Name = (const CHAR *)Record + Offset;
+
+    return TRUE;
+}
+
+/**
+ * @brief Index the records of the types (TPI) stream
+ * @details The offsets of all of the records and a hash table of the names
+ * of the user-defined types (without their forward references) are made
+ * when the types are first used
+ *
+ * @param Pdb
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbLoadTypes(PPDB_FILE Pdb)
+{
+    PPDB_STREAM  Stream;
+    const BYTE * Header;
+    UINT32       HeaderSize;
+    UINT32       Count;
+    UINT32       Offset = 0;
+
+    if (Pdb->IsTypesLoaded)
+    {
+        return Pdb->TypeOffsets != NULL;
+    }
+
+    Pdb->IsTypesLoaded = TRUE;
+
+    Stream = PdbGetStream(Pdb, PDB_STREAM_TPI);
+
+    if (Stream == NULL || Stream->Size < PDB_TPI_HEADER_SIZE)
+    {
+        return FALSE;
+    }
+
+    Header              = Stream->Data;
+    HeaderSize          = PdbRead32(Header + 4);
+    Pdb->TypeIndexBegin = PdbRead32(Header + 8);
+    Pdb->TypeIndexEnd   = PdbRead32(Header + 12);
+
+    Pdb->TypeRecords     = Header + HeaderSize;
+    Pdb->TypeRecordsSize = PdbRead32(Header + 16);
+
+    Pdb->TypeHashBucketsCount = PdbRead32(Header + 28);
+
+    if (Pdb->TypeHashBucketsCount == 0)
+    {
+        Pdb->TypeHashBucketsCount = PDB_TPI_HASH_BUCKETS;
+    }
+
+    if (Pdb->TypeIndexEnd < Pdb->TypeIndexBegin || !PdbHasRange(Stream->Size, HeaderSize, Pdb->TypeRecordsSize))
+    {
+        return FALSE;
+    }
+
+    Count = Pdb->TypeIndexEnd - Pdb->TypeIndexBegin;
+
+    Pdb->TypeOffsets   = malloc(((SIZE_T)Count + 1) * sizeof(UINT32));
+    Pdb->TypeHashNext  = malloc(((SIZE_T)Count + 1) * sizeof(UINT32));
+    Pdb->TypeHashHeads = malloc((SIZE_T)Pdb->TypeHashBucketsCount * sizeof(UINT32));
+
+    if (Pdb->TypeOffsets == NULL || Pdb->TypeHashNext == NULL || Pdb->TypeHashHeads == NULL)
+    {
+        free(Pdb->TypeOffsets);
+        Pdb->TypeOffsets = NULL;
+        return FALSE;
+    }
+
+    memset(Pdb->TypeHashHeads, 0xff, (SIZE_T)Pdb->TypeHashBucketsCount * sizeof(UINT32));
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        UINT32       Size;
+        UINT16       Kind;
+        const BYTE * Record;
+        UINT16       Properties;
+        UINT32       FieldList;
+        UINT64       TypeSize;
+        const CHAR * Name;
+
+        if (!PdbHasRange(Pdb->TypeRecordsSize, Offset, 2 * sizeof(UINT16)) ||
+            PdbRead16(Pdb->TypeRecords + Offset) < sizeof(UINT16) ||
+            !PdbHasRange(Pdb->TypeRecordsSize, Offset, PdbRead16(Pdb->TypeRecords + Offset) + sizeof(UINT16)))
+        {
+            //
+            // The types after an invalid record are not used
+            //
+            Pdb->TypeIndexEnd = Pdb->TypeIndexBegin + i;
+            break;
+        }
+
+        Pdb->TypeOffsets[i]  = Offset;
+        Pdb->TypeHashNext[i] = 0xffffffff;
+        Offset += PdbRead16(Pdb->TypeRecords + Offset) + sizeof(UINT16);
+
+        Record = PdbGetTypeRecord(Pdb, Pdb->TypeIndexBegin + i, &Kind, &Size);
+
+        if (PdbParseUdt(Kind, Record, Size, &Properties, &FieldList, &TypeSize, &Name) &&
+            !(Properties & PDB_PROPERTY_FORWARD_REF))
+        {
+            UINT32 Bucket = PdbHashName(Name, (UINT32)strlen(Name)) % Pdb->TypeHashBucketsCount;
+
+            Pdb->TypeHashNext[i]       = Pdb->TypeHashHeads[Bucket];
+            Pdb->TypeHashHeads[Bucket] = i;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Find a user-defined type (without the forward references) by its name
+ *
+ * @param Pdb
+ * @param Name
+ * @return UINT32 the type index, or zero if it's not found
+ */
+static UINT32
+PdbFindUdt(PPDB_FILE Pdb, const CHAR * Name)
+{
+    UINT32 Bucket = PdbHashName(Name, (UINT32)strlen(Name)) % Pdb->TypeHashBucketsCount;
+
+    for (UINT32 i = Pdb->TypeHashHeads[Bucket]; i != 0xffffffff; i = Pdb->TypeHashNext[i])
+    {
+        UINT32       Size;
+        UINT16       Kind;
+        const BYTE * Record = PdbGetTypeRecord(Pdb, Pdb->TypeIndexBegin + i, &Kind, &Size);
+        UINT16       Properties;
+        UINT32       FieldList;
+        UINT64       TypeSize;
+        const CHAR * RecordName;
+
+        if (PdbParseUdt(Kind, Record, Size, &Properties, &FieldList, &TypeSize, &RecordName) &&
+            strcasecmp(RecordName, Name) == 0)
+        {
+            return Pdb->TypeIndexBegin + i;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Find a type by its name
+ * @details The user-defined types are searched first, and then the
+ * typedefs (S_UDT) of the globals
+ *
+ * @param Pdb
+ * @param Name
+ * @return UINT32 the type index, or zero if it's not found
+ */
+static UINT32
+PdbFindType(PPDB_FILE Pdb, const CHAR * Name)
+{
+    UINT32       TypeIndex;
+    const BYTE * Record;
+    UINT16       Kind = 0;
+    UINT32       Size = 0;
+
+    if (!PdbLoadTypes(Pdb))
+    {
+        return 0;
+    }
+
+    TypeIndex = PdbFindUdt(Pdb, Name);
+
+    if (TypeIndex != 0)
+    {
+        return TypeIndex;
+    }
+
+    if (PdbLoadGsi(Pdb, &Pdb->Globals, Pdb->GlobalsStreamIndex, 0))
+    {
+        Record = PdbFindGsiRecord(Pdb, &Pdb->Globals, Name, TRUE, &Kind, &Size);
+
+        if (Record != NULL)
+        {
+            return PdbRead32(Record + 4);
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Get the size of the primitive (basic) types
+ *
+ * @param TypeIndex
+ * @param TypeSize
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbGetPrimitiveTypeSize(UINT32 TypeIndex, UINT64 * TypeSize)
+{
+    //
+    // Pointers to the primitive types
+    //
+    switch (TypeIndex & 0x700)
+    {
+    case 0x000:
+        break;
+    case 0x400:
+        *TypeSize = 4;
+        return TRUE;
+    case 0x600:
+        *TypeSize = 8;
+        return TRUE;
+    default:
+        return FALSE;
+    }
+
+    switch (TypeIndex & 0xff)
+    {
+    case 0x03: // void
+        *TypeSize = 0;
+        return TRUE;
+    case 0x10: // signed char
+    case 0x20: // unsigned char
+    case 0x30: // bool
+    case 0x68: // int8
+    case 0x69: // uint8
+    case 0x70: // char
+    case 0x7c: // char8
+        *TypeSize = 1;
+        return TRUE;
+    case 0x11: // short
+    case 0x21: // unsigned short
+    case 0x31: // bool16
+    case 0x46: // real16
+    case 0x71: // wchar_t
+    case 0x72: // int16
+    case 0x73: // uint16
+    case 0x7a: // char16_t
+        *TypeSize = 2;
+        return TRUE;
+    case 0x08: // HRESULT
+    case 0x12: // long
+    case 0x22: // unsigned long
+    case 0x32: // bool32
+    case 0x40: // float
+    case 0x74: // int
+    case 0x75: // unsigned int
+    case 0x7b: // char32_t
+        *TypeSize = 4;
+        return TRUE;
+    case 0x13: // __int64
+    case 0x23: // unsigned __int64
+    case 0x33: // bool64
+    case 0x41: // double
+    case 0x76: // int64
+    case 0x77: // uint64
+        *TypeSize = 8;
+        return TRUE;
+    case 0x42: // long double
+        *TypeSize = 10;
+        return TRUE;
+    case 0x14: // __int128
+    case 0x24: // unsigned __int128
+    case 0x78: // int128
+    case 0x79: // uint128
+        *TypeSize = 16;
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Get the size of a type
+ *
+ * @param Pdb
+ * @param TypeIndex
+ * @param TypeSize
+ * @param Depth
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbGetTypeIndexSize(PPDB_FILE Pdb, UINT32 TypeIndex, UINT64 * TypeSize, UINT32 Depth)
+{
+    const BYTE * Record;
+    UINT16       Kind;
+    UINT32       Size;
+    UINT16       Properties;
+    UINT32       FieldList;
+    const CHAR * Name;
+    UINT32       Length;
+    UINT32       Complete;
+
+    if (TypeIndex < Pdb->TypeIndexBegin)
+    {
+        return PdbGetPrimitiveTypeSize(TypeIndex, TypeSize);
+    }
+
+    Record = PdbGetTypeRecord(Pdb, TypeIndex, &Kind, &Size);
+
+    if (Record == NULL || Depth >= PDB_MAX_TYPE_DEPTH)
+    {
+        return FALSE;
+    }
+
+    switch (Kind)
+    {
+    case PDB_LF_POINTER:
+        if (Size < 8)
+        {
+            return FALSE;
+        }
+
+        *TypeSize = (PdbRead32(Record + 4) >> 13) & 0x3f;
+        return TRUE;
+
+    case PDB_LF_MODIFIER:
+    case PDB_LF_BITFIELD:
+        return Size >= 4 && PdbGetTypeIndexSize(Pdb, PdbRead32(Record), TypeSize, Depth + 1);
+
+    case PDB_LF_ARRAY:
+        return Size >= 8 && PdbReadNumeric(Record + 8, Size - 8, TypeSize, &Length);
+
+    default:
+        if (!PdbParseUdt(Kind, Record, Size, &Properties, &FieldList, TypeSize, &Name))
+        {
+            return FALSE;
+        }
+
+        if (Properties & PDB_PROPERTY_FORWARD_REF)
+        {
+            //
+            // The forward references are resolved by the name of the type
+            //
+            Complete = PdbFindUdt(Pdb, Name);
+
+            return Complete != 0 && PdbGetTypeIndexSize(Pdb, Complete, TypeSize, Depth + 1);
+        }
+
+        if (Kind == PDB_LF_ENUM)
+        {
+            return PdbGetTypeIndexSize(Pdb, (UINT32)*TypeSize, TypeSize, Depth + 1);
+        }
+
+        return TRUE;
+    }
+}
+
+/**
+ * @brief Get the length of a member of a field list
+ *
+ * @param Kind
+ * @param Member the member after its kind
+ * @param Size
+ * @param Length the length of the member after its kind
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbGetFieldLength(UINT16 Kind, const BYTE * Member, UINT32 Size, UINT32 * Length)
+{
+    UINT64  Value;
+    UINT32  Offset;
+    UINT32  NumericLength;
+    UINT32  NameLength;
+    BOOLEAN HasName = TRUE;
+
+    switch (Kind)
+    {
+    case PDB_LF_MEMBER:
+    case PDB_LF_BCLASS:
+        if (!PdbReadNumeric(Member + 6, Size > 6 ? Size - 6 : 0, &Value, &NumericLength))
+        {
+            return FALSE;
+        }
+
+        Offset  = 6 + NumericLength;
+        HasName = Kind == PDB_LF_MEMBER;
+        break;
+
+    case PDB_LF_VBCLASS:
+    case PDB_LF_IVBCLASS:
+        Offset = 10;
+
+        for (UINT32 i = 0; i < 2; i++)
+        {
+            if (!PdbReadNumeric(Member + Offset, Size > Offset ? Size - Offset : 0, &Value, &NumericLength))
+            {
+                return FALSE;
+            }
+
+            Offset += NumericLength;
+        }
+
+        HasName = FALSE;
+        break;
+
+    case PDB_LF_ENUMERATE:
+        if (!PdbReadNumeric(Member + 2, Size > 2 ? Size - 2 : 0, &Value, &NumericLength))
+        {
+            return FALSE;
+        }
+
+        Offset = 2 + NumericLength;
+        break;
+
+    case PDB_LF_ONEMETHOD:
+        Offset = 6;
+
+        //
+        // The introducing virtual methods have the offset in the virtual table
+        //
+        if (Size >= 2 && (((PdbRead16(Member) >> 2) & 7) == 4 || ((PdbRead16(Member) >> 2) & 7) == 6))
+        {
+            Offset += 4;
+        }
+        break;
+
+    case PDB_LF_STMEMBER:
+    case PDB_LF_METHOD:
+    case PDB_LF_NESTTYPE:
+    case PDB_LF_NESTTYPEEX:
+    case PDB_LF_MEMBERMODIFY:
+    case PDB_LF_FRIENDFCN:
+        Offset = 6;
+        break;
+
+    case PDB_LF_INDEX:
+    case PDB_LF_VFUNCTAB:
+    case PDB_LF_FRIENDCLS:
+        Offset  = 6;
+        HasName = FALSE;
+        break;
+
+    case PDB_LF_VFUNCOFF:
+        Offset  = 10;
+        HasName = FALSE;
+        break;
+
+    default:
+        return FALSE;
+    }
+
+    if (Offset > Size)
+    {
+        return FALSE;
+    }
+
+    if (HasName)
+    {
+        if (!PdbGetNameLength(Member + Offset, Size - Offset, &NameLength))
+        {
+            return FALSE;
+        }
+
+        Offset += NameLength + 1;
+    }
+
+    *Length = Offset;
+
+    return TRUE;
+}
+
+/**
+ * @brief Find a field in a field list
+ * @details The same as DbgHelp, the position of the bit is returned for
+ * the fields of one bit
+ *
+ * @param Pdb
+ * @param FieldListIndex
+ * @param FieldName
+ * @param FieldOffset
+ * @param Depth
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbFindField(PPDB_FILE Pdb, UINT32 FieldListIndex, const CHAR * FieldName, UINT32 * FieldOffset, UINT32 Depth)
+{
+    const BYTE * Record;
+    UINT16       Kind;
+    UINT32       Size;
+    UINT32       Offset = 0;
+
+    Record = PdbGetTypeRecord(Pdb, FieldListIndex, &Kind, &Size);
+
+    if (Record == NULL || Kind != PDB_LF_FIELDLIST || Depth >= PDB_MAX_TYPE_DEPTH)
+    {
+        return FALSE;
+    }
+
+    while (Offset + sizeof(UINT16) <= Size)
+    {
+        const BYTE * Member     = Record + Offset + sizeof(UINT16);
+        UINT32       MemberSize = Size - Offset - sizeof(UINT16);
+        UINT16       MemberKind = PdbRead16(Record + Offset);
+        UINT32       Length;
+
+        if (!PdbGetFieldLength(MemberKind, Member, MemberSize, &Length))
+        {
+            return FALSE;
+        }
+
+        if (MemberKind == PDB_LF_MEMBER)
+        {
+            UINT64 Value;
+            UINT32 NumericLength;
+
+            PdbReadNumeric(Member + 6, MemberSize - 6, &Value, &NumericLength);
+
+            if (strcmp((const CHAR *)Member + 6 + NumericLength, FieldName) == 0)
+            {
+                const BYTE * TypeRecord;
+                UINT16       TypeKind;
+                UINT32       TypeSize;
+
+                TypeRecord = PdbGetTypeRecord(Pdb, PdbRead32(Member + 2), &TypeKind, &TypeSize);
+
+                if (TypeRecord != NULL && TypeKind == PDB_LF_BITFIELD && TypeSize >= 6 && TypeRecord[4] == 1)
+                {
+                    *FieldOffset = TypeRecord[5];
+                }
+                else
+                {
+                    *FieldOffset = (UINT32)Value;
+                }
+
+                return TRUE;
+            }
+        }
+        else if (MemberKind == PDB_LF_INDEX)
+        {
+            //
+            // The rest of the members are in another field list
+            //
+            return PdbFindField(Pdb, PdbRead32(Member + 2), FieldName, FieldOffset, Depth + 1);
+        }
+
+        Offset += sizeof(UINT16) + Length;
+
+        //
+        // Skip the padding of the member
+        //
+        while (Offset < Size && Record[Offset] >= PDB_LF_PAD0)
+        {
+            Offset++;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Get the offset of a field of a type
+ *
+ * @param Pdb
+ * @param TypeName
+ * @param FieldName
+ * @param FieldOffset
+ * @return BOOLEAN
+ */
+BOOLEAN
+PdbGetFieldOffset(PPDB_FILE Pdb, const CHAR * TypeName, const CHAR * FieldName, UINT32 * FieldOffset)
+{
+    UINT32       TypeIndex = PdbFindType(Pdb, TypeName);
+    const BYTE * Record;
+    UINT16       Kind;
+    UINT32       Size;
+    UINT16       Properties;
+    UINT32       FieldList;
+    UINT64       TypeSize;
+    const CHAR * Name;
+
+    //
+    // The typedefs and the modifiers of the user-defined types are followed
+    //
+    for (UINT32 Depth = 0; Depth < PDB_MAX_TYPE_DEPTH; Depth++)
+    {
+        Record = PdbGetTypeRecord(Pdb, TypeIndex, &Kind, &Size);
+
+        if (Record == NULL)
+        {
+            return FALSE;
+        }
+
+        if (Kind == PDB_LF_MODIFIER && Size >= 4)
+        {
+            TypeIndex = PdbRead32(Record);
+            continue;
+        }
+
+        if (!PdbParseUdt(Kind, Record, Size, &Properties, &FieldList, &TypeSize, &Name) || Kind == PDB_LF_ENUM)
+        {
+            return FALSE;
+        }
+
+        if (Properties & PDB_PROPERTY_FORWARD_REF)
+        {
+            TypeIndex = PdbFindUdt(Pdb, Name);
+            continue;
+        }
+
+        return PdbFindField(Pdb, FieldList, FieldName, FieldOffset, 0);
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Get the size of a type
+ *
+ * @param Pdb
+ * @param TypeName
+ * @param TypeSize
+ * @return BOOLEAN
+ */
+BOOLEAN
+PdbGetTypeSize(PPDB_FILE Pdb, const CHAR * TypeName, UINT64 * TypeSize)
+{
+    UINT32 TypeIndex = PdbFindType(Pdb, TypeName);
+
+    if (TypeIndex == 0)
+    {
+        return FALSE;
+    }
+
+    return PdbGetTypeIndexSize(Pdb, TypeIndex, TypeSize, 0);
+}
+
+#endif // __linux__
@@ -11,8 +11,6 @@
  */
 #include "pch.h"
 
-static BOOLEAN PreviousTokenCanEndExpression;
-
 /**
  * @brief reads a token from the input string
  *
@@ -83,7 +81,7 @@ GetToken(char * c, char * str)
                     }
                     else
                     {
-                        InputIdx--;
+                        g_CompilerContext->InputIdx--;
                         CHAR Num = (CHAR)strtol(ByteString, NULL, 16);
                         AppendByte(Token, Num);
                     }
@@ -680,9 +678,9 @@ GetToken(char * c, char * str)
         }
 
     case 'L':
-        if (*(str + InputIdx) == '"')
+        if (*(str + g_CompilerContext->InputIdx) == '"')
         {
-            InputIdx++;
+            g_CompilerContext->InputIdx++;
             do
             {
                 *c = sgetc(str);
@@ -738,7 +736,7 @@ GetToken(char * c, char * str)
                         }
                         else
                         {
-                            InputIdx--;
+                            g_CompilerContext->InputIdx--;
                             WCHAR Num = (WCHAR)strtol(ByteString, NULL, 16);
                             AppendWchar(Token, Num);
                         }
@@ -1068,29 +1066,28 @@ GetToken(char * c, char * str)
 PSCRIPT_ENGINE_TOKEN
 Scan(char * str, char * c)
 {
-    static BOOLEAN       ReturnEndOfString;
     PSCRIPT_ENGINE_TOKEN Token;
 
-    if (InputIdx <= 1)
+    if (g_CompilerContext->InputIdx <= 1)
     {
-        ReturnEndOfString             = FALSE;
-        PreviousTokenCanEndExpression = FALSE;
+        g_CompilerContext->ReturnEndOfString             = FALSE;
+        g_CompilerContext->PreviousTokenCanEndExpression = FALSE;
     }
 
-    if (ReturnEndOfString)
+    if (g_CompilerContext->ReturnEndOfString)
     {
         Token = NewToken(END_OF_STACK, "$");
         return Token;
     }
 
-    if (str[InputIdx - 1] == '\0')
+    if (str[g_CompilerContext->InputIdx - 1] == '\0')
     {
     }
     while (1)
     {
-        CurrentTokenIdx = InputIdx - 1;
+        g_CompilerContext->CurrentTokenIdx = g_CompilerContext->InputIdx - 1;
 
-        if (*c == '.' && PreviousTokenCanEndExpression)
+        if (*c == '.' && g_CompilerContext->PreviousTokenCanEndExpression)
         {
             Token       = NewToken(SPECIAL_TOKEN, ".");
             *c          = sgetc(str);
@@ -1102,18 +1099,18 @@ Scan(char * str, char * c)
 
         if ((int)*c == EOF)
         {
-            ReturnEndOfString = TRUE;
+            g_CompilerContext->ReturnEndOfString = TRUE;
         }
 
         if (Token->Type == WHITE_SPACE)
         {
             if (!strcmp(Token->Value, "\n"))
             {
-                CurrentLine++;
-                CurrentLineIdx = InputIdx;
+                g_CompilerContext->CurrentLine++;
+                g_CompilerContext->CurrentLineIdx = g_CompilerContext->InputIdx;
             }
             RemoveToken(&Token);
-            if (ReturnEndOfString)
+            if (g_CompilerContext->ReturnEndOfString)
             {
                 Token = NewToken(END_OF_STACK, "$");
                 return Token;
@@ -1123,14 +1120,14 @@ Scan(char * str, char * c)
         else if (Token->Type == COMMENT)
         {
             RemoveToken(&Token);
-            if (ReturnEndOfString)
+            if (g_CompilerContext->ReturnEndOfString)
             {
                 Token = NewToken(END_OF_STACK, "$");
                 return Token;
             }
             continue;
         }
-        PreviousTokenCanEndExpression =
+        g_CompilerContext->PreviousTokenCanEndExpression =
             Token->Type == GLOBAL_ID || Token->Type == GLOBAL_UNRESOLVED_ID ||
             Token->Type == LOCAL_ID || Token->Type == LOCAL_UNRESOLVED_ID ||
             Token->Type == FUNCTION_PARAMETER_ID || Token->Type == REGISTER ||
@@ -1139,6 +1136,22 @@ Scan(char * str, char * c)
             Token->Type == FLOAT_LITERAL ||
             (Token->Type == SPECIAL_TOKEN &&
              (!strcmp(Token->Value, ")") || !strcmp(Token->Value, "]")));
+
+        //
+        // Count the lines up to the start of the token (the comments are
+        // counted too), the code generator uses the line of the last matched
+        // token as the source line of the generated symbols
+        //
+        g_CompilerContext->LastTokenLine = g_CompilerContext->TokenLine;
+
+        for (; g_CompilerContext->TokenLineIdx < g_CompilerContext->CurrentTokenIdx; g_CompilerContext->TokenLineIdx++)
+        {
+            if (str[g_CompilerContext->TokenLineIdx] == '\n')
+            {
+                g_CompilerContext->TokenLine++;
+            }
+        }
+
         return Token;
     }
 }
@@ -1152,11 +1165,11 @@ Scan(char * str, char * c)
 char
 sgetc(char * str)
 {
-    char c = str[InputIdx];
+    char c = str[g_CompilerContext->InputIdx];
 
     if (c)
     {
-        InputIdx++;
+        g_CompilerContext->InputIdx++;
         return c;
     }
     else
@@ -1174,24 +1187,12 @@ sgetc(char * str)
 char
 IsKeyword(char * str)
 {
-    int n = KEYWORD_LIST_LENGTH;
-    for (int i = 0; i < n; i++)
-    {
-        if (!strcmp(str, KeywordList[i]))
-        {
-            return 1;
-        }
-    }
-    n = TERMINAL_COUNT;
-    for (int i = 0; i < n; i++)
-    {
-        if (!strcmp(str, TerminalMap[i]))
-        {
-            return 1;
-        }
-    }
-
-    return 0;
+    //
+    // The keyword table has both the keywords and the terminals
+    //
+    if (PerfectHashLookup(&KeywordHashTable, str) == INVALID)
+        return 0;
+    return 1;
 }
 
 /**
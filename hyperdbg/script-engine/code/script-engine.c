@@ -27,45 +27,12 @@ extern HWDBG_INSTANCE_INFORMATION g_HwdbgInstanceInfo;
 extern BOOLEAN                    g_HwdbgInstanceInfoIsValid;
 extern PVOID                      g_MessageHandler;
 
-typedef struct _STRUCT_DECLARATOR_STATE
-{
-    char *                            Name;
-    unsigned int                      PointerDepth;
-    unsigned int                      Dimensions[16];
-    unsigned int                      DimensionCount;
-    struct _STRUCT_DECLARATOR_STATE * Next;
-} STRUCT_DECLARATOR_STATE, *PSTRUCT_DECLARATOR_STATE;
-
-static PSTRUCT_DECLARATOR_STATE StructDeclarators;
-static PSTRUCT_DECLARATOR_STATE StructDeclaratorsTail;
-static unsigned int             StructPointerDepth;
-static PVARIABLE_TYPE           CurrentStructDefinition;
-static PSCRIPT_ENGINE_TOKEN     LastStructObject;
-static PVARIABLE_TYPE           LastStructObjectType;
-
-typedef struct _SIZEOF_COMPILATION_CONTEXT
-{
-    UINT32 CodePointer;
-    UINT64 MaxTempNumber;
-    CHAR   TempMap[MAX_TEMP_COUNT];
-} SIZEOF_COMPILATION_CONTEXT;
-
-static SIZEOF_COMPILATION_CONTEXT SizeofContexts[16];
-static UINT32                     SizeofContextCount;
-
-typedef struct _LOGICAL_COMPILATION_CONTEXT
-{
-    BOOLEAN              IsOr;
-    UINT32               BeginJumpTargetIndex;
-    PSCRIPT_ENGINE_TOKEN ResultToken;
-} LOGICAL_COMPILATION_CONTEXT;
-
-static LOGICAL_COMPILATION_CONTEXT LogicalContexts[16];
-static UINT32                      LogicalContextCount;
-
 static UINT64
 GetScriptScalarTypeId(PVARIABLE_TYPE VariableType);
 
+static PVOID
+ScriptEngineCompile(char * str);
+
 static PVARIABLE_TYPE
 ResolveIdentifierVariableType(PSCRIPT_ENGINE_TOKEN Token)
 {
@@ -85,6 +52,7 @@ ResolveIdentifierVariableType(PSCRIPT_ENGINE_TOKEN Token)
     {
         VariableType          = GetGlobalIdentifierVariableType(Token);
         Token->IsImplicitType = GetGlobalIdentifierIsImplicitType(Token);
+        Token->IsPercpu       = GetGlobalIdentifierIsPercpu(Token);
     }
 
     if (VariableType)
@@ -597,15 +565,15 @@ CreateStructPointerType(PVARIABLE_TYPE BaseType, POINTER_PROVENANCE Provenance)
 static VOID
 ResetStructDeclarators(VOID)
 {
-    while (StructDeclarators)
+    while (g_CompilerContext->StructDeclarators)
     {
-        PSTRUCT_DECLARATOR_STATE Next = StructDeclarators->Next;
-        free(StructDeclarators->Name);
-        free(StructDeclarators);
-        StructDeclarators = Next;
+        PSTRUCT_DECLARATOR_STATE Next = g_CompilerContext->StructDeclarators->Next;
+        free(g_CompilerContext->StructDeclarators->Name);
+        free(g_CompilerContext->StructDeclarators);
+        g_CompilerContext->StructDeclarators = Next;
     }
-    StructDeclaratorsTail = NULL;
-    StructPointerDepth    = 0;
+    g_CompilerContext->StructDeclaratorsTail = NULL;
+    g_CompilerContext->StructPointerDepth    = 0;
 }
 
 static PVARIABLE_TYPE
@@ -711,10 +679,17 @@ ShowMessages(const char * Fmt, ...)
 UINT64
 ScriptEngineConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
 {
+    UINT64 Address;
+
     //
-    // A wrapper for pdb parser
+    // A wrapper for pdb parser, the symbol parser is not thread-safe so the
+    // compilations that run concurrently are serialized here
     //
-    return SymConvertNameToAddress(FunctionOrVariableName, WasFound);
+    ScriptEngineSpinlockLock(&SymbolParserLock);
+    Address = SymConvertNameToAddress(FunctionOrVariableName, WasFound);
+    ScriptEngineSpinlockUnlock(&SymbolParserLock);
+
+    return Address;
 }
 
 /**
@@ -976,6 +951,73 @@ ScriptEngineConvertLoadedModuleToPdbFileAndGuidAndAgeDetails(const BYTE * Loaded
         Is32BitModule);
 }
 
+/**
+ * @brief Acquires the lock of the table of global variables
+ *
+ * @details Global variables are shared between all the scripts, so the
+ * table is shared between the compilations that run concurrently
+ *
+ * @return VOID
+ */
+VOID
+AcquireGlobalIdTableLock(VOID)
+{
+    ScriptEngineSpinlockLock(&GlobalIdTableLock);
+
+    //
+    // The table is created the first time a script is compiled
+    //
+    if (!GlobalIdTable)
+    {
+        //
+        // The global variables outlive the compilation, so they are not
+        // allocated from the token arena
+        //
+        PSCRIPT_ENGINE_ARENA TokenArena = SwitchTokenArena(NULL);
+
+        GlobalIdTable = NewIdTable();
+
+        SwitchTokenArena(TokenArena);
+    }
+}
+
+/**
+ * @brief Releases the lock of the table of global variables
+ *
+ * @return VOID
+ */
+VOID
+ReleaseGlobalIdTableLock(VOID)
+{
+    ScriptEngineSpinlockUnlock(&GlobalIdTableLock);
+}
+
+/**
+ * @brief Allocates a compiler context for ScriptEngineParseEx
+ *
+ * @details A context can be reused for compiling several scripts (one
+ * after another) but it must not be used by two threads at the same time
+ *
+ * @return PVOID the context or NULL if the allocation fails
+ */
+PVOID
+ScriptEngineCreateCompilerContext(VOID)
+{
+    return calloc(1, sizeof(SCRIPT_ENGINE_COMPILER_CONTEXT));
+}
+
+/**
+ * @brief Frees a compiler context allocated by ScriptEngineCreateCompilerContext
+ *
+ * @param CompilerContext
+ * @return VOID
+ */
+VOID
+ScriptEngineFreeCompilerContext(PVOID CompilerContext)
+{
+    free(CompilerContext);
+}
+
 /**
  * @brief The entry point of script engine
  *
@@ -984,41 +1026,178 @@ ScriptEngineConvertLoadedModuleToPdbFileAndGuidAndAgeDetails(const BYTE * Loaded
  */
 PVOID
 ScriptEngineParse(char * str)
+{
+    SCRIPT_ENGINE_COMPILER_CONTEXT CompilerContext = {0};
+
+    return ScriptEngineParseEx(&CompilerContext, str);
+}
+
+/**
+ * @brief The entry point of script engine for compiling a script by
+ * using the given compiler context
+ *
+ * @details Scripts that use different compiler contexts can be compiled
+ * concurrently
+ *
+ * @param CompilerContext
+ * @param str
+ * @return PVOID
+ */
+PVOID
+ScriptEngineParseEx(PVOID CompilerContext, char * str)
+{
+    PSCRIPT_ENGINE_COMPILER_CONTEXT PreviousCompilerContext = g_CompilerContext;
+    PVOID                           CodeBuffer;
+
+    g_CompilerContext = (PSCRIPT_ENGINE_COMPILER_CONTEXT)CompilerContext;
+
+    //
+    // The tokens and token lists of the compilation are allocated from the
+    // arena of the context and they are freed all at once at the end
+    //
+    g_CompilerContext->ActiveTokenArena = &g_CompilerContext->TokenArena;
+
+    CodeBuffer = ScriptEngineCompile(str);
+
+    g_CompilerContext->ActiveTokenArena = NULL;
+    ArenaRelease(&g_CompilerContext->TokenArena);
+
+    g_CompilerContext = PreviousCompilerContext;
+
+    return CodeBuffer;
+}
+
+/**
+ * @brief Compiles one script of a batch after another
+ *
+ * @param Param the batch
+ * @return DWORD
+ */
+static DWORD WINAPI
+ScriptEngineParseBatchWorker(PVOID Param)
+{
+    PSCRIPT_ENGINE_COMPILE_BATCH   Batch = (PSCRIPT_ENGINE_COMPILE_BATCH)Param;
+    SCRIPT_ENGINE_COMPILER_CONTEXT CompilerContext;
+    INT64                          Index;
+
+    while ((Index = CpuInterlockedIncrement64(&Batch->NextScriptIndex) - 1) < Batch->NumberOfScripts)
+    {
+        PlatformZeroMemory(&CompilerContext, sizeof(SCRIPT_ENGINE_COMPILER_CONTEXT));
+        Batch->Results[Index] = ScriptEngineParseEx(&CompilerContext, Batch->Scripts[Index]);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Compiles a batch of scripts by a pool of threads
+ *
+ * @details The result of each script (the same as the result of
+ * ScriptEngineParse) is stored in the same index of the Results array
+ *
+ * @param Scripts
+ * @param Results
+ * @param NumberOfScripts
+ * @param NumberOfThreads zero means one thread per processor
+ * @return BOOLEAN
+ */
+BOOLEAN
+ScriptEngineParseBatch(CHAR ** Scripts, PVOID * Results, UINT32 NumberOfScripts, UINT32 NumberOfThreads)
+{
+    SCRIPT_ENGINE_COMPILE_BATCH Batch = {0};
+    HANDLE *                    Threads;
+    UINT32                      NumberOfCreatedThreads = 0;
+
+    Batch.Scripts         = Scripts;
+    Batch.Results         = Results;
+    Batch.NumberOfScripts = NumberOfScripts;
+
+    if (NumberOfThreads == 0)
+    {
+        NumberOfThreads = (UINT32)PlatformGetActiveProcessorCount();
+    }
+
+    if (NumberOfThreads > NumberOfScripts)
+    {
+        NumberOfThreads = NumberOfScripts;
+    }
+
+    //
+    // The current thread is also one of the workers
+    //
+    Threads = NumberOfThreads > 1 ? calloc(NumberOfThreads - 1, sizeof(HANDLE)) : NULL;
+
+    for (UINT32 i = 0; Threads && i < NumberOfThreads - 1; i++)
+    {
+        Threads[i] = PlatformCreateJoinableThread(ScriptEngineParseBatchWorker, &Batch);
+
+        if (Threads[i] == NULL)
+        {
+            //
+            // Continue with the threads that are already created
+            //
+            break;
+        }
+
+        NumberOfCreatedThreads++;
+    }
+
+    ScriptEngineParseBatchWorker(&Batch);
+
+    for (UINT32 i = 0; i < NumberOfCreatedThreads; i++)
+    {
+        PlatformJoinThread(Threads[i]);
+    }
+
+    free(Threads);
+
+    for (UINT32 i = 0; i < NumberOfScripts; i++)
+    {
+        if (Results[i] == NULL || ((PSYMBOL_BUFFER)Results[i])->Message != NULL)
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Compiles a script by using the compiler context of the current thread
+ *
+ * @param str
+ * @return PVOID
+ */
+static PVOID
+ScriptEngineCompile(char * str)
 {
     char * ScriptSource = PlatformStrDup(str);
 
     InitializeTypeContext();
     ResetStructDeclarators();
-    CurrentStructDefinition = NULL;
-    LastStructObject        = NULL;
-    LastStructObjectType    = NULL;
-    SizeofContextCount      = 0;
-    LogicalContextCount     = 0;
+    g_CompilerContext->CurrentStructDefinition = NULL;
+    g_CompilerContext->LastStructObject        = NULL;
+    g_CompilerContext->LastStructObjectType    = NULL;
+    g_CompilerContext->SizeofContextCount      = 0;
+    g_CompilerContext->LogicalContextCount     = 0;
 
     PSCRIPT_ENGINE_TOKEN_LIST Stack        = NewTokenList();
     PSCRIPT_ENGINE_TOKEN_LIST MatchedStack = NewTokenList();
     PSYMBOL_BUFFER            CodeBuffer   = NewSymbolBuffer();
 
-    UserDefinedFunctionHead = malloc(sizeof(USER_DEFINED_FUNCTION_NODE));
-    PlatformZeroMemory(UserDefinedFunctionHead, sizeof(USER_DEFINED_FUNCTION_NODE));
-    UserDefinedFunctionHead->Name                     = PlatformStrDup("main");
-    UserDefinedFunctionHead->IdTable                  = (unsigned long long)NewTokenList();
-    UserDefinedFunctionHead->FunctionParameterIdTable = (unsigned long long)NewTokenList();
-    UserDefinedFunctionHead->TempMap                  = calloc(MAX_TEMP_COUNT, 1);
-    UserDefinedFunctionHead->VariableType             = (unsigned long long)VARIABLE_TYPE_VOID;
+    g_CompilerContext->UserDefinedFunctionHead = malloc(sizeof(USER_DEFINED_FUNCTION_NODE));
+    PlatformZeroMemory(g_CompilerContext->UserDefinedFunctionHead, sizeof(USER_DEFINED_FUNCTION_NODE));
+    g_CompilerContext->UserDefinedFunctionHead->Name                     = PlatformStrDup("main");
+    g_CompilerContext->UserDefinedFunctionHead->IdTable                  = (unsigned long long)NewIdTable();
+    g_CompilerContext->UserDefinedFunctionHead->FunctionParameterIdTable = (unsigned long long)NewIdTable();
+    g_CompilerContext->UserDefinedFunctionHead->TempMap                  = calloc(MAX_TEMP_COUNT, 1);
+    g_CompilerContext->UserDefinedFunctionHead->VariableType             = (unsigned long long)VARIABLE_TYPE_VOID;
 
-    CurrentUserDefinedFunction = UserDefinedFunctionHead;
+    g_CompilerContext->CurrentUserDefinedFunction = g_CompilerContext->UserDefinedFunctionHead;
 
     SCRIPT_ENGINE_ERROR_TYPE Error        = SCRIPT_ENGINE_ERROR_FREE;
     char *                   ErrorMessage = NULL;
 
-    static INT FirstCall = 1;
-    if (FirstCall)
-    {
-        GlobalIdTable = NewTokenList();
-        FirstCall     = 0;
-    }
-
     PSCRIPT_ENGINE_TOKEN TopToken = NewUnknownToken();
 
     int  NonTerminalId;
@@ -1030,9 +1209,12 @@ ScriptEngineParse(char * str)
     //
     // Initialize Scanner
     //
-    InputIdx       = 0;
-    CurrentLine    = 0;
-    CurrentLineIdx = 0;
+    g_CompilerContext->InputIdx       = 0;
+    g_CompilerContext->CurrentLine    = 0;
+    g_CompilerContext->CurrentLineIdx = 0;
+    g_CompilerContext->TokenLineIdx   = 0;
+    g_CompilerContext->TokenLine      = 0;
+    g_CompilerContext->LastTokenLine  = 0;
 
     //
     // End of File Token
@@ -1245,17 +1427,17 @@ ScriptEngineParse(char * str)
             if (Symbol->Type == SYMBOL_LOCAL_ID_TYPE)
             {
                 Symbol->Type = SYMBOL_TEMP_TYPE;
-                Symbol->Value += UserDefinedFunctionHead->MaxTempNumber;
+                Symbol->Value += g_CompilerContext->UserDefinedFunctionHead->MaxTempNumber;
             }
             else if (Symbol->Type == SYMBOL_REFERENCE_LOCAL_ID_TYPE)
             {
                 Symbol->Type = SYMBOL_REFERENCE_TEMP_TYPE;
-                Symbol->Value += UserDefinedFunctionHead->MaxTempNumber;
+                Symbol->Value += g_CompilerContext->UserDefinedFunctionHead->MaxTempNumber;
             }
             else if (Symbol->Type == SYMBOL_DEREFERENCE_LOCAL_ID_TYPE)
             {
                 Symbol->Type = SYMBOL_DEREFERENCE_TEMP_TYPE;
-                Symbol->Value += UserDefinedFunctionHead->MaxTempNumber;
+                Symbol->Value += g_CompilerContext->UserDefinedFunctionHead->MaxTempNumber;
             }
             else if (Symbol->Type == SYMBOL_VARIABLE_COUNT_TYPE)
             {
@@ -1266,17 +1448,17 @@ ScriptEngineParse(char * str)
                     if ((Symbol->Type & 0x7fffffff) == SYMBOL_LOCAL_ID_TYPE)
                     {
                         Symbol->Type = SYMBOL_TEMP_TYPE | (Symbol->Type & 0xffffffff00000000);
-                        Symbol->Value += UserDefinedFunctionHead->MaxTempNumber;
+                        Symbol->Value += g_CompilerContext->UserDefinedFunctionHead->MaxTempNumber;
                     }
                     else if ((Symbol->Type & 0x7fffffff) == SYMBOL_REFERENCE_LOCAL_ID_TYPE)
                     {
                         Symbol->Type = SYMBOL_REFERENCE_LOCAL_ID_TYPE | (Symbol->Type & 0xffffffff00000000);
-                        Symbol->Value += UserDefinedFunctionHead->MaxTempNumber;
+                        Symbol->Value += g_CompilerContext->UserDefinedFunctionHead->MaxTempNumber;
                     }
                     else if ((Symbol->Type & 0x7fffffff) == SYMBOL_DEREFERENCE_LOCAL_ID_TYPE)
                     {
                         Symbol->Type = SYMBOL_DEREFERENCE_LOCAL_ID_TYPE | (Symbol->Type & 0xffffffff00000000);
-                        Symbol->Value += UserDefinedFunctionHead->MaxTempNumber;
+                        Symbol->Value += g_CompilerContext->UserDefinedFunctionHead->MaxTempNumber;
                     }
                 }
                 i += VariableCount;
@@ -1287,7 +1469,15 @@ ScriptEngineParse(char * str)
         // set memory size for stack buffer
         //
         Symbol        = CodeBuffer->Head + 1;
-        Symbol->Value = CurrentUserDefinedFunction->MaxTempNumber + CurrentUserDefinedFunction->LocalVariableNumber;
+        Symbol->Value = g_CompilerContext->CurrentUserDefinedFunction->MaxTempNumber + g_CompilerContext->CurrentUserDefinedFunction->LocalVariableNumber;
+
+        //
+        // optimize the generated code (-O1)
+        //
+        if (g_ScriptEngineOptimizationLevel >= SCRIPT_ENGINE_OPTIMIZATION_LEVEL_O1)
+        {
+            OptimizeSymbolBuffer(CodeBuffer);
+        }
     }
     CodeBuffer->Message = ErrorMessage;
 
@@ -1297,19 +1487,19 @@ ScriptEngineParse(char * str)
     if (MatchedStack)
         RemoveTokenList(MatchedStack);
 
-    if (UserDefinedFunctionHead)
+    if (g_CompilerContext->UserDefinedFunctionHead)
     {
-        PUSER_DEFINED_FUNCTION_NODE Node = UserDefinedFunctionHead;
+        PUSER_DEFINED_FUNCTION_NODE Node = g_CompilerContext->UserDefinedFunctionHead;
         while (Node)
         {
             if (Node->Name)
                 free(Node->Name);
 
             if (Node->IdTable)
-                RemoveTokenList((PSCRIPT_ENGINE_TOKEN_LIST)Node->IdTable);
+                RemoveIdTable((PSCRIPT_ENGINE_ID_TABLE)Node->IdTable);
 
             if (Node->FunctionParameterIdTable)
-                RemoveTokenList((PSCRIPT_ENGINE_TOKEN_LIST)Node->FunctionParameterIdTable);
+                RemoveIdTable((PSCRIPT_ENGINE_ID_TABLE)Node->FunctionParameterIdTable);
 
             if (Node->TempMap)
                 free(Node->TempMap);
@@ -1318,12 +1508,12 @@ ScriptEngineParse(char * str)
             Node                             = Node->NextNode;
             free(Temp);
         }
-        UserDefinedFunctionHead = 0;
+        g_CompilerContext->UserDefinedFunctionHead = 0;
     }
 
-    if (IncludeHead)
+    if (g_CompilerContext->IncludeHead)
     {
-        PINCLUDE_NODE Node = IncludeHead;
+        PINCLUDE_NODE Node = g_CompilerContext->IncludeHead;
         while (Node)
         {
             if (Node->FilePath)
@@ -1333,7 +1523,7 @@ ScriptEngineParse(char * str)
             Node               = Node->NextNode;
             free(Temp);
         }
-        IncludeHead = 0;
+        g_CompilerContext->IncludeHead = 0;
     }
 
     if (CurrentIn)
@@ -1343,14 +1533,71 @@ ScriptEngineParse(char * str)
         RemoveToken(&TopToken);
 
     ResetStructDeclarators();
-    if (LastStructObject)
-        RemoveToken(&LastStructObject);
+    if (g_CompilerContext->LastStructObject)
+        RemoveToken(&g_CompilerContext->LastStructObject);
     UninitializeTypeContext();
     free(ScriptSource);
 
     return (PVOID)CodeBuffer;
 }
 
+/**
+ * @brief Find the kind and the length of a format specifier of printf
+ *
+ * @param Str the format specifier (starts with '%')
+ * @param Length length of the format specifier
+ * @return UINT64 kind of the format specifier (zero if it's not a format specifier)
+ */
+static UINT64
+GetFormatSpecifierKind(const char * Str, UINT32 * Length)
+{
+    CHAR Temp = *(Str + 1);
+
+    *Length = 2;
+
+    if (Temp == 'd' || Temp == 'i' || Temp == 'u' || Temp == 'o' ||
+        Temp == 'x' || Temp == 'c' || Temp == 'p')
+    {
+        return FORMAT_SPECIFIER_KIND_INTEGER;
+    }
+    else if (Temp == 's')
+    {
+        return FORMAT_SPECIFIER_KIND_STRING;
+    }
+    else if (Temp == 'f')
+    {
+        return FORMAT_SPECIFIER_KIND_FLOAT;
+    }
+
+    *Length = 3;
+
+    if (!strncmp(Str, "%ws", 3) || !strncmp(Str, "%ls", 3))
+    {
+        return FORMAT_SPECIFIER_KIND_WSTRING;
+    }
+    else if (!strncmp(Str, "%ld", 3) || !strncmp(Str, "%li", 3) ||
+             !strncmp(Str, "%lu", 3) || !strncmp(Str, "%lo", 3) ||
+             !strncmp(Str, "%lx", 3) ||
+
+             !strncmp(Str, "%hd", 3) || !strncmp(Str, "%hi", 3) ||
+             !strncmp(Str, "%hu", 3) || !strncmp(Str, "%ho", 3) ||
+             !strncmp(Str, "%hx", 3))
+    {
+        return FORMAT_SPECIFIER_KIND_INTEGER;
+    }
+
+    *Length = 4;
+
+    if (!strncmp(Str, "%lld", 4) || !strncmp(Str, "%lli", 4) ||
+        !strncmp(Str, "%llu", 4) || !strncmp(Str, "%llo", 4) ||
+        !strncmp(Str, "%llx", 4))
+    {
+        return FORMAT_SPECIFIER_KIND_INTEGER;
+    }
+
+    return 0;
+}
+
 /**
  * @brief Script Engine code generator
  *
@@ -1407,35 +1654,39 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
         }
         else if (!strcmp(Operator->Value, "@SIZEOF_BEGIN"))
         {
-            if (SizeofContextCount >= 16)
+            SIZEOF_COMPILATION_CONTEXT * Context;
+            if (g_CompilerContext->SizeofContextCount >= MAX_NESTED_COMPILATION_CONTEXT_COUNT)
             {
                 *Error = SCRIPT_ENGINE_ERROR_SYNTAX;
                 break;
             }
-            SizeofContexts[SizeofContextCount].CodePointer   = CodeBuffer->Pointer;
-            SizeofContexts[SizeofContextCount].MaxTempNumber = CurrentUserDefinedFunction->MaxTempNumber;
-            memcpy(SizeofContexts[SizeofContextCount].TempMap,
-                   CurrentUserDefinedFunction->TempMap,
+            Context                = &g_CompilerContext->SizeofContexts[g_CompilerContext->SizeofContextCount];
+            Context->CodePointer   = CodeBuffer->Pointer;
+            Context->MaxTempNumber = g_CompilerContext->CurrentUserDefinedFunction->MaxTempNumber;
+            memcpy(Context->TempMap,
+                   g_CompilerContext->CurrentUserDefinedFunction->TempMap,
                    MAX_TEMP_COUNT);
-            SizeofContextCount++;
+            g_CompilerContext->SizeofContextCount++;
         }
         else if (!strcmp(Operator->Value, "@SIZEOF_EXPRESSION"))
         {
-            CHAR                 SizeText[32];
-            PVARIABLE_TYPE       OperandType;
-            PSCRIPT_ENGINE_TOKEN SizeToken;
-            if (!SizeofContextCount || !MatchedStack->Pointer)
+            SIZEOF_COMPILATION_CONTEXT * Context;
+            CHAR                         SizeText[32];
+            PVARIABLE_TYPE               OperandType;
+            PSCRIPT_ENGINE_TOKEN         SizeToken;
+            if (!g_CompilerContext->SizeofContextCount || !MatchedStack->Pointer)
             {
                 *Error = SCRIPT_ENGINE_ERROR_SYNTAX;
                 break;
             }
             Op0         = Pop(MatchedStack);
             OperandType = (PVARIABLE_TYPE)Op0->VariableType;
-            SizeofContextCount--;
-            CodeBuffer->Pointer                       = SizeofContexts[SizeofContextCount].CodePointer;
-            CurrentUserDefinedFunction->MaxTempNumber = SizeofContexts[SizeofContextCount].MaxTempNumber;
-            memcpy(CurrentUserDefinedFunction->TempMap,
-                   SizeofContexts[SizeofContextCount].TempMap,
+            g_CompilerContext->SizeofContextCount--;
+            Context                                                      = &g_CompilerContext->SizeofContexts[g_CompilerContext->SizeofContextCount];
+            CodeBuffer->Pointer                                          = Context->CodePointer;
+            g_CompilerContext->CurrentUserDefinedFunction->MaxTempNumber = Context->MaxTempNumber;
+            memcpy(g_CompilerContext->CurrentUserDefinedFunction->TempMap,
+                   Context->TempMap,
                    MAX_TEMP_COUNT);
             if (!OperandType || OperandType->Kind == TY_VOID || OperandType->Kind == TY_FUNC ||
                 (OperandType->Kind == TY_STRUCT && !OperandType->IsComplete) || OperandType->Size <= 0)
@@ -1558,11 +1809,12 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
         else if (!strcmp(Operator->Value, "@LOGICAL_OR_BEGIN") ||
                  !strcmp(Operator->Value, "@LOGICAL_AND_BEGIN"))
         {
-            PSCRIPT_ENGINE_TOKEN TruthToken;
-            PSYMBOL              TruthSymbol;
-            PSYMBOL              ResultSymbol;
-            PSYMBOL              Symbol;
-            if (!MatchedStack->Pointer || LogicalContextCount >= 16)
+            LOGICAL_COMPILATION_CONTEXT * Context;
+            PSCRIPT_ENGINE_TOKEN          TruthToken;
+            PSYMBOL                       TruthSymbol;
+            PSYMBOL                       ResultSymbol;
+            PSYMBOL                       Symbol;
+            if (!MatchedStack->Pointer || g_CompilerContext->LogicalContextCount >= MAX_NESTED_COMPILATION_CONTEXT_COUNT)
             {
                 *Error = SCRIPT_ENGINE_ERROR_SYNTAX;
                 break;
@@ -1570,33 +1822,34 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
             TruthToken = EmitTruthValue(CodeBuffer, Top(MatchedStack), Error);
             if (!TruthToken || *Error != SCRIPT_ENGINE_ERROR_FREE)
                 break;
-            TruthSymbol                                                    = ToSymbol(TruthToken, Error);
-            LogicalContexts[LogicalContextCount].IsOr                      = !strcmp(Operator->Value, "@LOGICAL_OR_BEGIN");
-            LogicalContexts[LogicalContextCount].ResultToken               = NewTemp(Error);
-            LogicalContexts[LogicalContextCount].ResultToken->VariableType = VARIABLE_TYPE_INT;
-            ResultSymbol                                                   = ToSymbol(LogicalContexts[LogicalContextCount].ResultToken, Error);
-            Symbol                                                         = NewSymbol();
+            Context                            = &g_CompilerContext->LogicalContexts[g_CompilerContext->LogicalContextCount];
+            TruthSymbol                        = ToSymbol(TruthToken, Error);
+            Context->IsOr                      = !strcmp(Operator->Value, "@LOGICAL_OR_BEGIN");
+            Context->ResultToken               = NewTemp(Error);
+            Context->ResultToken->VariableType = VARIABLE_TYPE_INT;
+            ResultSymbol                       = ToSymbol(Context->ResultToken, Error);
+            Symbol                             = NewSymbol();
 
             Symbol->Type  = SYMBOL_SEMANTIC_RULE_TYPE;
             Symbol->Value = FUNC_MOV;
             PushSymbol(CodeBuffer, Symbol);
             Symbol->Type  = SYMBOL_NUM_TYPE;
-            Symbol->Value = LogicalContexts[LogicalContextCount].IsOr ? 1 : 0;
+            Symbol->Value = Context->IsOr ? 1 : 0;
             PushSymbol(CodeBuffer, Symbol);
             PushSymbol(CodeBuffer, ResultSymbol);
 
             Symbol->Type  = SYMBOL_SEMANTIC_RULE_TYPE;
-            Symbol->Value = LogicalContexts[LogicalContextCount].IsOr ? FUNC_JNZ : FUNC_JZ;
+            Symbol->Value = Context->IsOr ? FUNC_JNZ : FUNC_JZ;
             PushSymbol(CodeBuffer, Symbol);
-            LogicalContexts[LogicalContextCount].BeginJumpTargetIndex = CodeBuffer->Pointer;
-            Symbol->Type                                              = SYMBOL_NUM_TYPE;
-            Symbol->Value                                             = 0;
+            Context->BeginJumpTargetIndex = CodeBuffer->Pointer;
+            Symbol->Type                  = SYMBOL_NUM_TYPE;
+            Symbol->Value                 = 0;
             PushSymbol(CodeBuffer, Symbol);
             PushSymbol(CodeBuffer, TruthSymbol);
             RemoveSymbol(&Symbol);
             FreeTemp(TruthToken);
             RemoveToken(&TruthToken);
-            LogicalContextCount++;
+            g_CompilerContext->LogicalContextCount++;
         }
         else if (!strcmp(Operator->Value, "@LOGICAL_OR_END") ||
                  !strcmp(Operator->Value, "@LOGICAL_AND_END"))
@@ -1607,13 +1860,13 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
             PSYMBOL                       ResultSymbol;
             PSYMBOL                       Symbol;
             UINT32                        EndJumpTargetIndex;
-            if (!LogicalContextCount || MatchedStack->Pointer < 2)
+            if (!g_CompilerContext->LogicalContextCount || MatchedStack->Pointer < 2)
             {
                 *Error = SCRIPT_ENGINE_ERROR_SYNTAX;
                 break;
             }
-            LogicalContextCount--;
-            Context    = &LogicalContexts[LogicalContextCount];
+            g_CompilerContext->LogicalContextCount--;
+            Context    = &g_CompilerContext->LogicalContexts[g_CompilerContext->LogicalContextCount];
             Op0        = Pop(MatchedStack);
             Op1        = Pop(MatchedStack);
             TruthToken = EmitTruthValue(CodeBuffer, Op0, Error);
@@ -1653,7 +1906,7 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
         }
         else if (!strcmp(Operator->Value, "@STRUCT_POINTER"))
         {
-            StructPointerDepth++;
+            g_CompilerContext->StructPointerDepth++;
         }
         else if (!strcmp(Operator->Value, "@STRUCT_ARRAY_DIMENSION"))
         {
@@ -1666,12 +1919,12 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
                 *Error = SCRIPT_ENGINE_ERROR_INVALID_ARRAY_SIZE;
                 break;
             }
-            if (!StructDeclaratorsTail || StructDeclaratorsTail->DimensionCount >= 16)
+            if (!g_CompilerContext->StructDeclaratorsTail || g_CompilerContext->StructDeclaratorsTail->DimensionCount >= 16)
             {
                 *Error = SCRIPT_ENGINE_ERROR_INVALID_ARRAY_SIZE;
                 break;
             }
-            StructDeclaratorsTail->Dimensions[StructDeclaratorsTail->DimensionCount++] = (unsigned int)Dimension;
+            g_CompilerContext->StructDeclaratorsTail->Dimensions[g_CompilerContext->StructDeclaratorsTail->DimensionCount++] = (unsigned int)Dimension;
         }
         else if (!strcmp(Operator->Value, "@STRUCT_DECLARATOR_COMPLETE"))
         {
@@ -1684,19 +1937,19 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
                 break;
             }
             Declarator->Name         = PlatformStrDup(Op0->Value);
-            Declarator->PointerDepth = StructPointerDepth;
+            Declarator->PointerDepth = g_CompilerContext->StructPointerDepth;
             RemoveToken(&Op0);
 
-            if (StructDeclaratorsTail)
+            if (g_CompilerContext->StructDeclaratorsTail)
             {
-                StructDeclaratorsTail->Next = Declarator;
+                g_CompilerContext->StructDeclaratorsTail->Next = Declarator;
             }
             else
             {
-                StructDeclarators = Declarator;
+                g_CompilerContext->StructDeclarators = Declarator;
             }
-            StructDeclaratorsTail = Declarator;
-            StructPointerDepth    = 0;
+            g_CompilerContext->StructDeclaratorsTail = Declarator;
+            g_CompilerContext->StructPointerDepth    = 0;
         }
         else if (!strcmp(Operator->Value, "@STRUCT_FORWARD_DECLARATION"))
         {
@@ -1709,18 +1962,18 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
         }
         else if (!strcmp(Operator->Value, "@STRUCT_DEFINITION_BEGIN"))
         {
-            Op0                     = Pop(MatchedStack);
-            CurrentStructDefinition = FindStructType(Op0->Value);
-            if (CurrentStructDefinition && CurrentStructDefinition->IsComplete)
+            Op0                                        = Pop(MatchedStack);
+            g_CompilerContext->CurrentStructDefinition = FindStructType(Op0->Value);
+            if (g_CompilerContext->CurrentStructDefinition && g_CompilerContext->CurrentStructDefinition->IsComplete)
             {
                 *Error = SCRIPT_ENGINE_ERROR_DUPLICATE_STRUCT_DEFINITION;
             }
-            else if (!CurrentStructDefinition)
+            else if (!g_CompilerContext->CurrentStructDefinition)
             {
-                CurrentStructDefinition = DeclareStructType(Op0->Value);
+                g_CompilerContext->CurrentStructDefinition = DeclareStructType(Op0->Value);
             }
             RemoveToken(&Op0);
-            if (!CurrentStructDefinition)
+            if (!g_CompilerContext->CurrentStructDefinition)
             {
                 *Error = SCRIPT_ENGINE_ERROR_SYNTAX;
             }
@@ -1734,7 +1987,7 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
                 break;
             }
 
-            for (Declarator = StructDeclarators; Declarator; Declarator = Declarator->Next)
+            for (Declarator = g_CompilerContext->StructDeclarators; Declarator; Declarator = Declarator->Next)
             {
                 PVARIABLE_TYPE MemberType = ApplyStructDeclarator(BaseType, Declarator);
                 if (!MemberType)
@@ -1747,7 +2000,7 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
                     *Error = SCRIPT_ENGINE_ERROR_INCOMPLETE_TYPE;
                     break;
                 }
-                if (!AddStructMember(CurrentStructDefinition, Declarator->Name, MemberType))
+                if (!AddStructMember(g_CompilerContext->CurrentStructDefinition, Declarator->Name, MemberType))
                 {
                     *Error = SCRIPT_ENGINE_ERROR_DUPLICATE_STRUCT_MEMBER;
                     break;
@@ -1757,7 +2010,7 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
         }
         else if (!strcmp(Operator->Value, "@STRUCT_DEFINITION_END"))
         {
-            if (!CompleteStructType(CurrentStructDefinition))
+            if (!CompleteStructType(g_CompilerContext->CurrentStructDefinition))
             {
                 *Error = SCRIPT_ENGINE_ERROR_INCOMPLETE_TYPE;
             }
@@ -1767,9 +2020,9 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
             PVARIABLE_TYPE           BaseType;
             PSTRUCT_DECLARATOR_STATE Declarator;
 
-            if (CurrentStructDefinition && CurrentStructDefinition->IsComplete && !MatchedStack->Pointer)
+            if (g_CompilerContext->CurrentStructDefinition && g_CompilerContext->CurrentStructDefinition->IsComplete && !MatchedStack->Pointer)
             {
-                BaseType = CurrentStructDefinition;
+                BaseType = g_CompilerContext->CurrentStructDefinition;
             }
             else
             {
@@ -1780,7 +2033,7 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
                 break;
             }
 
-            for (Declarator = StructDeclarators; Declarator; Declarator = Declarator->Next)
+            for (Declarator = g_CompilerContext->StructDeclarators; Declarator; Declarator = Declarator->Next)
             {
                 PVARIABLE_TYPE       ObjectType = ApplyStructDeclarator(BaseType, Declarator);
                 PSCRIPT_ENGINE_TOKEN IdToken;
@@ -1798,16 +2051,16 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
                 }
                 NewLocalIdentifier(IdToken, (unsigned int)ObjectType->Size);
                 SetLocalIdentifierVariableType(IdToken, ObjectType);
-                if (LastStructObject)
-                    RemoveToken(&LastStructObject);
-                IdToken->Type         = LOCAL_ID;
-                IdToken->VariableType = ObjectType;
-                LastStructObject      = CopyToken(IdToken);
-                LastStructObjectType  = ObjectType;
+                if (g_CompilerContext->LastStructObject)
+                    RemoveToken(&g_CompilerContext->LastStructObject);
+                IdToken->Type                           = LOCAL_ID;
+                IdToken->VariableType                   = ObjectType;
+                g_CompilerContext->LastStructObject     = CopyToken(IdToken);
+                g_CompilerContext->LastStructObjectType = ObjectType;
                 RemoveToken(&IdToken);
             }
             ResetStructDeclarators();
-            CurrentStructDefinition = NULL;
+            g_CompilerContext->CurrentStructDefinition = NULL;
         }
         else if (!strcmp(Operator->Value, "@STRUCT_INITIALIZER_BEGIN"))
         {
@@ -1829,8 +2082,8 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
                 }
                 Values[Count++] = Pop(MatchedStack);
             }
-            if (*Error != SCRIPT_ENGINE_ERROR_FREE || !MatchedStack->Pointer || !LastStructObject ||
-                !LastStructObjectType || LastStructObjectType->Kind != TY_STRUCT)
+            if (*Error != SCRIPT_ENGINE_ERROR_FREE || !MatchedStack->Pointer || !g_CompilerContext->LastStructObject ||
+                !g_CompilerContext->LastStructObjectType || g_CompilerContext->LastStructObjectType->Kind != TY_STRUCT)
             {
                 *Error = SCRIPT_ENGINE_ERROR_SYNTAX;
                 break;
@@ -1843,7 +2096,7 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
             Symbol->Value = FUNC_AGGREGATE_ZERO;
             PushSymbol(CodeBuffer, Symbol);
             RemoveSymbol(&Symbol);
-            Symbol = ToSymbol(LastStructObject, Error);
+            Symbol = ToSymbol(g_CompilerContext->LastStructObject, Error);
             PushSymbol(CodeBuffer, Symbol);
             RemoveSymbol(&Symbol);
             Symbol        = NewSymbol();
@@ -1853,15 +2106,15 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
             RemoveSymbol(&Symbol);
             Symbol        = NewSymbol();
             Symbol->Type  = SYMBOL_NUM_TYPE;
-            Symbol->Value = LastStructObjectType->Size;
+            Symbol->Value = g_CompilerContext->LastStructObjectType->Size;
             PushSymbol(CodeBuffer, Symbol);
             RemoveSymbol(&Symbol);
 
-            Member = LastStructObjectType->Members;
+            Member = g_CompilerContext->LastStructObjectType->Members;
             while (Count && Member)
             {
                 PSCRIPT_ENGINE_TOKEN ValueToken    = Values[--Count];
-                PSCRIPT_ENGINE_TOKEN AddressToken  = LastStructObject;
+                PSCRIPT_ENGINE_TOKEN AddressToken  = g_CompilerContext->LastStructObject;
                 BOOLEAN              AddressIsTemp = FALSE;
                 if (Member->Type->Kind == TY_STRUCT || Member->Type->Kind == TY_ARRAY ||
                     (Member->Type->Size != 1 && Member->Type->Size != 2 && Member->Type->Size != 4 && Member->Type->Size != 8))
@@ -1879,7 +2132,7 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
                     Symbol->Value      = FUNC_ADD;
                     PushSymbol(CodeBuffer, Symbol);
                     RemoveSymbol(&Symbol);
-                    Symbol = ToSymbol(LastStructObject, Error);
+                    Symbol = ToSymbol(g_CompilerContext->LastStructObject, Error);
                     PushSymbol(CodeBuffer, Symbol);
                     RemoveSymbol(&Symbol);
                     Symbol        = NewSymbol();
@@ -1932,21 +2185,21 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
                 Op1 = Pop(MatchedStack);
                 RemoveToken(&Op1);
             }
-            if (!LastStructObject || !LastStructObjectType || LastStructObjectType->Kind != TY_PTR)
+            if (!g_CompilerContext->LastStructObject || !g_CompilerContext->LastStructObjectType || g_CompilerContext->LastStructObjectType->Kind != TY_PTR)
             {
                 *Error = SCRIPT_ENGINE_ERROR_UNDEFINED_VARIABLE_TYPE;
                 break;
             }
-            RemotePointerType = CreateStructPointerType(LastStructObjectType->Base, POINTER_PROVENANCE_REMOTE);
+            RemotePointerType = CreateStructPointerType(g_CompilerContext->LastStructObjectType->Base, POINTER_PROVENANCE_REMOTE);
             if (!RemotePointerType)
             {
                 *Error = SCRIPT_ENGINE_ERROR_SYNTAX;
                 RemoveToken(&Op0);
                 break;
             }
-            LastStructObjectType           = RemotePointerType;
-            LastStructObject->VariableType = RemotePointerType;
-            SetLocalIdentifierVariableType(LastStructObject, RemotePointerType);
+            g_CompilerContext->LastStructObjectType           = RemotePointerType;
+            g_CompilerContext->LastStructObject->VariableType = RemotePointerType;
+            SetLocalIdentifierVariableType(g_CompilerContext->LastStructObject, RemotePointerType);
             Symbol        = NewSymbol();
             Symbol->Type  = SYMBOL_SEMANTIC_RULE_TYPE;
             Symbol->Value = FUNC_MOV;
@@ -1955,7 +2208,7 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
             Symbol = ToSymbol(Op0, Error);
             PushSymbol(CodeBuffer, Symbol);
             RemoveSymbol(&Symbol);
-            Symbol = ToSymbol(LastStructObject, Error);
+            Symbol = ToSymbol(g_CompilerContext->LastStructObject, Error);
             PushSymbol(CodeBuffer, Symbol);
             RemoveSymbol(&Symbol);
             RemoveToken(&Op0);
@@ -2079,17 +2332,44 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
                 RemoveToken(&Op0);
                 break;
             }
-            for (Index = 0; Index < StructPointerDepth; Index++)
+            for (Index = 0; Index < g_CompilerContext->StructPointerDepth; Index++)
             {
                 BaseType = CreatePointerType(BaseType);
             }
-            StructPointerDepth = 0;
+            g_CompilerContext->StructPointerDepth = 0;
             if (!BaseType || !AddTypedefType(Op0->Value, BaseType))
             {
                 *Error = SCRIPT_ENGINE_ERROR_DUPLICATE_TYPEDEF;
             }
             RemoveToken(&Op0);
         }
+        else if (!strcmp(Operator->Value, "@PERCPU_DECLARATION"))
+        {
+            Op0 = Pop(MatchedStack);
+
+            //
+            // The per-core variables share the indexes of the global variables,
+            // so a global variable that is already used cannot be changed
+            //
+            if (Op0->Type == GLOBAL_UNRESOLVED_ID)
+            {
+                Op0->VariableType   = GetDefaultImplicitVariableType();
+                Op0->IsImplicitType = TRUE;
+                Op0->IsPercpu       = TRUE;
+                NewGlobalIdentifier(Op0);
+            }
+            else if (Op0->Type != GLOBAL_ID)
+            {
+                *Error = SCRIPT_ENGINE_ERROR_SYNTAX;
+            }
+
+            if (*Error == SCRIPT_ENGINE_ERROR_FREE && !GetGlobalIdentifierIsPercpu(Op0))
+            {
+                *Error = SCRIPT_ENGINE_ERROR_GLOBAL_VARIABLE_IS_NOT_PERCPU;
+            }
+
+            RemoveToken(&Op0);
+        }
         else if (!strcmp(Operator->Value, "@INCLUDE"))
         {
             char *  IncludeFilePath;
@@ -2114,16 +2394,16 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
                 break;
             }
 
-            if (!IncludeHead)
+            if (!g_CompilerContext->IncludeHead)
             {
-                IncludeHead           = calloc(sizeof(INCLUDE_NODE), 1);
-                IncludeHead->FilePath = PlatformStrDup(FullPath);
+                g_CompilerContext->IncludeHead           = calloc(sizeof(INCLUDE_NODE), 1);
+                g_CompilerContext->IncludeHead->FilePath = PlatformStrDup(FullPath);
             }
             else
             {
                 PINCLUDE_NODE Node, PrevNode = NULL;
 
-                for (Node = IncludeHead; Node; PrevNode = Node, Node = Node->NextNode)
+                for (Node = g_CompilerContext->IncludeHead; Node; PrevNode = Node, Node = Node->NextNode)
                 {
                     if (!strcmp(Node->FilePath, FullPath))
                     {
@@ -2141,7 +2421,7 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
 
             if (!IncludedPath)
             {
-                *ScriptSource = InsertStrNew(*ScriptSource, InputIdx, IncludeFileBuffer);
+                *ScriptSource = InsertStrNew(*ScriptSource, g_CompilerContext->InputIdx, IncludeFileBuffer);
             }
         }
 
@@ -2175,21 +2455,21 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
             PushSymbol(CodeBuffer, JumpAddressSymbol);
             RemoveSymbol(&JumpAddressSymbol);
 
-            PUSER_DEFINED_FUNCTION_NODE Node = UserDefinedFunctionHead;
+            PUSER_DEFINED_FUNCTION_NODE Node = g_CompilerContext->UserDefinedFunctionHead;
             while (Node->NextNode)
             {
                 Node = Node->NextNode;
             }
             Node->NextNode = malloc(sizeof(USER_DEFINED_FUNCTION_NODE));
             PlatformZeroMemory(Node->NextNode, sizeof(USER_DEFINED_FUNCTION_NODE));
-            CurrentUserDefinedFunction = Node->NextNode;
+            g_CompilerContext->CurrentUserDefinedFunction = Node->NextNode;
 
-            CurrentUserDefinedFunction->Name                     = PlatformStrDup(Op0->Value);
-            CurrentUserDefinedFunction->Address                  = CodeBuffer->Pointer; // CurrentPointer
-            CurrentUserDefinedFunction->VariableType             = (long long unsigned)VariableType;
-            CurrentUserDefinedFunction->IdTable                  = (unsigned long long)NewTokenList();
-            CurrentUserDefinedFunction->FunctionParameterIdTable = (unsigned long long)NewTokenList();
-            CurrentUserDefinedFunction->TempMap                  = calloc(MAX_TEMP_COUNT, 1);
+            g_CompilerContext->CurrentUserDefinedFunction->Name                     = PlatformStrDup(Op0->Value);
+            g_CompilerContext->CurrentUserDefinedFunction->Address                  = CodeBuffer->Pointer; // CurrentPointer
+            g_CompilerContext->CurrentUserDefinedFunction->VariableType             = (long long unsigned)VariableType;
+            g_CompilerContext->CurrentUserDefinedFunction->IdTable                  = (unsigned long long)NewIdTable();
+            g_CompilerContext->CurrentUserDefinedFunction->FunctionParameterIdTable = (unsigned long long)NewIdTable();
+            g_CompilerContext->CurrentUserDefinedFunction->TempMap                  = calloc(MAX_TEMP_COUNT, 1);
 
             //
             // push stack base index
@@ -2266,14 +2546,14 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
             }
 
             NewFunctionParameterIdentifier(Op0);
-            CurrentUserDefinedFunction->ParameterNumber++;
+            g_CompilerContext->CurrentUserDefinedFunction->ParameterNumber++;
         }
         else if (!strcmp(Operator->Value, "@END_OF_USER_DEFINED_FUNCTION"))
         {
             UINT64  CurrentPointer = CodeBuffer->Pointer;
             PSYMBOL Symbol         = NULL;
 
-            if (!CurrentUserDefinedFunction)
+            if (!g_CompilerContext->CurrentUserDefinedFunction)
             {
                 *Error = SCRIPT_ENGINE_ERROR_SYNTAX;
                 break;
@@ -2282,13 +2562,13 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
             //
             // change local id to stack temp
             //
-            for (UINT64 i = CurrentUserDefinedFunction->Address; i < CurrentPointer; i++)
+            for (UINT64 i = g_CompilerContext->CurrentUserDefinedFunction->Address; i < CurrentPointer; i++)
             {
                 Symbol = CodeBuffer->Head + i;
                 if (Symbol->Type == SYMBOL_LOCAL_ID_TYPE)
                 {
                     Symbol->Type = SYMBOL_TEMP_TYPE;
-                    Symbol->Value += CurrentUserDefinedFunction->MaxTempNumber;
+                    Symbol->Value += g_CompilerContext->CurrentUserDefinedFunction->MaxTempNumber;
                 }
 
                 else if (Symbol->Type == SYMBOL_VARIABLE_COUNT_TYPE)
@@ -2300,7 +2580,7 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
                         if ((Symbol->Type & 0x7fffffff) == SYMBOL_LOCAL_ID_TYPE)
                         {
                             Symbol->Type = SYMBOL_TEMP_TYPE | (Symbol->Type & 0xffffffff00000000);
-                            Symbol->Value += CurrentUserDefinedFunction->MaxTempNumber;
+                            Symbol->Value += g_CompilerContext->CurrentUserDefinedFunction->MaxTempNumber;
                         }
                     }
                     i += VariableCount;
@@ -2310,13 +2590,13 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
             //
             // set memory size for stack buffer
             //
-            Symbol        = CodeBuffer->Head + CurrentUserDefinedFunction->Address + 6;
-            Symbol->Value = CurrentUserDefinedFunction->MaxTempNumber + CurrentUserDefinedFunction->LocalVariableNumber;
+            Symbol        = CodeBuffer->Head + g_CompilerContext->CurrentUserDefinedFunction->Address + 6;
+            Symbol->Value = g_CompilerContext->CurrentUserDefinedFunction->MaxTempNumber + g_CompilerContext->CurrentUserDefinedFunction->LocalVariableNumber;
 
             //
             // modify jump address
             //
-            for (UINT64 i = CurrentUserDefinedFunction->Address; i < CurrentPointer; i++)
+            for (UINT64 i = g_CompilerContext->CurrentUserDefinedFunction->Address; i < CurrentPointer; i++)
             {
                 Symbol = CodeBuffer->Head + i;
                 if (Symbol->Type == SYMBOL_SEMANTIC_RULE_TYPE && Symbol->Value == FUNC_JMP && (CodeBuffer->Head + i + 1)->Value == 0xfffffffffffffff0)
@@ -2368,19 +2648,19 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
             PushSymbol(CodeBuffer, TempSymbol);
             RemoveSymbol(&TempSymbol);
 
-            Symbol        = CodeBuffer->Head + CurrentUserDefinedFunction->Address - 1;
+            Symbol        = CodeBuffer->Head + g_CompilerContext->CurrentUserDefinedFunction->Address - 1;
             Symbol->Value = CodeBuffer->Pointer;
 
-            CurrentUserDefinedFunction = UserDefinedFunctionHead;
+            g_CompilerContext->CurrentUserDefinedFunction = g_CompilerContext->UserDefinedFunctionHead;
         }
         else if (!strcmp(Operator->Value, "@RETURN_OF_USER_DEFINED_FUNCTION_WITHOUT_VALUE"))
         {
-            if (!CurrentUserDefinedFunction)
+            if (!g_CompilerContext->CurrentUserDefinedFunction)
             {
                 *Error = SCRIPT_ENGINE_ERROR_SYNTAX;
                 break;
             }
-            if (((VARIABLE_TYPE *)CurrentUserDefinedFunction->VariableType)->Kind != TY_VOID)
+            if (((VARIABLE_TYPE *)g_CompilerContext->CurrentUserDefinedFunction->VariableType)->Kind != TY_VOID)
             {
                 *Error = SCRIPT_ENGINE_ERROR_NON_VOID_FUNCTION_NOT_RETURNING_VALUE;
                 break;
@@ -2403,12 +2683,12 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
         }
         else if (!strcmp(Operator->Value, "@RETURN_OF_USER_DEFINED_FUNCTION_WITH_VALUE"))
         {
-            if (!CurrentUserDefinedFunction)
+            if (!g_CompilerContext->CurrentUserDefinedFunction)
             {
                 *Error = SCRIPT_ENGINE_ERROR_SYNTAX;
                 break;
             }
-            if (((VARIABLE_TYPE *)CurrentUserDefinedFunction->VariableType)->Kind == TY_VOID)
+            if (((VARIABLE_TYPE *)g_CompilerContext->CurrentUserDefinedFunction->VariableType)->Kind == TY_VOID)
             {
                 *Error = SCRIPT_ENGINE_ERROR_VOID_FUNCTION_RETURNING_VALUE;
                 break;
@@ -3589,8 +3869,8 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
 
                 PushSymbol(CodeBuffer, OperatorSymbol);
                 Temp               = NewTemp(Error);
-                Temp->VariableType = (!strcmp(Operator->Value, "@NEG") ||
-                                      !strcmp(Operator->Value, "@NOT"))
+                Temp->VariableType = VariableType && (!strcmp(Operator->Value, "@NEG") ||
+                                                      !strcmp(Operator->Value, "@NOT"))
                                          ? VariableType
                                          : GetDefaultImplicitVariableType();
                 Push(MatchedStack, Temp);
@@ -3686,32 +3966,18 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
             do
             {
                 //
-                // Not the best way but some how for optimization
+                // The format specifiers are parsed once here, each argument keeps
+                // the descriptor of its specifier, so the evaluator doesn't parse
+                // the format again
                 //
                 if (*Str == '%')
                 {
-                    CHAR Temp = *(Str + 1);
-
-                    if (Temp == 'd' || Temp == 'i' || Temp == 'u' || Temp == 'o' ||
-                        Temp == 'x' || Temp == 'c' || Temp == 'p' || Temp == 's' || Temp == 'f' ||
+                    UINT32 SpecifierLength;
+                    UINT64 SpecifierKind = GetFormatSpecifierKind(Str, &SpecifierLength);
 
-                        !strncmp(Str, "%ws", 3) || !strncmp(Str, "%ls", 3) ||
-
-                        !strncmp(Str, "%ld", 3) || !strncmp(Str, "%li", 3) ||
-                        !strncmp(Str, "%lu", 3) || !strncmp(Str, "%lo", 3) ||
-                        !strncmp(Str, "%lx", 3) ||
-
-                        !strncmp(Str, "%hd", 3) || !strncmp(Str, "%hi", 3) ||
-                        !strncmp(Str, "%hu", 3) || !strncmp(Str, "%ho", 3) ||
-                        !strncmp(Str, "%hx", 3) ||
-
-                        !strncmp(Str, "%lld", 4) || !strncmp(Str, "%lli", 4) ||
-                        !strncmp(Str, "%llu", 4) || !strncmp(Str, "%llo", 4) ||
-                        !strncmp(Str, "%llx", 4)
-
-                    )
+                    if (SpecifierKind != 0)
                     {
-                        if (i < ArgCount)
+                        if (i < ArgCount && (UINT64)(Str - Format) <= SYMBOL_FORMAT_SPECIFIER_POSITION_MASK)
                         {
                             Symbol = FirstArg + i;
                         }
@@ -3721,7 +3987,9 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
                             break;
                         }
                         Symbol->Type &= 0xffffffff;
-                        Symbol->Type |= (UINT64)(Str - Format - 1) << 32;
+                        Symbol->Type |= (UINT64)(Str - Format) << SYMBOL_FORMAT_SPECIFIER_POSITION_SHIFT;
+                        Symbol->Type |= (UINT64)SpecifierLength << SYMBOL_FORMAT_SPECIFIER_LENGTH_SHIFT;
+                        Symbol->Type |= SpecifierKind << SYMBOL_FORMAT_SPECIFIER_KIND_SHIFT;
                         i++;
                     }
                 }
@@ -3741,6 +4009,61 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
         {
             PushSymbol(CodeBuffer, OperatorSymbol);
         }
+        else if (IsType17Func(Operator))
+        {
+            PushSymbol(CodeBuffer, OperatorSymbol);
+            PSYMBOL_BUFFER TempStack = NewSymbolBuffer();
+            do
+            {
+                if (Op1)
+                {
+                    RemoveToken(&Op1);
+                }
+                Op1 = Pop(MatchedStack);
+                if (Op1->Type != SEMANTIC_RULE)
+                {
+                    Op1Symbol = ToSymbol(Op1, Error);
+
+                    FreeTemp(Op1);
+                    PushSymbol(TempStack, Op1Symbol);
+                    RemoveSymbol(&Op1Symbol);
+
+                    if (*Error != SCRIPT_ENGINE_ERROR_FREE)
+                    {
+                        break;
+                    }
+                }
+
+            } while (!(Op1->Type == SEMANTIC_RULE && !strcmp(Op1->Value, "@VARGSTART")));
+
+            //
+            // The record of emit is built on the stack of the evaluator, so
+            // the number of its values is limited
+            //
+            if (*Error == SCRIPT_ENGINE_ERROR_FREE && TempStack->Pointer > SCRIPT_EMIT_RECORD_MAXIMUM_ARGUMENTS)
+            {
+                *Error = SCRIPT_ENGINE_ERROR_TOO_MANY_EMIT_ARGUMENTS;
+            }
+
+            if (*Error != SCRIPT_ENGINE_ERROR_FREE)
+            {
+                RemoveSymbolBuffer((PVOID)TempStack);
+                break;
+            }
+
+            PSYMBOL OperandCountSymbol = NewSymbol();
+            OperandCountSymbol->Type   = SYMBOL_VARIABLE_COUNT_TYPE;
+            OperandCountSymbol->Value  = TempStack->Pointer;
+
+            PushSymbol(CodeBuffer, OperandCountSymbol);
+            RemoveSymbol(&OperandCountSymbol);
+
+            for (int i = TempStack->Pointer - 1; i >= 0; i--)
+            {
+                PushSymbol(CodeBuffer, TempStack->Head + i);
+            }
+            RemoveSymbolBuffer((PVOID)TempStack);
+        }
         else if (IsType16Func(Operator))
         {
             PushSymbol(CodeBuffer, OperatorSymbol);
@@ -3872,12 +4195,17 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
         }
         else if (IsAssignmentOperator(Operator))
         {
-            BOOL Handled = FALSE;
-            Op1          = TopIndexed(MatchedStack, 1);
+            BOOL           Handled = FALSE;
+            PVARIABLE_TYPE Op1Type;
+            Op1     = TopIndexed(MatchedStack, 1);
+            Op1Type = (PVARIABLE_TYPE)Op1->VariableType;
 
-            if (Op1->IsAddress && ((VARIABLE_TYPE *)Op1->VariableType)->Kind != TY_PTR)
+            //
+            // Function parameters and unresolved variables have no type here
+            //
+            if (Op1->IsAddress && Op1Type && Op1Type->Kind != TY_PTR)
             {
-                PVARIABLE_TYPE       LValueType = (PVARIABLE_TYPE)Op1->VariableType;
+                PVARIABLE_TYPE       LValueType = Op1Type;
                 PVARIABLE_TYPE       CommonType;
                 UINT64               TypedOpcode;
                 PSCRIPT_ENGINE_TOKEN LoadedValue;
@@ -4000,7 +4328,7 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
                 }
             }
 
-            if (!Handled && ((VARIABLE_TYPE *)Op1->VariableType)->Kind == TY_PTR)
+            if (!Handled && Op1Type && Op1Type->Kind == TY_PTR)
             {
                 if (!strcmp(Operator->Value, "@ADD_ASSIGNMENT"))
                 {
@@ -4620,10 +4948,16 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
         }
         else if (IsOneOperandOperator(Operator))
         {
-            BOOL Handled = FALSE;
-            Op0          = Top(MatchedStack);
+            BOOL           Handled = FALSE;
+            PVARIABLE_TYPE Op0Type;
+            Op0     = Top(MatchedStack);
+            Op0Type = (PVARIABLE_TYPE)Op0->VariableType;
 
-            if (((VARIABLE_TYPE *)Op0->VariableType)->Kind == TY_PTR)
+            //
+            // Function parameters and unresolved variables have no type here, the
+            // latter are reported once the operand is converted to a symbol
+            //
+            if (Op0Type && Op0Type->Kind == TY_PTR)
             {
                 if (!strcmp(Operator->Value, "@INC"))
                 {
@@ -4636,7 +4970,7 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
 
                     Symbol        = NewSymbol();
                     Symbol->Type  = SYMBOL_NUM_TYPE;
-                    Symbol->Value = ((VARIABLE_TYPE *)Op0->VariableType)->Base->Size;
+                    Symbol->Value = Op0Type->Base->Size;
                     PushSymbol(CodeBuffer, Symbol);
 
                     Op0       = Pop(MatchedStack);
@@ -4663,7 +4997,7 @@ CodeGen(PSCRIPT_ENGINE_TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PSCRI
 
                     Symbol        = NewSymbol();
                     Symbol->Type  = SYMBOL_NUM_TYPE;
-                    Symbol->Value = ((VARIABLE_TYPE *)Op0->VariableType)->Base->Size;
+                    Symbol->Value = Op0Type->Base->Size;
                     PushSymbol(CodeBuffer, Symbol);
 
                     Op0       = Pop(MatchedStack);
@@ -5535,12 +5869,12 @@ BooleanExpressionExtractEnd(char * str, BOOL * WaitForWaitStatementBooleanExpres
     UINT64 BooleanExpressionSize = 0;
     if (*WaitForWaitStatementBooleanExpression)
     {
-        while (str[InputIdx + BooleanExpressionSize - 1] != ';')
+        while (str[g_CompilerContext->InputIdx + BooleanExpressionSize - 1] != ';')
         {
             BooleanExpressionSize += 1;
         }
         *WaitForWaitStatementBooleanExpression = FALSE;
-        return InputIdx + BooleanExpressionSize - 1;
+        return g_CompilerContext->InputIdx + BooleanExpressionSize - 1;
     }
     else
     {
@@ -5549,17 +5883,17 @@ BooleanExpressionExtractEnd(char * str, BOOL * WaitForWaitStatementBooleanExpres
         {
             OpenParanthesesCount++;
         }
-        while (str[InputIdx + BooleanExpressionSize - 1] != '\0')
+        while (str[g_CompilerContext->InputIdx + BooleanExpressionSize - 1] != '\0')
         {
-            if (str[InputIdx + BooleanExpressionSize - 1] == ')')
+            if (str[g_CompilerContext->InputIdx + BooleanExpressionSize - 1] == ')')
             {
                 OpenParanthesesCount--;
                 if (OpenParanthesesCount == 0)
                 {
-                    return InputIdx + BooleanExpressionSize - 1;
+                    return g_CompilerContext->InputIdx + BooleanExpressionSize - 1;
                 }
             }
-            else if (str[InputIdx + BooleanExpressionSize - 1] == '(')
+            else if (str[g_CompilerContext->InputIdx + BooleanExpressionSize - 1] == '(')
             {
                 OpenParanthesesCount++;
             }
@@ -5598,7 +5932,7 @@ ScriptEngineBooleanExpresssionParse(
 #ifdef _SCRIPT_ENGINE_LALR_DBG_EN
     printf("Boolean Expression: ");
     printf("%s", FirstToken->Value);
-    for (int i = InputIdx - 1; i < BooleanExpressionSize; i++)
+    for (int i = g_CompilerContext->InputIdx - 1; i < BooleanExpressionSize; i++)
     {
         printf("%c", str[i]);
     }
@@ -5668,13 +6002,13 @@ ScriptEngineBooleanExpresssionParse(
             State = NewToken(STATE_ID, buffer);
             Push(Stack, State);
 
-            InputIdxTemp = InputIdx;
+            InputIdxTemp = g_CompilerContext->InputIdx;
             CTemp        = *c;
 
             CurrentIn = Scan(str, c);
-            if (InputIdx - 1 > BooleanExpressionSize)
+            if (g_CompilerContext->InputIdx - 1 > BooleanExpressionSize)
             {
-                InputIdx = InputIdxTemp;
+                g_CompilerContext->InputIdx = InputIdxTemp;
                 *c       = CTemp;
 
                 RemoveToken(&CurrentIn);
@@ -5914,7 +6248,7 @@ ToSymbol(PSCRIPT_ENGINE_TOKEN Token, PSCRIPT_ENGINE_ERROR_TYPE Error)
     {
     case GLOBAL_ID:
         Symbol->Value = GetGlobalIdentifierVal(Token);
-        SetType(&Symbol->Type, SYMBOL_GLOBAL_ID_TYPE);
+        SetType(&Symbol->Type, Token->IsPercpu ? SYMBOL_PERCPU_ID_TYPE : SYMBOL_GLOBAL_ID_TYPE);
         return Symbol;
 
     case LOCAL_ID:
@@ -6049,6 +6383,7 @@ NewSymbolBuffer(void)
     SymbolBuffer->Pointer = 0;
     SymbolBuffer->Size    = SYMBOL_BUFFER_INIT_SIZE;
     SymbolBuffer->Head    = (PSYMBOL)malloc(SymbolBuffer->Size * sizeof(SYMBOL));
+    SymbolBuffer->Lines   = (unsigned int *)malloc(SymbolBuffer->Size * sizeof(unsigned int));
     SymbolBuffer->Message = NULL;
     return SymbolBuffer;
 }
@@ -6065,6 +6400,7 @@ RemoveSymbolBuffer(PVOID SymbolBuffer)
 
     free(SymBuf->Message);
     free(SymBuf->Head);
+    free(SymBuf->Lines);
     free(SymBuf);
 }
 
@@ -6081,9 +6417,10 @@ PushSymbol(PSYMBOL_BUFFER SymbolBuffer, const PSYMBOL Symbol)
     //
     // Calculate address to write new token
     //
-    uintptr_t Head      = (uintptr_t)SymbolBuffer->Head;
-    uintptr_t Pointer   = (uintptr_t)SymbolBuffer->Pointer;
-    PSYMBOL   WriteAddr = (PSYMBOL)(Head + Pointer * sizeof(SYMBOL));
+    uintptr_t    Head       = (uintptr_t)SymbolBuffer->Head;
+    uintptr_t    Pointer    = (uintptr_t)SymbolBuffer->Pointer;
+    PSYMBOL      WriteAddr  = (PSYMBOL)(Head + Pointer * sizeof(SYMBOL));
+    unsigned int SymbolLine = g_CompilerContext ? g_CompilerContext->LastTokenLine : 0;
 
     if (Symbol->Type == SYMBOL_STRING_TYPE || Symbol->Type == SYMBOL_WSTRING_TYPE)
     {
@@ -6109,10 +6446,13 @@ PushSymbol(PSYMBOL_BUFFER SymbolBuffer, const PSYMBOL Symbol)
             //
             // Allocate a new buffer for string list with doubled length
             //
-            PSYMBOL NewHead = (PSYMBOL)malloc(NewSize * sizeof(SYMBOL));
+            PSYMBOL        NewHead  = (PSYMBOL)malloc(NewSize * sizeof(SYMBOL));
+            unsigned int * NewLines = (unsigned int *)malloc(NewSize * sizeof(unsigned int));
 
-            if (NewHead == NULL)
+            if (NewHead == NULL || NewLines == NULL)
             {
+                free(NewHead);
+                free(NewLines);
                 printf("err, could not allocate buffer");
                 return NULL;
             }
@@ -6121,29 +6461,38 @@ PushSymbol(PSYMBOL_BUFFER SymbolBuffer, const PSYMBOL Symbol)
             // Copy old buffer to new buffer
             //
             memcpy(NewHead, SymbolBuffer->Head, SymbolBuffer->Size * sizeof(SYMBOL));
+            memcpy(NewLines, SymbolBuffer->Lines, SymbolBuffer->Size * sizeof(unsigned int));
 
             //
             // Free old buffer
             //
             free(SymbolBuffer->Head);
+            free(SymbolBuffer->Lines);
 
             //
             // Update Head and size of SymbolBuffer
             //
-            SymbolBuffer->Size = NewSize;
-            SymbolBuffer->Head = NewHead;
+            SymbolBuffer->Size  = NewSize;
+            SymbolBuffer->Head  = NewHead;
+            SymbolBuffer->Lines = NewLines;
         }
         WriteAddr       = (PSYMBOL)((uintptr_t)SymbolBuffer->Head + (uintptr_t)Pointer * (uintptr_t)sizeof(SYMBOL));
         WriteAddr->Type = Symbol->Type;
         WriteAddr->Len  = Symbol->Len;
         memcpy((char *)&WriteAddr->Value, (char *)&Symbol->Value, Symbol->Len);
+
+        for (uintptr_t i = Pointer; i < SymbolBuffer->Pointer; i++)
+        {
+            SymbolBuffer->Lines[i] = SymbolLine;
+        }
     }
     else
     {
         //
         // Write input to the appropriate address in SymbolBuffer
         //
-        *WriteAddr = *Symbol;
+        *WriteAddr                   = *Symbol;
+        SymbolBuffer->Lines[Pointer] = SymbolLine;
 
         //
         // Update Pointer
@@ -6158,10 +6507,13 @@ PushSymbol(PSYMBOL_BUFFER SymbolBuffer, const PSYMBOL Symbol)
             //
             // Allocate a new buffer for string list with doubled length
             //
-            PSYMBOL NewHead = (PSYMBOL)malloc(2 * SymbolBuffer->Size * sizeof(SYMBOL));
+            PSYMBOL        NewHead  = (PSYMBOL)malloc(2 * SymbolBuffer->Size * sizeof(SYMBOL));
+            unsigned int * NewLines = (unsigned int *)malloc(2 * SymbolBuffer->Size * sizeof(unsigned int));
 
-            if (NewHead == NULL)
+            if (NewHead == NULL || NewLines == NULL)
             {
+                free(NewHead);
+                free(NewLines);
                 printf("err, could not allocate buffer");
                 return NULL;
             }
@@ -6170,17 +6522,20 @@ PushSymbol(PSYMBOL_BUFFER SymbolBuffer, const PSYMBOL Symbol)
             // Copy old Buffer to new buffer
             //
             memcpy(NewHead, SymbolBuffer->Head, SymbolBuffer->Size * sizeof(SYMBOL));
+            memcpy(NewLines, SymbolBuffer->Lines, SymbolBuffer->Size * sizeof(unsigned int));
 
             //
             // Free Old buffer
             //
             free(SymbolBuffer->Head);
+            free(SymbolBuffer->Lines);
 
             //
             // Update Head and size of SymbolBuffer
             //
             SymbolBuffer->Size *= 2;
-            SymbolBuffer->Head = NewHead;
+            SymbolBuffer->Head  = NewHead;
+            SymbolBuffer->Lines = NewLines;
         }
     }
 
@@ -6227,12 +6582,11 @@ RegisterToInt(char * str)
     //
     // Check for register names
     //
-    for (int i = 0; i < REGISTER_MAP_LIST_LENGTH; i++)
+    unsigned long long int Register = PerfectHashLookup(&RegisterHashTable, str);
+
+    if (Register != INVALID)
     {
-        if (!strcmp(str, RegisterMapList[i].Name))
-        {
-            return RegisterMapList[i].Type;
-        }
+        return Register;
     }
 
     //
@@ -6325,14 +6679,7 @@ RegisterToInt(char * str)
 unsigned long long int
 PseudoRegToInt(char * str)
 {
-    for (int i = 0; i < PSEUDO_REGISTER_MAP_LIST_LENGTH; i++)
-    {
-        if (!strcmp(str, PseudoRegisterMapList[i].Name))
-        {
-            return PseudoRegisterMapList[i].Type;
-        }
-    }
-    return INVALID;
+    return PerfectHashLookup(&PseudoRegisterHashTable, str);
 }
 
 /**
@@ -6368,7 +6715,7 @@ HandleError(PSCRIPT_ENGINE_ERROR_TYPE Error, char * str)
     // calculate position of current line
     //
     unsigned int LineEnd;
-    for (int i = InputIdx;; i++)
+    for (int i = g_CompilerContext->InputIdx;; i++)
     {
         if (str[i] == '\n' || str[i] == '\0')
         {
@@ -6379,10 +6726,10 @@ HandleError(PSCRIPT_ENGINE_ERROR_TYPE Error, char * str)
 
     //
     // allocate required memory for message, 16 for line, 100 for error information,
-    // (CurrentTokenIdx - CurrentLineIdx) for space and,
-    // (LineEnd - CurrentLineIdx) for input string
+    // (g_CompilerContext->CurrentTokenIdx - g_CompilerContext->CurrentLineIdx) for space and,
+    // (LineEnd - g_CompilerContext->CurrentLineIdx) for input string
     //
-    int    MessageSize = 16 + 100 + (CurrentTokenIdx - CurrentLineIdx) + (LineEnd - CurrentLineIdx);
+    int    MessageSize = 16 + 100 + (g_CompilerContext->CurrentTokenIdx - g_CompilerContext->CurrentLineIdx) + (LineEnd - g_CompilerContext->CurrentLineIdx);
     char * Message     = (char *)malloc(MessageSize);
 
     if (Message == NULL)
@@ -6396,13 +6743,13 @@ HandleError(PSCRIPT_ENGINE_ERROR_TYPE Error, char * str)
     //
     strcpy(Message, "Line ");
     char Line[16] = {0};
-    sprintf(Line, "%d:\n", CurrentLine);
+    sprintf(Line, "%d:\n", g_CompilerContext->CurrentLine);
     strcat(Message, Line);
 
     //
     // add the line which error happened at
     //
-    strncat(Message, (str + CurrentLineIdx), LineEnd - CurrentLineIdx);
+    strncat(Message, (str + g_CompilerContext->CurrentLineIdx), LineEnd - g_CompilerContext->CurrentLineIdx);
 
     strcat(Message, "\n");
 
@@ -6410,7 +6757,7 @@ HandleError(PSCRIPT_ENGINE_ERROR_TYPE Error, char * str)
     // add pointer
     //
     char Space = ' ';
-    int  n     = (CurrentTokenIdx - CurrentLineIdx);
+    int  n     = (g_CompilerContext->CurrentTokenIdx - g_CompilerContext->CurrentLineIdx);
     for (int i = 0; i < n; i++)
     {
         strncat(Message, &Space, 1);
@@ -6486,6 +6833,12 @@ HandleError(PSCRIPT_ENGINE_ERROR_TYPE Error, char * str)
     case SCRIPT_ENGINE_ERROR_UNSUPPORTED_FLOAT_OPERATION:
         strcat(Message, "Unsupported floating-point operation");
         return Message;
+    case SCRIPT_ENGINE_ERROR_GLOBAL_VARIABLE_IS_NOT_PERCPU:
+        strcat(Message, "Global variable is already used and cannot be declared as percpu");
+        return Message;
+    case SCRIPT_ENGINE_ERROR_TOO_MANY_EMIT_ARGUMENTS:
+        strcat(Message, "Too many arguments for emit");
+        return Message;
     default:
         strcat(Message, "Unknown Error: ");
         return Message;
@@ -6501,16 +6854,13 @@ HandleError(PSCRIPT_ENGINE_ERROR_TYPE Error, char * str)
 int
 GetGlobalIdentifierVal(PSCRIPT_ENGINE_TOKEN Token)
 {
-    PSCRIPT_ENGINE_TOKEN CurrentToken;
-    for (uintptr_t i = 0; i < GlobalIdTable->Pointer; i++)
-    {
-        CurrentToken = *(GlobalIdTable->Head + i);
-        if (!strcmp(Token->Value, CurrentToken->Value))
-        {
-            return (int)i;
-        }
-    }
-    return -1;
+    int Index;
+
+    AcquireGlobalIdTableLock();
+    IdTableFind(GlobalIdTable, Token->Value, &Index);
+    ReleaseGlobalIdTableLock();
+
+    return Index;
 }
 
 /**
@@ -6522,14 +6872,10 @@ GetGlobalIdentifierVal(PSCRIPT_ENGINE_TOKEN Token)
 int
 GetLocalIdentifierVal(PSCRIPT_ENGINE_TOKEN Token)
 {
-    PSCRIPT_ENGINE_TOKEN CurrentToken;
-    for (uintptr_t i = 0; i < ((PSCRIPT_ENGINE_TOKEN_LIST)CurrentUserDefinedFunction->IdTable)->Pointer; i++)
+    PSCRIPT_ENGINE_TOKEN CurrentToken = IdTableFind((PSCRIPT_ENGINE_ID_TABLE)g_CompilerContext->CurrentUserDefinedFunction->IdTable, Token->Value, NULL);
+    if (CurrentToken)
     {
-        CurrentToken = *(((PSCRIPT_ENGINE_TOKEN_LIST)CurrentUserDefinedFunction->IdTable)->Head + i);
-        if (!strcmp(Token->Value, CurrentToken->Value))
-        {
-            return (int)CurrentToken->VariableMemoryIdx;
-        }
+        return (int)CurrentToken->VariableMemoryIdx;
     }
     return -1;
 }
@@ -6537,15 +6883,31 @@ GetLocalIdentifierVal(PSCRIPT_ENGINE_TOKEN Token)
 /**
  * @brief Allocates a new global variable and returns the integer assigned to it
  *
+ * @details If another compilation (thread) has already allocated the same
+ * global variable, the integer of the existing variable is returned
+ *
  * @param Token
  * @return int
  */
 int
 NewGlobalIdentifier(PSCRIPT_ENGINE_TOKEN Token)
 {
-    PSCRIPT_ENGINE_TOKEN CopiedToken = CopyToken(Token);
-    GlobalIdTable                    = Push(GlobalIdTable, CopiedToken);
-    return GlobalIdTable->Pointer - 1;
+    int Index;
+
+    AcquireGlobalIdTableLock();
+
+    if (!IdTableFind(GlobalIdTable, Token->Value, &Index))
+    {
+        PSCRIPT_ENGINE_ARENA TokenArena = SwitchTokenArena(NULL);
+
+        Index = IdTableAdd(GlobalIdTable, CopyToken(Token));
+
+        SwitchTokenArena(TokenArena);
+    }
+
+    ReleaseGlobalIdTableLock();
+
+    return Index;
 }
 
 /**
@@ -6556,15 +6918,15 @@ NewGlobalIdentifier(PSCRIPT_ENGINE_TOKEN Token)
 VOID
 SetGlobalIdentifierVariableType(PSCRIPT_ENGINE_TOKEN Token, VARIABLE_TYPE * VariableType)
 {
-    PSCRIPT_ENGINE_TOKEN CurrentToken;
-    for (uintptr_t i = 0; i < GlobalIdTable->Pointer; i++)
+    AcquireGlobalIdTableLock();
+
+    PSCRIPT_ENGINE_TOKEN CurrentToken = IdTableFind(GlobalIdTable, Token->Value, NULL);
+    if (CurrentToken)
     {
-        CurrentToken = *(GlobalIdTable->Head + i);
-        if (!strcmp(Token->Value, CurrentToken->Value))
-        {
-            CurrentToken->VariableType = (VARIABLE_TYPE *)VariableType;
-        }
+        CurrentToken->VariableType = (VARIABLE_TYPE *)VariableType;
     }
+
+    ReleaseGlobalIdTableLock();
 }
 
 /**
@@ -6575,31 +6937,61 @@ SetGlobalIdentifierVariableType(PSCRIPT_ENGINE_TOKEN Token, VARIABLE_TYPE * Vari
 VARIABLE_TYPE *
 GetGlobalIdentifierVariableType(PSCRIPT_ENGINE_TOKEN Token)
 {
-    PSCRIPT_ENGINE_TOKEN CurrentToken;
-    for (uintptr_t i = 0; i < GlobalIdTable->Pointer; i++)
+    VARIABLE_TYPE * VariableType = 0;
+
+    AcquireGlobalIdTableLock();
+
+    PSCRIPT_ENGINE_TOKEN CurrentToken = IdTableFind(GlobalIdTable, Token->Value, NULL);
+    if (CurrentToken)
     {
-        CurrentToken = *(GlobalIdTable->Head + i);
-        if (!strcmp(Token->Value, CurrentToken->Value))
-        {
-            return CurrentToken->VariableType;
-        }
+        VariableType = CurrentToken->VariableType;
     }
-    return 0;
+
+    ReleaseGlobalIdTableLock();
+
+    return VariableType;
 }
 
 BOOLEAN
 GetGlobalIdentifierIsImplicitType(PSCRIPT_ENGINE_TOKEN Token)
 {
-    PSCRIPT_ENGINE_TOKEN CurrentToken;
-    for (uintptr_t i = 0; i < GlobalIdTable->Pointer; i++)
+    BOOLEAN IsImplicitType = FALSE;
+
+    AcquireGlobalIdTableLock();
+
+    PSCRIPT_ENGINE_TOKEN CurrentToken = IdTableFind(GlobalIdTable, Token->Value, NULL);
+    if (CurrentToken)
     {
-        CurrentToken = *(GlobalIdTable->Head + i);
-        if (!strcmp(Token->Value, CurrentToken->Value))
-        {
-            return CurrentToken->IsImplicitType;
-        }
+        IsImplicitType = CurrentToken->IsImplicitType;
     }
-    return FALSE;
+
+    ReleaseGlobalIdTableLock();
+
+    return IsImplicitType;
+}
+
+/**
+ * @brief Checks whether a global variable is declared as a per-core (percpu) variable
+ *
+ * @param Token
+ * @return BOOLEAN
+ */
+BOOLEAN
+GetGlobalIdentifierIsPercpu(PSCRIPT_ENGINE_TOKEN Token)
+{
+    BOOLEAN IsPercpu = FALSE;
+
+    AcquireGlobalIdTableLock();
+
+    PSCRIPT_ENGINE_TOKEN CurrentToken = IdTableFind(GlobalIdTable, Token->Value, NULL);
+    if (CurrentToken)
+    {
+        IsPercpu = CurrentToken->IsPercpu;
+    }
+
+    ReleaseGlobalIdTableLock();
+
+    return IsPercpu;
 }
 
 /**
@@ -6613,9 +7005,9 @@ NewLocalIdentifier(PSCRIPT_ENGINE_TOKEN Token, unsigned int VariableSize)
 {
     PSCRIPT_ENGINE_TOKEN CopiedToken    = CopyToken(Token);
     unsigned int         VariableNumber = ((VariableSize + 8 - 1) & ~(8 - 1)) / 8;
-    CopiedToken->VariableMemoryIdx      = CurrentUserDefinedFunction->LocalVariableNumber;
-    CurrentUserDefinedFunction->LocalVariableNumber += VariableNumber;
-    Push(((PSCRIPT_ENGINE_TOKEN_LIST)CurrentUserDefinedFunction->IdTable), CopiedToken);
+    CopiedToken->VariableMemoryIdx      = g_CompilerContext->CurrentUserDefinedFunction->LocalVariableNumber;
+    g_CompilerContext->CurrentUserDefinedFunction->LocalVariableNumber += VariableNumber;
+    IdTableAdd((PSCRIPT_ENGINE_ID_TABLE)g_CompilerContext->CurrentUserDefinedFunction->IdTable, CopiedToken);
     return CopiedToken->VariableMemoryIdx;
 }
 
@@ -6627,14 +7019,10 @@ NewLocalIdentifier(PSCRIPT_ENGINE_TOKEN Token, unsigned int VariableSize)
 VOID
 SetLocalIdentifierVariableType(PSCRIPT_ENGINE_TOKEN Token, VARIABLE_TYPE * VariableType)
 {
-    PSCRIPT_ENGINE_TOKEN CurrentToken;
-    for (uintptr_t i = 0; i < ((PSCRIPT_ENGINE_TOKEN_LIST)CurrentUserDefinedFunction->IdTable)->Pointer; i++)
+    PSCRIPT_ENGINE_TOKEN CurrentToken = IdTableFind((PSCRIPT_ENGINE_ID_TABLE)g_CompilerContext->CurrentUserDefinedFunction->IdTable, Token->Value, NULL);
+    if (CurrentToken)
     {
-        CurrentToken = *(((PSCRIPT_ENGINE_TOKEN_LIST)CurrentUserDefinedFunction->IdTable)->Head + i);
-        if (!strcmp(Token->Value, CurrentToken->Value))
-        {
-            CurrentToken->VariableType = VariableType;
-        }
+        CurrentToken->VariableType = VariableType;
     }
 }
 
@@ -6647,14 +7035,10 @@ SetLocalIdentifierVariableType(PSCRIPT_ENGINE_TOKEN Token, VARIABLE_TYPE * Varia
 VARIABLE_TYPE *
 GetLocalIdentifierVariableType(PSCRIPT_ENGINE_TOKEN Token)
 {
-    PSCRIPT_ENGINE_TOKEN CurrentToken;
-    for (uintptr_t i = 0; i < ((PSCRIPT_ENGINE_TOKEN_LIST)CurrentUserDefinedFunction->IdTable)->Pointer; i++)
+    PSCRIPT_ENGINE_TOKEN CurrentToken = IdTableFind((PSCRIPT_ENGINE_ID_TABLE)g_CompilerContext->CurrentUserDefinedFunction->IdTable, Token->Value, NULL);
+    if (CurrentToken)
     {
-        CurrentToken = *(((PSCRIPT_ENGINE_TOKEN_LIST)CurrentUserDefinedFunction->IdTable)->Head + i);
-        if (!strcmp(Token->Value, CurrentToken->Value))
-        {
-            return CurrentToken->VariableType;
-        }
+        return CurrentToken->VariableType;
     }
     return 0;
 }
@@ -6662,14 +7046,10 @@ GetLocalIdentifierVariableType(PSCRIPT_ENGINE_TOKEN Token)
 BOOLEAN
 GetLocalIdentifierIsImplicitType(PSCRIPT_ENGINE_TOKEN Token)
 {
-    PSCRIPT_ENGINE_TOKEN CurrentToken;
-    for (uintptr_t i = 0; i < ((PSCRIPT_ENGINE_TOKEN_LIST)CurrentUserDefinedFunction->IdTable)->Pointer; i++)
+    PSCRIPT_ENGINE_TOKEN CurrentToken = IdTableFind((PSCRIPT_ENGINE_ID_TABLE)g_CompilerContext->CurrentUserDefinedFunction->IdTable, Token->Value, NULL);
+    if (CurrentToken)
     {
-        CurrentToken = *(((PSCRIPT_ENGINE_TOKEN_LIST)CurrentUserDefinedFunction->IdTable)->Head + i);
-        if (!strcmp(Token->Value, CurrentToken->Value))
-        {
-            return CurrentToken->IsImplicitType;
-        }
+        return CurrentToken->IsImplicitType;
     }
     return FALSE;
 }
@@ -6684,8 +7064,7 @@ int
 NewFunctionParameterIdentifier(PSCRIPT_ENGINE_TOKEN Token)
 {
     PSCRIPT_ENGINE_TOKEN CopiedToken = CopyToken(Token);
-    Push(((PSCRIPT_ENGINE_TOKEN_LIST)CurrentUserDefinedFunction->FunctionParameterIdTable), CopiedToken);
-    return ((PSCRIPT_ENGINE_TOKEN_LIST)CurrentUserDefinedFunction->FunctionParameterIdTable)->Pointer - 1;
+    return IdTableAdd((PSCRIPT_ENGINE_ID_TABLE)g_CompilerContext->CurrentUserDefinedFunction->FunctionParameterIdTable, CopiedToken);
 }
 
 /**
@@ -6697,16 +7076,9 @@ NewFunctionParameterIdentifier(PSCRIPT_ENGINE_TOKEN Token)
 int
 GetFunctionParameterIdentifier(PSCRIPT_ENGINE_TOKEN Token)
 {
-    PSCRIPT_ENGINE_TOKEN CurrentToken;
-    for (uintptr_t i = 0; i < ((PSCRIPT_ENGINE_TOKEN_LIST)CurrentUserDefinedFunction->FunctionParameterIdTable)->Pointer; i++)
-    {
-        CurrentToken = *(((PSCRIPT_ENGINE_TOKEN_LIST)CurrentUserDefinedFunction->FunctionParameterIdTable)->Head + i);
-        if (!strcmp(Token->Value, CurrentToken->Value))
-        {
-            return (int)i;
-        }
-    }
-    return -1;
+    int Index;
+    IdTableFind((PSCRIPT_ENGINE_ID_TABLE)g_CompilerContext->CurrentUserDefinedFunction->FunctionParameterIdTable, Token->Value, &Index);
+    return Index;
 }
 
 /**
@@ -6718,7 +7090,7 @@ GetFunctionParameterIdentifier(PSCRIPT_ENGINE_TOKEN Token)
 PUSER_DEFINED_FUNCTION_NODE
 GetUserDefinedFunctionNode(PSCRIPT_ENGINE_TOKEN Token)
 {
-    PUSER_DEFINED_FUNCTION_NODE Node = UserDefinedFunctionHead;
+    PUSER_DEFINED_FUNCTION_NODE Node = g_CompilerContext->UserDefinedFunctionHead;
     while (Node)
     {
         if (!strcmp((const char *)Token->Value, Node->Name))
@@ -6854,6 +7226,146 @@ ScriptEngineSetHwdbgInstanceInfo(HWDBG_INSTANCE_INFORMATION * InstancInfo)
     return TRUE;
 }
 
+/**
+ * @brief Set the optimization level of the generated code of the script engine
+ *
+ * @param Level SCRIPT_ENGINE_OPTIMIZATION_LEVEL_O0 or SCRIPT_ENGINE_OPTIMIZATION_LEVEL_O1
+ * @return VOID
+ */
+VOID
+ScriptEngineSetOptimizationLevel(UINT32 Level)
+{
+    g_ScriptEngineOptimizationLevel = Level;
+}
+
+/**
+ * @brief Get the optimization level of the generated code of the script engine
+ *
+ * @return UINT32
+ */
+UINT32
+ScriptEngineGetOptimizationLevel()
+{
+    return g_ScriptEngineOptimizationLevel;
+}
+
+/**
+ * @brief Get the index of a per-core (percpu) variable
+ *
+ * @param VariableName Name of the variable (with its '.')
+ * @param Index The index of the variable in the per-core variables of each core
+ * @return BOOLEAN TRUE if the variable is declared as percpu
+ */
+BOOLEAN
+ScriptEngineGetPercpuVariableIndex(const char * VariableName, UINT32 * Index)
+{
+    PSCRIPT_ENGINE_TOKEN CurrentToken;
+    int                  TableIndex = -1;
+    BOOLEAN              IsPercpu   = FALSE;
+
+    AcquireGlobalIdTableLock();
+
+    CurrentToken = IdTableFind(GlobalIdTable, VariableName, &TableIndex);
+
+    if (CurrentToken && CurrentToken->IsPercpu)
+    {
+        *Index   = (UINT32)TableIndex;
+        IsPercpu = TRUE;
+    }
+
+    ReleaseGlobalIdTableLock();
+
+    return IsPercpu;
+}
+
+/**
+ * @brief Encode the generated code of a script in the compact format
+ *
+ * @param SymbolBuffer
+ * @param CompactBuffer
+ * @param CompactBufferSize SCRIPT_COMPACT_BUFFER_MAXIMUM_SIZE of the number of the symbols is always enough
+ * @return UINT32 Size of the compact buffer or zero if it's not smaller than the symbols
+ */
+UINT32
+ScriptEngineEncodeCompactBuffer(PVOID SymbolBuffer, PVOID CompactBuffer, UINT32 CompactBufferSize)
+{
+    PSYMBOL_BUFFER CodeBuffer  = (PSYMBOL_BUFFER)SymbolBuffer;
+    UINT32         EncodedSize = 0;
+
+    if (CodeBuffer->Pointer == 0 ||
+        !CompactBytecodeEncode(CodeBuffer->Head, CodeBuffer->Pointer, CompactBuffer, CompactBufferSize, &EncodedSize) ||
+        EncodedSize >= CodeBuffer->Pointer * sizeof(SYMBOL))
+    {
+        return 0;
+    }
+
+    return EncodedSize;
+}
+
+/**
+ * @brief Expand a compact (or a plain) script buffer to its symbols
+ *
+ * @param CompactBuffer
+ * @param CompactBufferSize
+ * @param Symbols
+ * @param SymbolsSize
+ * @return UINT32 Number of the symbols or zero if the buffer is malformed
+ */
+UINT32
+ScriptEngineExpandCompactBuffer(PVOID CompactBuffer, UINT32 CompactBufferSize, PVOID Symbols, UINT32 SymbolsSize)
+{
+    UINT32 ExpandedSize = CompactBytecodeGetExpandedSize(CompactBuffer, CompactBufferSize);
+
+    if (!CompactBytecodeExpand(CompactBuffer, CompactBufferSize, (PSYMBOL)Symbols, SymbolsSize))
+    {
+        return 0;
+    }
+
+    return ExpandedSize / sizeof(SYMBOL);
+}
+
+/**
+ * @brief Accumulate the profile of a script by the source lines of its symbols
+ *
+ * @param SymbolBuffer The generated code of the script
+ * @param Profile The profile of the script (an entry per symbol)
+ * @param LinesProfile The profile of each source line (can be NULL)
+ * @param NumberOfLines Number of the entries of LinesProfile
+ * @return UINT32 Number of the source lines that the symbols are generated from
+ */
+UINT32
+ScriptEngineAccumulateProfileByLine(PVOID                                SymbolBuffer,
+                                    const SCRIPT_ENGINE_PROFILE_ENTRY * Profile,
+                                    PSCRIPT_ENGINE_PROFILE_ENTRY         LinesProfile,
+                                    UINT32                               NumberOfLines)
+{
+    PSYMBOL_BUFFER CodeBuffer = (PSYMBOL_BUFFER)SymbolBuffer;
+    UINT32         LinesCount = 0;
+
+    if (CodeBuffer->Lines == NULL)
+    {
+        return 0;
+    }
+
+    for (UINT32 i = 0; i < CodeBuffer->Pointer; i++)
+    {
+        UINT32 Line = CodeBuffer->Lines[i];
+
+        if (Line >= LinesCount)
+        {
+            LinesCount = Line + 1;
+        }
+
+        if (LinesProfile != NULL && Profile != NULL && Line < NumberOfLines)
+        {
+            LinesProfile[Line].Count += Profile[i].Count;
+            LinesProfile[Line].Cycles += Profile[i].Cycles;
+        }
+    }
+
+    return LinesCount;
+}
+
 /**
  * @brief Script Engine get number of operands
  *
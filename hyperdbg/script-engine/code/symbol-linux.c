@@ -0,0 +1,726 @@
+/**
+ * @file symbol-linux.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Symbol backend of Linux
+ * @details The symbol-parser (Sym*) exports that resolve the names, the
+ * fields and the sizes of the types of the loaded modules. The Windows
+ * implementation is built on DbgHelp; on Linux, the ELF files of the Linux
+ * debuggees (vmlinux, the kernel modules and the binaries) are read by the
+ * ELF (DWARF) reader (elf-reader.c), and the PDB files of the Windows
+ * debuggees are read by the PDB reader (pdb-reader.c), both memory-mapped.
+ * The names of the modules and the lookups are the same as symbol-parser.cpp
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+#ifdef __linux__
+
+//
+// Global Variables
+//
+static PSYMBOL_LOADED_MODULE_DETAILS * g_LoadedModules         = NULL;
+static UINT32                          g_LoadedModulesCount    = 0;
+static UINT32                          g_LoadedModulesCapacity = 0;
+static CHAR *                          g_CurrentModuleName     = NULL;
+
+/**
+ * @brief Find a loaded module by its name or its alternative name
+ * @param ModuleName the name of the module in lowercase
+ * @param SetModuleNameGlobally whether to set module name globally
+ *
+ * @return PSYMBOL_LOADED_MODULE_DETAILS NULL if the module is not found
+ */
+static PSYMBOL_LOADED_MODULE_DETAILS
+SymFindModuleByName(const char * ModuleName, BOOLEAN SetModuleNameGlobally)
+{
+    for (UINT32 i = 0; i < g_LoadedModulesCount; i++)
+    {
+        PSYMBOL_LOADED_MODULE_DETAILS Item = g_LoadedModules[i];
+
+        //
+        // Check for the module name
+        //
+        if (strcmp(Item->ModuleName, ModuleName) == 0)
+        {
+            if (SetModuleNameGlobally)
+            {
+                g_CurrentModuleName = Item->ModuleName;
+            }
+
+            return Item;
+        }
+
+        //
+        // Check for alternative module name
+        //
+        if (strcmp(Item->ModuleAlternativeName, ModuleName) == 0)
+        {
+            if (SetModuleNameGlobally)
+            {
+                g_CurrentModuleName = Item->ModuleAlternativeName;
+            }
+
+            return Item;
+        }
+    }
+
+    //
+    // If the function continues until here then it means
+    // that the module not found
+    //
+    return NULL;
+}
+
+/**
+ * @brief Interpret and find module base, based on module name
+ * @param SearchMask the search mask to find module
+ * @param SetModuleNameGlobally whether to set module name globally
+ *
+ * @return PSYMBOL_LOADED_MODULE_DETAILS NULL means error or not found,
+ * otherwise it returns the instance of loaded module based on search mask
+ */
+static PSYMBOL_LOADED_MODULE_DETAILS
+SymGetModuleBaseFromSearchMask(const char * SearchMask, BOOLEAN SetModuleNameGlobally)
+{
+    char                          ModuleName[_MAX_FNAME] = {0};
+    const char *                  Delimiter;
+    PSYMBOL_LOADED_MODULE_DETAILS Item;
+
+    if (g_LoadedModulesCount == 0 || SearchMask == NULL)
+    {
+        //
+        // no module is loaded or search mask is invalid
+        //
+        return NULL;
+    }
+
+    Delimiter = strchr(SearchMask, '!');
+
+    if (Delimiter != NULL)
+    {
+        if (Delimiter == SearchMask || (SIZE_T)(Delimiter - SearchMask) >= sizeof(ModuleName))
+        {
+            //
+            // Invalid name
+            //
+            return NULL;
+        }
+
+        //
+        // Convert module name to lowercase
+        //
+        for (SIZE_T i = 0; i < (SIZE_T)(Delimiter - SearchMask); i++)
+        {
+            ModuleName[i] = (char)tolower((unsigned char)SearchMask[i]);
+        }
+
+        return SymFindModuleByName(ModuleName, SetModuleNameGlobally);
+    }
+
+    //
+    // There is no '!' in the middle of the search mask so,
+    // we assume that the module is nt (or the kernel of Linux)
+    //
+    Item = SymFindModuleByName("nt", SetModuleNameGlobally);
+
+    if (Item == NULL)
+    {
+        Item = SymFindModuleByName("vmlinux", SetModuleNameGlobally);
+    }
+
+    return Item;
+}
+
+/**
+ * @brief Remove the module name (module!) from a name
+ *
+ * @param Name
+ * @return const CHAR *
+ */
+static const CHAR *
+SymRemoveModuleName(const CHAR * Name)
+{
+    const CHAR * Delimiter = strchr(Name, '!');
+
+    return Delimiter == NULL ? Name : Delimiter + 1;
+}
+
+/**
+ * @brief Match a name with a search mask
+ * @details The mask is case-insensitive, '*' matches any number of
+ * characters and '?' matches one character
+ *
+ * @param Mask
+ * @param Name
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymMatchMask(const CHAR * Mask, const CHAR * Name)
+{
+    const CHAR * StarMask = NULL;
+    const CHAR * StarName = NULL;
+
+    while (*Name != '\0')
+    {
+        if (*Mask == '*')
+        {
+            StarMask = ++Mask;
+            StarName = Name;
+        }
+        else if (*Mask == '?' || tolower((unsigned char)*Mask) == tolower((unsigned char)*Name))
+        {
+            Mask++;
+            Name++;
+        }
+        else if (StarMask != NULL)
+        {
+            //
+            // Let the last '*' match one more character
+            //
+            Mask = StarMask;
+            Name = ++StarName;
+        }
+        else
+        {
+            return FALSE;
+        }
+    }
+
+    while (*Mask == '*')
+    {
+        Mask++;
+    }
+
+    return *Mask == '\0';
+}
+
+/**
+ * @brief Load symbol based on a file name and GUID
+ * @details The file is either an ELF file (with its symbol table and its
+ * DWARF debug information) or a PDB file
+ *
+ * @param BaseAddress
+ * @param PdbFileName
+ * @param CustomModuleName
+ *
+ * @return UINT32
+ */
+UINT32
+SymLoadFileSymbol(UINT64 BaseAddress, const CHAR * PdbFileName, const CHAR * CustomModuleName)
+{
+    PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails = NULL;
+    const CHAR *                  FileName;
+    const CHAR *                  Extension;
+    SIZE_T                        Length;
+
+    //
+    // Determine the name of the file
+    //
+    FileName  = strrchr(PdbFileName, '/') == NULL ? PdbFileName : strrchr(PdbFileName, '/') + 1;
+    Extension = strrchr(FileName, '.');
+    Length    = Extension == NULL ? strlen(FileName) : (SIZE_T)(Extension - FileName);
+
+    if (Length >= _MAX_FNAME || strlen(PdbFileName) >= MAX_PATH ||
+        (CustomModuleName != NULL && strlen(CustomModuleName) >= _MAX_FNAME))
+    {
+        ShowMessages("err, the name of the symbol file is too long\n");
+        return -1;
+    }
+
+    //
+    // Allocate buffer to store the details
+    //
+    if (g_LoadedModulesCount == g_LoadedModulesCapacity)
+    {
+        UINT32                          Capacity = g_LoadedModulesCapacity == 0 ? 16 : g_LoadedModulesCapacity * 2;
+        PSYMBOL_LOADED_MODULE_DETAILS * Modules  = realloc(g_LoadedModules, Capacity * sizeof(PSYMBOL_LOADED_MODULE_DETAILS));
+
+        if (Modules == NULL)
+        {
+            ShowMessages("err, allocating buffer for storing symbol details\n");
+            return -1;
+        }
+
+        g_LoadedModules         = Modules;
+        g_LoadedModulesCapacity = Capacity;
+    }
+
+    ModuleDetails = calloc(1, sizeof(SYMBOL_LOADED_MODULE_DETAILS));
+
+    if (ModuleDetails == NULL)
+    {
+        ShowMessages("err, allocating buffer for storing symbol details\n");
+        return -1;
+    }
+
+    ModuleDetails->Elf = ElfOpen(PdbFileName);
+
+    if (ModuleDetails->Elf == NULL)
+    {
+        ModuleDetails->Pdb = PdbOpen(PdbFileName);
+    }
+
+    if (ModuleDetails->Elf == NULL && ModuleDetails->Pdb == NULL)
+    {
+        ShowMessages("err, loading symbols failed (%s)\n", PdbFileName);
+
+        free(ModuleDetails);
+        return -1;
+    }
+
+    //
+    // Make the details (to save), the module name is in lowercase
+    //
+    ModuleDetails->BaseAddress = BaseAddress;
+
+    for (SIZE_T i = 0; i < Length; i++)
+    {
+        ModuleDetails->ModuleName[i] = (char)tolower((unsigned char)FileName[i]);
+    }
+
+    strcpy(ModuleDetails->PdbFilePath, PdbFileName);
+
+    //
+    // Save the custom module name (if any)
+    //
+    if (CustomModuleName != NULL)
+    {
+        strcpy(ModuleDetails->ModuleAlternativeName, CustomModuleName);
+    }
+
+    //
+    // Save it
+    //
+    g_LoadedModules[g_LoadedModulesCount++] = ModuleDetails;
+
+    return 0;
+}
+
+/**
+ * @brief Unload one module symbol
+ *
+ * @param ModuleName
+ *
+ * @return UINT32
+ */
+UINT32
+SymUnloadModuleSymbol(CHAR * ModuleName)
+{
+    for (UINT32 i = 0; i < g_LoadedModulesCount; i++)
+    {
+        PSYMBOL_LOADED_MODULE_DETAILS Item = g_LoadedModules[i];
+
+        if (strcmp(Item->ModuleName, ModuleName) == 0 || strcmp(Item->ModuleAlternativeName, ModuleName) == 0)
+        {
+            if (g_CurrentModuleName == Item->ModuleName || g_CurrentModuleName == Item->ModuleAlternativeName)
+            {
+                g_CurrentModuleName = NULL;
+            }
+
+            ElfClose(Item->Elf);
+            PdbClose(Item->Pdb);
+            free(Item);
+
+            //
+            // Remove it from the list
+            //
+            memmove(&g_LoadedModules[i], &g_LoadedModules[i + 1], (g_LoadedModulesCount - i - 1) * sizeof(PSYMBOL_LOADED_MODULE_DETAILS));
+            g_LoadedModulesCount--;
+
+            //
+            // Success
+            //
+            return 0;
+        }
+    }
+
+    //
+    // Not found
+    //
+    return -1;
+}
+
+/**
+ * @brief Unload all the symbols
+ *
+ * @return UINT32
+ */
+UINT32
+SymUnloadAllSymbols()
+{
+    for (UINT32 i = 0; i < g_LoadedModulesCount; i++)
+    {
+        ElfClose(g_LoadedModules[i]->Elf);
+        PdbClose(g_LoadedModules[i]->Pdb);
+        free(g_LoadedModules[i]);
+    }
+
+    free(g_LoadedModules);
+
+    g_LoadedModules         = NULL;
+    g_LoadedModulesCount    = 0;
+    g_LoadedModulesCapacity = 0;
+    g_CurrentModuleName     = NULL;
+
+    return 0;
+}
+
+/**
+ * @brief Convert function name to address
+ *
+ * @param FunctionOrVariableName the name of the function or variable to convert
+ * @param WasFound
+ *
+ * @return UINT64
+ */
+UINT64
+SymConvertNameToAddress(const CHAR * FunctionOrVariableName, PBOOLEAN WasFound)
+{
+    PSYMBOL_LOADED_MODULE_DETAILS SymbolInfo = NULL;
+    const CHAR *                  Name       = SymRemoveModuleName(FunctionOrVariableName);
+    UINT64                        Rva        = 0;
+    UINT32                        PdbRva     = 0;
+
+    //
+    // Not found by default
+    //
+    *WasFound = FALSE;
+
+    //
+    // Find the module by its name or its alternative name, if it doesn't
+    // contain a module name, we'll use 'nt' (or 'vmlinux') by default
+    //
+    SymbolInfo = SymGetModuleBaseFromSearchMask(FunctionOrVariableName, FALSE);
+
+    if (SymbolInfo == NULL)
+    {
+        return NULL64_ZERO;
+    }
+
+    if (SymbolInfo->Elf != NULL)
+    {
+        if (!ElfFindSymbol(SymbolInfo->Elf, Name, &Rva))
+        {
+            return NULL64_ZERO;
+        }
+    }
+    else
+    {
+        if (!PdbFindSymbol(SymbolInfo->Pdb, Name, &PdbRva))
+        {
+            return NULL64_ZERO;
+        }
+
+        Rva = PdbRva;
+    }
+
+    *WasFound = TRUE;
+
+    return SymbolInfo->BaseAddress + Rva;
+}
+
+/**
+ * @brief Get the offset of a field from the top of a structure
+ *
+ * @param TypeName
+ * @param FieldName
+ * @param FieldOffset
+ *
+ * @return BOOLEAN Whether the module is found successfully or not
+ */
+BOOLEAN
+SymGetFieldOffset(CHAR * TypeName, CHAR * FieldName, UINT32 * FieldOffset)
+{
+    PSYMBOL_LOADED_MODULE_DETAILS SymbolInfo = SymGetModuleBaseFromSearchMask(TypeName, TRUE);
+
+    if (SymbolInfo == NULL)
+    {
+        //
+        // Module not found or there was an error
+        //
+        return FALSE;
+    }
+
+    if (SymbolInfo->Elf != NULL)
+    {
+        return ElfGetFieldOffset(SymbolInfo->Elf, SymRemoveModuleName(TypeName), FieldName, FieldOffset);
+    }
+
+    return PdbGetFieldOffset(SymbolInfo->Pdb, SymRemoveModuleName(TypeName), FieldName, FieldOffset);
+}
+
+/**
+ * @brief Get the size of structures from the symbols
+ *
+ * @param TypeName the type (structure) name to query
+ * @param TypeSize pointer to receive the size of the data type
+ *
+ * @return BOOLEAN Whether the module is found successfully or not
+ */
+BOOLEAN
+SymGetDataTypeSize(CHAR * TypeName, UINT64 * TypeSize)
+{
+    PSYMBOL_LOADED_MODULE_DETAILS SymbolInfo = SymGetModuleBaseFromSearchMask(TypeName, TRUE);
+
+    if (SymbolInfo == NULL)
+    {
+        //
+        // Module not found or there was an error
+        //
+        return FALSE;
+    }
+
+    if (SymbolInfo->Elf != NULL)
+    {
+        return ElfGetTypeSize(SymbolInfo->Elf, SymRemoveModuleName(TypeName), TypeSize);
+    }
+
+    return PdbGetTypeSize(SymbolInfo->Pdb, SymRemoveModuleName(TypeName), TypeSize);
+}
+
+/**
+ * @brief Context of the symbols that are shown by their mask
+ *
+ */
+typedef struct _SYMBOL_SEARCH_MASK_CONTEXT
+{
+    const CHAR * Mask;
+    UINT64       BaseAddress;
+
+} SYMBOL_SEARCH_MASK_CONTEXT, *PSYMBOL_SEARCH_MASK_CONTEXT;
+
+/**
+ * @brief Context of the symbols that are delivered to the disassembler
+ *
+ */
+typedef struct _SYMBOL_DISASSEMBLER_MAP_CONTEXT
+{
+    SymbolMapCallback Callback;
+    UINT64            BaseAddress;
+
+} SYMBOL_DISASSEMBLER_MAP_CONTEXT, *PSYMBOL_DISASSEMBLER_MAP_CONTEXT;
+
+/**
+ * @brief Show a symbol if it matches the mask
+ *
+ * @param Name
+ * @param Rva
+ * @param Size
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SymDisplayMaskSymbolsCallback(const CHAR * Name, UINT64 Rva, UINT64 Size, PVOID Context)
+{
+    PSYMBOL_SEARCH_MASK_CONTEXT SearchContext = (PSYMBOL_SEARCH_MASK_CONTEXT)Context;
+    UINT64                      Address       = SearchContext->BaseAddress + Rva;
+
+    (void)Size;
+
+    if (SymMatchMask(SearchContext->Mask, Name))
+    {
+        //
+        // Module!Name Address
+        //
+        ShowMessages("%08x`%08x  %s!%s\n",
+                     (UINT32)(Address >> 32),
+                     (UINT32)Address,
+                     g_CurrentModuleName,
+                     Name);
+    }
+
+    //
+    // Continue enumeration
+    //
+    return TRUE;
+}
+
+/**
+ * @brief Show a symbol of a PDB file if it matches the mask
+ *
+ * @param Name
+ * @param Rva
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SymDisplayMaskPdbSymbolsCallback(const CHAR * Name, UINT32 Rva, PVOID Context)
+{
+    return SymDisplayMaskSymbolsCallback(Name, Rva, 0, Context);
+}
+
+/**
+ * @brief Search and show symbols
+ * @details mainly used by the 'x' command
+ *
+ * @param SearchMask
+ *
+ * @return UINT32
+ */
+UINT32
+SymSearchSymbolForMask(const CHAR * SearchMask)
+{
+    PSYMBOL_LOADED_MODULE_DETAILS SymbolInfo = NULL;
+    SYMBOL_SEARCH_MASK_CONTEXT    Context    = {0};
+
+    //
+    // Get the module info
+    //
+    SymbolInfo = SymGetModuleBaseFromSearchMask(SearchMask, TRUE);
+
+    //
+    // Check to see if module info is found
+    //
+    if (SymbolInfo == NULL)
+    {
+        //
+        // Module not found or there was an error
+        //
+        return -1;
+    }
+
+    Context.Mask        = SymRemoveModuleName(SearchMask);
+    Context.BaseAddress = SymbolInfo->BaseAddress;
+
+    if (SymbolInfo->Elf != NULL)
+    {
+        ElfEnumerateSymbols(SymbolInfo->Elf, SymDisplayMaskSymbolsCallback, &Context);
+    }
+    else
+    {
+        PdbEnumerateSymbols(SymbolInfo->Pdb, SymDisplayMaskPdbSymbolsCallback, &Context);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Deliver module!ObjectName to the symbol map of the disassembler
+ *
+ * @param Name
+ * @param Rva
+ * @param Size
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SymDeliverDisassemblerSymbolMapCallback(const CHAR * Name, UINT64 Rva, UINT64 Size, PVOID Context)
+{
+    PSYMBOL_DISASSEMBLER_MAP_CONTEXT MapContext = (PSYMBOL_DISASSEMBLER_MAP_CONTEXT)Context;
+
+    //
+    // Call the remote callback
+    //
+    MapContext->Callback(MapContext->BaseAddress + Rva, g_CurrentModuleName, (char *)Name, (unsigned int)Size);
+
+    //
+    // Continue enumeration
+    //
+    return TRUE;
+}
+
+/**
+ * @brief Deliver module!ObjectName of a PDB file to the symbol map of the
+ * disassembler
+ * @details The sizes of the objects are not known (the publics)
+ *
+ * @param Name
+ * @param Rva
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SymDeliverDisassemblerPdbSymbolMapCallback(const CHAR * Name, UINT32 Rva, PVOID Context)
+{
+    return SymDeliverDisassemblerSymbolMapCallback(Name, Rva, 0, Context);
+}
+
+/**
+ * @brief Create symbol table for disassembler
+ * @details mainly used by disassembler for 'u' command
+ *
+ * @param CallbackFunction
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymCreateSymbolTableForDisassembler(PVOID CallbackFunction)
+{
+    SYMBOL_DISASSEMBLER_MAP_CONTEXT Context = {0};
+
+    //
+    // Set the callback function to deliver the name of module!ObjectName
+    //
+    Context.Callback = (SymbolMapCallback)CallbackFunction;
+
+    //
+    // Create a symbol table from all modules
+    //
+    for (UINT32 i = 0; i < g_LoadedModulesCount; i++)
+    {
+        PSYMBOL_LOADED_MODULE_DETAILS Item = g_LoadedModules[i];
+
+        //
+        // Set module name
+        //
+        g_CurrentModuleName = Item->ModuleName;
+        Context.BaseAddress = Item->BaseAddress;
+
+        if (Item->Elf != NULL)
+        {
+            ElfEnumerateSymbols(Item->Elf, SymDeliverDisassemblerSymbolMapCallback, &Context);
+        }
+        else
+        {
+            PdbEnumerateSymbols(Item->Pdb, SymDeliverDisassemblerPdbSymbolMapCallback, &Context);
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Get the source file and the line of an address
+ * @details The line is read from the debug information (.debug_line) of the
+ * ELF module with the highest base address that is not above the address
+ *
+ * @param Address
+ * @param FileName
+ * @param FileNameSize
+ * @param Line
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymGetLineFromAddress(UINT64 Address, CHAR * FileName, SIZE_T FileNameSize, UINT32 * Line)
+{
+    PSYMBOL_LOADED_MODULE_DETAILS SymbolInfo = NULL;
+
+    for (UINT32 i = 0; i < g_LoadedModulesCount; i++)
+    {
+        PSYMBOL_LOADED_MODULE_DETAILS Item = g_LoadedModules[i];
+
+        if (Item->Elf != NULL && Item->BaseAddress <= Address &&
+            (SymbolInfo == NULL || Item->BaseAddress > SymbolInfo->BaseAddress))
+        {
+            SymbolInfo = Item;
+        }
+    }
+
+    if (SymbolInfo == NULL)
+    {
+        return FALSE;
+    }
+
+    return ElfGetLineFromAddress(SymbolInfo->Elf, Address - SymbolInfo->BaseAddress, FileName, FileNameSize, Line);
+}
+
+#endif // __linux__
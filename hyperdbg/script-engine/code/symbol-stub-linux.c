@@ -6,17 +6,18 @@
  *          is built on DbgHelp + PDB files (via the DIA-SDK-based pdbex), none of
  *          which is available on Linux. The script-engine library calls these
  *          Sym* functions directly, so without definitions libscript-engine.so
- *          fails to link. These stubs satisfy the link and keep every call site
- *          intact; symbol resolution is simply unavailable until a real Linux
- *          backend (ELF/DWARF, or an LLVM DebugInfo/PDB port of symbol-parser)
- *          is implemented.
+ *          fails to link. The names, the fields and the sizes of the types and
+ *          the symbol table of the disassembler are resolved by the ELF and the
+ *          PDB readers of symbol-linux.c; the rest of the exports (the PDB paths
+ *          of the images, the download of the symbols and showing the types)
+ *          are stubs that satisfy the link and keep every call site intact.
  *
  *          The signatures mirror include/SDK/imports/user/HyperDbgSymImports.h
  *          exactly. Return values indicate "nothing found / not supported"
  *          (0 / FALSE) and any out-parameters are cleared.
  *
- *          TODO: replace with a real symbol backend and drop this file from the
- *                UNIX branch of script-engine/CMakeLists.txt.
+ *          TODO: move the rest of the exports to symbol-linux.c and drop this
+ *                file from the UNIX branch of script-engine/CMakeLists.txt.
  *
  * @version 0.1
  * @date 2026-07-24
@@ -39,86 +40,6 @@ SymbolAbortLoading()
 {
 }
 
-UINT64
-SymConvertNameToAddress(const CHAR * FunctionOrVariableName, PBOOLEAN WasFound)
-{
-    (void)FunctionOrVariableName;
-
-    if (WasFound != NULL)
-    {
-        *WasFound = FALSE;
-    }
-
-    return 0;
-}
-
-UINT32
-SymLoadFileSymbol(UINT64 BaseAddress, const CHAR * PdbFileName, const CHAR * CustomModuleName)
-{
-    (void)BaseAddress;
-    (void)PdbFileName;
-    (void)CustomModuleName;
-
-    return 0;
-}
-
-UINT32
-SymUnloadAllSymbols()
-{
-    return 0;
-}
-
-UINT32
-SymUnloadModuleSymbol(CHAR * ModuleName)
-{
-    (void)ModuleName;
-
-    return 0;
-}
-
-UINT32
-SymSearchSymbolForMask(const CHAR * SearchMask)
-{
-    (void)SearchMask;
-
-    return 0;
-}
-
-BOOLEAN
-SymGetFieldOffset(CHAR * TypeName, CHAR * FieldName, UINT32 * FieldOffset)
-{
-    (void)TypeName;
-    (void)FieldName;
-
-    if (FieldOffset != NULL)
-    {
-        *FieldOffset = 0;
-    }
-
-    return FALSE;
-}
-
-BOOLEAN
-SymGetDataTypeSize(CHAR * TypeName, UINT64 * TypeSize)
-{
-    (void)TypeName;
-
-    if (TypeSize != NULL)
-    {
-        *TypeSize = 0;
-    }
-
-    return FALSE;
-}
-
-BOOLEAN
-SymCreateSymbolTableForDisassembler(PVOID CallbackFunction)
-{
-    (void)CallbackFunction;
-
-    return FALSE;
-}
-
 BOOLEAN
 SymConvertFileToPdbPath(const CHAR * LocalFilePath, CHAR * ResultPath, SIZE_T ResultPathSize)
 {
@@ -12,30 +12,6 @@
  */
 #include "pch.h"
 
-typedef struct _TYPE_ALLOCATION_NODE
-{
-    PVARIABLE_TYPE                Type;
-    struct _TYPE_ALLOCATION_NODE * Next;
-} TYPE_ALLOCATION_NODE, *PTYPE_ALLOCATION_NODE;
-
-typedef struct _STRUCT_TAG_NODE
-{
-    char *                    Name;
-    PVARIABLE_TYPE            Type;
-    struct _STRUCT_TAG_NODE * Next;
-} STRUCT_TAG_NODE, *PSTRUCT_TAG_NODE;
-
-typedef struct _TYPEDEF_NODE
-{
-    char *                Name;
-    PVARIABLE_TYPE        Type;
-    struct _TYPEDEF_NODE * Next;
-} TYPEDEF_NODE, *PTYPEDEF_NODE;
-
-static PTYPE_ALLOCATION_NODE TypeAllocations;
-static PSTRUCT_TAG_NODE      StructTags;
-static PTYPEDEF_NODE         Typedefs;
-
 static PVARIABLE_TYPE
 AllocateType(VOID)
 {
@@ -54,9 +30,9 @@ AllocateType(VOID)
         return NULL;
     }
 
-    Node->Type      = Type;
-    Node->Next      = TypeAllocations;
-    TypeAllocations = Node;
+    Node->Type                         = Type;
+    Node->Next                         = g_CompilerContext->TypeAllocations;
+    g_CompilerContext->TypeAllocations = Node;
     return Type;
 }
 
@@ -69,34 +45,34 @@ AlignTo(unsigned int Value, unsigned int Alignment)
 VOID
 InitializeTypeContext(VOID)
 {
-    TypeAllocations = NULL;
-    StructTags      = NULL;
-    Typedefs        = NULL;
+    g_CompilerContext->TypeAllocations = NULL;
+    g_CompilerContext->StructTags      = NULL;
+    g_CompilerContext->Typedefs        = NULL;
 }
 
 VOID
 UninitializeTypeContext(VOID)
 {
-    while (Typedefs)
+    while (g_CompilerContext->Typedefs)
     {
-        PTYPEDEF_NODE Next = Typedefs->Next;
-        free(Typedefs->Name);
-        free(Typedefs);
-        Typedefs = Next;
+        PTYPEDEF_NODE Next = g_CompilerContext->Typedefs->Next;
+        free(g_CompilerContext->Typedefs->Name);
+        free(g_CompilerContext->Typedefs);
+        g_CompilerContext->Typedefs = Next;
     }
 
-    while (StructTags)
+    while (g_CompilerContext->StructTags)
     {
-        PSTRUCT_TAG_NODE Next = StructTags->Next;
-        free(StructTags->Name);
-        free(StructTags);
-        StructTags = Next;
+        PSTRUCT_TAG_NODE Next = g_CompilerContext->StructTags->Next;
+        free(g_CompilerContext->StructTags->Name);
+        free(g_CompilerContext->StructTags);
+        g_CompilerContext->StructTags = Next;
     }
 
-    while (TypeAllocations)
+    while (g_CompilerContext->TypeAllocations)
     {
-        PTYPE_ALLOCATION_NODE Next = TypeAllocations->Next;
-        PSTRUCT_MEMBER Member = TypeAllocations->Type->Members;
+        PTYPE_ALLOCATION_NODE Next = g_CompilerContext->TypeAllocations->Next;
+        PSTRUCT_MEMBER Member = g_CompilerContext->TypeAllocations->Type->Members;
         while (Member)
         {
             PSTRUCT_MEMBER NextMember = Member->Next;
@@ -104,10 +80,10 @@ UninitializeTypeContext(VOID)
             free(Member);
             Member = NextMember;
         }
-        free(TypeAllocations->Type->TagName);
-        free(TypeAllocations->Type);
-        free(TypeAllocations);
-        TypeAllocations = Next;
+        free(g_CompilerContext->TypeAllocations->Type->TagName);
+        free(g_CompilerContext->TypeAllocations->Type);
+        free(g_CompilerContext->TypeAllocations);
+        g_CompilerContext->TypeAllocations = Next;
     }
 }
 
@@ -115,7 +91,7 @@ PVARIABLE_TYPE
 FindStructType(const char * TagName)
 {
     PSTRUCT_TAG_NODE Node;
-    for (Node = StructTags; Node; Node = Node->Next)
+    for (Node = g_CompilerContext->StructTags; Node; Node = Node->Next)
     {
         if (!strcmp(Node->Name, TagName))
         {
@@ -145,12 +121,12 @@ DeclareStructType(const char * TagName)
         return NULL;
     }
 
-    Type->Kind    = TY_STRUCT;
-    Type->TagName = PlatformStrDup(TagName);
-    Node->Name    = PlatformStrDup(TagName);
-    Node->Type    = Type;
-    Node->Next    = StructTags;
-    StructTags    = Node;
+    Type->Kind                    = TY_STRUCT;
+    Type->TagName                 = PlatformStrDup(TagName);
+    Node->Name                    = PlatformStrDup(TagName);
+    Node->Type                    = Type;
+    Node->Next                    = g_CompilerContext->StructTags;
+    g_CompilerContext->StructTags = Node;
     return Type;
 }
 
@@ -300,7 +276,7 @@ BOOLEAN
 AddTypedefType(const char * Name, PVARIABLE_TYPE Type)
 {
     PTYPEDEF_NODE Node;
-    for (Node = Typedefs; Node; Node = Node->Next)
+    for (Node = g_CompilerContext->Typedefs; Node; Node = Node->Next)
     {
         if (!strcmp(Node->Name, Name))
         {
@@ -313,10 +289,10 @@ AddTypedefType(const char * Name, PVARIABLE_TYPE Type)
     {
         return FALSE;
     }
-    Node->Name = PlatformStrDup(Name);
-    Node->Type = Type;
-    Node->Next = Typedefs;
-    Typedefs   = Node;
+    Node->Name                  = PlatformStrDup(Name);
+    Node->Type                  = Type;
+    Node->Next                  = g_CompilerContext->Typedefs;
+    g_CompilerContext->Typedefs = Node;
     return TRUE;
 }
 
@@ -324,7 +300,7 @@ PVARIABLE_TYPE
 FindTypedefType(const char * Name)
 {
     PTYPEDEF_NODE Node;
-    for (Node = Typedefs; Node; Node = Node->Next)
+    for (Node = g_CompilerContext->Typedefs; Node; Node = Node->Next)
     {
         if (!strcmp(Node->Name, Name))
         {
@@ -30,6 +30,16 @@ initial size of symbol buffer
  */
 #    define TOKEN_LIST_INIT_SIZE 256
 
+/**
+ * @brief size of each chunk of the token arena
+ */
+#    define TOKEN_ARENA_CHUNK_SIZE 0x10000
+
+/**
+ * @brief alignment of the allocations of the token arena
+ */
+#    define TOKEN_ARENA_ALIGNMENT 16
+
 /**
  * @brief enumerates possible types for token
  */
@@ -65,6 +75,35 @@ typedef enum _SCRIPT_ENGINE_TOKEN_TYPE
     FLOAT_LITERAL
 } SCRIPT_ENGINE_TOKEN_TYPE;
 
+/**
+ * @brief a chunk of the token arena, the allocations are placed
+ * right after this header
+ */
+typedef struct _SCRIPT_ENGINE_ARENA_CHUNK
+{
+    struct _SCRIPT_ENGINE_ARENA_CHUNK * Next;
+    size_t                              Size;
+    size_t                              Used;
+} SCRIPT_ENGINE_ARENA_CHUNK, *PSCRIPT_ENGINE_ARENA_CHUNK;
+
+/**
+ * @brief bump allocator for the tokens, token values and token lists of
+ * a compilation
+ * @details the memory is zeroed and it is only freed as a whole by
+ * ArenaRelease
+ */
+typedef struct _SCRIPT_ENGINE_ARENA
+{
+    PSCRIPT_ENGINE_ARENA_CHUNK Head;
+
+#    ifdef _DEBUG
+    unsigned long long AllocationCount;
+    unsigned long long AllocatedBytes;
+    unsigned long long ChunkCount;
+#    endif
+
+} SCRIPT_ENGINE_ARENA, *PSCRIPT_ENGINE_ARENA;
+
 /**
  * @brief read tokens from input stored in this structure
  */
@@ -79,6 +118,10 @@ typedef struct _SCRIPT_ENGINE_TOKEN
     unsigned int             AddressSpace;
     BOOLEAN                  IsAddress;
     BOOLEAN                  IsImplicitType;
+    BOOLEAN                  IsPercpu;            // the global variable is kept per core (percpu)
+    int                      TerminalIdCache;     // LL(1) terminal id plus one, zero means not resolved yet
+    int                      LalrTerminalIdCache; // LALR(1) terminal id plus one, zero means not resolved yet
+    PSCRIPT_ENGINE_ARENA     Arena;               // arena of the token and its value, NULL means the heap
 } SCRIPT_ENGINE_TOKEN, *PSCRIPT_ENGINE_TOKEN;
 
 /**
@@ -89,8 +132,55 @@ typedef struct _SCRIPT_ENGINE_TOKEN_LIST
     PSCRIPT_ENGINE_TOKEN * Head;
     unsigned int           Pointer;
     unsigned int           Size;
+    PSCRIPT_ENGINE_ARENA   Arena; // arena of the list and its buffer, NULL means the heap
 } SCRIPT_ENGINE_TOKEN_LIST, *PSCRIPT_ENGINE_TOKEN_LIST;
 
+/**
+ * @brief init number of buckets in the hash index of an identifier table
+ * @details must be a power of two
+ */
+#    define ID_TABLE_INIT_BUCKET_COUNT 64
+
+/**
+ * @brief identifier table (global ids, local ids and function parameters)
+ * @details identifiers are kept in declaration order in the list (so their
+ * indexes and VariableMemoryIdx values stay stable) and an open-addressing
+ * hash index on top of it maps a name to its first declaration
+ */
+typedef struct _SCRIPT_ENGINE_ID_TABLE
+{
+    PSCRIPT_ENGINE_TOKEN_LIST List;
+    unsigned int *            Buckets; // index into the list plus one, zero means empty
+    unsigned int              BucketCount;
+} SCRIPT_ENGINE_ID_TABLE, *PSCRIPT_ENGINE_ID_TABLE;
+
+/**
+ * @brief perfect hash table (hash and displace) that is created by the
+ * generator (perfect_hash.py) for a fixed set of names
+ * @details the bucket of a name selects a seed, and the name mixed with the
+ * seed selects the only entry that may hold the name
+ */
+typedef struct _PERFECT_HASH_TABLE
+{
+    const unsigned int * Seeds;
+    unsigned int         SeedMask;
+    const SYMBOL_MAP *   Entries; // empty entries have a NULL name
+    unsigned int         EntryMask;
+} PERFECT_HASH_TABLE, *PPERFECT_HASH_TABLE;
+
+////////////////////////////////////////////////////
+//	     SCRIPT_ENGINE_ARENA related functions	  //
+////////////////////////////////////////////////////
+
+PVOID
+ArenaAllocate(PSCRIPT_ENGINE_ARENA Arena, size_t Size);
+
+VOID
+ArenaRelease(PSCRIPT_ENGINE_ARENA Arena);
+
+PSCRIPT_ENGINE_ARENA
+SwitchTokenArena(PSCRIPT_ENGINE_ARENA Arena);
+
 ////////////////////////////////////////////////////
 // PTOKEN related functions						  //
 ////////////////////////////////////////////////////
@@ -152,6 +242,22 @@ Top(PSCRIPT_ENGINE_TOKEN_LIST TokenList);
 PSCRIPT_ENGINE_TOKEN
 TopIndexed(PSCRIPT_ENGINE_TOKEN_LIST TokenList, int Index);
 
+////////////////////////////////////////////////////
+//	     SCRIPT_ENGINE_ID_TABLE related functions	  //
+////////////////////////////////////////////////////
+
+PSCRIPT_ENGINE_ID_TABLE
+NewIdTable(void);
+
+VOID
+RemoveIdTable(PSCRIPT_ENGINE_ID_TABLE IdTable);
+
+int
+IdTableAdd(PSCRIPT_ENGINE_ID_TABLE IdTable, PSCRIPT_ENGINE_TOKEN Token);
+
+PSCRIPT_ENGINE_TOKEN
+IdTableFind(PSCRIPT_ENGINE_ID_TABLE IdTable, const char * Name, int * Index);
+
 char
 IsNoneTerminal(PSCRIPT_ENGINE_TOKEN Token);
 
@@ -173,6 +279,9 @@ LalrGetNonTerminalId(PSCRIPT_ENGINE_TOKEN Token);
 int
 LalrGetTerminalId(PSCRIPT_ENGINE_TOKEN Token);
 
+long long unsigned
+PerfectHashLookup(const PERFECT_HASH_TABLE * Table, const char * Name);
+
 ////////////////////////////////////////////////////
 //					Util Functions				  //
 ////////////////////////////////////////////////////
@@ -216,6 +325,12 @@ BinaryToInt(char * str);
 VOID
 RotateLeftStringOnce(char * str);
 
+VOID
+ScriptEngineSpinlockLock(volatile LONG * Lock);
+
+VOID
+ScriptEngineSpinlockUnlock(volatile LONG * Lock);
+
 ////////////////////////////////////////////////////
 //	       Semantic Rule Related Functions		  //
 ////////////////////////////////////////////////////
@@ -265,6 +380,9 @@ IsType15Func(PSCRIPT_ENGINE_TOKEN Operator);
 char
 IsType16Func(PSCRIPT_ENGINE_TOKEN Operator);
 
+char
+IsType17Func(PSCRIPT_ENGINE_TOKEN Operator);
+
 char
 IsAssignmentOperator(PSCRIPT_ENGINE_TOKEN Operator);
 
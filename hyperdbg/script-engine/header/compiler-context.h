@@ -0,0 +1,202 @@
+/**
+ * @file compiler-context.h
+ * @author M.H. Gholamrezaei (mh@hyperdbg.org)
+ *
+ * @details State of a single compilation of the script engine
+ * @version 0.19
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+#ifndef COMPILER_CONTEXT_H
+#    define COMPILER_CONTEXT_H
+
+//////////////////////////////////////////////////
+//					Definitions                 //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Storage class of the pointer to the active compiler context
+ */
+#    ifdef _WIN32
+#        define SCRIPT_ENGINE_THREAD_LOCAL __declspec(thread)
+#    else
+#        define SCRIPT_ENGINE_THREAD_LOCAL __thread
+#    endif
+
+/**
+ * @brief Maximum number of nested sizeof() and logical (&&, ||) expressions
+ */
+#    define MAX_NESTED_COMPILATION_CONTEXT_COUNT 16
+
+//////////////////////////////////////////////////
+//					Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief A declarator of a struct object declaration (e.g., *Name[2][3])
+ */
+typedef struct _STRUCT_DECLARATOR_STATE
+{
+    char *                            Name;
+    unsigned int                      PointerDepth;
+    unsigned int                      Dimensions[16];
+    unsigned int                      DimensionCount;
+    struct _STRUCT_DECLARATOR_STATE * Next;
+} STRUCT_DECLARATOR_STATE, *PSTRUCT_DECLARATOR_STATE;
+
+/**
+ * @brief Saved code generator state of a sizeof() operand
+ */
+typedef struct _SIZEOF_COMPILATION_CONTEXT
+{
+    UINT32 CodePointer;
+    UINT64 MaxTempNumber;
+    CHAR   TempMap[MAX_TEMP_COUNT];
+} SIZEOF_COMPILATION_CONTEXT;
+
+/**
+ * @brief Saved code generator state of a short-circuit logical expression
+ */
+typedef struct _LOGICAL_COMPILATION_CONTEXT
+{
+    BOOLEAN              IsOr;
+    UINT32               BeginJumpTargetIndex;
+    PSCRIPT_ENGINE_TOKEN ResultToken;
+} LOGICAL_COMPILATION_CONTEXT;
+
+/**
+ * @brief Allocated types of the type context
+ */
+typedef struct _TYPE_ALLOCATION_NODE
+{
+    PVARIABLE_TYPE                 Type;
+    struct _TYPE_ALLOCATION_NODE * Next;
+} TYPE_ALLOCATION_NODE, *PTYPE_ALLOCATION_NODE;
+
+/**
+ * @brief Struct tags of the type context
+ */
+typedef struct _STRUCT_TAG_NODE
+{
+    char *                    Name;
+    PVARIABLE_TYPE            Type;
+    struct _STRUCT_TAG_NODE * Next;
+} STRUCT_TAG_NODE, *PSTRUCT_TAG_NODE;
+
+/**
+ * @brief Typedefs of the type context
+ */
+typedef struct _TYPEDEF_NODE
+{
+    char *                 Name;
+    PVARIABLE_TYPE         Type;
+    struct _TYPEDEF_NODE * Next;
+} TYPEDEF_NODE, *PTYPEDEF_NODE;
+
+/**
+ * @brief The whole state of the scanner, the parser, the code generator
+ * and the type context while compiling one script
+ *
+ * @details Each thread that compiles a script uses its own context, so
+ * scripts can be compiled concurrently. The only state that is shared
+ * between the compilations is the table of global variables ($ ids),
+ * as the global variables are shared between all the scripts at runtime
+ */
+typedef struct _SCRIPT_ENGINE_COMPILER_CONTEXT
+{
+    //
+    // Scanner
+    //
+    unsigned int InputIdx;        // number of read characters from input
+    unsigned int CurrentLine;     // number of current reading line
+    unsigned int CurrentLineIdx;  // current line start position
+    unsigned int CurrentTokenIdx; // current token start position
+    unsigned int TokenLineIdx;    // position that the lines of the tokens are counted up to
+    unsigned int TokenLine;       // line of the current token (the comments are counted)
+    unsigned int LastTokenLine;   // line of the previous token (the last matched token)
+    BOOLEAN      ReturnEndOfString;
+    BOOLEAN      PreviousTokenCanEndExpression;
+
+    //
+    // Parser
+    //
+    PUSER_DEFINED_FUNCTION_NODE UserDefinedFunctionHead;
+    PUSER_DEFINED_FUNCTION_NODE CurrentUserDefinedFunction;
+    PINCLUDE_NODE               IncludeHead;
+    unsigned int                TempId;
+
+    //
+    // Code generator
+    //
+    PSTRUCT_DECLARATOR_STATE    StructDeclarators;
+    PSTRUCT_DECLARATOR_STATE    StructDeclaratorsTail;
+    unsigned int                StructPointerDepth;
+    PVARIABLE_TYPE              CurrentStructDefinition;
+    PSCRIPT_ENGINE_TOKEN        LastStructObject;
+    PVARIABLE_TYPE              LastStructObjectType;
+    SIZEOF_COMPILATION_CONTEXT  SizeofContexts[MAX_NESTED_COMPILATION_CONTEXT_COUNT];
+    UINT32                      SizeofContextCount;
+    LOGICAL_COMPILATION_CONTEXT LogicalContexts[MAX_NESTED_COMPILATION_CONTEXT_COUNT];
+    UINT32                      LogicalContextCount;
+
+    //
+    // Type context
+    //
+    PTYPE_ALLOCATION_NODE TypeAllocations;
+    PSTRUCT_TAG_NODE      StructTags;
+    PTYPEDEF_NODE         Typedefs;
+
+    //
+    // Memory
+    //
+    SCRIPT_ENGINE_ARENA  TokenArena;       // released at the end of the compilation
+    PSCRIPT_ENGINE_ARENA ActiveTokenArena; // NULL while allocating tokens that outlive the compilation
+
+} SCRIPT_ENGINE_COMPILER_CONTEXT, *PSCRIPT_ENGINE_COMPILER_CONTEXT;
+
+/**
+ * @brief A batch of scripts that is compiled by a pool of threads
+ */
+typedef struct _SCRIPT_ENGINE_COMPILE_BATCH
+{
+    CHAR **         Scripts;
+    PVOID *         Results;
+    UINT32          NumberOfScripts;
+    volatile INT64  NextScriptIndex;
+
+} SCRIPT_ENGINE_COMPILE_BATCH, *PSCRIPT_ENGINE_COMPILE_BATCH;
+
+//////////////////////////////////////////////////
+//					Globals                     //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The compiler context that is used by the current thread
+ */
+extern SCRIPT_ENGINE_THREAD_LOCAL PSCRIPT_ENGINE_COMPILER_CONTEXT g_CompilerContext;
+
+/**
+ * @brief Lock of the table of global variables (GlobalIdTable)
+ */
+extern volatile LONG GlobalIdTableLock;
+
+/**
+ * @brief Lock of the symbol parser while compiling scripts concurrently
+ */
+extern volatile LONG SymbolParserLock;
+
+//////////////////////////////////////////////////
+//					Functions                   //
+//////////////////////////////////////////////////
+
+VOID
+AcquireGlobalIdTableLock(VOID);
+
+VOID
+ReleaseGlobalIdTableLock(VOID);
+
+#endif // !COMPILER_CONTEXT_H
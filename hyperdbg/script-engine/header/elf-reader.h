@@ -0,0 +1,486 @@
+/**
+ * @file elf-reader.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Memory-mapped reader of the ELF files and their DWARF debug information
+ * @details
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//                 Definitions                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Signature and identification of the ELF files (64-bit, little-endian)
+ */
+#define ELF_MAGIC          "\x7f" "ELF"
+#define ELF_MAGIC_SIZE     4
+#define ELF_CLASS_64       2
+#define ELF_DATA_LITTLE    1
+#define ELF_TYPE_RELOCATE  1
+#define ELF_MACHINE_X86_64 62
+
+/**
+ * @brief Size of the headers of the ELF files, the program headers, the
+ * section headers, the symbols and the relocations
+ */
+#define ELF_HEADER_SIZE         64
+#define ELF_PROGRAM_HEADER_SIZE 56
+#define ELF_SECTION_HEADER_SIZE 64
+#define ELF_SYMBOL_SIZE         24
+#define ELF_RELA_SIZE           24
+
+/**
+ * @brief Types and flags of the program headers and the sections
+ */
+#define ELF_PT_LOAD        1
+#define ELF_SHT_SYMTAB     2
+#define ELF_SHT_RELA       4
+#define ELF_SHT_NOBITS     8
+#define ELF_SHT_DYNSYM     11
+#define ELF_SHF_COMPRESSED 0x800
+
+/**
+ * @brief Special section indexes of the symbols
+ */
+#define ELF_SHN_UNDEF  0
+#define ELF_SHN_ABS    0xfff1
+#define ELF_SHN_XINDEX 0xffff
+
+/**
+ * @brief Types and bindings of the symbols
+ */
+#define ELF_STT_NOTYPE 0
+#define ELF_STT_OBJECT 1
+#define ELF_STT_FUNC   2
+#define ELF_STB_LOCAL  0
+
+/**
+ * @brief Types of the relocations (x86-64) that are applied to the debug
+ * information of the relocatable objects
+ */
+#define ELF_R_X86_64_64  1
+#define ELF_R_X86_64_32  10
+#define ELF_R_X86_64_32S 11
+
+/**
+ * @brief Types of the units of the DWARF 5 debug information
+ */
+#define ELF_DW_UT_COMPILE       0x01
+#define ELF_DW_UT_TYPE          0x02
+#define ELF_DW_UT_PARTIAL       0x03
+#define ELF_DW_UT_SKELETON      0x04
+#define ELF_DW_UT_SPLIT_COMPILE 0x05
+#define ELF_DW_UT_SPLIT_TYPE    0x06
+
+/**
+ * @brief Tags of the debugging information entries (DIEs)
+ */
+#define ELF_DW_TAG_ARRAY_TYPE       0x01
+#define ELF_DW_TAG_CLASS_TYPE       0x02
+#define ELF_DW_TAG_ENUMERATION_TYPE 0x04
+#define ELF_DW_TAG_MEMBER           0x0d
+#define ELF_DW_TAG_POINTER_TYPE     0x0f
+#define ELF_DW_TAG_REFERENCE_TYPE   0x10
+#define ELF_DW_TAG_COMPILE_UNIT     0x11
+#define ELF_DW_TAG_STRUCTURE_TYPE   0x13
+#define ELF_DW_TAG_TYPEDEF          0x16
+#define ELF_DW_TAG_UNION_TYPE       0x17
+#define ELF_DW_TAG_SUBRANGE_TYPE    0x21
+#define ELF_DW_TAG_BASE_TYPE        0x24
+#define ELF_DW_TAG_CONST_TYPE       0x26
+#define ELF_DW_TAG_SUBPROGRAM       0x2e
+#define ELF_DW_TAG_VARIABLE         0x34
+#define ELF_DW_TAG_VOLATILE_TYPE    0x35
+#define ELF_DW_TAG_RESTRICT_TYPE    0x37
+#define ELF_DW_TAG_PARTIAL_UNIT     0x3c
+#define ELF_DW_TAG_RVALUE_REF_TYPE  0x42
+#define ELF_DW_TAG_ATOMIC_TYPE      0x47
+
+/**
+ * @brief Attributes of the DIEs
+ */
+#define ELF_DW_AT_SIBLING              0x01
+#define ELF_DW_AT_LOCATION             0x02
+#define ELF_DW_AT_NAME                 0x03
+#define ELF_DW_AT_BYTE_SIZE            0x0b
+#define ELF_DW_AT_BIT_OFFSET           0x0c
+#define ELF_DW_AT_BIT_SIZE             0x0d
+#define ELF_DW_AT_STMT_LIST            0x10
+#define ELF_DW_AT_LOW_PC               0x11
+#define ELF_DW_AT_UPPER_BOUND          0x2f
+#define ELF_DW_AT_COUNT                0x37
+#define ELF_DW_AT_DATA_MEMBER_LOCATION 0x38
+#define ELF_DW_AT_DECLARATION          0x3c
+#define ELF_DW_AT_TYPE                 0x49
+#define ELF_DW_AT_DATA_BIT_OFFSET      0x6b
+#define ELF_DW_AT_STR_OFFSETS_BASE     0x72
+#define ELF_DW_AT_ADDR_BASE            0x73
+
+/**
+ * @brief Forms of the attributes
+ */
+#define ELF_DW_FORM_ADDR           0x01
+#define ELF_DW_FORM_BLOCK2         0x03
+#define ELF_DW_FORM_BLOCK4         0x04
+#define ELF_DW_FORM_DATA2          0x05
+#define ELF_DW_FORM_DATA4          0x06
+#define ELF_DW_FORM_DATA8          0x07
+#define ELF_DW_FORM_STRING         0x08
+#define ELF_DW_FORM_BLOCK          0x09
+#define ELF_DW_FORM_BLOCK1         0x0a
+#define ELF_DW_FORM_DATA1          0x0b
+#define ELF_DW_FORM_FLAG           0x0c
+#define ELF_DW_FORM_SDATA          0x0d
+#define ELF_DW_FORM_STRP           0x0e
+#define ELF_DW_FORM_UDATA          0x0f
+#define ELF_DW_FORM_REF_ADDR       0x10
+#define ELF_DW_FORM_REF1           0x11
+#define ELF_DW_FORM_REF2           0x12
+#define ELF_DW_FORM_REF4           0x13
+#define ELF_DW_FORM_REF8           0x14
+#define ELF_DW_FORM_REF_UDATA      0x15
+#define ELF_DW_FORM_INDIRECT       0x16
+#define ELF_DW_FORM_SEC_OFFSET     0x17
+#define ELF_DW_FORM_EXPRLOC        0x18
+#define ELF_DW_FORM_FLAG_PRESENT   0x19
+#define ELF_DW_FORM_STRX           0x1a
+#define ELF_DW_FORM_ADDRX          0x1b
+#define ELF_DW_FORM_REF_SUP4       0x1c
+#define ELF_DW_FORM_STRP_SUP       0x1d
+#define ELF_DW_FORM_DATA16         0x1e
+#define ELF_DW_FORM_LINE_STRP      0x1f
+#define ELF_DW_FORM_REF_SIG8       0x20
+#define ELF_DW_FORM_IMPLICIT_CONST 0x21
+#define ELF_DW_FORM_LOCLISTX       0x22
+#define ELF_DW_FORM_RNGLISTX       0x23
+#define ELF_DW_FORM_REF_SUP8       0x24
+#define ELF_DW_FORM_STRX1          0x25
+#define ELF_DW_FORM_STRX2          0x26
+#define ELF_DW_FORM_STRX3          0x27
+#define ELF_DW_FORM_STRX4          0x28
+#define ELF_DW_FORM_ADDRX1         0x29
+#define ELF_DW_FORM_ADDRX2         0x2a
+#define ELF_DW_FORM_ADDRX3         0x2b
+#define ELF_DW_FORM_ADDRX4         0x2c
+
+/**
+ * @brief Operations of the location expressions
+ */
+#define ELF_DW_OP_ADDR        0x03
+#define ELF_DW_OP_PLUS_UCONST 0x23
+#define ELF_DW_OP_ADDRX       0xa1
+
+/**
+ * @brief Opcodes and the formats of the entries of the line programs
+ */
+#define ELF_DW_LNS_COPY             0x01
+#define ELF_DW_LNS_ADVANCE_PC       0x02
+#define ELF_DW_LNS_ADVANCE_LINE     0x03
+#define ELF_DW_LNS_SET_FILE         0x04
+#define ELF_DW_LNS_CONST_ADD_PC     0x08
+#define ELF_DW_LNS_FIXED_ADVANCE_PC 0x09
+#define ELF_DW_LNE_END_SEQUENCE     0x01
+#define ELF_DW_LNE_SET_ADDRESS      0x02
+#define ELF_DW_LNCT_PATH            0x01
+#define ELF_DW_LNCT_DIRECTORY_INDEX 0x02
+
+/**
+ * @brief Maximum number of the formats of the entries of the directories
+ * and the files of the line programs
+ */
+#define ELF_DWARF_MAX_LINE_FORMATS 16
+
+/**
+ * @brief Number of the buckets of the hash table of the names of the DIEs
+ * (it grows with the names)
+ */
+#define ELF_DWARF_NAME_BUCKETS 0x4000
+
+/**
+ * @brief The largest code of the abbreviations of a unit
+ */
+#define ELF_DWARF_MAX_ABBREV_CODE 0x10000
+
+/**
+ * @brief Maximum depth of the type references that are followed
+ */
+#define ELF_MAX_TYPE_DEPTH 32
+
+//////////////////////////////////////////////////
+//                   Structures                 //
+//////////////////////////////////////////////////
+
+/**
+ * @brief A cursor of a section of the file
+ * @details Reading past the end of the section clears IsValid and returns
+ * zero, so the callers check it once after a group of reads
+ */
+typedef struct _ELF_READER
+{
+    const BYTE * Data;
+    UINT64       Size;
+    UINT64       Offset;
+    BOOLEAN      IsValid;
+
+} ELF_READER, *PELF_READER;
+
+/**
+ * @brief A section of the file
+ */
+typedef struct _ELF_SECTION
+{
+    const BYTE * Data;
+    UINT64       Size;
+
+} ELF_SECTION, *PELF_SECTION;
+
+/**
+ * @brief An attribute (and its form) of an abbreviation
+ */
+typedef struct _ELF_DWARF_ATTRIBUTE
+{
+    UINT16 Name;
+    UINT16 Form;
+    INT64  ImplicitConst;
+
+} ELF_DWARF_ATTRIBUTE, *PELF_DWARF_ATTRIBUTE;
+
+/**
+ * @brief An abbreviation of the DIEs
+ */
+typedef struct _ELF_DWARF_ABBREV
+{
+    UINT16               Tag;
+    BOOLEAN              HasChildren;
+    UINT32               AttributesCount;
+    PELF_DWARF_ATTRIBUTE Attributes;
+
+} ELF_DWARF_ABBREV, *PELF_DWARF_ABBREV;
+
+/**
+ * @brief A unit of the debug information (.debug_info)
+ * @details The headers of the units are read when the debug information is
+ * first used, the abbreviations of a unit are read when its DIEs are first
+ * read, and the names of a unit are indexed when a name is not found in the
+ * units that are already indexed
+ */
+typedef struct _ELF_DWARF_UNIT
+{
+    UINT64 Offset;
+    UINT64 End;
+    UINT64 DieOffset;
+    UINT64 AbbrevOffset;
+    UINT16 Version;
+    BYTE   UnitType;
+    BYTE   AddressSize;
+    BYTE   OffsetSize;
+
+    //
+    // Read from the DIE of the unit
+    //
+    UINT64  StrOffsetsBase;
+    UINT64  AddrBase;
+    UINT64  StmtList;
+    BOOLEAN HasStmtList;
+    BOOLEAN IsRead;
+
+    //
+    // Abbreviations (indexed by their codes)
+    //
+    PELF_DWARF_ABBREV    Abbrevs;
+    UINT32               AbbrevsCount;
+    PELF_DWARF_ATTRIBUTE Attributes;
+    BOOLEAN              IsAbbrevsLoaded;
+
+} ELF_DWARF_UNIT, *PELF_DWARF_UNIT;
+
+/**
+ * @brief The value of an attribute
+ * @details The references are converted to the offsets in .debug_info, and
+ * the indexes of the strings and the addresses (DWARF 5) are resolved by
+ * the unit of the DIE
+ */
+typedef struct _ELF_DWARF_VALUE
+{
+    UINT64       Constant;
+    const BYTE * Block;
+    UINT64       BlockSize;
+    const CHAR * String;
+    BOOLEAN      IsConstant;
+    BOOLEAN      IsAddress;
+    BOOLEAN      IsReference;
+    BOOLEAN      IsStringIndex;
+    BOOLEAN      IsAddressIndex;
+
+} ELF_DWARF_VALUE, *PELF_DWARF_VALUE;
+
+/**
+ * @brief The attributes of a DIE that are used by the reader
+ */
+typedef struct _ELF_DWARF_DIE
+{
+    UINT64          Offset;
+    UINT64          Next;
+    PELF_DWARF_UNIT Unit;
+    UINT16          Tag;
+    BOOLEAN         HasChildren;
+
+    const CHAR * Name;
+    UINT64       Type;
+    UINT64       Sibling;
+    UINT64       ByteSize;
+    UINT64       BitSize;
+    UINT64       BitOffset;
+    UINT64       DataBitOffset;
+    UINT64       MemberLocation;
+    UINT64       Address;
+    UINT64       Count;
+    INT64        UpperBound;
+    UINT64       StmtList;
+    UINT64       StrOffsetsBase;
+    UINT64       AddrBase;
+
+    BOOLEAN HasType;
+    BOOLEAN HasSibling;
+    BOOLEAN HasByteSize;
+    BOOLEAN HasBitSize;
+    BOOLEAN HasBitOffset;
+    BOOLEAN HasDataBitOffset;
+    BOOLEAN HasMemberLocation;
+    BOOLEAN HasAddress;
+    BOOLEAN HasCount;
+    BOOLEAN HasUpperBound;
+    BOOLEAN HasStmtList;
+    BOOLEAN HasStrOffsetsBase;
+    BOOLEAN HasAddrBase;
+    BOOLEAN IsDeclaration;
+
+} ELF_DWARF_DIE, *PELF_DWARF_DIE;
+
+/**
+ * @brief An entry of the hash table of the names of the DIEs
+ */
+typedef struct _ELF_DWARF_NAME
+{
+    const CHAR * Name;
+    UINT64       DieOffset;
+    UINT32       Hash;
+    UINT32       Next;
+    UINT16       Tag;
+
+} ELF_DWARF_NAME, *PELF_DWARF_NAME;
+
+/**
+ * @brief An address range of a unit (.debug_aranges)
+ */
+typedef struct _ELF_DWARF_RANGE
+{
+    UINT64 Address;
+    UINT64 Length;
+    UINT64 UnitOffset;
+
+} ELF_DWARF_RANGE, *PELF_DWARF_RANGE;
+
+/**
+ * @brief A memory-mapped ELF file
+ * @details Only the headers of the file and its sections are read when the
+ * file is opened; the symbols are indexed when they are first used, and the
+ * DWARF units are indexed one by one until the name that is looked up is
+ * found, so the debug information of a vmlinux is never parsed up front
+ */
+typedef struct _ELF_FILE
+{
+    BYTE *       Mapping;
+    SIZE_T       MappingSize;
+    UINT16       Type;
+    UINT64       ImageBase;
+    const BYTE * SectionHeaders;
+    UINT32       SectionsCount;
+
+    //
+    // Symbols (.symtab or .dynsym)
+    //
+    const BYTE * Symbols;
+    UINT32       SymbolsCount;
+    const CHAR * SymbolNames;
+    UINT64       SymbolNamesSize;
+    UINT32       SymbolHashBucketsCount;
+    UINT32 *     SymbolHashHeads;
+    UINT32 *     SymbolHashNext;
+    BOOLEAN      IsSymbolsLoaded;
+
+    //
+    // DWARF sections
+    //
+    ELF_SECTION DebugInfo;
+    ELF_SECTION DebugAbbrev;
+    ELF_SECTION DebugStr;
+    ELF_SECTION DebugLineStr;
+    ELF_SECTION DebugStrOffsets;
+    ELF_SECTION DebugAddr;
+    ELF_SECTION DebugLine;
+    ELF_SECTION DebugAranges;
+
+    //
+    // Units of the debug information
+    //
+    PELF_DWARF_UNIT Units;
+    UINT32          UnitsCount;
+    UINT32          IndexedUnitsCount;
+    BOOLEAN         IsUnitsLoaded;
+
+    //
+    // Names of the DIEs of the indexed units
+    //
+    PELF_DWARF_NAME Names;
+    UINT32          NamesCount;
+    UINT32          NamesCapacity;
+    UINT32 *        NameHashHeads;
+    UINT32          NameHashBucketsCount;
+
+    //
+    // Address ranges of the units
+    //
+    PELF_DWARF_RANGE Ranges;
+    UINT32           RangesCount;
+    BOOLEAN          IsRangesLoaded;
+
+} ELF_FILE, *PELF_FILE;
+
+/**
+ * @brief Callback of the enumeration of the symbols
+ *
+ * @return BOOLEAN FALSE stops the enumeration
+ */
+typedef BOOLEAN (*ELF_SYMBOL_CALLBACK)(const CHAR * Name, UINT64 Rva, UINT64 Size, PVOID Context);
+
+//////////////////////////////////////////////////
+//                  Functions                   //
+//////////////////////////////////////////////////
+
+PELF_FILE
+ElfOpen(const CHAR * FilePath);
+
+VOID
+ElfClose(PELF_FILE Elf);
+
+BOOLEAN
+ElfFindSymbol(PELF_FILE Elf, const CHAR * Name, UINT64 * Rva);
+
+VOID
+ElfEnumerateSymbols(PELF_FILE Elf, ELF_SYMBOL_CALLBACK Callback, PVOID Context);
+
+BOOLEAN
+ElfGetFieldOffset(PELF_FILE Elf, const CHAR * TypeName, const CHAR * FieldName, UINT32 * FieldOffset);
+
+BOOLEAN
+ElfGetTypeSize(PELF_FILE Elf, const CHAR * TypeName, UINT64 * TypeSize);
+
+BOOLEAN
+ElfGetLineFromAddress(PELF_FILE Elf, UINT64 Rva, CHAR * FileName, SIZE_T FileNameSize, UINT32 * Line);
@@ -34,3 +34,9 @@ extern BOOLEAN g_HwdbgInstanceInfoIsValid;
  *
  */
 extern PVOID g_MessageHandler;
+
+/**
+ * @brief Optimization level of the generated code (-O0 by default)
+ *
+ */
+extern UINT32 g_ScriptEngineOptimizationLevel;
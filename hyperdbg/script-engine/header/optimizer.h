@@ -0,0 +1,119 @@
+/**
+ * @file optimizer.h
+ * @author M.H. Gholamrezaei (mh@hyperdbg.org)
+ *
+ * @details Optimizer of the generated code of the script engine
+ * @version 0.19
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+#ifndef OPTIMIZER_H
+#    define OPTIMIZER_H
+
+//////////////////////////////////////////////////
+//					Definitions                 //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Optimization levels of the script engine
+ *
+ * @details -O0 leaves the generated code as it is, -O1 runs constant folding,
+ * copy propagation, dead-code elimination and jump threading over it
+ */
+#    define SCRIPT_ENGINE_OPTIMIZATION_LEVEL_O0 0
+#    define SCRIPT_ENGINE_OPTIMIZATION_LEVEL_O1 1
+
+/**
+ * @brief Maximum number of rounds of the optimization passes (each round
+ * continues while the previous one changed something)
+ */
+#    define OPTIMIZER_MAX_ROUNDS 16
+
+/**
+ * @brief Temps with a greater index disable the optimizations of the temps
+ */
+#    define OPTIMIZER_MAX_TEMP_COUNT 0x10000
+
+//////////////////////////////////////////////////
+//					Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Kind of an instruction (the layout of its operands) for the optimizer
+ */
+typedef enum _OPTIMIZER_INSTRUCTION_KIND
+{
+    OptimizerInstructionUnknown = 0,
+    OptimizerInstructionMove,            // [Src][Des]
+    OptimizerInstructionUnary,           // [Src][Des]
+    OptimizerInstructionBinary,          // [Src0][Src1][Des]
+    OptimizerInstructionTypedUnary,      // [Src][Des][Type]
+    OptimizerInstructionTypedBinary,     // [Src0][Src1][Des][Type]
+    OptimizerInstructionCast,            // [Src][Des][SourceType][DestinationType]
+    OptimizerInstructionJump,            // [Target]
+    OptimizerInstructionConditionalJump, // [Target][Condition]
+    OptimizerInstructionCall,            // [Target]
+    OptimizerInstructionReturn,          //
+    OptimizerInstructionPush,            // [Src]
+
+} OPTIMIZER_INSTRUCTION_KIND;
+
+/**
+ * @brief An instruction (the operator symbol and its operands) of the code buffer
+ */
+typedef struct _OPTIMIZER_INSTRUCTION
+{
+    UINT32                     Start;  // index of the operator symbol in the code buffer
+    UINT32                     Length; // number of symbols of the operator and the operands
+    UINT32                     Target; // instruction index of the target of jumps and calls
+    OPTIMIZER_INSTRUCTION_KIND Kind;
+    BOOLEAN                    IsRemoved;
+    BOOLEAN                    IsLeader; // target of a jump or a call
+
+} OPTIMIZER_INSTRUCTION, *POPTIMIZER_INSTRUCTION;
+
+/**
+ * @brief State of the optimization of a single code buffer
+ */
+typedef struct _OPTIMIZER_CONTEXT
+{
+    PSYMBOL_BUFFER         CodeBuffer;
+    POPTIMIZER_INSTRUCTION Instructions;
+    UINT32                 InstructionCount;
+
+    //
+    // The temps are only optimized if they cannot be accessed by their
+    // address (references, pointers and struct objects)
+    //
+    BOOLEAN   CanOptimizeTemps;
+    UINT32    TempCount;
+    UINT32    BitmapSize;   // number of UINT64 of the bitmap of the temps
+    UINT64 *  LiveIn;       // live temps before each instruction
+    UINT64 *  LiveOut;      // live temps after each instruction
+    UINT64 *  Uses;         // temps that are read by an instruction
+    UINT64 *  Definitions;  // temps that are written by an instruction
+    PSYMBOL   KnownValues;  // the constant or the temp that a temp is a copy of
+    BOOLEAN * IsValueKnown; // whether the known value of each temp is valid
+
+    //
+    // Everything is allocated before the code buffer is changed, so the
+    // optimization never stops in the middle because of the allocations
+    //
+    BOOLEAN * IsReachable;
+    UINT32 *  Worklist;
+    UINT32 *  NewStarts;
+
+} OPTIMIZER_CONTEXT, *POPTIMIZER_CONTEXT;
+
+//////////////////////////////////////////////////
+//					Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+OptimizeSymbolBuffer(PSYMBOL_BUFFER CodeBuffer);
+
+#endif // !OPTIMIZER_H
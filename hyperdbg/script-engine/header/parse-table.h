@@ -1,25 +1,25 @@
 #pragma once
 #ifndef PARSE_TABLE_H
 #define PARSE_TABLE_H
-#define RULES_COUNT 355
-#define TERMINAL_COUNT 135
-#define NONETERMINAL_COUNT 91
+#define RULES_COUNT 364
+#define TERMINAL_COUNT 142
+#define NONETERMINAL_COUNT 92
 #define START_VARIABLE "S"
 #define MAX_RHS_LEN 15
-#define KEYWORD_LIST_LENGTH 121
+#define KEYWORD_LIST_LENGTH 127
 #define OPERATORS_ONE_OPERAND_LIST_LENGTH 3
 #define OPERATORS_TWO_OPERAND_LIST_LENGTH 16
 #define REGISTER_MAP_LIST_LENGTH 120
 #define PSEUDO_REGISTER_MAP_LIST_LENGTH 16
 #define SCRIPT_VARIABLE_TYPE_LIST_LENGTH 10
 #define ASSIGNMENT_OPERATOR_LIST_LENGTH 10
-#define SEMANTIC_RULES_MAP_LIST_LENGTH 211
+#define SEMANTIC_RULES_MAP_LIST_LENGTH 217
 #define THREEOPFUNC1_LENGTH 1
 #define THREEOPFUNC2_LENGTH 3
 #define TWOOPFUNC1_LENGTH 8
-#define TWOOPFUNC2_LENGTH 2
+#define TWOOPFUNC2_LENGTH 6
 #define ONEOPFUNC1_LENGTH 26
-#define ONEOPFUNC2_LENGTH 10
+#define ONEOPFUNC2_LENGTH 11
 #define ONEOPFUNC3_LENGTH 1
 #define TWOOPFUNC3_LENGTH 1
 #define THREEOPFUNC3_LENGTH 2
@@ -29,6 +29,7 @@
 #define ZEROOPFUNC1_LENGTH 7
 #define ZEROOPFUNC2_LENGTH 7
 #define VARARGFUNC1_LENGTH 1
+#define VARARGFUNC2_LENGTH 1
 extern const struct _SCRIPT_ENGINE_TOKEN Lhs[RULES_COUNT];
 extern const struct _SCRIPT_ENGINE_TOKEN Rhs[RULES_COUNT][MAX_RHS_LEN];
 extern const unsigned int RhsSize[RULES_COUNT];
@@ -54,12 +55,20 @@ extern const char* TwoOpFunc4[];
 extern const char* ZeroOpFunc1[];
 extern const char* ZeroOpFunc2[];
 extern const char* VarArgFunc1[];
+extern const char* VarArgFunc2[];
 extern const SYMBOL_MAP SemanticRulesMapList[];
 extern const SYMBOL_MAP RegisterMapList[];
 extern const SYMBOL_MAP PseudoRegisterMapList[];
 extern const char* ScriptVariableTypeList[];
 
 
+extern const PERFECT_HASH_TABLE KeywordHashTable;
+extern const PERFECT_HASH_TABLE RegisterHashTable;
+extern const PERFECT_HASH_TABLE PseudoRegisterHashTable;
+extern const PERFECT_HASH_TABLE TerminalHashTable;
+extern const PERFECT_HASH_TABLE NonTerminalHashTable;
+extern const PERFECT_HASH_TABLE LalrTerminalHashTable;
+extern const PERFECT_HASH_TABLE LalrNonTerminalHashTable;
 #define LALR_RULES_COUNT 141
 #define LALR_TERMINAL_COUNT 93
 #define LALR_NONTERMINAL_COUNT 37
@@ -59,16 +59,37 @@
 #include "common.h"
 #include "scanner.h"
 #include "globals.h"
+#include "compiler-context.h"
+#include "optimizer.h"
 #include "../include/SDK/headers/ScriptEngineCommonDefinitions.h"
 #include "script-engine.h"
 #include "parse-table.h"
 #include "hardware.h"
 
+//
+// Symbol backend of Linux (ELF and PDB files)
+//
+#ifdef __linux__
+#    include "elf-reader.h"
+#    include "pdb-reader.h"
+#    include "symbol-linux.h"
+#endif
+
 //
 // Platform-specific library calls
 //
 #include "platform/user/header/platform-lib-calls.h"
 
+//
+// Platform-specific intrinsic functions
+//
+#include "platform/user/header/platform-intrinsics.h"
+
+//
+// Compact encoding of the script buffers
+//
+#include "components/bytecode/header/CompactBytecode.h"
+
 //
 // Import/export definitions
 //
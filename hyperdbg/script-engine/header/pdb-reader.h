@@ -0,0 +1,257 @@
+/**
+ * @file pdb-reader.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Memory-mapped reader of the PDB (MSF) files
+ * @details
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//                 Definitions                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Signature and size of the header of the MSF (PDB 7.0) files
+ */
+#define PDB_MSF_MAGIC       "Microsoft C/C++ MSF 7.00\r\n\x1a" "DS\0\0\0"
+#define PDB_MSF_MAGIC_SIZE  32
+#define PDB_MSF_HEADER_SIZE 56
+
+/**
+ * @brief Fixed streams of the PDB files
+ */
+#define PDB_STREAM_PDB_INFO 1
+#define PDB_STREAM_TPI      2
+#define PDB_STREAM_DBI      3
+
+/**
+ * @brief The stream index of the streams that are not present
+ */
+#define PDB_INVALID_STREAM 0xffff
+
+/**
+ * @brief Size of the headers of the DBI, the modules of the DBI, the TPI
+ * and the publics streams
+ */
+#define PDB_DBI_HEADER_SIZE         64
+#define PDB_DBI_MODULE_HEADER_SIZE  64
+#define PDB_TPI_HEADER_SIZE         56
+#define PDB_PUBLICS_HEADER_SIZE     28
+#define PDB_SECTION_HEADER_SIZE     40
+#define PDB_DBI_DEBUG_SECTION_INDEX 5
+
+/**
+ * @brief The hash tables of the publics and the globals (GSI) streams
+ */
+#define PDB_GSI_SIGNATURE         0xffffffff
+#define PDB_GSI_VERSION           (0xeffe0000 + 19990810)
+#define PDB_GSI_HEADER_SIZE       16
+#define PDB_GSI_HASH_RECORD_SIZE  8
+#define PDB_GSI_BUCKET_ENTRY_SIZE 12
+#define PDB_GSI_HASH_BUCKETS      4096
+#define PDB_GSI_BITMAP_WORDS      ((PDB_GSI_HASH_BUCKETS + 1 + 31) / 32)
+
+/**
+ * @brief Default number of the buckets of the hash table of the types
+ */
+#define PDB_TPI_HASH_BUCKETS 0x3ffff
+
+/**
+ * @brief Kinds of the symbol records
+ */
+#define PDB_S_UDT        0x1108
+#define PDB_S_LDATA32    0x110c
+#define PDB_S_GDATA32    0x110d
+#define PDB_S_PUB32      0x110e
+#define PDB_S_LPROC32    0x110f
+#define PDB_S_GPROC32    0x1110
+#define PDB_S_PROCREF    0x1125
+#define PDB_S_LPROCREF   0x1127
+#define PDB_S_LPROC32_ID 0x1146
+#define PDB_S_GPROC32_ID 0x1147
+
+/**
+ * @brief Kinds of the type records and the members of the field lists
+ */
+#define PDB_LF_MODIFIER     0x1001
+#define PDB_LF_POINTER      0x1002
+#define PDB_LF_BITFIELD     0x1205
+#define PDB_LF_FIELDLIST    0x1203
+#define PDB_LF_BCLASS       0x1400
+#define PDB_LF_VBCLASS      0x1401
+#define PDB_LF_IVBCLASS     0x1402
+#define PDB_LF_INDEX        0x1404
+#define PDB_LF_VFUNCTAB     0x1409
+#define PDB_LF_FRIENDCLS    0x140b
+#define PDB_LF_VFUNCOFF     0x140c
+#define PDB_LF_ENUMERATE    0x1502
+#define PDB_LF_ARRAY        0x1503
+#define PDB_LF_CLASS        0x1504
+#define PDB_LF_STRUCTURE    0x1505
+#define PDB_LF_UNION        0x1506
+#define PDB_LF_ENUM         0x1507
+#define PDB_LF_FRIENDFCN    0x150c
+#define PDB_LF_MEMBER       0x150d
+#define PDB_LF_STMEMBER     0x150e
+#define PDB_LF_METHOD       0x150f
+#define PDB_LF_NESTTYPE     0x1510
+#define PDB_LF_ONEMETHOD    0x1511
+#define PDB_LF_NESTTYPEEX   0x1512
+#define PDB_LF_MEMBERMODIFY 0x1513
+#define PDB_LF_INTERFACE    0x1519
+
+/**
+ * @brief Numeric leaves
+ */
+#define PDB_LF_NUMERIC   0x8000
+#define PDB_LF_CHAR      0x8000
+#define PDB_LF_SHORT     0x8001
+#define PDB_LF_USHORT    0x8002
+#define PDB_LF_LONG      0x8003
+#define PDB_LF_ULONG     0x8004
+#define PDB_LF_QUADWORD  0x8009
+#define PDB_LF_UQUADWORD 0x800a
+
+/**
+ * @brief Padding bytes of the members of the field lists
+ */
+#define PDB_LF_PAD0 0xf0
+
+/**
+ * @brief Properties of the user-defined types
+ */
+#define PDB_PROPERTY_FORWARD_REF 0x0080
+
+/**
+ * @brief Maximum depth of the type references that are followed
+ */
+#define PDB_MAX_TYPE_DEPTH 32
+
+//////////////////////////////////////////////////
+//                   Structures                 //
+//////////////////////////////////////////////////
+
+/**
+ * @brief A stream of the MSF container
+ * @details If the blocks of the stream are contiguous in the file, the
+ * data points into the mapping of the file, otherwise the blocks are
+ * copied into an allocated buffer
+ */
+typedef struct _PDB_STREAM
+{
+    const BYTE * Data;
+    UINT32       Size;
+    BOOLEAN      IsAllocated;
+    BOOLEAN      IsLoaded;
+
+} PDB_STREAM, *PPDB_STREAM;
+
+/**
+ * @brief Hash table of the publics or the globals (GSI) stream
+ * @details The buckets of the file are expanded to the first and the
+ * last hash record of each bucket when the stream is first used
+ */
+typedef struct _PDB_GSI
+{
+    const BYTE * HashRecords;
+    UINT32       HashRecordsCount;
+    UINT32 *     BucketBegins;
+    UINT32 *     BucketEnds;
+    BOOLEAN      IsLoaded;
+
+} PDB_GSI, *PPDB_GSI;
+
+/**
+ * @brief A memory-mapped PDB file
+ * @details Only the MSF directory, the PDB information stream and the
+ * header of the DBI stream are read when the file is opened, the other
+ * streams are read when they are first used
+ */
+typedef struct _PDB_FILE
+{
+    BYTE *   Mapping;
+    SIZE_T   MappingSize;
+    UINT32   BlockSize;
+    UINT32   BlocksCount;
+    BYTE *   Directory;
+    UINT32   StreamsCount;
+    UINT32 * StreamSizes;
+    UINT32 * StreamBlocks;
+    UINT32 * StreamFirstBlocks;
+
+    PDB_STREAM * Streams;
+
+    //
+    // PDB information stream
+    //
+    BYTE   Guid[16];
+    UINT32 Age;
+
+    //
+    // DBI stream
+    //
+    UINT16       GlobalsStreamIndex;
+    UINT16       PublicsStreamIndex;
+    UINT16       SymbolRecordsStreamIndex;
+    UINT16       SectionHeadersStreamIndex;
+    const BYTE * ModulesInfo;
+    UINT32       ModulesInfoSize;
+    UINT16 *     ModuleStreams;
+    UINT32       ModulesCount;
+    const BYTE * SectionHeaders;
+    UINT32       SectionsCount;
+
+    //
+    // Publics and globals
+    //
+    PDB_GSI Publics;
+    PDB_GSI Globals;
+
+    //
+    // TPI stream
+    //
+    UINT32       TypeIndexBegin;
+    UINT32       TypeIndexEnd;
+    const BYTE * TypeRecords;
+    UINT32       TypeRecordsSize;
+    UINT32 *     TypeOffsets;
+    UINT32       TypeHashBucketsCount;
+    UINT32 *     TypeHashHeads;
+    UINT32 *     TypeHashNext;
+    BOOLEAN      IsTypesLoaded;
+
+} PDB_FILE, *PPDB_FILE;
+
+/**
+ * @brief Callback of the enumeration of the symbols
+ *
+ * @return BOOLEAN FALSE stops the enumeration
+ */
+typedef BOOLEAN (*PDB_SYMBOL_CALLBACK)(const CHAR * Name, UINT32 Rva, PVOID Context);
+
+//////////////////////////////////////////////////
+//                  Functions                   //
+//////////////////////////////////////////////////
+
+PPDB_FILE
+PdbOpen(const CHAR * FilePath);
+
+VOID
+PdbClose(PPDB_FILE Pdb);
+
+BOOLEAN
+PdbFindSymbol(PPDB_FILE Pdb, const CHAR * Name, UINT32 * Rva);
+
+VOID
+PdbEnumerateSymbols(PPDB_FILE Pdb, PDB_SYMBOL_CALLBACK Callback, PVOID Context);
+
+BOOLEAN
+PdbGetFieldOffset(PPDB_FILE Pdb, const CHAR * TypeName, const CHAR * FieldName, UINT32 * FieldOffset);
+
+BOOLEAN
+PdbGetTypeSize(PPDB_FILE Pdb, const CHAR * TypeName, UINT64 * TypeSize);
@@ -17,36 +17,7 @@
 /**
  * @brief lookup table for storing global Ids
  */
-extern PSCRIPT_ENGINE_TOKEN_LIST GlobalIdTable;
-
-/**
- * @brief
- */
-extern PUSER_DEFINED_FUNCTION_NODE UserDefinedFunctionHead;
-
-extern PUSER_DEFINED_FUNCTION_NODE CurrentUserDefinedFunction;
-
-extern PINCLUDE_NODE IncludeHead;
-
-/**
- * @brief number of read characters from input
- */
-extern unsigned int InputIdx;
-
-/**
- * @brief number of current reading line
- */
-extern unsigned int CurrentLine;
-
-/*
- * @brief current line start position
- */
-extern unsigned int CurrentLineIdx;
-
-/*
- * @brief current PTOKEN start position
- */
-extern unsigned int CurrentTokenIdx;
+extern PSCRIPT_ENGINE_ID_TABLE GlobalIdTable;
 
 ////////////////////////////////////////////////////
 //            Interfacing functions	         	  //
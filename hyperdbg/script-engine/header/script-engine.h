@@ -93,6 +93,9 @@ GetGlobalIdentifierVariableType(PSCRIPT_ENGINE_TOKEN Token);
 BOOLEAN
 GetGlobalIdentifierIsImplicitType(PSCRIPT_ENGINE_TOKEN Token);
 
+BOOLEAN
+GetGlobalIdentifierIsPercpu(PSCRIPT_ENGINE_TOKEN Token);
+
 unsigned long long
 NewLocalIdentifier(PSCRIPT_ENGINE_TOKEN PTOKEN, unsigned int VariableSize);
 
@@ -0,0 +1,51 @@
+/**
+ * @file symbol-linux.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Symbol backend of Linux
+ * @details
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//                 Definitions                  //
+//////////////////////////////////////////////////
+
+#ifndef _MAX_FNAME
+#    define _MAX_FNAME 256
+#endif
+
+//////////////////////////////////////////////////
+//                   Structures                 //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Details of a module whose symbols are loaded
+ * @details The symbols are either of an ELF file (Linux debuggees) or of a
+ * PDB file (Windows debuggees)
+ *
+ */
+typedef struct _SYMBOL_LOADED_MODULE_DETAILS
+{
+    UINT64    BaseAddress;
+    char      ModuleName[_MAX_FNAME];
+    char      ModuleAlternativeName[_MAX_FNAME];
+    char      PdbFilePath[MAX_PATH];
+    PELF_FILE Elf;
+    PPDB_FILE Pdb;
+
+} SYMBOL_LOADED_MODULE_DETAILS, *PSYMBOL_LOADED_MODULE_DETAILS;
+
+//////////////////////////////////////////////////
+//                  Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+SymMatchMask(const CHAR * Mask, const CHAR * Name);
+
+BOOLEAN
+SymGetLineFromAddress(UINT64 Address, CHAR * FileName, SIZE_T FileNameSize, UINT32 * Line);
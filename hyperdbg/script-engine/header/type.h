@@ -122,7 +122,9 @@ typedef enum _SCRIPT_ENGINE_ERROR_TYPE
     SCRIPT_ENGINE_ERROR_INVALID_ARRAY_SIZE,
     SCRIPT_ENGINE_ERROR_INVALID_FLOAT_LITERAL,
     SCRIPT_ENGINE_ERROR_FLOAT_OUT_OF_RANGE,
-    SCRIPT_ENGINE_ERROR_UNSUPPORTED_FLOAT_OPERATION
+    SCRIPT_ENGINE_ERROR_UNSUPPORTED_FLOAT_OPERATION,
+    SCRIPT_ENGINE_ERROR_GLOBAL_VARIABLE_IS_NOT_PERCPU,
+    SCRIPT_ENGINE_ERROR_TOO_MANY_EMIT_ARGUMENTS
 } SCRIPT_ENGINE_ERROR_TYPE,
     *PSCRIPT_ENGINE_ERROR_TYPE;
 
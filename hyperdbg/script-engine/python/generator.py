@@ -20,6 +20,7 @@ import sys
 
 from ll1_parser import *
 from lalr1_parser import *
+from perfect_hash import *
 
 
 def EnsureDeterministicHashSeed():
@@ -53,6 +54,9 @@ class Generator():
         self.lalr.ParseTable = self.lalr_table
         self.ll1.SetLalr(self.lalr, self.lalr_table)
 
+        # Perfect hash tables of keywords, registers, terminals and non-terminals
+        PerfectHashGenerator(self.SourceFile, self.HeaderFile).Run(self.ll1, self.lalr)
+
         self.lalr.Run()
 
         self.CommonHeaderFile.write("#endif\n")
@@ -162,8 +166,47 @@ typedef struct SYMBOL_BUFFER {
     unsigned int Pointer;
     unsigned int Size;
     char* Message;
+    unsigned int* Lines; // source line of each symbol (NULL if not available)
 } SYMBOL_BUFFER, * PSYMBOL_BUFFER;
 
+/**
+ * @brief Header of a compact (variable-length) script buffer
+ *
+ * @details A compact buffer starts with this header and is followed by one
+ * record per symbol: a tag byte (the low 5 bits are the type, 0x1f means the
+ * type follows as a varint, 0x20 means a varint Len follows and the high 2 bits
+ * show how the value is stored), then the varint operands. Strings store their
+ * Len bytes right after the tag and the Len. Buffers without this header are
+ * plain arrays of SYMBOL (the first type of them never has the high bits set).
+ */
+typedef struct SCRIPT_COMPACT_BUFFER_HEADER
+{
+    long long unsigned Magic;
+    unsigned int Version;
+    unsigned int SymbolCount;
+
+} SCRIPT_COMPACT_BUFFER_HEADER, *PSCRIPT_COMPACT_BUFFER_HEADER;
+
+#define SCRIPT_COMPACT_BUFFER_MAGIC 0x5450495243534448ull // "HDSCRIPT"
+#define SCRIPT_COMPACT_BUFFER_VERSION 1
+
+#define SCRIPT_COMPACT_TAG_TYPE_MASK 0x1f
+#define SCRIPT_COMPACT_TAG_TYPE_ESCAPE 0x1f
+#define SCRIPT_COMPACT_TAG_HAS_LEN 0x20
+#define SCRIPT_COMPACT_TAG_VALUE_SHIFT 6
+
+#define SCRIPT_COMPACT_VALUE_ZERO 0
+#define SCRIPT_COMPACT_VALUE_VARINT 1
+#define SCRIPT_COMPACT_VALUE_INVERTED_VARINT 2 // ~Value as a varint (small negative numbers)
+#define SCRIPT_COMPACT_VALUE_RAW 3
+
+/**
+ * @brief A symbol never needs more than 32 bytes in the compact format
+ * (tag + 3 varints of at most 10 bytes)
+ */
+#define SCRIPT_COMPACT_BUFFER_MAXIMUM_SIZE(SymbolCount) \\
+    (sizeof(SCRIPT_COMPACT_BUFFER_HEADER) + (SymbolCount) * 32)
+
 typedef struct SYMBOL_MAP
 {
     char* Name;
@@ -200,11 +243,71 @@ typedef struct ACTION_BUFFER {
 #define SYMBOL_REFERENCE_TEMP_TYPE 19
 #define SYMBOL_DEREFERENCE_LOCAL_ID_TYPE 20
 #define SYMBOL_DEREFERENCE_TEMP_TYPE 21
+#define SYMBOL_PERCPU_ID_TYPE 22
 
 #define SYMBOL_VALUE_KIND_INTEGER 0
 #define SYMBOL_VALUE_KIND_FLOAT32 1
 #define SYMBOL_VALUE_KIND_FLOAT64 2
 
+/**
+ * @brief Descriptors of the format specifiers of printf
+ *
+ * @details The compiler keeps the descriptor of the specifier of each argument
+ * of printf in the high 32 bits of the type of the argument: the position of
+ * its '%' in the format, its length and its kind. The high 32 bits of the type
+ * of the variable count symbol keep the id of the format for the deferred
+ * messages (zero if the message is formatted by the evaluator).
+ */
+#define SYMBOL_FORMAT_SPECIFIER_POSITION_SHIFT 32
+#define SYMBOL_FORMAT_SPECIFIER_POSITION_MASK 0xffffff
+#define SYMBOL_FORMAT_SPECIFIER_LENGTH_SHIFT 56
+#define SYMBOL_FORMAT_SPECIFIER_LENGTH_MASK 0xf
+#define SYMBOL_FORMAT_SPECIFIER_KIND_SHIFT 60
+#define SYMBOL_FORMAT_ID_SHIFT 32
+
+#define FORMAT_SPECIFIER_KIND_INTEGER 1
+#define FORMAT_SPECIFIER_KIND_FLOAT 2
+#define FORMAT_SPECIFIER_KIND_STRING 3
+#define FORMAT_SPECIFIER_KIND_WSTRING 4
+
+/**
+ * @brief Header of a deferred printf message, the raw 64-bit values of the
+ * arguments follow it and the debugger formats the message by the id
+ *
+ * @details The indicator is zero, so the message is an empty string for
+ * the readers that don't know the deferred messages
+ */
+typedef struct SCRIPT_DEFERRED_PRINTF_HEADER
+{
+    unsigned int Indicator;
+    unsigned int FormatId;
+
+} SCRIPT_DEFERRED_PRINTF_HEADER, *PSCRIPT_DEFERRED_PRINTF_HEADER;
+
+#define SCRIPT_DEFERRED_PRINTF_INDICATOR 0
+#define SCRIPT_DEFERRED_PRINTF_MAXIMUM_ARGUMENTS 32
+
+/**
+ * @brief Header of a binary record of the emit function, the raw 64-bit
+ * values of the arguments follow it
+ *
+ * @details The indicator is zero and the signature is never a valid format
+ * id, so the record is not taken as a string or as a deferred printf message
+ */
+typedef struct SCRIPT_EMIT_RECORD_HEADER
+{
+    unsigned int       Indicator;
+    unsigned int       Signature;
+    unsigned long long Tag;
+    unsigned long long Tsc;
+    unsigned int       Core;
+    unsigned int       ArgCount;
+
+} SCRIPT_EMIT_RECORD_HEADER, *PSCRIPT_EMIT_RECORD_HEADER;
+
+#define SCRIPT_EMIT_RECORD_SIGNATURE 0xffffffff
+#define SCRIPT_EMIT_RECORD_MAXIMUM_ARGUMENTS 32
+
 #define SCRIPT_ENGINE_ADDRESS_SPACE_LOCAL 1
 #define SCRIPT_ENGINE_ADDRESS_SPACE_REMOTE 2
 
@@ -245,7 +348,8 @@ static const char *const SymbolTypeNames[] = {
 "SYMBOL_REFERENCE_LOCAL_ID_TYPE",
 "SYMBOL_REFERENCE_TEMP_TYPE",
 "SYMBOL_DEREFERENCE_LOCAL_ID_TYPE",
-"SYMBOL_DEREFERENCE_TEMP_TYPE"
+"SYMBOL_DEREFERENCE_TEMP_TYPE",
+"SYMBOL_PERCPU_ID_TYPE"
 };
 
 #define SYMBOL_MEM_VALID_CHECK_MASK (1 << 31)
@@ -453,6 +453,7 @@ class LL1Parser:
             "convert_float"
         }
         aggregate_keywords = {"struct", "typedef"}
+        append_only_keywords = ["emit"]
         append_only_semantics = [
             "cast_scalar",
             "add_typed", "sub_typed", "mul_typed", "div_typed", "mod_typed",
@@ -467,9 +468,9 @@ class LL1Parser:
         }
         legacy_semantics = [x for x in self.SemantiRulesList if x not in aggregate_semantics and x not in append_only_semantics and x not in compiler_only_semantics]
         new_semantics = [x for x in self.SemantiRulesList if x in aggregate_semantics]
-        legacy_keywords = [x for x in self.keywordList if x not in aggregate_keywords]
+        legacy_keywords = [x for x in self.keywordList if x not in aggregate_keywords and x not in append_only_keywords]
         new_keywords = [x for x in self.keywordList if x in aggregate_keywords]
-        numbered_semantics = legacy_semantics + legacy_keywords + new_semantics + new_keywords + append_only_semantics
+        numbered_semantics = legacy_semantics + legacy_keywords + new_semantics + new_keywords + append_only_semantics + append_only_keywords
         
         self.CommonHeaderFileScala.write("object ScriptEvalFunc {\n  object ScriptOperators extends ChiselEnum {\n    val ")
         
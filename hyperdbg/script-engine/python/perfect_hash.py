@@ -0,0 +1,123 @@
+"""
+ * @file perfect_hash.py
+ * @author M.H. Gholamrezei (mh@hyperdbg.org)
+ * @brief Script engine perfect hash table generator
+ * @details Creates the perfect hash tables (hash and displace) that the
+ *          scanner and the parsers use for finding keywords, registers,
+ *          pseudo-registers, terminals and non-terminals. The hash
+ *          functions must be the same as PerfectHashFunction and
+ *          PerfectHashMix in common.c
+ * @version 0.19
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+
+ """
+
+MASK32 = 0xffffffff
+
+
+# FNV-1a hash of the name (PerfectHashFunction)
+def PerfectHashFunction(Name):
+    Hash = 2166136261
+    for C in Name.encode("ascii"):
+        Hash ^= C
+        Hash = (Hash * 16777619) & MASK32
+    return Hash
+
+
+# Mixes the hash of the name with a seed (PerfectHashMix)
+def PerfectHashMix(Hash, Seed):
+    Hash ^= Seed
+    Hash ^= Hash >> 16
+    Hash = (Hash * 0x7feb352d) & MASK32
+    Hash ^= Hash >> 15
+    Hash = (Hash * 0x846ca68b) & MASK32
+    Hash ^= Hash >> 16
+    return Hash
+
+
+# Returns the smallest power of two which is not less than X
+def NextPowerOfTwo(X):
+    Result = 1
+    while Result < X:
+        Result *= 2
+    return Result
+
+
+class PerfectHashGenerator:
+    def __init__(self, SourceFile, HeaderFile):
+        self.SourceFile = SourceFile
+        self.HeaderFile = HeaderFile
+
+    # Finds a seed for each bucket so that all the names land in distinct slots
+    def Build(self, Names):
+        Hashes = [PerfectHashFunction(X) for X in Names]
+        if len(set(Hashes)) != len(Hashes):
+            raise Exception("err, two names of the perfect hash table have the same hash")
+
+        # Half-full table of entries and about four names per bucket
+        EntryCount = NextPowerOfTwo(len(Names) * 2)
+        SeedCount = NextPowerOfTwo(max(1, len(Names) // 4))
+
+        Buckets = [[] for i in range(SeedCount)]
+        for i in range(len(Names)):
+            Buckets[PerfectHashMix(Hashes[i], 0) & (SeedCount - 1)].append(i)
+
+        Seeds = [0] * SeedCount
+        Slots = [None] * EntryCount
+
+        # Buckets with more names are placed first
+        for Bucket in sorted(range(SeedCount), key=lambda X: (-len(Buckets[X]), X)):
+            if not Buckets[Bucket]:
+                continue
+            Seed = 1
+            while True:
+                Positions = [PerfectHashMix(Hashes[i], Seed) & (EntryCount - 1) for i in Buckets[Bucket]]
+                if len(set(Positions)) == len(Positions) and all(Slots[X] is None for X in Positions):
+                    break
+                Seed += 1
+            Seeds[Bucket] = Seed
+            for i, Position in zip(Buckets[Bucket], Positions):
+                Slots[Position] = i
+
+        return Seeds, Slots
+
+    # Writes a perfect hash table which maps each name to its value
+    def WriteTable(self, Name, Names, Values):
+        Seeds, Slots = self.Build(Names)
+
+        self.HeaderFile.write("extern const PERFECT_HASH_TABLE " + Name + ";\n")
+
+        self.SourceFile.write("const unsigned int " + Name + "Seeds[" + str(len(Seeds)) + "]= \n{\n")
+        for i in range(0, len(Seeds), 16):
+            self.SourceFile.write("\t" + ", ".join(str(X) for X in Seeds[i:i + 16]))
+            self.SourceFile.write(",\n" if i + 16 < len(Seeds) else "\n")
+        self.SourceFile.write("};\n")
+
+        self.SourceFile.write("const SYMBOL_MAP " + Name + "Entries[" + str(len(Slots)) + "]= \n{\n")
+        Counter = 0
+        for X in Slots:
+            if X is None:
+                self.SourceFile.write("\t{NULL, 0}")
+            else:
+                self.SourceFile.write("\t{\"" + Names[X] + "\", " + str(Values[X]) + "}")
+            self.SourceFile.write(",\n" if Counter != len(Slots) - 1 else "\n")
+            Counter += 1
+        self.SourceFile.write("};\n")
+
+        self.SourceFile.write("const PERFECT_HASH_TABLE " + Name + "= {" + Name + "Seeds, " + str(len(Seeds) - 1) + ", " + Name + "Entries, " + str(len(Slots) - 1) + "};\n")
+
+    # Writes the perfect hash tables of the LL(1) and the LALR(1) parsers
+    def Run(self, Ll1, Lalr):
+        # Keywords (the scanner also treats every terminal as a keyword)
+        Keywords = list(dict.fromkeys(Ll1.keywordList + Ll1.TerminalList))
+        self.WriteTable("KeywordHashTable", Keywords, list(range(len(Keywords))))
+
+        self.WriteTable("RegisterHashTable", Ll1.RegistersList, ["REGISTER_" + X.upper() for X in Ll1.RegistersList])
+        self.WriteTable("PseudoRegisterHashTable", Ll1.PseudoRegistersList, ["PSEUDO_REGISTER_" + X.upper() for X in Ll1.PseudoRegistersList])
+
+        self.WriteTable("TerminalHashTable", Ll1.TerminalList, list(range(len(Ll1.TerminalList))))
+        self.WriteTable("NonTerminalHashTable", Ll1.NonTerminalList, list(range(len(Ll1.NonTerminalList))))
+        self.WriteTable("LalrTerminalHashTable", Lalr.TerminalList, list(range(len(Lalr.TerminalList))))
+        self.WriteTable("LalrNonTerminalHashTable", Lalr.NonTerminalList, list(range(len(Lalr.NonTerminalList))))
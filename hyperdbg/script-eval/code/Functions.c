@@ -70,6 +70,7 @@ ScriptEngineFunctionEq(UINT64 Address, QWORD Value, BOOL * HasError)
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
     MemoryMapperWriteMemorySafeOnTargetProcess(Address, &Value, sizeof(QWORD));
+    MemoryMapperInvalidateTranslationCache();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
     return TRUE;
@@ -109,6 +110,7 @@ ScriptEngineFunctionEd(UINT64 Address, DWORD Value, BOOL * HasError)
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
     MemoryMapperWriteMemorySafeOnTargetProcess(Address, &Value, sizeof(DWORD));
+    MemoryMapperInvalidateTranslationCache();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
     return TRUE;
@@ -148,6 +150,7 @@ ScriptEngineFunctionEb(UINT64 Address, BYTE Value, BOOL * HasError)
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
     MemoryMapperWriteMemorySafeOnTargetProcess(Address, &Value, sizeof(BYTE));
+    MemoryMapperInvalidateTranslationCache();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
     return TRUE;
@@ -190,6 +193,7 @@ ScriptEngineFunctionEqPa(UINT64 Address, QWORD Value, BOOL * HasError)
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
     MemoryMapperWriteMemorySafeByPhysicalAddress(Address, (UINT64)&Value, sizeof(QWORD));
+    MemoryMapperInvalidateTranslationCache();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
     return TRUE;
@@ -232,6 +236,7 @@ ScriptEngineFunctionEdPa(UINT64 Address, DWORD Value, BOOL * HasError)
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
     MemoryMapperWriteMemorySafeByPhysicalAddress(Address, (UINT64)&Value, sizeof(DWORD));
+    MemoryMapperInvalidateTranslationCache();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
     return TRUE;
@@ -274,6 +279,7 @@ ScriptEngineFunctionEbPa(UINT64 Address, BYTE Value, BOOL * HasError)
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
     MemoryMapperWriteMemorySafeByPhysicalAddress(Address, (UINT64)&Value, sizeof(BYTE));
+    MemoryMapperInvalidateTranslationCache();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
     return TRUE;
@@ -322,9 +328,6 @@ ScriptEngineFunctionCheckAddress(UINT64 Address, UINT32 Length)
 VOID
 ScriptEngineFunctionMemcpy(UINT64 Destination, UINT64 Source, UINT32 Num, BOOL * HasError)
 {
-    UINT64 PrevReadLen                                              = 0;
-    BYTE   MovingBuffer[DebuggerScriptEngineMemcpyMovingBufferSize] = {0};
-
     //
     // Reject zero-length copies: a Num of 0 would pass address-range
     // validation vacuously (checking 0 bytes at any mapped page succeeds),
@@ -384,57 +387,13 @@ ScriptEngineFunctionMemcpy(UINT64 Destination, UINT64 Source, UINT32 Num, BOOL *
     }
 
     //
-    // Address is valid, perform the memcpy in kernel-mode (VMX-root mode)
+    // Address is valid, perform the memcpy in kernel-mode (VMX-root mode), the
+    // pages are mapped once and copied directly (it also invalidates the
+    // translation cache as the written memory might be the paging structures)
     //
-    while (Num > 0)
+    if (!MemoryMapperCopyMemorySafeOnTargetProcess(Destination, Source, Num))
     {
-        //
-        // Check the target buffer size
-        //
-        if (Num > DebuggerScriptEngineMemcpyMovingBufferSize)
-        {
-            //
-            // *** The size of read buffer is greater to maximum the moving buffer size ***
-            //
-
-            //
-            // Read memory into the buffer
-            //
-            MemoryMapperReadMemorySafeOnTargetProcess(Source + PrevReadLen, MovingBuffer, DebuggerScriptEngineMemcpyMovingBufferSize);
-
-            //
-            // Write the moving buffer into the target buffer
-            //
-            MemoryMapperWriteMemorySafeOnTargetProcess(Destination + PrevReadLen, MovingBuffer, DebuggerScriptEngineMemcpyMovingBufferSize);
-
-            //
-            // Computing the bytes that we read
-            //
-            PrevReadLen += DebuggerScriptEngineMemcpyMovingBufferSize;
-            Num -= DebuggerScriptEngineMemcpyMovingBufferSize;
-        }
-        else
-        {
-            //
-            // *** The size of read buffer is lower than or equal to the moving buffer size ***
-            //
-
-            //
-            // Read memory into the buffer
-            //
-            MemoryMapperReadMemorySafeOnTargetProcess(Source + PrevReadLen, MovingBuffer, Num);
-
-            //
-            // Write the moving buffer into the target buffer
-            //
-            MemoryMapperWriteMemorySafeOnTargetProcess(Destination + PrevReadLen, MovingBuffer, Num);
-
-            //
-            // Computing the bytes that we gonna read
-            //
-            PrevReadLen += Num;
-            Num = 0; // or Num -= Num;
-        }
+        *HasError = TRUE;
     }
 
 #endif // SCRIPT_ENGINE_KERNEL_MODE
@@ -539,6 +498,11 @@ ScriptEngineFunctionMemcpyPa(UINT64 Destination, UINT64 Source, UINT32 Num, BOOL
         }
     }
 
+    //
+    // The written memory might be the paging structures
+    //
+    MemoryMapperInvalidateTranslationCache();
+
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 }
 
@@ -1802,6 +1766,213 @@ ApplyStringFormatSpecifier(const CHAR * CurrentSpecifier, CHAR * FinalBuffer, PU
     return TRUE;
 }
 
+/**
+ * @brief Format an argument of printf by the descriptor of its format specifier
+ * (the text of the format before the specifier is also moved to the buffer)
+ *
+ * @param Format
+ * @param LenOfFormats
+ * @param Symbol the argument (keeps the descriptor of the format specifier)
+ * @param Val
+ * @param FinalBuffer
+ * @param CurrentProcessedPositionFromStartOfFormat
+ * @param CurrentPositionInFinalBuffer
+ * @param SizeOfFinalBuffer
+ * @return BOOLEAN
+ */
+BOOLEAN
+ScriptEngineFormatPrintfArgument(const CHAR * Format,
+                                 UINT32       LenOfFormats,
+                                 PSYMBOL      Symbol,
+                                 UINT64       Val,
+                                 CHAR *       FinalBuffer,
+                                 PUINT32      CurrentProcessedPositionFromStartOfFormat,
+                                 PUINT32      CurrentPositionInFinalBuffer,
+                                 UINT32       SizeOfFinalBuffer)
+{
+    UINT32  Position           = (UINT32)(Symbol->Type >> SYMBOL_FORMAT_SPECIFIER_POSITION_SHIFT) & SYMBOL_FORMAT_SPECIFIER_POSITION_MASK;
+    UINT32  SpecifierLength    = (UINT32)(Symbol->Type >> SYMBOL_FORMAT_SPECIFIER_LENGTH_SHIFT) & SYMBOL_FORMAT_SPECIFIER_LENGTH_MASK;
+    UINT64  SpecifierKind      = Symbol->Type >> SYMBOL_FORMAT_SPECIFIER_KIND_SHIFT;
+    UINT64  BaseType           = Symbol->Type & 0xffffffffULL;
+    CHAR    FormatSpecifier[5] = {0};
+    BOOLEAN IsFloatingValue;
+
+    if (Position < *CurrentProcessedPositionFromStartOfFormat ||
+        SpecifierLength < 2 ||
+        SpecifierLength >= sizeof(FormatSpecifier) ||
+        Position + SpecifierLength >= LenOfFormats ||
+        Format[Position] != '%')
+    {
+        return FALSE;
+    }
+
+    if (*CurrentProcessedPositionFromStartOfFormat != Position)
+    {
+        //
+        // There is some strings before this format specifier
+        // we should move it to the buffer
+        //
+        UINT32 StringLen = Position - *CurrentProcessedPositionFromStartOfFormat;
+
+        //
+        // Check final buffer capacity
+        //
+        if (*CurrentPositionInFinalBuffer + StringLen >= SizeOfFinalBuffer)
+        {
+            return FALSE;
+        }
+
+        memcpy(&FinalBuffer[*CurrentPositionInFinalBuffer],
+               &Format[*CurrentProcessedPositionFromStartOfFormat],
+               StringLen);
+
+        *CurrentProcessedPositionFromStartOfFormat += StringLen;
+        *CurrentPositionInFinalBuffer += StringLen;
+    }
+
+    //
+    // Apply the specifier
+    //
+    memcpy(FormatSpecifier, &Format[Position], SpecifierLength);
+
+    IsFloatingValue = BaseType != SYMBOL_STRING_TYPE && BaseType != SYMBOL_WSTRING_TYPE &&
+                      (Symbol->Len == SYMBOL_VALUE_KIND_FLOAT32 || Symbol->Len == SYMBOL_VALUE_KIND_FLOAT64);
+
+    if (SpecifierKind == FORMAT_SPECIFIER_KIND_FLOAT)
+    {
+        return IsFloatingValue &&
+               ApplyFloatingFormatSpecifier(FinalBuffer,
+                                            CurrentProcessedPositionFromStartOfFormat,
+                                            CurrentPositionInFinalBuffer,
+                                            Val,
+                                            Symbol->Len,
+                                            SizeOfFinalBuffer);
+    }
+    else if (IsFloatingValue)
+    {
+        return FALSE;
+    }
+
+    switch (SpecifierKind)
+    {
+    case FORMAT_SPECIFIER_KIND_INTEGER:
+
+        return ApplyFormatSpecifier(FormatSpecifier,
+                                    FinalBuffer,
+                                    CurrentProcessedPositionFromStartOfFormat,
+                                    CurrentPositionInFinalBuffer,
+                                    Val,
+                                    SizeOfFinalBuffer);
+
+    case FORMAT_SPECIFIER_KIND_STRING:
+    case FORMAT_SPECIFIER_KIND_WSTRING:
+
+        //
+        // for wide string (not important if %ls or %ws , only the length is
+        // important)
+        //
+        return ApplyStringFormatSpecifier(FormatSpecifier,
+                                          FinalBuffer,
+                                          CurrentProcessedPositionFromStartOfFormat,
+                                          CurrentPositionInFinalBuffer,
+                                          Val,
+                                          SpecifierKind == FORMAT_SPECIFIER_KIND_WSTRING,
+                                          SizeOfFinalBuffer);
+
+    default:
+
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Move the text of the format after the last format specifier of printf
+ * to the buffer (the whole format if there is no format specifier)
+ *
+ * @param Format
+ * @param LenOfFormats
+ * @param FinalBuffer
+ * @param CurrentProcessedPositionFromStartOfFormat
+ * @param CurrentPositionInFinalBuffer
+ * @param SizeOfFinalBuffer
+ * @return BOOLEAN
+ */
+BOOLEAN
+ScriptEngineFormatPrintfRemainder(const CHAR * Format,
+                                  UINT32       LenOfFormats,
+                                  CHAR *       FinalBuffer,
+                                  UINT32       CurrentProcessedPositionFromStartOfFormat,
+                                  UINT32       CurrentPositionInFinalBuffer,
+                                  UINT32       SizeOfFinalBuffer)
+{
+    if (LenOfFormats > CurrentProcessedPositionFromStartOfFormat)
+    {
+        UINT32 RemainedLen = LenOfFormats - CurrentProcessedPositionFromStartOfFormat;
+
+        //
+        // Check final buffer capacity
+        //
+        if (CurrentPositionInFinalBuffer + RemainedLen >= SizeOfFinalBuffer)
+        {
+            return FALSE;
+        }
+
+        memcpy(&FinalBuffer[CurrentPositionInFinalBuffer],
+               &Format[CurrentProcessedPositionFromStartOfFormat],
+               RemainedLen);
+    }
+
+    return TRUE;
+}
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+
+/**
+ * @brief Send the raw values of the arguments of printf to the debugger
+ * (the message is formatted by the debugger)
+ *
+ * @param GuestRegs
+ * @param ActionDetail
+ * @param ScriptGeneralRegisters
+ * @param Tag
+ * @param FormatId
+ * @param ArgCount
+ * @param FirstArg
+ * @return VOID
+ */
+static VOID
+ScriptEngineFunctionPrintfDeferred(PGUEST_REGS                       GuestRegs,
+                                   ACTION_BUFFER *                   ActionDetail,
+                                   SCRIPT_ENGINE_GENERAL_REGISTERS * ScriptGeneralRegisters,
+                                   UINT64                            Tag,
+                                   UINT32                            FormatId,
+                                   UINT64                            ArgCount,
+                                   PSYMBOL                           FirstArg)
+{
+    UINT64                         Message[(sizeof(SCRIPT_DEFERRED_PRINTF_HEADER) / sizeof(UINT64)) + SCRIPT_DEFERRED_PRINTF_MAXIMUM_ARGUMENTS];
+    PSCRIPT_DEFERRED_PRINTF_HEADER Header = (PSCRIPT_DEFERRED_PRINTF_HEADER)Message;
+    UINT64 *                       Values = &Message[sizeof(SCRIPT_DEFERRED_PRINTF_HEADER) / sizeof(UINT64)];
+
+    Header->Indicator = SCRIPT_DEFERRED_PRINTF_INDICATOR;
+    Header->FormatId  = FormatId;
+
+    for (UINT64 i = 0; i < ArgCount; i++)
+    {
+        SYMBOL TempSymbol = {0};
+        memcpy(&TempSymbol, FirstArg + i, sizeof(SYMBOL));
+        TempSymbol.Type &= 0x7fffffff;
+
+        Values[i] = GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, &TempSymbol, FALSE);
+    }
+
+    LogSimpleWithTag((UINT32)Tag,
+                     TRUE,
+                     (CHAR *)Message,
+                     (UINT32)(sizeof(SCRIPT_DEFERRED_PRINTF_HEADER) + ArgCount * sizeof(UINT64)));
+}
+
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+
 /**
  * @brief Implementation of printf function
  *
@@ -1811,6 +1982,7 @@ ApplyStringFormatSpecifier(const CHAR * CurrentSpecifier, CHAR * FinalBuffer, PU
  * @param Tag
  * @param ImmediateMessagePassing
  * @param Format
+ * @param FormatId id of the format in the debugger (zero if it's not deferred)
  * @param ArgCount
  * @param FirstArg
  * @param HasError
@@ -1823,6 +1995,7 @@ ScriptEngineFunctionPrintf(PGUEST_REGS                       GuestRegs,
                            UINT64                            Tag,
                            BOOLEAN                           ImmediateMessagePassing,
                            char *                            Format,
+                           UINT32                            FormatId,
                            UINT64                            ArgCount,
                            PSYMBOL                           FirstArg,
                            BOOLEAN *                         HasError)
@@ -1831,267 +2004,149 @@ ScriptEngineFunctionPrintf(PGUEST_REGS                       GuestRegs,
     // *** The printf function ***
     //
 
-    char    FinalBuffer[PacketChunkSize]              = {0};
-    UINT32  CurrentPositionInFinalBuffer              = 0;
-    UINT32  CurrentProcessedPositionFromStartOfFormat = 0;
-    BOOLEAN WithoutAnyFormatSpecifier                 = TRUE;
-
-    UINT64  Val;
-    UINT32  Position;
-    UINT32  LenOfFormats = (UINT32)strlen(Format) + 1;
-    PSYMBOL Symbol;
-
     *HasError = FALSE;
 
-    for (int i = 0; i < ArgCount; i++)
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+
+    //
+    // The debugger checked the format specifiers of the deferred formats, so
+    // only the values are sent (the non-immediate messages are concatenated,
+    // so they are formatted here)
+    //
+    if (FormatId != 0 && ImmediateMessagePassing && ArgCount <= SCRIPT_DEFERRED_PRINTF_MAXIMUM_ARGUMENTS)
     {
-        WithoutAnyFormatSpecifier = FALSE;
-        Symbol                    = FirstArg + i;
+        ScriptEngineFunctionPrintfDeferred(GuestRegs, ActionDetail, ScriptGeneralRegisters, Tag, FormatId, ArgCount, FirstArg);
+        return;
+    }
 
-        //
-        // Address is either wstring (%ws) or string (%s)
-        //
+#else
+
+    UNREFERENCED_PARAMETER(FormatId);
+
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+
+    char   FinalBuffer[PacketChunkSize]              = {0};
+    UINT32 CurrentPositionInFinalBuffer              = 0;
+    UINT32 CurrentProcessedPositionFromStartOfFormat = 0;
+    UINT32 LenOfFormats                              = (UINT32)strlen(Format) + 1;
+
+    for (UINT64 i = 0; i < ArgCount; i++)
+    {
+        SYMBOL TempSymbol = {0};
+        memcpy(&TempSymbol, FirstArg + i, sizeof(SYMBOL));
+        TempSymbol.Type &= 0x7fffffff;
 
-        Position = (Symbol->Type >> 32) + 1;
+        UINT64 Val = GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, &TempSymbol, FALSE);
 
-        if (Position < CurrentProcessedPositionFromStartOfFormat || Position + 1 >= LenOfFormats)
+        if (!ScriptEngineFormatPrintfArgument(Format,
+                                              LenOfFormats,
+                                              FirstArg + i,
+                                              Val,
+                                              FinalBuffer,
+                                              &CurrentProcessedPositionFromStartOfFormat,
+                                              &CurrentPositionInFinalBuffer,
+                                              sizeof(FinalBuffer)))
         {
             *HasError = TRUE;
             return;
         }
+    }
 
-        SYMBOL TempSymbol = {0};
-        memcpy(&TempSymbol, Symbol, sizeof(SYMBOL));
-        TempSymbol.Type &= 0x7fffffff;
-
-        Val = GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, &TempSymbol, FALSE);
+    if (!ScriptEngineFormatPrintfRemainder(Format,
+                                           LenOfFormats,
+                                           FinalBuffer,
+                                           CurrentProcessedPositionFromStartOfFormat,
+                                           CurrentPositionInFinalBuffer,
+                                           sizeof(FinalBuffer)))
+    {
+        *HasError = TRUE;
+        return;
+    }
 
-        CHAR PercentageChar = Format[Position];
+//
+// Print final result
+//
+#ifdef SCRIPT_ENGINE_USER_MODE
+    ShowMessages("%s", FinalBuffer);
+#endif // SCRIPT_ENGINE_USER_MODE
 
-        // printf("position = %d is %c%c \n", Position, PercentageChar, IndicatorChar1);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
 
-        if (CurrentProcessedPositionFromStartOfFormat != Position)
-        {
-            //
-            // There is some strings before this format specifier
-            // we should move it to the buffer
-            //
-            UINT32 StringLen = Position - CurrentProcessedPositionFromStartOfFormat;
+    //
+    // Prepare a buffer to bypass allocating a huge stack space for logging
+    //
+    LogSimpleWithTag((UINT32)Tag, ImmediateMessagePassing, FinalBuffer, (UINT32)strlen(FinalBuffer) + 1);
 
-            //
-            // Check final buffer capacity
-            //
-            if (CurrentPositionInFinalBuffer + StringLen < sizeof(FinalBuffer))
-            {
-                memcpy(&FinalBuffer[CurrentPositionInFinalBuffer],
-                       &Format[CurrentProcessedPositionFromStartOfFormat],
-                       StringLen);
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+}
 
-                CurrentProcessedPositionFromStartOfFormat += StringLen;
-                CurrentPositionInFinalBuffer += StringLen;
-            }
-            else
-            {
-                *HasError = TRUE;
-                return;
-            }
-        }
+/**
+ * @brief Implementation of emit function
+ * @details A binary record (SCRIPT_EMIT_RECORD_HEADER followed by the raw
+ * 64-bit values of the arguments) is sent to the debugger
+ *
+ * @param GuestRegs
+ * @param ActionDetail
+ * @param ScriptGeneralRegisters
+ * @param Tag
+ * @param ArgCount
+ * @param FirstArg
+ * @return VOID
+ */
+VOID
+ScriptEngineFunctionEmit(PGUEST_REGS                       GuestRegs,
+                         ACTION_BUFFER *                   ActionDetail,
+                         SCRIPT_ENGINE_GENERAL_REGISTERS * ScriptGeneralRegisters,
+                         UINT64                            Tag,
+                         UINT64                            ArgCount,
+                         PSYMBOL                           FirstArg)
+{
+    UINT64                     Message[(sizeof(SCRIPT_EMIT_RECORD_HEADER) / sizeof(UINT64)) + SCRIPT_EMIT_RECORD_MAXIMUM_ARGUMENTS];
+    PSCRIPT_EMIT_RECORD_HEADER Header = (PSCRIPT_EMIT_RECORD_HEADER)Message;
+    UINT64 *                   Values = &Message[sizeof(SCRIPT_EMIT_RECORD_HEADER) / sizeof(UINT64)];
 
-        //
-        // Double check and apply
-        //
-        if (PercentageChar == '%')
-        {
-            //
-            // Set first character of specifier
-            //
-            CHAR FormatSpecifier[5] = {0};
-            FormatSpecifier[0]      = '%';
+    Header->Indicator = 0;
+    Header->Signature = SCRIPT_EMIT_RECORD_SIGNATURE;
+    Header->Tag       = Tag;
+    Header->Tsc       = ScriptEngineFunctionRdtsc();
+    Header->ArgCount  = (UINT32)ArgCount;
 
-            //
-            // Read second char
-            //
-            CHAR IndicatorChar2 = Format[Position + 1];
+    for (UINT64 i = 0; i < ArgCount; i++)
+    {
+        SYMBOL TempSymbol = {0};
+        memcpy(&TempSymbol, FirstArg + i, sizeof(SYMBOL));
+        TempSymbol.Type &= 0x7fffffff;
 
-            //
-            // Check if IndicatorChar2 is 2 character long or more
-            //
-            if (IndicatorChar2 == 'l' || IndicatorChar2 == 'w' ||
-                IndicatorChar2 == 'h')
-            {
-                if (Position + 2 >= LenOfFormats)
-                {
-                    *HasError = TRUE;
-                    return;
-                }
+        Values[i] = GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, &TempSymbol, FALSE);
+    }
 
-                //
-                // Set second char in format specifier
-                //
-                FormatSpecifier[1] = IndicatorChar2;
-
-                if (IndicatorChar2 == 'l' && Format[Position + 2] == 'l')
-                {
-                    if (Position + 3 >= LenOfFormats)
-                    {
-                        *HasError = TRUE;
-                        return;
-                    }
-
-                    //
-                    // Set third character in format specifier "ll"
-                    //
-                    FormatSpecifier[2] = 'l';
-
-                    //
-                    // Set last character
-                    //
-                    FormatSpecifier[3] = Format[Position + 3];
-                }
-                else
-                {
-                    //
-                    // Set last character
-                    //
-                    FormatSpecifier[2] = Format[Position + 2];
-                }
-            }
-            else
-            {
-                //
-                // It's a one char specifier (Set last character)
-                //
-                FormatSpecifier[1] = IndicatorChar2;
-            }
+#ifdef SCRIPT_ENGINE_USER_MODE
 
-            //
-            // Apply the specifier
-            //
-            UINT64 BaseType = TempSymbol.Type & 0xffffffffULL;
-            BOOLEAN IsFloatingValue =
-                BaseType != SYMBOL_STRING_TYPE && BaseType != SYMBOL_WSTRING_TYPE &&
-                (Symbol->Len == SYMBOL_VALUE_KIND_FLOAT32 || Symbol->Len == SYMBOL_VALUE_KIND_FLOAT64);
+    Header->Core = 0;
 
-            if (!strncmp(FormatSpecifier, "%f", 2))
-            {
-                if (!IsFloatingValue ||
-                    !ApplyFloatingFormatSpecifier(FinalBuffer,
-                                                  &CurrentProcessedPositionFromStartOfFormat,
-                                                  &CurrentPositionInFinalBuffer,
-                                                  Val,
-                                                  Symbol->Len,
-                                                  sizeof(FinalBuffer)))
-                {
-                    *HasError = TRUE;
-                    return;
-                }
-            }
-            else if (IsFloatingValue)
-            {
-                *HasError = TRUE;
-                return;
-            }
-            else if (!strncmp(FormatSpecifier, "%s", 2))
-            {
-                //
-                // for string
-                //
-                if (!ApplyStringFormatSpecifier(
-                        "%s",
-                        FinalBuffer,
-                        &CurrentProcessedPositionFromStartOfFormat,
-                        &CurrentPositionInFinalBuffer,
-                        Val,
-                        FALSE,
-                        sizeof(FinalBuffer)))
-                {
-                    *HasError = TRUE;
-                    return;
-                }
-            }
-            else if (!strncmp(FormatSpecifier, "%ls", 3) ||
-                     !strncmp(FormatSpecifier, "%ws", 3))
-            {
-                //
-                // for wide string (not important if %ls or %ws , only the length is
-                // important)
-                //
-                if (!ApplyStringFormatSpecifier(
-                        "%ws",
-                        FinalBuffer,
-                        &CurrentProcessedPositionFromStartOfFormat,
-                        &CurrentPositionInFinalBuffer,
-                        Val,
-                        TRUE,
-                        sizeof(FinalBuffer)))
-                {
-                    *HasError = TRUE;
-                    return;
-                }
-            }
-            else
-            {
-                if (!ApplyFormatSpecifier(FormatSpecifier, FinalBuffer, &CurrentProcessedPositionFromStartOfFormat, &CurrentPositionInFinalBuffer, Val, sizeof(FinalBuffer)))
-                {
-                    *HasError = TRUE;
-                    return;
-                }
-            }
-        }
-    }
+    ShowMessages("emit (tag: %llx, tsc: %llx, core: %x) :", Header->Tag, Header->Tsc, Header->Core);
 
-    if (WithoutAnyFormatSpecifier)
+    for (UINT64 i = 0; i < ArgCount; i++)
     {
-        //
-        // Means that it's just a simple print without any format specifier
-        //
-        if (LenOfFormats < sizeof(FinalBuffer))
-        {
-            memcpy(FinalBuffer, Format, LenOfFormats);
-        }
-        else
-        {
-            *HasError = TRUE;
-            return;
-        }
+        ShowMessages(" %llx", Values[i]);
     }
-    else
-    {
-        //
-        // Check if there is anything after the last format specifier
-        //
-        if (LenOfFormats > CurrentProcessedPositionFromStartOfFormat)
-        {
-            UINT32 RemainedLen =
-                LenOfFormats - CurrentProcessedPositionFromStartOfFormat;
 
-            if (CurrentPositionInFinalBuffer + RemainedLen < sizeof(FinalBuffer))
-            {
-                memcpy(&FinalBuffer[CurrentPositionInFinalBuffer],
-                       &Format[CurrentProcessedPositionFromStartOfFormat],
-                       RemainedLen);
-            }
-            else
-            {
-                *HasError = TRUE;
-                return;
-            }
-        }
-    }
+    ShowMessages("\n");
 
-//
-// Print final result
-//
-#ifdef SCRIPT_ENGINE_USER_MODE
-    ShowMessages("%s", FinalBuffer);
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
 
+    Header->Core = KeGetCurrentProcessorNumberEx(NULL);
+
     //
-    // Prepare a buffer to bypass allocating a huge stack space for logging
+    // The non-immediate messages are concatenated in the buffers of the
+    // debugger, so the records are always sent immediately
     //
-    LogSimpleWithTag((UINT32)Tag, ImmediateMessagePassing, FinalBuffer, (UINT32)strlen(FinalBuffer) + 1);
+    LogSimpleWithTag((UINT32)Tag,
+                     TRUE,
+                     (CHAR *)Message,
+                     (UINT32)(sizeof(SCRIPT_EMIT_RECORD_HEADER) + ArgCount * sizeof(UINT64)));
 
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 }
@@ -2171,6 +2226,50 @@ ScriptEngineFunctionEventInjectErrorCode(UINT32 InterruptionType, UINT32 Vector,
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 }
 
+/**
+ * @brief Implementation of agg_count, agg_sum, agg_min, agg_max and agg_hist functions
+ * @details The aggregations are kept in the table of the current core and
+ * the debugger merges the tables of all cores
+ *
+ * @param Type Type of the aggregation (SCRIPT_ENGINE_AGGREGATION_TYPE)
+ * @param Key
+ * @param Value
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineFunctionAggregate(UINT32 Type, UINT64 Key, UINT64 Value)
+{
+#ifdef SCRIPT_ENGINE_USER_MODE
+
+    UNREFERENCED_PARAMETER(Type);
+    UNREFERENCED_PARAMETER(Key);
+    UNREFERENCED_PARAMETER(Value);
+
+    ShowMessages("err, aggregation functions are not supported in user-mode\n");
+
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+
+    UINT32 Bucket = 0;
+
+    if (Type == SCRIPT_ENGINE_AGGREGATION_TYPE_HISTOGRAM)
+    {
+        //
+        // Power-of-two buckets, the value of bucket n is in [2^(n-1), 2^n)
+        //
+        for (; Value != 0; Value >>= 1)
+        {
+            Bucket++;
+        }
+    }
+
+    ScriptEngineAggregationUpdate(Type, Key, Bucket, Value);
+
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+}
+
 /**
  * @brief Implementation of strcmp function
  *
@@ -34,9 +34,13 @@ ScriptEngineKeywordPoi(PUINT64 Address, BOOL * HasError)
 {
     UINT64 Result = (UINT64)NULL;
 
+#ifdef SCRIPT_ENGINE_USER_MODE
+    Result = *Address;
+#endif // SCRIPT_ENGINE_USER_MODE
+
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
 
-    if (!CheckAccessValidityAndSafety((UINT64)Address, sizeof(UINT64)))
+    if (!MemoryMapperReadMemorySafeOnTargetProcessCached((UINT64)Address, &Result, sizeof(UINT64)))
     {
         *HasError = TRUE;
 
@@ -45,14 +49,6 @@ ScriptEngineKeywordPoi(PUINT64 Address, BOOL * HasError)
 
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-    Result = *Address;
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-    MemoryMapperReadMemorySafeOnTargetProcess((UINT64)Address, &Result, sizeof(UINT64));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-
     return Result;
 }
 
@@ -68,9 +64,13 @@ ScriptEngineKeywordHi(PUINT64 Address, BOOL * HasError)
 {
     QWORD Result = NULL64_ZERO;
 
+#ifdef SCRIPT_ENGINE_USER_MODE
+    Result = *Address;
+#endif // SCRIPT_ENGINE_USER_MODE
+
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
 
-    if (!CheckAccessValidityAndSafety((UINT64)Address, sizeof(UINT64)))
+    if (!MemoryMapperReadMemorySafeOnTargetProcessCached((UINT64)Address, &Result, sizeof(UINT64)))
     {
         *HasError = TRUE;
 
@@ -79,14 +79,6 @@ ScriptEngineKeywordHi(PUINT64 Address, BOOL * HasError)
 
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-    Result = *Address;
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-    MemoryMapperReadMemorySafeOnTargetProcess((UINT64)Address, &Result, sizeof(UINT64));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-
     return HIWORD(Result);
 }
 
@@ -102,9 +94,13 @@ ScriptEngineKeywordLow(PUINT64 Address, BOOL * HasError)
 {
     QWORD Result = NULL64_ZERO;
 
+#ifdef SCRIPT_ENGINE_USER_MODE
+    Result = *Address;
+#endif // SCRIPT_ENGINE_USER_MODE
+
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
 
-    if (!CheckAccessValidityAndSafety((UINT64)Address, sizeof(UINT64)))
+    if (!MemoryMapperReadMemorySafeOnTargetProcessCached((UINT64)Address, &Result, sizeof(UINT64)))
     {
         *HasError = TRUE;
 
@@ -113,14 +109,6 @@ ScriptEngineKeywordLow(PUINT64 Address, BOOL * HasError)
 
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-    Result = *Address;
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-    MemoryMapperReadMemorySafeOnTargetProcess((UINT64)Address, &Result, sizeof(UINT64));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-
     return LOWORD(Result);
 }
 
@@ -136,9 +124,13 @@ ScriptEngineKeywordDb(PUINT64 Address, BOOL * HasError)
 {
     BYTE Result = NULL_ZERO;
 
+#ifdef SCRIPT_ENGINE_USER_MODE
+    Result = (BYTE)*Address;
+#endif // SCRIPT_ENGINE_USER_MODE
+
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
 
-    if (!CheckAccessValidityAndSafety((UINT64)Address, sizeof(BYTE)))
+    if (!MemoryMapperReadMemorySafeOnTargetProcessCached((UINT64)Address, &Result, sizeof(BYTE)))
     {
         *HasError = TRUE;
 
@@ -147,14 +139,6 @@ ScriptEngineKeywordDb(PUINT64 Address, BOOL * HasError)
 
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-    Result = (BYTE)*Address;
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-    MemoryMapperReadMemorySafeOnTargetProcess((UINT64)Address, &Result, sizeof(BYTE));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-
     return Result;
 }
 
@@ -170,9 +154,13 @@ ScriptEngineKeywordDd(PUINT64 Address, BOOL * HasError)
 {
     DWORD Result = NULL_ZERO;
 
+#ifdef SCRIPT_ENGINE_USER_MODE
+    Result = (DWORD)*Address;
+#endif // SCRIPT_ENGINE_USER_MODE
+
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
 
-    if (!CheckAccessValidityAndSafety((UINT64)Address, sizeof(DWORD)))
+    if (!MemoryMapperReadMemorySafeOnTargetProcessCached((UINT64)Address, &Result, sizeof(DWORD)))
     {
         *HasError = TRUE;
 
@@ -181,14 +169,6 @@ ScriptEngineKeywordDd(PUINT64 Address, BOOL * HasError)
 
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-    Result = (DWORD)*Address;
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-    MemoryMapperReadMemorySafeOnTargetProcess((UINT64)Address, &Result, sizeof(DWORD));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-
     return Result;
 }
 
@@ -204,9 +184,13 @@ ScriptEngineKeywordDw(PUINT64 Address, BOOL * HasError)
 {
     WORD Result = NULL_ZERO;
 
+#ifdef SCRIPT_ENGINE_USER_MODE
+    Result = (WORD)*Address;
+#endif // SCRIPT_ENGINE_USER_MODE
+
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
 
-    if (!CheckAccessValidityAndSafety((UINT64)Address, sizeof(WORD)))
+    if (!MemoryMapperReadMemorySafeOnTargetProcessCached((UINT64)Address, &Result, sizeof(WORD)))
     {
         *HasError = TRUE;
 
@@ -215,14 +199,6 @@ ScriptEngineKeywordDw(PUINT64 Address, BOOL * HasError)
 
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-    Result = (WORD)*Address;
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-    MemoryMapperReadMemorySafeOnTargetProcess((UINT64)Address, &Result, sizeof(WORD));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-
     return Result;
 }
 
@@ -238,9 +214,13 @@ ScriptEngineKeywordDq(PUINT64 Address, BOOL * HasError)
 {
     QWORD Result = (QWORD)NULL;
 
+#ifdef SCRIPT_ENGINE_USER_MODE
+    Result = *Address;
+#endif // SCRIPT_ENGINE_USER_MODE
+
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
 
-    if (!CheckAccessValidityAndSafety((UINT64)Address, sizeof(DWORD)))
+    if (!MemoryMapperReadMemorySafeOnTargetProcessCached((UINT64)Address, &Result, sizeof(QWORD)))
     {
         *HasError = TRUE;
 
@@ -249,14 +229,6 @@ ScriptEngineKeywordDq(PUINT64 Address, BOOL * HasError)
 
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-    Result = *Address;
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-    MemoryMapperReadMemorySafeOnTargetProcess((UINT64)Address, &Result, sizeof(QWORD));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-
     return Result;
 }
 
@@ -13,6 +13,10 @@
 #include "pch.h"
 #include "../script-eval/header/ScriptEngineInternalHeader.h"
 
+#if defined(SCRIPT_ENGINE_USER_MODE) && defined(HYPERDBG_LIBHYPERDBG)
+extern BOOLEAN g_HwdbgInstanceInfoIsValid;
+#endif // defined(SCRIPT_ENGINE_USER_MODE) && defined(HYPERDBG_LIBHYPERDBG)
+
 static BOOLEAN
 ScriptEngineTypedLocalRangeIsValid(PSCRIPT_ENGINE_GENERAL_REGISTERS Registers, UINT64 Address, UINT32 Size)
 {
@@ -40,21 +44,117 @@ ScriptEngineTransferMemory(PSCRIPT_ENGINE_GENERAL_REGISTERS Registers,
         return TRUE;
     }
 
-    if (AddressSpace != SCRIPT_ENGINE_ADDRESS_SPACE_REMOTE ||
-        !CheckAccessValidityAndSafety(Address, Size))
+    if (AddressSpace != SCRIPT_ENGINE_ADDRESS_SPACE_REMOTE)
         return FALSE;
 
 #ifdef SCRIPT_ENGINE_USER_MODE
+    if (!CheckAccessValidityAndSafety(Address, Size))
+        return FALSE;
     if (Write)
         memcpy((PVOID)Address, Buffer, Size);
     else
         memcpy(Buffer, (PVOID)Address, Size);
 #endif
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-    if (Write)
-        MemoryMapperWriteMemorySafeOnTargetProcess(Address, Buffer, Size);
-    else
-        MemoryMapperReadMemorySafeOnTargetProcess(Address, Buffer, Size);
+    //
+    // Reads are translated by the translation cache of the core, a write
+    // might change the paging structures, so it invalidates the cache
+    //
+    if (!Write)
+        return MemoryMapperReadMemorySafeOnTargetProcessCached(Address, Buffer, Size);
+    if (!CheckAccessValidityAndSafety(Address, Size))
+        return FALSE;
+    MemoryMapperWriteMemorySafeOnTargetProcess(Address, Buffer, Size);
+    MemoryMapperInvalidateTranslationCache();
+#endif
+    return TRUE;
+}
+
+//
+// Aggregates are moved in a single transfer, so a remote buffer is validated
+// once (once per page in the kernel) instead of once per chunk of a bounce
+// buffer
+//
+static BOOLEAN
+ScriptEngineCopyMemory(PSCRIPT_ENGINE_GENERAL_REGISTERS Registers,
+                       UINT64 Destination,
+                       UINT64 DestinationSpace,
+                       UINT64 Source,
+                       UINT64 SourceSpace,
+                       UINT64 Size)
+{
+    if (Size == 0)
+        return TRUE;
+    if (Size > 0xffffffffULL)
+        return FALSE;
+
+    if (SourceSpace == SCRIPT_ENGINE_ADDRESS_SPACE_LOCAL && DestinationSpace == SCRIPT_ENGINE_ADDRESS_SPACE_LOCAL)
+    {
+        if (!ScriptEngineTypedLocalRangeIsValid(Registers, Source, (UINT32)Size) ||
+            !ScriptEngineTypedLocalRangeIsValid(Registers, Destination, (UINT32)Size))
+            return FALSE;
+        memmove((PVOID)Destination, (PVOID)Source, (SIZE_T)Size);
+        return TRUE;
+    }
+
+    if (SourceSpace == SCRIPT_ENGINE_ADDRESS_SPACE_LOCAL)
+    {
+        if (!ScriptEngineTypedLocalRangeIsValid(Registers, Source, (UINT32)Size))
+            return FALSE;
+        return ScriptEngineTransferMemory(Registers, Destination, DestinationSpace, (PVOID)Source, (UINT32)Size, TRUE);
+    }
+
+    if (DestinationSpace == SCRIPT_ENGINE_ADDRESS_SPACE_LOCAL)
+    {
+        if (!ScriptEngineTypedLocalRangeIsValid(Registers, Destination, (UINT32)Size))
+            return FALSE;
+        return ScriptEngineTransferMemory(Registers, Source, SourceSpace, (PVOID)Destination, (UINT32)Size, FALSE);
+    }
+
+    if (SourceSpace != SCRIPT_ENGINE_ADDRESS_SPACE_REMOTE || DestinationSpace != SCRIPT_ENGINE_ADDRESS_SPACE_REMOTE)
+        return FALSE;
+
+#ifdef SCRIPT_ENGINE_USER_MODE
+    if (!CheckAccessValidityAndSafety(Source, (UINT32)Size) ||
+        !CheckAccessValidityAndSafety(Destination, (UINT32)Size))
+        return FALSE;
+    memmove((PVOID)Destination, (PVOID)Source, (SIZE_T)Size);
+#endif
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+    return MemoryMapperCopyMemorySafeOnTargetProcess(Destination, Source, (SIZE_T)Size);
+#endif
+    return TRUE;
+}
+
+static BOOLEAN
+ScriptEngineZeroMemory(PSCRIPT_ENGINE_GENERAL_REGISTERS Registers,
+                       UINT64 Destination,
+                       UINT64 DestinationSpace,
+                       UINT64 Size)
+{
+    if (Size == 0)
+        return TRUE;
+    if (Size > 0xffffffffULL)
+        return FALSE;
+
+    if (DestinationSpace == SCRIPT_ENGINE_ADDRESS_SPACE_LOCAL)
+    {
+        if (!ScriptEngineTypedLocalRangeIsValid(Registers, Destination, (UINT32)Size))
+            return FALSE;
+        memset((PVOID)Destination, 0, (SIZE_T)Size);
+        return TRUE;
+    }
+
+    if (DestinationSpace != SCRIPT_ENGINE_ADDRESS_SPACE_REMOTE)
+        return FALSE;
+
+#ifdef SCRIPT_ENGINE_USER_MODE
+    if (!CheckAccessValidityAndSafety(Destination, (UINT32)Size))
+        return FALSE;
+    memset((PVOID)Destination, 0, (SIZE_T)Size);
+#endif
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+    return MemoryMapperZeroMemorySafeOnTargetProcess(Destination, (SIZE_T)Size);
 #endif
     return TRUE;
 }
@@ -798,6 +898,12 @@ static INT32
 ScriptEngineSoftFloatCompare(const SCRIPT_ENGINE_SOFT_FLOAT * Left, const SCRIPT_ENGINE_SOFT_FLOAT * Right)
 {
     if (Left->IsZero && Right->IsZero) return 0;
+    //
+    // The exponent of a zero is the minimum exponent, which is larger than the
+    // exponents of the normalized subnormals
+    //
+    if (Left->IsZero) return Right->Negative ? 1 : -1;
+    if (Right->IsZero) return Left->Negative ? -1 : 1;
     if (Left->Negative != Right->Negative) return Left->Negative ? -1 : 1;
 
     INT32 Magnitude;
@@ -808,14 +914,28 @@ ScriptEngineSoftFloatCompare(const SCRIPT_ENGINE_SOFT_FLOAT * Left, const SCRIPT
     return Left->Negative ? -Magnitude : Magnitude;
 }
 
-static BOOLEAN
-ScriptEngineExecuteFloatingBinary(UINT64 Opcode,
-                                  UINT64 LeftKind,
-                                  UINT64 LeftBits,
-                                  UINT64 RightKind,
-                                  UINT64 RightBits,
-                                  UINT64 ResultKind,
-                                  PUINT64 Result)
+/**
+ * @brief Execute a floating-point operator by the software-float path
+ * @details Infinities, NaNs, division by zero and overflowed results are
+ * errors, the result is rounded once (to nearest, ties to even)
+ *
+ * @param Opcode
+ * @param LeftKind
+ * @param LeftBits
+ * @param RightKind
+ * @param RightBits
+ * @param ResultKind SYMBOL_VALUE_KIND_INTEGER for comparisons
+ * @param Result
+ * @return BOOLEAN
+ */
+BOOLEAN
+ScriptEngineSoftFloatExecuteBinary(UINT64 Opcode,
+                                   UINT64 LeftKind,
+                                   UINT64 LeftBits,
+                                   UINT64 RightKind,
+                                   UINT64 RightBits,
+                                   UINT64 ResultKind,
+                                   PUINT64 Result)
 {
     SCRIPT_ENGINE_SOFT_FLOAT Left;
     SCRIPT_ENGINE_SOFT_FLOAT Right;
@@ -842,6 +962,121 @@ ScriptEngineExecuteFloatingBinary(UINT64 Opcode,
     return TRUE;
 }
 
+#ifdef SCRIPT_ENGINE_NATIVE_FLOAT
+
+static BOOLEAN
+ScriptEngineNativeFloatLoad(UINT64 ValueKind, UINT64 RawBits, double * Value)
+{
+    if (ValueKind == SYMBOL_VALUE_KIND_FLOAT32)
+    {
+        UINT32 Bits = (UINT32)RawBits;
+        float  Single;
+        if ((Bits & 0x7f800000U) == 0x7f800000U) return FALSE;
+        memcpy(&Single, &Bits, sizeof(Single));
+        *Value = Single;
+        return TRUE;
+    }
+    if (ValueKind == SYMBOL_VALUE_KIND_FLOAT64)
+    {
+        if ((RawBits & 0x7ff0000000000000ULL) == 0x7ff0000000000000ULL) return FALSE;
+        memcpy(Value, &RawBits, sizeof(*Value));
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/**
+ * @brief Execute a floating-point operator by the native float and double
+ * @details The results are bit-exact with ScriptEngineSoftFloatExecuteBinary,
+ * the operands are exact in double, and an operation of two floats in double
+ * is rounded once more to float without a double rounding error (53 >= 2 * 24
+ * + 2 bits), but a float result of a double operand would be rounded twice, so
+ * it is computed by the software-float path
+ *
+ * @param Opcode
+ * @param LeftKind
+ * @param LeftBits
+ * @param RightKind
+ * @param RightBits
+ * @param ResultKind SYMBOL_VALUE_KIND_INTEGER for comparisons
+ * @param Result
+ * @return BOOLEAN
+ */
+BOOLEAN
+ScriptEngineNativeFloatExecuteBinary(UINT64 Opcode,
+                                     UINT64 LeftKind,
+                                     UINT64 LeftBits,
+                                     UINT64 RightKind,
+                                     UINT64 RightBits,
+                                     UINT64 ResultKind,
+                                     PUINT64 Result)
+{
+    double Left;
+    double Right;
+    double Value;
+
+    if (!ScriptEngineNativeFloatLoad(LeftKind, LeftBits, &Left) ||
+        !ScriptEngineNativeFloatLoad(RightKind, RightBits, &Right)) return FALSE;
+
+    switch (Opcode)
+    {
+    case FUNC_ADD_FLOAT: Value = Left + Right; break;
+    case FUNC_SUB_FLOAT: Value = Left - Right; break;
+    case FUNC_MUL_FLOAT: Value = Left * Right; break;
+    case FUNC_DIV_FLOAT:
+        if (Right == 0.0) return FALSE;
+        Value = Left / Right;
+        break;
+    case FUNC_GT_FLOAT: *Result = Left > Right; return TRUE;
+    case FUNC_LT_FLOAT: *Result = Left < Right; return TRUE;
+    case FUNC_EGT_FLOAT: *Result = Left >= Right; return TRUE;
+    case FUNC_ELT_FLOAT: *Result = Left <= Right; return TRUE;
+    case FUNC_EQUAL_FLOAT: *Result = Left == Right; return TRUE;
+    case FUNC_NEQ_FLOAT: *Result = Left != Right; return TRUE;
+    default: return FALSE;
+    }
+
+    if (ResultKind == SYMBOL_VALUE_KIND_FLOAT32)
+    {
+        UINT32 Bits;
+        float  Single;
+        if (LeftKind != SYMBOL_VALUE_KIND_FLOAT32 || RightKind != SYMBOL_VALUE_KIND_FLOAT32)
+            return ScriptEngineSoftFloatExecuteBinary(Opcode, LeftKind, LeftBits, RightKind, RightBits, ResultKind, Result);
+        Single = (float)Value;
+        memcpy(&Bits, &Single, sizeof(Bits));
+        if ((Bits & 0x7f800000U) == 0x7f800000U) return FALSE;
+        *Result = Bits;
+        return TRUE;
+    }
+    if (ResultKind == SYMBOL_VALUE_KIND_FLOAT64)
+    {
+        UINT64 Bits;
+        memcpy(&Bits, &Value, sizeof(Bits));
+        if ((Bits & 0x7ff0000000000000ULL) == 0x7ff0000000000000ULL) return FALSE;
+        *Result = Bits;
+        return TRUE;
+    }
+    return FALSE;
+}
+
+#endif // SCRIPT_ENGINE_NATIVE_FLOAT
+
+static BOOLEAN
+ScriptEngineExecuteFloatingBinary(UINT64 Opcode,
+                                  UINT64 LeftKind,
+                                  UINT64 LeftBits,
+                                  UINT64 RightKind,
+                                  UINT64 RightBits,
+                                  UINT64 ResultKind,
+                                  PUINT64 Result)
+{
+#ifdef SCRIPT_ENGINE_NATIVE_FLOAT
+    return ScriptEngineNativeFloatExecuteBinary(Opcode, LeftKind, LeftBits, RightKind, RightBits, ResultKind, Result);
+#else
+    return ScriptEngineSoftFloatExecuteBinary(Opcode, LeftKind, LeftBits, RightKind, RightBits, ResultKind, Result);
+#endif
+}
+
 /**
  * @brief Get the Pseudo reg value
  *
@@ -933,6 +1168,13 @@ GetValue(PGUEST_REGS                      GuestRegs,
         else
             return ScriptGeneralRegisters->GlobalVariablesList[Symbol->Value];
 
+    case SYMBOL_PERCPU_ID_TYPE:
+
+        if (ReturnReference)
+            return ((UINT64)(&ScriptGeneralRegisters->PercpuVariablesList[Symbol->Value]));
+        else
+            return ScriptGeneralRegisters->PercpuVariablesList[Symbol->Value];
+
     case SYMBOL_NUM_TYPE:
 
         if (ReturnReference)
@@ -1021,6 +1263,9 @@ SetValue(PGUEST_REGS                       GuestRegs,
     case SYMBOL_GLOBAL_ID_TYPE:
         ScriptGeneralRegisters->GlobalVariablesList[Symbol->Value] = Value;
         return;
+    case SYMBOL_PERCPU_ID_TYPE:
+        ScriptGeneralRegisters->PercpuVariablesList[Symbol->Value] = Value;
+        return;
     case SYMBOL_REGISTER_TYPE:
         SetRegValueUsingSymbol(GuestRegs, Symbol, Value);
         return;
@@ -1112,7 +1357,7 @@ ScriptEngineGetOperatorName(PSYMBOL OperatorSymbol, CHAR * BufferForName)
 }
 
 /**
- * @brief Execute the script buffer
+ * @brief Execute an operator of the script buffer
  *
  * @param GuestRegs General purpose registers
  * @param ActionDetail Detail of the specific action
@@ -1122,13 +1367,13 @@ ScriptEngineGetOperatorName(PSYMBOL OperatorSymbol, CHAR * BufferForName)
  * @param ErrorOperator Error in operator
  * @return BOOL
  */
-BOOL
-ScriptEngineExecute(PGUEST_REGS                      GuestRegs,
-                    ACTION_BUFFER *                  ActionDetail,
-                    PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters,
-                    SYMBOL_BUFFER *                  CodeBuffer,
-                    UINT64 *                         Indx,
-                    SYMBOL *                         ErrorOperator)
+static BOOL
+ScriptEngineExecuteOperator(PGUEST_REGS                      GuestRegs,
+                            ACTION_BUFFER *                  ActionDetail,
+                            PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters,
+                            SYMBOL_BUFFER *                  CodeBuffer,
+                            UINT64 *                         Indx,
+                            SYMBOL *                         ErrorOperator)
 {
     PSYMBOL Operator;
     PSYMBOL Src0;
@@ -1208,8 +1453,6 @@ ScriptEngineExecute(PGUEST_REGS                      GuestRegs,
 
     case FUNC_AGGREGATE_ZERO:
     {
-        BYTE ZeroBuffer[64] = {0};
-        UINT64 Done = 0;
         if (!ScriptEngineHasOperands(CodeBuffer, *Indx, 3))
         {
             HasError = TRUE;
@@ -1221,21 +1464,13 @@ ScriptEngineExecute(PGUEST_REGS                      GuestRegs,
         SrcVal0 = GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src0, FALSE);
         SrcVal1 = GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src1, FALSE);
         SrcVal2 = GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src2, FALSE);
-        while (Done < SrcVal2 && !HasError)
-        {
-            UINT32 Chunk = (UINT32)((SrcVal2 - Done) > sizeof(ZeroBuffer) ? sizeof(ZeroBuffer) : (SrcVal2 - Done));
-            if (!ScriptEngineTransferMemory(ScriptGeneralRegisters, SrcVal0 + Done, SrcVal1, ZeroBuffer, Chunk, TRUE))
-                HasError = TRUE;
-            Done += Chunk;
-        }
+        if (!ScriptEngineZeroMemory(ScriptGeneralRegisters, SrcVal0, SrcVal1, SrcVal2))
+            HasError = TRUE;
         break;
     }
 
     case FUNC_AGGREGATE_COPY:
     {
-        BYTE MovingBuffer[64];
-        UINT64 Done = 0;
-        BOOLEAN Backward;
         if (!ScriptEngineHasOperands(CodeBuffer, *Indx, 5))
         {
             HasError = TRUE;
@@ -1250,19 +1485,13 @@ ScriptEngineExecute(PGUEST_REGS                      GuestRegs,
         SrcVal1 = GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src1, FALSE);
         SrcVal2 = GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src2, FALSE);
         DesVal  = GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src3, FALSE);
-        {
-            UINT64 Size = GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src4, FALSE);
-            Backward = SrcVal1 == DesVal && SrcVal0 > SrcVal2 && SrcVal0 < SrcVal2 + Size;
-            while (Done < Size && !HasError)
-            {
-                UINT32 Chunk = (UINT32)((Size - Done) > sizeof(MovingBuffer) ? sizeof(MovingBuffer) : (Size - Done));
-                UINT64 Offset = Backward ? Size - Done - Chunk : Done;
-                if (!ScriptEngineTransferMemory(ScriptGeneralRegisters, SrcVal2 + Offset, DesVal, MovingBuffer, Chunk, FALSE) ||
-                    !ScriptEngineTransferMemory(ScriptGeneralRegisters, SrcVal0 + Offset, SrcVal1, MovingBuffer, Chunk, TRUE))
-                    HasError = TRUE;
-                Done += Chunk;
-            }
-        }
+        if (!ScriptEngineCopyMemory(ScriptGeneralRegisters,
+                                    SrcVal0,
+                                    SrcVal1,
+                                    SrcVal2,
+                                    DesVal,
+                                    GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src4, FALSE)))
+            HasError = TRUE;
         break;
     }
 
@@ -1685,6 +1914,36 @@ ScriptEngineExecute(PGUEST_REGS                      GuestRegs,
 
         break;
 
+    case FUNC_AGG_SUM:
+    case FUNC_AGG_MIN:
+    case FUNC_AGG_MAX:
+    case FUNC_AGG_HIST:
+
+        Src0 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src0, FALSE);
+
+        Src1 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src1, FALSE);
+
+        ScriptEngineFunctionAggregate(Operator->Value == FUNC_AGG_SUM ? SCRIPT_ENGINE_AGGREGATION_TYPE_SUM :
+                                      Operator->Value == FUNC_AGG_MIN ? SCRIPT_ENGINE_AGGREGATION_TYPE_MIN :
+                                      Operator->Value == FUNC_AGG_MAX ? SCRIPT_ENGINE_AGGREGATION_TYPE_MAX :
+                                                                        SCRIPT_ENGINE_AGGREGATION_TYPE_HISTOGRAM,
+                                      SrcVal1,
+                                      SrcVal0);
+
+        break;
+
     case FUNC_PAUSE:
 
         ScriptEngineFunctionPause(ActionDetail,
@@ -2690,6 +2949,17 @@ ScriptEngineExecute(PGUEST_REGS                      GuestRegs,
         ScriptEngineFunctionMicroSleep(SrcVal0);
         break;
 
+    case FUNC_AGG_COUNT:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src0, FALSE);
+
+        ScriptEngineFunctionAggregate(SCRIPT_ENGINE_AGGREGATION_TYPE_COUNT, SrcVal0, 0);
+        break;
+
     case FUNC_RDTSC:
 
         Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
@@ -3710,11 +3980,46 @@ ScriptEngineExecute(PGUEST_REGS                      GuestRegs,
             ActionDetail->Tag,
             ActionDetail->ImmediatelySendTheResults,
             (char *)&Src0->Value,
+            (UINT32)(Src1->Type >> SYMBOL_FORMAT_ID_SHIFT),
             Src1->Value,
             Src2,
             (BOOLEAN *)&HasError);
 
         break;
+
+    case FUNC_EMIT:
+
+        if (*Indx >= CodeBuffer->Pointer)
+        {
+            HasError = TRUE;
+            break;
+        }
+
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+
+        if ((Src0->Type & 0xffffffffULL) != SYMBOL_VARIABLE_COUNT_TYPE ||
+            Src0->Value > SCRIPT_EMIT_RECORD_MAXIMUM_ARGUMENTS ||
+            Src0->Value > CodeBuffer->Pointer - *Indx)
+        {
+            HasError = TRUE;
+            break;
+        }
+
+        Src1 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + Src0->Value;
+
+        ScriptEngineFunctionEmit(GuestRegs,
+                                 ActionDetail,
+                                 ScriptGeneralRegisters,
+                                 ActionDetail->Tag,
+                                 Src0->Value,
+                                 Src1);
+
+        break;
     }
 
     //
@@ -3722,3 +4027,1651 @@ ScriptEngineExecute(PGUEST_REGS                      GuestRegs,
     //
     return HasError;
 }
+
+/**
+ * @brief Execute the script buffer
+ * @details If the script is profiled, the execution and the cycles of the
+ * operator are added to the profile entry of its index, the entries might
+ * be updated by the other cores at the same time
+ *
+ * @param GuestRegs General purpose registers
+ * @param ActionDetail Detail of the specific action
+ * @param ScriptGeneralRegisters of core specific (and global) variable holders
+ * @param CodeBuffer The script buffer to be executed
+ * @param Indx Script Buffer index
+ * @param ErrorOperator Error in operator
+ * @return BOOL
+ */
+BOOL
+ScriptEngineExecute(PGUEST_REGS                      GuestRegs,
+                    ACTION_BUFFER *                  ActionDetail,
+                    PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters,
+                    SYMBOL_BUFFER *                  CodeBuffer,
+                    UINT64 *                         Indx,
+                    SYMBOL *                         ErrorOperator)
+{
+    PSCRIPT_ENGINE_PROFILE_ENTRY ProfileEntry = NULL;
+    UINT64                       StartTsc     = 0;
+    BOOL                         HasError;
+
+    if (ScriptGeneralRegisters->Profile != NULL)
+    {
+        ProfileEntry = &ScriptGeneralRegisters->Profile[*Indx];
+        StartTsc     = CpuReadTsc();
+    }
+
+    HasError = ScriptEngineExecuteOperator(GuestRegs, ActionDetail, ScriptGeneralRegisters, CodeBuffer, Indx, ErrorOperator);
+
+    if (ProfileEntry != NULL)
+    {
+        CpuInterlockedIncrement64((volatile INT64 *)&ProfileEntry->Count);
+        CpuInterlockedExchangeAdd64((volatile INT64 *)&ProfileEntry->Cycles, (INT64)(CpuReadTsc() - StartTsc));
+    }
+
+    return HasError;
+}
+
+/**
+ * @brief Get the size of the buffer of the linked code of a script buffer
+ *
+ * @param SymbolCount Number of the symbols of the script buffer
+ *
+ * @return UINT32 zero if the script buffer is too big to be linked
+ */
+UINT32
+ScriptEngineGetLinkedCodeSize(UINT32 SymbolCount)
+{
+    UINT64 Size = sizeof(SCRIPT_ENGINE_LINKED_CODE) +
+                  ((UINT64)SymbolCount + 1) * (sizeof(SCRIPT_ENGINE_LINKED_INSTRUCTION) + sizeof(UINT32));
+
+    if (Size > 0xffffffff)
+    {
+        return 0;
+    }
+
+    return (UINT32)Size;
+}
+
+/**
+ * @brief Get the index of a 64-bit general purpose register in GUEST_REGS
+ *
+ * @param RegId
+ *
+ * @return UINT32 SCRIPT_ENGINE_LINKED_NO_INSTRUCTION if the register is not
+ * a field of GUEST_REGS
+ */
+static UINT32
+ScriptEngineLinkedRegisterIndex(UINT64 RegId)
+{
+#if defined(SCRIPT_ENGINE_USER_MODE) && defined(HYPERDBG_LIBHYPERDBG)
+    //
+    // Registers of the hardware debugger are read by their ids
+    //
+    if (g_HwdbgInstanceInfoIsValid)
+    {
+        return SCRIPT_ENGINE_LINKED_NO_INSTRUCTION;
+    }
+#endif // defined(SCRIPT_ENGINE_USER_MODE) && defined(HYPERDBG_LIBHYPERDBG)
+
+    switch (RegId)
+    {
+    case REGISTER_RAX:
+        return 0;
+    case REGISTER_RCX:
+        return 1;
+    case REGISTER_RDX:
+        return 2;
+    case REGISTER_RBX:
+        return 3;
+    case REGISTER_RSP:
+        return 4;
+    case REGISTER_RBP:
+        return 5;
+    case REGISTER_RSI:
+        return 6;
+    case REGISTER_RDI:
+        return 7;
+    case REGISTER_R8:
+        return 8;
+    case REGISTER_R9:
+        return 9;
+    case REGISTER_R10:
+        return 10;
+    case REGISTER_R11:
+        return 11;
+    case REGISTER_R12:
+        return 12;
+    case REGISTER_R13:
+        return 13;
+    case REGISTER_R14:
+        return 14;
+    case REGISTER_R15:
+        return 15;
+    default:
+        return SCRIPT_ENGINE_LINKED_NO_INSTRUCTION;
+    }
+}
+
+/**
+ * @brief Resolve an operand of a linked instruction
+ *
+ * @param Instruction
+ * @param Operand Index of the operand
+ * @param Symbol The symbol of the operand in the code buffer
+ * @param IsWritten Whether the instruction changes the operand
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineLinkOperand(PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction, UINT32 Operand, PSYMBOL Symbol, BOOLEAN IsWritten)
+{
+    SCRIPT_ENGINE_LINKED_OPERAND_KIND Kind;
+    UINT64                            Value = Symbol->Value;
+
+    //
+    // The kinds should be the same as the types that GetValue and SetValue
+    // check (the whole type is compared, not only its lower part)
+    //
+    switch (Symbol->Type)
+    {
+    case SYMBOL_NUM_TYPE:
+        Kind = ScriptEngineLinkedOperandImmediate;
+        break;
+
+    case SYMBOL_GLOBAL_ID_TYPE:
+        Kind = ScriptEngineLinkedOperandGlobal;
+        break;
+
+    case SYMBOL_PERCPU_ID_TYPE:
+        Kind = ScriptEngineLinkedOperandPercpu;
+        break;
+
+    case SYMBOL_TEMP_TYPE:
+        Kind = ScriptEngineLinkedOperandTemp;
+        break;
+
+    case SYMBOL_FUNCTION_PARAMETER_ID_TYPE:
+        Kind = ScriptEngineLinkedOperandParameter;
+        break;
+
+    case SYMBOL_REGISTER_TYPE:
+
+        //
+        // The registers are only read directly, the narrower registers (and
+        // changing the registers) need GetRegValue and SetRegValue
+        //
+        Value = ScriptEngineLinkedRegisterIndex(Symbol->Value);
+        Kind  = IsWritten || Value == SCRIPT_ENGINE_LINKED_NO_INSTRUCTION ? ScriptEngineLinkedOperandSymbol : ScriptEngineLinkedOperandRegister;
+        break;
+
+    case SYMBOL_PSEUDO_REG_TYPE:
+        Kind = IsWritten ? ScriptEngineLinkedOperandSymbol : ScriptEngineLinkedOperandPseudoRegister;
+        break;
+
+    default:
+        Kind = ScriptEngineLinkedOperandSymbol;
+        break;
+    }
+
+    if (Kind == ScriptEngineLinkedOperandSymbol || Kind == ScriptEngineLinkedOperandPseudoRegister)
+    {
+        Value = (UINT64)Symbol;
+    }
+
+    Instruction->Operands[Operand] = Value;
+    Instruction->OperandKinds |= (UINT16)(Kind << (Operand * 4));
+}
+
+/**
+ * @brief Get the kind of an operand of a linked instruction
+ *
+ * @param Instruction
+ * @param Operand Index of the operand
+ *
+ * @return UINT32
+ */
+static UINT32
+ScriptEngineLinkedOperandKind(PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction, UINT32 Operand)
+{
+    return (Instruction->OperandKinds >> (Operand * 4)) & 0xf;
+}
+
+/**
+ * @brief Resolve the target of a jump or a call to the index of the target instruction
+ *
+ * @param Code
+ * @param Instruction
+ *
+ * @return BOOLEAN FALSE if the target is not known at the link time
+ */
+static BOOLEAN
+ScriptEngineLinkTarget(PSCRIPT_ENGINE_LINKED_CODE Code, PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction)
+{
+    UINT64 Target = Instruction->Operands[0];
+
+    if (ScriptEngineLinkedOperandKind(Instruction, 0) != ScriptEngineLinkedOperandImmediate)
+    {
+        return FALSE;
+    }
+
+    if (Target >= Code->Pointer)
+    {
+        //
+        // Jumping out of the code ends the script
+        //
+        Instruction->Operands[0] = Code->InstructionCount - 1;
+        return TRUE;
+    }
+
+    if (Code->InstructionOfSymbol[Target] == SCRIPT_ENGINE_LINKED_NO_INSTRUCTION)
+    {
+        return FALSE;
+    }
+
+    Instruction->Operands[0] = Code->InstructionOfSymbol[Target];
+    return TRUE;
+}
+
+/**
+ * @brief Select the handler of a linked instruction
+ *
+ * @param Operator
+ * @param OperandCount Number of the symbols after the operator
+ *
+ * @return SCRIPT_ENGINE_LINKED_HANDLER ScriptEngineLinkedHandlerGeneric
+ * if the instruction should be executed by ScriptEngineExecute
+ */
+static SCRIPT_ENGINE_LINKED_HANDLER
+ScriptEngineLinkedSelectHandler(PSYMBOL Operator, UINT32 OperandCount)
+{
+    SCRIPT_ENGINE_LINKED_HANDLER Handler;
+    UINT32                       ExpectedOperandCount = 3;
+
+    switch (Operator->Value)
+    {
+    case FUNC_MOV:
+        Handler              = ScriptEngineLinkedHandlerMov;
+        ExpectedOperandCount = 2;
+        break;
+    case FUNC_INC:
+        Handler              = ScriptEngineLinkedHandlerInc;
+        ExpectedOperandCount = 1;
+        break;
+    case FUNC_DEC:
+        Handler              = ScriptEngineLinkedHandlerDec;
+        ExpectedOperandCount = 1;
+        break;
+    case FUNC_NOT:
+        Handler              = ScriptEngineLinkedHandlerNot;
+        ExpectedOperandCount = 2;
+        break;
+    case FUNC_NEG:
+        Handler              = ScriptEngineLinkedHandlerNeg;
+        ExpectedOperandCount = 2;
+        break;
+    case FUNC_ADD:
+        Handler = ScriptEngineLinkedHandlerAdd;
+        break;
+    case FUNC_SUB:
+        Handler = ScriptEngineLinkedHandlerSub;
+        break;
+    case FUNC_MUL:
+        Handler = ScriptEngineLinkedHandlerMul;
+        break;
+    case FUNC_DIV:
+        Handler = ScriptEngineLinkedHandlerDiv;
+        break;
+    case FUNC_MOD:
+        Handler = ScriptEngineLinkedHandlerMod;
+        break;
+    case FUNC_OR:
+        Handler = ScriptEngineLinkedHandlerOr;
+        break;
+    case FUNC_AND:
+        Handler = ScriptEngineLinkedHandlerAnd;
+        break;
+    case FUNC_XOR:
+        Handler = ScriptEngineLinkedHandlerXor;
+        break;
+    case FUNC_ASL:
+        Handler = ScriptEngineLinkedHandlerAsl;
+        break;
+    case FUNC_ASR:
+        Handler = ScriptEngineLinkedHandlerAsr;
+        break;
+    case FUNC_GT:
+        Handler = ScriptEngineLinkedHandlerGt;
+        break;
+    case FUNC_LT:
+        Handler = ScriptEngineLinkedHandlerLt;
+        break;
+    case FUNC_EGT:
+        Handler = ScriptEngineLinkedHandlerEgt;
+        break;
+    case FUNC_ELT:
+        Handler = ScriptEngineLinkedHandlerElt;
+        break;
+    case FUNC_EQUAL:
+        Handler = ScriptEngineLinkedHandlerEqual;
+        break;
+    case FUNC_NEQ:
+        Handler = ScriptEngineLinkedHandlerNeq;
+        break;
+    case FUNC_ADD_TYPED:
+    case FUNC_SUB_TYPED:
+    case FUNC_MUL_TYPED:
+    case FUNC_DIV_TYPED:
+    case FUNC_MOD_TYPED:
+    case FUNC_BITWISE_AND_TYPED:
+    case FUNC_BITWISE_OR_TYPED:
+    case FUNC_BITWISE_XOR_TYPED:
+    case FUNC_SHIFT_LEFT_TYPED:
+    case FUNC_SHIFT_RIGHT_TYPED:
+    case FUNC_GT_TYPED:
+    case FUNC_LT_TYPED:
+    case FUNC_EGT_TYPED:
+    case FUNC_ELT_TYPED:
+    case FUNC_EQUAL_TYPED:
+    case FUNC_NEQ_TYPED:
+        Handler              = ScriptEngineLinkedHandlerTyped;
+        ExpectedOperandCount = 4;
+        break;
+    case FUNC_JMP:
+        Handler              = ScriptEngineLinkedHandlerJmp;
+        ExpectedOperandCount = 1;
+        break;
+    case FUNC_JZ:
+        Handler              = ScriptEngineLinkedHandlerJz;
+        ExpectedOperandCount = 2;
+        break;
+    case FUNC_JNZ:
+        Handler              = ScriptEngineLinkedHandlerJnz;
+        ExpectedOperandCount = 2;
+        break;
+    case FUNC_PUSH:
+        Handler              = ScriptEngineLinkedHandlerPush;
+        ExpectedOperandCount = 1;
+        break;
+    case FUNC_POP:
+        Handler              = ScriptEngineLinkedHandlerPop;
+        ExpectedOperandCount = 1;
+        break;
+    case FUNC_CALL:
+        Handler              = ScriptEngineLinkedHandlerCall;
+        ExpectedOperandCount = 1;
+        break;
+    case FUNC_RET:
+        Handler              = ScriptEngineLinkedHandlerRet;
+        ExpectedOperandCount = 0;
+        break;
+    case FUNC_CAST_SCALAR:
+        Handler              = ScriptEngineLinkedHandlerCastInteger;
+        ExpectedOperandCount = 4;
+        break;
+    case FUNC_LOGICAL_NOT_TYPED:
+        Handler = ScriptEngineLinkedHandlerLogicalNotInteger;
+        break;
+    case FUNC_RDTSC:
+    case FUNC_RDTSCP:
+    case FUNC_EVENT_ENABLE:
+    case FUNC_EVENT_DISABLE:
+    case FUNC_EVENT_CLEAR:
+    case FUNC_MICROSLEEP:
+    case FUNC_PRINT:
+        Handler              = ScriptEngineLinkedHandlerFunction;
+        ExpectedOperandCount = 1;
+        break;
+    case FUNC_VIRTUAL_TO_PHYSICAL:
+    case FUNC_PHYSICAL_TO_VIRTUAL:
+    case FUNC_CHECK_ADDRESS:
+    case FUNC_DISASSEMBLE_LEN:
+    case FUNC_DISASSEMBLE_LEN64:
+    case FUNC_STRLEN:
+    case FUNC_WCSLEN:
+        Handler              = ScriptEngineLinkedHandlerFunction;
+        ExpectedOperandCount = 2;
+        break;
+    default:
+        return ScriptEngineLinkedHandlerGeneric;
+    }
+
+    return OperandCount == ExpectedOperandCount ? Handler : ScriptEngineLinkedHandlerGeneric;
+}
+
+/**
+ * @brief Get the operand of a linked instruction that is changed by its handler
+ *
+ * @param Handler
+ * @param Operator
+ *
+ * @return UINT32 an index after the operands if the handler doesn't change any operand
+ */
+static UINT32
+ScriptEngineLinkedWrittenOperand(SCRIPT_ENGINE_LINKED_HANDLER Handler, UINT64 Operator)
+{
+    switch (Handler)
+    {
+    case ScriptEngineLinkedHandlerFunction:
+
+        //
+        // The result of the functions is the last operand
+        //
+        if (Operator == FUNC_RDTSC || Operator == FUNC_RDTSCP)
+        {
+            return 0;
+        }
+
+        return Operator == FUNC_EVENT_ENABLE || Operator == FUNC_EVENT_DISABLE || Operator == FUNC_EVENT_CLEAR ||
+                       Operator == FUNC_MICROSLEEP || Operator == FUNC_PRINT ?
+                   3 :
+                   1;
+
+    case ScriptEngineLinkedHandlerInc:
+    case ScriptEngineLinkedHandlerDec:
+    case ScriptEngineLinkedHandlerPop:
+        return 0;
+
+    case ScriptEngineLinkedHandlerMov:
+    case ScriptEngineLinkedHandlerNot:
+    case ScriptEngineLinkedHandlerNeg:
+    case ScriptEngineLinkedHandlerCastInteger:
+    case ScriptEngineLinkedHandlerLogicalNotInteger:
+        return 1;
+
+    case ScriptEngineLinkedHandlerJmp:
+    case ScriptEngineLinkedHandlerJz:
+    case ScriptEngineLinkedHandlerJnz:
+    case ScriptEngineLinkedHandlerPush:
+    case ScriptEngineLinkedHandlerCall:
+    case ScriptEngineLinkedHandlerRet:
+        return 3;
+
+    default:
+        return 2;
+    }
+}
+
+/**
+ * @brief Check whether a scalar type is an integer or a pointer
+ *
+ * @param Symbol The symbol of the type in the code buffer
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ScriptEngineLinkedTypeIsInteger(PSYMBOL Symbol)
+{
+    return Symbol->Type == SYMBOL_NUM_TYPE &&
+           (ScriptEngineScalarTypeIsInteger(Symbol->Value) || Symbol->Value == SCRIPT_SCALAR_TYPE_POINTER);
+}
+
+/**
+ * @brief Get the first specialized handler of a binary operator
+ *
+ * @param Operator
+ * @param Type The type of the typed operators
+ *
+ * @return SCRIPT_ENGINE_LINKED_HANDLER ScriptEngineLinkedHandlerGeneric if
+ * the operator is not specialized
+ */
+static SCRIPT_ENGINE_LINKED_HANDLER
+ScriptEngineLinkedSpecializedOperator(UINT64 Operator, UINT64 Type)
+{
+    BOOLEAN IsInteger    = Type == SCRIPT_SCALAR_TYPE_I64 || Type == SCRIPT_SCALAR_TYPE_U64;
+    BOOLEAN IsComparable = IsInteger || Type == SCRIPT_SCALAR_TYPE_POINTER;
+    BOOLEAN IsSigned     = Type == SCRIPT_SCALAR_TYPE_I64;
+
+    //
+    // The 64-bit typed operators don't need to normalize their operands and
+    // the pointers can only be compared
+    //
+    switch (Operator)
+    {
+    case FUNC_ADD:
+        return ScriptEngineLinkedHandlerAddTempTemp;
+    case FUNC_SUB:
+        return ScriptEngineLinkedHandlerSubTempTemp;
+    case FUNC_MUL:
+        return ScriptEngineLinkedHandlerMulTempTemp;
+    case FUNC_AND:
+        return ScriptEngineLinkedHandlerAndTempTemp;
+    case FUNC_OR:
+        return ScriptEngineLinkedHandlerOrTempTemp;
+    case FUNC_XOR:
+        return ScriptEngineLinkedHandlerXorTempTemp;
+    case FUNC_GT:
+        return ScriptEngineLinkedHandlerGtTempTemp;
+    case FUNC_LT:
+        return ScriptEngineLinkedHandlerLtTempTemp;
+    case FUNC_EGT:
+        return ScriptEngineLinkedHandlerEgtTempTemp;
+    case FUNC_ELT:
+        return ScriptEngineLinkedHandlerEltTempTemp;
+    case FUNC_EQUAL:
+        return ScriptEngineLinkedHandlerEqualTempTemp;
+    case FUNC_NEQ:
+        return ScriptEngineLinkedHandlerNeqTempTemp;
+    case FUNC_ADD_TYPED:
+        return IsInteger ? ScriptEngineLinkedHandlerAddTempTemp : ScriptEngineLinkedHandlerGeneric;
+    case FUNC_SUB_TYPED:
+        return IsInteger ? ScriptEngineLinkedHandlerSubTempTemp : ScriptEngineLinkedHandlerGeneric;
+    case FUNC_MUL_TYPED:
+        return IsInteger ? ScriptEngineLinkedHandlerMulTempTemp : ScriptEngineLinkedHandlerGeneric;
+    case FUNC_BITWISE_AND_TYPED:
+        return IsInteger ? ScriptEngineLinkedHandlerAndTempTemp : ScriptEngineLinkedHandlerGeneric;
+    case FUNC_BITWISE_OR_TYPED:
+        return IsInteger ? ScriptEngineLinkedHandlerOrTempTemp : ScriptEngineLinkedHandlerGeneric;
+    case FUNC_BITWISE_XOR_TYPED:
+        return IsInteger ? ScriptEngineLinkedHandlerXorTempTemp : ScriptEngineLinkedHandlerGeneric;
+    case FUNC_GT_TYPED:
+        return !IsComparable ? ScriptEngineLinkedHandlerGeneric : IsSigned ? ScriptEngineLinkedHandlerGtTempTemp :
+                                                                            ScriptEngineLinkedHandlerAboveTempTemp;
+    case FUNC_LT_TYPED:
+        return !IsComparable ? ScriptEngineLinkedHandlerGeneric : IsSigned ? ScriptEngineLinkedHandlerLtTempTemp :
+                                                                            ScriptEngineLinkedHandlerBelowTempTemp;
+    case FUNC_EGT_TYPED:
+        return !IsComparable ? ScriptEngineLinkedHandlerGeneric : IsSigned ? ScriptEngineLinkedHandlerEgtTempTemp :
+                                                                            ScriptEngineLinkedHandlerAboveOrEqualTempTemp;
+    case FUNC_ELT_TYPED:
+        return !IsComparable ? ScriptEngineLinkedHandlerGeneric : IsSigned ? ScriptEngineLinkedHandlerEltTempTemp :
+                                                                            ScriptEngineLinkedHandlerBelowOrEqualTempTemp;
+    case FUNC_EQUAL_TYPED:
+        return IsComparable ? ScriptEngineLinkedHandlerEqualTempTemp : ScriptEngineLinkedHandlerGeneric;
+    case FUNC_NEQ_TYPED:
+        return IsComparable ? ScriptEngineLinkedHandlerNeqTempTemp : ScriptEngineLinkedHandlerGeneric;
+    default:
+        return ScriptEngineLinkedHandlerGeneric;
+    }
+}
+
+/**
+ * @brief Specialize a linked instruction for the kinds of its operands
+ *
+ * @details The specialized handlers don't check the kinds of the operands at
+ * the run time, the checks of the stack are left for the handlers
+ *
+ * @param Code
+ * @param Instruction
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineLinkedSpecialize(PSCRIPT_ENGINE_LINKED_CODE Code, PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction)
+{
+    PSYMBOL                      Operator = &Code->Head[Instruction->SymbolIndex];
+    SCRIPT_ENGINE_LINKED_HANDLER Handler  = ScriptEngineLinkedHandlerGeneric;
+    UINT32                       Src0     = ScriptEngineLinkedOperandKind(Instruction, 0);
+    UINT32                       Src1     = ScriptEngineLinkedOperandKind(Instruction, 1);
+    UINT32                       Des      = ScriptEngineLinkedOperandKind(Instruction, 2);
+
+    switch (Instruction->Handler)
+    {
+    case ScriptEngineLinkedHandlerMov:
+
+        if (Src0 == ScriptEngineLinkedOperandTemp && Src1 == ScriptEngineLinkedOperandTemp)
+        {
+            Instruction->Handler = ScriptEngineLinkedHandlerMovTempTemp;
+        }
+        else if (Src0 == ScriptEngineLinkedOperandImmediate && Src1 == ScriptEngineLinkedOperandTemp)
+        {
+            Instruction->Handler = ScriptEngineLinkedHandlerMovImmediateTemp;
+        }
+        else if (Src0 == ScriptEngineLinkedOperandTemp && Src1 == ScriptEngineLinkedOperandGlobal)
+        {
+            Instruction->Handler = ScriptEngineLinkedHandlerMovTempGlobal;
+        }
+        return;
+
+    case ScriptEngineLinkedHandlerInc:
+    case ScriptEngineLinkedHandlerDec:
+
+        if (Src0 == ScriptEngineLinkedOperandTemp)
+        {
+            Instruction->Handler = Instruction->Handler == ScriptEngineLinkedHandlerInc ? ScriptEngineLinkedHandlerIncTemp : ScriptEngineLinkedHandlerDecTemp;
+        }
+        return;
+
+    case ScriptEngineLinkedHandlerJz:
+    case ScriptEngineLinkedHandlerJnz:
+
+        if (Src1 == ScriptEngineLinkedOperandTemp)
+        {
+            Instruction->Handler = Instruction->Handler == ScriptEngineLinkedHandlerJz ? ScriptEngineLinkedHandlerJzTemp : ScriptEngineLinkedHandlerJnzTemp;
+        }
+        return;
+
+    case ScriptEngineLinkedHandlerTyped:
+
+        //
+        // The type is a number (checked by the linker)
+        //
+        Handler = ScriptEngineLinkedSpecializedOperator(Operator->Value, Code->Head[Instruction->SymbolIndex + 4].Value);
+        break;
+
+    case ScriptEngineLinkedHandlerAdd:
+    case ScriptEngineLinkedHandlerSub:
+    case ScriptEngineLinkedHandlerMul:
+    case ScriptEngineLinkedHandlerOr:
+    case ScriptEngineLinkedHandlerAnd:
+    case ScriptEngineLinkedHandlerXor:
+    case ScriptEngineLinkedHandlerGt:
+    case ScriptEngineLinkedHandlerLt:
+    case ScriptEngineLinkedHandlerEgt:
+    case ScriptEngineLinkedHandlerElt:
+    case ScriptEngineLinkedHandlerEqual:
+    case ScriptEngineLinkedHandlerNeq:
+        Handler = ScriptEngineLinkedSpecializedOperator(Operator->Value, SCRIPT_SCALAR_TYPE_INVALID);
+        break;
+
+    default:
+        return;
+    }
+
+    if (Handler == ScriptEngineLinkedHandlerGeneric || Des != ScriptEngineLinkedOperandTemp)
+    {
+        return;
+    }
+
+    //
+    // The handlers of each operator are in the same order as the shapes
+    //
+    if (Src0 == ScriptEngineLinkedOperandTemp && Src1 == ScriptEngineLinkedOperandTemp)
+    {
+        Instruction->Handler = (UINT8)Handler;
+    }
+    else if (Src0 == ScriptEngineLinkedOperandImmediate && Src1 == ScriptEngineLinkedOperandTemp)
+    {
+        Instruction->Handler = (UINT8)(Handler + 1);
+    }
+    else if (Src0 == ScriptEngineLinkedOperandTemp && Src1 == ScriptEngineLinkedOperandImmediate)
+    {
+        Instruction->Handler = (UINT8)(Handler + 2);
+    }
+    else if (Src0 == ScriptEngineLinkedOperandImmediate && Src1 == ScriptEngineLinkedOperandRegister)
+    {
+        Instruction->Handler = (UINT8)(Handler + 3);
+    }
+}
+
+/**
+ * @brief Find the number of the used entries of the stack buffer and whether
+ * the linked code is bounded
+ *
+ * @details A code is bounded if all of its jumps are forward jumps to the
+ * instructions (or to the end of the code), it doesn't have calls, returns,
+ * pushes or pops and the stack index is only changed by the prologue of the
+ * main body. Each instruction of a bounded code is executed at most once and
+ * the stack index never reaches MAX_STACK_BUFFER_COUNT, so the limits don't
+ * need to be checked while it's executed
+ *
+ * @param Code
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineLinkAnalyze(PSCRIPT_ENGINE_LINKED_CODE Code)
+{
+    PSYMBOL Head         = Code->Head;
+    UINT64  StackIndex   = 0;
+    UINT64  StackUsage   = 0;
+    BOOLEAN IsBounded    = TRUE;
+    BOOLEAN IsStackKnown = TRUE;
+    UINT64  Symbol;
+    UINT32  Index;
+
+    for (Index = 0; Index + 1 < Code->InstructionCount; Index++)
+    {
+        UINT32  Start           = Code->Instructions[Index].SymbolIndex;
+        UINT32  End             = Code->Instructions[Index + 1].SymbolIndex;
+        PSYMBOL Operator        = &Head[Start];
+        PSYMBOL Target          = &Head[Start + 1];
+        BOOLEAN IsStackPrologue = FALSE;
+
+        switch (Operator->Value)
+        {
+        case FUNC_JMP:
+        case FUNC_JZ:
+        case FUNC_JNZ:
+
+            //
+            // The targets that are not known at the link time may go backward
+            //
+            if (End - Start < 2 || Target->Type != SYMBOL_NUM_TYPE || Target->Value <= Start ||
+                (Target->Value < Code->Pointer && Code->InstructionOfSymbol[Target->Value] == SCRIPT_ENGINE_LINKED_NO_INSTRUCTION))
+            {
+                IsBounded = FALSE;
+            }
+            break;
+
+        case FUNC_CALL:
+        case FUNC_RET:
+        case FUNC_PUSH:
+        case FUNC_POP:
+            IsBounded    = FALSE;
+            IsStackKnown = FALSE;
+            break;
+
+        case FUNC_ADD:
+
+            //
+            // The prologue of the main body reserves the local variables
+            // (add num, StackIndx, StackIndx)
+            //
+            IsStackPrologue = End - Start == 4 && Head[Start + 1].Type == SYMBOL_NUM_TYPE &&
+                              Head[Start + 2].Type == SYMBOL_STACK_INDEX_TYPE &&
+                              Head[Start + 3].Type == SYMBOL_STACK_INDEX_TYPE &&
+                              Head[Start + 1].Value < MAX_STACK_BUFFER_COUNT;
+
+            if (IsStackPrologue)
+            {
+                StackIndex += Head[Start + 1].Value;
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        for (Symbol = (UINT64)Start + 1; Symbol < End; Symbol++)
+        {
+            UINT64 Type = Head[Symbol].Type & 0x7fffffff;
+
+            switch (Type)
+            {
+            case SYMBOL_TEMP_TYPE:
+            case SYMBOL_DEREFERENCE_TEMP_TYPE:
+
+                if (Head[Symbol].Value >= MAX_STACK_BUFFER_COUNT)
+                {
+                    IsStackKnown = FALSE;
+                }
+                else if (Head[Symbol].Value >= StackUsage)
+                {
+                    StackUsage = Head[Symbol].Value + 1;
+                }
+                break;
+
+            case SYMBOL_STACK_INDEX_TYPE:
+            case SYMBOL_STACK_BASE_INDEX_TYPE:
+
+                if (!IsStackPrologue)
+                {
+                    IsBounded    = FALSE;
+                    IsStackKnown = FALSE;
+                }
+                break;
+
+            case SYMBOL_REFERENCE_TEMP_TYPE:
+            case SYMBOL_FUNCTION_PARAMETER_ID_TYPE:
+
+                //
+                // The entries after the temps may be accessed by the references
+                //
+                IsStackKnown = FALSE;
+                break;
+
+            default:
+
+                if (Type == SYMBOL_STRING_TYPE || Type == SYMBOL_WSTRING_TYPE)
+                {
+                    Symbol += (SIZE_SYMBOL_WITHOUT_LEN + Head[Symbol].Len) / sizeof(SYMBOL);
+                }
+                break;
+            }
+        }
+    }
+
+    if (StackIndex >= MAX_STACK_BUFFER_COUNT || Code->Pointer > MAX_EXECUTION_COUNT)
+    {
+        IsBounded    = FALSE;
+        IsStackKnown = FALSE;
+    }
+
+    if (StackIndex > StackUsage)
+    {
+        StackUsage = StackIndex;
+    }
+
+    Code->StackUsage = IsStackKnown ? (UINT32)StackUsage : MAX_STACK_BUFFER_COUNT;
+    Code->IsBounded  = IsBounded;
+}
+
+/**
+ * @brief Get the number of the entries of the stack buffer that a linked
+ * code may use
+ *
+ * @details Only these entries should be zeroed before executing the code
+ *
+ * @param LinkedCode The code that is linked by ScriptEngineLink
+ *
+ * @return UINT32
+ */
+UINT32
+ScriptEngineGetLinkedStackUsage(PVOID LinkedCode)
+{
+    return ((PSCRIPT_ENGINE_LINKED_CODE)LinkedCode)->StackUsage;
+}
+
+/**
+ * @brief Link a script buffer to pre-decoded instructions
+ *
+ * @details The operators and the operands are decoded once, so executing the
+ * linked code doesn't need to decode the symbols of each instruction again.
+ * Instructions without a handler are executed by ScriptEngineExecute, so
+ * the linked code behaves exactly the same as the script buffer
+ *
+ * @param CodeBuffer The script buffer (should remain valid while the linked code is used)
+ * @param LinkedCode
+ * @param LinkedCodeSize should be at least ScriptEngineGetLinkedCodeSize
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ScriptEngineLink(SYMBOL_BUFFER * CodeBuffer, PVOID LinkedCode, UINT32 LinkedCodeSize)
+{
+    PSCRIPT_ENGINE_LINKED_CODE        Code = (PSCRIPT_ENGINE_LINKED_CODE)LinkedCode;
+    PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction;
+    PSYMBOL                           Head    = CodeBuffer->Head;
+    UINT32                            Pointer = CodeBuffer->Pointer;
+    UINT32                            RequiredSize;
+    UINT32                            Count = 0;
+    UINT32                            OperandCount;
+    UINT32                            Operand;
+    UINT64                            Index;
+
+    RequiredSize = ScriptEngineGetLinkedCodeSize(Pointer);
+
+    if (RequiredSize == 0 || LinkedCodeSize < RequiredSize)
+    {
+        return FALSE;
+    }
+
+    Code->Head                = Head;
+    Code->Pointer             = Pointer;
+    Code->Instructions        = (PSCRIPT_ENGINE_LINKED_INSTRUCTION)((UINT8 *)LinkedCode + sizeof(SCRIPT_ENGINE_LINKED_CODE));
+    Code->InstructionOfSymbol = (UINT32 *)(Code->Instructions + Pointer + 1);
+
+    //
+    // Find the start of the instructions, each instruction continues up to
+    // the next operator (the characters of the strings are skipped)
+    //
+    for (Index = 0; Index < Pointer; Index++)
+    {
+        Code->InstructionOfSymbol[Index] = SCRIPT_ENGINE_LINKED_NO_INSTRUCTION;
+    }
+
+    Index = 0;
+
+    while (Index < Pointer)
+    {
+        UINT64 Type = Head[Index].Type & 0x7fffffff;
+
+        if (Head[Index].Type == SYMBOL_SEMANTIC_RULE_TYPE)
+        {
+            Code->InstructionOfSymbol[Index] = Count;
+
+            memset(&Code->Instructions[Count], 0, sizeof(SCRIPT_ENGINE_LINKED_INSTRUCTION));
+            Code->Instructions[Count].SymbolIndex = (UINT32)Index;
+            Count++;
+        }
+
+        if (Type == SYMBOL_STRING_TYPE || Type == SYMBOL_WSTRING_TYPE)
+        {
+            if (Head[Index].Len > (UINT64)Pointer * sizeof(SYMBOL))
+            {
+                break;
+            }
+
+            Index += (SIZE_SYMBOL_WITHOUT_LEN + Head[Index].Len) / sizeof(SYMBOL) + 1;
+        }
+        else
+        {
+            Index++;
+        }
+    }
+
+    //
+    // The end instruction is used for the instructions that continue after
+    // the last symbol
+    //
+    memset(&Code->Instructions[Count], 0, sizeof(SCRIPT_ENGINE_LINKED_INSTRUCTION));
+    Code->Instructions[Count].SymbolIndex = Pointer;
+    Code->Instructions[Count].Handler     = ScriptEngineLinkedHandlerEnd;
+    Code->InstructionCount                = Count + 1;
+
+    for (Index = 0; Index < Count; Index++)
+    {
+        Instruction  = &Code->Instructions[Index];
+        OperandCount = Code->Instructions[Index + 1].SymbolIndex - Instruction->SymbolIndex - 1;
+
+        Instruction->Handler = (UINT8)ScriptEngineLinkedSelectHandler(&Head[Instruction->SymbolIndex], OperandCount);
+
+        if (Instruction->Handler == ScriptEngineLinkedHandlerGeneric)
+        {
+            continue;
+        }
+
+        for (Operand = 0; Operand < OperandCount && Operand < 3; Operand++)
+        {
+            ScriptEngineLinkOperand(Instruction,
+                                    Operand,
+                                    &Head[Instruction->SymbolIndex + 1 + Operand],
+                                    Operand == ScriptEngineLinkedWrittenOperand((SCRIPT_ENGINE_LINKED_HANDLER)Instruction->Handler,
+                                                                                Head[Instruction->SymbolIndex].Value));
+        }
+
+        switch (Instruction->Handler)
+        {
+        case ScriptEngineLinkedHandlerJmp:
+        case ScriptEngineLinkedHandlerJz:
+        case ScriptEngineLinkedHandlerJnz:
+        case ScriptEngineLinkedHandlerCall:
+
+            if (!ScriptEngineLinkTarget(Code, Instruction))
+            {
+                Instruction->Handler = ScriptEngineLinkedHandlerGeneric;
+            }
+            break;
+
+        case ScriptEngineLinkedHandlerTyped:
+        {
+            PSYMBOL Src0 = &Head[Instruction->SymbolIndex + 1];
+            PSYMBOL Src1 = &Head[Instruction->SymbolIndex + 2];
+            PSYMBOL Des  = &Head[Instruction->SymbolIndex + 3];
+            PSYMBOL Type = &Head[Instruction->SymbolIndex + 4];
+
+            //
+            // Only the checks of the stack are left for the run time, other
+            // instructions (and errors) are left for ScriptEngineExecute
+            //
+            if (Src0->Len != SYMBOL_VALUE_KIND_INTEGER || Src1->Len != SYMBOL_VALUE_KIND_INTEGER ||
+                Des->Len != SYMBOL_VALUE_KIND_INTEGER || Des->Type != SYMBOL_TEMP_TYPE ||
+                Type->Type != SYMBOL_NUM_TYPE)
+            {
+                Instruction->Handler = ScriptEngineLinkedHandlerGeneric;
+            }
+            break;
+        }
+
+        case ScriptEngineLinkedHandlerFunction:
+        {
+            UINT64 Type = Head[Instruction->SymbolIndex + 1].Type & 0x7fffffff;
+
+            //
+            // The strings are passed by their address (not by their value)
+            //
+            if (Type == SYMBOL_STRING_TYPE || Type == SYMBOL_WSTRING_TYPE)
+            {
+                Instruction->Handler = ScriptEngineLinkedHandlerGeneric;
+            }
+            break;
+        }
+
+        case ScriptEngineLinkedHandlerCastInteger:
+        case ScriptEngineLinkedHandlerLogicalNotInteger:
+        {
+            PSYMBOL Src  = &Head[Instruction->SymbolIndex + 1];
+            PSYMBOL Des  = &Head[Instruction->SymbolIndex + 2];
+            PSYMBOL Type = &Head[Instruction->SymbolIndex + 3];
+
+            //
+            // Only the casts and the logical nots of the integers (and the
+            // pointers) are linked, the destination type of the casts replaces
+            // the source type (it's not needed by the integer casts)
+            //
+            if (Src->Len != SYMBOL_VALUE_KIND_INTEGER || Des->Len != SYMBOL_VALUE_KIND_INTEGER ||
+                Des->Type != SYMBOL_TEMP_TYPE || !ScriptEngineLinkedTypeIsInteger(Type) ||
+                (Instruction->Handler == ScriptEngineLinkedHandlerCastInteger &&
+                 !ScriptEngineLinkedTypeIsInteger(&Head[Instruction->SymbolIndex + 4])))
+            {
+                Instruction->Handler = ScriptEngineLinkedHandlerGeneric;
+            }
+            else if (Instruction->Handler == ScriptEngineLinkedHandlerCastInteger)
+            {
+                Instruction->Operands[2] = Head[Instruction->SymbolIndex + 4].Value;
+            }
+            break;
+        }
+
+        default:
+            break;
+        }
+
+        if (Instruction->Handler != ScriptEngineLinkedHandlerGeneric)
+        {
+            ScriptEngineLinkedSpecialize(Code, Instruction);
+        }
+    }
+
+    ScriptEngineLinkAnalyze(Code);
+
+    return TRUE;
+}
+
+/**
+ * @brief Get the value of an operand of a linked instruction
+ *
+ * @param GuestRegs
+ * @param ActionDetail
+ * @param ScriptGeneralRegisters
+ * @param Instruction
+ * @param Operand Index of the operand
+ *
+ * @return UINT64
+ */
+static UINT64
+ScriptEngineLinkedGetValue(PGUEST_REGS                       GuestRegs,
+                           ACTION_BUFFER *                   ActionDetail,
+                           PSCRIPT_ENGINE_GENERAL_REGISTERS  ScriptGeneralRegisters,
+                           PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction,
+                           UINT32                            Operand)
+{
+    UINT64 Value = Instruction->Operands[Operand];
+
+    switch (ScriptEngineLinkedOperandKind(Instruction, Operand))
+    {
+    case ScriptEngineLinkedOperandImmediate:
+        return Value;
+
+    case ScriptEngineLinkedOperandGlobal:
+        return ScriptGeneralRegisters->GlobalVariablesList[Value];
+
+    case ScriptEngineLinkedOperandPercpu:
+        return ScriptGeneralRegisters->PercpuVariablesList[Value];
+
+    case ScriptEngineLinkedOperandTemp:
+        return ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackBaseIndx + Value];
+
+    case ScriptEngineLinkedOperandParameter:
+        return ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackBaseIndx - 3 - Value];
+
+    case ScriptEngineLinkedOperandRegister:
+        return ((UINT64 *)GuestRegs)[Value];
+
+    case ScriptEngineLinkedOperandPseudoRegister:
+        return GetPseudoRegValue((PSYMBOL)Value, ActionDetail);
+
+    default:
+        return GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, (PSYMBOL)Value, FALSE);
+    }
+}
+
+/**
+ * @brief Set the value of an operand of a linked instruction
+ *
+ * @param GuestRegs
+ * @param ScriptGeneralRegisters
+ * @param Instruction
+ * @param Operand Index of the operand
+ * @param Value
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineLinkedSetValue(PGUEST_REGS                       GuestRegs,
+                           PSCRIPT_ENGINE_GENERAL_REGISTERS  ScriptGeneralRegisters,
+                           PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction,
+                           UINT32                            Operand,
+                           UINT64                            Value)
+{
+    UINT64 Destination = Instruction->Operands[Operand];
+
+    switch (ScriptEngineLinkedOperandKind(Instruction, Operand))
+    {
+    case ScriptEngineLinkedOperandImmediate:
+    case ScriptEngineLinkedOperandRegister:
+    case ScriptEngineLinkedOperandPseudoRegister:
+
+        //
+        // Numbers are not changed by SetValue (and the registers are only
+        // linked if they are not changed)
+        //
+        return;
+
+    case ScriptEngineLinkedOperandGlobal:
+        ScriptGeneralRegisters->GlobalVariablesList[Destination] = Value;
+        return;
+
+    case ScriptEngineLinkedOperandPercpu:
+        ScriptGeneralRegisters->PercpuVariablesList[Destination] = Value;
+        return;
+
+    case ScriptEngineLinkedOperandTemp:
+        ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackBaseIndx + Destination] = Value;
+        return;
+
+    case ScriptEngineLinkedOperandParameter:
+        ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackBaseIndx - 3 - Destination] = Value;
+        return;
+
+    default:
+        SetValue(GuestRegs, ScriptGeneralRegisters, (PSYMBOL)Destination, Value);
+        return;
+    }
+}
+
+//
+// Computed gotos jump directly from each handler to the next one, other
+// compilers (MSVC) dispatch the handlers by a switch
+//
+#if defined(__GNUC__)
+#    define LINKED_HANDLER(Name) case ScriptEngineLinkedHandler##Name: LinkedHandler##Name:
+#    define LINKED_DISPATCH()    goto *DispatchTable[Instruction->Handler]
+#else
+#    define LINKED_HANDLER(Name) case ScriptEngineLinkedHandler##Name:
+#    define LINKED_DISPATCH()    goto Dispatch
+#endif
+
+//
+// The same limits as the loops that call ScriptEngineExecute, checked
+// after each instruction (the bounded codes never reach them)
+//
+#define LINKED_CHECK_LIMITS()                                            \
+    if (!IsBounded)                                                      \
+    {                                                                    \
+        if (ScriptGeneralRegisters->StackIndx >= MAX_STACK_BUFFER_COUNT) \
+            return ScriptEngineLinkedExecutionStackOverflow;             \
+        if (ExecutionCount++ >= MAX_EXECUTION_COUNT)                     \
+            return ScriptEngineLinkedExecutionExecutionCountExceeded;    \
+    }
+
+#define LINKED_NEXT()         \
+    Instruction++;            \
+    LINKED_CHECK_LIMITS();    \
+    LINKED_DISPATCH()
+
+#define LINKED_JUMP(Target)                             \
+    Instruction = &Code->Instructions[(Target)];        \
+    LINKED_CHECK_LIMITS();                              \
+    LINKED_DISPATCH()
+
+#define LINKED_GET(Operand) \
+    ScriptEngineLinkedGetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Instruction, (Operand))
+
+#define LINKED_SET(Operand, Value) \
+    ScriptEngineLinkedSetValue(GuestRegs, ScriptGeneralRegisters, Instruction, (Operand), (Value))
+
+//
+// Operands of the specialized handlers (the kinds are known at the link time)
+//
+#define LINKED_OPERAND_Immediate(Operand) Instruction->Operands[(Operand)]
+#define LINKED_OPERAND_Temp(Operand) \
+    ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackBaseIndx + Instruction->Operands[(Operand)]]
+#define LINKED_OPERAND_Global(Operand)   ScriptGeneralRegisters->GlobalVariablesList[Instruction->Operands[(Operand)]]
+#define LINKED_OPERAND_Register(Operand) ((UINT64 *)GuestRegs)[Instruction->Operands[(Operand)]]
+
+//
+// Whether a temp is in the stack buffer (the same as ScriptEngineIntegerSymbolIsWritable)
+//
+#define LINKED_TEMP_IS_VALID(Operand)                                      \
+    (ScriptGeneralRegisters->StackBaseIndx < MAX_STACK_BUFFER_COUNT &&     \
+     Instruction->Operands[(Operand)] < MAX_STACK_BUFFER_COUNT - ScriptGeneralRegisters->StackBaseIndx)
+
+#define LINKED_OPERATION_Add(Left, Right)          ((Left) + (Right))
+#define LINKED_OPERATION_Sub(Left, Right)          ((Left) - (Right))
+#define LINKED_OPERATION_Mul(Left, Right)          ((Left) * (Right))
+#define LINKED_OPERATION_And(Left, Right)          ((Left) & (Right))
+#define LINKED_OPERATION_Or(Left, Right)           ((Left) | (Right))
+#define LINKED_OPERATION_Xor(Left, Right)          ((Left) ^ (Right))
+#define LINKED_OPERATION_Gt(Left, Right)           (UINT64)((INT64)(Left) > (INT64)(Right))
+#define LINKED_OPERATION_Lt(Left, Right)           (UINT64)((INT64)(Left) < (INT64)(Right))
+#define LINKED_OPERATION_Egt(Left, Right)          (UINT64)((INT64)(Left) >= (INT64)(Right))
+#define LINKED_OPERATION_Elt(Left, Right)          (UINT64)((INT64)(Left) <= (INT64)(Right))
+#define LINKED_OPERATION_Above(Left, Right)        (UINT64)((Left) > (Right))
+#define LINKED_OPERATION_Below(Left, Right)        (UINT64)((Left) < (Right))
+#define LINKED_OPERATION_AboveOrEqual(Left, Right) (UINT64)((Left) >= (Right))
+#define LINKED_OPERATION_BelowOrEqual(Left, Right) (UINT64)((Left) <= (Right))
+#define LINKED_OPERATION_Equal(Left, Right)        (UINT64)((Left) == (Right))
+#define LINKED_OPERATION_Neq(Left, Right)          (UINT64)((Left) != (Right))
+
+//
+// The destinations that are not in the stack buffer are left for
+// ScriptEngineExecute, so the errors (or the unchecked writes of the
+// untyped operators) are exactly the same as the script buffer
+//
+#define LINKED_SPECIALIZED_HANDLER(Operator, Src0, Src1)                               \
+    LINKED_HANDLER(Operator##Src0##Src1)                                               \
+    if (!LINKED_TEMP_IS_VALID(2))                                                      \
+    {                                                                                  \
+        Index = Instruction->SymbolIndex;                                              \
+        goto Interpret;                                                                \
+    }                                                                                  \
+    SrcVal0               = LINKED_OPERAND_##Src0(0);                                  \
+    SrcVal1               = LINKED_OPERAND_##Src1(1);                                  \
+    LINKED_OPERAND_Temp(2) = LINKED_OPERATION_##Operator(SrcVal1, SrcVal0);            \
+    LINKED_NEXT();
+
+#define LINKED_SPECIALIZED_HANDLERS(Operator) \
+    SCRIPT_ENGINE_LINKED_SPECIALIZED_SHAPES(LINKED_SPECIALIZED_HANDLER, Operator)
+
+#define LINKED_SPECIALIZED_LABEL(Operator, Src0, Src1) &&LinkedHandler##Operator##Src0##Src1,
+
+#define LINKED_SPECIALIZED_LABELS(Operator) \
+    SCRIPT_ENGINE_LINKED_SPECIALIZED_SHAPES(LINKED_SPECIALIZED_LABEL, Operator)
+
+/**
+ * @brief Execute a linked script buffer
+ *
+ * @param GuestRegs General purpose registers
+ * @param ActionDetail Detail of the specific action
+ * @param ScriptGeneralRegisters of core specific (and global) variable holders
+ * @param LinkedCode The code that is linked by ScriptEngineLink
+ * @param ErrorOperator Error in operator
+ *
+ * @return SCRIPT_ENGINE_LINKED_EXECUTION_RESULT
+ */
+SCRIPT_ENGINE_LINKED_EXECUTION_RESULT
+ScriptEngineExecuteLinked(PGUEST_REGS                      GuestRegs,
+                          ACTION_BUFFER *                  ActionDetail,
+                          PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters,
+                          PVOID                            LinkedCode,
+                          SYMBOL *                         ErrorOperator)
+{
+    PSCRIPT_ENGINE_LINKED_CODE        Code        = (PSCRIPT_ENGINE_LINKED_CODE)LinkedCode;
+    PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction = Code->Instructions;
+    SYMBOL_BUFFER                     CodeBuffer  = {0};
+    UINT64                            ExecutionCount = 0;
+    BOOLEAN                           IsBounded      = Code->IsBounded;
+    UINT64                            Index;
+    UINT64                            SrcVal0;
+    UINT64                            SrcVal1;
+    UINT64                            DesVal;
+
+#if defined(__GNUC__)
+    static const void * const DispatchTable[ScriptEngineLinkedHandlerCount] = {
+        &&LinkedHandlerEnd,
+        &&LinkedHandlerGeneric,
+        &&LinkedHandlerMov,
+        &&LinkedHandlerInc,
+        &&LinkedHandlerDec,
+        &&LinkedHandlerNot,
+        &&LinkedHandlerNeg,
+        &&LinkedHandlerAdd,
+        &&LinkedHandlerSub,
+        &&LinkedHandlerMul,
+        &&LinkedHandlerDiv,
+        &&LinkedHandlerMod,
+        &&LinkedHandlerOr,
+        &&LinkedHandlerAnd,
+        &&LinkedHandlerXor,
+        &&LinkedHandlerAsl,
+        &&LinkedHandlerAsr,
+        &&LinkedHandlerGt,
+        &&LinkedHandlerLt,
+        &&LinkedHandlerEgt,
+        &&LinkedHandlerElt,
+        &&LinkedHandlerEqual,
+        &&LinkedHandlerNeq,
+        &&LinkedHandlerTyped,
+        &&LinkedHandlerJmp,
+        &&LinkedHandlerJz,
+        &&LinkedHandlerJnz,
+        &&LinkedHandlerPush,
+        &&LinkedHandlerPop,
+        &&LinkedHandlerCall,
+        &&LinkedHandlerRet,
+        &&LinkedHandlerMovTempTemp,
+        &&LinkedHandlerMovImmediateTemp,
+        &&LinkedHandlerMovTempGlobal,
+        &&LinkedHandlerIncTemp,
+        &&LinkedHandlerDecTemp,
+        &&LinkedHandlerJzTemp,
+        &&LinkedHandlerJnzTemp,
+        &&LinkedHandlerCastInteger,
+        &&LinkedHandlerLogicalNotInteger,
+        &&LinkedHandlerFunction,
+        SCRIPT_ENGINE_LINKED_SPECIALIZED_OPERATORS(LINKED_SPECIALIZED_LABELS)
+    };
+#endif
+
+    //
+    // The instructions without a handler are executed on the script buffer
+    //
+    CodeBuffer.Head    = Code->Head;
+    CodeBuffer.Pointer = Code->Pointer;
+    CodeBuffer.Size    = Code->Pointer * sizeof(SYMBOL);
+
+    Index = 0;
+    goto Resume;
+
+Dispatch:
+    switch (Instruction->Handler)
+    {
+        LINKED_HANDLER(End)
+        return ScriptEngineLinkedExecutionCompleted;
+
+        LINKED_HANDLER(Mov)
+        LINKED_SET(1, LINKED_GET(0));
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Inc)
+        LINKED_SET(0, LINKED_GET(0) + 1);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Dec)
+        LINKED_SET(0, LINKED_GET(0) - 1);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Not)
+        LINKED_SET(1, ~LINKED_GET(0));
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Neg)
+        LINKED_SET(1, -(INT64)LINKED_GET(0));
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Add)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+        LINKED_SET(2, SrcVal1 + SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Sub)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+        LINKED_SET(2, SrcVal1 - SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Mul)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+        LINKED_SET(2, SrcVal1 * SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Div)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+
+        if (SrcVal0 == 0)
+        {
+            goto Error;
+        }
+
+        LINKED_SET(2, SrcVal1 / SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Mod)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+
+        if (SrcVal0 == 0)
+        {
+            goto Error;
+        }
+
+        LINKED_SET(2, SrcVal1 % SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Or)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+        LINKED_SET(2, SrcVal1 | SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(And)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+        LINKED_SET(2, SrcVal1 & SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Xor)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+        LINKED_SET(2, SrcVal1 ^ SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Asl)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+        LINKED_SET(2, SrcVal1 << SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Asr)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+        LINKED_SET(2, SrcVal1 >> SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Gt)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+        LINKED_SET(2, (INT64)SrcVal1 > (INT64)SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Lt)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+        LINKED_SET(2, (INT64)SrcVal1 < (INT64)SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Egt)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+        LINKED_SET(2, (INT64)SrcVal1 >= (INT64)SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Elt)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+        LINKED_SET(2, (INT64)SrcVal1 <= (INT64)SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Equal)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+        LINKED_SET(2, SrcVal1 == SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Neq)
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+        LINKED_SET(2, SrcVal1 != SrcVal0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Typed)
+
+        //
+        // The destination is a temp (checked by the linker), the operator and
+        // the type are read from the script buffer
+        //
+        if (ScriptGeneralRegisters->StackBaseIndx >= MAX_STACK_BUFFER_COUNT ||
+            Instruction->Operands[2] >= MAX_STACK_BUFFER_COUNT - ScriptGeneralRegisters->StackBaseIndx)
+        {
+            goto Error;
+        }
+
+        SrcVal0 = LINKED_GET(0);
+        SrcVal1 = LINKED_GET(1);
+
+        if (!ScriptEngineExecuteTypedBinary(Code->Head[Instruction->SymbolIndex].Value,
+                                            SrcVal0,
+                                            SrcVal1,
+                                            Code->Head[Instruction->SymbolIndex + 4].Value,
+                                            &DesVal))
+        {
+            goto Error;
+        }
+
+        ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackBaseIndx + Instruction->Operands[2]] = DesVal;
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Jmp)
+        LINKED_JUMP(Instruction->Operands[0]);
+
+        LINKED_HANDLER(Jz)
+        if (LINKED_GET(1) == 0)
+        {
+            LINKED_JUMP(Instruction->Operands[0]);
+        }
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Jnz)
+        if (LINKED_GET(1) != 0)
+        {
+            LINKED_JUMP(Instruction->Operands[0]);
+        }
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Push)
+        ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackIndx] = LINKED_GET(0);
+        ScriptGeneralRegisters->StackIndx++;
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Pop)
+        ScriptGeneralRegisters->StackIndx--;
+        LINKED_SET(0, ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackIndx]);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(Call)
+
+        //
+        // The return address is the symbol after the target (the same as ScriptEngineExecute)
+        //
+        ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackIndx] = (UINT64)Instruction->SymbolIndex + 2;
+        ScriptGeneralRegisters->StackIndx++;
+        LINKED_JUMP(Instruction->Operands[0]);
+
+        LINKED_HANDLER(Ret)
+        ScriptGeneralRegisters->StackIndx--;
+        Index = ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackIndx];
+        LINKED_CHECK_LIMITS();
+        goto Resume;
+
+        LINKED_HANDLER(MovTempTemp)
+        LINKED_OPERAND_Temp(1) = LINKED_OPERAND_Temp(0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(MovImmediateTemp)
+        LINKED_OPERAND_Temp(1) = LINKED_OPERAND_Immediate(0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(MovTempGlobal)
+        LINKED_OPERAND_Global(1) = LINKED_OPERAND_Temp(0);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(IncTemp)
+        LINKED_OPERAND_Temp(0)++;
+        LINKED_NEXT();
+
+        LINKED_HANDLER(DecTemp)
+        LINKED_OPERAND_Temp(0)--;
+        LINKED_NEXT();
+
+        LINKED_HANDLER(JzTemp)
+        if (LINKED_OPERAND_Temp(1) == 0)
+        {
+            LINKED_JUMP(Instruction->Operands[0]);
+        }
+        LINKED_NEXT();
+
+        LINKED_HANDLER(JnzTemp)
+        if (LINKED_OPERAND_Temp(1) != 0)
+        {
+            LINKED_JUMP(Instruction->Operands[0]);
+        }
+        LINKED_NEXT();
+
+        LINKED_HANDLER(CastInteger)
+        if (!LINKED_TEMP_IS_VALID(1))
+        {
+            goto Error;
+        }
+
+        SrcVal0 = LINKED_GET(0);
+
+        LINKED_OPERAND_Temp(1) = Instruction->Operands[2] == SCRIPT_SCALAR_TYPE_POINTER ?
+                                     SrcVal0 :
+                                     ScriptEngineNormalizeInteger(SrcVal0, Instruction->Operands[2]);
+        LINKED_NEXT();
+
+        LINKED_HANDLER(LogicalNotInteger)
+        if (!LINKED_TEMP_IS_VALID(1))
+        {
+            goto Error;
+        }
+
+        LINKED_OPERAND_Temp(1) = LINKED_GET(0) == 0;
+        LINKED_NEXT();
+
+        SCRIPT_ENGINE_LINKED_SPECIALIZED_OPERATORS(LINKED_SPECIALIZED_HANDLERS)
+
+        //
+        // The functions are only linked for the JIT, they are executed by
+        // ScriptEngineExecute
+        //
+        LINKED_HANDLER(Function)
+        LINKED_HANDLER(Generic)
+        Index = Instruction->SymbolIndex;
+        goto Interpret;
+
+    default:
+        break;
+    }
+
+Interpret:
+
+    //
+    // Execute a single instruction on the script buffer
+    //
+    if (ScriptEngineExecute(GuestRegs, ActionDetail, ScriptGeneralRegisters, &CodeBuffer, &Index, ErrorOperator) == TRUE)
+    {
+        return ScriptEngineLinkedExecutionError;
+    }
+
+    LINKED_CHECK_LIMITS();
+
+Resume:
+
+    //
+    // Continue from a symbol index (e.g., after the interpreted instructions or returns)
+    //
+    if (Index >= Code->Pointer)
+    {
+        return ScriptEngineLinkedExecutionCompleted;
+    }
+
+    if (Code->InstructionOfSymbol[Index] == SCRIPT_ENGINE_LINKED_NO_INSTRUCTION)
+    {
+        goto Interpret;
+    }
+
+    Instruction = &Code->Instructions[Code->InstructionOfSymbol[Index]];
+    goto Dispatch;
+
+Error:
+    *ErrorOperator = Code->Head[Instruction->SymbolIndex];
+    return ScriptEngineLinkedExecutionError;
+}
+
+#undef LINKED_HANDLER
+#undef LINKED_DISPATCH
+#undef LINKED_CHECK_LIMITS
+#undef LINKED_NEXT
+#undef LINKED_JUMP
+#undef LINKED_GET
+#undef LINKED_SET
+#undef LINKED_OPERAND_Immediate
+#undef LINKED_OPERAND_Temp
+#undef LINKED_OPERAND_Global
+#undef LINKED_OPERAND_Register
+#undef LINKED_TEMP_IS_VALID
+#undef LINKED_OPERATION_Add
+#undef LINKED_OPERATION_Sub
+#undef LINKED_OPERATION_Mul
+#undef LINKED_OPERATION_And
+#undef LINKED_OPERATION_Or
+#undef LINKED_OPERATION_Xor
+#undef LINKED_OPERATION_Gt
+#undef LINKED_OPERATION_Lt
+#undef LINKED_OPERATION_Egt
+#undef LINKED_OPERATION_Elt
+#undef LINKED_OPERATION_Above
+#undef LINKED_OPERATION_Below
+#undef LINKED_OPERATION_AboveOrEqual
+#undef LINKED_OPERATION_BelowOrEqual
+#undef LINKED_OPERATION_Equal
+#undef LINKED_OPERATION_Neq
+#undef LINKED_SPECIALIZED_HANDLER
+#undef LINKED_SPECIALIZED_HANDLERS
+#undef LINKED_SPECIALIZED_LABEL
+#undef LINKED_SPECIALIZED_LABELS
@@ -0,0 +1,1926 @@
+/**
+ * @file ScriptEngineJit.c
+ * @author M.H. Gholamrezaei (mh@hyperdbg.org)
+ * @brief JIT of the linked scripts to x86-64
+ * @details The native code of each linked instruction does the same as its
+ * handler in ScriptEngineExecuteLinked, the instructions that are not
+ * translated are executed by ScriptEngineExecute. The JIT is only available
+ * in user mode (libhyperdbg) on x86-64
+ * @version 0.19
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+#include "../script-eval/header/ScriptEngineInternalHeader.h"
+
+#if defined(SCRIPT_ENGINE_USER_MODE) && (defined(_M_X64) || defined(__x86_64__))
+
+//
+// *** Definitions ***
+//
+UINT64
+GetValue(PGUEST_REGS                      GuestRegs,
+         PACTION_BUFFER                   ActionBuffer,
+         PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters,
+         PSYMBOL                          Symbol,
+         BOOLEAN                          ReturnReference);
+
+VOID
+SetValue(PGUEST_REGS                       GuestRegs,
+         SCRIPT_ENGINE_GENERAL_REGISTERS * ScriptGeneralRegisters,
+         PSYMBOL                           Symbol,
+         UINT64                            Value);
+
+UINT64
+GetPseudoRegValue(PSYMBOL Symbol, PACTION_BUFFER ActionBuffer);
+
+//
+// Registers of x86-64 (the numbers of the encoding)
+//
+#define JIT_RAX 0
+#define JIT_RCX 1
+#define JIT_RDX 2
+#define JIT_RBX 3
+#define JIT_RSP 4
+#define JIT_RBP 5
+#define JIT_RSI 6
+#define JIT_RDI 7
+#define JIT_R8  8
+#define JIT_R9  9
+#define JIT_R11 11
+#define JIT_R12 12
+#define JIT_R13 13
+#define JIT_R14 14
+#define JIT_R15 15
+
+#define JIT_NO_INDEX 0xff
+
+//
+// Arguments of the calls (the same convention as the compiler of this file)
+//
+#if defined(_WIN32)
+#    define JIT_ARG0 JIT_RCX
+#    define JIT_ARG1 JIT_RDX
+#    define JIT_ARG2 JIT_R8
+#    define JIT_ARG3 JIT_R9
+#else
+#    define JIT_ARG0 JIT_RDI
+#    define JIT_ARG1 JIT_RSI
+#    define JIT_ARG2 JIT_RDX
+#    define JIT_ARG3 JIT_RCX
+#    define JIT_ARG4 JIT_R8
+#endif
+
+//
+// Registers that hold the state while the native code is executed (all of
+// them are preserved by the calls)
+//
+#define JIT_REGISTERS       JIT_RBX // PSCRIPT_ENGINE_GENERAL_REGISTERS
+#define JIT_STACK_BUFFER    JIT_R12 // ScriptGeneralRegisters->StackBuffer
+#define JIT_GLOBALS         JIT_RBP // ScriptGeneralRegisters->GlobalVariablesList
+#define JIT_GUEST_REGS      JIT_R13 // PGUEST_REGS
+#define JIT_FRAME           JIT_R14 // PSCRIPT_ENGINE_JIT_FRAME
+#define JIT_EXECUTION_COUNT JIT_R15 // the execution count (stored in the frame while the helpers are called)
+
+//
+// Layout of the stack of the native code: the home of the arguments (on
+// Windows), the fifth argument and a spilled value. The size keeps the
+// stack aligned after pushing the six registers
+//
+#define JIT_STACK_SIZE          72
+#define JIT_STACK_FIFTH_ARGUMENT 32
+#define JIT_STACK_SPILL          48
+
+//
+// Conditions of jcc and setcc
+//
+#define JIT_CONDITION_B  0x2
+#define JIT_CONDITION_AE 0x3
+#define JIT_CONDITION_E  0x4
+#define JIT_CONDITION_NE 0x5
+#define JIT_CONDITION_BE 0x6
+#define JIT_CONDITION_A  0x7
+#define JIT_CONDITION_L  0xc
+#define JIT_CONDITION_GE 0xd
+#define JIT_CONDITION_LE 0xe
+#define JIT_CONDITION_G  0xf
+
+//
+// Operand values that are greater than this are left for ScriptEngineExecute
+// (the offsets of the memory operands are 32-bit)
+//
+#define JIT_MAXIMUM_INDEX 0x0fffffff
+
+#define JIT_NO_LABEL 0xffffffff
+
+/**
+ * @brief Operations of the binary instructions (SrcVal1 <operation> SrcVal0)
+ *
+ */
+typedef enum _SCRIPT_ENGINE_JIT_OPERATION
+{
+    ScriptEngineJitOperationAdd = 0,
+    ScriptEngineJitOperationSub,
+    ScriptEngineJitOperationMul,
+    ScriptEngineJitOperationDiv,
+    ScriptEngineJitOperationMod,
+    ScriptEngineJitOperationOr,
+    ScriptEngineJitOperationAnd,
+    ScriptEngineJitOperationXor,
+    ScriptEngineJitOperationAsl,
+    ScriptEngineJitOperationAsr,
+    ScriptEngineJitOperationGt,
+    ScriptEngineJitOperationLt,
+    ScriptEngineJitOperationEgt,
+    ScriptEngineJitOperationElt,
+    ScriptEngineJitOperationAbove,
+    ScriptEngineJitOperationBelow,
+    ScriptEngineJitOperationAboveOrEqual,
+    ScriptEngineJitOperationBelowOrEqual,
+    ScriptEngineJitOperationEqual,
+    ScriptEngineJitOperationNeq,
+    ScriptEngineJitOperationSignedDiv,
+    ScriptEngineJitOperationSignedMod,
+    ScriptEngineJitOperationInvalid,
+
+} SCRIPT_ENGINE_JIT_OPERATION;
+
+/**
+ * @brief Labels that are shared by all of the instructions
+ *
+ * @details The labels of the instructions, their error stubs and their
+ * interpret stubs come after these labels
+ */
+typedef enum _SCRIPT_ENGINE_JIT_COMMON_LABEL
+{
+    ScriptEngineJitLabelStackOverflow = 0,
+    ScriptEngineJitLabelExecutionCountExceeded,
+    ScriptEngineJitLabelInterpret, // the symbol index is in rdx
+    ScriptEngineJitLabelResume,    // the symbol index is in rdx
+    ScriptEngineJitLabelResultExit,
+    ScriptEngineJitLabelEpilogue,
+    ScriptEngineJitLabelCount,
+
+} SCRIPT_ENGINE_JIT_COMMON_LABEL;
+
+/**
+ * @brief A jump (rel32) to a label that is not bound yet
+ *
+ */
+typedef struct _SCRIPT_ENGINE_JIT_FIXUP
+{
+    UINT32 Offset; // offset of the rel32
+    UINT32 Label;
+
+} SCRIPT_ENGINE_JIT_FIXUP, *PSCRIPT_ENGINE_JIT_FIXUP;
+
+/**
+ * @brief State of generating the native code of a linked code
+ *
+ */
+typedef struct _SCRIPT_ENGINE_JIT_EMITTER
+{
+    PSCRIPT_ENGINE_LINKED_CODE LinkedCode;
+    PSCRIPT_ENGINE_JIT_CODE    JitCode;
+    UINT8 *                    Buffer;
+    UINT32                     Size;
+    UINT32                     Capacity;
+    UINT32 *                   LabelOffsets; // JIT_NO_LABEL if the label is not bound
+    BOOLEAN *                  LabelIsUsed;
+    UINT32                     LabelCount;
+    PSCRIPT_ENGINE_JIT_FIXUP   Fixups;
+    UINT32                     FixupCount;
+    UINT32                     FixupCapacity;
+    BOOLEAN                    HasError; // an allocation is failed
+
+} SCRIPT_ENGINE_JIT_EMITTER, *PSCRIPT_ENGINE_JIT_EMITTER;
+
+//
+// Operations of the specialized handlers (in the same order as the handlers)
+//
+#define JIT_SPECIALIZED_OPERATION(Operator) ScriptEngineJitOperation##Operator,
+
+static const SCRIPT_ENGINE_JIT_OPERATION ScriptEngineJitSpecializedOperations[] = {
+    SCRIPT_ENGINE_LINKED_SPECIALIZED_OPERATORS(JIT_SPECIALIZED_OPERATION)};
+
+#undef JIT_SPECIALIZED_OPERATION
+
+//
+// *** Helpers of the native code ***
+//
+
+/**
+ * @brief Execute the instructions from a symbol index by ScriptEngineExecute
+ * up to the next instruction that has native code
+ *
+ * @param Frame
+ * @param Index The symbol index of the first instruction
+ *
+ * @return PVOID The native code to continue from, NULL if the execution is
+ * finished (the result is in the frame)
+ */
+static PVOID
+ScriptEngineJitInterpret(PSCRIPT_ENGINE_JIT_FRAME Frame, UINT64 Index)
+{
+    PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters = Frame->ScriptGeneralRegisters;
+
+    while (TRUE)
+    {
+        if (ScriptEngineExecute(Frame->GuestRegs,
+                                Frame->ActionDetail,
+                                ScriptGeneralRegisters,
+                                &Frame->CodeBuffer,
+                                &Index,
+                                Frame->ErrorOperator) == TRUE)
+        {
+            Frame->Result = ScriptEngineLinkedExecutionError;
+            return NULL;
+        }
+
+        if (ScriptGeneralRegisters->StackIndx >= MAX_STACK_BUFFER_COUNT)
+        {
+            Frame->Result = ScriptEngineLinkedExecutionStackOverflow;
+            return NULL;
+        }
+
+        if (Frame->ExecutionCount++ >= MAX_EXECUTION_COUNT)
+        {
+            Frame->Result = ScriptEngineLinkedExecutionExecutionCountExceeded;
+            return NULL;
+        }
+
+        if (Index >= Frame->CodeBuffer.Pointer)
+        {
+            Frame->Result = ScriptEngineLinkedExecutionCompleted;
+            return NULL;
+        }
+
+        if (Frame->Code->NativeOfSymbol[Index] != NULL)
+        {
+            return Frame->Code->NativeOfSymbol[Index];
+        }
+    }
+}
+
+/**
+ * @brief Continue from a symbol index (e.g., the start of the script or
+ * the returns to a symbol without native code)
+ *
+ * @param Frame
+ * @param Index
+ *
+ * @return PVOID The native code to continue from, NULL if the execution is
+ * finished (the result is in the frame)
+ */
+static PVOID
+ScriptEngineJitResume(PSCRIPT_ENGINE_JIT_FRAME Frame, UINT64 Index)
+{
+    if (Index >= Frame->CodeBuffer.Pointer)
+    {
+        Frame->Result = ScriptEngineLinkedExecutionCompleted;
+        return NULL;
+    }
+
+    if (Frame->Code->NativeOfSymbol[Index] != NULL)
+    {
+        return Frame->Code->NativeOfSymbol[Index];
+    }
+
+    return ScriptEngineJitInterpret(Frame, Index);
+}
+
+//
+// *** Emitter ***
+//
+
+/**
+ * @brief Emit a byte of the native code
+ *
+ * @param Emitter
+ * @param Byte
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitByte(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT8 Byte)
+{
+    if (Emitter->Size == Emitter->Capacity)
+    {
+        UINT32  Capacity = Emitter->Capacity * 2;
+        UINT8 * Buffer   = (UINT8 *)realloc(Emitter->Buffer, Capacity);
+
+        if (Buffer == NULL)
+        {
+            //
+            // The rest of the code is not emitted, the compilation fails at the end
+            //
+            Emitter->HasError = TRUE;
+            Emitter->Size     = 0;
+            return;
+        }
+
+        Emitter->Buffer   = Buffer;
+        Emitter->Capacity = Capacity;
+    }
+
+    Emitter->Buffer[Emitter->Size++] = Byte;
+}
+
+static VOID
+ScriptEngineJitEmitUint32(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT32 Value)
+{
+    for (UINT32 i = 0; i < 4; i++)
+    {
+        ScriptEngineJitEmitByte(Emitter, (UINT8)(Value >> (i * 8)));
+    }
+}
+
+static VOID
+ScriptEngineJitEmitUint64(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT64 Value)
+{
+    for (UINT32 i = 0; i < 8; i++)
+    {
+        ScriptEngineJitEmitByte(Emitter, (UINT8)(Value >> (i * 8)));
+    }
+}
+
+/**
+ * @brief Emit the REX prefix (if it's needed) and the opcode
+ *
+ * @param Emitter
+ * @param Is64Bit REX.W
+ * @param Opcode One byte, or two bytes that start with 0x0f
+ * @param Reg The register (or the extension of the opcode) of ModRM
+ * @param Index
+ * @param Base The register of r/m (or the base of the memory operand)
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitOpcode(PSCRIPT_ENGINE_JIT_EMITTER Emitter, BOOLEAN Is64Bit, UINT32 Opcode, UINT32 Reg, UINT32 Index, UINT32 Base)
+{
+    UINT8 Rex = 0x40;
+
+    if (Is64Bit)
+    {
+        Rex |= 0x8;
+    }
+    if (Reg & 8)
+    {
+        Rex |= 0x4;
+    }
+    if (Index != JIT_NO_INDEX && (Index & 8))
+    {
+        Rex |= 0x2;
+    }
+    if (Base & 8)
+    {
+        Rex |= 0x1;
+    }
+
+    if (Rex != 0x40)
+    {
+        ScriptEngineJitEmitByte(Emitter, Rex);
+    }
+
+    if (Opcode > 0xff)
+    {
+        ScriptEngineJitEmitByte(Emitter, (UINT8)(Opcode >> 8));
+    }
+
+    ScriptEngineJitEmitByte(Emitter, (UINT8)Opcode);
+}
+
+/**
+ * @brief Emit an instruction with a register operand (ModRM.mod = 3)
+ *
+ * @param Emitter
+ * @param Is64Bit
+ * @param Opcode
+ * @param Reg
+ * @param Rm
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitRegister(PSCRIPT_ENGINE_JIT_EMITTER Emitter, BOOLEAN Is64Bit, UINT32 Opcode, UINT32 Reg, UINT32 Rm)
+{
+    ScriptEngineJitEmitOpcode(Emitter, Is64Bit, Opcode, Reg, JIT_NO_INDEX, Rm);
+    ScriptEngineJitEmitByte(Emitter, (UINT8)(0xc0 | ((Reg & 7) << 3) | (Rm & 7)));
+}
+
+/**
+ * @brief Emit an instruction with a memory operand ([Base + Index * 8 + Displacement])
+ *
+ * @details The displacement is always 32-bit, so rbp and r13 don't need
+ * another encoding
+ *
+ * @param Emitter
+ * @param Is64Bit
+ * @param Opcode
+ * @param Reg
+ * @param Base
+ * @param Index JIT_NO_INDEX if the operand doesn't have an index
+ * @param Displacement
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitMemory(PSCRIPT_ENGINE_JIT_EMITTER Emitter,
+                          BOOLEAN                    Is64Bit,
+                          UINT32                     Opcode,
+                          UINT32                     Reg,
+                          UINT32                     Base,
+                          UINT32                     Index,
+                          INT32                      Displacement)
+{
+    ScriptEngineJitEmitOpcode(Emitter, Is64Bit, Opcode, Reg, Index, Base);
+
+    if (Index == JIT_NO_INDEX && (Base & 7) != JIT_RSP)
+    {
+        ScriptEngineJitEmitByte(Emitter, (UINT8)(0x80 | ((Reg & 7) << 3) | (Base & 7)));
+    }
+    else
+    {
+        //
+        // SIB, the index of rsp means no index
+        //
+        ScriptEngineJitEmitByte(Emitter, (UINT8)(0x80 | ((Reg & 7) << 3) | JIT_RSP));
+        ScriptEngineJitEmitByte(Emitter,
+                                Index == JIT_NO_INDEX ? (UINT8)((JIT_RSP << 3) | (Base & 7)) : (UINT8)(0xc0 | ((Index & 7) << 3) | (Base & 7)));
+    }
+
+    ScriptEngineJitEmitUint32(Emitter, (UINT32)Displacement);
+}
+
+static VOID
+ScriptEngineJitEmitLoad(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT32 Reg, UINT32 Base, UINT32 Index, INT32 Displacement)
+{
+    ScriptEngineJitEmitMemory(Emitter, TRUE, 0x8b, Reg, Base, Index, Displacement);
+}
+
+static VOID
+ScriptEngineJitEmitStore(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT32 Reg, UINT32 Base, UINT32 Index, INT32 Displacement)
+{
+    ScriptEngineJitEmitMemory(Emitter, TRUE, 0x89, Reg, Base, Index, Displacement);
+}
+
+static VOID
+ScriptEngineJitEmitMove(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT32 Destination, UINT32 Source)
+{
+    if (Destination != Source)
+    {
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x89, Source, Destination);
+    }
+}
+
+/**
+ * @brief Emit mov Reg, Value with the shortest encoding
+ *
+ * @param Emitter
+ * @param Reg
+ * @param Value
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitMoveImmediate(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT32 Reg, UINT64 Value)
+{
+    if (Value <= 0xffffffff)
+    {
+        //
+        // The 32-bit moves clear the upper half
+        //
+        ScriptEngineJitEmitOpcode(Emitter, FALSE, 0xb8 + (Reg & 7), 0, JIT_NO_INDEX, Reg);
+        ScriptEngineJitEmitUint32(Emitter, (UINT32)Value);
+    }
+    else if ((INT64)Value < 0 && (INT64)Value >= -0x80000000ll)
+    {
+        //
+        // Sign-extended imm32
+        //
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0xc7, 0, Reg);
+        ScriptEngineJitEmitUint32(Emitter, (UINT32)Value);
+    }
+    else
+    {
+        ScriptEngineJitEmitOpcode(Emitter, TRUE, 0xb8 + (Reg & 7), 0, JIT_NO_INDEX, Reg);
+        ScriptEngineJitEmitUint64(Emitter, Value);
+    }
+}
+
+static VOID
+ScriptEngineJitEmitCall(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT64 Function)
+{
+    ScriptEngineJitEmitMoveImmediate(Emitter, JIT_RAX, Function);
+    ScriptEngineJitEmitRegister(Emitter, FALSE, 0xff, 2, JIT_RAX);
+}
+
+/**
+ * @brief Emit the rel32 of a jump to a label
+ *
+ * @param Emitter
+ * @param Label
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitLabelReference(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT32 Label)
+{
+    if (Emitter->FixupCount == Emitter->FixupCapacity)
+    {
+        UINT32                   Capacity = Emitter->FixupCapacity * 2;
+        PSCRIPT_ENGINE_JIT_FIXUP Fixups   = (PSCRIPT_ENGINE_JIT_FIXUP)realloc(Emitter->Fixups, Capacity * sizeof(SCRIPT_ENGINE_JIT_FIXUP));
+
+        if (Fixups == NULL)
+        {
+            Emitter->HasError = TRUE;
+            return;
+        }
+
+        Emitter->Fixups        = Fixups;
+        Emitter->FixupCapacity = Capacity;
+    }
+
+    Emitter->Fixups[Emitter->FixupCount].Offset = Emitter->Size;
+    Emitter->Fixups[Emitter->FixupCount].Label  = Label;
+    Emitter->FixupCount++;
+
+    Emitter->LabelIsUsed[Label] = TRUE;
+
+    ScriptEngineJitEmitUint32(Emitter, 0);
+}
+
+static VOID
+ScriptEngineJitEmitJump(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT32 Label)
+{
+    ScriptEngineJitEmitByte(Emitter, 0xe9);
+    ScriptEngineJitEmitLabelReference(Emitter, Label);
+}
+
+static VOID
+ScriptEngineJitEmitConditionalJump(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT32 Condition, UINT32 Label)
+{
+    ScriptEngineJitEmitByte(Emitter, 0x0f);
+    ScriptEngineJitEmitByte(Emitter, (UINT8)(0x80 | Condition));
+    ScriptEngineJitEmitLabelReference(Emitter, Label);
+}
+
+static VOID
+ScriptEngineJitBindLabel(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT32 Label)
+{
+    Emitter->LabelOffsets[Label] = Emitter->Size;
+}
+
+static UINT32
+ScriptEngineJitInstructionLabel(UINT32 Instruction)
+{
+    return ScriptEngineJitLabelCount + Instruction;
+}
+
+static UINT32
+ScriptEngineJitErrorLabel(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT32 Instruction)
+{
+    return ScriptEngineJitLabelCount + Emitter->LinkedCode->InstructionCount + Instruction;
+}
+
+static UINT32
+ScriptEngineJitInterpretLabel(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT32 Instruction)
+{
+    return ScriptEngineJitLabelCount + Emitter->LinkedCode->InstructionCount * 2 + Instruction;
+}
+
+//
+// *** Operands ***
+//
+
+static UINT32
+ScriptEngineJitOperandKind(PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction, UINT32 Operand)
+{
+    return (Instruction->OperandKinds >> (Operand * 4)) & 0xf;
+}
+
+/**
+ * @brief Check whether getting an operand calls a function (the argument
+ * registers and rax are changed)
+ *
+ * @param Instruction
+ * @param Operand
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ScriptEngineJitOperandIsCall(PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction, UINT32 Operand)
+{
+    UINT32 Kind = ScriptEngineJitOperandKind(Instruction, Operand);
+
+    return Kind == ScriptEngineLinkedOperandSymbol || Kind == ScriptEngineLinkedOperandPseudoRegister;
+}
+
+/**
+ * @brief Check whether the operands of an instruction can be encoded
+ *
+ * @param Instruction
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ScriptEngineJitOperandsAreEncodable(PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction)
+{
+    for (UINT32 Operand = 0; Operand < 3; Operand++)
+    {
+        switch (ScriptEngineJitOperandKind(Instruction, Operand))
+        {
+        case ScriptEngineLinkedOperandGlobal:
+        case ScriptEngineLinkedOperandTemp:
+        case ScriptEngineLinkedOperandParameter:
+        case ScriptEngineLinkedOperandRegister:
+        case ScriptEngineLinkedOperandPercpu:
+
+            if (Instruction->Operands[Operand] > JIT_MAXIMUM_INDEX)
+            {
+                return FALSE;
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Emit r11 = ScriptGeneralRegisters->StackBaseIndx
+ *
+ * @param Emitter
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitLoadStackBase(PSCRIPT_ENGINE_JIT_EMITTER Emitter)
+{
+    ScriptEngineJitEmitLoad(Emitter, JIT_R11, JIT_REGISTERS, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_GENERAL_REGISTERS, StackBaseIndx));
+}
+
+/**
+ * @brief Emit r11 = ScriptGeneralRegisters->PercpuVariablesList
+ *
+ * @param Emitter
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitLoadPercpuVariables(PSCRIPT_ENGINE_JIT_EMITTER Emitter)
+{
+    ScriptEngineJitEmitLoad(Emitter, JIT_R11, JIT_REGISTERS, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_GENERAL_REGISTERS, PercpuVariablesList));
+}
+
+/**
+ * @brief Emit getting the value of an operand (the same as ScriptEngineLinkedGetValue)
+ *
+ * @param Emitter
+ * @param Instruction
+ * @param Operand
+ * @param Reg
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitGetOperand(PSCRIPT_ENGINE_JIT_EMITTER        Emitter,
+                              PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction,
+                              UINT32                            Operand,
+                              UINT32                            Reg)
+{
+    UINT64 Value = Instruction->Operands[Operand];
+
+    switch (ScriptEngineJitOperandKind(Instruction, Operand))
+    {
+    case ScriptEngineLinkedOperandImmediate:
+        ScriptEngineJitEmitMoveImmediate(Emitter, Reg, Value);
+        break;
+
+    case ScriptEngineLinkedOperandGlobal:
+        ScriptEngineJitEmitLoad(Emitter, Reg, JIT_GLOBALS, JIT_NO_INDEX, (INT32)(Value * sizeof(UINT64)));
+        break;
+
+    case ScriptEngineLinkedOperandPercpu:
+        ScriptEngineJitEmitLoadPercpuVariables(Emitter);
+        ScriptEngineJitEmitLoad(Emitter, Reg, JIT_R11, JIT_NO_INDEX, (INT32)(Value * sizeof(UINT64)));
+        break;
+
+    case ScriptEngineLinkedOperandTemp:
+        ScriptEngineJitEmitLoadStackBase(Emitter);
+        ScriptEngineJitEmitLoad(Emitter, Reg, JIT_STACK_BUFFER, JIT_R11, (INT32)(Value * sizeof(UINT64)));
+        break;
+
+    case ScriptEngineLinkedOperandParameter:
+        ScriptEngineJitEmitLoadStackBase(Emitter);
+        ScriptEngineJitEmitLoad(Emitter, Reg, JIT_STACK_BUFFER, JIT_R11, -(INT32)((3 + Value) * sizeof(UINT64)));
+        break;
+
+    case ScriptEngineLinkedOperandRegister:
+        ScriptEngineJitEmitLoad(Emitter, Reg, JIT_GUEST_REGS, JIT_NO_INDEX, (INT32)(Value * sizeof(UINT64)));
+        break;
+
+    case ScriptEngineLinkedOperandPseudoRegister:
+        ScriptEngineJitEmitMoveImmediate(Emitter, JIT_ARG0, Value);
+        ScriptEngineJitEmitLoad(Emitter, JIT_ARG1, JIT_FRAME, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_JIT_FRAME, ActionDetail));
+        ScriptEngineJitEmitCall(Emitter, (UINT64)GetPseudoRegValue);
+        ScriptEngineJitEmitMove(Emitter, Reg, JIT_RAX);
+        break;
+
+    default:
+        ScriptEngineJitEmitMove(Emitter, JIT_ARG0, JIT_GUEST_REGS);
+        ScriptEngineJitEmitLoad(Emitter, JIT_ARG1, JIT_FRAME, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_JIT_FRAME, ActionDetail));
+        ScriptEngineJitEmitMove(Emitter, JIT_ARG2, JIT_REGISTERS);
+        ScriptEngineJitEmitMoveImmediate(Emitter, JIT_ARG3, Value);
+#if defined(_WIN32)
+        ScriptEngineJitEmitMemory(Emitter, TRUE, 0xc7, 0, JIT_RSP, JIT_NO_INDEX, JIT_STACK_FIFTH_ARGUMENT);
+        ScriptEngineJitEmitUint32(Emitter, FALSE);
+#else
+        ScriptEngineJitEmitMoveImmediate(Emitter, JIT_ARG4, FALSE);
+#endif
+        ScriptEngineJitEmitCall(Emitter, (UINT64)GetValue);
+        ScriptEngineJitEmitMove(Emitter, Reg, JIT_RAX);
+        break;
+    }
+}
+
+/**
+ * @brief Emit setting an operand to rax (the same as ScriptEngineLinkedSetValue)
+ *
+ * @param Emitter
+ * @param Instruction
+ * @param Operand
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitSetOperand(PSCRIPT_ENGINE_JIT_EMITTER        Emitter,
+                              PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction,
+                              UINT32                            Operand)
+{
+    UINT64 Destination = Instruction->Operands[Operand];
+
+    switch (ScriptEngineJitOperandKind(Instruction, Operand))
+    {
+    case ScriptEngineLinkedOperandImmediate:
+    case ScriptEngineLinkedOperandRegister:
+    case ScriptEngineLinkedOperandPseudoRegister:
+        break;
+
+    case ScriptEngineLinkedOperandGlobal:
+        ScriptEngineJitEmitStore(Emitter, JIT_RAX, JIT_GLOBALS, JIT_NO_INDEX, (INT32)(Destination * sizeof(UINT64)));
+        break;
+
+    case ScriptEngineLinkedOperandPercpu:
+        ScriptEngineJitEmitLoadPercpuVariables(Emitter);
+        ScriptEngineJitEmitStore(Emitter, JIT_RAX, JIT_R11, JIT_NO_INDEX, (INT32)(Destination * sizeof(UINT64)));
+        break;
+
+    case ScriptEngineLinkedOperandTemp:
+        ScriptEngineJitEmitLoadStackBase(Emitter);
+        ScriptEngineJitEmitStore(Emitter, JIT_RAX, JIT_STACK_BUFFER, JIT_R11, (INT32)(Destination * sizeof(UINT64)));
+        break;
+
+    case ScriptEngineLinkedOperandParameter:
+        ScriptEngineJitEmitLoadStackBase(Emitter);
+        ScriptEngineJitEmitStore(Emitter, JIT_RAX, JIT_STACK_BUFFER, JIT_R11, -(INT32)((3 + Destination) * sizeof(UINT64)));
+        break;
+
+    default:
+        ScriptEngineJitEmitMove(Emitter, JIT_ARG3, JIT_RAX);
+        ScriptEngineJitEmitMove(Emitter, JIT_ARG0, JIT_GUEST_REGS);
+        ScriptEngineJitEmitMove(Emitter, JIT_ARG1, JIT_REGISTERS);
+        ScriptEngineJitEmitMoveImmediate(Emitter, JIT_ARG2, Destination);
+        ScriptEngineJitEmitCall(Emitter, (UINT64)SetValue);
+        break;
+    }
+}
+
+/**
+ * @brief Emit getting the operands of a binary instruction (rcx = SrcVal0
+ * and rdx = SrcVal1), in the same order as the linked handlers
+ *
+ * @param Emitter
+ * @param Instruction
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitGetBinaryOperands(PSCRIPT_ENGINE_JIT_EMITTER Emitter, PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction)
+{
+    if (ScriptEngineJitOperandIsCall(Instruction, 1))
+    {
+        //
+        // The first operand is kept on the stack during the call
+        //
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 0, JIT_RAX);
+        ScriptEngineJitEmitStore(Emitter, JIT_RAX, JIT_RSP, JIT_NO_INDEX, JIT_STACK_SPILL);
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 1, JIT_RDX);
+        ScriptEngineJitEmitLoad(Emitter, JIT_RCX, JIT_RSP, JIT_NO_INDEX, JIT_STACK_SPILL);
+    }
+    else
+    {
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 0, JIT_RCX);
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 1, JIT_RDX);
+    }
+}
+
+/**
+ * @brief Emit jumping to a label if a temp is not in the stack buffer (the
+ * same as LINKED_TEMP_IS_VALID)
+ *
+ * @param Emitter
+ * @param Instruction
+ * @param Operand
+ * @param Label
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitCheckTemp(PSCRIPT_ENGINE_JIT_EMITTER        Emitter,
+                             PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction,
+                             UINT32                            Operand,
+                             UINT32                            Label)
+{
+    UINT64 Temp = Instruction->Operands[Operand];
+
+    if (Temp >= MAX_STACK_BUFFER_COUNT)
+    {
+        ScriptEngineJitEmitJump(Emitter, Label);
+        return;
+    }
+
+    //
+    // StackBaseIndx < MAX_STACK_BUFFER_COUNT - Temp
+    //
+    ScriptEngineJitEmitLoadStackBase(Emitter);
+    ScriptEngineJitEmitRegister(Emitter, TRUE, 0x81, 7, JIT_R11);
+    ScriptEngineJitEmitUint32(Emitter, (UINT32)(MAX_STACK_BUFFER_COUNT - Temp));
+    ScriptEngineJitEmitConditionalJump(Emitter, JIT_CONDITION_AE, Label);
+}
+
+//
+// *** Instructions ***
+//
+
+/**
+ * @brief Emit the checks of the limits after an instruction (the same as
+ * LINKED_CHECK_LIMITS)
+ *
+ * @details Nothing is emitted for the bounded codes
+ *
+ * @param Emitter
+ * @param CheckStack Whether the instruction may change StackIndx
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitCheckLimits(PSCRIPT_ENGINE_JIT_EMITTER Emitter, BOOLEAN CheckStack)
+{
+    if (Emitter->LinkedCode->IsBounded)
+    {
+        return;
+    }
+
+    if (CheckStack)
+    {
+        ScriptEngineJitEmitMemory(Emitter, TRUE, 0x81, 7, JIT_REGISTERS, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_GENERAL_REGISTERS, StackIndx));
+        ScriptEngineJitEmitUint32(Emitter, MAX_STACK_BUFFER_COUNT);
+        ScriptEngineJitEmitConditionalJump(Emitter, JIT_CONDITION_AE, ScriptEngineJitLabelStackOverflow);
+    }
+
+    //
+    // ExecutionCount++ >= MAX_EXECUTION_COUNT
+    //
+    ScriptEngineJitEmitRegister(Emitter, TRUE, 0xff, 0, JIT_EXECUTION_COUNT);
+    ScriptEngineJitEmitRegister(Emitter, TRUE, 0x81, 7, JIT_EXECUTION_COUNT);
+    ScriptEngineJitEmitUint32(Emitter, MAX_EXECUTION_COUNT);
+    ScriptEngineJitEmitConditionalJump(Emitter, JIT_CONDITION_A, ScriptEngineJitLabelExecutionCountExceeded);
+}
+
+/**
+ * @brief Emit normalizing a register to an integer type (the same as
+ * ScriptEngineNormalizeInteger)
+ *
+ * @param Emitter
+ * @param Reg rax, rcx or rdx
+ * @param Type
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitNormalize(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT32 Reg, UINT64 Type)
+{
+    switch (Type)
+    {
+    case SCRIPT_SCALAR_TYPE_BOOL:
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x85, Reg, Reg);
+        ScriptEngineJitEmitRegister(Emitter, FALSE, 0x0f90 | JIT_CONDITION_NE, 0, Reg);
+        ScriptEngineJitEmitRegister(Emitter, FALSE, 0x0fb6, Reg, Reg);
+        break;
+    case SCRIPT_SCALAR_TYPE_I8:
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x0fbe, Reg, Reg);
+        break;
+    case SCRIPT_SCALAR_TYPE_I16:
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x0fbf, Reg, Reg);
+        break;
+    case SCRIPT_SCALAR_TYPE_I32:
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x63, Reg, Reg);
+        break;
+    case SCRIPT_SCALAR_TYPE_U8:
+        ScriptEngineJitEmitRegister(Emitter, FALSE, 0x0fb6, Reg, Reg);
+        break;
+    case SCRIPT_SCALAR_TYPE_U16:
+        ScriptEngineJitEmitRegister(Emitter, FALSE, 0x0fb7, Reg, Reg);
+        break;
+    case SCRIPT_SCALAR_TYPE_U32:
+        ScriptEngineJitEmitRegister(Emitter, FALSE, 0x89, Reg, Reg);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Emit rax = rdx <operation> rcx
+ *
+ * @param Emitter
+ * @param Operation
+ * @param ErrorLabel The label of the division by zero
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitOperation(PSCRIPT_ENGINE_JIT_EMITTER Emitter, SCRIPT_ENGINE_JIT_OPERATION Operation, UINT32 ErrorLabel)
+{
+    UINT32 Condition;
+
+    switch (Operation)
+    {
+    case ScriptEngineJitOperationAdd:
+        ScriptEngineJitEmitMove(Emitter, JIT_RAX, JIT_RDX);
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x01, JIT_RCX, JIT_RAX);
+        return;
+    case ScriptEngineJitOperationSub:
+        ScriptEngineJitEmitMove(Emitter, JIT_RAX, JIT_RDX);
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x29, JIT_RCX, JIT_RAX);
+        return;
+    case ScriptEngineJitOperationMul:
+        ScriptEngineJitEmitMove(Emitter, JIT_RAX, JIT_RDX);
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x0faf, JIT_RAX, JIT_RCX);
+        return;
+    case ScriptEngineJitOperationOr:
+        ScriptEngineJitEmitMove(Emitter, JIT_RAX, JIT_RDX);
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x09, JIT_RCX, JIT_RAX);
+        return;
+    case ScriptEngineJitOperationAnd:
+        ScriptEngineJitEmitMove(Emitter, JIT_RAX, JIT_RDX);
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x21, JIT_RCX, JIT_RAX);
+        return;
+    case ScriptEngineJitOperationXor:
+        ScriptEngineJitEmitMove(Emitter, JIT_RAX, JIT_RDX);
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x31, JIT_RCX, JIT_RAX);
+        return;
+    case ScriptEngineJitOperationAsl:
+    case ScriptEngineJitOperationAsr:
+
+        //
+        // The count is masked the same as the shifts of the compiled evaluator
+        //
+        ScriptEngineJitEmitMove(Emitter, JIT_RAX, JIT_RDX);
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0xd3, Operation == ScriptEngineJitOperationAsl ? 4 : 5, JIT_RAX);
+        return;
+    case ScriptEngineJitOperationDiv:
+    case ScriptEngineJitOperationMod:
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x85, JIT_RCX, JIT_RCX);
+        ScriptEngineJitEmitConditionalJump(Emitter, JIT_CONDITION_E, ErrorLabel);
+        ScriptEngineJitEmitMove(Emitter, JIT_RAX, JIT_RDX);
+        ScriptEngineJitEmitRegister(Emitter, FALSE, 0x31, JIT_RDX, JIT_RDX);
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0xf7, 6, JIT_RCX);
+
+        if (Operation == ScriptEngineJitOperationMod)
+        {
+            ScriptEngineJitEmitMove(Emitter, JIT_RAX, JIT_RDX);
+        }
+        return;
+    case ScriptEngineJitOperationSignedDiv:
+    case ScriptEngineJitOperationSignedMod:
+
+        //
+        // mov rax, rdx / cqo / idiv rcx (the overflow is checked before)
+        //
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x85, JIT_RCX, JIT_RCX);
+        ScriptEngineJitEmitConditionalJump(Emitter, JIT_CONDITION_E, ErrorLabel);
+        ScriptEngineJitEmitMove(Emitter, JIT_RAX, JIT_RDX);
+        ScriptEngineJitEmitByte(Emitter, 0x48);
+        ScriptEngineJitEmitByte(Emitter, 0x99);
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0xf7, 7, JIT_RCX);
+
+        if (Operation == ScriptEngineJitOperationSignedMod)
+        {
+            ScriptEngineJitEmitMove(Emitter, JIT_RAX, JIT_RDX);
+        }
+        return;
+    case ScriptEngineJitOperationGt:
+        Condition = JIT_CONDITION_G;
+        break;
+    case ScriptEngineJitOperationLt:
+        Condition = JIT_CONDITION_L;
+        break;
+    case ScriptEngineJitOperationEgt:
+        Condition = JIT_CONDITION_GE;
+        break;
+    case ScriptEngineJitOperationElt:
+        Condition = JIT_CONDITION_LE;
+        break;
+    case ScriptEngineJitOperationAbove:
+        Condition = JIT_CONDITION_A;
+        break;
+    case ScriptEngineJitOperationBelow:
+        Condition = JIT_CONDITION_B;
+        break;
+    case ScriptEngineJitOperationAboveOrEqual:
+        Condition = JIT_CONDITION_AE;
+        break;
+    case ScriptEngineJitOperationBelowOrEqual:
+        Condition = JIT_CONDITION_BE;
+        break;
+    case ScriptEngineJitOperationEqual:
+        Condition = JIT_CONDITION_E;
+        break;
+    default:
+        Condition = JIT_CONDITION_NE;
+        break;
+    }
+
+    //
+    // xor eax, eax / cmp rdx, rcx / setcc al
+    //
+    ScriptEngineJitEmitRegister(Emitter, FALSE, 0x31, JIT_RAX, JIT_RAX);
+    ScriptEngineJitEmitRegister(Emitter, TRUE, 0x39, JIT_RCX, JIT_RDX);
+    ScriptEngineJitEmitRegister(Emitter, FALSE, 0x0f90 | Condition, 0, JIT_RAX);
+}
+
+/**
+ * @brief Emit jumping to the error label if a signed division overflows
+ * (the minimum of the type divided by -1, the same as ScriptEngineExecuteTypedBinary)
+ *
+ * @param Emitter
+ * @param Type
+ * @param ErrorLabel
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitCheckSignedDivision(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT64 Type, UINT32 ErrorLabel)
+{
+    UINT32 Width = Type == SCRIPT_SCALAR_TYPE_I8 ? 8 : Type == SCRIPT_SCALAR_TYPE_I16 ? 16 :
+                   Type == SCRIPT_SCALAR_TYPE_I32 ? 32 : 64;
+
+    //
+    // The operands are sign-extended, so the minimum is sign-extended too
+    //
+    ScriptEngineJitEmitMoveImmediate(Emitter, JIT_RAX, (UINT64)0 - (1ULL << (Width - 1)));
+    ScriptEngineJitEmitRegister(Emitter, TRUE, 0x39, JIT_RAX, JIT_RDX);
+
+    //
+    // jne over (cmp rcx, -1 / je ErrorLabel)
+    //
+    ScriptEngineJitEmitByte(Emitter, 0x70 | JIT_CONDITION_NE);
+    ScriptEngineJitEmitByte(Emitter, 10);
+    ScriptEngineJitEmitRegister(Emitter, TRUE, 0x83, 7, JIT_RCX);
+    ScriptEngineJitEmitByte(Emitter, 0xff);
+    ScriptEngineJitEmitConditionalJump(Emitter, JIT_CONDITION_E, ErrorLabel);
+}
+
+/**
+ * @brief Check whether an operation is a comparison (the results of the
+ * typed comparisons are not normalized)
+ *
+ * @param Operation
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ScriptEngineJitOperationIsComparison(SCRIPT_ENGINE_JIT_OPERATION Operation)
+{
+    return Operation >= ScriptEngineJitOperationGt && Operation <= ScriptEngineJitOperationNeq;
+}
+
+/**
+ * @brief Get the operation of a typed instruction that the JIT translates
+ *
+ * @param Operator
+ * @param Type
+ *
+ * @return SCRIPT_ENGINE_JIT_OPERATION ScriptEngineJitOperationInvalid if
+ * the instruction is left for ScriptEngineExecute
+ */
+static SCRIPT_ENGINE_JIT_OPERATION
+ScriptEngineJitTypedOperation(UINT64 Operator, UINT64 Type)
+{
+    BOOLEAN IsInteger = Type >= SCRIPT_SCALAR_TYPE_BOOL && Type <= SCRIPT_SCALAR_TYPE_U64;
+    BOOLEAN IsSigned  = Type == SCRIPT_SCALAR_TYPE_I8 || Type == SCRIPT_SCALAR_TYPE_I16 ||
+                       Type == SCRIPT_SCALAR_TYPE_I32 || Type == SCRIPT_SCALAR_TYPE_I64;
+
+    if (!IsInteger && Type != SCRIPT_SCALAR_TYPE_POINTER)
+    {
+        return ScriptEngineJitOperationInvalid;
+    }
+
+    //
+    // The pointers can only be compared, the shifts are left for
+    // ScriptEngineExecute (they have their own errors)
+    //
+    switch (Operator)
+    {
+    case FUNC_ADD_TYPED:
+        return IsInteger ? ScriptEngineJitOperationAdd : ScriptEngineJitOperationInvalid;
+    case FUNC_SUB_TYPED:
+        return IsInteger ? ScriptEngineJitOperationSub : ScriptEngineJitOperationInvalid;
+    case FUNC_MUL_TYPED:
+        return IsInteger ? ScriptEngineJitOperationMul : ScriptEngineJitOperationInvalid;
+    case FUNC_DIV_TYPED:
+        return !IsInteger ? ScriptEngineJitOperationInvalid : IsSigned ? ScriptEngineJitOperationSignedDiv :
+                                                                         ScriptEngineJitOperationDiv;
+    case FUNC_MOD_TYPED:
+        return !IsInteger ? ScriptEngineJitOperationInvalid : IsSigned ? ScriptEngineJitOperationSignedMod :
+                                                                         ScriptEngineJitOperationMod;
+    case FUNC_BITWISE_AND_TYPED:
+        return IsInteger ? ScriptEngineJitOperationAnd : ScriptEngineJitOperationInvalid;
+    case FUNC_BITWISE_OR_TYPED:
+        return IsInteger ? ScriptEngineJitOperationOr : ScriptEngineJitOperationInvalid;
+    case FUNC_BITWISE_XOR_TYPED:
+        return IsInteger ? ScriptEngineJitOperationXor : ScriptEngineJitOperationInvalid;
+    case FUNC_GT_TYPED:
+        return IsSigned ? ScriptEngineJitOperationGt : ScriptEngineJitOperationAbove;
+    case FUNC_LT_TYPED:
+        return IsSigned ? ScriptEngineJitOperationLt : ScriptEngineJitOperationBelow;
+    case FUNC_EGT_TYPED:
+        return IsSigned ? ScriptEngineJitOperationEgt : ScriptEngineJitOperationAboveOrEqual;
+    case FUNC_ELT_TYPED:
+        return IsSigned ? ScriptEngineJitOperationElt : ScriptEngineJitOperationBelowOrEqual;
+    case FUNC_EQUAL_TYPED:
+        return ScriptEngineJitOperationEqual;
+    case FUNC_NEQ_TYPED:
+        return ScriptEngineJitOperationNeq;
+    default:
+        return ScriptEngineJitOperationInvalid;
+    }
+}
+
+/**
+ * @brief Emit a call to a built-in function (ScriptEngineLinkedHandlerFunction)
+ *
+ * @param Emitter
+ * @param Instruction
+ *
+ * @return BOOLEAN FALSE if the function is left for ScriptEngineExecute
+ */
+static BOOLEAN
+ScriptEngineJitEmitFunction(PSCRIPT_ENGINE_JIT_EMITTER Emitter, PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction)
+{
+    UINT64 Operator = Emitter->LinkedCode->Head[Instruction->SymbolIndex].Value;
+    UINT64 Function;
+
+    switch (Operator)
+    {
+    case FUNC_RDTSC:
+    case FUNC_RDTSCP:
+        ScriptEngineJitEmitCall(Emitter, Operator == FUNC_RDTSC ? (UINT64)ScriptEngineFunctionRdtsc : (UINT64)ScriptEngineFunctionRdtscp);
+        ScriptEngineJitEmitSetOperand(Emitter, Instruction, 0);
+        return TRUE;
+
+    case FUNC_EVENT_ENABLE:
+    case FUNC_EVENT_DISABLE:
+    case FUNC_EVENT_CLEAR:
+    case FUNC_MICROSLEEP:
+
+        Function = Operator == FUNC_EVENT_ENABLE  ? (UINT64)ScriptEngineFunctionEventEnable :
+                   Operator == FUNC_EVENT_DISABLE ? (UINT64)ScriptEngineFunctionEventDisable :
+                   Operator == FUNC_EVENT_CLEAR   ? (UINT64)ScriptEngineFunctionEventClear :
+                                                    (UINT64)ScriptEngineFunctionMicroSleep;
+
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 0, JIT_RAX);
+        ScriptEngineJitEmitMove(Emitter, JIT_ARG0, JIT_RAX);
+        ScriptEngineJitEmitCall(Emitter, Function);
+        return TRUE;
+
+    case FUNC_PRINT:
+
+        //
+        // ScriptEngineFunctionPrint(ActionDetail->Tag, ActionDetail->ImmediatelySendTheResults, Value)
+        //
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 0, JIT_RAX);
+        ScriptEngineJitEmitMove(Emitter, JIT_ARG2, JIT_RAX);
+        ScriptEngineJitEmitLoad(Emitter, JIT_ARG0, JIT_FRAME, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_JIT_FRAME, ActionDetail));
+        ScriptEngineJitEmitMemory(Emitter, FALSE, 0x0fb6, JIT_ARG1, JIT_ARG0, JIT_NO_INDEX, offsetof(ACTION_BUFFER, ImmediatelySendTheResults));
+        ScriptEngineJitEmitLoad(Emitter, JIT_ARG0, JIT_ARG0, JIT_NO_INDEX, offsetof(ACTION_BUFFER, Tag));
+        ScriptEngineJitEmitCall(Emitter, (UINT64)ScriptEngineFunctionPrint);
+        return TRUE;
+
+    case FUNC_VIRTUAL_TO_PHYSICAL:
+    case FUNC_PHYSICAL_TO_VIRTUAL:
+    case FUNC_STRLEN:
+    case FUNC_WCSLEN:
+
+        Function = Operator == FUNC_VIRTUAL_TO_PHYSICAL ? (UINT64)ScriptEngineFunctionVirtualToPhysical :
+                   Operator == FUNC_PHYSICAL_TO_VIRTUAL ? (UINT64)ScriptEngineFunctionPhysicalToVirtual :
+                   Operator == FUNC_STRLEN              ? (UINT64)ScriptEngineFunctionStrlen :
+                                                          (UINT64)ScriptEngineFunctionWcslen;
+
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 0, JIT_RAX);
+        ScriptEngineJitEmitMove(Emitter, JIT_ARG0, JIT_RAX);
+        ScriptEngineJitEmitCall(Emitter, Function);
+        ScriptEngineJitEmitSetOperand(Emitter, Instruction, 1);
+        return TRUE;
+
+    case FUNC_DISASSEMBLE_LEN:
+    case FUNC_DISASSEMBLE_LEN64:
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 0, JIT_RAX);
+        ScriptEngineJitEmitMove(Emitter, JIT_ARG0, JIT_RAX);
+        ScriptEngineJitEmitMoveImmediate(Emitter, JIT_ARG1, FALSE);
+        ScriptEngineJitEmitCall(Emitter, (UINT64)ScriptEngineFunctionDisassembleLen);
+        ScriptEngineJitEmitSetOperand(Emitter, Instruction, 1);
+        return TRUE;
+
+    case FUNC_CHECK_ADDRESS:
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 0, JIT_RAX);
+        ScriptEngineJitEmitMove(Emitter, JIT_ARG0, JIT_RAX);
+        ScriptEngineJitEmitMoveImmediate(Emitter, JIT_ARG1, sizeof(BYTE));
+        ScriptEngineJitEmitCall(Emitter, (UINT64)ScriptEngineFunctionCheckAddress);
+
+        //
+        // Only al is returned (BOOLEAN), test al, al / setne al / movzx eax, al
+        //
+        ScriptEngineJitEmitRegister(Emitter, FALSE, 0x84, JIT_RAX, JIT_RAX);
+        ScriptEngineJitEmitRegister(Emitter, FALSE, 0x0f90 | JIT_CONDITION_NE, 0, JIT_RAX);
+        ScriptEngineJitEmitRegister(Emitter, FALSE, 0x0fb6, JIT_RAX, JIT_RAX);
+        ScriptEngineJitEmitSetOperand(Emitter, Instruction, 1);
+        return TRUE;
+
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Emit jumping to the interpret stub of an instruction
+ *
+ * @param Emitter
+ * @param InstructionIndex
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitInterpret(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT32 InstructionIndex)
+{
+    ScriptEngineJitEmitJump(Emitter, ScriptEngineJitInterpretLabel(Emitter, InstructionIndex));
+}
+
+/**
+ * @brief Emit the native code of a linked instruction
+ *
+ * @param Emitter
+ * @param InstructionIndex
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitInstruction(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT32 InstructionIndex)
+{
+    PSCRIPT_ENGINE_LINKED_CODE        Code         = Emitter->LinkedCode;
+    PSCRIPT_ENGINE_LINKED_INSTRUCTION Instruction  = &Code->Instructions[InstructionIndex];
+    UINT32                            ErrorLabel   = ScriptEngineJitErrorLabel(Emitter, InstructionIndex);
+    UINT32                            Handler      = Instruction->Handler;
+    SCRIPT_ENGINE_JIT_OPERATION       Operation    = ScriptEngineJitOperationInvalid;
+    BOOLEAN                           CheckStack   = InstructionIndex == 0;
+    UINT64                            Type;
+
+    if (Handler == ScriptEngineLinkedHandlerEnd)
+    {
+        ScriptEngineJitEmitMoveImmediate(Emitter, JIT_RAX, ScriptEngineLinkedExecutionCompleted);
+        ScriptEngineJitEmitJump(Emitter, ScriptEngineJitLabelEpilogue);
+        return;
+    }
+
+    if (Handler == ScriptEngineLinkedHandlerGeneric || !ScriptEngineJitOperandsAreEncodable(Instruction))
+    {
+        ScriptEngineJitEmitInterpret(Emitter, InstructionIndex);
+        return;
+    }
+
+    //
+    // The stack index is only changed by the stack instructions and by
+    // SetValue (the first instruction checks the stack index of the caller)
+    //
+    for (UINT32 Operand = 0; Operand < 3; Operand++)
+    {
+        if (ScriptEngineJitOperandKind(Instruction, Operand) == ScriptEngineLinkedOperandSymbol)
+        {
+            CheckStack = TRUE;
+        }
+    }
+
+    if (Handler >= ScriptEngineLinkedHandlerAddTempTemp)
+    {
+        //
+        // The specialized handlers leave the invalid destinations for ScriptEngineExecute
+        //
+        Operation = ScriptEngineJitSpecializedOperations[(Handler - ScriptEngineLinkedHandlerAddTempTemp) /
+                                                         (ScriptEngineLinkedHandlerSubTempTemp - ScriptEngineLinkedHandlerAddTempTemp)];
+
+        ScriptEngineJitEmitCheckTemp(Emitter, Instruction, 2, ScriptEngineJitInterpretLabel(Emitter, InstructionIndex));
+        ScriptEngineJitEmitGetBinaryOperands(Emitter, Instruction);
+        ScriptEngineJitEmitOperation(Emitter, Operation, ErrorLabel);
+        ScriptEngineJitEmitSetOperand(Emitter, Instruction, 2);
+        ScriptEngineJitEmitCheckLimits(Emitter, CheckStack);
+        return;
+    }
+
+    switch (Handler)
+    {
+    case ScriptEngineLinkedHandlerMov:
+    case ScriptEngineLinkedHandlerMovTempTemp:
+    case ScriptEngineLinkedHandlerMovImmediateTemp:
+    case ScriptEngineLinkedHandlerMovTempGlobal:
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 0, JIT_RAX);
+        ScriptEngineJitEmitSetOperand(Emitter, Instruction, 1);
+        break;
+
+    case ScriptEngineLinkedHandlerInc:
+    case ScriptEngineLinkedHandlerIncTemp:
+    case ScriptEngineLinkedHandlerDec:
+    case ScriptEngineLinkedHandlerDecTemp:
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 0, JIT_RAX);
+        ScriptEngineJitEmitRegister(Emitter,
+                                    TRUE,
+                                    0xff,
+                                    Handler == ScriptEngineLinkedHandlerInc || Handler == ScriptEngineLinkedHandlerIncTemp ? 0 : 1,
+                                    JIT_RAX);
+        ScriptEngineJitEmitSetOperand(Emitter, Instruction, 0);
+        break;
+
+    case ScriptEngineLinkedHandlerNot:
+    case ScriptEngineLinkedHandlerNeg:
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 0, JIT_RAX);
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0xf7, Handler == ScriptEngineLinkedHandlerNot ? 2 : 3, JIT_RAX);
+        ScriptEngineJitEmitSetOperand(Emitter, Instruction, 1);
+        break;
+
+    case ScriptEngineLinkedHandlerAdd:
+    case ScriptEngineLinkedHandlerSub:
+    case ScriptEngineLinkedHandlerMul:
+    case ScriptEngineLinkedHandlerDiv:
+    case ScriptEngineLinkedHandlerMod:
+    case ScriptEngineLinkedHandlerOr:
+    case ScriptEngineLinkedHandlerAnd:
+    case ScriptEngineLinkedHandlerXor:
+    case ScriptEngineLinkedHandlerAsl:
+    case ScriptEngineLinkedHandlerAsr:
+    case ScriptEngineLinkedHandlerGt:
+    case ScriptEngineLinkedHandlerLt:
+    case ScriptEngineLinkedHandlerEgt:
+    case ScriptEngineLinkedHandlerElt:
+    case ScriptEngineLinkedHandlerEqual:
+    case ScriptEngineLinkedHandlerNeq:
+
+        //
+        // The untyped handlers are in the same order as the operations (up
+        // to the unsigned comparisons)
+        //
+        Operation = Handler <= ScriptEngineLinkedHandlerElt ? (SCRIPT_ENGINE_JIT_OPERATION)(Handler - ScriptEngineLinkedHandlerAdd) :
+                    Handler == ScriptEngineLinkedHandlerEqual ? ScriptEngineJitOperationEqual :
+                                                                ScriptEngineJitOperationNeq;
+
+        ScriptEngineJitEmitGetBinaryOperands(Emitter, Instruction);
+        ScriptEngineJitEmitOperation(Emitter, Operation, ErrorLabel);
+        ScriptEngineJitEmitSetOperand(Emitter, Instruction, 2);
+        break;
+
+    case ScriptEngineLinkedHandlerTyped:
+
+        Type      = Code->Head[Instruction->SymbolIndex + 4].Value;
+        Operation = ScriptEngineJitTypedOperation(Code->Head[Instruction->SymbolIndex].Value, Type);
+
+        if (Operation == ScriptEngineJitOperationInvalid)
+        {
+            ScriptEngineJitEmitInterpret(Emitter, InstructionIndex);
+            return;
+        }
+
+        ScriptEngineJitEmitCheckTemp(Emitter, Instruction, 2, ErrorLabel);
+        ScriptEngineJitEmitGetBinaryOperands(Emitter, Instruction);
+        ScriptEngineJitEmitNormalize(Emitter, JIT_RCX, Type);
+        ScriptEngineJitEmitNormalize(Emitter, JIT_RDX, Type);
+
+        if (Operation == ScriptEngineJitOperationSignedDiv || Operation == ScriptEngineJitOperationSignedMod)
+        {
+            ScriptEngineJitEmitCheckSignedDivision(Emitter, Type, ErrorLabel);
+        }
+
+        ScriptEngineJitEmitOperation(Emitter, Operation, ErrorLabel);
+
+        if (!ScriptEngineJitOperationIsComparison(Operation))
+        {
+            ScriptEngineJitEmitNormalize(Emitter, JIT_RAX, Type);
+        }
+
+        ScriptEngineJitEmitSetOperand(Emitter, Instruction, 2);
+        break;
+
+    case ScriptEngineLinkedHandlerCastInteger:
+        ScriptEngineJitEmitCheckTemp(Emitter, Instruction, 1, ErrorLabel);
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 0, JIT_RAX);
+        ScriptEngineJitEmitNormalize(Emitter, JIT_RAX, Instruction->Operands[2]);
+        ScriptEngineJitEmitSetOperand(Emitter, Instruction, 1);
+        break;
+
+    case ScriptEngineLinkedHandlerLogicalNotInteger:
+        ScriptEngineJitEmitCheckTemp(Emitter, Instruction, 1, ErrorLabel);
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 0, JIT_RCX);
+        ScriptEngineJitEmitRegister(Emitter, FALSE, 0x31, JIT_RAX, JIT_RAX);
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x85, JIT_RCX, JIT_RCX);
+        ScriptEngineJitEmitRegister(Emitter, FALSE, 0x0f90 | JIT_CONDITION_E, 0, JIT_RAX);
+        ScriptEngineJitEmitSetOperand(Emitter, Instruction, 1);
+        break;
+
+    case ScriptEngineLinkedHandlerFunction:
+
+        if (!ScriptEngineJitEmitFunction(Emitter, Instruction))
+        {
+            ScriptEngineJitEmitInterpret(Emitter, InstructionIndex);
+            return;
+        }
+        break;
+
+    case ScriptEngineLinkedHandlerJmp:
+        ScriptEngineJitEmitCheckLimits(Emitter, CheckStack);
+        ScriptEngineJitEmitJump(Emitter, ScriptEngineJitInstructionLabel((UINT32)Instruction->Operands[0]));
+        return;
+
+    case ScriptEngineLinkedHandlerJz:
+    case ScriptEngineLinkedHandlerJzTemp:
+    case ScriptEngineLinkedHandlerJnz:
+    case ScriptEngineLinkedHandlerJnzTemp:
+
+        //
+        // The limits are checked in both of the paths, so they're checked
+        // before the jump
+        //
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 1, JIT_RAX);
+        ScriptEngineJitEmitCheckLimits(Emitter, CheckStack);
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x85, JIT_RAX, JIT_RAX);
+        ScriptEngineJitEmitConditionalJump(Emitter,
+                                           Handler == ScriptEngineLinkedHandlerJz || Handler == ScriptEngineLinkedHandlerJzTemp ? JIT_CONDITION_E : JIT_CONDITION_NE,
+                                           ScriptEngineJitInstructionLabel((UINT32)Instruction->Operands[0]));
+        return;
+
+    case ScriptEngineLinkedHandlerPush:
+        ScriptEngineJitEmitGetOperand(Emitter, Instruction, 0, JIT_RAX);
+        ScriptEngineJitEmitLoad(Emitter, JIT_RDX, JIT_REGISTERS, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_GENERAL_REGISTERS, StackIndx));
+        ScriptEngineJitEmitStore(Emitter, JIT_RAX, JIT_STACK_BUFFER, JIT_RDX, 0);
+        ScriptEngineJitEmitMemory(Emitter, TRUE, 0xff, 0, JIT_REGISTERS, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_GENERAL_REGISTERS, StackIndx));
+        CheckStack = TRUE;
+        break;
+
+    case ScriptEngineLinkedHandlerPop:
+        ScriptEngineJitEmitMemory(Emitter, TRUE, 0xff, 1, JIT_REGISTERS, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_GENERAL_REGISTERS, StackIndx));
+        ScriptEngineJitEmitLoad(Emitter, JIT_RDX, JIT_REGISTERS, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_GENERAL_REGISTERS, StackIndx));
+        ScriptEngineJitEmitLoad(Emitter, JIT_RAX, JIT_STACK_BUFFER, JIT_RDX, 0);
+        ScriptEngineJitEmitSetOperand(Emitter, Instruction, 0);
+        CheckStack = TRUE;
+        break;
+
+    case ScriptEngineLinkedHandlerCall:
+
+        //
+        // The return address is the symbol after the target (the same as ScriptEngineExecute)
+        //
+        ScriptEngineJitEmitMoveImmediate(Emitter, JIT_RAX, (UINT64)Instruction->SymbolIndex + 2);
+        ScriptEngineJitEmitLoad(Emitter, JIT_RDX, JIT_REGISTERS, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_GENERAL_REGISTERS, StackIndx));
+        ScriptEngineJitEmitStore(Emitter, JIT_RAX, JIT_STACK_BUFFER, JIT_RDX, 0);
+        ScriptEngineJitEmitMemory(Emitter, TRUE, 0xff, 0, JIT_REGISTERS, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_GENERAL_REGISTERS, StackIndx));
+        ScriptEngineJitEmitCheckLimits(Emitter, TRUE);
+        ScriptEngineJitEmitJump(Emitter, ScriptEngineJitInstructionLabel((UINT32)Instruction->Operands[0]));
+        return;
+
+    case ScriptEngineLinkedHandlerRet:
+
+        //
+        // rdx = the symbol index of the return address
+        //
+        ScriptEngineJitEmitMemory(Emitter, TRUE, 0xff, 1, JIT_REGISTERS, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_GENERAL_REGISTERS, StackIndx));
+        ScriptEngineJitEmitLoad(Emitter, JIT_RAX, JIT_REGISTERS, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_GENERAL_REGISTERS, StackIndx));
+        ScriptEngineJitEmitLoad(Emitter, JIT_RDX, JIT_STACK_BUFFER, JIT_RAX, 0);
+        ScriptEngineJitEmitCheckLimits(Emitter, TRUE);
+
+        //
+        // Jump to the native code of the symbol, the symbols without native
+        // code are resumed by the helper
+        //
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x81, 7, JIT_RDX);
+        ScriptEngineJitEmitUint32(Emitter, Code->Pointer);
+        ScriptEngineJitEmitConditionalJump(Emitter, JIT_CONDITION_AE, ScriptEngineJitLabelResume);
+        ScriptEngineJitEmitMoveImmediate(Emitter, JIT_RAX, (UINT64)Emitter->JitCode->NativeOfSymbol);
+        ScriptEngineJitEmitLoad(Emitter, JIT_RAX, JIT_RAX, JIT_RDX, 0);
+        ScriptEngineJitEmitRegister(Emitter, TRUE, 0x85, JIT_RAX, JIT_RAX);
+        ScriptEngineJitEmitConditionalJump(Emitter, JIT_CONDITION_E, ScriptEngineJitLabelResume);
+        ScriptEngineJitEmitRegister(Emitter, FALSE, 0xff, 4, JIT_RAX);
+        return;
+
+    default:
+        ScriptEngineJitEmitInterpret(Emitter, InstructionIndex);
+        return;
+    }
+
+    ScriptEngineJitEmitCheckLimits(Emitter, CheckStack);
+}
+
+/**
+ * @brief Emit a jump to a helper (ScriptEngineJitInterpret or
+ * ScriptEngineJitResume) that returns the native code to continue from
+ *
+ * @param Emitter
+ * @param Helper
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitHelperCall(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT64 Helper)
+{
+    //
+    // The symbol index is in rdx
+    //
+    ScriptEngineJitEmitMove(Emitter, JIT_ARG1, JIT_RDX);
+    ScriptEngineJitEmitMove(Emitter, JIT_ARG0, JIT_FRAME);
+    ScriptEngineJitEmitStore(Emitter, JIT_EXECUTION_COUNT, JIT_FRAME, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_JIT_FRAME, ExecutionCount));
+    ScriptEngineJitEmitCall(Emitter, Helper);
+    ScriptEngineJitEmitLoad(Emitter, JIT_EXECUTION_COUNT, JIT_FRAME, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_JIT_FRAME, ExecutionCount));
+    ScriptEngineJitEmitRegister(Emitter, TRUE, 0x85, JIT_RAX, JIT_RAX);
+    ScriptEngineJitEmitConditionalJump(Emitter, JIT_CONDITION_E, ScriptEngineJitLabelResultExit);
+    ScriptEngineJitEmitRegister(Emitter, FALSE, 0xff, 4, JIT_RAX);
+}
+
+/**
+ * @brief Emit pushing or popping a register
+ *
+ * @param Emitter
+ * @param Opcode 0x50 (push) or 0x58 (pop)
+ * @param Reg
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitPushPop(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT32 Opcode, UINT32 Reg)
+{
+    ScriptEngineJitEmitOpcode(Emitter, FALSE, Opcode + (Reg & 7), 0, JIT_NO_INDEX, Reg);
+}
+
+/**
+ * @brief Emit the whole native code of a linked code
+ *
+ * @details The entry (SCRIPT_ENGINE_JIT_ENTRY) is followed by the
+ * instructions, the stubs of the instructions and the common exits
+ *
+ * @param Emitter
+ *
+ * @return VOID
+ */
+static VOID
+ScriptEngineJitEmitCode(PSCRIPT_ENGINE_JIT_EMITTER Emitter)
+{
+    static const UINT32 SavedRegisters[] = {JIT_RBP, JIT_RBX, JIT_R12, JIT_R13, JIT_R14, JIT_R15};
+
+    PSCRIPT_ENGINE_LINKED_CODE Code = Emitter->LinkedCode;
+    UINT32                     Label;
+
+    //
+    // Entry
+    //
+    for (UINT32 i = 0; i < sizeof(SavedRegisters) / sizeof(SavedRegisters[0]); i++)
+    {
+        ScriptEngineJitEmitPushPop(Emitter, 0x50, SavedRegisters[i]);
+    }
+
+    ScriptEngineJitEmitRegister(Emitter, TRUE, 0x81, 5, JIT_RSP);
+    ScriptEngineJitEmitUint32(Emitter, JIT_STACK_SIZE);
+
+    ScriptEngineJitEmitMove(Emitter, JIT_FRAME, JIT_ARG0);
+    ScriptEngineJitEmitLoad(Emitter, JIT_REGISTERS, JIT_FRAME, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_JIT_FRAME, ScriptGeneralRegisters));
+    ScriptEngineJitEmitLoad(Emitter, JIT_STACK_BUFFER, JIT_REGISTERS, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_GENERAL_REGISTERS, StackBuffer));
+    ScriptEngineJitEmitLoad(Emitter, JIT_GLOBALS, JIT_REGISTERS, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_GENERAL_REGISTERS, GlobalVariablesList));
+    ScriptEngineJitEmitLoad(Emitter, JIT_GUEST_REGS, JIT_FRAME, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_JIT_FRAME, GuestRegs));
+    ScriptEngineJitEmitLoad(Emitter, JIT_EXECUTION_COUNT, JIT_FRAME, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_JIT_FRAME, ExecutionCount));
+    ScriptEngineJitEmitRegister(Emitter, FALSE, 0xff, 4, JIT_ARG1);
+
+    //
+    // Instructions
+    //
+    for (UINT32 i = 0; i < Code->InstructionCount; i++)
+    {
+        ScriptEngineJitBindLabel(Emitter, ScriptEngineJitInstructionLabel(i));
+        ScriptEngineJitEmitInstruction(Emitter, i);
+    }
+
+    //
+    // Stubs of the instructions (only the ones that are used)
+    //
+    for (UINT32 i = 0; i < Code->InstructionCount; i++)
+    {
+        Label = ScriptEngineJitErrorLabel(Emitter, i);
+
+        if (Emitter->LabelIsUsed[Label])
+        {
+            ScriptEngineJitBindLabel(Emitter, Label);
+            ScriptEngineJitEmitMemory(Emitter, TRUE, 0xc7, 0, JIT_FRAME, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_JIT_FRAME, ErrorSymbolIndex));
+            ScriptEngineJitEmitUint32(Emitter, Code->Instructions[i].SymbolIndex);
+            ScriptEngineJitEmitMoveImmediate(Emitter, JIT_RAX, ScriptEngineLinkedExecutionError);
+            ScriptEngineJitEmitJump(Emitter, ScriptEngineJitLabelEpilogue);
+        }
+
+        Label = ScriptEngineJitInterpretLabel(Emitter, i);
+
+        if (Emitter->LabelIsUsed[Label])
+        {
+            ScriptEngineJitBindLabel(Emitter, Label);
+            ScriptEngineJitEmitMoveImmediate(Emitter, JIT_RDX, Code->Instructions[i].SymbolIndex);
+            ScriptEngineJitEmitJump(Emitter, ScriptEngineJitLabelInterpret);
+        }
+    }
+
+    //
+    // Common exits
+    //
+    ScriptEngineJitBindLabel(Emitter, ScriptEngineJitLabelStackOverflow);
+    ScriptEngineJitEmitMoveImmediate(Emitter, JIT_RAX, ScriptEngineLinkedExecutionStackOverflow);
+    ScriptEngineJitEmitJump(Emitter, ScriptEngineJitLabelEpilogue);
+
+    ScriptEngineJitBindLabel(Emitter, ScriptEngineJitLabelExecutionCountExceeded);
+    ScriptEngineJitEmitMoveImmediate(Emitter, JIT_RAX, ScriptEngineLinkedExecutionExecutionCountExceeded);
+    ScriptEngineJitEmitJump(Emitter, ScriptEngineJitLabelEpilogue);
+
+    ScriptEngineJitBindLabel(Emitter, ScriptEngineJitLabelInterpret);
+    ScriptEngineJitEmitHelperCall(Emitter, (UINT64)ScriptEngineJitInterpret);
+
+    ScriptEngineJitBindLabel(Emitter, ScriptEngineJitLabelResume);
+    ScriptEngineJitEmitHelperCall(Emitter, (UINT64)ScriptEngineJitResume);
+
+    ScriptEngineJitBindLabel(Emitter, ScriptEngineJitLabelResultExit);
+    ScriptEngineJitEmitMemory(Emitter, FALSE, 0x8b, JIT_RAX, JIT_FRAME, JIT_NO_INDEX, offsetof(SCRIPT_ENGINE_JIT_FRAME, Result));
+
+    ScriptEngineJitBindLabel(Emitter, ScriptEngineJitLabelEpilogue);
+    ScriptEngineJitEmitRegister(Emitter, TRUE, 0x81, 0, JIT_RSP);
+    ScriptEngineJitEmitUint32(Emitter, JIT_STACK_SIZE);
+
+    for (UINT32 i = sizeof(SavedRegisters) / sizeof(SavedRegisters[0]); i > 0; i--)
+    {
+        ScriptEngineJitEmitPushPop(Emitter, 0x58, SavedRegisters[i - 1]);
+    }
+
+    ScriptEngineJitEmitByte(Emitter, 0xc3);
+}
+
+/**
+ * @brief Translate a linked code to native code
+ *
+ * @details Windows doesn't know the unwind information of the native code,
+ * which is fine as long as the helpers that it calls don't throw
+ *
+ * @param LinkedCode The code that is linked by ScriptEngineLink (should
+ * remain valid while the native code is used)
+ *
+ * @return PVOID The native code (freed by ScriptEngineJitFree), NULL if
+ * the code cannot be translated
+ */
+PVOID
+ScriptEngineJitCompile(PVOID LinkedCode)
+{
+    PSCRIPT_ENGINE_LINKED_CODE Code    = (PSCRIPT_ENGINE_LINKED_CODE)LinkedCode;
+    PSCRIPT_ENGINE_JIT_CODE    JitCode = NULL;
+    SCRIPT_ENGINE_JIT_EMITTER  Emitter = {0};
+    UINT32                     Label;
+
+    //
+    // The symbol indexes are 32-bit immediates of the native code
+    //
+    if (Code->Pointer > 0x7fffffff)
+    {
+        return NULL;
+    }
+
+    JitCode = (PSCRIPT_ENGINE_JIT_CODE)calloc(1, sizeof(SCRIPT_ENGINE_JIT_CODE));
+
+    if (JitCode == NULL)
+    {
+        return NULL;
+    }
+
+    Emitter.LinkedCode    = Code;
+    Emitter.JitCode       = JitCode;
+    Emitter.Capacity      = 0x1000;
+    Emitter.FixupCapacity = 0x100;
+    Emitter.LabelCount    = ScriptEngineJitLabelCount + Code->InstructionCount * 3;
+
+    JitCode->LinkedCode     = Code;
+    JitCode->NativeOfSymbol = (UINT8 **)calloc(Code->Pointer + 1, sizeof(UINT8 *));
+    Emitter.Buffer          = (UINT8 *)malloc(Emitter.Capacity);
+    Emitter.Fixups          = (PSCRIPT_ENGINE_JIT_FIXUP)malloc(Emitter.FixupCapacity * sizeof(SCRIPT_ENGINE_JIT_FIXUP));
+    Emitter.LabelOffsets    = (UINT32 *)malloc(Emitter.LabelCount * sizeof(UINT32));
+    Emitter.LabelIsUsed     = (BOOLEAN *)calloc(Emitter.LabelCount, sizeof(BOOLEAN));
+
+    if (JitCode->NativeOfSymbol == NULL || Emitter.Buffer == NULL || Emitter.Fixups == NULL ||
+        Emitter.LabelOffsets == NULL || Emitter.LabelIsUsed == NULL)
+    {
+        goto Failed;
+    }
+
+    for (Label = 0; Label < Emitter.LabelCount; Label++)
+    {
+        Emitter.LabelOffsets[Label] = JIT_NO_LABEL;
+    }
+
+    ScriptEngineJitEmitCode(&Emitter);
+
+    if (Emitter.HasError)
+    {
+        goto Failed;
+    }
+
+    //
+    // Resolve the jumps (rel32 is relative to the end of itself)
+    //
+    for (UINT32 i = 0; i < Emitter.FixupCount; i++)
+    {
+        UINT32 Target = Emitter.LabelOffsets[Emitter.Fixups[i].Label];
+        INT32  Relative;
+
+        if (Target == JIT_NO_LABEL)
+        {
+            goto Failed;
+        }
+
+        Relative = (INT32)Target - (INT32)(Emitter.Fixups[i].Offset + 4);
+        memcpy(&Emitter.Buffer[Emitter.Fixups[i].Offset], &Relative, sizeof(INT32));
+    }
+
+    JitCode->NativeCodeSize = Emitter.Size;
+    JitCode->NativeCode     = (UINT8 *)PlatformAllocateExecutableMemory(Emitter.Size);
+
+    if (JitCode->NativeCode == NULL)
+    {
+        goto Failed;
+    }
+
+    memcpy(JitCode->NativeCode, Emitter.Buffer, Emitter.Size);
+
+    if (!PlatformProtectExecutableMemory(JitCode->NativeCode, Emitter.Size))
+    {
+        goto Failed;
+    }
+
+    //
+    // The end instruction is after the last symbol
+    //
+    for (UINT32 i = 0; i + 1 < Code->InstructionCount; i++)
+    {
+        JitCode->NativeOfSymbol[Code->Instructions[i].SymbolIndex] =
+            JitCode->NativeCode + Emitter.LabelOffsets[ScriptEngineJitInstructionLabel(i)];
+    }
+
+    free(Emitter.Buffer);
+    free(Emitter.Fixups);
+    free(Emitter.LabelOffsets);
+    free(Emitter.LabelIsUsed);
+
+    return JitCode;
+
+Failed:
+    free(Emitter.Buffer);
+    free(Emitter.Fixups);
+    free(Emitter.LabelOffsets);
+    free(Emitter.LabelIsUsed);
+    ScriptEngineJitFree(JitCode);
+
+    return NULL;
+}
+
+/**
+ * @brief Execute a native code
+ *
+ * @param GuestRegs General purpose registers
+ * @param ActionDetail Detail of the specific action
+ * @param ScriptGeneralRegisters of core specific (and global) variable holders
+ * @param JitCode The code that is translated by ScriptEngineJitCompile
+ * @param ErrorOperator Error in operator
+ *
+ * @return SCRIPT_ENGINE_LINKED_EXECUTION_RESULT
+ */
+SCRIPT_ENGINE_LINKED_EXECUTION_RESULT
+ScriptEngineJitExecute(PGUEST_REGS                      GuestRegs,
+                       ACTION_BUFFER *                  ActionDetail,
+                       PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters,
+                       PVOID                            JitCode,
+                       SYMBOL *                         ErrorOperator)
+{
+    PSCRIPT_ENGINE_JIT_CODE               Code  = (PSCRIPT_ENGINE_JIT_CODE)JitCode;
+    SCRIPT_ENGINE_JIT_ENTRY               Entry = (SCRIPT_ENGINE_JIT_ENTRY)Code->NativeCode;
+    SCRIPT_ENGINE_JIT_FRAME               Frame = {0};
+    SCRIPT_ENGINE_LINKED_EXECUTION_RESULT Result;
+    PVOID                                 Target;
+
+    Frame.GuestRegs              = GuestRegs;
+    Frame.ActionDetail           = ActionDetail;
+    Frame.ScriptGeneralRegisters = ScriptGeneralRegisters;
+    Frame.Code                   = Code;
+    Frame.CodeBuffer.Head        = Code->LinkedCode->Head;
+    Frame.CodeBuffer.Pointer     = Code->LinkedCode->Pointer;
+    Frame.CodeBuffer.Size        = Code->LinkedCode->Pointer * sizeof(SYMBOL);
+    Frame.ErrorOperator          = ErrorOperator;
+    Frame.ErrorSymbolIndex       = SCRIPT_ENGINE_LINKED_NO_INSTRUCTION;
+
+    Target = ScriptEngineJitResume(&Frame, 0);
+
+    if (Target == NULL)
+    {
+        return Frame.Result;
+    }
+
+    Result = Entry(&Frame, Target);
+
+    //
+    // The errors of the interpreted instructions are already filled by ScriptEngineExecute
+    //
+    if (Result == ScriptEngineLinkedExecutionError && Frame.ErrorSymbolIndex != SCRIPT_ENGINE_LINKED_NO_INSTRUCTION)
+    {
+        *ErrorOperator = Code->LinkedCode->Head[Frame.ErrorSymbolIndex];
+    }
+
+    return Result;
+}
+
+/**
+ * @brief Free a native code
+ *
+ * @param JitCode
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineJitFree(PVOID JitCode)
+{
+    PSCRIPT_ENGINE_JIT_CODE Code = (PSCRIPT_ENGINE_JIT_CODE)JitCode;
+
+    if (Code == NULL)
+    {
+        return;
+    }
+
+    if (Code->NativeCode != NULL)
+    {
+        PlatformFreeExecutableMemory(Code->NativeCode, Code->NativeCodeSize);
+    }
+
+    free(Code->NativeOfSymbol);
+    free(Code);
+}
+
+#else
+
+//
+// The JIT is not available, the callers execute the linked code
+//
+
+PVOID
+ScriptEngineJitCompile(PVOID LinkedCode)
+{
+    UNREFERENCED_PARAMETER(LinkedCode);
+
+    return NULL;
+}
+
+SCRIPT_ENGINE_LINKED_EXECUTION_RESULT
+ScriptEngineJitExecute(PGUEST_REGS                      GuestRegs,
+                       ACTION_BUFFER *                  ActionDetail,
+                       PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters,
+                       PVOID                            JitCode,
+                       SYMBOL *                         ErrorOperator)
+{
+    UNREFERENCED_PARAMETER(JitCode);
+
+    return ScriptEngineExecuteLinked(GuestRegs, ActionDetail, ScriptGeneralRegisters, NULL, ErrorOperator);
+}
+
+VOID
+ScriptEngineJitFree(PVOID JitCode)
+{
+    UNREFERENCED_PARAMETER(JitCode);
+}
+
+#endif // defined(SCRIPT_ENGINE_USER_MODE) && (defined(_M_X64) || defined(__x86_64__))
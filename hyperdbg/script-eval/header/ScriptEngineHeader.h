@@ -11,6 +11,260 @@
  */
 #pragma once
 
+//////////////////////////////////////////////////
+//			       Linked code                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Operators of the specialized binary handlers
+ *
+ * @details The typed operators are only specialized for 64-bit integers (and
+ * pointers), so they compute the same as the untyped operators
+ */
+#define SCRIPT_ENGINE_LINKED_SPECIALIZED_OPERATORS(Operator) \
+    Operator(Add)                                            \
+    Operator(Sub)                                            \
+    Operator(Mul)                                            \
+    Operator(And)                                            \
+    Operator(Or)                                             \
+    Operator(Xor)                                            \
+    Operator(Gt)                                             \
+    Operator(Lt)                                             \
+    Operator(Egt)                                            \
+    Operator(Elt)                                            \
+    Operator(Above)                                          \
+    Operator(Below)                                          \
+    Operator(AboveOrEqual)                                   \
+    Operator(BelowOrEqual)                                   \
+    Operator(Equal)                                          \
+    Operator(Neq)
+
+/**
+ * @brief Operand kinds ([Src0][Src1]) of the specialized binary handlers
+ *
+ * @details The destination is always a temp, the order of the shapes is used
+ * by the linker to find the handler of a shape
+ */
+#define SCRIPT_ENGINE_LINKED_SPECIALIZED_SHAPES(Shape, Operator) \
+    Shape(Operator, Temp, Temp)                                  \
+    Shape(Operator, Immediate, Temp)                             \
+    Shape(Operator, Temp, Immediate)                             \
+    Shape(Operator, Immediate, Register)
+
+#define SCRIPT_ENGINE_LINKED_SPECIALIZED_HANDLER_NAME(Operator, Src0, Src1) \
+    ScriptEngineLinkedHandler##Operator##Src0##Src1,
+
+#define SCRIPT_ENGINE_LINKED_SPECIALIZED_HANDLER_NAMES(Operator) \
+    SCRIPT_ENGINE_LINKED_SPECIALIZED_SHAPES(SCRIPT_ENGINE_LINKED_SPECIALIZED_HANDLER_NAME, Operator)
+
+/**
+ * @brief Handlers of the linked (pre-decoded) instructions
+ *
+ * @details The order should be the same as the order of the dispatch table
+ * in ScriptEngineExecuteLinked
+ */
+typedef enum _SCRIPT_ENGINE_LINKED_HANDLER
+{
+    ScriptEngineLinkedHandlerEnd = 0,  // end of the code
+    ScriptEngineLinkedHandlerGeneric,  // executed by ScriptEngineExecute
+    ScriptEngineLinkedHandlerMov,      // [Src][Des]
+    ScriptEngineLinkedHandlerInc,      // [Src/Des]
+    ScriptEngineLinkedHandlerDec,      // [Src/Des]
+    ScriptEngineLinkedHandlerNot,      // [Src][Des]
+    ScriptEngineLinkedHandlerNeg,      // [Src][Des]
+    ScriptEngineLinkedHandlerAdd,      // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerSub,      // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerMul,      // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerDiv,      // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerMod,      // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerOr,       // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerAnd,      // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerXor,      // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerAsl,      // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerAsr,      // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerGt,       // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerLt,       // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerEgt,      // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerElt,      // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerEqual,    // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerNeq,      // [Src0][Src1][Des]
+    ScriptEngineLinkedHandlerTyped,    // [Src0][Src1][Des], the operator and the type are read from the code buffer
+    ScriptEngineLinkedHandlerJmp,      // [Target]
+    ScriptEngineLinkedHandlerJz,       // [Target][Condition]
+    ScriptEngineLinkedHandlerJnz,      // [Target][Condition]
+    ScriptEngineLinkedHandlerPush,     // [Src]
+    ScriptEngineLinkedHandlerPop,      // [Des]
+    ScriptEngineLinkedHandlerCall,     // [Target]
+    ScriptEngineLinkedHandlerRet,      //
+
+    //
+    // Handlers that are specialized for the kinds of their operands
+    //
+    ScriptEngineLinkedHandlerMovTempTemp,      // [Temp][Temp]
+    ScriptEngineLinkedHandlerMovImmediateTemp, // [Immediate][Temp]
+    ScriptEngineLinkedHandlerMovTempGlobal,    // [Temp][Global]
+    ScriptEngineLinkedHandlerIncTemp,          // [Temp]
+    ScriptEngineLinkedHandlerDecTemp,          // [Temp]
+    ScriptEngineLinkedHandlerJzTemp,           // [Target][Temp]
+    ScriptEngineLinkedHandlerJnzTemp,          // [Target][Temp]
+    ScriptEngineLinkedHandlerCastInteger,      // [Src][Temp], the destination type is in the third operand
+    ScriptEngineLinkedHandlerLogicalNotInteger, // [Src][Temp]
+    ScriptEngineLinkedHandlerFunction,          // [Src][Des], [Des] or [Src], the built-in functions that only need values
+
+    SCRIPT_ENGINE_LINKED_SPECIALIZED_OPERATORS(SCRIPT_ENGINE_LINKED_SPECIALIZED_HANDLER_NAMES)
+
+    ScriptEngineLinkedHandlerCount,
+
+} SCRIPT_ENGINE_LINKED_HANDLER;
+
+/**
+ * @brief Kinds of the resolved operands of the linked instructions
+ *
+ */
+typedef enum _SCRIPT_ENGINE_LINKED_OPERAND_KIND
+{
+    ScriptEngineLinkedOperandImmediate = 0, // the operand is the value itself
+    ScriptEngineLinkedOperandGlobal,        // the operand is the index of the global variable
+    ScriptEngineLinkedOperandTemp,          // the operand is the index of the temp (from the stack base)
+    ScriptEngineLinkedOperandParameter,     // the operand is the index of the function parameter
+    ScriptEngineLinkedOperandSymbol,        // the operand is the address of the symbol (GetValue/SetValue)
+    ScriptEngineLinkedOperandRegister,      // the operand is the index of the 64-bit register in GUEST_REGS (only read)
+    ScriptEngineLinkedOperandPseudoRegister, // the operand is the address of the symbol (GetPseudoRegValue)
+    ScriptEngineLinkedOperandPercpu,         // the operand is the index of the per-core (percpu) variable
+
+} SCRIPT_ENGINE_LINKED_OPERAND_KIND;
+
+/**
+ * @brief A linked (pre-decoded) instruction
+ *
+ */
+typedef struct _SCRIPT_ENGINE_LINKED_INSTRUCTION
+{
+    UINT64 Operands[3];  // resolved operands (targets of jumps are instruction indexes)
+    UINT32 SymbolIndex;  // index of the operator symbol in the code buffer
+    UINT16 OperandKinds; // SCRIPT_ENGINE_LINKED_OPERAND_KIND of each operand (4 bits each)
+    UINT8  Handler;      // SCRIPT_ENGINE_LINKED_HANDLER
+    UINT8  Reserved;
+
+} SCRIPT_ENGINE_LINKED_INSTRUCTION, *PSCRIPT_ENGINE_LINKED_INSTRUCTION;
+
+/**
+ * @brief Header of the linked code of a script buffer
+ *
+ * @details The instructions and the instruction index of each symbol are
+ * stored right after the header (see ScriptEngineGetLinkedCodeSize)
+ */
+typedef struct _SCRIPT_ENGINE_LINKED_CODE
+{
+    PSYMBOL                           Head;                // symbols of the script buffer
+    UINT32                            Pointer;             // number of the symbols of the script buffer
+    UINT32                            InstructionCount;    // including the end instruction
+    PSCRIPT_ENGINE_LINKED_INSTRUCTION Instructions;        //
+    UINT32 *                          InstructionOfSymbol; // SCRIPT_ENGINE_LINKED_NO_INSTRUCTION if the symbol is not an operator
+    UINT32                            StackUsage;          // number of the used entries of the stack buffer (MAX_STACK_BUFFER_COUNT if unknown)
+    BOOLEAN                           IsBounded;           // no loops, calls or stack changes, so the limits are never reached
+
+} SCRIPT_ENGINE_LINKED_CODE, *PSCRIPT_ENGINE_LINKED_CODE;
+
+/**
+ * @brief The symbol is not the operator of a linked instruction
+ *
+ */
+#define SCRIPT_ENGINE_LINKED_NO_INSTRUCTION 0xffffffff
+
+/**
+ * @brief Result of executing a linked code
+ *
+ */
+typedef enum _SCRIPT_ENGINE_LINKED_EXECUTION_RESULT
+{
+    ScriptEngineLinkedExecutionCompleted = 0,
+    ScriptEngineLinkedExecutionError,                 // the error operator is filled
+    ScriptEngineLinkedExecutionStackOverflow,         // StackIndx reached MAX_STACK_BUFFER_COUNT
+    ScriptEngineLinkedExecutionExecutionCountExceeded, // more than MAX_EXECUTION_COUNT instructions are executed
+
+} SCRIPT_ENGINE_LINKED_EXECUTION_RESULT;
+
+//////////////////////////////////////////////////
+//			           JIT                      //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Native (x86-64) code of a linked code
+ *
+ * @details The native code of each instruction does the same as its linked
+ * handler, the instructions that are not translated are executed by
+ * ScriptEngineExecute (see ScriptEngineJitCompile)
+ */
+typedef struct _SCRIPT_ENGINE_JIT_CODE
+{
+    PSCRIPT_ENGINE_LINKED_CODE LinkedCode;     // should remain valid while the native code is used
+    UINT8 *                    NativeCode;     // read/execute pages, starts with the entry
+    SIZE_T                     NativeCodeSize; //
+    UINT8 **                   NativeOfSymbol; // NULL if the symbol is not the operator of an instruction
+
+} SCRIPT_ENGINE_JIT_CODE, *PSCRIPT_ENGINE_JIT_CODE;
+
+/**
+ * @brief State of executing a native code (shared by the native code and
+ * the helpers that it calls)
+ *
+ */
+typedef struct _SCRIPT_ENGINE_JIT_FRAME
+{
+    PGUEST_REGS                           GuestRegs;
+    ACTION_BUFFER *                       ActionDetail;
+    PSCRIPT_ENGINE_GENERAL_REGISTERS      ScriptGeneralRegisters;
+    PSCRIPT_ENGINE_JIT_CODE               Code;
+    SYMBOL_BUFFER                         CodeBuffer;       // for ScriptEngineExecute
+    SYMBOL *                              ErrorOperator;    //
+    UINT64                                ExecutionCount;   // only valid while the helpers are called
+    UINT64                                ErrorSymbolIndex; // set by the native code if it finds an error
+    SCRIPT_ENGINE_LINKED_EXECUTION_RESULT Result;           // set by the helpers if they finish the execution
+
+} SCRIPT_ENGINE_JIT_FRAME, *PSCRIPT_ENGINE_JIT_FRAME;
+
+/**
+ * @brief Entry of the native code, jumps to the native code of an instruction
+ *
+ */
+typedef SCRIPT_ENGINE_LINKED_EXECUTION_RESULT (*SCRIPT_ENGINE_JIT_ENTRY)(PSCRIPT_ENGINE_JIT_FRAME Frame, PVOID Target);
+
+//////////////////////////////////////////////////
+//			      Floating-point                //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The floating-point operators of the user-mode evaluator use the
+ * native float and double (SSE2 on x64), the kernel evaluator uses the
+ * software-float path as it shouldn't touch the XMM state
+ */
+#if defined(SCRIPT_ENGINE_USER_MODE) && (defined(_M_AMD64) || defined(__x86_64__) || defined(_M_ARM64) || defined(__aarch64__))
+#    define SCRIPT_ENGINE_NATIVE_FLOAT
+#endif
+
+BOOLEAN
+ScriptEngineSoftFloatExecuteBinary(UINT64  Opcode,
+                                   UINT64  LeftKind,
+                                   UINT64  LeftBits,
+                                   UINT64  RightKind,
+                                   UINT64  RightBits,
+                                   UINT64  ResultKind,
+                                   PUINT64 Result);
+
+#ifdef SCRIPT_ENGINE_NATIVE_FLOAT
+
+BOOLEAN
+ScriptEngineNativeFloatExecuteBinary(UINT64  Opcode,
+                                     UINT64  LeftKind,
+                                     UINT64  LeftBits,
+                                     UINT64  RightKind,
+                                     UINT64  RightBits,
+                                     UINT64  ResultKind,
+                                     PUINT64 Result);
+
+#endif // SCRIPT_ENGINE_NATIVE_FLOAT
+
 //////////////////////////////////////////////////
 //			        Registers                   //
 //////////////////////////////////////////////////
@@ -41,3 +295,50 @@ ScriptEngineExecute(PGUEST_REGS                      GuestRegs,
 
 VOID
 ScriptEngineGetOperatorName(PSYMBOL OperatorSymbol, CHAR * BufferForName);
+
+BOOLEAN
+ScriptEngineFormatPrintfArgument(const CHAR * Format,
+                                 UINT32       LenOfFormats,
+                                 PSYMBOL      Symbol,
+                                 UINT64       Val,
+                                 CHAR *       FinalBuffer,
+                                 PUINT32      CurrentProcessedPositionFromStartOfFormat,
+                                 PUINT32      CurrentPositionInFinalBuffer,
+                                 UINT32       SizeOfFinalBuffer);
+
+BOOLEAN
+ScriptEngineFormatPrintfRemainder(const CHAR * Format,
+                                  UINT32       LenOfFormats,
+                                  CHAR *       FinalBuffer,
+                                  UINT32       CurrentProcessedPositionFromStartOfFormat,
+                                  UINT32       CurrentPositionInFinalBuffer,
+                                  UINT32       SizeOfFinalBuffer);
+
+UINT32
+ScriptEngineGetLinkedCodeSize(UINT32 SymbolCount);
+
+BOOLEAN
+ScriptEngineLink(SYMBOL_BUFFER * CodeBuffer, PVOID LinkedCode, UINT32 LinkedCodeSize);
+
+UINT32
+ScriptEngineGetLinkedStackUsage(PVOID LinkedCode);
+
+SCRIPT_ENGINE_LINKED_EXECUTION_RESULT
+ScriptEngineExecuteLinked(PGUEST_REGS                      GuestRegs,
+                          ACTION_BUFFER *                  ActionDetail,
+                          PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters,
+                          PVOID                            LinkedCode,
+                          SYMBOL *                         ErrorOperator);
+
+PVOID
+ScriptEngineJitCompile(PVOID LinkedCode);
+
+SCRIPT_ENGINE_LINKED_EXECUTION_RESULT
+ScriptEngineJitExecute(PGUEST_REGS                      GuestRegs,
+                       ACTION_BUFFER *                  ActionDetail,
+                       PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters,
+                       PVOID                            JitCode,
+                       SYMBOL *                         ErrorOperator);
+
+VOID
+ScriptEngineJitFree(PVOID JitCode);
@@ -247,16 +247,28 @@ ScriptEngineFunctionPrintf(PGUEST_REGS                       GuestRegs,
                            UINT64                            Tag,
                            BOOLEAN                           ImmediateMessagePassing,
                            char *                            Format,
+                           UINT32                            FormatId,
                            UINT64                            ArgCount,
                            PSYMBOL                           FirstArg,
                            BOOLEAN *                         HasError);
 
+VOID
+ScriptEngineFunctionEmit(PGUEST_REGS                       GuestRegs,
+                         ACTION_BUFFER *                   ActionDetail,
+                         SCRIPT_ENGINE_GENERAL_REGISTERS * ScriptGeneralRegisters,
+                         UINT64                            Tag,
+                         UINT64                            ArgCount,
+                         PSYMBOL                           FirstArg);
+
 VOID
 ScriptEngineFunctionEventInject(UINT32 InterruptionType, UINT32 Vector, BOOL * HasError);
 
 VOID
 ScriptEngineFunctionEventInjectErrorCode(UINT32 InterruptionType, UINT32 Vector, UINT32 ErrorCode, BOOL * HasError);
 
+VOID
+ScriptEngineFunctionAggregate(UINT32 Type, UINT64 Key, UINT64 Value);
+
 VOID
 ScriptEngineFunctionEventTraceInstrumentationStep();
 
@@ -0,0 +1,649 @@
+/**
+ * @file symbol-cache.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Preprocessed symbol cache
+ * @details The symbols (names, addresses and sizes) and the layout of the
+ * types (sizes and offsets of the fields) of a module are saved to a cache
+ * file the first time its PDB file is loaded. The file is saved next to the
+ * PDB file (in the GUID and age directory of the symbol store), and in the
+ * next reloads, it's memory-mapped and the names, the fields and the sizes
+ * of the types are resolved from it without loading the PDB file
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Compare two names (case-insensitive, the same as the symbol
+ * options of DbgHelp)
+ *
+ * @param First
+ * @param Second
+ *
+ * @return INT
+ */
+static INT
+SymCacheCompareNames(const CHAR * First, const CHAR * Second)
+{
+    while (*First != '\0' && tolower((unsigned char)*First) == tolower((unsigned char)*Second))
+    {
+        First++;
+        Second++;
+    }
+
+    return tolower((unsigned char)*First) - tolower((unsigned char)*Second);
+}
+
+/**
+ * @brief Add a name to the names of the cache
+ *
+ * @param Builder
+ * @param Name
+ *
+ * @return UINT32 the offset of the name
+ */
+static UINT32
+SymCacheBuilderAddName(PSYMBOL_CACHE_BUILDER Builder, const CHAR * Name)
+{
+    UINT32 Offset = (UINT32)Builder->Names.size();
+
+    if (Name != NULL)
+    {
+        Builder->Names.insert(Builder->Names.end(), Name, Name + strlen(Name));
+    }
+
+    Builder->Names.push_back('\0');
+
+    return Offset;
+}
+
+/**
+ * @brief Add a symbol to the cache
+ *
+ * @param Builder
+ * @param Name
+ * @param Rva
+ * @param Size
+ *
+ * @return VOID
+ */
+VOID
+SymCacheBuilderAddSymbol(PSYMBOL_CACHE_BUILDER Builder, const CHAR * Name, UINT64 Rva, UINT32 Size)
+{
+    SYMBOL_CACHE_SYMBOL Symbol = {};
+
+    Symbol.Rva        = Rva;
+    Symbol.Size       = Size;
+    Symbol.NameOffset = SymCacheBuilderAddName(Builder, Name);
+
+    Builder->Symbols.push_back(Symbol);
+}
+
+/**
+ * @brief Add a type to the cache
+ * @details The fields that are added after the type are the fields of
+ * the type
+ *
+ * @param Builder
+ * @param Name
+ * @param Size
+ *
+ * @return VOID
+ */
+VOID
+SymCacheBuilderAddType(PSYMBOL_CACHE_BUILDER Builder, const CHAR * Name, UINT64 Size)
+{
+    SYMBOL_CACHE_TYPE Type = {};
+
+    Type.Size        = Size;
+    Type.NameOffset  = SymCacheBuilderAddName(Builder, Name);
+    Type.FirstField  = (UINT32)Builder->Fields.size();
+    Type.FieldsCount = 0;
+
+    Builder->Types.push_back(Type);
+}
+
+/**
+ * @brief Add a field to the last type of the cache
+ *
+ * @param Builder
+ * @param Name
+ * @param Offset
+ *
+ * @return VOID
+ */
+VOID
+SymCacheBuilderAddField(PSYMBOL_CACHE_BUILDER Builder, const CHAR * Name, UINT32 Offset)
+{
+    SYMBOL_CACHE_FIELD Field = {};
+
+    if (Builder->Types.empty())
+    {
+        return;
+    }
+
+    Field.NameOffset = SymCacheBuilderAddName(Builder, Name);
+    Field.Offset     = Offset;
+
+    Builder->Fields.push_back(Field);
+    Builder->Types.back().FieldsCount++;
+}
+
+/**
+ * @brief Align an offset of the cache file
+ *
+ * @param Offset
+ *
+ * @return UINT64
+ */
+static UINT64
+SymCacheAlignOffset(UINT64 Offset)
+{
+    return (Offset + 7) & ~7ull;
+}
+
+/**
+ * @brief Save the symbols and the types of a module to a cache file
+ * @details The file is written to a temporary file and then renamed, so an
+ * incomplete file is never opened by the other instances of the debugger
+ *
+ * @param Builder
+ * @param CachePath
+ * @param GuidAndAge the GUID and age of the PDB file
+ * @param PdbFileSize the size of the PDB file
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymCacheWrite(PSYMBOL_CACHE_BUILDER Builder, const CHAR * CachePath, const CHAR * GuidAndAge, UINT64 PdbFileSize)
+{
+    SYMBOL_CACHE_HEADER            Header        = {};
+    std::vector<SYMBOL_CACHE_NAME> SymbolsByName = {};
+    std::vector<SYMBOL_CACHE_TYPE> Types         = Builder->Types;
+    std::string                    TempPath      = std::string(CachePath) + ".tmp";
+    const CHAR *                   Names;
+    UINT64                         Offset;
+    FILE *                         File;
+    BOOLEAN                        Result;
+
+    if (strlen(GuidAndAge) >= MAXIMUM_GUID_AND_AGE_SIZE || Builder->Names.empty())
+    {
+        return FALSE;
+    }
+
+    Names = Builder->Names.data();
+
+    //
+    // The symbols are kept in the order of their enumeration (for the map of
+    // the disassembler) and their names are sorted separately; the symbols
+    // with the same name are kept in the order of their enumeration
+    //
+    SymbolsByName.resize(Builder->Symbols.size());
+
+    for (UINT32 i = 0; i < (UINT32)SymbolsByName.size(); i++)
+    {
+        SymbolsByName[i].NameOffset = Builder->Symbols[i].NameOffset;
+        SymbolsByName[i].Symbol     = i;
+    }
+
+    std::stable_sort(SymbolsByName.begin(), SymbolsByName.end(), [&](const SYMBOL_CACHE_NAME & First, const SYMBOL_CACHE_NAME & Second) {
+        return SymCacheCompareNames(Names + First.NameOffset, Names + Second.NameOffset) < 0;
+    });
+
+    //
+    // The types are sorted by name, and if there is more than one type with
+    // the same name (the forward declarations), the one with the fields (or
+    // the size) is kept
+    //
+    std::stable_sort(Types.begin(), Types.end(), [&](const SYMBOL_CACHE_TYPE & First, const SYMBOL_CACHE_TYPE & Second) {
+        INT Compare = SymCacheCompareNames(Names + First.NameOffset, Names + Second.NameOffset);
+
+        if (Compare != 0)
+        {
+            return Compare < 0;
+        }
+
+        return (First.FieldsCount != 0 || First.Size != 0) && Second.FieldsCount == 0 && Second.Size == 0;
+    });
+
+    Types.erase(std::unique(Types.begin(), Types.end(), [&](const SYMBOL_CACHE_TYPE & First, const SYMBOL_CACHE_TYPE & Second) {
+                    return SymCacheCompareNames(Names + First.NameOffset, Names + Second.NameOffset) == 0;
+                }),
+                Types.end());
+
+    //
+    // Make the header
+    //
+    Header.Magic       = SYMBOL_CACHE_MAGIC;
+    Header.Version     = SYMBOL_CACHE_VERSION;
+    Header.PdbFileSize = PdbFileSize;
+    strcpy(Header.GuidAndAge, GuidAndAge);
+
+    Offset                     = sizeof(SYMBOL_CACHE_HEADER);
+    Header.SymbolsOffset       = (UINT32)Offset;
+    Header.SymbolsCount        = (UINT32)Builder->Symbols.size();
+    Offset                     = SymCacheAlignOffset(Offset + Builder->Symbols.size() * sizeof(SYMBOL_CACHE_SYMBOL));
+    Header.SymbolsByNameOffset = (UINT32)Offset;
+    Offset                     = SymCacheAlignOffset(Offset + SymbolsByName.size() * sizeof(SYMBOL_CACHE_NAME));
+    Header.TypesOffset         = (UINT32)Offset;
+    Header.TypesCount          = (UINT32)Types.size();
+    Offset                     = SymCacheAlignOffset(Offset + Types.size() * sizeof(SYMBOL_CACHE_TYPE));
+    Header.FieldsOffset        = (UINT32)Offset;
+    Header.FieldsCount         = (UINT32)Builder->Fields.size();
+    Offset                     = SymCacheAlignOffset(Offset + Builder->Fields.size() * sizeof(SYMBOL_CACHE_FIELD));
+    Header.NamesOffset         = (UINT32)Offset;
+    Header.NamesSize           = (UINT32)Builder->Names.size();
+    Offset                     = Offset + Builder->Names.size();
+    Header.FileSize            = Offset;
+
+    if (Offset > UINT32_MAX)
+    {
+        return FALSE;
+    }
+
+    //
+    // Write the file
+    //
+    File = fopen(TempPath.c_str(), "wb");
+
+    if (File == NULL)
+    {
+        return FALSE;
+    }
+
+    auto WriteSection = [&](UINT32 SectionOffset, const VOID * Data, SIZE_T Size) {
+        static const BYTE Padding[8] = {0};
+        SIZE_T            Position   = (SIZE_T)ftell(File);
+
+        return Position <= SectionOffset &&
+               fwrite(Padding, 1, SectionOffset - Position, File) == SectionOffset - Position &&
+               (Size == 0 || fwrite(Data, 1, Size, File) == Size);
+    };
+
+    Result = WriteSection(0, &Header, sizeof(Header)) &&
+             WriteSection(Header.SymbolsOffset, Builder->Symbols.data(), Builder->Symbols.size() * sizeof(SYMBOL_CACHE_SYMBOL)) &&
+             WriteSection(Header.SymbolsByNameOffset, SymbolsByName.data(), SymbolsByName.size() * sizeof(SYMBOL_CACHE_NAME)) &&
+             WriteSection(Header.TypesOffset, Types.data(), Types.size() * sizeof(SYMBOL_CACHE_TYPE)) &&
+             WriteSection(Header.FieldsOffset, Builder->Fields.data(), Builder->Fields.size() * sizeof(SYMBOL_CACHE_FIELD)) &&
+             WriteSection(Header.NamesOffset, Builder->Names.data(), Builder->Names.size());
+
+    if (fclose(File) != 0)
+    {
+        Result = FALSE;
+    }
+
+    //
+    // Replace the previous file (if any)
+    //
+    if (Result)
+    {
+        remove(CachePath);
+        Result = rename(TempPath.c_str(), CachePath) == 0;
+    }
+
+    if (!Result)
+    {
+        remove(TempPath.c_str());
+    }
+
+    return Result;
+}
+
+/**
+ * @brief Check the header and the sections of a cache file
+ *
+ * @param Cache
+ * @param GuidAndAge
+ * @param PdbFileSize
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SymCacheValidate(PSYMBOL_CACHE Cache, const CHAR * GuidAndAge, UINT64 PdbFileSize)
+{
+    const SYMBOL_CACHE_HEADER * Header = (const SYMBOL_CACHE_HEADER *)Cache->Mapping;
+
+    auto HasSection = [&](UINT64 SectionOffset, UINT64 Count, UINT64 EntrySize) {
+        return SectionOffset % 8 == 0 && SectionOffset <= Cache->MappingSize &&
+               Count * EntrySize <= Cache->MappingSize - SectionOffset;
+    };
+
+    //
+    // Check the identity of the PDB file
+    //
+    if (Cache->MappingSize < sizeof(SYMBOL_CACHE_HEADER) ||
+        Header->Magic != SYMBOL_CACHE_MAGIC ||
+        Header->Version != SYMBOL_CACHE_VERSION ||
+        Header->FileSize != Cache->MappingSize ||
+        Header->PdbFileSize != PdbFileSize ||
+        strncmp(Header->GuidAndAge, GuidAndAge, MAXIMUM_GUID_AND_AGE_SIZE) != 0)
+    {
+        return FALSE;
+    }
+
+    //
+    // Check the sections
+    //
+    if (!HasSection(Header->SymbolsOffset, Header->SymbolsCount, sizeof(SYMBOL_CACHE_SYMBOL)) ||
+        !HasSection(Header->SymbolsByNameOffset, Header->SymbolsCount, sizeof(SYMBOL_CACHE_NAME)) ||
+        !HasSection(Header->TypesOffset, Header->TypesCount, sizeof(SYMBOL_CACHE_TYPE)) ||
+        !HasSection(Header->FieldsOffset, Header->FieldsCount, sizeof(SYMBOL_CACHE_FIELD)) ||
+        !HasSection(Header->NamesOffset, Header->NamesSize, 1) ||
+        Header->NamesSize == 0 ||
+        Cache->Mapping[Header->NamesOffset + Header->NamesSize - 1] != '\0')
+    {
+        return FALSE;
+    }
+
+    Cache->Header        = Header;
+    Cache->Symbols       = (const SYMBOL_CACHE_SYMBOL *)(Cache->Mapping + Header->SymbolsOffset);
+    Cache->SymbolsByName = (const SYMBOL_CACHE_NAME *)(Cache->Mapping + Header->SymbolsByNameOffset);
+    Cache->Types         = (const SYMBOL_CACHE_TYPE *)(Cache->Mapping + Header->TypesOffset);
+    Cache->Fields        = (const SYMBOL_CACHE_FIELD *)(Cache->Mapping + Header->FieldsOffset);
+    Cache->Names         = (const CHAR *)(Cache->Mapping + Header->NamesOffset);
+
+    //
+    // Check the entries (so a damaged file cannot be read out of its bounds)
+    //
+    for (UINT32 i = 0; i < Header->SymbolsCount; i++)
+    {
+        if (Cache->Symbols[i].NameOffset >= Header->NamesSize ||
+            Cache->SymbolsByName[i].NameOffset >= Header->NamesSize ||
+            Cache->SymbolsByName[i].Symbol >= Header->SymbolsCount)
+        {
+            return FALSE;
+        }
+    }
+
+    for (UINT32 i = 0; i < Header->TypesCount; i++)
+    {
+        const SYMBOL_CACHE_TYPE * Type = &Cache->Types[i];
+
+        if (Type->NameOffset >= Header->NamesSize ||
+            Type->FirstField > Header->FieldsCount ||
+            Type->FieldsCount > Header->FieldsCount - Type->FirstField)
+        {
+            return FALSE;
+        }
+    }
+
+    for (UINT32 i = 0; i < Header->FieldsCount; i++)
+    {
+        if (Cache->Fields[i].NameOffset >= Header->NamesSize)
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Open (memory-map) a cache file
+ *
+ * @param CachePath
+ * @param GuidAndAge the GUID and age of the PDB file
+ * @param PdbFileSize the size of the PDB file
+ *
+ * @return PSYMBOL_CACHE NULL if the file is not found, or it's not the cache
+ * of the PDB file
+ */
+PSYMBOL_CACHE
+SymCacheOpen(const CHAR * CachePath, const CHAR * GuidAndAge, UINT64 PdbFileSize)
+{
+    PSYMBOL_CACHE Cache;
+    VOID *        Mapping;
+    SIZE_T        MappingSize;
+
+#if defined(_WIN32)
+    HANDLE        FileHandle;
+    HANDLE        MapObjectHandle;
+    LARGE_INTEGER FileSize;
+
+    FileHandle = CreateFileA(CachePath, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (FileHandle == INVALID_HANDLE_VALUE)
+    {
+        return NULL;
+    }
+
+    if (!GetFileSizeEx(FileHandle, &FileSize) || FileSize.QuadPart < (LONGLONG)sizeof(SYMBOL_CACHE_HEADER) || FileSize.QuadPart > UINT32_MAX)
+    {
+        CloseHandle(FileHandle);
+        return NULL;
+    }
+
+    MapObjectHandle = CreateFileMapping(FileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(FileHandle);
+
+    if (MapObjectHandle == NULL)
+    {
+        return NULL;
+    }
+
+    //
+    // The view stays valid after the handles are closed
+    //
+    Mapping = MapViewOfFile(MapObjectHandle, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(MapObjectHandle);
+
+    if (Mapping == NULL)
+    {
+        return NULL;
+    }
+
+    MappingSize = (SIZE_T)FileSize.QuadPart;
+#elif defined(__linux__)
+    struct stat FileStat;
+    int         Fd;
+
+    Fd = open(CachePath, O_RDONLY | O_CLOEXEC);
+
+    if (Fd < 0)
+    {
+        return NULL;
+    }
+
+    if (fstat(Fd, &FileStat) != 0 || FileStat.st_size < (off_t)sizeof(SYMBOL_CACHE_HEADER) || FileStat.st_size > UINT32_MAX)
+    {
+        close(Fd);
+        return NULL;
+    }
+
+    Mapping = mmap(NULL, (SIZE_T)FileStat.st_size, PROT_READ, MAP_PRIVATE, Fd, 0);
+    close(Fd);
+
+    if (Mapping == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    MappingSize = (SIZE_T)FileStat.st_size;
+#else
+#    error "Unsupported platform"
+#endif
+
+    Cache = (PSYMBOL_CACHE)calloc(1, sizeof(SYMBOL_CACHE));
+
+    if (Cache != NULL)
+    {
+        Cache->Mapping     = (const BYTE *)Mapping;
+        Cache->MappingSize = MappingSize;
+
+        if (SymCacheValidate(Cache, GuidAndAge, PdbFileSize))
+        {
+            return Cache;
+        }
+
+        free(Cache);
+    }
+
+#if defined(_WIN32)
+    UnmapViewOfFile(Mapping);
+#else
+    munmap(Mapping, MappingSize);
+#endif
+
+    return NULL;
+}
+
+/**
+ * @brief Close (unmap) a cache file
+ *
+ * @param Cache
+ *
+ * @return VOID
+ */
+VOID
+SymCacheClose(PSYMBOL_CACHE Cache)
+{
+    if (Cache == NULL)
+    {
+        return;
+    }
+
+#if defined(_WIN32)
+    UnmapViewOfFile((PVOID)Cache->Mapping);
+#else
+    munmap((PVOID)Cache->Mapping, Cache->MappingSize);
+#endif
+
+    free(Cache);
+}
+
+/**
+ * @brief Find the address of a symbol in a cache
+ * @details If there is more than one symbol with the name, the first
+ * enumerated symbol is used
+ *
+ * @param Cache
+ * @param Name
+ * @param Rva
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymCacheFindSymbol(const SYMBOL_CACHE * Cache, const CHAR * Name, UINT64 * Rva)
+{
+    const SYMBOL_CACHE_NAME * First = Cache->SymbolsByName;
+    const SYMBOL_CACHE_NAME * Last  = Cache->SymbolsByName + Cache->Header->SymbolsCount;
+
+    First = std::lower_bound(First, Last, Name, [&](const SYMBOL_CACHE_NAME & Item, const CHAR * Value) {
+        return SymCacheCompareNames(Cache->Names + Item.NameOffset, Value) < 0;
+    });
+
+    if (First == Last || SymCacheCompareNames(Cache->Names + First->NameOffset, Name) != 0)
+    {
+        return FALSE;
+    }
+
+    *Rva = Cache->Symbols[First->Symbol].Rva;
+
+    return TRUE;
+}
+
+/**
+ * @brief Find a type in a cache
+ *
+ * @param Cache
+ * @param TypeName
+ *
+ * @return const SYMBOL_CACHE_TYPE * NULL if the type is not found
+ */
+static const SYMBOL_CACHE_TYPE *
+SymCacheFindType(const SYMBOL_CACHE * Cache, const CHAR * TypeName)
+{
+    const SYMBOL_CACHE_TYPE * First = Cache->Types;
+    const SYMBOL_CACHE_TYPE * Last  = Cache->Types + Cache->Header->TypesCount;
+
+    First = std::lower_bound(First, Last, TypeName, [&](const SYMBOL_CACHE_TYPE & Type, const CHAR * Value) {
+        return SymCacheCompareNames(Cache->Names + Type.NameOffset, Value) < 0;
+    });
+
+    if (First == Last || SymCacheCompareNames(Cache->Names + First->NameOffset, TypeName) != 0)
+    {
+        return NULL;
+    }
+
+    return First;
+}
+
+/**
+ * @brief Get the size of a data type (structure) from a cache
+ *
+ * @param Cache
+ * @param TypeName
+ * @param TypeSize
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymCacheGetDataTypeSize(const SYMBOL_CACHE * Cache, const CHAR * TypeName, UINT64 * TypeSize)
+{
+    const SYMBOL_CACHE_TYPE * Type = SymCacheFindType(Cache, TypeName);
+
+    if (Type == NULL)
+    {
+        return FALSE;
+    }
+
+    *TypeSize = Type->Size;
+
+    return TRUE;
+}
+
+/**
+ * @brief Get the offset of a field from the top of a structure from a cache
+ * @details The names of the fields are case-sensitive (the same as
+ * SymGetFieldOffsetFromModule)
+ *
+ * @param Cache
+ * @param TypeName
+ * @param FieldName
+ * @param FieldOffset
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymCacheGetFieldOffset(const SYMBOL_CACHE * Cache, const CHAR * TypeName, const CHAR * FieldName, UINT32 * FieldOffset)
+{
+    const SYMBOL_CACHE_TYPE * Type = SymCacheFindType(Cache, TypeName);
+
+    if (Type == NULL)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = Type->FirstField; i < Type->FirstField + Type->FieldsCount; i++)
+    {
+        if (strcmp(Cache->Names + Cache->Fields[i].NameOffset, FieldName) == 0)
+        {
+            *FieldOffset = Cache->Fields[i].Offset;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Enumerate the symbols of a cache (in the order of their enumeration
+ * when the cache was created)
+ *
+ * @param Cache
+ * @param Callback
+ * @param Context
+ *
+ * @return VOID
+ */
+VOID
+SymCacheEnumerateSymbols(const SYMBOL_CACHE * Cache, SYMBOL_CACHE_SYMBOL_CALLBACK Callback, PVOID Context)
+{
+    for (UINT32 i = 0; i < Cache->Header->SymbolsCount; i++)
+    {
+        Callback(Cache->Names + Cache->Symbols[i].NameOffset, Cache->Symbols[i].Rva, Cache->Symbols[i].Size, Context);
+    }
+}
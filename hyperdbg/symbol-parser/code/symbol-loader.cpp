@@ -0,0 +1,193 @@
+/**
+ * @file symbol-loader.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Parallel loading of the symbols of the modules
+ * @details The modules are prepared (their PDB files are downloaded and
+ * their caches are opened) by a bounded pool of threads, and they're merged
+ * (loaded to DbgHelp, which is single-threaded) by the thread of the loader
+ * in the order of their index, while the next modules are still prepared
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Prepare the next module that is not prepared by the other threads
+ *
+ * @param Loader
+ *
+ * @return BOOLEAN FALSE if there is no module to prepare (or the loading
+ * is aborted)
+ */
+static BOOLEAN
+SymLoaderPrepareNextModule(PSYMBOL_LOADER Loader)
+{
+    UINT32 Index;
+
+    if (*Loader->Abort)
+    {
+        return FALSE;
+    }
+
+    Index = Loader->NextModuleIndex.fetch_add(1);
+
+    if (Index >= Loader->NumberOfModules)
+    {
+        return FALSE;
+    }
+
+    Loader->Prepare(Index, Loader->Context);
+
+    {
+        std::lock_guard<std::mutex> Lock(Loader->Lock);
+        Loader->IsModulePrepared[Index] = TRUE;
+    }
+
+    //
+    // The loader might be waiting for this module (or for an aborted loading)
+    //
+    Loader->ModulePrepared.notify_all();
+
+    return TRUE;
+}
+
+/**
+ * @brief Prepare one module after another (a thread of the pool)
+ *
+ * @param Loader
+ *
+ * @return VOID
+ */
+static VOID
+SymLoaderWorker(PSYMBOL_LOADER Loader)
+{
+    while (SymLoaderPrepareNextModule(Loader))
+    {
+    }
+}
+
+/**
+ * @brief Wait until a module is prepared
+ * @details The thread of the loader prepares the next modules itself instead
+ * of waiting (it's also one of the threads of the pool)
+ *
+ * @param Loader
+ * @param Index
+ *
+ * @return BOOLEAN FALSE if the loading is aborted
+ */
+static BOOLEAN
+SymLoaderWaitForModule(PSYMBOL_LOADER Loader, UINT32 Index)
+{
+    for (;;)
+    {
+        if (*Loader->Abort)
+        {
+            return FALSE;
+        }
+
+        {
+            std::lock_guard<std::mutex> Lock(Loader->Lock);
+
+            if (Loader->IsModulePrepared[Index])
+            {
+                return TRUE;
+            }
+        }
+
+        if (!SymLoaderPrepareNextModule(Loader))
+        {
+            //
+            // All of the modules are taken, so this module is prepared by
+            // another thread, which notifies when it's finished (the abort
+            // is also checked after each module)
+            //
+            std::unique_lock<std::mutex> Lock(Loader->Lock);
+
+            Loader->ModulePrepared.wait(Lock, [Loader, Index] { return Loader->IsModulePrepared[Index] || *Loader->Abort; });
+        }
+    }
+}
+
+/**
+ * @brief Load the symbols of the modules by a pool of threads
+ * @details Each module is prepared by one of the threads (in parallel with the
+ * other modules), and then it's merged by the current thread in the order of
+ * the modules (the same order as loading them one after another). If the
+ * loading is aborted, the threads stop after the module that they're
+ * preparing, and the modules that are prepared but not merged should be
+ * released by the caller
+ *
+ * @param NumberOfModules
+ * @param NumberOfThreads the maximum number of the threads (including the
+ * current thread)
+ * @param Prepare
+ * @param Merge
+ * @param Context
+ * @param Abort the loading is aborted if it's set
+ *
+ * @return BOOLEAN FALSE if the loading is aborted
+ */
+BOOLEAN
+SymLoaderRun(UINT32                         NumberOfModules,
+             UINT32                         NumberOfThreads,
+             SYMBOL_LOADER_PREPARE_CALLBACK Prepare,
+             SYMBOL_LOADER_MERGE_CALLBACK   Merge,
+             PVOID                          Context,
+             const volatile BOOLEAN *       Abort)
+{
+    SYMBOL_LOADER            Loader;
+    std::vector<std::thread> Threads;
+    BOOLEAN                  Result = TRUE;
+
+    Loader.NumberOfModules = NumberOfModules;
+    Loader.Prepare         = Prepare;
+    Loader.Context         = Context;
+    Loader.Abort           = Abort;
+    Loader.NextModuleIndex = 0;
+    Loader.IsModulePrepared.assign(NumberOfModules, FALSE);
+
+    if (NumberOfThreads > NumberOfModules)
+    {
+        NumberOfThreads = NumberOfModules;
+    }
+
+    //
+    // The current thread is also one of the threads
+    //
+    for (UINT32 i = 1; i < NumberOfThreads; i++)
+    {
+        try
+        {
+            Threads.emplace_back(SymLoaderWorker, &Loader);
+        }
+        catch (const std::system_error &)
+        {
+            //
+            // Continue with the threads that are already created
+            //
+            break;
+        }
+    }
+
+    for (UINT32 i = 0; i < NumberOfModules; i++)
+    {
+        if (!SymLoaderWaitForModule(&Loader, i))
+        {
+            Result = FALSE;
+            break;
+        }
+
+        Merge(i, Context);
+    }
+
+    for (std::thread & Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    return Result;
+}
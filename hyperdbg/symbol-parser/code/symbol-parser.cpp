@@ -19,7 +19,7 @@
 //
 std::vector<PSYMBOL_LOADED_MODULE_DETAILS> g_LoadedModules;
 BOOLEAN                                    g_IsLoadedModulesInitialized = FALSE;
-BOOLEAN                                    g_AbortLoadingExecution      = FALSE;
+volatile BOOLEAN                           g_AbortLoadingExecution      = FALSE;
 CHAR *                                     g_CurrentModuleName          = NULL;
 PVOID                                      g_MessageHandler             = NULL;
 SymbolMapCallback                          g_SymbolMapForDisassembler   = NULL;
@@ -616,16 +616,20 @@ SymCheckNtoskrnlPrefix(const char * PdbFileName, std::string & CustomModuleName)
 }
 
 /**
- * @brief load symbol based on a file name and GUID
+ * @brief load symbol based on a file name and GUID (or its cache)
+ * @details If the cache of the PDB file is given, the PDB file is not loaded
+ * and the names, the fields and the sizes of the types are resolved from
+ * the cache
  *
  * @param BaseAddress
  * @param PdbFileName
  * @param CustomModuleName
+ * @param Cache the opened cache of the PDB file (or NULL)
  *
  * @return UINT32
  */
-UINT32
-SymLoadFileSymbol(UINT64 BaseAddress, const char * PdbFileName, const char * CustomModuleName)
+static UINT32
+SymLoadFileSymbolOrCache(UINT64 BaseAddress, const char * PdbFileName, const char * CustomModuleName, PSYMBOL_CACHE Cache)
 {
     DWORD                         FileSize                        = 0;
     int                           Index                           = 0;
@@ -648,7 +652,7 @@ SymLoadFileSymbol(UINT64 BaseAddress, const char * PdbFileName, const char * Cus
     //
     // Determine the base address and the file size
     //
-    if (!SymGetFileParams(PdbFileName, FileSize))
+    if (Cache == NULL && !SymGetFileParams(PdbFileName, FileSize))
     {
         ShowMessages("err, cannot obtain file parameters (internal error)\n");
         return -1;
@@ -693,24 +697,30 @@ SymLoadFileSymbol(UINT64 BaseAddress, const char * PdbFileName, const char * Cus
 
     RtlZeroMemory(ModuleDetails, sizeof(SYMBOL_LOADED_MODULE_DETAILS));
 
-    ModuleDetails->ModuleBase = SymLoadModule64(
-        GetCurrentProcess(), // Process handle of the current process
-        NULL,                // Handle to the module's image file (not needed)
-        PdbFileName,         // Path/name of the file
-        NULL,                // User-defined short name of the module (it can be NULL)
-        BaseAddress,         // Base address of the module (cannot be NULL if .PDB file is
-                             // used, otherwise it can be NULL)
-        FileSize             // Size of the file (cannot be NULL if .PDB file is used,
-                             // otherwise it can be NULL)
-    );
-
-    if (ModuleDetails->ModuleBase == NULL)
+    //
+    // The PDB file is not loaded if the symbols are resolved from the cache
+    //
+    if (Cache == NULL)
     {
-        ShowMessages("err, loading symbols failed (%x)\n",
-                     GetLastError());
+        ModuleDetails->ModuleBase = SymLoadModule64(
+            GetCurrentProcess(), // Process handle of the current process
+            NULL,                // Handle to the module's image file (not needed)
+            PdbFileName,         // Path/name of the file
+            NULL,                // User-defined short name of the module (it can be NULL)
+            BaseAddress,         // Base address of the module (cannot be NULL if .PDB file is
+                                 // used, otherwise it can be NULL)
+            FileSize             // Size of the file (cannot be NULL if .PDB file is used,
+                                 // otherwise it can be NULL)
+        );
 
-        free(ModuleDetails);
-        return -1;
+        if (ModuleDetails->ModuleBase == NULL)
+        {
+            ShowMessages("err, loading symbols failed (%x)\n",
+                         GetLastError());
+
+            free(ModuleDetails);
+            return -1;
+        }
     }
 
 #ifndef DoNotShowDetailedResult
@@ -733,6 +743,7 @@ SymLoadFileSymbol(UINT64 BaseAddress, const char * PdbFileName, const char * Cus
     // Make the details (to save)
     //
     ModuleDetails->BaseAddress = BaseAddress;
+    ModuleDetails->Cache       = Cache;
     strcpy((char *)ModuleDetails->ModuleName, ModuleName);
     strcpy((char *)ModuleDetails->PdbFilePath, PdbFileName);
 
@@ -752,6 +763,285 @@ SymLoadFileSymbol(UINT64 BaseAddress, const char * PdbFileName, const char * Cus
     return 0;
 }
 
+/**
+ * @brief load symbol based on a file name and GUID
+ *
+ * @param BaseAddress
+ * @param PdbFileName
+ * @param CustomModuleName
+ *
+ * @return UINT32
+ */
+UINT32
+SymLoadFileSymbol(UINT64 BaseAddress, const char * PdbFileName, const char * CustomModuleName)
+{
+    return SymLoadFileSymbolOrCache(BaseAddress, PdbFileName, CustomModuleName, NULL);
+}
+
+/**
+ * @brief Load the PDB file of a module whose symbols are resolved from
+ * the cache
+ * @details Used by the queries that are not saved in the cache (e.g., the
+ * search masks of the 'x' command)
+ *
+ * @param ModuleDetails
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SymLoadPdbOfCachedModule(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails)
+{
+    DWORD FileSize = 0;
+
+    if (ModuleDetails->ModuleBase != NULL)
+    {
+        //
+        // Already loaded
+        //
+        return TRUE;
+    }
+
+    if (!SymGetFileParams(ModuleDetails->PdbFilePath, FileSize))
+    {
+        return FALSE;
+    }
+
+    ModuleDetails->ModuleBase = SymLoadModule64(GetCurrentProcess(),
+                                                NULL,
+                                                ModuleDetails->PdbFilePath,
+                                                NULL,
+                                                ModuleDetails->BaseAddress,
+                                                FileSize);
+
+    if (ModuleDetails->ModuleBase == NULL)
+    {
+        ShowMessages("err, loading symbols failed (%x)\n",
+                     GetLastError());
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Callback for adding the symbols of a module to its cache
+ *
+ * @param SymInfo
+ * @param SymbolSize
+ * @param UserContext
+ *
+ * @return BOOL
+ */
+BOOL CALLBACK
+SymAddSymbolToCacheCallback(SYMBOL_INFO * SymInfo, ULONG SymbolSize, PVOID UserContext)
+{
+    PSYMBOL_CACHE_CREATION_CONTEXT Context = (PSYMBOL_CACHE_CREATION_CONTEXT)UserContext;
+
+    if (g_AbortLoadingExecution)
+    {
+        //
+        // Stop the enumeration
+        //
+        return FALSE;
+    }
+
+    if (SymInfo != 0)
+    {
+        SymCacheBuilderAddSymbol(Context->Builder, SymInfo->Name, SymInfo->Address - Context->ModuleBase, SymInfo->Size);
+    }
+
+    //
+    // Continue enumeration
+    //
+    return TRUE;
+}
+
+/**
+ * @brief Callback for adding the types of a module (and the layout of
+ * its structures) to its cache
+ * @details The fields are the same as SymGetFieldOffsetFromModule
+ *
+ * @param SymInfo
+ * @param SymbolSize
+ * @param UserContext
+ *
+ * @return BOOL
+ */
+BOOL CALLBACK
+SymAddTypeToCacheCallback(SYMBOL_INFO * SymInfo, ULONG SymbolSize, PVOID UserContext)
+{
+    PSYMBOL_CACHE_CREATION_CONTEXT Context       = (PSYMBOL_CACHE_CREATION_CONTEXT)UserContext;
+    UINT64                         Base          = Context->ModuleBase;
+    UINT64                         TypeSize      = 0;
+    DWORD                          ChildrenCount = 0;
+    CHAR                           FieldName[MAX_SYM_NAME];
+
+    if (g_AbortLoadingExecution)
+    {
+        //
+        // Stop the enumeration
+        //
+        return FALSE;
+    }
+
+    if (SymInfo == 0 ||
+        !SymGetTypeInfo(GetCurrentProcess(), Base, SymInfo->TypeIndex, TI_GET_LENGTH, &TypeSize))
+    {
+        return TRUE;
+    }
+
+    SymCacheBuilderAddType(Context->Builder, SymInfo->Name, TypeSize);
+
+    //
+    // Add the fields of the structures (and the unions)
+    //
+    if (SymInfo->Tag != SymTagUDT ||
+        !SymGetTypeInfo(GetCurrentProcess(), Base, SymInfo->TypeIndex, TI_GET_CHILDRENCOUNT, &ChildrenCount) ||
+        ChildrenCount == 0)
+    {
+        return TRUE;
+    }
+
+    auto FindChildrenParamsBacking = std::make_unique<UINT8[]>(
+        sizeof(_TI_FINDCHILDREN_PARAMS) + ((ChildrenCount - 1) * sizeof(ULONG)));
+    auto FindChildrenParams =
+        (_TI_FINDCHILDREN_PARAMS *)FindChildrenParamsBacking.get();
+
+    FindChildrenParams->Count = ChildrenCount;
+
+    if (!SymGetTypeInfo(GetCurrentProcess(), Base, SymInfo->TypeIndex, TI_FINDCHILDREN, FindChildrenParams))
+    {
+        return TRUE;
+    }
+
+    for (DWORD ChildIdx = 0; ChildIdx < ChildrenCount; ChildIdx++)
+    {
+        const ULONG ChildId     = FindChildrenParams->ChildId[ChildIdx];
+        WCHAR *     ChildName   = nullptr;
+        UINT64      ChildSize   = 0;
+        UINT32      FieldOffset = 0;
+
+        if (!SymGetTypeInfo(GetCurrentProcess(), Base, ChildId, TI_GET_SYMNAME, &ChildName))
+        {
+            continue;
+        }
+
+        //
+        // The position of the bit is saved for the fields of one bit
+        //
+        SymGetTypeInfo(GetCurrentProcess(), Base, ChildId, TI_GET_LENGTH, &ChildSize);
+
+        const IMAGEHLP_SYMBOL_TYPE_INFO Info =
+            (ChildSize == 1) ? TI_GET_BITPOSITION : TI_GET_OFFSET;
+        SymGetTypeInfo(GetCurrentProcess(), Base, ChildId, Info, &FieldOffset);
+
+        if (wcstombs(FieldName, ChildName, sizeof(FieldName)) < sizeof(FieldName))
+        {
+            SymCacheBuilderAddField(Context->Builder, FieldName, FieldOffset);
+        }
+
+        LocalFree(ChildName);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Create the cache of a module whose PDB file is loaded
+ * @details The symbols and the types are enumerated once (when the PDB file
+ * is loaded for the first time), and the cache is used in the next reloads
+ *
+ * @param ModuleDetails
+ * @param CachePath
+ * @param GuidAndAge
+ * @param PdbFileSize
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SymCreateSymbolCache(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails,
+                     const char *                  CachePath,
+                     const char *                  GuidAndAge,
+                     UINT64                        PdbFileSize)
+{
+    SYMBOL_CACHE_BUILDER          Builder;
+    SYMBOL_CACHE_CREATION_CONTEXT Context = {&Builder, ModuleDetails->ModuleBase};
+
+    if (!SymEnumSymbols(GetCurrentProcess(), ModuleDetails->ModuleBase, NULL, SymAddSymbolToCacheCallback, &Context) ||
+        !SymEnumTypes(GetCurrentProcess(), ModuleDetails->ModuleBase, SymAddTypeToCacheCallback, &Context) ||
+        g_AbortLoadingExecution)
+    {
+        return FALSE;
+    }
+
+    return SymCacheWrite(&Builder, CachePath, GuidAndAge, PdbFileSize);
+}
+
+/**
+ * @brief load the symbols of a prepared module (from its cache if the cache
+ * is available)
+ * @details The cache is saved in the GUID and age directory of the PDB file
+ * in the symbol store (SymDir\pdb\GuidAndAge\pdb.hdcache), and it's created
+ * the first time the PDB file is loaded
+ *
+ * @param Module the module that is prepared by SymPrepareModuleSymbolCallback
+ *
+ * @return UINT32
+ */
+static UINT32
+SymLoadPreparedModuleSymbol(PSYMBOL_LOADING_MODULE Module)
+{
+    UINT64       BaseAddress      = Module->Details->BaseAddress;
+    const char * PdbFileName      = Module->PdbFilePath.c_str();
+    const char * CustomModuleName = Module->CustomModuleName.empty() ? NULL : Module->CustomModuleName.c_str();
+
+    //
+    // The cache is not used for this module (it has no GUID and age, or no
+    // base address)
+    //
+    if (Module->CacheDir.empty())
+    {
+        return SymLoadFileSymbol(BaseAddress, PdbFileName, CustomModuleName);
+    }
+
+    //
+    // Use the cache if it's the cache of this PDB file (it's opened while the
+    // module is prepared)
+    //
+    if (Module->Cache != NULL)
+    {
+        PSYMBOL_CACHE Cache = Module->Cache;
+
+        //
+        // The cache is owned by the loaded module from now on
+        //
+        Module->Cache = NULL;
+
+        if (SymLoadFileSymbolOrCache(BaseAddress, PdbFileName, CustomModuleName, Cache) != 0)
+        {
+            SymCacheClose(Cache);
+            return -1;
+        }
+
+        return 0;
+    }
+
+    //
+    // Otherwise, load the PDB file and create the cache
+    //
+    if (SymLoadFileSymbol(BaseAddress, PdbFileName, CustomModuleName) != 0)
+    {
+        return -1;
+    }
+
+    if (CreateDirectoryRecursive(Module->CacheDir))
+    {
+        SymCreateSymbolCache(g_LoadedModules.back(), Module->CachePath.c_str(), Module->Details->ModuleSymbolGuidAndAge, Module->PdbFileSize);
+    }
+
+    return 0;
+}
+
 /**
  * @brief Unload one module symbol
  *
@@ -773,17 +1063,25 @@ SymUnloadModuleSymbol(char * ModuleName)
         if (strcmp(item->ModuleName, ModuleName) == 0 || strcmp(item->ModuleAlternativeName, ModuleName) == 0)
         {
             //
-            // Unload symbol for the module
+            // Unload symbol for the module (if its PDB is loaded)
             //
-            Ret = SymUnloadModule64(GetCurrentProcess(), item->ModuleBase);
-
-            if (!Ret)
+            if (item->ModuleBase != NULL)
             {
-                ShowMessages("err, unload symbol failed (%x)\n",
-                             GetLastError());
-                return -1;
+                Ret = SymUnloadModule64(GetCurrentProcess(), item->ModuleBase);
+
+                if (!Ret)
+                {
+                    ShowMessages("err, unload symbol failed (%x)\n",
+                                 GetLastError());
+                    return -1;
+                }
             }
 
+            //
+            // Unmap the cache of the module (if any)
+            //
+            SymCacheClose(item->Cache);
+
             OneModuleFound = TRUE;
 
             free(item);
@@ -840,16 +1138,24 @@ SymUnloadAllSymbols()
         IsAnythingLoaded = TRUE;
 
         //
-        // Unload symbols for the module
+        // Unload symbols for the module (if its PDB is loaded)
         //
-        Ret = SymUnloadModule64(GetCurrentProcess(), item->ModuleBase);
-
-        if (!Ret)
+        if (item->ModuleBase != NULL)
         {
-            // ShowMessages("err, unload symbol failed (%x)\n",
-            //              GetLastError());
+            Ret = SymUnloadModule64(GetCurrentProcess(), item->ModuleBase);
+
+            if (!Ret)
+            {
+                // ShowMessages("err, unload symbol failed (%x)\n",
+                //              GetLastError());
+            }
         }
 
+        //
+        // Unmap the cache of the module (if any)
+        //
+        SymCacheClose(item->Cache);
+
         free(item);
     }
 
@@ -899,14 +1205,16 @@ SymUnloadAllSymbols()
 UINT64
 SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
 {
-    BOOLEAN      Found   = FALSE;
-    UINT64       Address = NULL;
-    UINT64       Buffer[(sizeof(SYMBOL_INFO) + MAX_SYM_NAME * sizeof(CHAR) + sizeof(UINT64) - 1) / sizeof(UINT64)];
-    PSYMBOL_INFO Symbol = (PSYMBOL_INFO)Buffer;
-    string       FinalModuleName;
-    string       TempName(FunctionOrVariableName);
-    string       ExtractedModuleName;
-    string       FunctionName;
+    BOOLEAN                       Found   = FALSE;
+    UINT64                        Address = NULL;
+    UINT64                        Buffer[(sizeof(SYMBOL_INFO) + MAX_SYM_NAME * sizeof(CHAR) + sizeof(UINT64) - 1) / sizeof(UINT64)];
+    PSYMBOL_INFO                  Symbol = (PSYMBOL_INFO)Buffer;
+    PSYMBOL_LOADED_MODULE_DETAILS Module = NULL;
+    UINT64                        Rva    = 0;
+    string                        FinalModuleName;
+    string                        TempName(FunctionOrVariableName);
+    string                        ExtractedModuleName;
+    string                        FunctionName;
 
     //
     // Not found by default
@@ -952,6 +1260,7 @@ SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
             {
                 string ModuleName(item->ModuleName);
                 FinalModuleName = ModuleName + "!" + FunctionName;
+                Module          = item;
                 break;
             }
 
@@ -965,6 +1274,7 @@ SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
                 //
                 string ModuleName(item->ModuleName);
                 FinalModuleName = ModuleName + "!" + FunctionName;
+                Module          = item;
                 break;
             }
         }
@@ -974,6 +1284,8 @@ SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
         //
         // It doesn't contain a module name, so we'll use 'nt' by default
         //
+        FunctionName = TempName;
+
         for (auto item : g_LoadedModules)
         {
             //
@@ -985,7 +1297,8 @@ SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
                 // Replace the alternative module name with original module name
                 //
                 string ModuleName(item->ModuleName);
-                FinalModuleName = ModuleName + "!" + TempName;
+                FinalModuleName = ModuleName + "!" + FunctionName;
+                Module          = item;
                 break;
             }
         }
@@ -1000,6 +1313,21 @@ SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
         return NULL;
     }
 
+    //
+    // Resolve it from the cache of the module (if any)
+    //
+    if (Module->Cache != NULL)
+    {
+        if (SymCacheFindSymbol(Module->Cache, FunctionName.c_str(), &Rva))
+        {
+            *WasFound = TRUE;
+            return Module->BaseAddress + Rva;
+        }
+
+        *WasFound = FALSE;
+        return NULL;
+    }
+
     if (SymFromName(GetCurrentProcess(), FinalModuleName.c_str(), Symbol))
     {
         //
@@ -1073,6 +1401,14 @@ SymGetFieldOffset(CHAR * TypeName, CHAR * FieldName, UINT32 * FieldOffset)
         Index++;
     }
 
+    //
+    // Resolve it from the cache of the module (if any)
+    //
+    if (SymbolInfo->Cache != NULL)
+    {
+        return SymCacheGetFieldOffset(SymbolInfo->Cache, TypeName, FieldName, FieldOffset);
+    }
+
     //
     // Convert TypeName to wide-char, it's because SymGetTypeInfo supports
     // wide-char
@@ -1161,6 +1497,14 @@ SymGetDataTypeSize(CHAR * TypeName, UINT64 * TypeSize)
         Index++;
     }
 
+    //
+    // Resolve it from the cache of the module (if any)
+    //
+    if (SymbolInfo->Cache != NULL)
+    {
+        return SymCacheGetDataTypeSize(SymbolInfo->Cache, TypeName, TypeSize);
+    }
+
     //
     // Convert FieldName to wide-char, it's because SymGetTypeInfo supports
     // wide-char
@@ -1213,6 +1557,15 @@ SymSearchSymbolForMask(const char * SearchMask)
         return -1;
     }
 
+    //
+    // The search masks are not resolved from the cache, so the PDB file is
+    // loaded (if the symbols of the module are resolved from the cache)
+    //
+    if (!SymLoadPdbOfCachedModule(SymbolInfo))
+    {
+        return -1;
+    }
+
     Ret = SymEnumSymbols(
         GetCurrentProcess(),           // Process handle of the current process
         SymbolInfo->ModuleBase,        // Base address of the module
@@ -1259,6 +1612,15 @@ SymCreateSymbolTableForDisassembler(void * CallbackFunction)
         //
         g_CurrentModuleName = (char *)item->ModuleName;
 
+        //
+        // Deliver the symbols of the cache (if any)
+        //
+        if (item->Cache != NULL)
+        {
+            SymCacheEnumerateSymbols(item->Cache, SymDeliverCachedDisassemblerSymbolMapCallback, item);
+            continue;
+        }
+
         //
         // Call the callback for the current module
         //
@@ -1613,6 +1975,31 @@ SymDeliverDisassemblerSymbolMapCallback(SYMBOL_INFO * SymInfo, ULONG SymbolSize,
     return TRUE;
 }
 
+/**
+ * @brief Callback for delivering module!ObjectName of the cache of a module
+ * to disassembler symbol map
+ *
+ * @param Name
+ * @param Rva
+ * @param Size
+ * @param Context the module
+ *
+ * @return VOID
+ */
+VOID
+SymDeliverCachedDisassemblerSymbolMapCallback(const CHAR * Name, UINT64 Rva, UINT32 Size, PVOID Context)
+{
+    PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails = (PSYMBOL_LOADED_MODULE_DETAILS)Context;
+
+    if (g_SymbolMapForDisassembler != NULL)
+    {
+        //
+        // Call the remote callback
+        //
+        g_SymbolMapForDisassembler(ModuleDetails->BaseAddress + Rva, g_CurrentModuleName, (CHAR *)Name, Size);
+    }
+}
+
 /**
  * @brief Show symbols details
  *
@@ -1921,233 +2308,272 @@ SymConvertLoadedModuleToPdbFileAndGuidAndAgeDetails(const BYTE * LoadedImageByte
 }
 
 /**
- * @brief check if the pdb files of loaded symbols are available or not
+ * @brief Prepare the symbols of a module for loading them
+ * @details Called by the threads of the loader (in parallel with the other
+ * modules), so it only downloads the PDB file, finds the alternative name
+ * of the module and opens its cache (DbgHelp is single-threaded, so the
+ * symbols are loaded by SymMergeModuleSymbolCallback)
  *
- * @param BufferToStoreDetails Pointer to a buffer to store the symbols details
- * this buffer will be allocated by this function and needs to be freed by caller
- * @param StoredLength The length that stored on the BufferToStoreDetails
- * @param DownloadIfAvailable Download the file if its available online
- * @param SymbolPath The path of symbols
- * @param IsSilentLoad
+ * @param Index the index of the module
+ * @param Context the loading context
  *
- * @return BOOLEAN
+ * @return VOID
  */
-BOOLEAN
-SymbolInitLoad(PVOID        BufferToStoreDetails,
-               UINT32       StoredLength,
-               BOOLEAN      DownloadIfAvailable,
-               const char * SymbolPath,
-               BOOLEAN      IsSilentLoad)
+VOID
+SymPrepareModuleSymbolCallback(UINT32 Index, PVOID Context)
 {
-    string                Tmp, SymDir, CustomModuleNameStr;
-    const char *          CustomModuleName = NULL;
-    string                SymPath(SymbolPath);
-    PMODULE_SYMBOL_DETAIL BufferToStoreDetailsConverted = (PMODULE_SYMBOL_DETAIL)BufferToStoreDetails;
-
-    vector<string> SplitedSymPath = Split(SymPath, '*');
-    if (SplitedSymPath.size() < 2)
-        return FALSE;
-    if (SplitedSymPath[1].find(":\\") == string::npos)
-        return FALSE;
-
-    Tmp = SymDir = SplitedSymPath[1];
+    PSYMBOL_LOADING_CONTEXT LoadingContext       = (PSYMBOL_LOADING_CONTEXT)Context;
+    PSYMBOL_LOADING_MODULE  Module               = &LoadingContext->Modules[Index];
+    PMODULE_SYMBOL_DETAIL   Details              = Module->Details;
+    char                    FileName[_MAX_FNAME] = {0};
+    char                    FileExt[_MAX_EXT]    = {0};
 
     //
-    // Split each module and details
+    // Check if symbol pdb detail is available in the module
     //
-    for (SIZE_T i = 0; i < StoredLength / sizeof(MODULE_SYMBOL_DETAIL); i++)
+    if (!Details->IsSymbolDetailsFound)
     {
         //
-        // Check for abort
+        // Ignore the module
         //
-        if (g_AbortLoadingExecution)
-        {
-            g_AbortLoadingExecution = FALSE;
-            return FALSE;
-        }
+        return;
+    }
 
+    //
+    // Check if it's a local path (a path) or a microsoft symbol
+    //
+    if (Details->IsLocalSymbolPath)
+    {
+        Module->PdbFilePath = Details->ModuleSymbolPath;
+    }
+    else
+    {
         //
-        // Check if symbol pdb detail is available in the module
+        // It might be a Windows symbol
         //
-        if (!BufferToStoreDetailsConverted[i].IsSymbolDetailsFound)
-        {
-            //
-            // Ignore the module
-            //
-            continue;
-        }
+        Module->PdbFilePath = LoadingContext->SymDir +
+                              "\\" +
+                              Details->ModuleSymbolPath +
+                              "\\" +
+                              Details->ModuleSymbolGuidAndAge +
+                              "\\" +
+                              Details->ModuleSymbolPath;
 
         //
-        // Check if it's a local path (a path) or a microsoft symbol
+        // Download the symbols file if not available
         //
-        if (BufferToStoreDetailsConverted[i].IsLocalSymbolPath)
+        if (LoadingContext->DownloadIfAvailable && IsFileExists(Module->PdbFilePath) == FALSE)
         {
-            //
-            // If this is a local driver, then load the pdb
-            //
-            if (IsFileExists(BufferToStoreDetailsConverted[i].ModuleSymbolPath))
-            {
-                BufferToStoreDetailsConverted[i].IsSymbolPDBAvaliable = TRUE;
+            SymbolPdbDownload(Details->ModuleSymbolPath,
+                              Details->ModuleSymbolGuidAndAge,
+                              LoadingContext->SymPath,
+                              &Module->DownloadResult);
+        }
+    }
 
-                //
-                // Load symbol locally
-                //
-                if (!IsSilentLoad)
-                {
-                    ShowMessages("loading symbol '%s'...", Tmp.c_str());
-                }
+    //
+    // Check again to see if the symbol already download or not
+    //
+    if (!IsFileExists(Module->PdbFilePath))
+    {
+        return;
+    }
 
-                //
-                // Check if we need an alternative module name (in 32-bit modules)
-                //
-                CustomModuleName = NULL;
+    Module->IsPdbAvailable = TRUE;
 
-                // ShowMessages("name: %s , is 32-bit? %s\n", BufferToStoreDetailsConverted[i].FilePath, BufferToStoreDetailsConverted[i].Is32Bit ? "true" : "false");
+    //
+    // Check for alternative module names (in 32-bit modules and the nt module),
+    // the name is only set if the module has an alternative name
+    //
+    if (Details->Is32Bit)
+    {
+        SymCheckAndRemoveWow64Prefix(Details->FilePath, Module->PdbFilePath.c_str(), Module->CustomModuleName);
+    }
+    else
+    {
+        SymCheckNtoskrnlPrefix(Module->PdbFilePath.c_str(), Module->CustomModuleName);
+    }
 
-                //
-                // Check for alternative module names
-                //
-                if (BufferToStoreDetailsConverted[i].Is32Bit &&
-                    SymCheckAndRemoveWow64Prefix(BufferToStoreDetailsConverted[i].FilePath,
-                                                 BufferToStoreDetailsConverted[i].ModuleSymbolPath,
-                                                 CustomModuleNameStr))
-                {
-                    //
-                    // The name of the module contains a prefix which should be removed
-                    //
-                    CustomModuleName = CustomModuleNameStr.c_str();
-                }
-                else if (!BufferToStoreDetailsConverted[i].Is32Bit &&
-                         SymCheckNtoskrnlPrefix(BufferToStoreDetailsConverted[i].ModuleSymbolPath, CustomModuleNameStr))
-                {
-                    //
-                    // This is an nt module
-                    //
-                    CustomModuleName = CustomModuleNameStr.c_str();
-                }
+    //
+    // The cache is not used for the modules without a GUID and age (and without
+    // a base address, as the addresses of the cache are relative to it)
+    //
+    if (Details->ModuleSymbolGuidAndAge[0] == '\0' || Details->BaseAddress == NULL ||
+        !SymGetFileSize(Module->PdbFilePath.c_str(), Module->PdbFileSize))
+    {
+        return;
+    }
 
-                if (SymLoadFileSymbol(BufferToStoreDetailsConverted[i].BaseAddress,
-                                      BufferToStoreDetailsConverted[i].ModuleSymbolPath,
-                                      CustomModuleName) == 0)
-                {
-                    if (!IsSilentLoad)
-                    {
-                        ShowMessages("\tloaded\n");
-                    }
-                }
-                else
-                {
-                    if (!IsSilentLoad)
-                    {
-                        ShowMessages("\tnot loaded (already loaded?)\n");
-                    }
-                }
-            }
+    _splitpath(Module->PdbFilePath.c_str(), NULL, NULL, FileName, FileExt);
+
+    Module->CacheDir  = LoadingContext->SymDir + "\\" + FileName + FileExt + "\\" + Details->ModuleSymbolGuidAndAge + "\\";
+    Module->CachePath = Module->CacheDir + FileName + SYMBOL_CACHE_FILE_EXTENSION;
+
+    //
+    // Open the cache if it's the cache of this PDB file
+    //
+    Module->Cache = SymCacheOpen(Module->CachePath.c_str(), Details->ModuleSymbolGuidAndAge, Module->PdbFileSize);
+}
+
+/**
+ * @brief Load the symbols of a prepared module
+ * @details Called by the thread of the loader, one module after another in
+ * the order of the modules
+ *
+ * @param Index the index of the module
+ * @param Context the loading context
+ *
+ * @return VOID
+ */
+VOID
+SymMergeModuleSymbolCallback(UINT32 Index, PVOID Context)
+{
+    PSYMBOL_LOADING_CONTEXT LoadingContext = (PSYMBOL_LOADING_CONTEXT)Context;
+    PSYMBOL_LOADING_MODULE  Module         = &LoadingContext->Modules[Index];
+
+    //
+    // Show the result of downloading the PDB file (if it's downloaded)
+    //
+    if (Module->DownloadResult != S_FALSE && !LoadingContext->IsSilentLoad)
+    {
+        if (Module->DownloadResult == S_OK)
+        {
+            ShowMessages("downloading symbol '%s'...\tdownloaded\n", Module->Details->ModuleSymbolPath);
         }
         else
         {
-            //
-            // It might be a Windows symbol
-            //
-            Tmp = SymDir +
-                  "\\" +
-                  BufferToStoreDetailsConverted[i].ModuleSymbolPath +
-                  "\\" +
-                  BufferToStoreDetailsConverted[i].ModuleSymbolGuidAndAge +
-                  "\\" +
-                  BufferToStoreDetailsConverted[i].ModuleSymbolPath;
+            ShowMessages("downloading symbol '%s'...\tcould not be downloaded (%x) \n",
+                         Module->Details->ModuleSymbolPath,
+                         Module->DownloadResult);
+        }
+    }
 
-            //
-            // Download the symbols file if not available
-            //
-            if (DownloadIfAvailable && IsFileExists(Tmp) == FALSE)
-            {
-                //
-                // Download the symbol
-                //
-                SymbolPdbDownload(BufferToStoreDetailsConverted[i].ModuleSymbolPath,
-                                  BufferToStoreDetailsConverted[i].ModuleSymbolGuidAndAge,
-                                  SymPath,
-                                  IsSilentLoad);
-            }
+    if (!Module->IsPdbAvailable)
+    {
+        return;
+    }
 
-            //
-            // Check again to see if the symbol already download or not
-            //
-            if (IsFileExists(Tmp))
-            {
-                BufferToStoreDetailsConverted[i].IsSymbolPDBAvaliable = TRUE;
+    Module->Details->IsSymbolPDBAvaliable = TRUE;
 
-                if (!IsSilentLoad)
-                {
-                    ShowMessages("loading symbol '%s'...", Tmp.c_str());
-                }
+    if (!LoadingContext->IsSilentLoad)
+    {
+        ShowMessages("loading symbol '%s'...", Module->PdbFilePath.c_str());
+    }
 
-                //
-                // Check if we need an alternative module name (in 32-bit modules)
-                //
-                CustomModuleName = NULL;
+    if (SymLoadPreparedModuleSymbol(Module) == 0)
+    {
+        if (!LoadingContext->IsSilentLoad)
+        {
+            ShowMessages("\tloaded\n");
+        }
+    }
+    else
+    {
+        if (!LoadingContext->IsSilentLoad)
+        {
+            ShowMessages("\tnot loaded (already loaded?)\n");
+        }
+    }
+}
 
-                // ShowMessages("name: %s , is 32-bit? %s\n", BufferToStoreDetailsConverted[i].FilePath, BufferToStoreDetailsConverted[i].Is32Bit ? "true" : "false");
+/**
+ * @brief check if the pdb files of loaded symbols are available or not
+ * @details The modules are prepared (their PDB files are downloaded and their
+ * caches are opened) by a pool of threads, and their symbols are loaded in
+ * the order of the modules
+ *
+ * @param BufferToStoreDetails Pointer to a buffer to store the symbols details
+ * this buffer will be allocated by this function and needs to be freed by caller
+ * @param StoredLength The length that stored on the BufferToStoreDetails
+ * @param DownloadIfAvailable Download the file if its available online
+ * @param SymbolPath The path of symbols
+ * @param IsSilentLoad
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymbolInitLoad(PVOID        BufferToStoreDetails,
+               UINT32       StoredLength,
+               BOOLEAN      DownloadIfAvailable,
+               const char * SymbolPath,
+               BOOLEAN      IsSilentLoad)
+{
+    SYMBOL_LOADING_CONTEXT LoadingContext;
+    UINT32                 NumberOfModules               = StoredLength / sizeof(MODULE_SYMBOL_DETAIL);
+    PMODULE_SYMBOL_DETAIL  BufferToStoreDetailsConverted = (PMODULE_SYMBOL_DETAIL)BufferToStoreDetails;
+    BOOLEAN                Result;
 
-                //
-                // Check for alternative module names
-                //
-                if (BufferToStoreDetailsConverted[i].Is32Bit &&
-                    SymCheckAndRemoveWow64Prefix(BufferToStoreDetailsConverted[i].FilePath,
-                                                 Tmp.c_str(),
-                                                 CustomModuleNameStr))
-                {
-                    //
-                    // The name of the module contains a prefix which should be removed
-                    //
-                    CustomModuleName = CustomModuleNameStr.c_str();
-                }
-                else if (!BufferToStoreDetailsConverted[i].Is32Bit &&
-                         SymCheckNtoskrnlPrefix(Tmp.c_str(), CustomModuleNameStr))
-                {
-                    //
-                    // This is an nt module
-                    //
-                    CustomModuleName = CustomModuleNameStr.c_str();
-                }
+    LoadingContext.SymPath = SymbolPath;
 
-                if (SymLoadFileSymbol(BufferToStoreDetailsConverted[i].BaseAddress, Tmp.c_str(), CustomModuleName) == 0)
-                {
-                    if (!IsSilentLoad)
-                    {
-                        ShowMessages("\tloaded\n");
-                    }
-                }
-                else
-                {
-                    if (!IsSilentLoad)
-                    {
-                        ShowMessages("\tnot loaded (already loaded?)\n");
-                    }
-                }
-            }
+    vector<string> SplitedSymPath = Split(LoadingContext.SymPath, '*');
+    if (SplitedSymPath.size() < 2)
+        return FALSE;
+    if (SplitedSymPath[1].find(":\\") == string::npos)
+        return FALSE;
+
+    LoadingContext.SymDir              = SplitedSymPath[1];
+    LoadingContext.DownloadIfAvailable = DownloadIfAvailable;
+    LoadingContext.IsSilentLoad        = IsSilentLoad;
+
+    LoadingContext.Modules.resize(NumberOfModules);
+
+    for (UINT32 i = 0; i < NumberOfModules; i++)
+    {
+        LoadingContext.Modules[i].Details        = &BufferToStoreDetailsConverted[i];
+        LoadingContext.Modules[i].DownloadResult = S_FALSE;
+    }
+
+    //
+    // Prepare the modules by a pool of threads and load them one after another
+    // (DbgHelp is single-threaded), it stops if the loading is aborted
+    //
+    Result = SymLoaderRun(NumberOfModules,
+                          SYMBOL_LOADER_MAXIMUM_THREADS,
+                          SymPrepareModuleSymbolCallback,
+                          SymMergeModuleSymbolCallback,
+                          &LoadingContext,
+                          &g_AbortLoadingExecution);
+
+    //
+    // Close the caches of the modules that are prepared but not loaded
+    //
+    for (SYMBOL_LOADING_MODULE & Module : LoadingContext.Modules)
+    {
+        if (Module.Cache != NULL)
+        {
+            SymCacheClose(Module.Cache);
         }
     }
 
+    if (!Result)
+    {
+        g_AbortLoadingExecution = FALSE;
+        return FALSE;
+    }
+
     return TRUE;
 }
 
 /**
  * @brief download pdb file
+ * @details The messages are not shown, as the files are downloaded by the
+ * threads of the loader (the result is shown when the module is loaded)
  *
  * @param SymName the name of the symbol (pdb file name)
  * @param GUID the GUID and age string identifying the symbol version
  * @param SymPath the symbol search path
- * @param IsSilentLoad download without any message
+ * @param DownloadResult the result of downloading the file (S_FALSE if
+ * there is no symbol server in the symbol path)
  *
  * @return BOOLEAN
  */
 BOOLEAN
-SymbolPdbDownload(std::string SymName, const std::string & GUID, const std::string & SymPath, BOOLEAN IsSilentLoad)
+SymbolPdbDownload(std::string SymName, const std::string & GUID, const std::string & SymPath, HRESULT * DownloadResult)
 {
+    *DownloadResult = S_FALSE;
+
     vector<string> SplitedSymPath = Split(SymPath, '*');
-    if (SplitedSymPath.size() < 2)
+    if (SplitedSymPath.size() < 3)
         return FALSE;
     if (SplitedSymPath[1].find(":\\") == string::npos)
         return FALSE;
@@ -2160,37 +2586,13 @@ SymbolPdbDownload(std::string SymName, const std::string & GUID, const std::stri
     string SymFullDir        = SymDir + "\\" + SymName + "\\" + GUID + "\\";
     if (!CreateDirectoryRecursive(SymFullDir))
     {
-        if (!IsSilentLoad)
-        {
-            ShowMessages("err, unable to create sympath directory '%s'\n", SymFullDir.c_str());
-        }
+        *DownloadResult = HRESULT_FROM_WIN32(GetLastError());
         return FALSE;
     }
 
-    if (!IsSilentLoad)
-    {
-        ShowMessages("downloading symbol '%s'...", SymName.c_str());
-    }
-
-    HRESULT Result = URLDownloadToFileA(NULL, DownloadURL.c_str(), (SymFullDir + "\\" + SymName).c_str(), 0, NULL);
-
-    if (Result == S_OK)
-    {
-        if (!IsSilentLoad)
-        {
-            ShowMessages("\tdownloaded\n");
-        }
-        return TRUE;
-    }
-    else
-    {
-        if (!IsSilentLoad)
-        {
-            ShowMessages("\tcould not be downloaded (%x) \n", Result);
-        }
-    }
+    *DownloadResult = URLDownloadToFileA(NULL, DownloadURL.c_str(), (SymFullDir + "\\" + SymName).c_str(), 0, NULL);
 
-    return FALSE;
+    return *DownloadResult == S_OK;
 }
 
 /**
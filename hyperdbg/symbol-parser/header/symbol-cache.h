@@ -0,0 +1,193 @@
+/**
+ * @file symbol-cache.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Preprocessed symbol cache (headers)
+ * @details
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions                 //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The signature of the cache files ("HDSC")
+ *
+ */
+#define SYMBOL_CACHE_MAGIC 0x43534448
+
+/**
+ * @brief The version of the format of the cache files
+ * @details The files of the other versions are ignored (and rebuilt)
+ *
+ */
+#define SYMBOL_CACHE_VERSION 1
+
+/**
+ * @brief The extension of the cache files (saved next to the PDB files in
+ * the GUID and age directory of the symbol store)
+ *
+ */
+#define SYMBOL_CACHE_FILE_EXTENSION ".hdcache"
+
+//////////////////////////////////////////////////
+//					Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The header of a cache file
+ * @details The offsets are from the start of the file, and the cache is
+ * only used if its GUID and age and the size of its PDB file are the same
+ * as the PDB file that is loaded
+ *
+ */
+typedef struct _SYMBOL_CACHE_HEADER
+{
+    UINT32 Magic;
+    UINT32 Version;
+    CHAR   GuidAndAge[MAXIMUM_GUID_AND_AGE_SIZE];
+    UINT32 Reserved;
+    UINT64 PdbFileSize;
+    UINT64 FileSize;
+    UINT32 SymbolsOffset;
+    UINT32 SymbolsCount;
+    UINT32 SymbolsByNameOffset;
+    UINT32 TypesOffset;
+    UINT32 TypesCount;
+    UINT32 FieldsOffset;
+    UINT32 FieldsCount;
+    UINT32 NamesOffset;
+    UINT32 NamesSize;
+    UINT32 Reserved2;
+
+} SYMBOL_CACHE_HEADER, *PSYMBOL_CACHE_HEADER;
+
+/**
+ * @brief A symbol (function or variable) of the cache
+ * @details The symbols are saved in the order of their enumeration, and
+ * their address is relative to the base address of the module
+ *
+ */
+typedef struct _SYMBOL_CACHE_SYMBOL
+{
+    UINT64 Rva;
+    UINT32 Size;
+    UINT32 NameOffset;
+
+} SYMBOL_CACHE_SYMBOL, *PSYMBOL_CACHE_SYMBOL;
+
+/**
+ * @brief A name of the symbols of the cache (sorted by name)
+ * @details The name is saved with the index of its symbol, so the names are
+ * compared without reading the symbols
+ *
+ */
+typedef struct _SYMBOL_CACHE_NAME
+{
+    UINT32 NameOffset;
+    UINT32 Symbol;
+
+} SYMBOL_CACHE_NAME, *PSYMBOL_CACHE_NAME;
+
+/**
+ * @brief A type of the cache (sorted by name)
+ *
+ */
+typedef struct _SYMBOL_CACHE_TYPE
+{
+    UINT64 Size;
+    UINT32 NameOffset;
+    UINT32 FirstField;
+    UINT32 FieldsCount;
+    UINT32 Reserved;
+
+} SYMBOL_CACHE_TYPE, *PSYMBOL_CACHE_TYPE;
+
+/**
+ * @brief A field of a type of the cache
+ * @details The offset is the position of the bit for the fields of one bit
+ * (the same as SymGetFieldOffset)
+ *
+ */
+typedef struct _SYMBOL_CACHE_FIELD
+{
+    UINT32 NameOffset;
+    UINT32 Offset;
+
+} SYMBOL_CACHE_FIELD, *PSYMBOL_CACHE_FIELD;
+
+/**
+ * @brief A memory-mapped cache file
+ *
+ */
+typedef struct _SYMBOL_CACHE
+{
+    const BYTE *                Mapping;
+    SIZE_T                      MappingSize;
+    const SYMBOL_CACHE_HEADER * Header;
+    const SYMBOL_CACHE_SYMBOL * Symbols;
+    const SYMBOL_CACHE_NAME *   SymbolsByName;
+    const SYMBOL_CACHE_TYPE *   Types;
+    const SYMBOL_CACHE_FIELD *  Fields;
+    const CHAR *                Names;
+
+} SYMBOL_CACHE, *PSYMBOL_CACHE;
+
+/**
+ * @brief The symbols and the types of a module that are saved to a
+ * cache file
+ *
+ */
+typedef struct _SYMBOL_CACHE_BUILDER
+{
+    std::vector<SYMBOL_CACHE_SYMBOL> Symbols;
+    std::vector<SYMBOL_CACHE_TYPE>   Types;
+    std::vector<SYMBOL_CACHE_FIELD>  Fields;
+    std::vector<CHAR>                Names;
+
+} SYMBOL_CACHE_BUILDER, *PSYMBOL_CACHE_BUILDER;
+
+/**
+ * @brief Callback of enumerating the symbols of a cache
+ *
+ */
+typedef VOID (*SYMBOL_CACHE_SYMBOL_CALLBACK)(const CHAR * Name, UINT64 Rva, UINT32 Size, PVOID Context);
+
+//////////////////////////////////////////////////
+//					Functions                   //
+//////////////////////////////////////////////////
+
+VOID
+SymCacheBuilderAddSymbol(PSYMBOL_CACHE_BUILDER Builder, const CHAR * Name, UINT64 Rva, UINT32 Size);
+
+VOID
+SymCacheBuilderAddType(PSYMBOL_CACHE_BUILDER Builder, const CHAR * Name, UINT64 Size);
+
+VOID
+SymCacheBuilderAddField(PSYMBOL_CACHE_BUILDER Builder, const CHAR * Name, UINT32 Offset);
+
+BOOLEAN
+SymCacheWrite(PSYMBOL_CACHE_BUILDER Builder, const CHAR * CachePath, const CHAR * GuidAndAge, UINT64 PdbFileSize);
+
+PSYMBOL_CACHE
+SymCacheOpen(const CHAR * CachePath, const CHAR * GuidAndAge, UINT64 PdbFileSize);
+
+VOID
+SymCacheClose(PSYMBOL_CACHE Cache);
+
+BOOLEAN
+SymCacheFindSymbol(const SYMBOL_CACHE * Cache, const CHAR * Name, UINT64 * Rva);
+
+BOOLEAN
+SymCacheGetDataTypeSize(const SYMBOL_CACHE * Cache, const CHAR * TypeName, UINT64 * TypeSize);
+
+BOOLEAN
+SymCacheGetFieldOffset(const SYMBOL_CACHE * Cache, const CHAR * TypeName, const CHAR * FieldName, UINT32 * FieldOffset);
+
+VOID
+SymCacheEnumerateSymbols(const SYMBOL_CACHE * Cache, SYMBOL_CACHE_SYMBOL_CALLBACK Callback, PVOID Context);
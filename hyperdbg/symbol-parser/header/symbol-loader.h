@@ -0,0 +1,73 @@
+/**
+ * @file symbol-loader.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Parallel loading of the symbols of the modules (headers)
+ * @details
+ * @version 0.23
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions                 //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The maximum number of the threads that prepare the symbols of
+ * the modules
+ * @details Preparing a module is mostly waiting for the disk and the
+ * symbol server, so the number of the threads is not limited to the
+ * number of the processors
+ *
+ */
+#define SYMBOL_LOADER_MAXIMUM_THREADS 8
+
+//////////////////////////////////////////////////
+//					Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Callback of preparing a module (called by the threads of the pool,
+ * in parallel with the other modules)
+ *
+ */
+typedef VOID (*SYMBOL_LOADER_PREPARE_CALLBACK)(UINT32 Index, PVOID Context);
+
+/**
+ * @brief Callback of merging a prepared module (called by the thread of the
+ * loader, one module after another in the order of their index)
+ *
+ */
+typedef VOID (*SYMBOL_LOADER_MERGE_CALLBACK)(UINT32 Index, PVOID Context);
+
+/**
+ * @brief The state of the modules that are loaded by a pool of threads
+ *
+ */
+typedef struct _SYMBOL_LOADER
+{
+    UINT32                         NumberOfModules;
+    SYMBOL_LOADER_PREPARE_CALLBACK Prepare;
+    PVOID                          Context;
+    const volatile BOOLEAN *       Abort;
+    std::atomic<UINT32>            NextModuleIndex;
+    std::vector<BOOLEAN>           IsModulePrepared; // protected by Lock
+    std::mutex                     Lock;
+    std::condition_variable        ModulePrepared;
+
+} SYMBOL_LOADER, *PSYMBOL_LOADER;
+
+//////////////////////////////////////////////////
+//					Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+SymLoaderRun(UINT32                         NumberOfModules,
+             UINT32                         NumberOfThreads,
+             SYMBOL_LOADER_PREPARE_CALLBACK Prepare,
+             SYMBOL_LOADER_MERGE_CALLBACK   Merge,
+             PVOID                          Context,
+             const volatile BOOLEAN *       Abort);
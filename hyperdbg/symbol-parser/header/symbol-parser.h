@@ -27,14 +27,61 @@
  */
 typedef struct _SYMBOL_LOADED_MODULE_DETAILS
 {
-    UINT64 BaseAddress;
-    UINT64 ModuleBase;
-    char   ModuleName[_MAX_FNAME];
-    char   ModuleAlternativeName[_MAX_FNAME];
-    char   PdbFilePath[MAX_PATH];
+    UINT64        BaseAddress;
+    UINT64        ModuleBase; // NULL if the symbols are resolved from the cache (the PDB is not loaded)
+    char          ModuleName[_MAX_FNAME];
+    char          ModuleAlternativeName[_MAX_FNAME];
+    char          PdbFilePath[MAX_PATH];
+    PSYMBOL_CACHE Cache;
 
 } SYMBOL_LOADED_MODULE_DETAILS, *PSYMBOL_LOADED_MODULE_DETAILS;
 
+/**
+ * @brief The context of enumerating the symbols and the types of a module
+ * for creating its cache
+ *
+ */
+typedef struct _SYMBOL_CACHE_CREATION_CONTEXT
+{
+    PSYMBOL_CACHE_BUILDER Builder;
+    UINT64                ModuleBase;
+
+} SYMBOL_CACHE_CREATION_CONTEXT, *PSYMBOL_CACHE_CREATION_CONTEXT;
+
+/**
+ * @brief A module that is prepared for loading its symbols (its PDB file is
+ * downloaded and its cache is opened) by the threads of the loader
+ *
+ */
+typedef struct _SYMBOL_LOADING_MODULE
+{
+    PMODULE_SYMBOL_DETAIL Details;
+    BOOLEAN               IsDownloadAttempted;
+    HRESULT               DownloadResult;
+    BOOLEAN               IsPdbAvailable;
+    string                PdbFilePath;
+    string                CustomModuleName; // empty if the module is loaded by its own name
+    string                CacheDir;         // empty if the cache is not used for the module
+    string                CachePath;
+    DWORD                 PdbFileSize;
+    PSYMBOL_CACHE         Cache; // NULL if the cache is not found (or it's taken by the loaded module)
+
+} SYMBOL_LOADING_MODULE, *PSYMBOL_LOADING_MODULE;
+
+/**
+ * @brief The modules that are loaded by SymbolInitLoad
+ *
+ */
+typedef struct _SYMBOL_LOADING_CONTEXT
+{
+    std::vector<SYMBOL_LOADING_MODULE> Modules;
+    string                             SymDir;
+    string                             SymPath;
+    BOOLEAN                            DownloadIfAvailable;
+    BOOLEAN                            IsSilentLoad;
+
+} SYMBOL_LOADING_CONTEXT, *PSYMBOL_LOADING_CONTEXT;
+
 //////////////////////////////////////////////////
 //				Exports & Imports               //
 //////////////////////////////////////////////////
@@ -74,5 +121,20 @@ SymShowSymbolDetails(SYMBOL_INFO & SymInfo);
 const char *
 SymTagStr(ULONG Tag);
 
+VOID
+SymDeliverCachedDisassemblerSymbolMapCallback(const CHAR * Name, UINT64 Rva, UINT32 Size, PVOID Context);
+
+BOOL CALLBACK
+SymAddSymbolToCacheCallback(SYMBOL_INFO * SymInfo, ULONG SymbolSize, PVOID UserContext);
+
+BOOL CALLBACK
+SymAddTypeToCacheCallback(SYMBOL_INFO * SymInfo, ULONG SymbolSize, PVOID UserContext);
+
+VOID
+SymPrepareModuleSymbolCallback(UINT32 Index, PVOID Context);
+
+VOID
+SymMergeModuleSymbolCallback(UINT32 Index, PVOID Context);
+
 BOOLEAN
-SymbolPdbDownload(std::string SymName, const std::string & GUID, const std::string & SymPath, BOOLEAN IsSilentLoad);
+SymbolPdbDownload(std::string SymName, const std::string & GUID, const std::string & SymPath, HRESULT * DownloadResult);
@@ -29,6 +29,10 @@ using namespace std;
 #include <sstream>
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <strsafe.h>
 #define _NO_CVCONST_H // for symbol parsing
 #include <DbgHelp.h>
@@ -50,6 +54,8 @@ typedef RFLAGS * PRFLAGS;
 #include "config/Definition.h"
 #include "SDK/imports/user/HyperDbgLibImports.h"
 #include "../symbol-parser/header/common-utils.h"
+#include "../symbol-parser/header/symbol-cache.h"
+#include "../symbol-parser/header/symbol-loader.h"
 #include "../symbol-parser/header/symbol-parser.h"
 
 //